@@ -605,6 +605,33 @@ def sign(data):
     return sign_key.sign(h)
 
 
+DEFINITIONS_KIND_ETHEREUM_TOKENS = 1
+
+
+def serialize_definitions(kind, records, block_size=1024):
+    """Serialize a signed definitions blob, see core/src/apps/common/definitions.py
+
+    `records` maps the keys to the values, all keys have the same length and
+    the values are padded to the longest one.
+    """
+    key_size = len(next(iter(records)))
+    value_size = max(len(v) for v in records.values())
+    record_size = key_size + value_size
+    per_block = max(1, block_size // record_size)
+    table = [k + v.ljust(value_size, b"\0") for k, v in sorted(records.items())]
+
+    header = b"trdf" + struct.pack(
+        "<BBBBIHH", 1, kind, key_size, record_size, len(table), per_block, 0
+    )
+    index = b""
+    blocks = b""
+    for i in range(0, len(table), per_block):
+        block = b"".join(table[i : i + per_block])
+        index += table[i][:key_size] + sha256(block).digest()
+        blocks += block
+    return header + index + sign(header + index) + blocks
+
+
 # ====== click command handlers ======
 
 
@@ -879,6 +906,28 @@ def coindefs(outfile):
         outfile.write("\n")
 
 
+@cli.command()
+@click.option(
+    "-o", "--outfile", type=click.File(mode="wb"), default="./ethereum_tokens.dat"
+)
+def definitions(outfile):
+    """Generate the signed Ethereum token definitions blob for the SD card
+
+    Trezor T looks up the tokens that are not built in the firmware in this blob,
+    stored as trezor/definitions/ethereum_tokens.dat on the SD card.
+    """
+    records = {}
+    for token in coin_info.coin_info().erc20:
+        key = token["chain_id"].to_bytes(4, "big") + token["address_bytes"]
+        symbol = token["symbol"].encode()
+        if key in records or len(symbol) > 255 or token["decimals"] > 255:
+            continue
+        records[key] = bytes([token["decimals"], len(symbol)]) + symbol
+
+    with outfile:
+        outfile.write(serialize_definitions(DEFINITIONS_KIND_ETHEREUM_TOKENS, records))
+
+
 @cli.command()
 # fmt: off
 @click.argument("paths", metavar="[path]...", nargs=-1)
@@ -0,0 +1,479 @@
+/*
+ * This file is part of the Trezor project, https://trezor.io/
+ *
+ * Copyright (c) SatoshiLabs
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Runs the crypto and storage benchmarks on the device and reports the CPU
+// cycles per operation over the USB virtual COM port, one result per line:
+//
+//   <name> <iterations> <cycles/op>
+//
+// followed by OK. The commands are PING, LIST and BENCH [substring].
+//
+// The storage benchmarks wipe the storage of the installed firmware.
+
+#include <string.h>
+
+#include STM32_HAL_H
+
+#include "common.h"
+#include "display.h"
+#include "mini_printf.h"
+#include "secbool.h"
+#include "usb.h"
+
+#include "aes/aes.h"
+#include "bip32.h"
+#include "blake2b.h"
+#include "chacha20poly1305/rfc7539.h"
+#include "curves.h"
+#include "ecdsa.h"
+#include "ed25519-donna/ed25519.h"
+#include "hmac.h"
+#include "memzero.h"
+#include "nist256p1.h"
+#include "pbkdf2.h"
+#include "ripemd160.h"
+#include "secp256k1.h"
+#include "sha2.h"
+#include "sha3.h"
+#include "storage.h"
+
+enum { VCP_IFACE = 0x00 };
+
+static void vcp_intr(void) {
+  display_clear();
+  ensure(secfalse, "vcp_intr");
+}
+
+static void vcp_puts(const char *s, size_t len) {
+  int r = usb_vcp_write_blocking(VCP_IFACE, (const uint8_t *)s, len, -1);
+  (void)r;
+}
+
+static char vcp_getchar(void) {
+  uint8_t c = 0;
+  int r = usb_vcp_read_blocking(VCP_IFACE, &c, 1, -1);
+  (void)r;
+  return (char)c;
+}
+
+static void vcp_readline(char *buf, size_t len) {
+  for (;;) {
+    char c = vcp_getchar();
+    if (c == '\r') {
+      vcp_puts("\r\n", 2);
+      break;
+    }
+    if (c < 32 || c > 126) {  // not printable
+      continue;
+    }
+    if (len > 1) {  // leave space for \0
+      *buf = c;
+      buf++;
+      len--;
+      vcp_puts(&c, 1);
+    }
+  }
+  if (len > 0) {
+    *buf = '\0';
+  }
+}
+
+static void vcp_printf(const char *fmt, ...) {
+  static char buf[128];
+  va_list va;
+  va_start(va, fmt);
+  int r = mini_vsnprintf(buf, sizeof(buf), fmt, va);
+  va_end(va);
+  vcp_puts(buf, r);
+  vcp_puts("\r\n", 2);
+}
+
+static void usb_init_all(void) {
+  enum {
+    VCP_PACKET_LEN = 64,
+    VCP_BUFFER_LEN = 1024,
+  };
+
+  static const usb_dev_info_t dev_info = {
+      .device_class = 0xEF,     // Composite Device Class
+      .device_subclass = 0x02,  // Common Class
+      .device_protocol = 0x01,  // Interface Association Descriptor
+      .vendor_id = 0x1209,
+      .product_id = 0x53C1,
+      .release_num = 0x0400,
+      .manufacturer = "SatoshiLabs",
+      .product = "TREZOR",
+      .serial_number = "000000000000",
+      .interface = "TREZOR Interface",
+      .usb21_enabled = secfalse,
+      .usb21_landing = secfalse,
+  };
+
+  static uint8_t tx_packet[VCP_PACKET_LEN];
+  static uint8_t tx_buffer[VCP_BUFFER_LEN];
+  static uint8_t rx_packet[VCP_PACKET_LEN];
+  static uint8_t rx_buffer[VCP_BUFFER_LEN];
+
+  static const usb_vcp_info_t vcp_info = {
+      .tx_packet = tx_packet,
+      .tx_buffer = tx_buffer,
+      .rx_packet = rx_packet,
+      .rx_buffer = rx_buffer,
+      .tx_buffer_len = VCP_BUFFER_LEN,
+      .rx_buffer_len = VCP_BUFFER_LEN,
+      .rx_intr_fn = vcp_intr,
+      .rx_intr_byte = 3,  // Ctrl-C
+      .iface_num = VCP_IFACE,
+      .data_iface_num = 0x01,
+      .ep_cmd = 0x82,
+      .ep_in = 0x81,
+      .ep_out = 0x01,
+      .polling_interval = 10,
+      .max_packet_len = VCP_PACKET_LEN,
+  };
+
+  usb_init(&dev_info);
+  ensure(usb_vcp_add(&vcp_info), "usb_vcp_add");
+  usb_start();
+}
+
+static uint8_t msg[256];
+static uint8_t data[1024];
+
+static const uint8_t priv[32] = {
+    0xc5, 0x5e, 0xce, 0x85, 0x8b, 0x0d, 0xdd, 0x52, 0x63, 0xf9, 0x68,
+    0x10, 0xfe, 0x14, 0x43, 0x7c, 0xd3, 0xb5, 0xe1, 0xfb, 0xd7, 0xc6,
+    0xa2, 0xec, 0x1e, 0x03, 0x1f, 0x05, 0xe8, 0x6d, 0x8b, 0xd5,
+};
+
+static void bench_sha256_1k(int iterations) {
+  uint8_t digest[SHA256_DIGEST_LENGTH];
+  for (int i = 0; i < iterations; i++) {
+    sha256_Raw(data, sizeof(data), digest);
+  }
+}
+
+static void bench_sha512_1k(int iterations) {
+  uint8_t digest[SHA512_DIGEST_LENGTH];
+  for (int i = 0; i < iterations; i++) {
+    sha512_Raw(data, sizeof(data), digest);
+  }
+}
+
+static void bench_keccak_256_1k(int iterations) {
+  uint8_t digest[SHA3_256_DIGEST_LENGTH];
+  for (int i = 0; i < iterations; i++) {
+    keccak_256(data, sizeof(data), digest);
+  }
+}
+
+static void bench_blake2b_1k(int iterations) {
+  uint8_t digest[BLAKE2B_OUTBYTES];
+  for (int i = 0; i < iterations; i++) {
+    blake2b(data, sizeof(data), digest, sizeof(digest));
+  }
+}
+
+static void bench_ripemd160_1k(int iterations) {
+  uint8_t digest[RIPEMD160_DIGEST_LENGTH];
+  for (int i = 0; i < iterations; i++) {
+    ripemd160(data, sizeof(data), digest);
+  }
+}
+
+static void bench_hmac_sha512_1k(int iterations) {
+  uint8_t mac[SHA512_DIGEST_LENGTH];
+  for (int i = 0; i < iterations; i++) {
+    hmac_sha512(priv, sizeof(priv), data, sizeof(data), mac);
+  }
+}
+
+// One PIN unlock in storage.c derives two blocks with 20000 iterations each.
+static void bench_pbkdf2_hmac_sha256_pin(int iterations) {
+  uint8_t key[64];
+  for (int i = 0; i < iterations; i++) {
+    pbkdf2_hmac_sha256(data, 4, data + 4, 80, 20000, key, sizeof(key));
+  }
+}
+
+static void bench_aes256_cbc_1k(int iterations) {
+  static uint8_t out[sizeof(data)];
+  uint8_t iv[AES_BLOCK_SIZE] = {0};
+  aes_encrypt_ctx ctx;
+  aes_encrypt_key256(priv, &ctx);
+  for (int i = 0; i < iterations; i++) {
+    aes_cbc_encrypt(data, out, sizeof(data), iv, &ctx);
+  }
+}
+
+static void bench_chacha20poly1305_1k(int iterations) {
+  static uint8_t out[sizeof(data)];
+  uint8_t mac[16];
+  chacha20poly1305_ctx ctx;
+  for (int i = 0; i < iterations; i++) {
+    rfc7539_init(&ctx, priv, msg);
+    chacha20poly1305_encrypt(&ctx, data, out, sizeof(data));
+    rfc7539_finish(&ctx, 0, sizeof(data), mac);
+  }
+}
+
+static void bench_sign(const ecdsa_curve *curve, int iterations) {
+  uint8_t sig[64], pby;
+  for (int i = 0; i < iterations; i++) {
+    ecdsa_sign(curve, HASHER_SHA2, priv, msg, sizeof(msg), sig, &pby, NULL);
+  }
+}
+
+static uint8_t verify_sig[64], verify_pub[33];
+
+static void prepare_verify(const ecdsa_curve *curve) {
+  uint8_t pby;
+  ecdsa_get_public_key33(curve, priv, verify_pub);
+  ecdsa_sign(curve, HASHER_SHA2, priv, msg, sizeof(msg), verify_sig, &pby,
+             NULL);
+}
+
+static void bench_verify(const ecdsa_curve *curve, int iterations) {
+  for (int i = 0; i < iterations; i++) {
+    ecdsa_verify(curve, HASHER_SHA2, verify_pub, verify_sig, msg, sizeof(msg));
+  }
+}
+
+static void prepare_verify_secp256k1(void) { prepare_verify(&secp256k1); }
+
+static void prepare_verify_nist256p1(void) { prepare_verify(&nist256p1); }
+
+static void bench_sign_secp256k1(int iterations) {
+  bench_sign(&secp256k1, iterations);
+}
+
+static void bench_verify_secp256k1(int iterations) {
+  bench_verify(&secp256k1, iterations);
+}
+
+static void bench_sign_nist256p1(int iterations) {
+  bench_sign(&nist256p1, iterations);
+}
+
+static void bench_verify_nist256p1(int iterations) {
+  bench_verify(&nist256p1, iterations);
+}
+
+static ed25519_public_key ed25519_pk;
+static ed25519_signature ed25519_sig;
+
+static void prepare_ed25519(void) {
+  ed25519_publickey(priv, ed25519_pk);
+  ed25519_sign(msg, sizeof(msg), priv, ed25519_pk, ed25519_sig);
+}
+
+static void bench_sign_ed25519(int iterations) {
+  for (int i = 0; i < iterations; i++) {
+    ed25519_sign(msg, sizeof(msg), priv, ed25519_pk, ed25519_sig);
+  }
+}
+
+static void bench_verify_ed25519(int iterations) {
+  for (int i = 0; i < iterations; i++) {
+    ed25519_sign_open(msg, sizeof(msg), ed25519_pk, ed25519_sig);
+  }
+}
+
+static void bench_multiply_curve25519(int iterations) {
+  uint8_t result[32];
+  for (int i = 0; i < iterations; i++) {
+    curve25519_scalarmult_basepoint(result, priv);
+  }
+}
+
+static HDNode root;
+
+static void prepare_ckd(void) {
+  hdnode_from_seed(priv, sizeof(priv), SECP256K1_NAME, &root);
+}
+
+// One hardened and one normal step of a BIP-44 path with the public key.
+static void bench_ckd_secp256k1(int iterations) {
+  HDNode node;
+  for (int i = 0; i < iterations; i++) {
+    memcpy(&node, &root, sizeof(HDNode));
+    hdnode_private_ckd_prime(&node, 0);
+    hdnode_private_ckd(&node, i);
+    hdnode_fill_public_key(&node);
+  }
+  memzero(&node, sizeof(node));
+}
+
+static const uint8_t storage_salt[] = {0x67, 0xce, 0x6a, 0xe8, 0xf7, 0x9b,
+                                       0x73, 0x96, 0x83, 0x88, 0x21, 0x5e};
+
+#define STORAGE_PIN_EMPTY 1
+#define STORAGE_KEY 0x0101
+#define STORAGE_COUNTER_KEY 0xC001
+
+static void storage_prepare(void) {
+  storage_init(NULL, storage_salt, sizeof(storage_salt));
+  storage_wipe();
+  ensure(storage_unlock(STORAGE_PIN_EMPTY, NULL), "storage_unlock");
+  ensure(storage_set(STORAGE_KEY, msg, 32), "storage_set");
+  ensure(storage_set_counter(STORAGE_COUNTER_KEY, 0), "storage_set_counter");
+}
+
+static void bench_storage_unlock(int iterations) {
+  for (int i = 0; i < iterations; i++) {
+    storage_lock();
+    storage_unlock(STORAGE_PIN_EMPTY, NULL);
+  }
+}
+
+static void bench_storage_get(int iterations) {
+  uint8_t val[32];
+  uint16_t len = 0;
+  for (int i = 0; i < iterations; i++) {
+    storage_get(STORAGE_KEY, val, sizeof(val), &len);
+  }
+}
+
+static void bench_storage_set(int iterations) {
+  for (int i = 0; i < iterations; i++) {
+    msg[0] = i;
+    storage_set(STORAGE_KEY, msg, 32);
+  }
+}
+
+static void bench_storage_next_counter(int iterations) {
+  uint32_t count = 0;
+  for (int i = 0; i < iterations; i++) {
+    storage_next_counter(STORAGE_COUNTER_KEY, &count);
+  }
+}
+
+typedef struct {
+  void (*prepare)(void);  // not measured, may be NULL
+  void (*func)(int);
+  const char *name;
+  int iterations;
+} benchmark_t;
+
+#define BENCH(PREPARE, NAME, ITER) \
+  { PREPARE, bench_##NAME, #NAME, ITER }
+
+// A whole run of a benchmark has to take less than 2^32 cycles (25 s at
+// 168 MHz), when the cycle counter wraps.
+static const benchmark_t benchmarks[] = {
+    BENCH(NULL, sha256_1k, 100),
+    BENCH(NULL, sha512_1k, 100),
+    BENCH(NULL, keccak_256_1k, 100),
+    BENCH(NULL, blake2b_1k, 100),
+    BENCH(NULL, ripemd160_1k, 100),
+    BENCH(NULL, hmac_sha512_1k, 100),
+    BENCH(NULL, pbkdf2_hmac_sha256_pin, 1),
+    BENCH(NULL, aes256_cbc_1k, 100),
+    BENCH(NULL, chacha20poly1305_1k, 100),
+    BENCH(NULL, sign_secp256k1, 10),
+    BENCH(prepare_verify_secp256k1, verify_secp256k1, 10),
+    BENCH(NULL, sign_nist256p1, 10),
+    BENCH(prepare_verify_nist256p1, verify_nist256p1, 10),
+    BENCH(prepare_ed25519, sign_ed25519, 10),
+    BENCH(prepare_ed25519, verify_ed25519, 10),
+    BENCH(NULL, multiply_curve25519, 10),
+    BENCH(prepare_ckd, ckd_secp256k1, 10),
+    BENCH(storage_prepare, storage_unlock, 2),
+    BENCH(storage_prepare, storage_get, 100),
+    BENCH(storage_prepare, storage_set, 100),
+    BENCH(storage_prepare, storage_next_counter, 100),
+};
+
+static void cycles_start(void) {
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static void run_benchmarks(const char *filter) {
+  for (size_t i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++) {
+    const benchmark_t *b = &benchmarks[i];
+    if (filter[0] != '\0' && strstr(b->name, filter) == NULL) {
+      continue;
+    }
+    if (b->prepare != NULL) {
+      b->prepare();
+    }
+    cycles_start();
+    b->func(b->iterations);
+    uint32_t cycles = DWT->CYCCNT;
+    vcp_printf("%s %d %d", b->name, b->iterations,
+               (int)(cycles / b->iterations));
+  }
+  vcp_printf("OK");
+}
+
+static void list_benchmarks(void) {
+  for (size_t i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++) {
+    vcp_printf("%s", benchmarks[i].name);
+  }
+  vcp_printf("OK");
+}
+
+static secbool startswith(const char *s, const char *prefix) {
+  return sectrue * (0 == strncmp(s, prefix, strlen(prefix)));
+}
+
+#define BACKLIGHT_NORMAL 150
+
+int main(void) {
+  display_orientation(0);
+  usb_init_all();
+
+  for (size_t i = 0; i < sizeof(msg); i++) {
+    msg[i] = i * 1103515245;
+  }
+  for (size_t i = 0; i < sizeof(data); i++) {
+    data[i] = i;
+  }
+
+  display_clear();
+  display_text_center(DISPLAY_RESX / 2, DISPLAY_RESY / 2, "BENCHMARK", -1,
+                      FONT_BOLD, COLOR_WHITE, COLOR_BLACK);
+  display_fade(0, BACKLIGHT_NORMAL, 1000);
+
+  char line[128];
+
+  for (;;) {
+    vcp_readline(line, sizeof(line));
+
+    if (startswith(line, "PING")) {
+      vcp_printf("OK");
+
+    } else if (startswith(line, "LIST")) {
+      list_benchmarks();
+
+    } else if (startswith(line, "BENCH ")) {
+      run_benchmarks(line + 6);
+
+    } else if (startswith(line, "BENCH")) {
+      run_benchmarks("");
+
+    } else {
+      vcp_printf("UNKNOWN");
+    }
+  }
+
+  return 0;
+}
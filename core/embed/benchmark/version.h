@@ -0,0 +1,9 @@
+#define VERSION_MAJOR 0
+#define VERSION_MINOR 1
+#define VERSION_PATCH 0
+#define VERSION_BUILD 0
+
+#define FIX_VERSION_MAJOR 0
+#define FIX_VERSION_MINOR 1
+#define FIX_VERSION_PATCH 0
+#define FIX_VERSION_BUILD 0
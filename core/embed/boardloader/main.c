@@ -19,6 +19,7 @@
 
 #include <string.h>
 
+#include "boottime.h"
 #include "common.h"
 #include "display.h"
 #include "flash.h"
@@ -166,6 +167,9 @@ static secbool copy_sdcard(void) {
 }
 
 int main(void) {
+  boottime_start();
+  boottime_mark(BOOTTIME_BOARDLOADER);
+
   if (sectrue != reset_flags_check()) {
     return 1;
   }
@@ -205,6 +209,8 @@ int main(void) {
   ensure(check_image_contents(&hdr, IMAGE_HEADER_SIZE, sectors, 1),
          "invalid bootloader hash");
 
+  boottime_mark(BOOTTIME_BOARDLOADER_CHECKED);
+
   jump_to(BOOTLOADER_START + IMAGE_HEADER_SIZE);
 
   return 0;
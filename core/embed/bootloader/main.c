@@ -20,6 +20,7 @@
 #include <string.h>
 #include <sys/types.h>
 
+#include "boottime.h"
 #include "common.h"
 #include "display.h"
 #include "flash.h"
@@ -67,6 +68,7 @@ static void usb_init_all(secbool usb21_landing) {
   };
 
   static uint8_t rx_buffer[USB_PACKET_SIZE];
+  static uint8_t tx_buffer[USB_PACKET_SIZE];
 
   static const usb_webusb_info_t webusb_info = {
       .iface_num = USB_IFACE_NUM,
@@ -76,6 +78,9 @@ static void usb_init_all(secbool usb21_landing) {
       .protocol = 0,
       .max_packet_len = sizeof(rx_buffer),
       .rx_buffer = rx_buffer,
+      .tx_buffer = tx_buffer,
+      .rx_queue_len = 1,
+      .tx_queue_len = 1,
       .polling_interval = 1,
   };
 
@@ -235,7 +240,31 @@ static void check_bootloader_version(void) {
 
 #endif
 
+#ifdef BOOT_TIMING
+
+// Build with CFLAGS=-DBOOT_TIMING to list how long each boot stage took before
+// the firmware is started. Non-production builds only, see boottime.h.
+
+static void boot_stages_show(void) {
+  static const char *const names[] = {
+      "init",           "touch wait", "vendor header", "image header",
+      "image contents", "recheck",    "boot screen",
+  };
+  display_backlight(255);
+  uint32_t start = boottime_get(BOOTTIME_BOOTLOADER);
+  for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+    uint32_t end = boottime_get(BOOTTIME_BOOTLOADER_INIT + i);
+    display_printf("%s: %d ms\n", names[i], (int)(end - start));
+    start = end;
+  }
+  hal_delay(3000);
+}
+
+#endif
+
 int main(void) {
+  boottime_mark(BOOTTIME_BOOTLOADER);
+
   drbg_init();
   touch_init();
   touch_power_on();
@@ -248,6 +277,8 @@ int main(void) {
 
 main_start:
 
+  boottime_mark(BOOTTIME_BOOTLOADER_INIT);
+
   display_clear();
 
   // delay to detect touch
@@ -260,6 +291,8 @@ main_start:
     hal_delay(1);
   }
 
+  boottime_mark(BOOTTIME_BOOTLOADER_TOUCH_WAIT);
+
   vendor_header vhdr;
   image_header hdr;
   secbool firmware_present;
@@ -271,16 +304,19 @@ main_start:
   if (sectrue == firmware_present) {
     firmware_present = check_vendor_keys_lock(&vhdr);
   }
+  boottime_mark(BOOTTIME_BOOTLOADER_VENDOR_HEADER);
   if (sectrue == firmware_present) {
     firmware_present = load_image_header(
         (const uint8_t *)(FIRMWARE_START + vhdr.hdrlen), FIRMWARE_IMAGE_MAGIC,
         FIRMWARE_IMAGE_MAXSIZE, vhdr.vsig_m, vhdr.vsig_n, vhdr.vpub, &hdr);
   }
+  boottime_mark(BOOTTIME_BOOTLOADER_IMAGE_HEADER);
   if (sectrue == firmware_present) {
     firmware_present =
         check_image_contents(&hdr, IMAGE_HEADER_SIZE + vhdr.hdrlen,
                              FIRMWARE_SECTORS, FIRMWARE_SECTORS_COUNT);
   }
+  boottime_mark(BOOTTIME_BOOTLOADER_IMAGE_CONTENTS);
 
   // start the bootloader if no or broken firmware found ...
   if (firmware_present != sectrue) {
@@ -369,6 +405,8 @@ main_start:
                               FIRMWARE_SECTORS, FIRMWARE_SECTORS_COUNT),
          "invalid firmware hash");
 
+  boottime_mark(BOOTTIME_BOOTLOADER_CHECKED);
+
   // if all VTRUST flags are unset = ultimate trust => skip the procedure
 
   if ((vhdr.vtrust & VTRUST_ALL) != VTRUST_ALL) {
@@ -395,6 +433,11 @@ main_start:
     ui_fadeout();
   }
 
+  boottime_mark(BOOTTIME_BOOTLOADER_BOOT_SCREEN);
+#ifdef BOOT_TIMING
+  boot_stages_show();
+#endif
+
   // mpu_config_firmware();
   // jump_to_unprivileged(FIRMWARE_START + vhdr.hdrlen + IMAGE_HEADER_SIZE);
 
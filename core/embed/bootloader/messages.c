@@ -35,6 +35,7 @@
 #include "messages.h"
 
 #include "memzero.h"
+#include "uzlib.h"
 
 #define MSG_HEADER1_LEN 9
 #define MSG_HEADER2_LEN 1
@@ -326,18 +327,83 @@ void process_msg_Ping(uint8_t iface_num, uint32_t msg_size, uint8_t *buf) {
   MSG_SEND(Success);
 }
 
+secbool load_vendor_header_keys(const uint8_t *const data,
+                                vendor_header *const vhdr);
+
 static uint32_t firmware_remaining, firmware_block, chunk_requested;
 
+// FirmwareUpload payloads of this upload are raw deflate streams, each one
+// decompressing to the requested chunk
+static bool firmware_compressed = false;
+
+// FirmwareUpload payloads of this upload are patches against the installed
+// firmware, which is then rewritten in place block by block
+static bool firmware_delta = false;
+
+static secbool check_installed_firmware(void) {
+  vendor_header vhdr;
+  image_header hdr;
+  if (sectrue !=
+      load_vendor_header_keys((const uint8_t *)FIRMWARE_START, &vhdr)) {
+    return secfalse;
+  }
+  if (sectrue !=
+      load_image_header((const uint8_t *)FIRMWARE_START + vhdr.hdrlen,
+                        FIRMWARE_IMAGE_MAGIC, FIRMWARE_IMAGE_MAXSIZE,
+                        vhdr.vsig_m, vhdr.vsig_n, vhdr.vpub, &hdr)) {
+    return secfalse;
+  }
+  return check_image_contents(&hdr, IMAGE_HEADER_SIZE + vhdr.hdrlen,
+                              FIRMWARE_SECTORS, FIRMWARE_SECTORS_COUNT);
+}
+
+// Firmware sectors of the first flash bank are erased before the upload, the
+// ones of the second bank only while the chunk before them is transferred.
+// The bootloader runs from the first bank, so USB keeps working meanwhile.
+static int firmware_erase_pending = -1;
+
+static uint32_t firmware_bank1_blocks(void) {
+  uint32_t blocks = 0;
+  while (blocks < FIRMWARE_SECTORS_COUNT &&
+         FIRMWARE_SECTORS[blocks] < FLASH_SECTOR_BANK2_START) {
+    blocks++;
+  }
+  return blocks;
+}
+
+static secbool firmware_erase_block(uint32_t block) {
+  if (firmware_erase_pending == (int)block) {
+    firmware_erase_pending = -1;
+    return flash_erase_finish(FIRMWARE_SECTORS[block]);
+  }
+  if (block < firmware_bank1_blocks() && !firmware_delta) {
+    return sectrue;  // erased before the upload
+  }
+  return flash_erase_sectors(FIRMWARE_SECTORS + block, 1, NULL);
+}
+
 void process_msg_FirmwareErase(uint8_t iface_num, uint32_t msg_size,
                                uint8_t *buf) {
   firmware_remaining = 0;
   firmware_block = 0;
   chunk_requested = 0;
+  firmware_compressed = false;
+  firmware_delta = false;
+  if (firmware_erase_pending >= 0) {
+    // an earlier upload was abandoned while erasing
+    ensure(flash_erase_finish(FIRMWARE_SECTORS[firmware_erase_pending]), NULL);
+    firmware_erase_pending = -1;
+  }
 
   MSG_RECV_INIT(FirmwareErase);
   MSG_RECV(FirmwareErase);
 
   firmware_remaining = msg_recv.has_length ? msg_recv.length : 0;
+  // a patch needs an intact firmware to be applied to
+  firmware_delta = msg_recv.has_delta && msg_recv.delta &&
+                   sectrue == check_installed_firmware();
+  firmware_compressed =
+      !firmware_delta && msg_recv.has_compressed && msg_recv.compressed;
   if ((firmware_remaining > 0) &&
       ((firmware_remaining % sizeof(uint32_t)) == 0) &&
       (firmware_remaining <= (FIRMWARE_SECTORS_COUNT * IMAGE_CHUNK_SIZE))) {
@@ -348,6 +414,12 @@ void process_msg_FirmwareErase(uint8_t iface_num, uint32_t msg_size,
     MSG_SEND_INIT(FirmwareRequest);
     MSG_SEND_ASSIGN_VALUE(offset, 0);
     MSG_SEND_ASSIGN_VALUE(length, chunk_requested);
+    // confirm that compressed or delta chunks are understood
+    if (firmware_delta) {
+      MSG_SEND_ASSIGN_VALUE(delta, true);
+    } else if (firmware_compressed) {
+      MSG_SEND_ASSIGN_VALUE(compressed, true);
+    }
     MSG_SEND(FirmwareRequest);
   } else {
     // invalid firmware size
@@ -362,6 +434,160 @@ static uint32_t chunk_size = 0;
 // SRAM is unused, so we can use it for chunk buffer
 uint8_t *const chunk_buffer = (uint8_t *const)0x20000000;
 
+static void _update_upload_progress(uint32_t chunk_written) {
+  // update loader but skip first block
+  if (firmware_block > 0) {
+    ui_screen_install_progress_upload(
+        250 + 750 * (firmware_block * IMAGE_CHUNK_SIZE + chunk_written) /
+                  (firmware_block * IMAGE_CHUNK_SIZE + firmware_remaining));
+  }
+}
+
+static pb_istream_t *inflate_stream = NULL;
+static uint8_t inflate_buffer[1024];
+static uint32_t inflate_progress = 0;
+
+// uzlib asks for more input whenever it has consumed inflate_buffer
+static int _inflate_read(struct uzlib_uncomp *decomp) {
+  const uint32_t chunk_written = decomp->dest - chunk_buffer;
+  if (chunk_written >= inflate_progress + 32768) {
+    inflate_progress = chunk_written;
+    _update_upload_progress(chunk_written);
+  }
+  const size_t len = MIN(inflate_stream->bytes_left, sizeof(inflate_buffer));
+  if (len == 0 || !pb_read(inflate_stream, inflate_buffer, len)) {
+    return -1;
+  }
+  decomp->source = inflate_buffer + 1;
+  decomp->source_limit = inflate_buffer + len;
+  return inflate_buffer[0];
+}
+
+// Decompresses the payload straight into the chunk buffer, the chunk is then
+// hashed and written to flash as if it had been sent uncompressed.
+static bool _inflate_payload(pb_istream_t *stream, uint32_t offset) {
+  chunk_size = 0;
+  if (offset + chunk_requested > IMAGE_CHUNK_SIZE) {
+    return false;
+  }
+
+  if (offset == 0) {
+    // clear chunk buffer
+    memset(chunk_buffer, 0xFF, IMAGE_CHUNK_SIZE);
+  }
+
+  struct uzlib_uncomp decomp;
+  memzero(&decomp, sizeof(decomp));
+  decomp.source_read_cb = _inflate_read;
+  decomp.dest = chunk_buffer + offset;
+  decomp.dest_limit = chunk_buffer + offset + chunk_requested;
+  uzlib_uncompress_init(&decomp, NULL, 0);
+
+  inflate_stream = stream;
+  inflate_progress = offset;
+  int st = uzlib_uncompress(&decomp);
+  inflate_stream = NULL;
+  if (st < 0 || decomp.dest != decomp.dest_limit) {
+    return false;
+  }
+
+  // skip what is left of the stream, e.g. its final end-of-block code
+  if (!pb_read(stream, NULL, stream->bytes_left)) {
+    return false;
+  }
+
+  chunk_size = offset + chunk_requested;
+  return true;
+}
+
+// A delta chunk is a sequence of operations. DELTA_COPY is followed by
+// a source offset into the installed firmware and a length, DELTA_INSERT by
+// a length and that many bytes of new data. The numbers are little-endian
+// uint32.
+#define DELTA_COPY 0
+#define DELTA_INSERT 1
+
+static uint32_t _read_le32(const uint8_t *p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// The blocks before the one being rebuilt already hold the new firmware, so
+// only the current block and the ones after it can be copied from.
+static bool _delta_copy(uint8_t *dest, uint32_t src, uint32_t len) {
+  while (len > 0) {
+    const uint32_t block = src / IMAGE_CHUNK_SIZE;
+    const uint32_t block_offset = src % IMAGE_CHUNK_SIZE;
+    const uint32_t n = MIN(len, IMAGE_CHUNK_SIZE - block_offset);
+    if (block < firmware_block || block >= FIRMWARE_SECTORS_COUNT) {
+      return false;
+    }
+    const void *p = flash_get_address(FIRMWARE_SECTORS[block], block_offset, n);
+    if (p == NULL) {
+      return false;
+    }
+    memcpy(dest, p, n);
+    dest += n;
+    src += n;
+    len -= n;
+  }
+  return true;
+}
+
+static bool _patch_payload(pb_istream_t *stream, uint32_t offset) {
+  chunk_size = 0;
+  if (offset + chunk_requested > IMAGE_CHUNK_SIZE) {
+    return false;
+  }
+
+  if (offset == 0) {
+    // clear chunk buffer
+    memset(chunk_buffer, 0xFF, IMAGE_CHUNK_SIZE);
+  }
+
+  const uint32_t chunk_end = offset + chunk_requested;
+  uint32_t chunk_written = offset;
+  uint32_t progress = offset;
+  while (stream->bytes_left) {
+    if (chunk_written >= progress + 32768) {
+      progress = chunk_written;
+      _update_upload_progress(chunk_written);
+    }
+    uint8_t op[9];
+    uint32_t len = 0;
+    if (!pb_read(stream, op, 1)) {
+      return false;
+    }
+    if (op[0] == DELTA_COPY) {
+      if (!pb_read(stream, op + 1, 8)) {
+        return false;
+      }
+      len = _read_le32(op + 5);
+      if (len > chunk_end - chunk_written ||
+          !_delta_copy(chunk_buffer + chunk_written, _read_le32(op + 1), len)) {
+        return false;
+      }
+    } else if (op[0] == DELTA_INSERT) {
+      if (!pb_read(stream, op + 1, 4)) {
+        return false;
+      }
+      len = _read_le32(op + 1);
+      if (len > chunk_end - chunk_written ||
+          !pb_read(stream, chunk_buffer + chunk_written, len)) {
+        return false;
+      }
+    } else {
+      return false;
+    }
+    chunk_written += len;
+  }
+  if (chunk_written != chunk_end) {
+    return false;
+  }
+
+  chunk_size = chunk_end;
+  return true;
+}
+
 /* we don't use secbool/sectrue/secfalse here as it is a nanopb api */
 static bool _read_payload(pb_istream_t *stream, const pb_field_t *field,
                           void **arg) {
@@ -369,6 +595,13 @@ static bool _read_payload(pb_istream_t *stream, const pb_field_t *field,
 
   uint32_t offset = (uint32_t)(*arg);
 
+  if (firmware_delta) {
+    return _patch_payload(stream, offset);
+  }
+  if (firmware_compressed) {
+    return _inflate_payload(stream, offset);
+  }
+
   if (stream->bytes_left > IMAGE_CHUNK_SIZE) {
     chunk_size = 0;
     return false;
@@ -383,12 +616,7 @@ static bool _read_payload(pb_istream_t *stream, const pb_field_t *field,
   chunk_size = offset + stream->bytes_left;
 
   while (stream->bytes_left) {
-    // update loader but skip first block
-    if (firmware_block > 0) {
-      ui_screen_install_progress_upload(
-          250 + 750 * (firmware_block * IMAGE_CHUNK_SIZE + chunk_written) /
-                    (firmware_block * IMAGE_CHUNK_SIZE + firmware_remaining));
-    }
+    _update_upload_progress(chunk_written);
     // read data
     if (!pb_read(
             stream, (pb_byte_t *)(chunk_buffer + chunk_written),
@@ -402,9 +630,6 @@ static bool _read_payload(pb_istream_t *stream, const pb_field_t *field,
   return true;
 }
 
-secbool load_vendor_header_keys(const uint8_t *const data,
-                                vendor_header *const vhdr);
-
 static int version_compare(uint32_t vera, uint32_t verb) {
   int a, b;
   a = vera & 0xFF;
@@ -559,9 +784,13 @@ int process_msg_FirmwareUpload(uint8_t iface_num, uint32_t msg_size,
             flash_erase_sectors(STORAGE_SECTORS, STORAGE_SECTORS_COUNT, NULL),
             NULL);
       }
-      ensure(flash_erase_sectors(FIRMWARE_SECTORS, FIRMWARE_SECTORS_COUNT,
-                                 ui_screen_install_progress_erase),
-             NULL);
+      // a delta upload still reads from the old firmware, its sectors are
+      // erased one by one just before they are written
+      if (!firmware_delta) {
+        ensure(flash_erase_sectors(FIRMWARE_SECTORS, firmware_bank1_blocks(),
+                                   ui_screen_install_progress_erase),
+               NULL);
+      }
     }
   }
 
@@ -593,14 +822,14 @@ int process_msg_FirmwareUpload(uint8_t iface_num, uint32_t msg_size,
     return -6;
   }
 
+  ensure(firmware_erase_block(firmware_block), NULL);
+
   ensure(flash_unlock_write(), NULL);
 
   const uint32_t *const src = (const uint32_t *const)chunk_buffer;
-  for (int i = 0; i < chunk_size / sizeof(uint32_t); i++) {
-    ensure(flash_write_word(FIRMWARE_SECTORS[firmware_block],
-                            i * sizeof(uint32_t), src[i]),
-           NULL);
-  }
+  ensure(flash_write_block(FIRMWARE_SECTORS[firmware_block], 0, src,
+                           chunk_size / sizeof(uint32_t)),
+         NULL);
 
   ensure(flash_lock_write(), NULL);
 
@@ -617,7 +846,30 @@ int process_msg_FirmwareUpload(uint8_t iface_num, uint32_t msg_size,
     MSG_SEND_ASSIGN_VALUE(offset, firmware_block * IMAGE_CHUNK_SIZE);
     MSG_SEND_ASSIGN_VALUE(length, chunk_requested);
     MSG_SEND(FirmwareRequest);
+    // erase the next sector while the host sends the chunk, unless the chunk
+    // is a patch that may copy from it
+    if (!firmware_delta && firmware_block < FIRMWARE_SECTORS_COUNT &&
+        firmware_block >= firmware_bank1_blocks()) {
+      ensure(flash_erase_start(FIRMWARE_SECTORS[firmware_block]), NULL);
+      firmware_erase_pending = firmware_block;
+    }
   } else {
+    // do not leave a previous firmware in the sectors past the new one
+    uint32_t unused = firmware_block;
+    if (unused < firmware_bank1_blocks()) {
+      unused = firmware_bank1_blocks();
+    }
+    ensure(flash_erase_sectors(FIRMWARE_SECTORS + unused,
+                               FIRMWARE_SECTORS_COUNT - unused, NULL),
+           NULL);
+    // the chunks were checked one by one, check the patched image as a whole
+    if (firmware_delta && sectrue != check_installed_firmware()) {
+      MSG_SEND_INIT(Failure);
+      MSG_SEND_ASSIGN_VALUE(code, FailureType_Failure_ProcessError);
+      MSG_SEND_ASSIGN_STRING(message, "Invalid firmware");
+      MSG_SEND(Failure);
+      return -7;
+    }
     MSG_SEND_INIT(Success);
     MSG_SEND(Success);
   }
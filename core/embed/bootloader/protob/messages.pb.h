@@ -96,6 +96,10 @@ typedef struct _Features {
 typedef struct _FirmwareErase {
     bool has_length;
     uint32_t length;
+    bool has_compressed;
+    bool compressed;
+    bool has_delta;
+    bool delta;
 } FirmwareErase;
 
 typedef struct _FirmwareRequest {
@@ -103,6 +107,10 @@ typedef struct _FirmwareRequest {
     uint32_t offset;
     bool has_length;
     uint32_t length;
+    bool has_compressed;
+    bool compressed;
+    bool has_delta;
+    bool delta;
 } FirmwareRequest;
 
 typedef PB_BYTES_ARRAY_T(32) FirmwareUpload_hash_t;
@@ -144,8 +152,8 @@ typedef struct _Success {
 #define Failure_init_default                     {false, _FailureType_MIN, false, ""}
 #define ButtonRequest_init_default               {false, _ButtonRequestType_MIN}
 #define ButtonAck_init_default                   {0}
-#define FirmwareErase_init_default               {false, 0}
-#define FirmwareRequest_init_default             {false, 0, false, 0}
+#define FirmwareErase_init_default               {false, 0, false, 0, false, 0}
+#define FirmwareRequest_init_default             {false, 0, false, 0, false, 0, false, 0}
 #define FirmwareUpload_init_default              {{{NULL}, NULL}, false, {0, {0}}}
 #define Initialize_init_zero                     {0}
 #define GetFeatures_init_zero                    {0}
@@ -155,8 +163,8 @@ typedef struct _Success {
 #define Failure_init_zero                        {false, _FailureType_MIN, false, ""}
 #define ButtonRequest_init_zero                  {false, _ButtonRequestType_MIN}
 #define ButtonAck_init_zero                      {0}
-#define FirmwareErase_init_zero                  {false, 0}
-#define FirmwareRequest_init_zero                {false, 0, false, 0}
+#define FirmwareErase_init_zero                  {false, 0, false, 0, false, 0}
+#define FirmwareRequest_init_zero                {false, 0, false, 0, false, 0, false, 0}
 #define FirmwareUpload_init_zero                 {{{NULL}, NULL}, false, {0, {0}}}
 
 /* Field tags (for use in manual encoding/decoding) */
@@ -181,8 +189,12 @@ typedef struct _Success {
 #define Features_fw_vendor_tag                   25
 #define Features_fw_vendor_keys_tag              26
 #define FirmwareErase_length_tag                 1
+#define FirmwareErase_compressed_tag             2
+#define FirmwareErase_delta_tag                  3
 #define FirmwareRequest_offset_tag               1
 #define FirmwareRequest_length_tag               2
+#define FirmwareRequest_compressed_tag           3
+#define FirmwareRequest_delta_tag                4
 #define FirmwareUpload_payload_tag               1
 #define FirmwareUpload_hash_tag                  2
 #define Ping_message_tag                         1
@@ -253,13 +265,17 @@ X(a, STATIC,   OPTIONAL, ENUM,     code,              1)
 #define ButtonAck_DEFAULT NULL
 
 #define FirmwareErase_FIELDLIST(X, a) \
-X(a, STATIC,   OPTIONAL, UINT32,   length,            1)
+X(a, STATIC,   OPTIONAL, UINT32,   length,            1) \
+X(a, STATIC,   OPTIONAL, BOOL,     compressed,        2) \
+X(a, STATIC,   OPTIONAL, BOOL,     delta,             3)
 #define FirmwareErase_CALLBACK NULL
 #define FirmwareErase_DEFAULT NULL
 
 #define FirmwareRequest_FIELDLIST(X, a) \
 X(a, STATIC,   OPTIONAL, UINT32,   offset,            1) \
-X(a, STATIC,   OPTIONAL, UINT32,   length,            2)
+X(a, STATIC,   OPTIONAL, UINT32,   length,            2) \
+X(a, STATIC,   OPTIONAL, BOOL,     compressed,        3) \
+X(a, STATIC,   OPTIONAL, BOOL,     delta,             4)
 #define FirmwareRequest_CALLBACK NULL
 #define FirmwareRequest_DEFAULT NULL
 
@@ -303,8 +319,8 @@ extern const pb_msgdesc_t FirmwareUpload_msg;
 #define Failure_size                             269
 #define ButtonRequest_size                       11
 #define ButtonAck_size                           0
-#define FirmwareErase_size                       6
-#define FirmwareRequest_size                     12
+#define FirmwareErase_size                       10
+#define FirmwareRequest_size                     16
 /* FirmwareUpload_size depends on runtime parameters */
 
 #ifdef __cplusplus
@@ -30,6 +30,7 @@
 #include "common.h"
 #include "memzero.h"
 #include "storage.h"
+#include "trace.h"
 
 STATIC mp_obj_t ui_wait_callback = mp_const_none;
 
@@ -82,7 +83,10 @@ STATIC mp_obj_t mod_trezorconfig_unlock(mp_obj_t pin, mp_obj_t ext_salt) {
       mp_raise_msg(&mp_type_ValueError, "Invalid length of external salt.");
   }
 
-  if (sectrue != storage_unlock(pin_i, ext_salt_b.buf)) {
+  trace_event(TRACE_STORAGE_UNLOCK, TRACE_BEGIN);
+  secbool unlocked = storage_unlock(pin_i, ext_salt_b.buf);
+  trace_event(TRACE_STORAGE_UNLOCK, TRACE_END);
+  if (sectrue != unlocked) {
     return mp_const_false;
   }
   return mp_const_true;
@@ -285,7 +289,10 @@ STATIC mp_obj_t mod_trezorconfig_set(size_t n_args, const mp_obj_t *args) {
   uint16_t appkey = (app << 8) | key;
   mp_buffer_info_t value;
   mp_get_buffer_raise(args[2], &value, MP_BUFFER_READ);
-  if (sectrue != storage_set(appkey, value.buf, value.len)) {
+  trace_event(TRACE_STORAGE_SET, TRACE_BEGIN);
+  secbool ret = storage_set(appkey, value.buf, value.len);
+  trace_event(TRACE_STORAGE_SET, TRACE_END);
+  if (sectrue != ret) {
     mp_raise_msg(&mp_type_RuntimeError, "Could not save value");
   }
   return mp_const_none;
@@ -293,6 +300,52 @@ STATIC mp_obj_t mod_trezorconfig_set(size_t n_args, const mp_obj_t *args) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_trezorconfig_set_obj, 3, 4,
                                            mod_trezorconfig_set);
 
+/// def set_many(
+///     app: int, values: Dict[int, bytes], public: bool = False
+/// ) -> None:
+///     """
+///     Sets the values of several keys of given app at once. The values are
+///     appended in one run and the storage authentication tag is updated only
+///     once.
+///     """
+STATIC mp_obj_t mod_trezorconfig_set_many(size_t n_args,
+                                          const mp_obj_t *args) {
+  uint8_t app = trezor_obj_get_uint8(args[0]) & FLAGS_APPID;
+  if (n_args > 2 && args[2] == mp_const_true) {
+    app |= FLAG_PUBLIC;
+  }
+  if (!MP_OBJ_IS_TYPE(args[1], &mp_type_dict)) {
+    mp_raise_TypeError("values must be a dict");
+  }
+  mp_map_t *map = mp_obj_dict_get_map(args[1]);
+  if (map->used > STORAGE_BATCH_MAX) {
+    mp_raise_ValueError("Too many values");
+  }
+
+  uint16_t appkeys[STORAGE_BATCH_MAX] = {0};
+  const void *vals[STORAGE_BATCH_MAX] = {0};
+  uint16_t lens[STORAGE_BATCH_MAX] = {0};
+  uint16_t count = 0;
+  for (size_t i = 0; i < map->alloc; i++) {
+    if (!mp_map_slot_is_filled(map, i)) {
+      continue;
+    }
+    uint8_t key = trezor_obj_get_uint8(map->table[i].key);
+    mp_buffer_info_t value;
+    mp_get_buffer_raise(map->table[i].value, &value, MP_BUFFER_READ);
+    appkeys[count] = (app << 8) | key;
+    vals[count] = value.buf;
+    lens[count] = value.len;
+    count++;
+  }
+  if (sectrue != storage_set_batch(appkeys, vals, lens, count)) {
+    mp_raise_msg(&mp_type_RuntimeError, "Could not save values");
+  }
+  return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_trezorconfig_set_many_obj, 2,
+                                           3, mod_trezorconfig_set_many);
+
 /// def delete(app: int, key: int, public: bool = False) -> bool:
 ///     """
 ///     Deletes the given key of the given app.
@@ -312,6 +365,37 @@ STATIC mp_obj_t mod_trezorconfig_delete(size_t n_args, const mp_obj_t *args) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_trezorconfig_delete_obj, 2, 3,
                                            mod_trezorconfig_delete);
 
+STATIC void iter_mark_key(uint16_t appkey, void *context) {
+  uint8_t *present = context;
+  uint8_t key = appkey & 0xFF;
+  present[key / 8] |= 1 << (key % 8);
+}
+
+/// def iter(app: int, public: bool = False) -> List[int]:
+///     """
+///     Returns the sorted list of the keys of the given app which are set,
+///     using a single pass over the storage.
+///     """
+STATIC mp_obj_t mod_trezorconfig_iter(size_t n_args, const mp_obj_t *args) {
+  uint8_t app = trezor_obj_get_uint8(args[0]) & FLAGS_APPID;
+  if (n_args > 1 && args[1] == mp_const_true) {
+    app |= FLAG_PUBLIC;
+  }
+  uint8_t present[256 / 8] = {0};
+  if (sectrue != storage_iter_app(app, iter_mark_key, present)) {
+    mp_raise_msg(&mp_type_RuntimeError, "Could not list keys");
+  }
+  mp_obj_t keys = mp_obj_new_list(0, NULL);
+  for (int key = 0; key < 256; key++) {
+    if (present[key / 8] & (1 << (key % 8))) {
+      mp_obj_list_append(keys, MP_OBJ_NEW_SMALL_INT(key));
+    }
+  }
+  return keys;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_trezorconfig_iter_obj, 1, 2,
+                                           mod_trezorconfig_iter);
+
 /// def set_counter(
 ///     app: int, key: int, count: int, writable_locked: bool = False
 /// ) -> bool:
@@ -380,6 +464,20 @@ STATIC mp_obj_t mod_trezorconfig_wipe(void) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_0(mod_trezorconfig_wipe_obj,
                                  mod_trezorconfig_wipe);
 
+/// def compact_step() -> bool:
+///     """
+///     Performs one bounded step of incremental storage compaction. Returns
+///     True if more steps are needed to complete it.
+///     """
+STATIC mp_obj_t mod_trezorconfig_compact_step(void) {
+  if (sectrue != storage_compact_step()) {
+    return mp_const_false;
+  }
+  return mp_const_true;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(mod_trezorconfig_compact_step_obj,
+                                 mod_trezorconfig_compact_step);
+
 STATIC const mp_rom_map_elem_t mp_module_trezorconfig_globals_table[] = {
     {MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_trezorconfig)},
     {MP_ROM_QSTR(MP_QSTR_init), MP_ROM_PTR(&mod_trezorconfig_init_obj)},
@@ -402,12 +500,17 @@ STATIC const mp_rom_map_elem_t mp_module_trezorconfig_globals_table[] = {
      MP_ROM_PTR(&mod_trezorconfig_change_wipe_code_obj)},
     {MP_ROM_QSTR(MP_QSTR_get), MP_ROM_PTR(&mod_trezorconfig_get_obj)},
     {MP_ROM_QSTR(MP_QSTR_set), MP_ROM_PTR(&mod_trezorconfig_set_obj)},
+    {MP_ROM_QSTR(MP_QSTR_set_many),
+     MP_ROM_PTR(&mod_trezorconfig_set_many_obj)},
     {MP_ROM_QSTR(MP_QSTR_delete), MP_ROM_PTR(&mod_trezorconfig_delete_obj)},
+    {MP_ROM_QSTR(MP_QSTR_iter), MP_ROM_PTR(&mod_trezorconfig_iter_obj)},
     {MP_ROM_QSTR(MP_QSTR_set_counter),
      MP_ROM_PTR(&mod_trezorconfig_set_counter_obj)},
     {MP_ROM_QSTR(MP_QSTR_next_counter),
      MP_ROM_PTR(&mod_trezorconfig_next_counter_obj)},
     {MP_ROM_QSTR(MP_QSTR_wipe), MP_ROM_PTR(&mod_trezorconfig_wipe_obj)},
+    {MP_ROM_QSTR(MP_QSTR_compact_step),
+     MP_ROM_PTR(&mod_trezorconfig_compact_step_obj)},
 };
 STATIC MP_DEFINE_CONST_DICT(mp_module_trezorconfig_globals,
                             mp_module_trezorconfig_globals_table);
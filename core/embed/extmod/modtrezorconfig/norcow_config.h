@@ -23,6 +23,11 @@
 #include "flash.h"
 
 #define NORCOW_HEADER_LEN 0
+
+/*
+ * The flash sectors used by the storage. Compaction rotates through all of
+ * them, so listing more sectors spreads the erase cycles.
+ */
 #define NORCOW_SECTOR_COUNT 2
 
 #if TREZOR_MODEL == T
@@ -57,18 +57,78 @@
 
 #include "crc.h"
 
+#ifndef TREZOR_EMULATOR
+#include "crc32.h"
+#endif
+
 static const uint32_t crc32tab[16] = {
     0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4,
     0x4db26158, 0x5005713c, 0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
     0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c};
 
-/* crc is previous value for incremental computation, 0xffffffff initially */
-uint32_t checksum_crc32(const uint8_t *data, uint32_t length, uint32_t crc) {
+static uint32_t crc32_bytes(const uint8_t *data, uint32_t length,
+                            uint32_t crc) {
   for (uint32_t i = 0; i < length; ++i) {
     crc ^= data[i];
     crc = crc32tab[crc & 0x0f] ^ (crc >> 4);
     crc = crc32tab[crc & 0x0f] ^ (crc >> 4);
   }
+  return crc;
+}
+
+#ifdef TREZOR_EMULATOR
+
+// slicing-by-8: crc32tab8[k][b] is the CRC of byte b followed by k zero bytes
+static uint32_t crc32tab8[8][256];
+
+static void crc32_init_tables(void) {
+  for (uint32_t b = 0; b < 256; b++) {
+    crc32tab8[0][b] = crc32_bytes((const uint8_t *)"\0", 1, b);
+  }
+  for (uint32_t b = 0; b < 256; b++) {
+    for (int k = 1; k < 8; k++) {
+      uint32_t c = crc32tab8[k - 1][b];
+      crc32tab8[k][b] = crc32tab8[0][c & 0xff] ^ (c >> 8);
+    }
+  }
+}
+
+static uint32_t crc32_slice8(const uint8_t *data, uint32_t length,
+                             uint32_t crc) {
+  if (crc32tab8[0][1] == 0) {
+    crc32_init_tables();
+  }
+  for (; length >= 8; data += 8, length -= 8) {
+    uint32_t lo = crc ^ ((uint32_t)data[0] | ((uint32_t)data[1] << 8) |
+                         ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24));
+    uint32_t hi = (uint32_t)data[4] | ((uint32_t)data[5] << 8) |
+                  ((uint32_t)data[6] << 16) | ((uint32_t)data[7] << 24);
+    crc = crc32tab8[7][lo & 0xff] ^ crc32tab8[6][(lo >> 8) & 0xff] ^
+          crc32tab8[5][(lo >> 16) & 0xff] ^ crc32tab8[4][lo >> 24] ^
+          crc32tab8[3][hi & 0xff] ^ crc32tab8[2][(hi >> 8) & 0xff] ^
+          crc32tab8[1][(hi >> 16) & 0xff] ^ crc32tab8[0][hi >> 24];
+  }
+  return crc32_bytes(data, length, crc);
+}
+
+#endif
+
+/* crc is previous value for incremental computation, 0xffffffff initially */
+uint32_t checksum_crc32(const uint8_t *data, uint32_t length, uint32_t crc) {
+#ifdef TREZOR_EMULATOR
+  crc = crc32_slice8(data, length, crc);
+#else
+  // bytes up to the first word boundary, then whole words in the CRC unit
+  uint32_t head = (-(uintptr_t)data) & 3;
+  if (head > length) {
+    head = length;
+  }
+  crc = crc32_bytes(data, head, crc);
+  data += head;
+  length -= head;
+  crc = crc32_words(crc, (const uint32_t *)data, length / 4);
+  crc = crc32_bytes(data + (length & ~3), length & 3, crc);
+#endif
 
   // return value suitable for passing in next time, for final value invert it
   return crc /* ^ 0xffffffff*/;
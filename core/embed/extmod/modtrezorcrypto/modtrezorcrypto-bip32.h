@@ -25,6 +25,7 @@
 #include "bip39.h"
 #include "curves.h"
 #include "memzero.h"
+#include "trace.h"
 #if !BITCOIN_ONLY
 #include "nem.h"
 #endif
@@ -55,6 +56,7 @@ STATIC const mp_obj_type_t mod_trezorcrypto_HDNode_type;
 ///     private_key: bytes = None,
 ///     public_key: bytes = None,
 ///     curve_name: str = None,
+///     private_key_ext: bytes = None,
 /// ) -> None:
 ///     """
 ///     """
@@ -83,6 +85,9 @@ STATIC mp_obj_t mod_trezorcrypto_HDNode_make_new(const mp_obj_type_t *type,
       {MP_QSTR_curve_name,
        MP_ARG_KW_ONLY | MP_ARG_OBJ,
        {.u_obj = mp_const_empty_bytes}},
+      {MP_QSTR_private_key_ext,
+       MP_ARG_KW_ONLY | MP_ARG_OBJ,
+       {.u_obj = mp_const_empty_bytes}},
   };
   mp_arg_val_t vals[MP_ARRAY_SIZE(allowed_args)];
   mp_arg_parse_all_kw_array(n_args, n_kw, args, MP_ARRAY_SIZE(allowed_args),
@@ -92,6 +97,7 @@ STATIC mp_obj_t mod_trezorcrypto_HDNode_make_new(const mp_obj_type_t *type,
   mp_buffer_info_t private_key;
   mp_buffer_info_t public_key;
   mp_buffer_info_t curve_name;
+  mp_buffer_info_t private_key_ext;
   const uint32_t depth = trezor_obj_get_uint(vals[0].u_obj);
   const uint32_t fingerprint = trezor_obj_get_uint(vals[1].u_obj);
   const uint32_t child_num = trezor_obj_get_uint(vals[2].u_obj);
@@ -99,6 +105,7 @@ STATIC mp_obj_t mod_trezorcrypto_HDNode_make_new(const mp_obj_type_t *type,
   mp_get_buffer_raise(vals[4].u_obj, &private_key, MP_BUFFER_READ);
   mp_get_buffer_raise(vals[5].u_obj, &public_key, MP_BUFFER_READ);
   mp_get_buffer_raise(vals[6].u_obj, &curve_name, MP_BUFFER_READ);
+  mp_get_buffer_raise(vals[7].u_obj, &private_key_ext, MP_BUFFER_READ);
 
   if (32 != chain_code.len) {
     mp_raise_ValueError("chain_code is invalid");
@@ -112,6 +119,9 @@ STATIC mp_obj_t mod_trezorcrypto_HDNode_make_new(const mp_obj_type_t *type,
   if (0 != public_key.len && 33 != public_key.len) {
     mp_raise_ValueError("public_key is invalid");
   }
+  if (0 != private_key_ext.len && 32 != private_key_ext.len) {
+    mp_raise_ValueError("private_key_ext is invalid");
+  }
 
   const curve_info *curve = NULL;
   if (0 == curve_name.len) {
@@ -138,6 +148,13 @@ STATIC mp_obj_t mod_trezorcrypto_HDNode_make_new(const mp_obj_type_t *type,
   } else {
     memzero(o->hdnode.private_key, 32);
   }
+  if (32 == private_key_ext.len) {
+    memcpy(o->hdnode.private_key_extension, private_key_ext.buf, 32);
+  } else {
+    memzero(o->hdnode.private_key_extension, 32);
+  }
+  memzero(o->hdnode.private_key_expanded,
+          sizeof(o->hdnode.private_key_expanded));
   if (33 == public_key.len) {
     memcpy(o->hdnode.public_key, public_key.buf, 33);
   } else {
@@ -186,6 +203,51 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_trezorcrypto_HDNode_derive_obj,
                                            2, 3,
                                            mod_trezorcrypto_HDNode_derive);
 
+#define DERIVE_PUBLIC_KEYS_MAX 64
+
+/// def derive_public_keys(self, index: int, count: int) -> List[bytes]:
+///     """
+///     Derive the children index, ..., index + count - 1 with private
+///     derivation and return their public keys. No child nodes are
+///     allocated and the node itself is not modified.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_HDNode_derive_public_keys(mp_obj_t self,
+                                                           mp_obj_t index,
+                                                           mp_obj_t count) {
+  mp_obj_HDNode_t *o = MP_OBJ_TO_PTR(self);
+  uint32_t i = trezor_obj_get_uint(index);
+  size_t n = trezor_obj_get_uint(count);
+  if (n > DERIVE_PUBLIC_KEYS_MAX) {
+    mp_raise_ValueError("Too many keys to derive");
+  }
+  // same as in derive
+  if (0 ==
+      memcmp(o->hdnode.private_key,
+             "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+             "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
+             32)) {
+    mp_raise_ValueError("Failed to derive, private key not set");
+  }
+
+  mp_obj_list_t *list = MP_OBJ_TO_PTR(mp_obj_new_list(n, NULL));
+  HDNode child;
+  for (size_t j = 0; j < n; j++) {
+    child = o->hdnode;
+    if (!hdnode_private_ckd(&child, i + j)) {
+      memzero(&child, sizeof(child));
+      mp_raise_ValueError("Failed to derive");
+    }
+    hdnode_fill_public_key(&child);
+    list->items[j] =
+        mp_obj_new_bytes(child.public_key, sizeof(child.public_key));
+  }
+  memzero(&child, sizeof(child));
+
+  return MP_OBJ_FROM_PTR(list);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(mod_trezorcrypto_HDNode_derive_public_keys_obj,
+                                 mod_trezorcrypto_HDNode_derive_public_keys);
+
 #if !BITCOIN_ONLY
 
 /// def derive_cardano(self, index: int) -> None:
@@ -221,17 +283,65 @@ STATIC mp_obj_t mod_trezorcrypto_HDNode_derive_cardano(mp_obj_t self,
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_HDNode_derive_cardano_obj,
                                  mod_trezorcrypto_HDNode_derive_cardano);
 
-#endif
+#define CARDANO_BATCH_SIZE 8
+#define CARDANO_BATCH_MAX 64
 
-/// def derive_path(self, path: List[int]) -> None:
+/// def derive_cardano_batch(self, index: int, count: int) -> List[HDNode]:
 ///     """
-///     Go through a list of indexes and iteratively derive a child node in
-///     place.
+///     Derive the children index, ..., index + count - 1 using Cardano
+///     algorithm and return them as new nodes with public keys filled in.
+///     The node itself is not modified.
 ///     """
-STATIC mp_obj_t mod_trezorcrypto_HDNode_derive_path(mp_obj_t self,
-                                                    mp_obj_t path) {
+STATIC mp_obj_t mod_trezorcrypto_HDNode_derive_cardano_batch(mp_obj_t self,
+                                                             mp_obj_t index,
+                                                             mp_obj_t count) {
   mp_obj_HDNode_t *o = MP_OBJ_TO_PTR(self);
+  uint32_t i = trezor_obj_get_uint(index);
+  size_t n = trezor_obj_get_uint(count);
+  if (n > CARDANO_BATCH_MAX) {
+    mp_raise_ValueError("Too many nodes to derive");
+  }
+  if (0 ==
+      memcmp(o->hdnode.private_key,
+             "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+             "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
+             32)) {
+    mp_raise_ValueError("Failed to derive, private key not set");
+  }
+  uint32_t fp = hdnode_fingerprint(&o->hdnode);
 
+  mp_obj_list_t *list = MP_OBJ_TO_PTR(mp_obj_new_list(n, NULL));
+  HDNode children[CARDANO_BATCH_SIZE];
+  for (size_t start = 0; start < n; start += CARDANO_BATCH_SIZE) {
+    size_t m = n - start;
+    if (m > CARDANO_BATCH_SIZE) {
+      m = CARDANO_BATCH_SIZE;
+    }
+    if (!hdnode_private_ckd_cardano_batch(&o->hdnode, i + start, m,
+                                          children)) {
+      memzero(children, sizeof(children));
+      mp_raise_ValueError("Failed to derive");
+    }
+    for (size_t j = 0; j < m; j++) {
+      mp_obj_HDNode_t *child = m_new_obj_with_finaliser(mp_obj_HDNode_t);
+      child->base.type = &mod_trezorcrypto_HDNode_type;
+      child->hdnode = children[j];
+      child->fingerprint = fp;
+      list->items[start + j] = MP_OBJ_FROM_PTR(child);
+    }
+  }
+  memzero(children, sizeof(children));
+
+  return MP_OBJ_FROM_PTR(list);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(
+    mod_trezorcrypto_HDNode_derive_cardano_batch_obj,
+    mod_trezorcrypto_HDNode_derive_cardano_batch);
+
+#endif
+
+// derives the path in place, wipes the node on failure
+STATIC void derive_path_obj(mp_obj_HDNode_t *o, mp_obj_t path, bool public) {
   // get path objects and length
   size_t plen;
   mp_obj_t *pitems;
@@ -240,23 +350,81 @@ STATIC mp_obj_t mod_trezorcrypto_HDNode_derive_path(mp_obj_t self,
     mp_raise_ValueError("Path cannot be longer than 32 indexes");
   }
 
+#if USE_BIP32_CACHE
+  if (public) {
+    uint32_t ipath[32];
+    for (uint32_t pi = 0; pi < plen; pi++) {
+      ipath[pi] = trezor_obj_get_uint(pitems[pi]);
+    }
+    uint32_t fp = o->fingerprint;
+    if (!hdnode_public_ckd_cached(&o->hdnode, ipath, plen, &fp)) {
+      o->fingerprint = 0;
+      memzero(&o->hdnode, sizeof(o->hdnode));
+      mp_raise_ValueError("Failed to derive path");
+    }
+    o->fingerprint = fp;
+    return;
+  }
+#endif
+
   for (uint32_t pi = 0; pi < plen; pi++) {
     if (pi == plen - 1) {
       // fingerprint is calculated from the parent of the final derivation
       o->fingerprint = hdnode_fingerprint(&o->hdnode);
     }
     uint32_t pitem = trezor_obj_get_uint(pitems[pi]);
-    if (!hdnode_private_ckd(&o->hdnode, pitem)) {
+    if (!(public ? hdnode_public_ckd(&o->hdnode, pitem)
+                 : hdnode_private_ckd(&o->hdnode, pitem))) {
       o->fingerprint = 0;
       memzero(&o->hdnode, sizeof(o->hdnode));
       mp_raise_ValueError("Failed to derive path");
     }
   }
+}
 
+/// def derive_path(self, path: List[int], public: bool = False) -> None:
+///     """
+///     Go through a list of indexes and iteratively derive a child node in
+///     place. Public derivation goes through the BIP32 cache, so deriving
+///     many paths under one xpub recomputes the shared parent only once.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_HDNode_derive_path(size_t n_args,
+                                                    const mp_obj_t *args) {
+  mp_obj_HDNode_t *o = MP_OBJ_TO_PTR(args[0]);
+  bool public = n_args > 2 && mp_obj_is_true(args[2]);
+  trace_event(TRACE_BIP32_DERIVE_PATH, TRACE_BEGIN);
+  derive_path_obj(o, args[1], public);
+  trace_event(TRACE_BIP32_DERIVE_PATH, TRACE_END);
   return mp_const_none;
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_HDNode_derive_path_obj,
-                                 mod_trezorcrypto_HDNode_derive_path);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_HDNode_derive_path_obj, 2, 3,
+    mod_trezorcrypto_HDNode_derive_path);
+
+/// def derive_path_into(
+///     self, dst: HDNode, path: List[int], public: bool = False
+/// ) -> None:
+///     """
+///     Copy the node into dst and derive the path there, like clone()
+///     followed by derive_path() but without allocating a new node. The
+///     node itself is not modified.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_HDNode_derive_path_into(size_t n_args,
+                                                         const mp_obj_t *args) {
+  mp_obj_HDNode_t *o = MP_OBJ_TO_PTR(args[0]);
+  if (!MP_OBJ_IS_TYPE(args[1], &mod_trezorcrypto_HDNode_type)) {
+    mp_raise_TypeError("dst must be an HDNode");
+  }
+  mp_obj_HDNode_t *dst = MP_OBJ_TO_PTR(args[1]);
+  bool public = n_args > 3 && mp_obj_is_true(args[3]);
+  dst->hdnode = o->hdnode;
+  dst->fingerprint = o->fingerprint;
+  derive_path_obj(dst, args[2], public);
+  return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_HDNode_derive_path_into_obj, 3, 4,
+    mod_trezorcrypto_HDNode_derive_path_into);
 
 /// def serialize_public(self, version: int) -> str:
 ///     """
@@ -493,12 +661,18 @@ STATIC const mp_rom_map_elem_t mod_trezorcrypto_HDNode_locals_dict_table[] = {
      MP_ROM_PTR(&mod_trezorcrypto_HDNode___del___obj)},
     {MP_ROM_QSTR(MP_QSTR_derive),
      MP_ROM_PTR(&mod_trezorcrypto_HDNode_derive_obj)},
+    {MP_ROM_QSTR(MP_QSTR_derive_public_keys),
+     MP_ROM_PTR(&mod_trezorcrypto_HDNode_derive_public_keys_obj)},
 #if !BITCOIN_ONLY
     {MP_ROM_QSTR(MP_QSTR_derive_cardano),
      MP_ROM_PTR(&mod_trezorcrypto_HDNode_derive_cardano_obj)},
+    {MP_ROM_QSTR(MP_QSTR_derive_cardano_batch),
+     MP_ROM_PTR(&mod_trezorcrypto_HDNode_derive_cardano_batch_obj)},
 #endif
     {MP_ROM_QSTR(MP_QSTR_derive_path),
      MP_ROM_PTR(&mod_trezorcrypto_HDNode_derive_path_obj)},
+    {MP_ROM_QSTR(MP_QSTR_derive_path_into),
+     MP_ROM_PTR(&mod_trezorcrypto_HDNode_derive_path_into_obj)},
     {MP_ROM_QSTR(MP_QSTR_serialize_public),
      MP_ROM_PTR(&mod_trezorcrypto_HDNode_serialize_public_obj)},
     {MP_ROM_QSTR(MP_QSTR_clone),
@@ -19,6 +19,8 @@
 
 #include "py/objstr.h"
 
+#include "embed/extmod/trezorobj.h"
+
 #include "blake256.h"
 #include "memzero.h"
 
@@ -35,7 +37,8 @@ typedef struct _mp_obj_Blake256_t {
   BLAKE256_CTX ctx;
 } mp_obj_Blake256_t;
 
-STATIC mp_obj_t mod_trezorcrypto_Blake256_update(mp_obj_t self, mp_obj_t data);
+STATIC mp_obj_t mod_trezorcrypto_Blake256_update(size_t n_args,
+                                                 const mp_obj_t *args);
 
 /// def __init__(self, data: bytes = None) -> None:
 ///     """
@@ -50,26 +53,32 @@ STATIC mp_obj_t mod_trezorcrypto_Blake256_make_new(const mp_obj_type_t *type,
   blake256_Init(&(o->ctx));
   // constructor called with bytes/str as first parameter
   if (n_args == 1) {
-    mod_trezorcrypto_Blake256_update(MP_OBJ_FROM_PTR(o), args[0]);
+    const mp_obj_t update_args[2] = {MP_OBJ_FROM_PTR(o), args[0]};
+    mod_trezorcrypto_Blake256_update(2, update_args);
   }
   return MP_OBJ_FROM_PTR(o);
 }
 
-/// def update(self, data: bytes) -> None:
+/// def update(
+///     self, data: bytes, offset: int = 0, length: Optional[int] = None
+/// ) -> None:
 ///     """
-///     Update the hash context with hashed data.
+///     Update the hash context with hashed data. If offset or length are
+///     given, only that part of data is hashed, without copying it.
 ///     """
-STATIC mp_obj_t mod_trezorcrypto_Blake256_update(mp_obj_t self, mp_obj_t data) {
-  mp_obj_Blake256_t *o = MP_OBJ_TO_PTR(self);
+STATIC mp_obj_t mod_trezorcrypto_Blake256_update(size_t n_args,
+                                                 const mp_obj_t *args) {
+  mp_obj_Blake256_t *o = MP_OBJ_TO_PTR(args[0]);
   mp_buffer_info_t msg;
-  mp_get_buffer_raise(data, &msg, MP_BUFFER_READ);
+  trezor_obj_get_buffer_range(n_args - 1, args + 1, &msg);
   if (msg.len > 0) {
     blake256_Update(&(o->ctx), msg.buf, msg.len);
   }
   return mp_const_none;
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_Blake256_update_obj,
-                                 mod_trezorcrypto_Blake256_update);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_Blake256_update_obj, 2, 4,
+    mod_trezorcrypto_Blake256_update);
 
 /// def digest(self) -> bytes:
 ///     """
@@ -87,6 +96,22 @@ STATIC mp_obj_t mod_trezorcrypto_Blake256_digest(mp_obj_t self) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorcrypto_Blake256_digest_obj,
                                  mod_trezorcrypto_Blake256_digest);
 
+/// def copy(self) -> blake256:
+///     """
+///     Returns the copy of the digest object with the current state
+///     """
+STATIC mp_obj_t mod_trezorcrypto_Blake256_copy(size_t n_args,
+                                               const mp_obj_t *args) {
+  mp_obj_Blake256_t *o = MP_OBJ_TO_PTR(args[0]);
+  mp_obj_Blake256_t *out = m_new_obj_with_finaliser(mp_obj_Blake256_t);
+  out->base.type = o->base.type;
+  memcpy(&(out->ctx), &(o->ctx), sizeof(BLAKE256_CTX));
+  return MP_OBJ_FROM_PTR(out);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_trezorcrypto_Blake256_copy_obj,
+                                           1, 1,
+                                           mod_trezorcrypto_Blake256_copy);
+
 STATIC mp_obj_t mod_trezorcrypto_Blake256___del__(mp_obj_t self) {
   mp_obj_Blake256_t *o = MP_OBJ_TO_PTR(self);
   memzero(&(o->ctx), sizeof(BLAKE256_CTX));
@@ -100,6 +125,8 @@ STATIC const mp_rom_map_elem_t mod_trezorcrypto_Blake256_locals_dict_table[] = {
      MP_ROM_PTR(&mod_trezorcrypto_Blake256_update_obj)},
     {MP_ROM_QSTR(MP_QSTR_digest),
      MP_ROM_PTR(&mod_trezorcrypto_Blake256_digest_obj)},
+    {MP_ROM_QSTR(MP_QSTR_copy),
+     MP_ROM_PTR(&mod_trezorcrypto_Blake256_copy_obj)},
     {MP_ROM_QSTR(MP_QSTR___del__),
      MP_ROM_PTR(&mod_trezorcrypto_Blake256___del___obj)},
     {MP_ROM_QSTR(MP_QSTR_block_size), MP_ROM_INT(BLAKE256_BLOCK_LENGTH)},
@@ -37,7 +37,8 @@ typedef struct _mp_obj_Blake2s_t {
   BLAKE2S_CTX ctx;
 } mp_obj_Blake2s_t;
 
-STATIC mp_obj_t mod_trezorcrypto_Blake2s_update(mp_obj_t self, mp_obj_t data);
+STATIC mp_obj_t mod_trezorcrypto_Blake2s_update(size_t n_args,
+                                                const mp_obj_t *args);
 
 /// def __init__(
 ///     self,
@@ -109,21 +110,26 @@ STATIC mp_obj_t mod_trezorcrypto_Blake2s_make_new(const mp_obj_type_t *type,
   return MP_OBJ_FROM_PTR(o);
 }
 
-/// def update(self, data: bytes) -> None:
+/// def update(
+///     self, data: bytes, offset: int = 0, length: Optional[int] = None
+/// ) -> None:
 ///     """
-///     Update the hash context with hashed data.
+///     Update the hash context with hashed data. If offset or length are
+///     given, only that part of data is hashed, without copying it.
 ///     """
-STATIC mp_obj_t mod_trezorcrypto_Blake2s_update(mp_obj_t self, mp_obj_t data) {
-  mp_obj_Blake2s_t *o = MP_OBJ_TO_PTR(self);
+STATIC mp_obj_t mod_trezorcrypto_Blake2s_update(size_t n_args,
+                                                const mp_obj_t *args) {
+  mp_obj_Blake2s_t *o = MP_OBJ_TO_PTR(args[0]);
   mp_buffer_info_t msg;
-  mp_get_buffer_raise(data, &msg, MP_BUFFER_READ);
+  trezor_obj_get_buffer_range(n_args - 1, args + 1, &msg);
   if (msg.len > 0) {
     blake2s_Update(&(o->ctx), msg.buf, msg.len);
   }
   return mp_const_none;
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_Blake2s_update_obj,
-                                 mod_trezorcrypto_Blake2s_update);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_Blake2s_update_obj, 2, 4,
+    mod_trezorcrypto_Blake2s_update);
 
 /// def digest(self) -> bytes:
 ///     """
@@ -28,6 +28,8 @@
 /// def crc32(data: bytes, crc: int = 0) -> int:
 ///     """
 ///     Computes a CRC32 checksum of `data`.
+///     Pass the previous result as `crc` to continue the checksum over
+///     another chunk, so crc32(b, crc32(a)) == crc32(a + b).
 ///     """
 mp_obj_t mod_trezorcrypto_crc_crc32(size_t n_args, const mp_obj_t *args) {
   mp_buffer_info_t bufinfo;
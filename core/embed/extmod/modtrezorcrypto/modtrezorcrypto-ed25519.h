@@ -22,6 +22,7 @@
 #include "ed25519-donna/ed25519-keccak.h"
 #include "ed25519-donna/ed25519.h"
 
+#include "memzero.h"
 #include "rand.h"
 
 /// package: trezorcrypto.ed25519
@@ -75,7 +76,9 @@ STATIC mp_obj_t mod_trezorcrypto_ed25519_sign(size_t n_args,
   if (msg.len == 0) {
     mp_raise_ValueError("Empty data to sign");
   }
-  ed25519_public_key pk;
+  // the public key is derived from the same expanded key that signs, so the
+  // secret key is hashed only once
+  ed25519_keypair_expanded kp;
   uint8_t out[64];
   mp_buffer_info_t hash_func;
 
@@ -83,17 +86,18 @@ STATIC mp_obj_t mod_trezorcrypto_ed25519_sign(size_t n_args,
     mp_get_buffer_raise(args[2], &hash_func, MP_BUFFER_READ);
     // if hash_func == 'keccak':
     if (memcmp(hash_func.buf, "keccak", sizeof("keccak")) == 0) {
-      ed25519_publickey_keccak(*(const ed25519_secret_key *)sk.buf, pk);
-      ed25519_sign_keccak(msg.buf, msg.len, *(const ed25519_secret_key *)sk.buf,
-                          pk, *(ed25519_signature *)out);
+      ed25519_keypair_expand_keccak(*(const ed25519_secret_key *)sk.buf, &kp);
+      ed25519_sign_with_expanded_keccak(msg.buf, msg.len, &kp,
+                                        *(ed25519_signature *)out);
     } else {
       mp_raise_ValueError("Unknown hash function");
     }
   } else {
-    ed25519_publickey(*(const ed25519_secret_key *)sk.buf, pk);
-    ed25519_sign(msg.buf, msg.len, *(const ed25519_secret_key *)sk.buf, pk,
-                 *(ed25519_signature *)out);
+    ed25519_keypair_expand(*(const ed25519_secret_key *)sk.buf, &kp);
+    ed25519_sign_with_expanded(msg.buf, msg.len, &kp,
+                               *(ed25519_signature *)out);
   }
+  memzero(&kp, sizeof(kp));
 
   return mp_obj_new_bytes(out, sizeof(out));
 }
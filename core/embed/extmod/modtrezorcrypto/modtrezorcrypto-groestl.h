@@ -19,6 +19,8 @@
 
 #include "py/objstr.h"
 
+#include "embed/extmod/trezorobj.h"
+
 #include "groestl.h"
 #include "memzero.h"
 
@@ -38,8 +40,8 @@ typedef struct _mp_obj_Groestl512_t {
   GROESTL512_CTX ctx;
 } mp_obj_Groestl512_t;
 
-STATIC mp_obj_t mod_trezorcrypto_Groestl512_update(mp_obj_t self,
-                                                   mp_obj_t data);
+STATIC mp_obj_t mod_trezorcrypto_Groestl512_update(size_t n_args,
+                                                   const mp_obj_t *args);
 
 /// def __init__(self, data: bytes = None) -> None:
 ///     """
@@ -53,27 +55,32 @@ STATIC mp_obj_t mod_trezorcrypto_Groestl512_make_new(const mp_obj_type_t *type,
   o->base.type = type;
   groestl512_Init(&(o->ctx));
   if (n_args == 1) {
-    mod_trezorcrypto_Groestl512_update(MP_OBJ_FROM_PTR(o), args[0]);
+    const mp_obj_t update_args[2] = {MP_OBJ_FROM_PTR(o), args[0]};
+    mod_trezorcrypto_Groestl512_update(2, update_args);
   }
   return MP_OBJ_FROM_PTR(o);
 }
 
-/// def update(self, data: bytes) -> None:
+/// def update(
+///     self, data: bytes, offset: int = 0, length: Optional[int] = None
+/// ) -> None:
 ///     """
-///     Update the hash context with hashed data.
+///     Update the hash context with hashed data. If offset or length are
+///     given, only that part of data is hashed, without copying it.
 ///     """
-STATIC mp_obj_t mod_trezorcrypto_Groestl512_update(mp_obj_t self,
-                                                   mp_obj_t data) {
-  mp_obj_Groestl512_t *o = MP_OBJ_TO_PTR(self);
+STATIC mp_obj_t mod_trezorcrypto_Groestl512_update(size_t n_args,
+                                                   const mp_obj_t *args) {
+  mp_obj_Groestl512_t *o = MP_OBJ_TO_PTR(args[0]);
   mp_buffer_info_t msg;
-  mp_get_buffer_raise(data, &msg, MP_BUFFER_READ);
+  trezor_obj_get_buffer_range(n_args - 1, args + 1, &msg);
   if (msg.len > 0) {
     groestl512_Update(&(o->ctx), msg.buf, msg.len);
   }
   return mp_const_none;
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_Groestl512_update_obj,
-                                 mod_trezorcrypto_Groestl512_update);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_Groestl512_update_obj, 2, 4,
+    mod_trezorcrypto_Groestl512_update);
 
 /// def digest(self) -> bytes:
 ///     """
@@ -21,6 +21,8 @@
 #include "py/objint.h"
 #include "py/objstr.h"
 
+#include "embed/extmod/trezorobj.h"
+
 #include "bignum.h"
 #include "memzero.h"
 #include "monero/monero.h"
@@ -834,6 +836,34 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
     mod_trezorcrypto_monero_ge25519_scalarmult_base_obj, 1, 2,
     mod_trezorcrypto_monero_ge25519_scalarmult_base);
 
+/// def ge25519_scalarmult_h(
+///     r: Optional[Ge25519], s: Union[Sc25519, int]
+/// ) -> Ge25519:
+///     """
+///     s * H
+///     """
+STATIC mp_obj_t mod_trezorcrypto_monero_ge25519_scalarmult_h(
+    size_t n_args, const mp_obj_t *args) {
+  const bool res_arg = n_args == 2;
+  const int off = res_arg ? 0 : -1;
+  mp_obj_t res = mp_obj_new_ge25519_r(res_arg ? args[0] : mp_const_none);
+
+  if (MP_OBJ_IS_SCALAR(args[1 + off])) {
+    ge25519_scalarmult_h(&MP_OBJ_GE25519(res), MP_OBJ_C_SCALAR(args[1 + off]));
+  } else if (mp_obj_is_integer(args[1 + off])) {
+    bignum256modm mlt;
+    set256_modm(mlt, mp_obj_get_int(args[1 + off]));
+    ge25519_scalarmult_h(&MP_OBJ_GE25519(res), mlt);
+  } else {
+    mp_raise_ValueError("unknown base mult type");
+  }
+
+  return res;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_monero_ge25519_scalarmult_h_obj, 1, 2,
+    mod_trezorcrypto_monero_ge25519_scalarmult_h);
+
 /// def ge25519_scalarmult(
 ///     r: Optional[Ge25519], p: Ge25519, s: Union[Sc25519, int]
 /// ) -> Ge25519:
@@ -1254,6 +1284,181 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
     mod_trezorcrypto_monero_xmr_add_keys3_vartime_obj, 4, 5,
     mod_trezorcrypto_monero_xmr_add_keys3_vartime);
 
+STATIC mp_obj_t mod_trezorcrypto_monero_multi_scalarmult(size_t n_args,
+                                                        const mp_obj_t *args,
+                                                        bool vartime) {
+  const bool res_arg = n_args == 3;
+  const int off = res_arg ? 0 : -1;
+  size_t n = 0, scalars_len = 0;
+  mp_obj_t *points_items = NULL, *scalars_items = NULL;
+  mp_obj_get_array(args[1 + off], &n, &points_items);
+  mp_obj_get_array(args[2 + off], &scalars_len, &scalars_items);
+  if (n != scalars_len) {
+    mp_raise_ValueError("Points and scalars length mismatch");
+  }
+  for (size_t i = 0; i < n; i++) {
+    assert_ge25519(points_items[i]);
+    assert_scalar(scalars_items[i]);
+  }
+
+  mp_obj_t res = mp_obj_new_ge25519_r(res_arg ? args[0] : mp_const_none);
+  ge25519 *points = m_new(ge25519, n);
+  bignum256modm *scalars = m_new(bignum256modm, n);
+  for (size_t i = 0; i < n; i++) {
+    ge25519_copy(&points[i], &MP_OBJ_C_GE25519(points_items[i]));
+    copy256_modm(scalars[i], MP_OBJ_C_SCALAR(scalars_items[i]));
+  }
+
+  if (vartime) {
+    xmr_multi_scalarmult_vartime(&MP_OBJ_GE25519(res), points,
+                                 (const bignum256modm *)scalars, n);
+  } else {
+    const size_t scratch_len = xmr_multi_scalarmult_scratch_size(n);
+    uint8_t *scratch = m_new(uint8_t, scratch_len);
+    xmr_multi_scalarmult(&MP_OBJ_GE25519(res), points,
+                         (const bignum256modm *)scalars, n, scratch);
+    m_del(uint8_t, scratch, scratch_len);
+  }
+
+  memzero(scalars, n * sizeof(bignum256modm));
+  m_del(bignum256modm, scalars, n);
+  m_del(ge25519, points, n);
+  return res;
+}
+
+// clang-format off
+/// def xmr_multi_scalarmult(r: Optional[Ge25519], points: List[Ge25519], scalars: List[Sc25519]) -> Ge25519:
+// clang-format on
+///     """
+///     sum_i scalars_i points_i, constant time
+///     """
+STATIC mp_obj_t mod_trezorcrypto_monero_xmr_multi_scalarmult(
+    size_t n_args, const mp_obj_t *args) {
+  return mod_trezorcrypto_monero_multi_scalarmult(n_args, args, false);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_monero_xmr_multi_scalarmult_obj, 2, 3,
+    mod_trezorcrypto_monero_xmr_multi_scalarmult);
+
+// clang-format off
+/// def xmr_multi_scalarmult_vartime(r: Optional[Ge25519], points: List[Ge25519], scalars: List[Sc25519]) -> Ge25519:
+// clang-format on
+///     """
+///     sum_i scalars_i points_i
+///     """
+STATIC mp_obj_t mod_trezorcrypto_monero_xmr_multi_scalarmult_vartime(
+    size_t n_args, const mp_obj_t *args) {
+  return mod_trezorcrypto_monero_multi_scalarmult(n_args, args, true);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_monero_xmr_multi_scalarmult_vartime_obj, 2, 3,
+    mod_trezorcrypto_monero_xmr_multi_scalarmult_vartime);
+
+// number of packed 32 byte elements of dst, checks srcs are long enough
+STATIC size_t mp_vct_len(const mp_buffer_info_t *dst,
+                         const mp_buffer_info_t *a,
+                         const mp_buffer_info_t *b) {
+  if (dst->len % 32 != 0 || a->len < dst->len || b->len < dst->len) {
+    mp_raise_ValueError("Invalid length of the key vector");
+  }
+  return dst->len / 32;
+}
+
+// clang-format off
+/// def xmr_sc_fold_vct(dst: bytearray, lo: bytes, hi: bytes, a: Sc25519, b: Sc25519) -> None:
+// clang-format on
+///     """
+///     dst_i = a lo_i + b hi_i over packed scalars, for i < len(dst) / 32.
+///     dst may be the same buffer as lo.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_monero_xmr_sc_fold_vct(size_t n_args,
+                                                        const mp_obj_t *args) {
+  mp_buffer_info_t dst, lo, hi;
+  mp_get_buffer_raise(args[0], &dst, MP_BUFFER_WRITE);
+  mp_get_buffer_raise(args[1], &lo, MP_BUFFER_READ);
+  mp_get_buffer_raise(args[2], &hi, MP_BUFFER_READ);
+  assert_scalar(args[3]);
+  assert_scalar(args[4]);
+  const size_t n = mp_vct_len(&dst, &lo, &hi);
+
+  bignum256modm x = {0}, y = {0};
+  for (size_t i = 0; i < n; i++) {
+    expand_raw256_modm(x, (const uint8_t *)lo.buf + 32 * i);
+    expand_raw256_modm(y, (const uint8_t *)hi.buf + 32 * i);
+    mul256_modm(x, x, MP_OBJ_C_SCALAR(args[3]));
+    mul256_modm(y, y, MP_OBJ_C_SCALAR(args[4]));
+    add256_modm(x, x, y);
+    contract256_modm((uint8_t *)dst.buf + 32 * i, x);
+  }
+  memzero(x, sizeof(x));
+  memzero(y, sizeof(y));
+  return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_monero_xmr_sc_fold_vct_obj, 5, 5,
+    mod_trezorcrypto_monero_xmr_sc_fold_vct);
+
+// clang-format off
+/// def xmr_sc_muladd_vct(r: Sc25519, a: bytes, b: bytes) -> Sc25519:
+// clang-format on
+///     """
+///     r += sum_i a_i b_i over packed scalars, for i < len(a) / 32
+///     """
+STATIC mp_obj_t mod_trezorcrypto_monero_xmr_sc_muladd_vct(const mp_obj_t r,
+                                                          const mp_obj_t a,
+                                                          const mp_obj_t b) {
+  mp_buffer_info_t abuf, bbuf;
+  assert_scalar(r);
+  mp_get_buffer_raise(a, &abuf, MP_BUFFER_READ);
+  mp_get_buffer_raise(b, &bbuf, MP_BUFFER_READ);
+  const size_t n = mp_vct_len(&abuf, &abuf, &bbuf);
+
+  bignum256modm x = {0}, y = {0};
+  for (size_t i = 0; i < n; i++) {
+    expand_raw256_modm(x, (const uint8_t *)abuf.buf + 32 * i);
+    expand_raw256_modm(y, (const uint8_t *)bbuf.buf + 32 * i);
+    muladd256_modm(MP_OBJ_SCALAR(r), x, y, MP_OBJ_SCALAR(r));
+  }
+  memzero(x, sizeof(x));
+  memzero(y, sizeof(y));
+  return r;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(mod_trezorcrypto_monero_xmr_sc_muladd_vct_obj,
+                                 mod_trezorcrypto_monero_xmr_sc_muladd_vct);
+
+// clang-format off
+/// def xmr_add_keys3_vct(dst: bytearray, a: Sc25519, A: bytes, b: Sc25519, B: bytes) -> None:
+// clang-format on
+///     """
+///     dst_i = a A_i + b B_i over packed points, for i < len(dst) / 32.
+///     dst may be the same buffer as A.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_monero_xmr_add_keys3_vct(size_t n_args,
+                                                          const mp_obj_t *args) {
+  mp_buffer_info_t dst, A, B;
+  mp_get_buffer_raise(args[0], &dst, MP_BUFFER_WRITE);
+  assert_scalar(args[1]);
+  mp_get_buffer_raise(args[2], &A, MP_BUFFER_READ);
+  assert_scalar(args[3]);
+  mp_get_buffer_raise(args[4], &B, MP_BUFFER_READ);
+  const size_t n = mp_vct_len(&dst, &A, &B);
+
+  ge25519 P = {0}, Q = {0};
+  for (size_t i = 0; i < n; i++) {
+    if (ge25519_unpack_vartime(&P, (const uint8_t *)A.buf + 32 * i) != 1 ||
+        ge25519_unpack_vartime(&Q, (const uint8_t *)B.buf + 32 * i) != 1) {
+      mp_raise_ValueError("Point decoding error");
+    }
+    xmr_add_keys3_vartime(&P, MP_OBJ_C_SCALAR(args[1]), &P,
+                          MP_OBJ_C_SCALAR(args[3]), &Q);
+    ge25519_pack((uint8_t *)dst.buf + 32 * i, &P);
+  }
+  return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_monero_xmr_add_keys3_vct_obj, 5, 5,
+    mod_trezorcrypto_monero_xmr_add_keys3_vct);
+
 /// def xmr_get_subaddress_secret_key(
 ///     r: Optional[Sc25519], major: int, minor: int, m: Sc25519
 /// ) -> Sc25519:
@@ -1293,6 +1498,140 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
     mod_trezorcrypto_monero_xmr_gen_c_obj, 2, 3,
     mod_trezorcrypto_monero_xmr_gen_c);
 
+// clang-format off
+/// def xmr_gen_mlsag_simple(message: bytes, ring: bytes, x: Sc25519, z: Sc25519, Cout: Ge25519, index: int) -> Tuple[bytes, bytes]:
+// clang-format on
+///     """
+///     MLSAG for RctType.Simple over the ring of packed (P_i || C_i) pairs,
+///     returns (ss, cc) with 2 packed scalars per ring member in ss
+///     """
+STATIC mp_obj_t mod_trezorcrypto_monero_xmr_gen_mlsag_simple(
+    size_t n_args, const mp_obj_t *args) {
+  mp_buffer_info_t msg, ring;
+  mp_get_buffer_raise(args[0], &msg, MP_BUFFER_READ);
+  mp_get_buffer_raise(args[1], &ring, MP_BUFFER_READ);
+  assert_scalar(args[2]);
+  assert_scalar(args[3]);
+  assert_ge25519(args[4]);
+  const size_t cols = ring.len / (2 * sizeof(xmr_key_t));
+  if (ring.len % (2 * sizeof(xmr_key_t)) != 0) {
+    mp_raise_ValueError("Invalid ring length");
+  }
+
+  vstr_t ss = {0};
+  vstr_init_len(&ss, 2 * cols * sizeof(xmr_key_t));
+  xmr_key_t cc = {0};
+  if (!xmr_gen_mlsag_simple((xmr_key_t *)ss.buf, cc, msg.buf, msg.len,
+                            ring.buf, cols, MP_OBJ_C_SCALAR(args[2]),
+                            MP_OBJ_C_SCALAR(args[3]),
+                            &MP_OBJ_C_GE25519(args[4]),
+                            mp_obj_get_int(args[5]))) {
+    vstr_clear(&ss);
+    mp_raise_ValueError("Invalid ring");
+  }
+
+  mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(2, NULL));
+  tuple->items[0] = mp_obj_new_str_from_vstr(&mp_type_bytes, &ss);
+  tuple->items[1] = mp_obj_new_bytes(cc, sizeof(xmr_key_t));
+  return MP_OBJ_FROM_PTR(tuple);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_monero_xmr_gen_mlsag_simple_obj, 6, 6,
+    mod_trezorcrypto_monero_xmr_gen_mlsag_simple);
+
+// clang-format off
+/// def xmr_gen_clsag_simple(message: bytes, ring: bytes, p: Sc25519, z: Sc25519, Cout: Ge25519, index: int) -> Tuple[bytes, bytes, bytes]:
+// clang-format on
+///     """
+///     CLSAG for RctType.Simple over the ring of packed (P_i || C_i) pairs,
+///     returns (ss, c1, D) with 1 packed scalar per ring member in ss
+///     """
+STATIC mp_obj_t mod_trezorcrypto_monero_xmr_gen_clsag_simple(
+    size_t n_args, const mp_obj_t *args) {
+  mp_buffer_info_t msg, ring;
+  mp_get_buffer_raise(args[0], &msg, MP_BUFFER_READ);
+  mp_get_buffer_raise(args[1], &ring, MP_BUFFER_READ);
+  assert_scalar(args[2]);
+  assert_scalar(args[3]);
+  assert_ge25519(args[4]);
+  const size_t cols = ring.len / (2 * sizeof(xmr_key_t));
+  if (ring.len % (2 * sizeof(xmr_key_t)) != 0) {
+    mp_raise_ValueError("Invalid ring length");
+  }
+
+  vstr_t ss = {0};
+  vstr_init_len(&ss, cols * sizeof(xmr_key_t));
+  xmr_key_t c1 = {0}, D = {0};
+  if (!xmr_gen_clsag_simple((xmr_key_t *)ss.buf, c1, D, msg.buf, msg.len,
+                            ring.buf, cols, MP_OBJ_C_SCALAR(args[2]),
+                            MP_OBJ_C_SCALAR(args[3]),
+                            &MP_OBJ_C_GE25519(args[4]),
+                            mp_obj_get_int(args[5]))) {
+    vstr_clear(&ss);
+    mp_raise_ValueError("Invalid ring");
+  }
+
+  mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(3, NULL));
+  tuple->items[0] = mp_obj_new_str_from_vstr(&mp_type_bytes, &ss);
+  tuple->items[1] = mp_obj_new_bytes(c1, sizeof(xmr_key_t));
+  tuple->items[2] = mp_obj_new_bytes(D, sizeof(xmr_key_t));
+  return MP_OBJ_FROM_PTR(tuple);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_monero_xmr_gen_clsag_simple_obj, 6, 6,
+    mod_trezorcrypto_monero_xmr_gen_clsag_simple);
+
+// clang-format off
+/// def xmr_export_key_images(spend_key: Sc25519, out_keys: bytes, derivations: List[Ge25519], indices: List[int], subaddr_keys: List[Optional[Sc25519]]) -> bytes:
+// clang-format on
+///     """
+///     Key images of owned outputs with their signatures, packed as
+///     (ki || c || r) per output. out_keys are packed, subaddr_keys are None
+///     for the main address.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_monero_xmr_export_key_images(
+    size_t n_args, const mp_obj_t *args) {
+  mp_buffer_info_t out_keys;
+  size_t count = 0, derivations_len = 0, indices_len = 0, subaddr_len = 0;
+  mp_obj_t *derivations = NULL, *indices = NULL, *subaddr_keys = NULL;
+  assert_scalar(args[0]);
+  mp_get_buffer_raise(args[1], &out_keys, MP_BUFFER_READ);
+  mp_obj_get_array(args[2], &derivations_len, &derivations);
+  mp_obj_get_array(args[3], &indices_len, &indices);
+  mp_obj_get_array(args[4], &subaddr_len, &subaddr_keys);
+  count = out_keys.len / sizeof(xmr_key_t);
+  if (out_keys.len != count * sizeof(xmr_key_t) || derivations_len != count ||
+      indices_len != count || subaddr_len != count) {
+    mp_raise_ValueError("Invalid batch length");
+  }
+
+  vstr_t res = {0};
+  vstr_init_len(&res, 3 * count * sizeof(xmr_key_t));
+  xmr_key_t *out = (xmr_key_t *)res.buf;
+  for (size_t i = 0; i < count; i++) {
+    assert_ge25519(derivations[i]);
+    const bool main_address = subaddr_keys[i] == mp_const_none;
+    if (!main_address) {
+      assert_scalar(subaddr_keys[i]);
+    }
+    if (!xmr_export_key_image(
+            out[3 * i], out[3 * i + 1], out[3 * i + 2],
+            (const uint8_t *)out_keys.buf + i * sizeof(xmr_key_t),
+            &MP_OBJ_C_GE25519(derivations[i]), mp_obj_get_int(indices[i]),
+            MP_OBJ_C_SCALAR(args[0]),
+            main_address ? NULL : MP_OBJ_C_SCALAR(subaddr_keys[i]))) {
+      vstr_clear(&res);
+      mp_raise_ValueError(
+          "key image helper precomp: given output pubkey doesn't match the "
+          "derived one");
+    }
+  }
+  return mp_obj_new_str_from_vstr(&mp_type_bytes, &res);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_monero_xmr_export_key_images_obj, 5, 5,
+    mod_trezorcrypto_monero_xmr_export_key_images);
+
 /// def ct_equals(a: bytes, b: bytes) -> bool:
 ///     """
 ///     Constant time buffer comparison
@@ -1313,18 +1652,19 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_ct_equals_obj,
                                  mod_trezorcrypto_ct_equals);
 
 // Hasher
-STATIC mp_obj_t mod_trezorcrypto_monero_hasher_update(mp_obj_t self,
-                                                      const mp_obj_t arg) {
-  mp_obj_hasher_t *o = MP_OBJ_TO_PTR(self);
+STATIC mp_obj_t mod_trezorcrypto_monero_hasher_update(size_t n_args,
+                                                      const mp_obj_t *args) {
+  mp_obj_hasher_t *o = MP_OBJ_TO_PTR(args[0]);
   mp_buffer_info_t buff;
-  mp_get_buffer_raise(arg, &buff, MP_BUFFER_READ);
+  trezor_obj_get_buffer_range(n_args - 1, args + 1, &buff);
   if (buff.len > 0) {
     xmr_hasher_update(&o->h, buff.buf, buff.len);
   }
   return mp_const_none;
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_monero_hasher_update_obj,
-                                 mod_trezorcrypto_monero_hasher_update);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_monero_hasher_update_obj, 2, 4,
+    mod_trezorcrypto_monero_hasher_update);
 
 STATIC mp_obj_t mod_trezorcrypto_monero_hasher_digest(size_t n_args,
                                                       const mp_obj_t *args) {
@@ -2585,6 +2925,80 @@ STATIC const mp_obj_str_t mod_trezorcrypto_monero_BP_TWO_N_obj = {{&mp_type_byte
 "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
 };
 
+// clang-format off
+/// def xmr_prove_range_bulletproof(amounts: List[int], masks: List[Sc25519]) -> Tuple[List[bytes], bytes, bytes, bytes, bytes, bytes, bytes, List[bytes], List[bytes], bytes, bytes, bytes]:
+// clang-format on
+///     """
+///     Bulletproof range proof of the amounts with the given commitment masks,
+///     returns (V, A, S, T1, T2, taux, mu, L, R, a, b, t). At most two
+///     amounts are supported.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_monero_xmr_prove_range_bulletproof(
+    const mp_obj_t amounts_obj, const mp_obj_t masks_obj) {
+  size_t count = 0, masks_len = 0;
+  mp_obj_t *amounts_items = NULL, *masks_items = NULL;
+  mp_obj_get_array(amounts_obj, &count, &amounts_items);
+  mp_obj_get_array(masks_obj, &masks_len, &masks_items);
+  if (count != masks_len) {
+    mp_raise_ValueError("Amounts and masks length mismatch");
+  }
+  if (count > XMR_BP_MAX_M) {
+    mp_raise_ValueError("Too many amounts for the native prover");
+  }
+  const size_t scratch_len = xmr_bulletproof_scratch_size(count);
+  if (scratch_len == 0) {
+    mp_raise_ValueError("Invalid number of amounts");
+  }
+
+  xmr_amount amounts[XMR_BP_MAX_M] = {0};
+  bignum256modm masks[XMR_BP_MAX_M] = {0};
+  for (size_t i = 0; i < count; i++) {
+    assert_scalar(masks_items[i]);
+    amounts[i] = mp_obj_get_uint64(amounts_items[i]);
+    copy256_modm(masks[i], MP_OBJ_C_SCALAR(masks_items[i]));
+  }
+
+  xmr_bulletproof_t proof = {0};
+  uint8_t *scratch = m_new(uint8_t, scratch_len);
+  xmr_bulletproof_prove(
+      &proof, amounts, (const bignum256modm *)masks, count,
+      (const xmr_key_t *)mod_trezorcrypto_monero_BP_GI_PRE_obj.data,
+      (const xmr_key_t *)mod_trezorcrypto_monero_BP_HI_PRE_obj.data,
+      mod_trezorcrypto_monero_BP_GI_PRE_obj.len / sizeof(xmr_key_t), scratch);
+  m_del(uint8_t, scratch, scratch_len);
+  memzero(amounts, sizeof(amounts));
+  memzero(masks, sizeof(masks));
+
+  mp_obj_t V = mp_obj_new_list(0, NULL);
+  for (size_t i = 0; i < proof.V_len; i++) {
+    mp_obj_list_append(V, mp_obj_new_bytes(proof.V[i], sizeof(xmr_key_t)));
+  }
+  mp_obj_t L = mp_obj_new_list(0, NULL);
+  mp_obj_t R = mp_obj_new_list(0, NULL);
+  for (size_t i = 0; i < proof.L_len; i++) {
+    mp_obj_list_append(L, mp_obj_new_bytes(proof.L[i], sizeof(xmr_key_t)));
+    mp_obj_list_append(R, mp_obj_new_bytes(proof.R[i], sizeof(xmr_key_t)));
+  }
+
+  mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(12, NULL));
+  tuple->items[0] = V;
+  tuple->items[1] = mp_obj_new_bytes(proof.A, sizeof(xmr_key_t));
+  tuple->items[2] = mp_obj_new_bytes(proof.S, sizeof(xmr_key_t));
+  tuple->items[3] = mp_obj_new_bytes(proof.T1, sizeof(xmr_key_t));
+  tuple->items[4] = mp_obj_new_bytes(proof.T2, sizeof(xmr_key_t));
+  tuple->items[5] = mp_obj_new_bytes(proof.taux, sizeof(xmr_key_t));
+  tuple->items[6] = mp_obj_new_bytes(proof.mu, sizeof(xmr_key_t));
+  tuple->items[7] = L;
+  tuple->items[8] = R;
+  tuple->items[9] = mp_obj_new_bytes(proof.a, sizeof(xmr_key_t));
+  tuple->items[10] = mp_obj_new_bytes(proof.b, sizeof(xmr_key_t));
+  tuple->items[11] = mp_obj_new_bytes(proof.t, sizeof(xmr_key_t));
+  return MP_OBJ_FROM_PTR(tuple);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(
+    mod_trezorcrypto_monero_xmr_prove_range_bulletproof_obj,
+    mod_trezorcrypto_monero_xmr_prove_range_bulletproof);
+
 STATIC const mp_rom_map_elem_t mod_trezorcrypto_monero_globals_table[] = {
     {MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_monero)},
     {MP_ROM_QSTR(MP_QSTR_init256_modm),
@@ -2643,6 +3057,8 @@ STATIC const mp_rom_map_elem_t mod_trezorcrypto_monero_globals_table[] = {
          &mod_trezorcrypto_monero_ge25519_double_scalarmult_vartime2_obj)},
     {MP_ROM_QSTR(MP_QSTR_ge25519_scalarmult_base),
      MP_ROM_PTR(&mod_trezorcrypto_monero_ge25519_scalarmult_base_obj)},
+    {MP_ROM_QSTR(MP_QSTR_ge25519_scalarmult_h),
+     MP_ROM_PTR(&mod_trezorcrypto_monero_ge25519_scalarmult_h_obj)},
     {MP_ROM_QSTR(MP_QSTR_ge25519_scalarmult),
      MP_ROM_PTR(&mod_trezorcrypto_monero_ge25519_scalarmult_obj)},
     {MP_ROM_QSTR(MP_QSTR_xmr_base58_addr_encode_check),
@@ -2673,12 +3089,30 @@ STATIC const mp_rom_map_elem_t mod_trezorcrypto_monero_globals_table[] = {
      MP_ROM_PTR(&mod_trezorcrypto_monero_xmr_add_keys3_obj)},
     {MP_ROM_QSTR(MP_QSTR_xmr_add_keys3_vartime),
      MP_ROM_PTR(&mod_trezorcrypto_monero_xmr_add_keys3_vartime_obj)},
+    {MP_ROM_QSTR(MP_QSTR_xmr_multi_scalarmult),
+     MP_ROM_PTR(&mod_trezorcrypto_monero_xmr_multi_scalarmult_obj)},
+    {MP_ROM_QSTR(MP_QSTR_xmr_multi_scalarmult_vartime),
+     MP_ROM_PTR(&mod_trezorcrypto_monero_xmr_multi_scalarmult_vartime_obj)},
+    {MP_ROM_QSTR(MP_QSTR_xmr_sc_fold_vct),
+     MP_ROM_PTR(&mod_trezorcrypto_monero_xmr_sc_fold_vct_obj)},
+    {MP_ROM_QSTR(MP_QSTR_xmr_sc_muladd_vct),
+     MP_ROM_PTR(&mod_trezorcrypto_monero_xmr_sc_muladd_vct_obj)},
+    {MP_ROM_QSTR(MP_QSTR_xmr_add_keys3_vct),
+     MP_ROM_PTR(&mod_trezorcrypto_monero_xmr_add_keys3_vct_obj)},
     {MP_ROM_QSTR(MP_QSTR_xmr_get_subaddress_secret_key),
      MP_ROM_PTR(&mod_trezorcrypto_monero_xmr_get_subaddress_secret_key_obj)},
     {MP_ROM_QSTR(MP_QSTR_xmr_gen_c),
      MP_ROM_PTR(&mod_trezorcrypto_monero_xmr_gen_c_obj)},
+    {MP_ROM_QSTR(MP_QSTR_xmr_gen_mlsag_simple),
+     MP_ROM_PTR(&mod_trezorcrypto_monero_xmr_gen_mlsag_simple_obj)},
+    {MP_ROM_QSTR(MP_QSTR_xmr_gen_clsag_simple),
+     MP_ROM_PTR(&mod_trezorcrypto_monero_xmr_gen_clsag_simple_obj)},
+    {MP_ROM_QSTR(MP_QSTR_xmr_export_key_images),
+     MP_ROM_PTR(&mod_trezorcrypto_monero_xmr_export_key_images_obj)},
     {MP_ROM_QSTR(MP_QSTR_ct_equals),
      MP_ROM_PTR(&mod_trezorcrypto_ct_equals_obj)},
+    {MP_ROM_QSTR(MP_QSTR_xmr_prove_range_bulletproof),
+     MP_ROM_PTR(&mod_trezorcrypto_monero_xmr_prove_range_bulletproof_obj)},
     // bulletproof constants
     {MP_ROM_QSTR(MP_QSTR_BP_GI_PRE),
      MP_ROM_PTR(&mod_trezorcrypto_monero_BP_GI_PRE_obj)},
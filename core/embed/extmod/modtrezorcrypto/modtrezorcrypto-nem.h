@@ -61,12 +61,487 @@ STATIC mp_obj_t mod_trezorcrypto_nem_compute_address(mp_obj_t public_key,
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_nem_compute_address_obj,
                                  mod_trezorcrypto_nem_compute_address);
 
+// The serializers below take the fields common to all transactions as their
+// first arguments: network, timestamp, signer public key, fee and deadline.
+#define NEM_COMMON_ARGS 5
+
+// the largest part of a transaction that does not depend on the lengths of
+// its strings and payloads
+#define NEM_FIXED_SIZE 512
+
+typedef struct {
+  uint8_t network;
+  uint32_t timestamp;
+  const uint8_t *signer;
+  uint64_t fee;
+  uint32_t deadline;
+} nem_common_t;
+
+STATIC void nem_get_common(const mp_obj_t *args, nem_common_t *common) {
+  mp_buffer_info_t signer;
+  mp_get_buffer_raise(args[2], &signer, MP_BUFFER_READ);
+  if (signer.len != sizeof(ed25519_public_key)) {
+    mp_raise_ValueError("Invalid length of public key");
+  }
+  common->network = trezor_obj_get_uint8(args[0]);
+  common->timestamp = trezor_obj_get_uint(args[1]);
+  common->signer = signer.buf;
+  common->fee = trezor_obj_get_uint64(args[3]);
+  common->deadline = trezor_obj_get_uint(args[4]);
+}
+
+STATIC const char *nem_get_address_arg(mp_obj_t address) {
+  size_t len = 0;
+  const char *str = mp_obj_str_get_data(address, &len);
+  if (len != NEM_ADDRESS_SIZE) {
+    mp_raise_ValueError("Invalid length of address");
+  }
+  return str;
+}
+
+STATIC const char *nem_get_str_arg(mp_obj_t str, size_t *size) {
+  size_t len = 0;
+  const char *data = mp_obj_str_get_data(str, &len);
+  *size += len;
+  return data;
+}
+
+STATIC void nem_start(nem_transaction_ctx *ctx, vstr_t *vstr,
+                      const uint8_t *signer, size_t size) {
+  // the parts of a transaction written on their own have no signer
+  static const ed25519_public_key no_signer = {0};
+  vstr_init_len(vstr, size);
+  nem_transaction_start(ctx, signer ? signer : no_signer, (uint8_t *)vstr->buf,
+                        size);
+}
+
+STATIC mp_obj_t nem_finish(nem_transaction_ctx *ctx, vstr_t *vstr, bool ok) {
+  if (!ok) {
+    vstr_clear(vstr);
+    mp_raise_ValueError("Failed to serialize transaction");
+  }
+  vstr->len = nem_transaction_end(ctx, NULL, NULL);
+  return mp_obj_new_str_from_vstr(&mp_type_bytes, vstr);
+}
+
+/// def serialize_transfer(
+///     network: int,
+///     timestamp: int,
+///     signer: bytes,
+///     fee: int,
+///     deadline: int,
+///     recipient: str,
+///     amount: int,
+///     payload: Optional[bytes],
+///     encrypted: bool,
+///     mosaics: int,
+/// ) -> bytes:
+///     """
+///     Serialize a transfer, without the mosaics that follow it.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_nem_serialize_transfer(size_t n_args,
+                                                        const mp_obj_t *args) {
+  nem_common_t c;
+  nem_get_common(args, &c);
+  const char *recipient = nem_get_address_arg(args[5]);
+  uint64_t amount = trezor_obj_get_uint64(args[6]);
+  mp_buffer_info_t payload = {0};
+  if (args[7] != mp_const_none) {
+    mp_get_buffer_raise(args[7], &payload, MP_BUFFER_READ);
+  }
+  bool encrypted = mp_obj_is_true(args[8]);
+  uint32_t mosaics = trezor_obj_get_uint(args[9]);
+
+  nem_transaction_ctx ctx;
+  vstr_t vstr;
+  nem_start(&ctx, &vstr, c.signer, NEM_FIXED_SIZE + payload.len);
+  bool ok = nem_transaction_create_transfer(
+      &ctx, c.network, c.timestamp, c.signer, c.fee, c.deadline, recipient,
+      amount, payload.buf, payload.len, encrypted, mosaics);
+  return nem_finish(&ctx, &vstr, ok);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_nem_serialize_transfer_obj, NEM_COMMON_ARGS + 5,
+    NEM_COMMON_ARGS + 5, mod_trezorcrypto_nem_serialize_transfer);
+
+/// def serialize_mosaic(namespace: str, mosaic: str, quantity: int) -> bytes:
+///     """
+///     Serialize a mosaic attached to a transfer.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_nem_serialize_mosaic(mp_obj_t namespace,
+                                                      mp_obj_t mosaic,
+                                                      mp_obj_t quantity) {
+  size_t size = NEM_FIXED_SIZE;
+  const char *ns = nem_get_str_arg(namespace, &size);
+  const char *m = nem_get_str_arg(mosaic, &size);
+  uint64_t q = trezor_obj_get_uint64(quantity);
+
+  nem_transaction_ctx ctx;
+  vstr_t vstr;
+  nem_start(&ctx, &vstr, NULL, size);
+  return nem_finish(&ctx, &vstr, nem_transaction_write_mosaic(&ctx, ns, m, q));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(mod_trezorcrypto_nem_serialize_mosaic_obj,
+                                 mod_trezorcrypto_nem_serialize_mosaic);
+
+/// def serialize_importance_transfer(
+///     network: int,
+///     timestamp: int,
+///     signer: bytes,
+///     fee: int,
+///     deadline: int,
+///     mode: int,
+///     remote: bytes,
+/// ) -> bytes:
+///     """
+///     Serialize an importance transfer.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_nem_serialize_importance_transfer(
+    size_t n_args, const mp_obj_t *args) {
+  nem_common_t c;
+  nem_get_common(args, &c);
+  uint32_t mode = trezor_obj_get_uint(args[5]);
+  mp_buffer_info_t remote;
+  mp_get_buffer_raise(args[6], &remote, MP_BUFFER_READ);
+  if (remote.len != sizeof(ed25519_public_key)) {
+    mp_raise_ValueError("Invalid length of public key");
+  }
+
+  nem_transaction_ctx ctx;
+  vstr_t vstr;
+  nem_start(&ctx, &vstr, c.signer, NEM_FIXED_SIZE);
+  bool ok = nem_transaction_create_importance_transfer(
+      &ctx, c.network, c.timestamp, c.signer, c.fee, c.deadline, mode,
+      remote.buf);
+  return nem_finish(&ctx, &vstr, ok);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_nem_serialize_importance_transfer_obj,
+    NEM_COMMON_ARGS + 2, NEM_COMMON_ARGS + 2,
+    mod_trezorcrypto_nem_serialize_importance_transfer);
+
+/// def serialize_aggregate_modification(
+///     network: int,
+///     timestamp: int,
+///     signer: bytes,
+///     fee: int,
+///     deadline: int,
+///     modifications: int,
+///     relative_change: bool,
+/// ) -> bytes:
+///     """
+///     Serialize an aggregate modification, without the cosignatory
+///     modifications and the minimum cosignatories that follow it.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_nem_serialize_aggregate_modification(
+    size_t n_args, const mp_obj_t *args) {
+  nem_common_t c;
+  nem_get_common(args, &c);
+  uint32_t modifications = trezor_obj_get_uint(args[5]);
+  bool relative_change = mp_obj_is_true(args[6]);
+
+  nem_transaction_ctx ctx;
+  vstr_t vstr;
+  nem_start(&ctx, &vstr, c.signer, NEM_FIXED_SIZE);
+  bool ok = nem_transaction_create_aggregate_modification(
+      &ctx, c.network, c.timestamp, c.signer, c.fee, c.deadline, modifications,
+      relative_change);
+  return nem_finish(&ctx, &vstr, ok);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_nem_serialize_aggregate_modification_obj,
+    NEM_COMMON_ARGS + 2, NEM_COMMON_ARGS + 2,
+    mod_trezorcrypto_nem_serialize_aggregate_modification);
+
+/// def serialize_cosignatory_modification(
+///     type: int, cosignatory: bytes
+/// ) -> bytes:
+///     """
+///     Serialize a cosignatory modification of an aggregate modification.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_nem_serialize_cosignatory_modification(
+    mp_obj_t type, mp_obj_t cosignatory) {
+  uint32_t t = trezor_obj_get_uint(type);
+  mp_buffer_info_t pk;
+  mp_get_buffer_raise(cosignatory, &pk, MP_BUFFER_READ);
+  if (pk.len != sizeof(ed25519_public_key)) {
+    mp_raise_ValueError("Invalid length of public key");
+  }
+
+  nem_transaction_ctx ctx;
+  vstr_t vstr;
+  nem_start(&ctx, &vstr, NULL, NEM_FIXED_SIZE);
+  return nem_finish(
+      &ctx, &vstr,
+      nem_transaction_write_cosignatory_modification(&ctx, t, pk.buf));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(
+    mod_trezorcrypto_nem_serialize_cosignatory_modification_obj,
+    mod_trezorcrypto_nem_serialize_cosignatory_modification);
+
+/// def serialize_minimum_cosignatories(relative_change: int) -> bytes:
+///     """
+///     Serialize the change of the minimum number of cosignatories.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_nem_serialize_minimum_cosignatories(
+    mp_obj_t relative_change) {
+  int32_t change = trezor_obj_get_int(relative_change);
+
+  nem_transaction_ctx ctx;
+  vstr_t vstr;
+  nem_start(&ctx, &vstr, NULL, NEM_FIXED_SIZE);
+  return nem_finish(
+      &ctx, &vstr, nem_transaction_write_minimum_cosignatories(&ctx, change));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(
+    mod_trezorcrypto_nem_serialize_minimum_cosignatories_obj,
+    mod_trezorcrypto_nem_serialize_minimum_cosignatories);
+
+/// def serialize_provision_namespace(
+///     network: int,
+///     timestamp: int,
+///     signer: bytes,
+///     fee: int,
+///     deadline: int,
+///     namespace: str,
+///     parent: Optional[str],
+///     sink: str,
+///     rental_fee: int,
+/// ) -> bytes:
+///     """
+///     Serialize a namespace provision.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_nem_serialize_provision_namespace(
+    size_t n_args, const mp_obj_t *args) {
+  nem_common_t c;
+  nem_get_common(args, &c);
+  size_t size = NEM_FIXED_SIZE;
+  const char *namespace = nem_get_str_arg(args[5], &size);
+  const char *parent = NULL;
+  if (args[6] != mp_const_none) {
+    parent = nem_get_str_arg(args[6], &size);
+  }
+  const char *sink = nem_get_address_arg(args[7]);
+  uint64_t rental_fee = trezor_obj_get_uint64(args[8]);
+
+  nem_transaction_ctx ctx;
+  vstr_t vstr;
+  nem_start(&ctx, &vstr, c.signer, size);
+  bool ok = nem_transaction_create_provision_namespace(
+      &ctx, c.network, c.timestamp, c.signer, c.fee, c.deadline, namespace,
+      parent, sink, rental_fee);
+  return nem_finish(&ctx, &vstr, ok);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_nem_serialize_provision_namespace_obj,
+    NEM_COMMON_ARGS + 4, NEM_COMMON_ARGS + 4,
+    mod_trezorcrypto_nem_serialize_provision_namespace);
+
+/// def serialize_mosaic_creation(
+///     network: int,
+///     timestamp: int,
+///     signer: bytes,
+///     fee: int,
+///     deadline: int,
+///     namespace: str,
+///     mosaic: str,
+///     description: str,
+///     divisibility: int,
+///     supply: int,
+///     mutable_supply: bool,
+///     transferable: bool,
+///     levy: int,
+///     levy_fee: int,
+///     levy_address: Optional[str],
+///     levy_namespace: Optional[str],
+///     levy_mosaic: Optional[str],
+///     sink: str,
+///     creation_fee: int,
+/// ) -> bytes:
+///     """
+///     Serialize a mosaic definition creation. The levy fields are only used
+///     if levy is not zero.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_nem_serialize_mosaic_creation(
+    size_t n_args, const mp_obj_t *args) {
+  nem_common_t c;
+  nem_get_common(args, &c);
+  size_t size = NEM_FIXED_SIZE + sizeof(ed25519_public_key);
+  const char *namespace = nem_get_str_arg(args[5], &size);
+  const char *mosaic = nem_get_str_arg(args[6], &size);
+  const char *description = nem_get_str_arg(args[7], &size);
+  uint32_t divisibility = trezor_obj_get_uint(args[8]);
+  uint64_t supply = trezor_obj_get_uint64(args[9]);
+  bool mutable_supply = mp_obj_is_true(args[10]);
+  bool transferable = mp_obj_is_true(args[11]);
+  uint32_t levy = trezor_obj_get_uint(args[12]);
+  uint64_t levy_fee = 0;
+  const char *levy_address = NULL;
+  const char *levy_namespace = NULL;
+  const char *levy_mosaic = NULL;
+  if (levy) {
+    levy_fee = trezor_obj_get_uint64(args[13]);
+    levy_address = nem_get_address_arg(args[14]);
+    levy_namespace = nem_get_str_arg(args[15], &size);
+    levy_mosaic = nem_get_str_arg(args[16], &size);
+  }
+  const char *sink = nem_get_address_arg(args[17]);
+  uint64_t creation_fee = trezor_obj_get_uint64(args[18]);
+
+  nem_transaction_ctx ctx;
+  vstr_t vstr;
+  nem_start(&ctx, &vstr, c.signer, size);
+  bool ok = nem_transaction_create_mosaic_creation(
+      &ctx, c.network, c.timestamp, c.signer, c.fee, c.deadline, namespace,
+      mosaic, description, divisibility, supply, mutable_supply, transferable,
+      levy, levy_fee, levy_address, levy_namespace, levy_mosaic, sink,
+      creation_fee);
+  return nem_finish(&ctx, &vstr, ok);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_nem_serialize_mosaic_creation_obj, NEM_COMMON_ARGS + 14,
+    NEM_COMMON_ARGS + 14, mod_trezorcrypto_nem_serialize_mosaic_creation);
+
+/// def serialize_mosaic_supply_change(
+///     network: int,
+///     timestamp: int,
+///     signer: bytes,
+///     fee: int,
+///     deadline: int,
+///     namespace: str,
+///     mosaic: str,
+///     type: int,
+///     delta: int,
+/// ) -> bytes:
+///     """
+///     Serialize a mosaic supply change.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_nem_serialize_mosaic_supply_change(
+    size_t n_args, const mp_obj_t *args) {
+  nem_common_t c;
+  nem_get_common(args, &c);
+  size_t size = NEM_FIXED_SIZE;
+  const char *namespace = nem_get_str_arg(args[5], &size);
+  const char *mosaic = nem_get_str_arg(args[6], &size);
+  uint32_t type = trezor_obj_get_uint(args[7]);
+  uint64_t delta = trezor_obj_get_uint64(args[8]);
+
+  nem_transaction_ctx ctx;
+  vstr_t vstr;
+  nem_start(&ctx, &vstr, c.signer, size);
+  bool ok = nem_transaction_create_mosaic_supply_change(
+      &ctx, c.network, c.timestamp, c.signer, c.fee, c.deadline, namespace,
+      mosaic, type, delta);
+  return nem_finish(&ctx, &vstr, ok);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_nem_serialize_mosaic_supply_change_obj,
+    NEM_COMMON_ARGS + 4, NEM_COMMON_ARGS + 4,
+    mod_trezorcrypto_nem_serialize_mosaic_supply_change);
+
+/// def serialize_multisig(
+///     network: int,
+///     timestamp: int,
+///     signer: bytes,
+///     fee: int,
+///     deadline: int,
+///     inner: bytes,
+/// ) -> bytes:
+///     """
+///     Wrap the serialized inner transaction in a multisig transaction.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_nem_serialize_multisig(size_t n_args,
+                                                        const mp_obj_t *args) {
+  nem_common_t c;
+  nem_get_common(args, &c);
+  mp_buffer_info_t inner_buf;
+  mp_get_buffer_raise(args[5], &inner_buf, MP_BUFFER_READ);
+
+  nem_transaction_ctx inner = {0};
+  nem_transaction_start(&inner, c.signer, inner_buf.buf, inner_buf.len);
+  inner.offset = inner_buf.len;
+
+  nem_transaction_ctx ctx;
+  vstr_t vstr;
+  nem_start(&ctx, &vstr, c.signer, NEM_FIXED_SIZE + inner_buf.len);
+  bool ok = nem_transaction_create_multisig(
+      &ctx, c.network, c.timestamp, c.signer, c.fee, c.deadline, &inner);
+  return nem_finish(&ctx, &vstr, ok);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_nem_serialize_multisig_obj, NEM_COMMON_ARGS + 1,
+    NEM_COMMON_ARGS + 1, mod_trezorcrypto_nem_serialize_multisig);
+
+/// def serialize_multisig_signature(
+///     network: int,
+///     timestamp: int,
+///     signer: bytes,
+///     fee: int,
+///     deadline: int,
+///     inner: bytes,
+///     inner_signer: bytes,
+/// ) -> bytes:
+///     """
+///     Serialize the cosignature of the serialized inner transaction signed by
+///     the multisig account inner_signer.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_nem_serialize_multisig_signature(
+    size_t n_args, const mp_obj_t *args) {
+  nem_common_t c;
+  nem_get_common(args, &c);
+  mp_buffer_info_t inner_buf, inner_signer;
+  mp_get_buffer_raise(args[5], &inner_buf, MP_BUFFER_READ);
+  mp_get_buffer_raise(args[6], &inner_signer, MP_BUFFER_READ);
+  if (inner_signer.len != sizeof(ed25519_public_key)) {
+    mp_raise_ValueError("Invalid length of public key");
+  }
+
+  // the inner context only provides the digest and the multisig address
+  nem_transaction_ctx inner = {0};
+  nem_transaction_start(&inner, inner_signer.buf, inner_buf.buf,
+                        inner_buf.len);
+  inner.offset = inner_buf.len;
+
+  nem_transaction_ctx ctx;
+  vstr_t vstr;
+  nem_start(&ctx, &vstr, c.signer, NEM_FIXED_SIZE);
+  bool ok = nem_transaction_create_multisig_signature(
+      &ctx, c.network, c.timestamp, c.signer, c.fee, c.deadline, &inner);
+  return nem_finish(&ctx, &vstr, ok);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_nem_serialize_multisig_signature_obj,
+    NEM_COMMON_ARGS + 2, NEM_COMMON_ARGS + 2,
+    mod_trezorcrypto_nem_serialize_multisig_signature);
+
 // objects definition
 STATIC const mp_rom_map_elem_t mod_trezorcrypto_nem_globals_table[] = {
     {MP_ROM_QSTR(MP_QSTR_validate_address),
      MP_ROM_PTR(&mod_trezorcrypto_nem_validate_address_obj)},
     {MP_ROM_QSTR(MP_QSTR_compute_address),
      MP_ROM_PTR(&mod_trezorcrypto_nem_compute_address_obj)},
+    {MP_ROM_QSTR(MP_QSTR_serialize_transfer),
+     MP_ROM_PTR(&mod_trezorcrypto_nem_serialize_transfer_obj)},
+    {MP_ROM_QSTR(MP_QSTR_serialize_mosaic),
+     MP_ROM_PTR(&mod_trezorcrypto_nem_serialize_mosaic_obj)},
+    {MP_ROM_QSTR(MP_QSTR_serialize_importance_transfer),
+     MP_ROM_PTR(&mod_trezorcrypto_nem_serialize_importance_transfer_obj)},
+    {MP_ROM_QSTR(MP_QSTR_serialize_aggregate_modification),
+     MP_ROM_PTR(&mod_trezorcrypto_nem_serialize_aggregate_modification_obj)},
+    {MP_ROM_QSTR(MP_QSTR_serialize_cosignatory_modification),
+     MP_ROM_PTR(&mod_trezorcrypto_nem_serialize_cosignatory_modification_obj)},
+    {MP_ROM_QSTR(MP_QSTR_serialize_minimum_cosignatories),
+     MP_ROM_PTR(&mod_trezorcrypto_nem_serialize_minimum_cosignatories_obj)},
+    {MP_ROM_QSTR(MP_QSTR_serialize_provision_namespace),
+     MP_ROM_PTR(&mod_trezorcrypto_nem_serialize_provision_namespace_obj)},
+    {MP_ROM_QSTR(MP_QSTR_serialize_mosaic_creation),
+     MP_ROM_PTR(&mod_trezorcrypto_nem_serialize_mosaic_creation_obj)},
+    {MP_ROM_QSTR(MP_QSTR_serialize_mosaic_supply_change),
+     MP_ROM_PTR(&mod_trezorcrypto_nem_serialize_mosaic_supply_change_obj)},
+    {MP_ROM_QSTR(MP_QSTR_serialize_multisig),
+     MP_ROM_PTR(&mod_trezorcrypto_nem_serialize_multisig_obj)},
+    {MP_ROM_QSTR(MP_QSTR_serialize_multisig_signature),
+     MP_ROM_PTR(&mod_trezorcrypto_nem_serialize_multisig_signature_obj)},
 };
 STATIC MP_DEFINE_CONST_DICT(mod_trezorcrypto_nem_globals,
                             mod_trezorcrypto_nem_globals_table);
@@ -22,6 +22,8 @@
 #include "vendor/trezor-crypto/ecdsa.h"
 #include "vendor/trezor-crypto/secp256k1.h"
 
+#include "trace.h"
+
 /// package: trezorcrypto.secp256k1
 
 /// def generate_secret() -> bytes:
@@ -140,9 +142,12 @@ STATIC mp_obj_t mod_trezorcrypto_secp256k1_sign(size_t n_args,
     mp_raise_ValueError("Invalid length of digest");
   }
   uint8_t out[65], pby;
-  if (0 != ecdsa_sign_digest(&secp256k1, (const uint8_t *)sk.buf,
-                             (const uint8_t *)dig.buf, out + 1, &pby,
-                             is_canonical)) {
+  trace_event(TRACE_SECP256K1_SIGN, TRACE_BEGIN);
+  int res = ecdsa_sign_digest(&secp256k1, (const uint8_t *)sk.buf,
+                              (const uint8_t *)dig.buf, out + 1, &pby,
+                              is_canonical);
+  trace_event(TRACE_SECP256K1_SIGN, TRACE_END);
+  if (0 != res) {
     mp_raise_ValueError("Signing failed");
   }
   out[0] = 27 + pby + compressed * 4;
@@ -246,6 +251,126 @@ STATIC mp_obj_t mod_trezorcrypto_secp256k1_multiply(mp_obj_t secret_key,
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_secp256k1_multiply_obj,
                                  mod_trezorcrypto_secp256k1_multiply);
 
+/// def schnorr_publickey(secret_key: bytes) -> bytes:
+///     """
+///     Computes the 32-byte BIP-340 public key from secret key.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_secp256k1_schnorr_publickey(
+    mp_obj_t secret_key) {
+  mp_buffer_info_t sk;
+  mp_get_buffer_raise(secret_key, &sk, MP_BUFFER_READ);
+  if (sk.len != 32) {
+    mp_raise_ValueError("Invalid length of secret key");
+  }
+  uint8_t out[32];
+  if (0 != bip340_get_public_key(&secp256k1, (const uint8_t *)sk.buf, out)) {
+    mp_raise_ValueError("Invalid secret key");
+  }
+  return mp_obj_new_bytes(out, sizeof(out));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(
+    mod_trezorcrypto_secp256k1_schnorr_publickey_obj,
+    mod_trezorcrypto_secp256k1_schnorr_publickey);
+
+/// def sign_schnorr(secret_key: bytes, digest: bytes) -> bytes:
+///     """
+///     Uses secret key to produce the BIP-340 signature of the digest.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_secp256k1_sign_schnorr(mp_obj_t secret_key,
+                                                        mp_obj_t digest) {
+  mp_buffer_info_t sk, dig;
+  mp_get_buffer_raise(secret_key, &sk, MP_BUFFER_READ);
+  mp_get_buffer_raise(digest, &dig, MP_BUFFER_READ);
+  if (sk.len != 32) {
+    mp_raise_ValueError("Invalid length of secret key");
+  }
+  if (dig.len != 32) {
+    mp_raise_ValueError("Invalid length of digest");
+  }
+  uint8_t aux_rand[32], out[64];
+  random_buffer(aux_rand, sizeof(aux_rand));
+  if (0 != bip340_sign_digest(&secp256k1, (const uint8_t *)sk.buf,
+                              (const uint8_t *)dig.buf, aux_rand, out)) {
+    mp_raise_ValueError("Signing failed");
+  }
+  return mp_obj_new_bytes(out, sizeof(out));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_secp256k1_sign_schnorr_obj,
+                                 mod_trezorcrypto_secp256k1_sign_schnorr);
+
+/// def verify_schnorr(
+///     public_key: bytes, signature: bytes, digest: bytes
+/// ) -> bool:
+///     """
+///     Uses the 32-byte public key to verify the BIP-340 signature of the
+///     digest. Returns True on success.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_secp256k1_verify_schnorr(mp_obj_t public_key,
+                                                          mp_obj_t signature,
+                                                          mp_obj_t digest) {
+  mp_buffer_info_t pk, sig, dig;
+  mp_get_buffer_raise(public_key, &pk, MP_BUFFER_READ);
+  mp_get_buffer_raise(signature, &sig, MP_BUFFER_READ);
+  mp_get_buffer_raise(digest, &dig, MP_BUFFER_READ);
+  if (pk.len != 32 || sig.len != 64 || dig.len != 32) {
+    return mp_const_false;
+  }
+  return mp_obj_new_bool(
+      0 == bip340_verify_digest(&secp256k1, (const uint8_t *)pk.buf,
+                                (const uint8_t *)sig.buf,
+                                (const uint8_t *)dig.buf));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(mod_trezorcrypto_secp256k1_verify_schnorr_obj,
+                                 mod_trezorcrypto_secp256k1_verify_schnorr);
+
+/// def verify_schnorr_batch(
+///     public_keys: List[bytes], signatures: List[bytes], digests: List[bytes]
+/// ) -> bool:
+///     """
+///     Verifies the BIP-340 signatures of the digests, BIP340_VERIFY_BATCH_SIZE
+///     at a time with one multi-scalar multiplication. Returns True if all of
+///     them are valid.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_secp256k1_verify_schnorr_batch(
+    mp_obj_t public_keys, mp_obj_t signatures, mp_obj_t digests) {
+  size_t n = 0, sigs_len = 0, digests_len = 0;
+  mp_obj_t *pkitems = NULL, *sigitems = NULL, *digestitems = NULL;
+  mp_obj_get_array(public_keys, &n, &pkitems);
+  mp_obj_get_array(signatures, &sigs_len, &sigitems);
+  mp_obj_get_array(digests, &digests_len, &digestitems);
+  if (sigs_len != n || digests_len != n) {
+    mp_raise_ValueError("Lists must have the same length");
+  }
+  const uint8_t *pks[BIP340_VERIFY_BATCH_SIZE] = {0};
+  const uint8_t *sigs[BIP340_VERIFY_BATCH_SIZE] = {0};
+  const uint8_t *digs[BIP340_VERIFY_BATCH_SIZE] = {0};
+  for (size_t start = 0; start < n; start += BIP340_VERIFY_BATCH_SIZE) {
+    size_t len = n - start;
+    if (len > BIP340_VERIFY_BATCH_SIZE) {
+      len = BIP340_VERIFY_BATCH_SIZE;
+    }
+    for (size_t i = 0; i < len; i++) {
+      mp_buffer_info_t pk, sig, dig;
+      mp_get_buffer_raise(pkitems[start + i], &pk, MP_BUFFER_READ);
+      mp_get_buffer_raise(sigitems[start + i], &sig, MP_BUFFER_READ);
+      mp_get_buffer_raise(digestitems[start + i], &dig, MP_BUFFER_READ);
+      if (pk.len != 32 || sig.len != 64 || dig.len != 32) {
+        return mp_const_false;
+      }
+      pks[i] = pk.buf;
+      sigs[i] = sig.buf;
+      digs[i] = dig.buf;
+    }
+    if (0 != bip340_verify_digest_batch(&secp256k1, len, pks, sigs, digs)) {
+      return mp_const_false;
+    }
+  }
+  return mp_const_true;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(
+    mod_trezorcrypto_secp256k1_verify_schnorr_batch_obj,
+    mod_trezorcrypto_secp256k1_verify_schnorr_batch);
+
 STATIC const mp_rom_map_elem_t mod_trezorcrypto_secp256k1_globals_table[] = {
     {MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_secp256k1)},
     {MP_ROM_QSTR(MP_QSTR_generate_secret),
@@ -260,6 +385,14 @@ STATIC const mp_rom_map_elem_t mod_trezorcrypto_secp256k1_globals_table[] = {
      MP_ROM_PTR(&mod_trezorcrypto_secp256k1_verify_recover_obj)},
     {MP_ROM_QSTR(MP_QSTR_multiply),
      MP_ROM_PTR(&mod_trezorcrypto_secp256k1_multiply_obj)},
+    {MP_ROM_QSTR(MP_QSTR_schnorr_publickey),
+     MP_ROM_PTR(&mod_trezorcrypto_secp256k1_schnorr_publickey_obj)},
+    {MP_ROM_QSTR(MP_QSTR_sign_schnorr),
+     MP_ROM_PTR(&mod_trezorcrypto_secp256k1_sign_schnorr_obj)},
+    {MP_ROM_QSTR(MP_QSTR_verify_schnorr),
+     MP_ROM_PTR(&mod_trezorcrypto_secp256k1_verify_schnorr_obj)},
+    {MP_ROM_QSTR(MP_QSTR_verify_schnorr_batch),
+     MP_ROM_PTR(&mod_trezorcrypto_secp256k1_verify_schnorr_batch_obj)},
 #if !BITCOIN_ONLY
     {MP_ROM_QSTR(MP_QSTR_CANONICAL_SIG_ETHEREUM),
      MP_ROM_INT(CANONICAL_SIG_ETHEREUM)},
@@ -57,20 +57,27 @@ typedef struct _mp_obj_secp256k1_context_t {
   mp_obj_base_t base;
   secp256k1_context *secp256k1_ctx;
   size_t secp256k1_ctx_size;
+  // The signing context takes the ecmult_gen table from flash
+  // (USE_ECMULT_STATIC_PRECOMPUTATION), so it is small and comes up at once.
+  // The ecmult table needed for verification is built into RAM on the first
+  // verify call only.
+  secp256k1_context *secp256k1_verify_ctx;
+  size_t secp256k1_verify_ctx_size;
   uint8_t secp256k1_ctx_buf[0];  // to be allocate via m_new_obj_var_maybe().
 } mp_obj_secp256k1_context_t;
 
 /// def __init__(self) -> None:
 ///     """
-///     Allocate and initialize secp256k1_context.
+///     Allocate and initialize secp256k1_context. The verification tables are
+///     built lazily on the first verify or verify_recover call.
 ///     """
 STATIC mp_obj_t mod_trezorcrypto_secp256k1_context_make_new(
     const mp_obj_type_t *type, size_t n_args, size_t n_kw,
     const mp_obj_t *args) {
   mp_arg_check_num(n_args, n_kw, 0, 0, false);
 
-  const size_t secp256k1_ctx_size = secp256k1_context_preallocated_size(
-      SECP256K1_CONTEXT_SIGN | SECP256K1_CONTEXT_VERIFY);
+  const size_t secp256k1_ctx_size =
+      secp256k1_context_preallocated_size(SECP256K1_CONTEXT_SIGN);
 
   mp_obj_secp256k1_context_t *o = m_new_obj_var_maybe_with_finaliser(
       mp_obj_secp256k1_context_t, uint8_t, secp256k1_ctx_size);
@@ -80,7 +87,9 @@ STATIC mp_obj_t mod_trezorcrypto_secp256k1_context_make_new(
   o->base.type = type;
   o->secp256k1_ctx_size = secp256k1_ctx_size;
   o->secp256k1_ctx = secp256k1_context_preallocated_create(
-      o->secp256k1_ctx_buf, SECP256K1_CONTEXT_SIGN | SECP256K1_CONTEXT_VERIFY);
+      o->secp256k1_ctx_buf, SECP256K1_CONTEXT_SIGN);
+  o->secp256k1_verify_ctx = NULL;
+  o->secp256k1_verify_ctx_size = 0;
 
   uint8_t rand[32] = {0};
   random_buffer(rand, 32);
@@ -100,6 +109,9 @@ STATIC mp_obj_t mod_trezorcrypto_secp256k1_context___del__(mp_obj_t self) {
   mp_obj_secp256k1_context_t *o = MP_OBJ_TO_PTR(self);
   secp256k1_context_preallocated_destroy(o->secp256k1_ctx);
   memzero(o->secp256k1_ctx_buf, o->secp256k1_ctx_size);
+  // The verification context holds public data only and its buffer is owned
+  // by the GC, which may have swept it already, so it is just dropped.
+  o->secp256k1_verify_ctx = NULL;
   return mp_const_none;
 }
 
@@ -108,11 +120,13 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorcrypto_secp256k1_context___del___obj,
 
 /// def size(self) -> int:
 ///     """
-///     Return the size in bytes of the internal secp256k1_ctx_buf buffer.
+///     Return the size in bytes of the internal secp256k1_ctx_buf buffer,
+///     including the verification tables if they have been built.
 ///     """
 STATIC mp_obj_t mod_trezorcrypto_secp256k1_context_size(mp_obj_t self) {
   mp_obj_secp256k1_context_t *o = MP_OBJ_TO_PTR(self);
-  return mp_obj_new_int_from_uint(o->secp256k1_ctx_size);
+  return mp_obj_new_int_from_uint(o->secp256k1_ctx_size +
+                                  o->secp256k1_verify_ctx_size);
 }
 
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorcrypto_secp256k1_context_size_obj,
@@ -124,6 +138,23 @@ static const secp256k1_context *mod_trezorcrypto_get_secp256k1_context(
   return o->secp256k1_ctx;
 }
 
+static const secp256k1_context *mod_trezorcrypto_get_secp256k1_verify_context(
+    mp_obj_t self) {
+  mp_obj_secp256k1_context_t *o = MP_OBJ_TO_PTR(self);
+  if (o->secp256k1_verify_ctx == NULL) {
+    const size_t size =
+        secp256k1_context_preallocated_size(SECP256K1_CONTEXT_VERIFY);
+    uint8_t *buf = m_new_maybe(uint8_t, size);
+    if (!buf) {
+      mp_raise_ValueError("secp256k1_zkp context is too large");
+    }
+    o->secp256k1_verify_ctx =
+        secp256k1_context_preallocated_create(buf, SECP256K1_CONTEXT_VERIFY);
+    o->secp256k1_verify_ctx_size = size;
+  }
+  return o->secp256k1_verify_ctx;
+}
+
 /// def generate_secret(self) -> bytes:
 ///     """
 ///     Generate secret key.
@@ -220,7 +251,7 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
 STATIC mp_obj_t
 mod_trezorcrypto_secp256k1_context_verify(size_t n_args, const mp_obj_t *args) {
   const secp256k1_context *ctx =
-      mod_trezorcrypto_get_secp256k1_context(args[0]);
+      mod_trezorcrypto_get_secp256k1_verify_context(args[0]);
   mp_buffer_info_t pk, sig, dig;
   mp_get_buffer_raise(args[1], &pk, MP_BUFFER_READ);
   mp_get_buffer_raise(args[2], &sig, MP_BUFFER_READ);
@@ -260,7 +291,8 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
 ///     """
 STATIC mp_obj_t mod_trezorcrypto_secp256k1_context_verify_recover(
     mp_obj_t self, mp_obj_t signature, mp_obj_t digest) {
-  const secp256k1_context *ctx = mod_trezorcrypto_get_secp256k1_context(self);
+  const secp256k1_context *ctx =
+      mod_trezorcrypto_get_secp256k1_verify_context(self);
   mp_buffer_info_t sig, dig;
   mp_get_buffer_raise(signature, &sig, MP_BUFFER_READ);
   mp_get_buffer_raise(digest, &dig, MP_BUFFER_READ);
@@ -19,6 +19,8 @@
 
 #include "py/objstr.h"
 
+#include "embed/extmod/trezorobj.h"
+
 #include "memzero.h"
 #include "sha2.h"
 
@@ -35,7 +37,8 @@ typedef struct _mp_obj_Sha1_t {
   SHA1_CTX ctx;
 } mp_obj_Sha1_t;
 
-STATIC mp_obj_t mod_trezorcrypto_Sha1_update(mp_obj_t self, mp_obj_t data);
+STATIC mp_obj_t mod_trezorcrypto_Sha1_update(size_t n_args,
+                                             const mp_obj_t *args);
 
 /// def __init__(self, data: bytes = None) -> None:
 ///     """
@@ -50,26 +53,32 @@ STATIC mp_obj_t mod_trezorcrypto_Sha1_make_new(const mp_obj_type_t *type,
   sha1_Init(&(o->ctx));
   // constructor called with bytes/str as first parameter
   if (n_args == 1) {
-    mod_trezorcrypto_Sha1_update(MP_OBJ_FROM_PTR(o), args[0]);
+    const mp_obj_t update_args[2] = {MP_OBJ_FROM_PTR(o), args[0]};
+    mod_trezorcrypto_Sha1_update(2, update_args);
   }
   return MP_OBJ_FROM_PTR(o);
 }
 
-/// def update(self, data: bytes) -> None:
+/// def update(
+///     self, data: bytes, offset: int = 0, length: Optional[int] = None
+/// ) -> None:
 ///     """
-///     Update the hash context with hashed data.
+///     Update the hash context with hashed data. If offset or length are
+///     given, only that part of data is hashed, without copying it.
 ///     """
-STATIC mp_obj_t mod_trezorcrypto_Sha1_update(mp_obj_t self, mp_obj_t data) {
-  mp_obj_Sha1_t *o = MP_OBJ_TO_PTR(self);
+STATIC mp_obj_t mod_trezorcrypto_Sha1_update(size_t n_args,
+                                             const mp_obj_t *args) {
+  mp_obj_Sha1_t *o = MP_OBJ_TO_PTR(args[0]);
   mp_buffer_info_t msg;
-  mp_get_buffer_raise(data, &msg, MP_BUFFER_READ);
+  trezor_obj_get_buffer_range(n_args - 1, args + 1, &msg);
   if (msg.len > 0) {
     sha1_Update(&(o->ctx), msg.buf, msg.len);
   }
   return mp_const_none;
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_Sha1_update_obj,
-                                 mod_trezorcrypto_Sha1_update);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_Sha1_update_obj, 2, 4,
+    mod_trezorcrypto_Sha1_update);
 
 /// def digest(self) -> bytes:
 ///     """
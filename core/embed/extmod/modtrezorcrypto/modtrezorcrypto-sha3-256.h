@@ -19,6 +19,8 @@
 
 #include "py/objstr.h"
 
+#include "embed/extmod/trezorobj.h"
+
 #include "memzero.h"
 #include "sha3.h"
 
@@ -36,7 +38,8 @@ typedef struct _mp_obj_Sha3_256_t {
   bool keccak;
 } mp_obj_Sha3_256_t;
 
-STATIC mp_obj_t mod_trezorcrypto_Sha3_256_update(mp_obj_t self, mp_obj_t data);
+STATIC mp_obj_t mod_trezorcrypto_Sha3_256_update(size_t n_args,
+                                                 const mp_obj_t *args);
 
 /// def __init__(self, data: bytes = None, keccak: bool = False) -> None:
 ///     """
@@ -63,26 +66,108 @@ STATIC mp_obj_t mod_trezorcrypto_Sha3_256_make_new(const mp_obj_type_t *type,
   }
 
   if (vals[0].u_obj != mp_const_none) {
-    mod_trezorcrypto_Sha3_256_update(MP_OBJ_FROM_PTR(o), vals[0].u_obj);
+    const mp_obj_t update_args[2] = {MP_OBJ_FROM_PTR(o), vals[0].u_obj};
+    mod_trezorcrypto_Sha3_256_update(2, update_args);
   }
   return MP_OBJ_FROM_PTR(o);
 }
 
-/// def update(self, data: bytes) -> None:
+/// def update(
+///     self, data: bytes, offset: int = 0, length: Optional[int] = None
+/// ) -> None:
 ///     """
-///     Update the hash context with hashed data.
+///     Update the hash context with hashed data. If offset or length are
+///     given, only that part of data is hashed, without copying it.
 ///     """
-STATIC mp_obj_t mod_trezorcrypto_Sha3_256_update(mp_obj_t self, mp_obj_t data) {
-  mp_obj_Sha3_256_t *o = MP_OBJ_TO_PTR(self);
+STATIC mp_obj_t mod_trezorcrypto_Sha3_256_update(size_t n_args,
+                                                 const mp_obj_t *args) {
+  mp_obj_Sha3_256_t *o = MP_OBJ_TO_PTR(args[0]);
   mp_buffer_info_t msg;
-  mp_get_buffer_raise(data, &msg, MP_BUFFER_READ);
+  trezor_obj_get_buffer_range(n_args - 1, args + 1, &msg);
   if (msg.len > 0) {
     sha3_Update(&(o->ctx), msg.buf, msg.len);
   }
   return mp_const_none;
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_Sha3_256_update_obj,
-                                 mod_trezorcrypto_Sha3_256_update);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_Sha3_256_update_obj, 2, 4,
+    mod_trezorcrypto_Sha3_256_update);
+
+// hashes the RLP header of a string or a list of the given length
+static void sha3_256_rlp_length(SHA3_CTX *ctx, uint32_t length, bool is_list) {
+  uint8_t header[1 + sizeof(uint32_t)];
+  uint8_t offset = is_list ? 0xC0 : 0x80;
+  if (length < 56) {
+    header[0] = offset + length;
+    sha3_Update(ctx, header, 1);
+    return;
+  }
+  size_t bytes = 0;
+  for (uint32_t l = length; l > 0; l >>= 8) {
+    bytes++;
+  }
+  header[0] = offset + 55 + bytes;
+  for (size_t i = 0; i < bytes; i++) {
+    header[bytes - i] = length >> (8 * i);
+  }
+  sha3_Update(ctx, header, 1 + bytes);
+}
+
+/// def update_rlp(self, data: Union[bytes, int]) -> None:
+///     """
+///     Update the hash context with the RLP encoding of a string, without
+///     building the encoding. Integers are encoded as big endian strings
+///     without leading zeros.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_Sha3_256_update_rlp(mp_obj_t self,
+                                                     mp_obj_t data) {
+  mp_obj_Sha3_256_t *o = MP_OBJ_TO_PTR(self);
+  uint8_t int_buf[sizeof(uint32_t)];
+  const uint8_t *buf = NULL;
+  size_t len = 0;
+  if (mp_obj_is_integer(data)) {
+    uint32_t value = trezor_obj_get_uint(data);
+    for (uint32_t v = value; v > 0; v >>= 8) {
+      len++;
+    }
+    for (size_t i = 0; i < len; i++) {
+      int_buf[len - 1 - i] = value >> (8 * i);
+    }
+    buf = int_buf;
+  } else {
+    mp_buffer_info_t msg;
+    mp_get_buffer_raise(data, &msg, MP_BUFFER_READ);
+    buf = msg.buf;
+    len = msg.len;
+  }
+  // a single byte below 0x80 is its own encoding
+  if (len != 1 || buf[0] >= 0x80) {
+    sha3_256_rlp_length(&(o->ctx), len, false);
+  }
+  if (len > 0) {
+    sha3_Update(&(o->ctx), buf, len);
+  }
+  return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_Sha3_256_update_rlp_obj,
+                                 mod_trezorcrypto_Sha3_256_update_rlp);
+
+/// def update_rlp_length(self, length: int, is_list: bool) -> None:
+///     """
+///     Update the hash context with the RLP header of a string or a list
+///     whose encoded content is length bytes long.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_Sha3_256_update_rlp_length(mp_obj_t self,
+                                                            mp_obj_t length,
+                                                            mp_obj_t is_list) {
+  mp_obj_Sha3_256_t *o = MP_OBJ_TO_PTR(self);
+  sha3_256_rlp_length(&(o->ctx), trezor_obj_get_uint(length),
+                      mp_obj_is_true(is_list));
+  return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(
+    mod_trezorcrypto_Sha3_256_update_rlp_length_obj,
+    mod_trezorcrypto_Sha3_256_update_rlp_length);
 
 /// def digest(self) -> bytes:
 ///     """
@@ -132,6 +217,10 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorcrypto_Sha3_256___del___obj,
 STATIC const mp_rom_map_elem_t mod_trezorcrypto_Sha3_256_locals_dict_table[] = {
     {MP_ROM_QSTR(MP_QSTR_update),
      MP_ROM_PTR(&mod_trezorcrypto_Sha3_256_update_obj)},
+    {MP_ROM_QSTR(MP_QSTR_update_rlp),
+     MP_ROM_PTR(&mod_trezorcrypto_Sha3_256_update_rlp_obj)},
+    {MP_ROM_QSTR(MP_QSTR_update_rlp_length),
+     MP_ROM_PTR(&mod_trezorcrypto_Sha3_256_update_rlp_length_obj)},
     {MP_ROM_QSTR(MP_QSTR_digest),
      MP_ROM_PTR(&mod_trezorcrypto_Sha3_256_digest_obj)},
     {MP_ROM_QSTR(MP_QSTR_copy),
@@ -21,33 +21,22 @@
 
 #include "embed/extmod/trezorobj.h"
 
+#include "memzero.h"
 #include "shamir.h"
 
 #define SHAMIR_MAX_SHARE_COUNT 16
 
 /// package: trezorcrypto.shamir
 
-/// def interpolate(shares: List[Tuple[int, bytes]], x: int) -> bytes:
-///     """
-///     Returns f(x) given the Shamir shares (x_1, f(x_1)), ... , (x_k, f(x_k)).
-///     :param shares: The Shamir shares.
-///     :type shares: A list of pairs (x_i, y_i), where x_i is an integer and
-///         y_i is an array of bytes representing the evaluations of the
-///         polynomials in x_i.
-///     :param int x: The x coordinate of the result.
-///     :return: Evaluations of the polynomials in x.
-///     :rtype: Array of bytes.
-///     """
-mp_obj_t mod_trezorcrypto_shamir_interpolate(mp_obj_t shares, mp_obj_t x) {
+static size_t shamir_get_shares(mp_obj_t shares, uint8_t *share_indices,
+                                const uint8_t **share_values,
+                                size_t *value_len_out) {
   size_t share_count;
   mp_obj_t *share_items;
   mp_obj_get_array(shares, &share_count, &share_items);
   if (share_count < 1 || share_count > SHAMIR_MAX_SHARE_COUNT) {
     mp_raise_ValueError("Invalid number of shares.");
   }
-  uint8_t x_uint8 = trezor_obj_get_uint8(x);
-  uint8_t share_indices[SHAMIR_MAX_SHARE_COUNT];
-  const uint8_t *share_values[SHAMIR_MAX_SHARE_COUNT];
   size_t value_len = 0;
   for (int i = 0; i < share_count; ++i) {
     mp_obj_t *share;
@@ -66,6 +55,28 @@ mp_obj_t mod_trezorcrypto_shamir_interpolate(mp_obj_t shares, mp_obj_t x) {
     }
     share_values[i] = value.buf;
   }
+  *value_len_out = value_len;
+  return share_count;
+}
+
+/// def interpolate(shares: List[Tuple[int, bytes]], x: int) -> bytes:
+///     """
+///     Returns f(x) given the Shamir shares (x_1, f(x_1)), ... , (x_k, f(x_k)).
+///     :param shares: The Shamir shares.
+///     :type shares: A list of pairs (x_i, y_i), where x_i is an integer and
+///         y_i is an array of bytes representing the evaluations of the
+///         polynomials in x_i.
+///     :param int x: The x coordinate of the result.
+///     :return: Evaluations of the polynomials in x.
+///     :rtype: Array of bytes.
+///     """
+mp_obj_t mod_trezorcrypto_shamir_interpolate(mp_obj_t shares, mp_obj_t x) {
+  uint8_t share_indices[SHAMIR_MAX_SHARE_COUNT];
+  const uint8_t *share_values[SHAMIR_MAX_SHARE_COUNT];
+  size_t value_len = 0;
+  size_t share_count =
+      shamir_get_shares(shares, share_indices, share_values, &value_len);
+  uint8_t x_uint8 = trezor_obj_get_uint8(x);
   vstr_t vstr;
   vstr_init_len(&vstr, value_len);
   if (shamir_interpolate((uint8_t *)vstr.buf, x_uint8, share_indices,
@@ -78,10 +89,58 @@ mp_obj_t mod_trezorcrypto_shamir_interpolate(mp_obj_t shares, mp_obj_t x) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_shamir_interpolate_obj,
                                  mod_trezorcrypto_shamir_interpolate);
 
+/// def interpolate_multi(
+///     shares: List[Tuple[int, bytes]], xs: Sequence[int]
+/// ) -> List[bytes]:
+///     """
+///     Returns [f(x) for x in xs] given the Shamir shares (x_1, f(x_1)), ... ,
+///     (x_k, f(x_k)). Faster than calling interpolate() for each x, because
+///     the work which does not depend on x is done only once.
+///     """
+mp_obj_t mod_trezorcrypto_shamir_interpolate_multi(mp_obj_t shares,
+                                                   mp_obj_t xs) {
+  uint8_t share_indices[SHAMIR_MAX_SHARE_COUNT];
+  const uint8_t *share_values[SHAMIR_MAX_SHARE_COUNT];
+  size_t value_len = 0;
+  size_t share_count =
+      shamir_get_shares(shares, share_indices, share_values, &value_len);
+
+  size_t result_count;
+  mp_obj_t *x_items;
+  mp_obj_get_array(xs, &result_count, &x_items);
+  if (result_count > SHAMIR_MAX_SHARE_COUNT) {
+    mp_raise_ValueError("Invalid number of results.");
+  }
+  uint8_t result_indices[SHAMIR_MAX_SHARE_COUNT];
+  uint8_t values[SHAMIR_MAX_SHARE_COUNT][SHAMIR_MAX_LEN];
+  uint8_t *results[SHAMIR_MAX_SHARE_COUNT];
+  for (size_t i = 0; i < result_count; ++i) {
+    result_indices[i] = trezor_obj_get_uint8(x_items[i]);
+    results[i] = values[i];
+  }
+
+  if (shamir_interpolate_multi(results, result_indices, result_count,
+                               share_indices, share_values, share_count,
+                               value_len) != true) {
+    mp_raise_ValueError("Share indices must be pairwise distinct.");
+  }
+  mp_obj_t list = mp_obj_new_list(result_count, NULL);
+  for (size_t i = 0; i < result_count; ++i) {
+    mp_obj_list_store(list, MP_OBJ_NEW_SMALL_INT(i),
+                      mp_obj_new_bytes(values[i], value_len));
+  }
+  memzero(values, sizeof(values));
+  return list;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_shamir_interpolate_multi_obj,
+                                 mod_trezorcrypto_shamir_interpolate_multi);
+
 STATIC const mp_rom_map_elem_t mod_trezorcrypto_shamir_globals_table[] = {
     {MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_shamir)},
     {MP_ROM_QSTR(MP_QSTR_interpolate),
      MP_ROM_PTR(&mod_trezorcrypto_shamir_interpolate_obj)},
+    {MP_ROM_QSTR(MP_QSTR_interpolate_multi),
+     MP_ROM_PTR(&mod_trezorcrypto_shamir_interpolate_multi_obj)},
 };
 STATIC MP_DEFINE_CONST_DICT(mod_trezorcrypto_shamir_globals,
                             mod_trezorcrypto_shamir_globals_table);
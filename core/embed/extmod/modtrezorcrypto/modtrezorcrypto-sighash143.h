@@ -0,0 +1,374 @@
+/*
+ * This file is part of the Trezor project, https://trezor.io/
+ *
+ * Copyright (c) SatoshiLabs
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "py/objstr.h"
+
+#include "embed/extmod/trezorobj.h"
+
+#include "blake2b.h"
+#include "memzero.h"
+#include "sha2.h"
+
+#define SIGHASH143_HASH_LENGTH 32
+#define SIGHASH143_OVERWINTERED 0x80000000
+
+typedef union {
+  SHA256_CTX sha256;
+  BLAKE2B_CTX blake2b;
+} sighash143_ctx_t;
+
+/// package: trezorcrypto.__init__
+
+/// class sighash143:
+///     """
+///     Signature hash of BIP-143 (segwit) or ZIP-143/ZIP-243 (Zcash)
+///     transaction inputs.
+///     """
+typedef struct _mp_obj_Sighash143_t {
+  mp_obj_base_t base;
+  bool zcash;
+  bool double_hash;
+  sighash143_ctx_t prevouts;
+  sighash143_ctx_t sequence;
+  sighash143_ctx_t outputs;
+} mp_obj_Sighash143_t;
+
+static void sighash143_init(const mp_obj_Sighash143_t *o, sighash143_ctx_t *ctx,
+                            const uint8_t *personal) {
+  if (o->zcash) {
+    blake2b_InitPersonal(&ctx->blake2b, SIGHASH143_HASH_LENGTH, personal, 16);
+  } else {
+    sha256_Init(&ctx->sha256);
+  }
+}
+
+static void sighash143_update(const mp_obj_Sighash143_t *o,
+                              sighash143_ctx_t *ctx, const uint8_t *data,
+                              size_t len) {
+  if (o->zcash) {
+    blake2b_Update(&ctx->blake2b, data, len);
+  } else {
+    sha256_Update(&ctx->sha256, data, len);
+  }
+}
+
+// Finalizes a copy of ctx, so that the running hashes can be finalized once
+// per signed input.
+static void sighash143_digest(const mp_obj_Sighash143_t *o,
+                              const sighash143_ctx_t *ctx, uint8_t *out) {
+  sighash143_ctx_t tmp;
+  memcpy(&tmp, ctx, sizeof(tmp));
+  if (o->zcash) {
+    blake2b_Final(&tmp.blake2b, out, SIGHASH143_HASH_LENGTH);
+  } else {
+    sha256_Final(&tmp.sha256, out);
+    if (o->double_hash) {
+      sha256_Raw(out, SHA256_DIGEST_LENGTH, out);
+    }
+  }
+  memzero(&tmp, sizeof(tmp));
+}
+
+static size_t sighash143_write_uint32(uint8_t *out, uint32_t n) {
+  out[0] = n & 0xFF;
+  out[1] = (n >> 8) & 0xFF;
+  out[2] = (n >> 16) & 0xFF;
+  out[3] = (n >> 24) & 0xFF;
+  return 4;
+}
+
+static size_t sighash143_write_uint64(uint8_t *out, uint64_t n) {
+  sighash143_write_uint32(out, n & 0xFFFFFFFF);
+  sighash143_write_uint32(out + 4, n >> 32);
+  return 8;
+}
+
+static size_t sighash143_write_varint(uint8_t *out, uint32_t n) {
+  if (n < 253) {
+    out[0] = n;
+    return 1;
+  } else if (n < 0x10000) {
+    out[0] = 253;
+    out[1] = n & 0xFF;
+    out[2] = (n >> 8) & 0xFF;
+    return 3;
+  } else {
+    out[0] = 254;
+    return 1 + sighash143_write_uint32(out + 1, n);
+  }
+}
+
+// Writes the outpoint, i.e. the previous transaction hash in the reversed byte
+// order followed by the output index.
+static size_t sighash143_write_outpoint(uint8_t *out, mp_obj_t prev_hash,
+                                        mp_obj_t prev_index) {
+  mp_buffer_info_t hash;
+  mp_get_buffer_raise(prev_hash, &hash, MP_BUFFER_READ);
+  if (hash.len != 32) {
+    mp_raise_ValueError("Invalid prev_hash length");
+  }
+  for (size_t i = 0; i < 32; i++) {
+    out[i] = ((const uint8_t *)hash.buf)[31 - i];
+  }
+  const uint32_t index = trezor_obj_get_uint(prev_index);
+  return 32 + sighash143_write_uint32(out + 32, index);
+}
+
+/// def __init__(self, double: bool = False, zcash: bool = False) -> None:
+///     """
+///     Creates a signature hash context. BIP-143 uses SHA256, applied twice
+///     if double is set. ZIP-143 and ZIP-243 use personalized BLAKE2b.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_Sighash143_make_new(const mp_obj_type_t *type,
+                                                     size_t n_args, size_t n_kw,
+                                                     const mp_obj_t *args) {
+  STATIC const mp_arg_t allowed_args[] = {
+      {MP_QSTR_double, MP_ARG_OBJ, {.u_obj = mp_const_false}},
+      {MP_QSTR_zcash, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_false}},
+  };
+  mp_arg_val_t vals[MP_ARRAY_SIZE(allowed_args)];
+  mp_arg_parse_all_kw_array(n_args, n_kw, args, MP_ARRAY_SIZE(allowed_args),
+                            allowed_args, vals);
+
+  mp_obj_Sighash143_t *o = m_new_obj_with_finaliser(mp_obj_Sighash143_t);
+  o->base.type = type;
+  o->double_hash = mp_obj_is_true(vals[0].u_obj);
+  o->zcash = mp_obj_is_true(vals[1].u_obj);
+  sighash143_init(o, &o->prevouts, (const uint8_t *)"ZcashPrevoutHash");
+  sighash143_init(o, &o->sequence, (const uint8_t *)"ZcashSequencHash");
+  sighash143_init(o, &o->outputs, (const uint8_t *)"ZcashOutputsHash");
+  return MP_OBJ_FROM_PTR(o);
+}
+
+/// def add_input(
+///     self, prev_hash: bytes, prev_index: int, sequence: int
+/// ) -> None:
+///     """
+///     Adds the outpoint and the sequence number of a transaction input.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_Sighash143_add_input(size_t n_args,
+                                                      const mp_obj_t *args) {
+  mp_obj_Sighash143_t *o = MP_OBJ_TO_PTR(args[0]);
+  uint8_t buf[36];
+  size_t len = sighash143_write_outpoint(buf, args[1], args[2]);
+  sighash143_update(o, &o->prevouts, buf, len);
+  len = sighash143_write_uint32(buf, trezor_obj_get_uint(args[3]));
+  sighash143_update(o, &o->sequence, buf, len);
+  return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_Sighash143_add_input_obj, 4, 4,
+    mod_trezorcrypto_Sighash143_add_input);
+
+/// def add_output(self, amount: int, script_pubkey: bytes) -> None:
+///     """
+///     Adds the amount and the script of a transaction output.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_Sighash143_add_output(mp_obj_t self,
+                                                       mp_obj_t amount,
+                                                       mp_obj_t script_pubkey) {
+  mp_obj_Sighash143_t *o = MP_OBJ_TO_PTR(self);
+  mp_buffer_info_t script;
+  mp_get_buffer_raise(script_pubkey, &script, MP_BUFFER_READ);
+  uint8_t buf[8 + 5];
+  size_t len = sighash143_write_uint64(buf, trezor_obj_get_uint64(amount));
+  len += sighash143_write_varint(buf + len, script.len);
+  sighash143_update(o, &o->outputs, buf, len);
+  sighash143_update(o, &o->outputs, script.buf, script.len);
+  return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(mod_trezorcrypto_Sighash143_add_output_obj,
+                                 mod_trezorcrypto_Sighash143_add_output);
+
+/// def prevouts_hash(self) -> bytes:
+///     """
+///     Returns the hash of the outpoints added so far.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_Sighash143_prevouts_hash(mp_obj_t self) {
+  mp_obj_Sighash143_t *o = MP_OBJ_TO_PTR(self);
+  uint8_t out[SIGHASH143_HASH_LENGTH];
+  sighash143_digest(o, &o->prevouts, out);
+  return mp_obj_new_bytes(out, sizeof(out));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorcrypto_Sighash143_prevouts_hash_obj,
+                                 mod_trezorcrypto_Sighash143_prevouts_hash);
+
+/// def sequence_hash(self) -> bytes:
+///     """
+///     Returns the hash of the sequence numbers added so far.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_Sighash143_sequence_hash(mp_obj_t self) {
+  mp_obj_Sighash143_t *o = MP_OBJ_TO_PTR(self);
+  uint8_t out[SIGHASH143_HASH_LENGTH];
+  sighash143_digest(o, &o->sequence, out);
+  return mp_obj_new_bytes(out, sizeof(out));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorcrypto_Sighash143_sequence_hash_obj,
+                                 mod_trezorcrypto_Sighash143_sequence_hash);
+
+/// def outputs_hash(self) -> bytes:
+///     """
+///     Returns the hash of the outputs added so far.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_Sighash143_outputs_hash(mp_obj_t self) {
+  mp_obj_Sighash143_t *o = MP_OBJ_TO_PTR(self);
+  uint8_t out[SIGHASH143_HASH_LENGTH];
+  sighash143_digest(o, &o->outputs, out);
+  return mp_obj_new_bytes(out, sizeof(out));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorcrypto_Sighash143_outputs_hash_obj,
+                                 mod_trezorcrypto_Sighash143_outputs_hash);
+
+/// def preimage_hash(
+///     self,
+///     prev_hash: bytes,
+///     prev_index: int,
+///     script_code: bytes,
+///     amount: int,
+///     sequence: int,
+///     version: int,
+///     lock_time: int,
+///     hash_type: int,
+///     version_group_id: int = 0,
+///     expiry: int = 0,
+///     branch_id: int = 0,
+/// ) -> bytes:
+///     """
+///     Returns the signature hash of the given input. The last three
+///     arguments are used only by Zcash, where version must be 3 or 4.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_Sighash143_preimage_hash(
+    size_t n_args, const mp_obj_t *args) {
+  mp_obj_Sighash143_t *o = MP_OBJ_TO_PTR(args[0]);
+  mp_buffer_info_t script_code;
+  mp_get_buffer_raise(args[3], &script_code, MP_BUFFER_READ);
+  const uint64_t amount = trezor_obj_get_uint64(args[4]);
+  const uint32_t sequence = trezor_obj_get_uint(args[5]);
+  const uint32_t version = trezor_obj_get_uint(args[6]);
+  const uint32_t lock_time = trezor_obj_get_uint(args[7]);
+  const uint32_t hash_type = trezor_obj_get_uint(args[8]);
+  const uint32_t version_group_id =
+      n_args > 9 ? trezor_obj_get_uint(args[9]) : 0;
+  const uint32_t expiry = n_args > 10 ? trezor_obj_get_uint(args[10]) : 0;
+  const uint32_t branch_id = n_args > 11 ? trezor_obj_get_uint(args[11]) : 0;
+
+  if (o->zcash && version != 3 && version != 4) {
+    mp_raise_ValueError("Unsupported version for overwintered transaction");
+  }
+
+  // the longest part is the Zcash v4 header followed by the outpoint and the
+  // script code length
+  uint8_t buf[4 * 4 + 6 * SIGHASH143_HASH_LENGTH + 8 + 36 + 5];
+  size_t len = 0;
+  sighash143_ctx_t preimage;
+
+  if (o->zcash) {
+    uint8_t personal[16] = "ZcashSigHash";
+    sighash143_write_uint32(personal + 12, branch_id);
+    sighash143_init(o, &preimage, personal);
+
+    len += sighash143_write_uint32(buf + len,
+                                   version | SIGHASH143_OVERWINTERED);
+    len += sighash143_write_uint32(buf + len, version_group_id);
+    sighash143_digest(o, &o->prevouts, buf + len);
+    len += SIGHASH143_HASH_LENGTH;
+    sighash143_digest(o, &o->sequence, buf + len);
+    len += SIGHASH143_HASH_LENGTH;
+    sighash143_digest(o, &o->outputs, buf + len);
+    len += SIGHASH143_HASH_LENGTH;
+    // hashJoinSplits, for v4 also hashShieldedSpends and hashShieldedOutputs
+    const size_t zero_hashes = version == 3 ? 1 : 3;
+    memzero(buf + len, zero_hashes * SIGHASH143_HASH_LENGTH);
+    len += zero_hashes * SIGHASH143_HASH_LENGTH;
+    len += sighash143_write_uint32(buf + len, lock_time);
+    len += sighash143_write_uint32(buf + len, expiry);
+    if (version == 4) {
+      len += sighash143_write_uint64(buf + len, 0);  // valueBalance
+    }
+    len += sighash143_write_uint32(buf + len, hash_type);
+  } else {
+    sighash143_init(o, &preimage, NULL);
+
+    len += sighash143_write_uint32(buf + len, version);
+    sighash143_digest(o, &o->prevouts, buf + len);
+    len += SIGHASH143_HASH_LENGTH;
+    sighash143_digest(o, &o->sequence, buf + len);
+    len += SIGHASH143_HASH_LENGTH;
+  }
+
+  len += sighash143_write_outpoint(buf + len, args[1], args[2]);
+  len += sighash143_write_varint(buf + len, script_code.len);
+  sighash143_update(o, &preimage, buf, len);
+  sighash143_update(o, &preimage, script_code.buf, script_code.len);
+
+  len = sighash143_write_uint64(buf, amount);
+  len += sighash143_write_uint32(buf + len, sequence);
+  if (!o->zcash) {
+    sighash143_digest(o, &o->outputs, buf + len);
+    len += SIGHASH143_HASH_LENGTH;
+    len += sighash143_write_uint32(buf + len, lock_time);
+    len += sighash143_write_uint32(buf + len, hash_type);
+  }
+  sighash143_update(o, &preimage, buf, len);
+
+  uint8_t out[SIGHASH143_HASH_LENGTH];
+  sighash143_digest(o, &preimage, out);
+  memzero(&preimage, sizeof(preimage));
+  return mp_obj_new_bytes(out, sizeof(out));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_Sighash143_preimage_hash_obj, 9, 12,
+    mod_trezorcrypto_Sighash143_preimage_hash);
+
+STATIC mp_obj_t mod_trezorcrypto_Sighash143___del__(mp_obj_t self) {
+  mp_obj_Sighash143_t *o = MP_OBJ_TO_PTR(self);
+  memzero(&(o->prevouts), sizeof(sighash143_ctx_t));
+  memzero(&(o->sequence), sizeof(sighash143_ctx_t));
+  memzero(&(o->outputs), sizeof(sighash143_ctx_t));
+  return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorcrypto_Sighash143___del___obj,
+                                 mod_trezorcrypto_Sighash143___del__);
+
+STATIC const mp_rom_map_elem_t
+    mod_trezorcrypto_Sighash143_locals_dict_table[] = {
+        {MP_ROM_QSTR(MP_QSTR_add_input),
+         MP_ROM_PTR(&mod_trezorcrypto_Sighash143_add_input_obj)},
+        {MP_ROM_QSTR(MP_QSTR_add_output),
+         MP_ROM_PTR(&mod_trezorcrypto_Sighash143_add_output_obj)},
+        {MP_ROM_QSTR(MP_QSTR_prevouts_hash),
+         MP_ROM_PTR(&mod_trezorcrypto_Sighash143_prevouts_hash_obj)},
+        {MP_ROM_QSTR(MP_QSTR_sequence_hash),
+         MP_ROM_PTR(&mod_trezorcrypto_Sighash143_sequence_hash_obj)},
+        {MP_ROM_QSTR(MP_QSTR_outputs_hash),
+         MP_ROM_PTR(&mod_trezorcrypto_Sighash143_outputs_hash_obj)},
+        {MP_ROM_QSTR(MP_QSTR_preimage_hash),
+         MP_ROM_PTR(&mod_trezorcrypto_Sighash143_preimage_hash_obj)},
+        {MP_ROM_QSTR(MP_QSTR___del__),
+         MP_ROM_PTR(&mod_trezorcrypto_Sighash143___del___obj)},
+};
+STATIC MP_DEFINE_CONST_DICT(mod_trezorcrypto_Sighash143_locals_dict,
+                            mod_trezorcrypto_Sighash143_locals_dict_table);
+
+STATIC const mp_obj_type_t mod_trezorcrypto_Sighash143_type = {
+    {&mp_type_type},
+    .name = MP_QSTR_Sighash143,
+    .make_new = mod_trezorcrypto_Sighash143_make_new,
+    .locals_dict = (void *)&mod_trezorcrypto_Sighash143_locals_dict,
+};
@@ -20,8 +20,12 @@
 #include "py/obj.h"
 #include "py/runtime.h"
 
+#include "embed/extmod/trezorobj.h"
+
 #include "slip39.h"
 
+#define SLIP39_MAX_WORD_COUNT 64
+
 /// package: trezorcrypto.slip39
 
 /// def compute_mask(prefix: int) -> int:
@@ -102,6 +106,123 @@ STATIC mp_obj_t mod_trezorcrypto_slip39_get_word(mp_obj_t _index) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorcrypto_slip39_get_word_obj,
                                  mod_trezorcrypto_slip39_get_word);
 
+static size_t slip39_get_indices(mp_obj_t data, uint16_t *indices,
+                                 size_t extra) {
+  size_t count;
+  mp_obj_t *items;
+  mp_obj_get_array(data, &count, &items);
+  if (count + extra > SLIP39_MAX_WORD_COUNT) {
+    mp_raise_ValueError("Invalid mnemonic length");
+  }
+  for (size_t i = 0; i < count; i++) {
+    mp_uint_t index = trezor_obj_get_uint(items[i]);
+    if (index > 1023) {
+      mp_raise_ValueError("Invalid wordlist index");
+    }
+    indices[i] = index;
+  }
+  return count;
+}
+
+/// def rs1024_verify_checksum(data: Sequence[int]) -> bool:
+///     """
+///     Verifies the RS1024 checksum of the word indices of a mnemonic, the
+///     last three of which are the checksum.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_slip39_rs1024_verify_checksum(mp_obj_t data) {
+  uint16_t indices[SLIP39_MAX_WORD_COUNT];
+  size_t count = slip39_get_indices(data, indices, 0);
+  return mp_obj_new_bool(rs1024_verify_checksum(indices, count));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(
+    mod_trezorcrypto_slip39_rs1024_verify_checksum_obj,
+    mod_trezorcrypto_slip39_rs1024_verify_checksum);
+
+/// def rs1024_create_checksum(data: Sequence[int]) -> Tuple[int, int, int]:
+///     """
+///     Returns the RS1024 checksum of the word indices of a mnemonic.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_slip39_rs1024_create_checksum(mp_obj_t data) {
+  uint16_t indices[SLIP39_MAX_WORD_COUNT];
+  size_t count = slip39_get_indices(data, indices,
+                                    SLIP39_RS1024_CHECKSUM_LENGTH) +
+                 SLIP39_RS1024_CHECKSUM_LENGTH;
+  rs1024_create_checksum(indices, count);
+  mp_obj_t checksum[SLIP39_RS1024_CHECKSUM_LENGTH];
+  for (size_t i = 0; i < SLIP39_RS1024_CHECKSUM_LENGTH; i++) {
+    checksum[i] = mp_obj_new_int_from_uint(
+        indices[count - SLIP39_RS1024_CHECKSUM_LENGTH + i]);
+  }
+  return mp_obj_new_tuple(SLIP39_RS1024_CHECKSUM_LENGTH, checksum);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(
+    mod_trezorcrypto_slip39_rs1024_create_checksum_obj,
+    mod_trezorcrypto_slip39_rs1024_create_checksum);
+
+static mp_obj_t slip39_crypt(size_t n_args, const mp_obj_t *args,
+                             bool decrypt) {
+  mp_buffer_info_t secret, passphrase;
+  mp_get_buffer_raise(args[0], &secret, MP_BUFFER_READ);
+  mp_get_buffer_raise(args[1], &passphrase, MP_BUFFER_READ);
+  uint8_t iteration_exponent = trezor_obj_get_uint8(args[2]);
+  mp_uint_t identifier = trezor_obj_get_uint(args[3]);
+  if (identifier > 0x7FFF) {
+    mp_raise_ValueError("Invalid identifier");
+  }
+
+  vstr_t vstr;
+  vstr_init_len(&vstr, secret.len);
+  bool ok;
+  if (decrypt) {
+    ok = slip39_decrypt(secret.buf, secret.len, passphrase.buf, passphrase.len,
+                        iteration_exponent, identifier, (uint8_t *)vstr.buf);
+  } else {
+    ok = slip39_encrypt(secret.buf, secret.len, passphrase.buf, passphrase.len,
+                        iteration_exponent, identifier, (uint8_t *)vstr.buf);
+  }
+  if (!ok) {
+    vstr_clear(&vstr);
+    mp_raise_ValueError("Invalid secret length or iteration exponent");
+  }
+  return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
+}
+
+/// def encrypt(
+///     master_secret: bytes,
+///     passphrase: bytes,
+///     iteration_exponent: int,
+///     identifier: int,
+/// ) -> bytes:
+///     """
+///     Converts the Master Secret to the Encrypted Master Secret by applying
+///     the passphrase with the Feistel network of SLIP-39.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_slip39_encrypt(size_t n_args,
+                                                const mp_obj_t *args) {
+  return slip39_crypt(n_args, args, false);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_trezorcrypto_slip39_encrypt_obj,
+                                           4, 4,
+                                           mod_trezorcrypto_slip39_encrypt);
+
+/// def decrypt(
+///     encrypted_master_secret: bytes,
+///     passphrase: bytes,
+///     iteration_exponent: int,
+///     identifier: int,
+/// ) -> bytes:
+///     """
+///     Converts the Encrypted Master Secret to the Master Secret by applying
+///     the passphrase with the Feistel network of SLIP-39.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_slip39_decrypt(size_t n_args,
+                                                const mp_obj_t *args) {
+  return slip39_crypt(n_args, args, true);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_trezorcrypto_slip39_decrypt_obj,
+                                           4, 4,
+                                           mod_trezorcrypto_slip39_decrypt);
+
 STATIC const mp_rom_map_elem_t mod_trezorcrypto_slip39_globals_table[] = {
     {MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_slip39)},
     {MP_ROM_QSTR(MP_QSTR_compute_mask),
@@ -112,6 +233,14 @@ STATIC const mp_rom_map_elem_t mod_trezorcrypto_slip39_globals_table[] = {
      MP_ROM_PTR(&mod_trezorcrypto_slip39_word_index_obj)},
     {MP_ROM_QSTR(MP_QSTR_get_word),
      MP_ROM_PTR(&mod_trezorcrypto_slip39_get_word_obj)},
+    {MP_ROM_QSTR(MP_QSTR_rs1024_verify_checksum),
+     MP_ROM_PTR(&mod_trezorcrypto_slip39_rs1024_verify_checksum_obj)},
+    {MP_ROM_QSTR(MP_QSTR_rs1024_create_checksum),
+     MP_ROM_PTR(&mod_trezorcrypto_slip39_rs1024_create_checksum_obj)},
+    {MP_ROM_QSTR(MP_QSTR_encrypt),
+     MP_ROM_PTR(&mod_trezorcrypto_slip39_encrypt_obj)},
+    {MP_ROM_QSTR(MP_QSTR_decrypt),
+     MP_ROM_PTR(&mod_trezorcrypto_slip39_decrypt_obj)},
 };
 STATIC MP_DEFINE_CONST_DICT(mod_trezorcrypto_slip39_globals,
                             mod_trezorcrypto_slip39_globals_table);
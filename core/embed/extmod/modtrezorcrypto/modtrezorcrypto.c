@@ -47,6 +47,7 @@
 #include "modtrezorcrypto-sha3-512.h"
 #include "modtrezorcrypto-sha512.h"
 #include "modtrezorcrypto-shamir.h"
+#include "modtrezorcrypto-sighash143.h"
 #include "modtrezorcrypto-slip39.h"
 #if !BITCOIN_ONLY
 #include "modtrezorcrypto-monero.h"
@@ -77,6 +78,7 @@ STATIC const mp_rom_map_elem_t mp_module_trezorcrypto_globals_table[] = {
      MP_ROM_PTR(&mod_trezorcrypto_nist256p1_module)},
     {MP_ROM_QSTR(MP_QSTR_groestl512),
      MP_ROM_PTR(&mod_trezorcrypto_Groestl512_type)},
+    {MP_ROM_QSTR(MP_QSTR_hash160), MP_ROM_PTR(&mod_trezorcrypto_hash160_obj)},
 #if !BITCOIN_ONLY
     {MP_ROM_QSTR(MP_QSTR_nem), MP_ROM_PTR(&mod_trezorcrypto_nem_module)},
 #endif
@@ -98,6 +100,8 @@ STATIC const mp_rom_map_elem_t mp_module_trezorcrypto_globals_table[] = {
     {MP_ROM_QSTR(MP_QSTR_sha3_512),
      MP_ROM_PTR(&mod_trezorcrypto_Sha3_512_type)},
     {MP_ROM_QSTR(MP_QSTR_shamir), MP_ROM_PTR(&mod_trezorcrypto_shamir_module)},
+    {MP_ROM_QSTR(MP_QSTR_sighash143),
+     MP_ROM_PTR(&mod_trezorcrypto_Sighash143_type)},
     {MP_ROM_QSTR(MP_QSTR_slip39), MP_ROM_PTR(&mod_trezorcrypto_slip39_module)},
 };
 STATIC MP_DEFINE_CONST_DICT(mp_module_trezorcrypto_globals,
@@ -17,6 +17,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
+
 #include "embed/extmod/trezorobj.h"
 #include "py/mperrno.h"
 #include "py/objstr.h"
@@ -57,8 +59,87 @@
 
 static FATFS fs_instance;
 
+// Number of sectors kept by the write-through sector cache below disk_read()
+// and disk_write(). FatFs holds a single FAT or directory sector in its
+// window, so every path lookup reads the same few sectors again. Set to 0 to
+// disable the cache.
+#ifndef FATFS_CACHE_SECTORS
+#define FATFS_CACHE_SECTORS 4
+#endif
+
+#if FATFS_CACHE_SECTORS > 0
+
+typedef struct {
+  LBA_t sector;
+  uint32_t used;  // time of the last use, 0 if the entry is empty
+  uint32_t data[SDCARD_BLOCK_SIZE / sizeof(uint32_t)];
+} fatfs_cache_entry_t;
+
+static fatfs_cache_entry_t fatfs_cache[FATFS_CACHE_SECTORS];
+static uint32_t fatfs_cache_clock;
+
+static void _fatfs_cache_invalidate(void) {
+  for (int i = 0; i < FATFS_CACHE_SECTORS; i++) {
+    fatfs_cache[i].used = 0;
+  }
+}
+
+static fatfs_cache_entry_t *_fatfs_cache_find(LBA_t sector) {
+  for (int i = 0; i < FATFS_CACHE_SECTORS; i++) {
+    if (fatfs_cache[i].used != 0 && fatfs_cache[i].sector == sector) {
+      return &fatfs_cache[i];
+    }
+  }
+  return NULL;
+}
+
+static void _fatfs_cache_store(LBA_t sector, const BYTE *buff) {
+  fatfs_cache_entry_t *entry = _fatfs_cache_find(sector);
+  if (entry == NULL) {
+    // replace the least recently used entry
+    entry = &fatfs_cache[0];
+    for (int i = 1; i < FATFS_CACHE_SECTORS; i++) {
+      if (fatfs_cache[i].used < entry->used) {
+        entry = &fatfs_cache[i];
+      }
+    }
+  }
+  entry->sector = sector;
+  entry->used = ++fatfs_cache_clock;
+  memcpy(entry->data, buff, SDCARD_BLOCK_SIZE);
+}
+
+// Called after writing count sectors from buff. Cached copies of the written
+// sectors are refreshed, or dropped if the write failed.
+static void _fatfs_cache_written(LBA_t sector, const BYTE *buff, UINT count,
+                                 bool ok) {
+  for (int i = 0; i < FATFS_CACHE_SECTORS; i++) {
+    fatfs_cache_entry_t *entry = &fatfs_cache[i];
+    if (entry->used == 0 || entry->sector < sector ||
+        entry->sector - sector >= count) {
+      continue;
+    }
+    if (ok) {
+      memcpy(entry->data, buff + (entry->sector - sector) * SDCARD_BLOCK_SIZE,
+             SDCARD_BLOCK_SIZE);
+    } else {
+      entry->used = 0;
+    }
+  }
+}
+
+#else
+
+static void _fatfs_cache_invalidate(void) {}
+
+#endif
+
 bool _fatfs_instance_is_mounted() { return fs_instance.fs_type != 0; }
-void _fatfs_unmount_instance() { fs_instance.fs_type = 0; }
+void _fatfs_unmount_instance() {
+  fs_instance.fs_type = 0;
+  // the card may be replaced before the next mount
+  _fatfs_cache_invalidate();
+}
 
 /// class FatFSError(OSError):
 ///     pass
@@ -95,7 +176,24 @@ DSTATUS disk_status(BYTE pdrv) {
 
 DRESULT disk_read(BYTE pdrv, BYTE *buff, LBA_t sector, UINT count) {
   (void)pdrv;
+#if FATFS_CACHE_SECTORS > 0
+  // FatFs reads FAT and directory sectors one at a time, file data mostly in
+  // longer runs that go straight to the card
+  if (count == 1) {
+    fatfs_cache_entry_t *entry = _fatfs_cache_find(sector);
+    if (entry != NULL) {
+      entry->used = ++fatfs_cache_clock;
+      memcpy(buff, entry->data, SDCARD_BLOCK_SIZE);
+      return RES_OK;
+    }
+  }
+#endif
   if (sectrue == sdcard_read_blocks((uint32_t *)buff, sector, count)) {
+#if FATFS_CACHE_SECTORS > 0
+    if (count == 1) {
+      _fatfs_cache_store(sector, buff);
+    }
+#endif
     return RES_OK;
   } else {
     return RES_ERROR;
@@ -104,7 +202,14 @@ DRESULT disk_read(BYTE pdrv, BYTE *buff, LBA_t sector, UINT count) {
 
 DRESULT disk_write(BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count) {
   (void)pdrv;
-  if (sectrue == sdcard_write_blocks((const uint32_t *)buff, sector, count)) {
+  secbool ok = sdcard_write_blocks((const uint32_t *)buff, sector, count);
+#if FATFS_CACHE_SECTORS > 0
+  _fatfs_cache_written(sector, buff, count, sectrue == ok);
+  if (sectrue == ok && count == 1) {
+    _fatfs_cache_store(sector, buff);
+  }
+#endif
+  if (sectrue == ok) {
     return RES_OK;
   } else {
     return RES_ERROR;
@@ -494,6 +599,7 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorio_fatfs_rename_obj,
 ///     Mount the SD card filesystem.
 ///     """
 STATIC mp_obj_t mod_trezorio_fatfs_mount() {
+  _fatfs_cache_invalidate();
   FRESULT res = f_mount(&fs_instance, "", 1);
   if (res != FR_OK) {
     if (res == FR_NO_FILESYSTEM) {
@@ -91,7 +91,10 @@ STATIC mp_obj_t mod_trezorio_HID_make_new(const mp_obj_type_t *type,
   mp_obj_HID_t *o = m_new_obj(mp_obj_HID_t);
   o->base.type = type;
 
-  o->info.rx_buffer = m_new(uint8_t, max_packet_len);
+  o->info.rx_buffer = m_new(uint8_t, USB_REPORT_QUEUE_LEN * max_packet_len);
+  o->info.tx_buffer = m_new(uint8_t, USB_REPORT_QUEUE_LEN * max_packet_len);
+  o->info.rx_queue_len = USB_REPORT_QUEUE_LEN;
+  o->info.tx_queue_len = USB_REPORT_QUEUE_LEN;
   o->info.report_desc = report_desc.buf;
   o->info.iface_num = (uint8_t)(iface_num);
   o->info.ep_in = (uint8_t)(ep_in);
@@ -147,12 +150,85 @@ STATIC mp_obj_t mod_trezorio_HID_write_blocking(mp_obj_t self, mp_obj_t msg,
 STATIC MP_DEFINE_CONST_FUN_OBJ_3(mod_trezorio_HID_write_blocking_obj,
                                  mod_trezorio_HID_write_blocking);
 
+#define CTAPHID_REPORT_SIZE 64
+#define CTAPHID_INIT_HEADER 7  // cid, cmd, bcnt
+#define CTAPHID_CONT_HEADER 5  // cid, seq
+#define CTAPHID_INIT_DATA (CTAPHID_REPORT_SIZE - CTAPHID_INIT_HEADER)
+#define CTAPHID_CONT_DATA (CTAPHID_REPORT_SIZE - CTAPHID_CONT_HEADER)
+
+/// def write_ctaphid(
+///     self, cid: int, cmd: int, data: bytes, offset: int, timeout_ms: int = 0
+/// ) -> int:
+///     """
+///     Sends the CTAPHID frame of `data` that starts at `offset`, that is
+///     the initialization frame of command `cmd` if `offset` is 0, otherwise
+///     the continuation frame with the matching sequence number. Waits for
+///     the interface up to `timeout_ms` if it is set. Returns the offset of
+///     the next frame, or `offset` if the frame was not sent.
+///     """
+STATIC mp_obj_t mod_trezorio_HID_write_ctaphid(size_t n_args,
+                                               const mp_obj_t *args) {
+  mp_obj_HID_t *o = MP_OBJ_TO_PTR(args[0]);
+  uint32_t cid = trezor_obj_get_uint(args[1]);
+  uint8_t cmd = trezor_obj_get_uint8(args[2]);
+  mp_buffer_info_t data;
+  mp_get_buffer_raise(args[3], &data, MP_BUFFER_READ);
+  size_t offset = trezor_obj_get_uint(args[4]);
+  uint32_t timeout = (n_args > 5) ? trezor_obj_get_uint(args[5]) : 0;
+  if (data.len > 0xFFFF) {
+    mp_raise_ValueError("Message too long");
+  }
+
+  uint8_t report[CTAPHID_REPORT_SIZE] = {0};
+  report[0] = cid >> 24;
+  report[1] = cid >> 16;
+  report[2] = cid >> 8;
+  report[3] = cid;
+  size_t header = 0;
+  if (offset == 0) {
+    report[4] = cmd;
+    report[5] = data.len >> 8;
+    report[6] = data.len;
+    header = CTAPHID_INIT_HEADER;
+  } else {
+    size_t cont = offset - CTAPHID_INIT_DATA;
+    if (offset < CTAPHID_INIT_DATA || offset >= data.len ||
+        cont % CTAPHID_CONT_DATA != 0 || cont / CTAPHID_CONT_DATA > 0x7F) {
+      mp_raise_ValueError("Invalid offset");
+    }
+    report[4] = cont / CTAPHID_CONT_DATA;
+    header = CTAPHID_CONT_HEADER;
+  }
+  size_t n = data.len - offset;
+  if (n > CTAPHID_REPORT_SIZE - header) {
+    n = CTAPHID_REPORT_SIZE - header;
+  }
+  memcpy(report + header, (const uint8_t *)data.buf + offset, n);
+
+  int r = 0;
+  if (timeout > 0) {
+    r = usb_hid_write_blocking(o->info.iface_num, report, sizeof(report),
+                               timeout);
+  } else {
+    r = usb_hid_write(o->info.iface_num, report, sizeof(report));
+  }
+  if (r <= 0) {
+    return mp_obj_new_int_from_uint(offset);
+  }
+  return mp_obj_new_int_from_uint(offset + n);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_trezorio_HID_write_ctaphid_obj,
+                                           5, 6,
+                                           mod_trezorio_HID_write_ctaphid);
+
 STATIC const mp_rom_map_elem_t mod_trezorio_HID_locals_dict_table[] = {
     {MP_ROM_QSTR(MP_QSTR_iface_num),
      MP_ROM_PTR(&mod_trezorio_HID_iface_num_obj)},
     {MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&mod_trezorio_HID_write_obj)},
     {MP_ROM_QSTR(MP_QSTR_write_blocking),
      MP_ROM_PTR(&mod_trezorio_HID_write_blocking_obj)},
+    {MP_ROM_QSTR(MP_QSTR_write_ctaphid),
+     MP_ROM_PTR(&mod_trezorio_HID_write_ctaphid_obj)},
 };
 STATIC MP_DEFINE_CONST_DICT(mod_trezorio_HID_locals_dict,
                             mod_trezorio_HID_locals_dict_table);
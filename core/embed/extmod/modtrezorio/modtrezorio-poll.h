@@ -26,6 +26,10 @@
 #define POLL_READ (0x0000)
 #define POLL_WRITE (0x0100)
 
+// Counters for profiling the poll loop: the number of poll calls, of loop
+// iterations woken by an interrupt, and of calls that returned an event.
+static uint32_t poll_calls, poll_wakeups, poll_events;
+
 /// package: trezorio.__init__
 
 /// def poll(ifaces: Iterable[int], list_ref: List, timeout_ms: int) -> bool:
@@ -52,7 +56,12 @@ STATIC mp_obj_t mod_trezorio_poll(mp_obj_t ifaces, mp_obj_t list_ref,
   const mp_uint_t deadline = mp_hal_ticks_ms() + timeout;
   mp_obj_iter_buf_t iterbuf;
 
+  poll_calls++;
   for (;;) {
+#ifdef TREZOR_EMULATOR
+    // snapshots are taken only here, where nothing is half done
+    snapshot_poll();
+#endif
     mp_obj_t iter = mp_getiter(ifaces, &iterbuf);
     mp_obj_t item;
     while ((item = mp_iternext(iter)) != MP_OBJ_STOP_ITERATION) {
@@ -92,6 +101,7 @@ STATIC mp_obj_t mod_trezorio_poll(mp_obj_t ifaces, mp_obj_t list_ref,
           tuple->items[2] = MP_OBJ_NEW_SMALL_INT(eyr);
           ret->items[0] = MP_OBJ_NEW_SMALL_INT(i);
           ret->items[1] = MP_OBJ_FROM_PTR(tuple);
+          poll_events++;
           return mp_const_true;
         }
       } else if (mode == POLL_READ) {
@@ -101,6 +111,7 @@ STATIC mp_obj_t mod_trezorio_poll(mp_obj_t ifaces, mp_obj_t list_ref,
           if (len > 0) {
             ret->items[0] = MP_OBJ_NEW_SMALL_INT(i);
             ret->items[1] = mp_obj_new_bytes(buf, len);
+            poll_events++;
             return mp_const_true;
           }
         } else if (sectrue == usb_webusb_can_read(iface)) {
@@ -109,6 +120,7 @@ STATIC mp_obj_t mod_trezorio_poll(mp_obj_t ifaces, mp_obj_t list_ref,
           if (len > 0) {
             ret->items[0] = MP_OBJ_NEW_SMALL_INT(i);
             ret->items[1] = mp_obj_new_bytes(buf, len);
+            poll_events++;
             return mp_const_true;
           }
         }
@@ -116,22 +128,61 @@ STATIC mp_obj_t mod_trezorio_poll(mp_obj_t ifaces, mp_obj_t list_ref,
         if (sectrue == usb_hid_can_write(iface)) {
           ret->items[0] = MP_OBJ_NEW_SMALL_INT(i);
           ret->items[1] = mp_const_none;
+          poll_events++;
           return mp_const_true;
         } else if (sectrue == usb_webusb_can_write(iface)) {
           ret->items[0] = MP_OBJ_NEW_SMALL_INT(i);
           ret->items[1] = mp_const_none;
+          poll_events++;
           return mp_const_true;
         }
       }
     }
 
-    if (mp_hal_ticks_ms() >= deadline) {
+    const mp_uint_t now = mp_hal_ticks_ms();
+    if (now >= deadline) {
       break;
+    }
+#ifdef TREZOR_EMULATOR
+    // A headless emulator jumps over short waits such as animation frames
+    // and loop.sleep, but longer ones (waiting for the host, idle timers)
+    // still take real time.
+    if (emulator_headless() && deadline - now <= EMULATOR_SKIP_WAIT_MS) {
+      emulator_clock_advance(deadline - now);
+      continue;
+    }
+    // Instead of sleeping a fixed tick, block on the UDP sockets so that a
+    // report from the host is picked up as soon as it arrives.
+    if (emulator_headless()) {
+      usb_emulated_wait(deadline - now);
     } else {
-      MICROPY_EVENT_POLL_HOOK
+      usb_emulated_wait(MIN(deadline - now, EMULATOR_USB_WAIT_MS));
     }
+#else
+    // Nothing is ready, so sleep until the next interrupt. On hardware the
+    // hook is WFI and the core wakes on USB, touch (EXTI) or SysTick, all
+    // of which can change the outcome of the next iteration.
+    MICROPY_EVENT_POLL_HOOK
+#endif
+    poll_wakeups++;
   }
 
   return mp_const_false;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_3(mod_trezorio_poll_obj, mod_trezorio_poll);
+
+/// def poll_stats() -> Tuple[int, int, int]:
+///     """
+///     Returns the number of `poll` calls, of wakeups while waiting and of
+///     calls that returned an event, counted since boot.
+///     """
+STATIC mp_obj_t mod_trezorio_poll_stats(void) {
+  mp_obj_t tuple[3] = {
+      mp_obj_new_int_from_uint(poll_calls),
+      mp_obj_new_int_from_uint(poll_wakeups),
+      mp_obj_new_int_from_uint(poll_events),
+  };
+  return mp_obj_new_tuple(3, tuple);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(mod_trezorio_poll_stats_obj,
+                                 mod_trezorio_poll_stats);
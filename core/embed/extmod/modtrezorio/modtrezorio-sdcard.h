@@ -103,6 +103,8 @@ STATIC mp_obj_t mod_trezorio_sdcard_write(mp_obj_t block_num, mp_obj_t buf) {
   uint32_t block = trezor_obj_get_uint(block_num);
   mp_buffer_info_t bufinfo;
   mp_get_buffer_raise(buf, &bufinfo, MP_BUFFER_READ);
+  // raw writes bypass the filesystem sector cache
+  _fatfs_cache_invalidate();
   if (sectrue != sdcard_write_blocks(bufinfo.buf, block,
                                      bufinfo.len / SDCARD_BLOCK_SIZE)) {
     mp_raise_OSError(MP_EIO);
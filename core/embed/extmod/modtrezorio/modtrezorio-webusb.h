@@ -81,7 +81,10 @@ STATIC mp_obj_t mod_trezorio_WebUSB_make_new(const mp_obj_type_t *type,
   mp_obj_WebUSB_t *o = m_new_obj(mp_obj_WebUSB_t);
   o->base.type = type;
 
-  o->info.rx_buffer = m_new(uint8_t, max_packet_len);
+  o->info.rx_buffer = m_new(uint8_t, USB_REPORT_QUEUE_LEN * max_packet_len);
+  o->info.tx_buffer = m_new(uint8_t, USB_REPORT_QUEUE_LEN * max_packet_len);
+  o->info.rx_queue_len = USB_REPORT_QUEUE_LEN;
+  o->info.tx_queue_len = USB_REPORT_QUEUE_LEN;
   o->info.iface_num = (uint8_t)(iface_num);
   o->info.ep_in = (uint8_t)(ep_in);
   o->info.ep_out = (uint8_t)(ep_out);
@@ -30,11 +30,19 @@
 #include "touch.h"
 #include "usb.h"
 
+#ifdef TREZOR_EMULATOR
+#include "common.h"
+#include "snapshot.h"
+#endif
+
 #define CHECK_PARAM_RANGE(value, minimum, maximum)  \
   if (value < minimum || value > maximum) {         \
     mp_raise_ValueError(#value " is out of range"); \
   }
 
+// Number of reports queued in each direction of HID and WebUSB interfaces
+#define USB_REPORT_QUEUE_LEN 4
+
 // clang-format off
 #include "modtrezorio-fatfs.h"
 #include "modtrezorio-flash.h"
@@ -76,6 +84,7 @@ STATIC const mp_rom_map_elem_t mp_module_trezorio_globals_table[] = {
     {MP_ROM_QSTR(MP_QSTR_WebUSB), MP_ROM_PTR(&mod_trezorio_WebUSB_type)},
 
     {MP_ROM_QSTR(MP_QSTR_poll), MP_ROM_PTR(&mod_trezorio_poll_obj)},
+    {MP_ROM_QSTR(MP_QSTR_poll_stats), MP_ROM_PTR(&mod_trezorio_poll_stats_obj)},
     {MP_ROM_QSTR(MP_QSTR_POLL_READ), MP_ROM_INT(POLL_READ)},
     {MP_ROM_QSTR(MP_QSTR_POLL_WRITE), MP_ROM_INT(POLL_WRITE)},
 
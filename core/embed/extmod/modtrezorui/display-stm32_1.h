@@ -101,6 +101,10 @@ static void display_set_orientation(int degrees) { display_refresh(); }
 
 static void display_set_backlight(int val) {}
 
+static inline uint32_t display_fade_ticks(void) { return HAL_GetTick(); }
+
+static void display_fade_timer(bool enable) {}
+
 SPI_HandleTypeDef spi_handle;
 
 static inline void spi_send(const uint8_t *data, int len) {
@@ -224,6 +228,12 @@ void display_refresh(void) {
                                OLED_SETHIGHCOLUMN | 0x00,
                                OLED_SETSTARTLINE | 0x00};
 
+  // the panel keeps its contents, skip the transfer if nothing was drawn
+  if (DISPLAY_DIRTY_COUNT == 0) {
+    return;
+  }
+  DISPLAY_DIRTY_COUNT = 0;
+
   HAL_GPIO_WritePin(OLED_CS_PORT, OLED_CS_PIN, GPIO_PIN_RESET);  // SPI select
   spi_send(s, 3);
   HAL_GPIO_WritePin(OLED_CS_PORT, OLED_CS_PIN, GPIO_PIN_SET);  // SPI deselect
@@ -243,4 +253,10 @@ void display_refresh(void) {
 
 const char *display_save(const char *prefix) { return NULL; }
 
+void display_save_frame(void) {}
+
+void display_save_kept(const char *prefix) {}
+
+void display_save_hash(uint8_t hash[32]) { memset(hash, 0, 32); }
+
 void display_clear_save(void) {}
@@ -19,11 +19,13 @@
 
 #include STM32_HAL_H
 
+#include "irq.h"
+#include "supervise.h"
+
 // FSMC/FMC Bank 1 - NOR/PSRAM 1
 #define DISPLAY_MEMORY_BASE 0x60000000
 #define DISPLAY_MEMORY_PIN 16
 
-#define CMD(X) (*((__IO uint8_t *)((uint32_t)(DISPLAY_MEMORY_BASE))) = (X))
 #define ADDR                                           \
   (*((__IO uint8_t *)((uint32_t)(DISPLAY_MEMORY_BASE | \
                                  (1 << DISPLAY_MEMORY_PIN)))))
@@ -32,6 +34,73 @@
   DATA((X) >> 8);    \
   DATA((X)&0xFF)
 
+#ifdef TREZOR_DISPLAY_DMA
+
+#include "dma.h"
+
+// Pixels are pushed by a memory-to-memory DMA stream writing halfwords to the
+// data address. The 8-bit FMC bank splits each halfword into two byte writes,
+// lower address first, so a buffer of big-endian pixels goes out in the same
+// order as PIXELDATA() sends them.
+#define DISPLAY_PUSH_DMA
+#define DISPLAY_DMA_CONFIG \
+  (DMA_MEMORY_TO_MEMORY | DMA_PDATAALIGN_HALFWORD | DMA_MDATAALIGN_HALFWORD)
+#define DISPLAY_DMA_MAX_LEN 0xFFFF
+
+// The source of solid fills, stored big-endian.
+static uint16_t display_dma_color;
+
+static inline void display_dma_wait(void) { dma_nohal_wait(&dma_DISPLAY); }
+
+static void display_dma_start(const void *src, uint32_t src_inc,
+                              uint32_t len) {
+  display_dma_wait();
+  dma_nohal_init(&dma_DISPLAY, DISPLAY_DMA_CONFIG | src_inc);
+  dma_nohal_start(&dma_DISPLAY, (uint32_t)src, (uint32_t)&ADDR, len);
+}
+
+// Pushes len pixels of color c. Returns while the last transfer is running.
+static void display_fill(uint16_t c, uint32_t len) {
+  display_dma_wait();
+  display_dma_color = (c >> 8) | (c << 8);
+  while (len > 0) {
+    uint32_t n = MIN(len, DISPLAY_DMA_MAX_LEN);
+    display_dma_start(&display_dma_color, DMA_PINC_DISABLE, n);
+    len -= n;
+  }
+}
+
+// Pushes len big-endian pixels from the halfword aligned buf. Returns while
+// the transfer is running, the buffer must not change until the next push.
+static void display_pixels(const uint8_t *buf, uint32_t len) {
+  display_dma_start(buf, DMA_PINC_ENABLE, len);
+}
+
+// Commands wait for the pixels still being pushed.
+#define CMD(X)         \
+  (display_dma_wait(), \
+   *((__IO uint8_t *)((uint32_t)(DISPLAY_MEMORY_BASE))) = (X))
+
+#else
+
+#define CMD(X) (*((__IO uint8_t *)((uint32_t)(DISPLAY_MEMORY_BASE))) = (X))
+
+#endif
+
+#ifdef TREZOR_DISPLAY_IMAGE_CACHE
+
+// Decompressed images are kept in the otherwise unused CCMRAM. The CPU copies
+// each row to a line buffer, as the DMA controllers cannot read CCMRAM. Only
+// images stored in flash are cached, buffers in RAM can be reused for other
+// data at the same address. A preloaded avatar, such as the homescreen, takes
+// 41 KiB at the end of the arena.
+#define DISPLAY_IMAGE_CACHE_SIZE (48 * 1024)
+#define DISPLAY_IMAGE_CACHE_SECTION __attribute__((section(".ccmram")))
+#define DISPLAY_IMAGE_CACHEABLE(data) \
+  ((uint32_t)(data) >= FLASH_BASE && (uint32_t)(data) <= FLASH_END)
+
+#endif
+
 #define LED_PWM_TIM_PERIOD (10000)
 
 #define DISPLAY_ID_ST7789V \
@@ -173,6 +242,29 @@ static void display_set_backlight(int val) {
   TIM1->CCR1 = LED_PWM_TIM_PERIOD * val / 255;
 }
 
+// A background fade is stepped on every period of the backlight PWM timer.
+#define DISPLAY_FADE_TIMER
+
+static inline uint32_t display_fade_ticks(void) { return HAL_GetTick(); }
+
+static void display_fade_timer(bool enable) {
+  if (enable) {
+    TIM1->SR = ~TIM_SR_UIF;
+    svc_setpriority(TIM1_UP_TIM10_IRQn, IRQ_PRI_TIMX);
+    svc_enableIRQ(TIM1_UP_TIM10_IRQn);
+    TIM1->DIER |= TIM_DIER_UIE;
+  } else {
+    TIM1->DIER &= ~TIM_DIER_UIE;
+  }
+}
+
+void TIM1_UP_TIM10_IRQHandler(void) {
+  IRQ_ENTER(TIM1_UP_TIM10_IRQn);
+  TIM1->SR = ~TIM_SR_UIF;
+  display_fade_update();
+  IRQ_EXIT(TIM1_UP_TIM10_IRQn);
+}
+
 static void display_hardware_reset(void) {
   HAL_GPIO_WritePin(GPIOC, GPIO_PIN_14, GPIO_PIN_RESET);  // LCD_RST/PC14
   // wait 10 milliseconds. only needs to be low for 10 microseconds.
@@ -487,6 +579,15 @@ void display_init(void) {
 }
 
 void display_refresh(void) {
+  // pixels go straight to the frame memory of the controller, there is no
+  // need to wait for the panel if nothing was drawn since the last refresh
+  if (DISPLAY_DIRTY_COUNT == 0) {
+    return;
+  }
+  DISPLAY_DIRTY_COUNT = 0;
+#ifdef DISPLAY_PUSH_DMA
+  display_dma_wait();
+#endif
   uint32_t id = display_identify();
   if (id && (id != DISPLAY_ID_GC9307)) {
     // synchronize with the panel synchronization signal in order to avoid
@@ -500,4 +601,10 @@ void display_refresh(void) {
 
 const char *display_save(const char *prefix) { return NULL; }
 
+void display_save_frame(void) {}
+
+void display_save_kept(const char *prefix) {}
+
+void display_save_hash(uint8_t hash[32]) { memset(hash, 0, 32); }
+
 void display_clear_save(void) {}
@@ -22,6 +22,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "profile.h"
+#include "sha2.h"
 
 #define EMULATOR_BORDER 16
 
@@ -55,6 +56,12 @@ static SDL_Surface *BUFFER;
 static SDL_Texture *TEXTURE, *BACKGROUND;
 
 static SDL_Surface *PREV_SAVED;
+// hash of the frames saved since display_clear_save
+static SHA256_CTX SAVED_HASH;
+static int SAVED_COUNT;
+// frames only hashed by display_save_frame, written out by display_save_kept
+static uint8_t **KEPT_FRAMES;
+static int KEPT_COUNT, KEPT_PITCH;
 
 int sdl_display_res_x = DISPLAY_RESX, sdl_display_res_y = DISPLAY_RESY;
 int sdl_touch_offset_x, sdl_touch_offset_y;
@@ -78,7 +85,7 @@ void PIXELDATA(uint16_t c) {
   // otherwise set to black
   c = (c & 0x8410) ? 0xFFFF : 0x0000;
 #endif
-  if (!RENDERER) {
+  if (!BUFFER) {
     display_init();
   }
   if (PIXELWINDOW.pos.x <= PIXELWINDOW.end.x &&
@@ -95,6 +102,13 @@ void PIXELDATA(uint16_t c) {
 }
 
 void display_init(void) {
+  BUFFER = SDL_CreateRGBSurface(0, MAX_DISPLAY_RESX, MAX_DISPLAY_RESY, 16,
+                                0xF800, 0x07E0, 0x001F, 0x0000);
+  if (emulator_headless()) {
+    // no window, the framebuffer is kept for display_save
+    DISPLAY_BACKLIGHT = 0;
+    return;
+  }
   if (SDL_Init(SDL_INIT_VIDEO) != 0) {
     printf("%s\n", SDL_GetError());
     ensure(secfalse, "SDL_Init error");
@@ -127,8 +141,6 @@ void display_init(void) {
   }
   SDL_SetRenderDrawColor(RENDERER, 0, 0, 0, 255);
   SDL_RenderClear(RENDERER);
-  BUFFER = SDL_CreateRGBSurface(0, MAX_DISPLAY_RESX, MAX_DISPLAY_RESY, 16,
-                                0xF800, 0x07E0, 0x001F, 0x0000);
   TEXTURE = SDL_CreateTexture(RENDERER, SDL_PIXELFORMAT_RGB565,
                               SDL_TEXTUREACCESS_STREAMING, DISPLAY_RESX,
                               DISPLAY_RESY);
@@ -175,7 +187,7 @@ void display_init(void) {
 
 static void display_set_window(uint16_t x0, uint16_t y0, uint16_t x1,
                                uint16_t y1) {
-  if (!RENDERER) {
+  if (!BUFFER) {
     display_init();
   }
   PIXELWINDOW.start.x = x0;
@@ -186,16 +198,34 @@ static void display_set_window(uint16_t x0, uint16_t y0, uint16_t x1,
   PIXELWINDOW.pos.y = y0;
 }
 
-void display_refresh(void) {
-  if (!RENDERER) {
+static void display_present(void) {
+  if (!BUFFER) {
     display_init();
   }
+  if (!RENDERER) {
+    DISPLAY_DIRTY_COUNT = 0;
+    return;
+  }
   if (BACKGROUND) {
     SDL_RenderCopy(RENDERER, BACKGROUND, NULL, NULL);
   } else {
     SDL_RenderClear(RENDERER);
   }
-  SDL_UpdateTexture(TEXTURE, NULL, BUFFER->pixels, BUFFER->pitch);
+  // upload only the regions drawn since the last refresh
+  for (int i = 0; i < DISPLAY_DIRTY_COUNT; i++) {
+    const int x0 = DISPLAY_DIRTY[i].x0, y0 = DISPLAY_DIRTY[i].y0;
+    const int x1 = MIN(DISPLAY_DIRTY[i].x1, DISPLAY_RESX - 1);
+    const int y1 = MIN(DISPLAY_DIRTY[i].y1, DISPLAY_RESY - 1);
+    if (x0 > x1 || y0 > y1) {
+      continue;
+    }
+    const SDL_Rect r = {x0, y0, x1 - x0 + 1, y1 - y0 + 1};
+    SDL_UpdateTexture(TEXTURE, &r,
+                      (uint8_t *)BUFFER->pixels + y0 * BUFFER->pitch +
+                          x0 * sizeof(uint16_t),
+                      BUFFER->pitch);
+  }
+  DISPLAY_DIRTY_COUNT = 0;
 #define BACKLIGHT_NORMAL 150
   SDL_SetTextureAlphaMod(TEXTURE,
                          MIN(255, 255 * DISPLAY_BACKLIGHT / BACKLIGHT_NORMAL));
@@ -211,17 +241,31 @@ void display_refresh(void) {
   SDL_RenderPresent(RENDERER);
 }
 
-static void display_set_orientation(int degrees) { display_refresh(); }
+void display_refresh(void) {
+  // skip the frame if nothing was drawn since the last one
+  if (BUFFER && DISPLAY_DIRTY_COUNT == 0) {
+    return;
+  }
+  display_present();
+}
 
-static void display_set_backlight(int val) { display_refresh(); }
+static void display_set_orientation(int degrees) { display_present(); }
 
-const char *display_save(const char *prefix) {
-  if (!RENDERER) {
+static void display_set_backlight(int val) { display_present(); }
+
+// SDL cannot be used from a signal handler, the fade is stepped by polling.
+static inline uint32_t display_fade_ticks(void) {
+  return SDL_GetTicks() + emulator_clock_offset();
+}
+
+static void display_fade_timer(bool enable) {}
+
+// returns a cropped view of the screen contents, or NULL if it is the same
+// as the previously saved one
+static SDL_Surface *display_save_crop(void) {
+  if (!BUFFER) {
     display_init();
   }
-  static int count;
-  static char filename[256];
-  // take a cropped view of the screen contents
   const SDL_Rect rect = {0, 0, DISPLAY_RESX, DISPLAY_RESY};
   SDL_Surface *crop = SDL_CreateRGBSurface(
       BUFFER->flags, rect.w, rect.h, BUFFER->format->BitsPerPixel,
@@ -232,18 +276,90 @@ const char *display_save(const char *prefix) {
   if (PREV_SAVED != NULL) {
     if (memcmp(PREV_SAVED->pixels, crop->pixels, crop->pitch * crop->h) == 0) {
       SDL_FreeSurface(crop);
-      return filename;
+      return NULL;
     }
     SDL_FreeSurface(PREV_SAVED);
   }
-  // save to png
-  snprintf(filename, sizeof(filename), "%s%08d.png", prefix, count++);
-  IMG_SavePNG(crop, filename);
+  if (SAVED_COUNT == 0) {
+    sha256_Init(&SAVED_HASH);
+  }
+  sha256_Update(&SAVED_HASH, crop->pixels, crop->pitch * crop->h);
+  SAVED_COUNT++;
   PREV_SAVED = crop;
+  return crop;
+}
+
+static const char *display_save_png(SDL_Surface *surface, const char *prefix) {
+  static int count;
+  static char filename[256];
+  snprintf(filename, sizeof(filename), "%s%08d.png", prefix, count++);
+  IMG_SavePNG(surface, filename);
   return filename;
 }
 
+static void display_free_kept(void) {
+  for (int i = 0; i < KEPT_COUNT; i++) {
+    free(KEPT_FRAMES[i]);
+  }
+  free(KEPT_FRAMES);
+  KEPT_FRAMES = NULL;
+  KEPT_COUNT = 0;
+}
+
+const char *display_save(const char *prefix) {
+  static const char *filename = "";
+  SDL_Surface *crop = display_save_crop();
+  if (crop != NULL) {
+    filename = display_save_png(crop, prefix);
+  }
+  return filename;
+}
+
+void display_save_frame(void) {
+  SDL_Surface *crop = display_save_crop();
+  if (crop == NULL) {
+    return;
+  }
+  // the frame stays hashed even if there is no memory to keep it
+  uint8_t **frames =
+      realloc(KEPT_FRAMES, (KEPT_COUNT + 1) * sizeof(KEPT_FRAMES[0]));
+  if (frames == NULL) {
+    return;
+  }
+  KEPT_FRAMES = frames;
+  size_t len = crop->pitch * crop->h;
+  uint8_t *frame = malloc(len);
+  if (frame == NULL) {
+    return;
+  }
+  memcpy(frame, crop->pixels, len);
+  KEPT_FRAMES[KEPT_COUNT++] = frame;
+  KEPT_PITCH = crop->pitch;
+}
+
+void display_save_kept(const char *prefix) {
+  for (int i = 0; i < KEPT_COUNT; i++) {
+    SDL_Surface *frame = SDL_CreateRGBSurfaceFrom(
+        KEPT_FRAMES[i], DISPLAY_RESX, DISPLAY_RESY,
+        BUFFER->format->BitsPerPixel, KEPT_PITCH, BUFFER->format->Rmask,
+        BUFFER->format->Gmask, BUFFER->format->Bmask, BUFFER->format->Amask);
+    display_save_png(frame, prefix);
+    SDL_FreeSurface(frame);
+  }
+  display_free_kept();
+}
+
+void display_save_hash(uint8_t hash[32]) {
+  SHA256_CTX ctx = SAVED_HASH;
+  if (SAVED_COUNT == 0) {
+    sha256_Init(&ctx);
+  }
+  sha256_Final(&ctx, hash);
+}
+
 void display_clear_save(void) {
   SDL_FreeSurface(PREV_SAVED);
   PREV_SAVED = NULL;
+  SAVED_COUNT = 0;
+  display_free_kept();
 }
@@ -50,6 +50,92 @@ static int DISPLAY_ORIENTATION = -1;
 
 static struct { int x, y; } DISPLAY_OFFSET;
 
+// Regions drawn since the last display_refresh, used by the ports which have
+// to copy a frame buffer to the screen. Rectangles may overlap, the whole
+// frame memory starts dirty.
+#define DISPLAY_DIRTY_RECTS 4
+static struct {
+  int x0, y0, x1, y1;
+} DISPLAY_DIRTY[DISPLAY_DIRTY_RECTS] = {
+    {0, 0, MAX_DISPLAY_RESX - 1, MAX_DISPLAY_RESY - 1}};
+static int DISPLAY_DIRTY_COUNT = 1;
+
+// Backlight fade running in the background, stepped by display_fade_update
+// from a timer interrupt (ports defining DISPLAY_FADE_TIMER) or from polling
+// display_fade_running.
+static struct {
+  int start, end;
+  uint32_t begin, duration;
+  volatile bool running;
+} DISPLAY_FADE;
+
+static void display_fade_update(void);
+
+// Area and parameters of the last loader drawn, so that a progress update can
+// redraw only the pixels which change. Any other drawing over the area
+// invalidates it, see display_dirty.
+static struct {
+  bool valid;
+  int x0, y0, x1, y1;
+  uint16_t progress, fgcolor, bgcolor, iconfgcolor;
+  const uint8_t *icon;
+  uint32_t iconlen;
+} LOADER_LAST;
+
+static int dirty_area(int x0, int y0, int x1, int y1) {
+  return (x1 - x0 + 1) * (y1 - y0 + 1);
+}
+
+// Adds a region to the dirty rectangles. It grows the rectangle which needs
+// the smallest extra area, unless that would cover more than a new rectangle
+// and one is still free.
+static void display_dirty(int x0, int y0, int x1, int y1) {
+  if (x0 > x1 || y0 > y1) {
+    return;
+  }
+  if (x0 <= LOADER_LAST.x1 && x1 >= LOADER_LAST.x0 && y0 <= LOADER_LAST.y1 &&
+      y1 >= LOADER_LAST.y0) {
+    LOADER_LAST.valid = false;
+  }
+  int best = -1, best_cost = 0;
+  for (int i = 0; i < DISPLAY_DIRTY_COUNT; i++) {
+    const int cost =
+        dirty_area(MIN(x0, DISPLAY_DIRTY[i].x0), MIN(y0, DISPLAY_DIRTY[i].y0),
+                   MAX(x1, DISPLAY_DIRTY[i].x1), MAX(y1, DISPLAY_DIRTY[i].y1)) -
+        dirty_area(DISPLAY_DIRTY[i].x0, DISPLAY_DIRTY[i].y0,
+                   DISPLAY_DIRTY[i].x1, DISPLAY_DIRTY[i].y1);
+    if (best < 0 || cost < best_cost) {
+      best = i;
+      best_cost = cost;
+    }
+  }
+  if (best < 0 || (best_cost > dirty_area(x0, y0, x1, y1) &&
+                   DISPLAY_DIRTY_COUNT < DISPLAY_DIRTY_RECTS)) {
+    best = DISPLAY_DIRTY_COUNT++;
+    DISPLAY_DIRTY[best].x0 = x0;
+    DISPLAY_DIRTY[best].y0 = y0;
+    DISPLAY_DIRTY[best].x1 = x1;
+    DISPLAY_DIRTY[best].y1 = y1;
+    return;
+  }
+  DISPLAY_DIRTY[best].x0 = MIN(x0, DISPLAY_DIRTY[best].x0);
+  DISPLAY_DIRTY[best].y0 = MIN(y0, DISPLAY_DIRTY[best].y0);
+  DISPLAY_DIRTY[best].x1 = MAX(x1, DISPLAY_DIRTY[best].x1);
+  DISPLAY_DIRTY[best].y1 = MAX(y1, DISPLAY_DIRTY[best].y1);
+  // drop the rectangles covered by the grown one
+  for (int i = DISPLAY_DIRTY_COUNT - 1; i >= 0; i--) {
+    if (i != best && DISPLAY_DIRTY[i].x0 >= DISPLAY_DIRTY[best].x0 &&
+        DISPLAY_DIRTY[i].y0 >= DISPLAY_DIRTY[best].y0 &&
+        DISPLAY_DIRTY[i].x1 <= DISPLAY_DIRTY[best].x1 &&
+        DISPLAY_DIRTY[i].y1 <= DISPLAY_DIRTY[best].y1) {
+      DISPLAY_DIRTY[i] = DISPLAY_DIRTY[--DISPLAY_DIRTY_COUNT];
+      if (best == DISPLAY_DIRTY_COUNT) {
+        best = i;
+      }
+    }
+  }
+}
+
 #ifdef TREZOR_EMULATOR
 #include "display-unix.h"
 #else
@@ -64,6 +150,49 @@ static struct { int x, y; } DISPLAY_OFFSET;
 
 // common display functions
 
+// Addresses the window for the following pixels and marks it dirty.
+static void display_draw_window(int x0, int y0, int x1, int y1) {
+  display_dirty(x0, y0, x1, y1);
+  display_set_window(x0, y0, x1, y1);
+}
+
+#ifndef DISPLAY_PUSH_DMA
+
+static void display_fill(uint16_t c, uint32_t len) {
+  for (uint32_t i = 0; i < len; i++) {
+    PIXELDATA(c);
+  }
+}
+
+static void display_pixels(const uint8_t *buf, uint32_t len) {
+  for (uint32_t i = 0; i < len; i++) {
+    PIXELDATA((buf[2 * i] << 8) | buf[2 * i + 1]);
+  }
+}
+
+#endif
+
+// Two buffers of big-endian pixels, so that one line can be prepared while the
+// other one is still being pushed to the display.
+static uint16_t display_line_buffers[2][MAX_DISPLAY_RESX];
+static int display_line_index = 0;
+
+static inline uint8_t *display_line(void) {
+  return (uint8_t *)display_line_buffers[display_line_index];
+}
+
+static inline void display_line_set(int i, uint16_t c) {
+  display_line()[2 * i] = c >> 8;
+  display_line()[2 * i + 1] = c & 0xFF;
+}
+
+static void display_line_push(int len) {
+  if (len > 0) {
+    display_pixels(display_line(), len);
+    display_line_index ^= 1;
+  }
+}
+
 static inline uint16_t interpolate_color(uint16_t color0, uint16_t color1,
                                          uint8_t step) {
   uint8_t cr, cg, cb;
@@ -97,11 +226,8 @@ void display_clear(void) {
   // set MADCTL first so that we can set the window correctly next
   display_orientation(0);
   // address the complete frame memory
-  display_set_window(0, 0, MAX_DISPLAY_RESX - 1, MAX_DISPLAY_RESY - 1);
-  for (uint32_t i = 0; i < MAX_DISPLAY_RESX * MAX_DISPLAY_RESY; i++) {
-    // 2 bytes per pixel because we're using RGB 5-6-5 format
-    PIXELDATA(0x0000);
-  }
+  display_draw_window(0, 0, MAX_DISPLAY_RESX - 1, MAX_DISPLAY_RESY - 1);
+  display_fill(0x0000, MAX_DISPLAY_RESX * MAX_DISPLAY_RESY);
   // go back to restricted window
   display_set_window(0, 0, DISPLAY_RESX - 1, DISPLAY_RESY - 1);
   // if valid, go back to the saved orientation
@@ -113,9 +239,9 @@ void display_bar(int x, int y, int w, int h, uint16_t c) {
   y += DISPLAY_OFFSET.y;
   int x0, y0, x1, y1;
   clamp_coords(x, y, w, h, &x0, &y0, &x1, &y1);
-  display_set_window(x0, y0, x1, y1);
-  for (int i = 0; i < (x1 - x0 + 1) * (y1 - y0 + 1); i++) {
-    PIXELDATA(c);
+  display_draw_window(x0, y0, x1, y1);
+  if (x0 <= x1 && y0 <= y1) {
+    display_fill(c, (x1 - x0 + 1) * (y1 - y0 + 1));
   }
 }
 
@@ -151,7 +277,7 @@ void display_bar_radius(int x, int y, int w, int h, uint16_t c, uint16_t b,
   y += DISPLAY_OFFSET.y;
   int x0, y0, x1, y1;
   clamp_coords(x, y, w, h, &x0, &y0, &x1, &y1);
-  display_set_window(x0, y0, x1, y1);
+  display_draw_window(x0, y0, x1, y1);
   for (int j = y0; j <= y1; j++) {
     for (int i = x0; i <= x1; i++) {
       int rx = i - x;
@@ -193,6 +319,117 @@ static void uzlib_prepare(struct uzlib_uncomp *decomp, uint8_t *window,
   uzlib_uncompress_init(decomp, window, window ? UZLIB_WINDOW_SIZE : 0);
 }
 
+#ifndef DISPLAY_IMAGE_CACHE_SIZE
+#define DISPLAY_IMAGE_CACHE_SIZE 0
+#endif
+
+static uint32_t image_cache_hits = 0, image_cache_misses = 0;
+
+void display_image_cache_stats(uint32_t *hits, uint32_t *misses) {
+  *hits = image_cache_hits;
+  *misses = image_cache_misses;
+}
+
+#if DISPLAY_IMAGE_CACHE_SIZE > 0
+
+#ifndef DISPLAY_IMAGE_CACHE_ENTRIES
+#define DISPLAY_IMAGE_CACHE_ENTRIES 16
+#endif
+#ifndef DISPLAY_IMAGE_CACHE_SECTION
+#define DISPLAY_IMAGE_CACHE_SECTION
+#endif
+// The cache is keyed by the address of the compressed data, so the port has
+// to exclude data which can be freed and replaced, such as heap buffers.
+#ifndef DISPLAY_IMAGE_CACHEABLE
+#define DISPLAY_IMAGE_CACHEABLE(data) 1
+#endif
+
+// Decompressed images keyed by their compressed data. The images are packed
+// at the start of image_cache_data, the least recently used one is evicted
+// when a new one does not fit.
+static struct {
+  const void *src;
+  uint32_t srclen;
+  uint32_t offset;
+  uint32_t len;
+  uint32_t used;
+} image_cache[DISPLAY_IMAGE_CACHE_ENTRIES];
+static uint32_t image_cache_count = 0, image_cache_end = 0,
+                image_cache_clock = 0;
+// The arena above image_cache_limit holds the preloaded avatar.
+static uint32_t image_cache_limit = DISPLAY_IMAGE_CACHE_SIZE;
+static uint8_t image_cache_data[DISPLAY_IMAGE_CACHE_SIZE]
+    DISPLAY_IMAGE_CACHE_SECTION;
+
+static void image_cache_evict(void) {
+  uint32_t lru = 0;
+  for (uint32_t i = 1; i < image_cache_count; i++) {
+    if (image_cache[i].used < image_cache[lru].used) {
+      lru = i;
+    }
+  }
+  const uint32_t offset = image_cache[lru].offset, len = image_cache[lru].len;
+  memmove(image_cache_data + offset, image_cache_data + offset + len,
+          image_cache_end - offset - len);
+  image_cache_end -= len;
+  for (uint32_t i = 0; i < image_cache_count; i++) {
+    if (image_cache[i].offset > offset) {
+      image_cache[i].offset -= len;
+    }
+  }
+  image_cache[lru] = image_cache[--image_cache_count];
+}
+
+// Returns the len bytes decompressed from src, or NULL if the image cannot be
+// cached and has to be streamed instead. Only data which never changes (such
+// as resources in flash) is cached, because the address is the key.
+static const uint8_t *image_cache_get(const void *src, uint32_t srclen,
+                                      uint32_t len) {
+  if (!DISPLAY_IMAGE_CACHEABLE(src) || len > image_cache_limit) {
+    return NULL;
+  }
+  for (uint32_t i = 0; i < image_cache_count; i++) {
+    if (image_cache[i].src == src && image_cache[i].srclen == srclen &&
+        image_cache[i].len == len) {
+      image_cache[i].used = ++image_cache_clock;
+      image_cache_hits++;
+      return image_cache_data + image_cache[i].offset;
+    }
+  }
+  image_cache_misses++;
+  while (image_cache_count == DISPLAY_IMAGE_CACHE_ENTRIES ||
+         image_cache_end + len > image_cache_limit) {
+    image_cache_evict();
+  }
+  uint8_t *dest = image_cache_data + image_cache_end;
+  struct uzlib_uncomp decomp;
+  uzlib_prepare(&decomp, NULL, src, srclen, dest, len);
+  int st = uzlib_uncompress(&decomp);
+  if (st < 0 || decomp.dest != dest + len) {
+    return NULL;
+  }
+  image_cache[image_cache_count].src = src;
+  image_cache[image_cache_count].srclen = srclen;
+  image_cache[image_cache_count].offset = image_cache_end;
+  image_cache[image_cache_count].len = len;
+  image_cache[image_cache_count].used = ++image_cache_clock;
+  image_cache_count++;
+  image_cache_end += len;
+  return dest;
+}
+
+#else
+
+static inline const uint8_t *image_cache_get(const void *src, uint32_t srclen,
+                                             uint32_t len) {
+  (void)src;
+  (void)srclen;
+  (void)len;
+  return NULL;
+}
+
+#endif
+
 void display_image(int x, int y, int w, int h, const void *data,
                    uint32_t datalen) {
 #if TREZOR_MODEL == T
@@ -200,12 +437,21 @@ void display_image(int x, int y, int w, int h, const void *data,
   y += DISPLAY_OFFSET.y;
   int x0, y0, x1, y1;
   clamp_coords(x, y, w, h, &x0, &y0, &x1, &y1);
-  display_set_window(x0, y0, x1, y1);
+  display_draw_window(x0, y0, x1, y1);
   x0 -= x;
   x1 -= x;
   y0 -= y;
   y1 -= y;
 
+  const uint8_t *pixels = image_cache_get(data, datalen, w * h * 2);
+  if (pixels != NULL) {
+    for (int py = y0; py <= y1 && x0 <= x1; py++) {
+      memcpy(display_line(), pixels + (py * w + x0) * 2, (x1 - x0 + 1) * 2);
+      display_line_push(x1 - x0 + 1);
+    }
+    return;
+  }
+
   struct uzlib_uncomp decomp;
   uint8_t decomp_window[UZLIB_WINDOW_SIZE];
   uint8_t decomp_out[2];
@@ -219,7 +465,10 @@ void display_image(int x, int y, int w, int h, const void *data,
     const int px = pos % w;
     const int py = pos / w;
     if (px >= x0 && px <= x1 && py >= y0 && py <= y1) {
-      PIXELDATA((decomp_out[0] << 8) | decomp_out[1]);
+      display_line_set(px - x0, (decomp_out[0] << 8) | decomp_out[1]);
+      if (px == x1) {
+        display_line_push(x1 - x0 + 1);
+      }
     }
     decomp.dest = (uint8_t *)&decomp_out;
   }
@@ -233,6 +482,34 @@ void display_image(int x, int y, int w, int h, const void *data,
 #define AVATAR_BORDER_HIGH (AVATAR_IMAGE_SIZE / 2) * (AVATAR_IMAGE_SIZE / 2)
 #define AVATAR_ANTIALIAS 1
 
+#define AVATAR_PIXELS_LEN (AVATAR_IMAGE_SIZE * AVATAR_IMAGE_SIZE * 2)
+
+// Returns the color of the avatar pixel (px,py) of color c, cropped to a
+// circle with a border of fgcolor.
+static inline uint16_t avatar_pixel(int px, int py, uint16_t c,
+                                    uint16_t fgcolor, uint16_t bgcolor) {
+  int d = (px - AVATAR_IMAGE_SIZE / 2) * (px - AVATAR_IMAGE_SIZE / 2) +
+          (py - AVATAR_IMAGE_SIZE / 2) * (py - AVATAR_IMAGE_SIZE / 2);
+  // inside border area
+  if (d < AVATAR_BORDER_LOW) {
+    return c;
+  }
+  // outside border area
+  if (d > AVATAR_BORDER_HIGH) {
+    return bgcolor;
+  }
+  // border area
+#if AVATAR_ANTIALIAS
+  d = 31 * (d - AVATAR_BORDER_LOW) / (AVATAR_BORDER_HIGH - AVATAR_BORDER_LOW);
+  if (d >= 16) {
+    return interpolate_color(bgcolor, fgcolor, d - 16);
+  }
+  return interpolate_color(fgcolor, c, d);
+#else
+  return fgcolor;
+#endif
+}
+
 void display_avatar(int x, int y, const void *data, uint32_t datalen,
                     uint16_t fgcolor, uint16_t bgcolor) {
 #if TREZOR_MODEL == T
@@ -240,57 +517,118 @@ void display_avatar(int x, int y, const void *data, uint32_t datalen,
   y += DISPLAY_OFFSET.y;
   int x0, y0, x1, y1;
   clamp_coords(x, y, AVATAR_IMAGE_SIZE, AVATAR_IMAGE_SIZE, &x0, &y0, &x1, &y1);
-  display_set_window(x0, y0, x1, y1);
+  display_draw_window(x0, y0, x1, y1);
   x0 -= x;
   x1 -= x;
   y0 -= y;
   y1 -= y;
 
+  const uint8_t *pixels = image_cache_get(data, datalen, AVATAR_PIXELS_LEN);
+
   struct uzlib_uncomp decomp;
   uint8_t decomp_window[UZLIB_WINDOW_SIZE];
   uint8_t decomp_out[2];
-  uzlib_prepare(&decomp, decomp_window, data, datalen, decomp_out,
-                sizeof(decomp_out));
+  if (pixels == NULL) {
+    uzlib_prepare(&decomp, decomp_window, data, datalen, decomp_out,
+                  sizeof(decomp_out));
+  }
 
   for (uint32_t pos = 0; pos < AVATAR_IMAGE_SIZE * AVATAR_IMAGE_SIZE; pos++) {
-    int st = uzlib_uncompress(&decomp);
-    if (st == TINF_DONE) break;  // all OK
-    if (st < 0) break;           // error
+    if (pixels != NULL) {
+      decomp_out[0] = pixels[pos * 2];
+      decomp_out[1] = pixels[pos * 2 + 1];
+    } else {
+      int st = uzlib_uncompress(&decomp);
+      if (st == TINF_DONE) break;  // all OK
+      if (st < 0) break;           // error
+      decomp.dest = (uint8_t *)&decomp_out;
+    }
     const int px = pos % AVATAR_IMAGE_SIZE;
     const int py = pos / AVATAR_IMAGE_SIZE;
     if (px >= x0 && px <= x1 && py >= y0 && py <= y1) {
-      int d = (px - AVATAR_IMAGE_SIZE / 2) * (px - AVATAR_IMAGE_SIZE / 2) +
-              (py - AVATAR_IMAGE_SIZE / 2) * (py - AVATAR_IMAGE_SIZE / 2);
-      // inside border area
-      if (d < AVATAR_BORDER_LOW) {
-        PIXELDATA((decomp_out[0] << 8) | decomp_out[1]);
-      } else
-          // outside border area
-          if (d > AVATAR_BORDER_HIGH) {
-        PIXELDATA(bgcolor);
-        // border area
-      } else {
-#if AVATAR_ANTIALIAS
-        d = 31 * (d - AVATAR_BORDER_LOW) /
-            (AVATAR_BORDER_HIGH - AVATAR_BORDER_LOW);
-        uint16_t c;
-        if (d >= 16) {
-          c = interpolate_color(bgcolor, fgcolor, d - 16);
-        } else {
-          c = interpolate_color(fgcolor, (decomp_out[0] << 8) | decomp_out[1],
-                                d);
-        }
-        PIXELDATA(c);
-#else
-        PIXELDATA(fgcolor);
-#endif
-      }
+      PIXELDATA(avatar_pixel(px, py, (decomp_out[0] << 8) | decomp_out[1],
+                             fgcolor, bgcolor));
     }
-    decomp.dest = (uint8_t *)&decomp_out;
   }
 #endif
 }
 
+#if TREZOR_MODEL == T && DISPLAY_IMAGE_CACHE_SIZE >= AVATAR_PIXELS_LEN
+
+// The avatar rendered with its border, in big-endian pixels.
+static const uint8_t *avatar_preloaded = NULL;
+
+bool display_avatar_preload(const void *data, uint32_t datalen,
+                            uint16_t fgcolor, uint16_t bgcolor) {
+  avatar_preloaded = NULL;
+  image_cache_limit = DISPLAY_IMAGE_CACHE_SIZE;
+  if (data == NULL) {
+    return false;
+  }
+  while (image_cache_end > DISPLAY_IMAGE_CACHE_SIZE - AVATAR_PIXELS_LEN) {
+    image_cache_evict();
+  }
+  image_cache_limit = DISPLAY_IMAGE_CACHE_SIZE - AVATAR_PIXELS_LEN;
+  uint8_t *dest = image_cache_data + image_cache_limit;
+  struct uzlib_uncomp decomp;
+  uzlib_prepare(&decomp, NULL, data, datalen, dest, AVATAR_PIXELS_LEN);
+  int st = uzlib_uncompress(&decomp);
+  if (st < 0 || decomp.dest != dest + AVATAR_PIXELS_LEN) {
+    image_cache_limit = DISPLAY_IMAGE_CACHE_SIZE;
+    return false;
+  }
+  for (uint32_t pos = 0; pos < AVATAR_IMAGE_SIZE * AVATAR_IMAGE_SIZE; pos++) {
+    uint16_t c = avatar_pixel(pos % AVATAR_IMAGE_SIZE, pos / AVATAR_IMAGE_SIZE,
+                              (dest[pos * 2] << 8) | dest[pos * 2 + 1],
+                              fgcolor, bgcolor);
+    dest[pos * 2] = c >> 8;
+    dest[pos * 2 + 1] = c & 0xFF;
+  }
+  avatar_preloaded = dest;
+  return true;
+}
+
+bool display_avatar_preloaded(int x, int y) {
+  if (avatar_preloaded == NULL) {
+    return false;
+  }
+  x += DISPLAY_OFFSET.x;
+  y += DISPLAY_OFFSET.y;
+  int x0, y0, x1, y1;
+  clamp_coords(x, y, AVATAR_IMAGE_SIZE, AVATAR_IMAGE_SIZE, &x0, &y0, &x1, &y1);
+  display_draw_window(x0, y0, x1, y1);
+  x0 -= x;
+  x1 -= x;
+  y0 -= y;
+  y1 -= y;
+  for (int py = y0; py <= y1 && x0 <= x1; py++) {
+    memcpy(display_line(),
+           avatar_preloaded + (py * AVATAR_IMAGE_SIZE + x0) * 2,
+           (x1 - x0 + 1) * 2);
+    display_line_push(x1 - x0 + 1);
+  }
+  return true;
+}
+
+#else
+
+bool display_avatar_preload(const void *data, uint32_t datalen,
+                            uint16_t fgcolor, uint16_t bgcolor) {
+  (void)data;
+  (void)datalen;
+  (void)fgcolor;
+  (void)bgcolor;
+  return false;
+}
+
+bool display_avatar_preloaded(int x, int y) {
+  (void)x;
+  (void)y;
+  return false;
+}
+
+#endif
+
 void display_icon(int x, int y, int w, int h, const void *data,
                   uint32_t datalen, uint16_t fgcolor, uint16_t bgcolor) {
   x += DISPLAY_OFFSET.x;
@@ -298,7 +636,7 @@ void display_icon(int x, int y, int w, int h, const void *data,
   x &= ~1;  // cannot draw at odd coordinate
   int x0, y0, x1, y1;
   clamp_coords(x, y, w, h, &x0, &y0, &x1, &y1);
-  display_set_window(x0, y0, x1, y1);
+  display_draw_window(x0, y0, x1, y1);
   x0 -= x;
   x1 -= x;
   y0 -= y;
@@ -307,6 +645,20 @@ void display_icon(int x, int y, int w, int h, const void *data,
   uint16_t colortable[16];
   set_color_table(colortable, fgcolor, bgcolor);
 
+  const uint8_t *pixels = image_cache_get(data, datalen, w * h / 2);
+  if (pixels != NULL) {
+    for (int py = y0; py <= y1 && x0 <= x1; py++) {
+      // every byte holds two pixels, x0 is even and x1 is odd
+      for (int px = x0; px <= x1; px += 2) {
+        const uint8_t c = pixels[(py * w + px) / 2];
+        display_line_set(px - x0, colortable[c >> 4]);
+        display_line_set(px + 1 - x0, colortable[c & 0x0F]);
+      }
+      display_line_push(x1 - x0 + 1);
+    }
+    return;
+  }
+
   struct uzlib_uncomp decomp;
   uint8_t decomp_window[UZLIB_WINDOW_SIZE];
   uint8_t decomp_out;
@@ -317,11 +669,15 @@ void display_icon(int x, int y, int w, int h, const void *data,
     int st = uzlib_uncompress(&decomp);
     if (st == TINF_DONE) break;  // all OK
     if (st < 0) break;           // error
-    const int px = pos % w;
-    const int py = pos / w;
+    // every byte holds two pixels, x0 is even and x1 is odd
+    const int px = (pos * 2) % w;
+    const int py = (pos * 2) / w;
     if (px >= x0 && px <= x1 && py >= y0 && py <= y1) {
-      PIXELDATA(colortable[decomp_out >> 4]);
-      PIXELDATA(colortable[decomp_out & 0x0F]);
+      display_line_set(px - x0, colortable[decomp_out >> 4]);
+      display_line_set(px + 1 - x0, colortable[decomp_out & 0x0F]);
+      if (px + 1 == x1) {
+        display_line_push(x1 - x0 + 1);
+      }
     }
     decomp.dest = (uint8_t *)&decomp_out;
   }
@@ -329,6 +685,77 @@ void display_icon(int x, int y, int w, int h, const void *data,
 
 #if TREZOR_MODEL == T
 #include "loader.h"
+
+#define LOADER_ICON_CORNER_CUT 2
+#define LOADER_INDETERMINATE_WIDTH 100
+
+// Returns the position of the loader pixel x, y on the progress circle
+// (0-999) and its mirrored coordinates in the quadrant of img_loader.
+static inline uint16_t loader_angle(int x, int y, int *mx, int *my) {
+  *mx = x;
+  *my = y;
+  if ((x >= img_loader_size) && (y >= img_loader_size)) {
+    *mx = img_loader_size * 2 - 1 - x;
+    *my = img_loader_size * 2 - 1 - y;
+    return 499 - (img_loader[*my][*mx] >> 8);
+  } else if (x >= img_loader_size) {
+    *mx = img_loader_size * 2 - 1 - x;
+    return img_loader[*my][*mx] >> 8;
+  } else if (y >= img_loader_size) {
+    *my = img_loader_size * 2 - 1 - y;
+    return 500 + (img_loader[*my][*mx] >> 8);
+  } else {
+    return 999 - (img_loader[*my][*mx] >> 8);
+  }
+}
+
+// Returns the index of the icon pixel drawn at x, y, or -1 outside the icon.
+static inline int loader_icon_index(int x, int y, int mx, int my) {
+  // inside of circle - draw glyph
+  if (mx + my > (((LOADER_ICON_SIZE / 2) + LOADER_ICON_CORNER_CUT) * 2) &&
+      mx >= img_loader_size - (LOADER_ICON_SIZE / 2) &&
+      my >= img_loader_size - (LOADER_ICON_SIZE / 2)) {
+    return (x - (img_loader_size - (LOADER_ICON_SIZE / 2))) +
+           (y - (img_loader_size - (LOADER_ICON_SIZE / 2))) * LOADER_ICON_SIZE;
+  }
+  return -1;
+}
+
+static uint16_t loader_color(int x, int y, uint16_t progress,
+                             bool indeterminate, const uint16_t *colortable,
+                             const uint8_t *icon,
+                             const uint16_t *iconcolortable) {
+  int mx, my;
+  const uint16_t a = loader_angle(x, y, &mx, &my);
+  const int i = icon ? loader_icon_index(x, y, mx, my) : -1;
+  if (i >= 0) {
+    uint8_t c;
+    if (i % 2) {
+      c = icon[i / 2] & 0x0F;
+    } else {
+      c = (icon[i / 2] & 0xF0) >> 4;
+    }
+    return iconcolortable[c];
+  }
+  uint8_t c;
+  if (indeterminate) {
+    uint16_t diff = (progress > a) ? (progress - a) : (1000 + progress - a);
+    if (diff < LOADER_INDETERMINATE_WIDTH ||
+        diff > 1000 - LOADER_INDETERMINATE_WIDTH) {
+      c = (img_loader[my][mx] & 0x00F0) >> 4;
+    } else {
+      c = img_loader[my][mx] & 0x000F;
+    }
+  } else {
+    if (progress > a) {
+      c = (img_loader[my][mx] & 0x00F0) >> 4;
+    } else {
+      c = img_loader[my][mx] & 0x000F;
+    }
+  }
+  return colortable[c];
+}
+
 #endif
 
 void display_loader(uint16_t progress, bool indeterminate, int yoffset,
@@ -336,6 +763,7 @@ void display_loader(uint16_t progress, bool indeterminate, int yoffset,
                     uint32_t iconlen, uint16_t iconfgcolor) {
 #if TREZOR_MODEL == T
   uint16_t colortable[16], iconcolortable[16];
+  uint8_t icondata[LOADER_ICON_SIZE * LOADER_ICON_SIZE / 2];
   set_color_table(colortable, fgcolor, bgcolor);
   if (icon) {
     set_color_table(iconcolortable, iconfgcolor, bgcolor);
@@ -344,80 +772,88 @@ void display_loader(uint16_t progress, bool indeterminate, int yoffset,
       (DISPLAY_RESY / 2 + img_loader_size - 1 + yoffset >= DISPLAY_RESY)) {
     return;
   }
-  display_set_window(DISPLAY_RESX / 2 - img_loader_size,
-                     DISPLAY_RESY / 2 - img_loader_size + yoffset,
-                     DISPLAY_RESX / 2 + img_loader_size - 1,
-                     DISPLAY_RESY / 2 + img_loader_size - 1 + yoffset);
+  const int x0 = DISPLAY_RESX / 2 - img_loader_size;
+  const int y0 = DISPLAY_RESY / 2 - img_loader_size + yoffset;
+  const int x1 = DISPLAY_RESX / 2 + img_loader_size - 1;
+  const int y1 = DISPLAY_RESY / 2 + img_loader_size - 1 + yoffset;
+  // only the pixels between the last and the new progress change
+  const bool incremental =
+      !indeterminate && LOADER_LAST.valid && LOADER_LAST.x0 == x0 &&
+      LOADER_LAST.y0 == y0 && LOADER_LAST.fgcolor == fgcolor &&
+      LOADER_LAST.bgcolor == bgcolor && LOADER_LAST.icon == icon &&
+      LOADER_LAST.iconlen == iconlen &&
+      (!icon || LOADER_LAST.iconfgcolor == iconfgcolor);
+  const uint16_t last_progress = LOADER_LAST.progress;
+  const uint8_t *const toif = icon;
   if (icon && memcmp(icon, "TOIg", 4) == 0 &&
       LOADER_ICON_SIZE == *(uint16_t *)(icon + 4) &&
       LOADER_ICON_SIZE == *(uint16_t *)(icon + 6) &&
       iconlen == 12 + *(uint32_t *)(icon + 8)) {
-    uint8_t icondata[LOADER_ICON_SIZE * LOADER_ICON_SIZE / 2];
-    memzero(&icondata, sizeof(icondata));
-    struct uzlib_uncomp decomp;
-    uzlib_prepare(&decomp, NULL, icon + 12, iconlen - 12, icondata,
-                  sizeof(icondata));
-    uzlib_uncompress(&decomp);
-    icon = icondata;
+    const uint8_t *cached = image_cache_get(icon + 12, iconlen - 12,
+                                            sizeof(icondata));
+    if (cached != NULL) {
+      icon = cached;
+    } else {
+      struct uzlib_uncomp decomp;
+      uzlib_prepare(&decomp, NULL, icon + 12, iconlen - 12, icondata,
+                    sizeof(icondata));
+      uzlib_uncompress(&decomp);
+      icon = icondata;
+    }
   } else {
     icon = NULL;
   }
-  for (int y = 0; y < img_loader_size * 2; y++) {
-    for (int x = 0; x < img_loader_size * 2; x++) {
-      int mx = x, my = y;
-      uint16_t a;
-      if ((mx >= img_loader_size) && (my >= img_loader_size)) {
-        mx = img_loader_size * 2 - 1 - x;
-        my = img_loader_size * 2 - 1 - y;
-        a = 499 - (img_loader[my][mx] >> 8);
-      } else if (mx >= img_loader_size) {
-        mx = img_loader_size * 2 - 1 - x;
-        a = img_loader[my][mx] >> 8;
-      } else if (my >= img_loader_size) {
-        my = img_loader_size * 2 - 1 - y;
-        a = 500 + (img_loader[my][mx] >> 8);
-      } else {
-        a = 999 - (img_loader[my][mx] >> 8);
-      }
-// inside of circle - draw glyph
-#define LOADER_ICON_CORNER_CUT 2
-#define LOADER_INDETERMINATE_WIDTH 100
-      if (icon &&
-          mx + my > (((LOADER_ICON_SIZE / 2) + LOADER_ICON_CORNER_CUT) * 2) &&
-          mx >= img_loader_size - (LOADER_ICON_SIZE / 2) &&
-          my >= img_loader_size - (LOADER_ICON_SIZE / 2)) {
-        int i =
-            (x - (img_loader_size - (LOADER_ICON_SIZE / 2))) +
-            (y - (img_loader_size - (LOADER_ICON_SIZE / 2))) * LOADER_ICON_SIZE;
-        uint8_t c;
-        if (i % 2) {
-          c = icon[i / 2] & 0x0F;
-        } else {
-          c = (icon[i / 2] & 0xF0) >> 4;
-        }
-        PIXELDATA(iconcolortable[c]);
-      } else {
-        uint8_t c;
-        if (indeterminate) {
-          uint16_t diff =
-              (progress > a) ? (progress - a) : (1000 + progress - a);
-          if (diff < LOADER_INDETERMINATE_WIDTH ||
-              diff > 1000 - LOADER_INDETERMINATE_WIDTH) {
-            c = (img_loader[my][mx] & 0x00F0) >> 4;
-          } else {
-            c = img_loader[my][mx] & 0x000F;
-          }
-        } else {
-          if (progress > a) {
-            c = (img_loader[my][mx] & 0x00F0) >> 4;
-          } else {
-            c = img_loader[my][mx] & 0x000F;
+
+  if (incremental) {
+    if (progress != last_progress) {
+      for (int y = 0; y < img_loader_size * 2; y++) {
+        int first = -1, last = -1;
+        for (int x = 0; x < img_loader_size * 2; x++) {
+          int mx, my;
+          const uint16_t a = loader_angle(x, y, &mx, &my);
+          if ((last_progress > a) != (progress > a) &&
+              (!icon || loader_icon_index(x, y, mx, my) < 0)) {
+            if (first < 0) {
+              first = x;
+            }
+            last = x;
           }
         }
-        PIXELDATA(colortable[c]);
+        if (first < 0) {
+          continue;
+        }
+        display_draw_window(x0 + first, y0 + y, x0 + last, y0 + y);
+        for (int x = first; x <= last; x++) {
+          display_line_set(x - first,
+                           loader_color(x, y, progress, false, colortable,
+                                        icon, iconcolortable));
+        }
+        display_line_push(last - first + 1);
       }
     }
+  } else {
+    display_draw_window(x0, y0, x1, y1);
+    for (int y = 0; y < img_loader_size * 2; y++) {
+      for (int x = 0; x < img_loader_size * 2; x++) {
+        display_line_set(x, loader_color(x, y, progress, indeterminate,
+                                         colortable, icon, iconcolortable));
+      }
+      display_line_push(img_loader_size * 2);
+    }
   }
+
+  // drawing the loader invalidated the last one in display_dirty
+  LOADER_LAST.valid = !indeterminate;
+  LOADER_LAST.x0 = x0;
+  LOADER_LAST.y0 = y0;
+  LOADER_LAST.x1 = x1;
+  LOADER_LAST.y1 = y1;
+  LOADER_LAST.progress = progress;
+  LOADER_LAST.fgcolor = fgcolor;
+  LOADER_LAST.bgcolor = bgcolor;
+  LOADER_LAST.iconfgcolor = iconfgcolor;
+  LOADER_LAST.icon = toif;
+  LOADER_LAST.iconlen = iconlen;
 #endif
 }
 
@@ -475,7 +911,7 @@ void display_print(const char *text, int textlen) {
   }
 
   // render buffer to display
-  display_set_window(0, 0, DISPLAY_RESX - 1, DISPLAY_RESY - 1);
+  display_draw_window(0, 0, DISPLAY_RESX - 1, DISPLAY_RESY - 1);
   for (int i = 0; i < DISPLAY_RESX * DISPLAY_RESY; i++) {
     int x = (i % DISPLAY_RESX);
     int y = (i / DISPLAY_RESX);
@@ -562,30 +998,67 @@ static uint8_t convert_char(const uint8_t c) {
   return 0;
 }
 
-static const uint8_t *get_glyph(int font, uint8_t c) {
-  c = convert_char(c);
-  if (!c) return 0;
+#define FONT_GLYPHS (126 + 1 - ' ')
+
+static const uint8_t *const *get_font(int font) {
   switch (font) {
 #ifdef TREZOR_FONT_NORMAL_ENABLE
     case FONT_NORMAL:
-      return Font_Roboto_Regular_20[c - ' '];
+      return Font_Roboto_Regular_20;
 #endif
 #ifdef TREZOR_FONT_BOLD_ENABLE
     case FONT_BOLD:
-      return Font_Roboto_Bold_20[c - ' '];
+      return Font_Roboto_Bold_20;
 #endif
 #ifdef TREZOR_FONT_MONO_ENABLE
     case FONT_MONO:
-      return Font_RobotoMono_Regular_20[c - ' '];
+      return Font_RobotoMono_Regular_20;
 #endif
 #ifdef TREZOR_FONT_MONO_BOLD_ENABLE
     case FONT_MONO_BOLD:
-      return Font_RobotoMono_Bold_20[c - ' '];
+      return Font_RobotoMono_Bold_20;
 #endif
   }
   return 0;
 }
 
+static const uint8_t *get_glyph(int font, uint8_t c) {
+  c = convert_char(c);
+  if (!c) return 0;
+  const uint8_t *const *glyphs = get_font(font);
+  if (!glyphs) return 0;
+  return glyphs[c - ' '];
+}
+
+#if TREZOR_MODEL == T
+
+// Advances of all glyphs of a font, indexed by character - ' '. Measuring text
+// then reads one table instead of dereferencing every glyph in flash.
+static uint8_t font_advances[4][FONT_GLYPHS];
+static bool font_advances_ready[4];
+
+static const uint8_t *get_advances(int font) {
+  const uint8_t *const *glyphs = get_font(font);
+  if (!glyphs) return 0;
+  uint8_t *advances = font_advances[-1 - font];
+  if (!font_advances_ready[-1 - font]) {
+    for (int i = 0; i < FONT_GLYPHS; i++) {
+      advances[i] = glyphs[i][2];
+    }
+    font_advances_ready[-1 - font] = true;
+  }
+  return advances;
+}
+
+// Returns the advance of the next character of a string, like get_glyph.
+static inline uint8_t get_advance(const uint8_t *advances, uint8_t c) {
+  c = convert_char(c);
+  if (!c || !advances || c - ' ' >= FONT_GLYPHS) return 0;
+  return advances[c - ' '];
+}
+
+#endif
+
 #endif
 
 #if TREZOR_MODEL == T
@@ -614,7 +1087,7 @@ static void display_text_render(int x, int y, const char *text, int textlen,
       const int sy = y - bearY;
       int x0, y0, x1, y1;
       clamp_coords(sx, sy, w, h, &x0, &y0, &x1, &y1);
-      display_set_window(x0, y0, x1, y1);
+      display_draw_window(x0, y0, x1, y1);
       for (int j = y0; j <= y1; j++) {
         for (int i = x0; i <= x1; i++) {
           const int rx = i - sx;
@@ -627,8 +1100,9 @@ static void display_text_render(int x, int y, const char *text, int textlen,
 #else
 #error Unsupported FONT_BPP value
 #endif
-          PIXELDATA(colortable[c]);
+          display_line_set(i - x0, colortable[c]);
         }
+        display_line_push(x1 - x0 + 1);
       }
     }
     x += adv;
@@ -674,11 +1148,9 @@ int display_text_width(const char *text, int textlen, int font) {
   if (textlen < 0) {
     textlen = strlen(text);
   }
+  const uint8_t *advances = get_advances(font);
   for (int i = 0; i < textlen; i++) {
-    const uint8_t *g = get_glyph(font, (uint8_t)text[i]);
-    if (!g) continue;
-    const uint8_t adv = g[2];  // advance
-    width += adv;
+    width += get_advance(advances, (uint8_t)text[i]);
     /*
     if (i != textlen - 1) {
         const uint8_t adv = g[2]; // advance
@@ -705,14 +1177,12 @@ int display_text_split(const char *text, int textlen, int font,
   if (textlen < 0) {
     textlen = strlen(text);
   }
+  const uint8_t *advances = get_advances(font);
   for (int i = 0; i < textlen; i++) {
     if (text[i] == ' ') {
       lastspace = i;
     }
-    const uint8_t *g = get_glyph(font, (uint8_t)text[i]);
-    if (!g) continue;
-    const uint8_t adv = g[2];  // advance
-    width += adv;
+    width += get_advance(advances, (uint8_t)text[i]);
     if (width > requested_width) {
       if (lastspace > 0) {
         return lastspace;
@@ -726,42 +1196,86 @@ int display_text_split(const char *text, int textlen, int font,
 }
 
 #define QR_MAX_VERSION 9
+#define QR_CACHE_ENTRIES 2
+#define QR_CACHE_DATA_MAX 128
+
+// Recently encoded symbols, as the mask selection is expensive and screens
+// with a QR code are redrawn on every swipe. The error correction level is
+// fixed, so the data alone is the key.
+static struct {
+  bool valid;
+  uint32_t datalen;
+  char data[QR_CACHE_DATA_MAX];
+  int side;
+  uint8_t codedata[qrcodegen_BUFFER_LEN_FOR_VERSION(QR_MAX_VERSION)];
+} qr_cache[QR_CACHE_ENTRIES];
+static int qr_cache_next = 0;
+
+// Returns the symbol encoding data, which is either cached or written to
+// codedata, and stores its size in side (0 if the data cannot be encoded).
+static const uint8_t *qrcode_encode(const char *data, uint32_t datalen,
+                                    uint8_t *codedata, int *side) {
+  for (int i = 0; i < QR_CACHE_ENTRIES; i++) {
+    if (qr_cache[i].valid && qr_cache[i].datalen == datalen &&
+        memcmp(qr_cache[i].data, data, datalen) == 0) {
+      *side = qr_cache[i].side;
+      return qr_cache[i].codedata;
+    }
+  }
+
+  uint8_t tempdata[qrcodegen_BUFFER_LEN_FOR_VERSION(QR_MAX_VERSION)];
+  *side = 0;
+  if (qrcodegen_encodeText(data, tempdata, codedata, qrcodegen_Ecc_MEDIUM,
+                           qrcodegen_VERSION_MIN, QR_MAX_VERSION,
+                           qrcodegen_Mask_AUTO, true)) {
+    *side = qrcodegen_getSize(codedata);
+  }
+
+  if (datalen <= QR_CACHE_DATA_MAX) {
+    qr_cache[qr_cache_next].valid = true;
+    qr_cache[qr_cache_next].datalen = datalen;
+    memcpy(qr_cache[qr_cache_next].data, data, datalen);
+    qr_cache[qr_cache_next].side = *side;
+    memcpy(qr_cache[qr_cache_next].codedata, codedata,
+           sizeof(qr_cache[qr_cache_next].codedata));
+    qr_cache_next = (qr_cache_next + 1) % QR_CACHE_ENTRIES;
+  }
+  return codedata;
+}
 
 void display_qrcode(int x, int y, const char *data, uint32_t datalen,
                     uint8_t scale) {
   if (scale < 1 || scale > 10) return;
 
   uint8_t codedata[qrcodegen_BUFFER_LEN_FOR_VERSION(QR_MAX_VERSION)];
-  uint8_t tempdata[qrcodegen_BUFFER_LEN_FOR_VERSION(QR_MAX_VERSION)];
-
   int side = 0;
-  if (qrcodegen_encodeText(data, tempdata, codedata, qrcodegen_Ecc_MEDIUM,
-                           qrcodegen_VERSION_MIN, QR_MAX_VERSION,
-                           qrcodegen_Mask_AUTO, true)) {
-    side = qrcodegen_getSize(codedata);
-  }
+  const uint8_t *code = qrcode_encode(data, datalen, codedata, &side);
 
   x += DISPLAY_OFFSET.x - (side + 2) * scale / 2;
   y += DISPLAY_OFFSET.y - (side + 2) * scale / 2;
   int x0, y0, x1, y1;
   clamp_coords(x, y, (side + 2) * scale, (side + 2) * scale, &x0, &y0, &x1,
                &y1);
-  display_set_window(x0, y0, x1, y1);
-  for (int j = y0; j <= y1; j++) {
+  display_draw_window(x0, y0, x1, y1);
+  // render each row of modules once and push it for all of its pixel rows
+  for (int j = y0; j <= y1 && x0 <= x1;) {
+    const int ry = (j - y) / scale - 1;
+    const int rows = MIN(y + (ry + 2) * scale, y1 + 1) - j;
     for (int i = x0; i <= x1; i++) {
-      int rx = (i - x) / scale - 1;
-      int ry = (j - y) / scale - 1;
+      const int rx = (i - x) / scale - 1;
       // 1px border
-      if (rx < 0 || ry < 0 || rx >= side || ry >= side) {
-        PIXELDATA(0xFFFF);
-        continue;
-      }
-      if (qrcodegen_getModule(codedata, rx, ry)) {
-        PIXELDATA(0x0000);
+      if (rx < 0 || ry < 0 || rx >= side || ry >= side ||
+          !qrcodegen_getModule(code, rx, ry)) {
+        display_line_set(i - x0, 0xFFFF);
       } else {
-        PIXELDATA(0xFFFF);
+        display_line_set(i - x0, 0x0000);
       }
     }
+    for (int k = 1; k < rows; k++) {
+      display_pixels(display_line(), x1 - x0 + 1);
+    }
+    display_line_push(x1 - x0 + 1);
+    j += rows;
   }
 }
 
@@ -784,13 +1298,14 @@ int display_orientation(int degrees) {
 #error Unknown Trezor model
 #endif
       DISPLAY_ORIENTATION = degrees;
+      display_dirty(0, 0, MAX_DISPLAY_RESX - 1, MAX_DISPLAY_RESY - 1);
       display_set_orientation(degrees);
     }
   }
   return DISPLAY_ORIENTATION;
 }
 
-int display_backlight(int val) {
+static int display_backlight_update(int val) {
 #if TREZOR_MODEL == 1
   val = 255;
 #endif
@@ -801,6 +1316,19 @@ int display_backlight(int val) {
   return DISPLAY_BACKLIGHT;
 }
 
+static void display_fade_stop(void) {
+  display_fade_timer(false);
+  DISPLAY_FADE.running = false;
+}
+
+int display_backlight(int val) {
+  // setting a value cancels the running fade
+  if (val >= 0) {
+    display_fade_stop();
+  }
+  return display_backlight_update(val);
+}
+
 void display_fade(int start, int end, int delay) {
   for (int i = 0; i < 100; i++) {
     display_backlight(start + i * (end - start) / 100);
@@ -808,3 +1336,41 @@ void display_fade(int start, int end, int delay) {
   }
   display_backlight(end);
 }
+
+static void display_fade_update(void) {
+  if (!DISPLAY_FADE.running) {
+    return;
+  }
+  const uint32_t elapsed = display_fade_ticks() - DISPLAY_FADE.begin;
+  if (elapsed >= DISPLAY_FADE.duration) {
+    display_fade_stop();
+    display_backlight_update(DISPLAY_FADE.end);
+  } else {
+    display_backlight_update(DISPLAY_FADE.start +
+                             (DISPLAY_FADE.end - DISPLAY_FADE.start) *
+                                 (int)elapsed / (int)DISPLAY_FADE.duration);
+  }
+}
+
+// Starts fading the backlight to end over duration milliseconds and returns
+// immediately.
+void display_fade_start(int end, int duration) {
+  display_fade_stop();
+  if (duration <= 0 || end == DISPLAY_BACKLIGHT) {
+    display_backlight_update(end);
+    return;
+  }
+  DISPLAY_FADE.start = DISPLAY_BACKLIGHT;
+  DISPLAY_FADE.end = end;
+  DISPLAY_FADE.begin = display_fade_ticks();
+  DISPLAY_FADE.duration = duration;
+  DISPLAY_FADE.running = true;
+  display_fade_timer(true);
+}
+
+bool display_fade_running(void) {
+#ifndef DISPLAY_FADE_TIMER
+  display_fade_update();
+#endif
+  return DISPLAY_FADE.running;
+}
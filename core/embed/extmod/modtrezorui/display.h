@@ -69,6 +69,9 @@
 void display_init(void);
 void display_refresh(void);
 const char *display_save(const char *prefix);
+void display_save_frame(void);
+void display_save_kept(const char *prefix);
+void display_save_hash(uint8_t hash[32]);
 void display_clear_save(void);
 
 // provided by common
@@ -88,6 +91,10 @@ void display_icon(int x, int y, int w, int h, const void *data,
 void display_loader(uint16_t progress, bool indeterminate, int yoffset,
                     uint16_t fgcolor, uint16_t bgcolor, const uint8_t *icon,
                     uint32_t iconlen, uint16_t iconfgcolor);
+bool display_avatar_preload(const void *data, uint32_t datalen,
+                            uint16_t fgcolor, uint16_t bgcolor);
+bool display_avatar_preloaded(int x, int y);
+void display_image_cache_stats(uint32_t *hits, uint32_t *misses);
 
 #ifndef TREZOR_PRINT_DISABLE
 void display_print_color(uint16_t fgcolor, uint16_t bgcolor);
@@ -113,5 +120,7 @@ void display_offset(int set_xy[2], int *get_x, int *get_y);
 int display_orientation(int degrees);
 int display_backlight(int val);
 void display_fade(int start, int end, int delay);
+void display_fade_start(int end, int duration);
+bool display_fade_running(void);
 
 #endif
@@ -18,6 +18,7 @@
  */
 
 #include "display.h"
+#include "trace.h"
 
 /// class Display:
 ///     """
@@ -65,7 +66,9 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorui_Display_clear_obj,
 ///     Refresh display (update screen).
 ///     """
 STATIC mp_obj_t mod_trezorui_Display_refresh(mp_obj_t self) {
+  trace_event(TRACE_DISPLAY_REFRESH, TRACE_BEGIN);
   display_refresh();
+  trace_event(TRACE_DISPLAY_REFRESH, TRACE_END);
   return mp_const_none;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorui_Display_refresh_obj,
@@ -156,12 +159,10 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_trezorui_Display_image_obj, 4, 4,
 ///     full-color mode. Image needs to be of exactly AVATAR_IMAGE_SIZE x
 ///     AVATAR_IMAGE_SIZE pixels size.
 ///     """
-STATIC mp_obj_t mod_trezorui_Display_avatar(size_t n_args,
-                                            const mp_obj_t *args) {
-  mp_int_t x = mp_obj_get_int(args[1]);
-  mp_int_t y = mp_obj_get_int(args[2]);
+// Checks the avatar TOIF in buf and returns its compressed data and length.
+static const uint8_t *get_avatar_data(mp_obj_t buf, uint32_t *datalen) {
   mp_buffer_info_t image;
-  mp_get_buffer_raise(args[3], &image, MP_BUFFER_READ);
+  mp_get_buffer_raise(buf, &image, MP_BUFFER_READ);
   const uint8_t *data = image.buf;
   if (image.len < 8 || memcmp(data, "TOIf", 4) != 0) {
     mp_raise_ValueError("Invalid image format");
@@ -171,18 +172,67 @@ STATIC mp_obj_t mod_trezorui_Display_avatar(size_t n_args,
   if (w != AVATAR_IMAGE_SIZE || h != AVATAR_IMAGE_SIZE) {
     mp_raise_ValueError("Invalid image size");
   }
-  uint32_t datalen = *(uint32_t *)(data + 8);
-  if (datalen != image.len - 12) {
+  *datalen = *(uint32_t *)(data + 8);
+  if (*datalen != image.len - 12) {
     mp_raise_ValueError("Invalid size of data");
   }
+  return data + 12;
+}
+
+STATIC mp_obj_t mod_trezorui_Display_avatar(size_t n_args,
+                                            const mp_obj_t *args) {
+  mp_int_t x = mp_obj_get_int(args[1]);
+  mp_int_t y = mp_obj_get_int(args[2]);
+  uint32_t datalen = 0;
+  const uint8_t *data = get_avatar_data(args[3], &datalen);
   mp_int_t fgcolor = mp_obj_get_int(args[4]);
   mp_int_t bgcolor = mp_obj_get_int(args[5]);
-  display_avatar(x, y, data + 12, datalen, fgcolor, bgcolor);
+  display_avatar(x, y, data, datalen, fgcolor, bgcolor);
   return mp_const_none;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_trezorui_Display_avatar_obj, 6,
                                            6, mod_trezorui_Display_avatar);
 
+/// def avatar_preload(
+///     self, image: Optional[bytes], fgcolor: int, bgcolor: int
+/// ) -> bool:
+///     """
+///     Decompresses the avatar and renders its border into RAM once, so that
+///     avatar_preloaded() draws it without inflating the image again. The
+///     image has the same format as for avatar(). None frees the memory.
+///     Returns False if the port cannot keep a preloaded avatar.
+///     """
+STATIC mp_obj_t mod_trezorui_Display_avatar_preload(size_t n_args,
+                                                    const mp_obj_t *args) {
+  if (args[1] == mp_const_none) {
+    display_avatar_preload(NULL, 0, 0, 0);
+    return mp_const_false;
+  }
+  uint32_t datalen = 0;
+  const uint8_t *data = get_avatar_data(args[1], &datalen);
+  mp_int_t fgcolor = mp_obj_get_int(args[2]);
+  mp_int_t bgcolor = mp_obj_get_int(args[3]);
+  return mp_obj_new_bool(
+      display_avatar_preload(data, datalen, fgcolor, bgcolor));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorui_Display_avatar_preload_obj, 4, 4,
+    mod_trezorui_Display_avatar_preload);
+
+/// def avatar_preloaded(self, x: int, y: int) -> bool:
+///     """
+///     Renders the avatar loaded by avatar_preload() at position (x,y).
+///     Returns False and draws nothing if there is no preloaded avatar.
+///     """
+STATIC mp_obj_t mod_trezorui_Display_avatar_preloaded(mp_obj_t self,
+                                                      mp_obj_t x,
+                                                      mp_obj_t y) {
+  return mp_obj_new_bool(
+      display_avatar_preloaded(mp_obj_get_int(x), mp_obj_get_int(y)));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(mod_trezorui_Display_avatar_preloaded_obj,
+                                 mod_trezorui_Display_avatar_preloaded);
+
 /// def icon(
 ///     self, x: int, y: int, icon: bytes, fgcolor: int, bgcolor: int
 /// ) -> None:
@@ -504,6 +554,34 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_trezorui_Display_backlight_obj,
                                            1, 2,
                                            mod_trezorui_Display_backlight);
 
+/// def backlight_fade(self, val: int, duration: int) -> None:
+///     """
+///     Starts fading the backlight intensity to val over duration milliseconds
+///     and returns immediately. Setting the backlight cancels the fade.
+///     """
+STATIC mp_obj_t mod_trezorui_Display_backlight_fade(mp_obj_t self,
+                                                    mp_obj_t val,
+                                                    mp_obj_t duration) {
+  mp_int_t v = mp_obj_get_int(val);
+  if (v < 0 || v > 255) {
+    mp_raise_ValueError("Value must be between 0 and 255");
+  }
+  display_fade_start(v, mp_obj_get_int(duration));
+  return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(mod_trezorui_Display_backlight_fade_obj,
+                                 mod_trezorui_Display_backlight_fade);
+
+/// def backlight_fading(self) -> bool:
+///     """
+///     Returns True while a fade started by backlight_fade is running.
+///     """
+STATIC mp_obj_t mod_trezorui_Display_backlight_fading(mp_obj_t self) {
+  return mp_obj_new_bool(display_fade_running());
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorui_Display_backlight_fading_obj,
+                                 mod_trezorui_Display_backlight_fading);
+
 /// def offset(self, xy: Tuple[int, int] = None) -> Tuple[int, int]:
 ///     """
 ///     Sets offset (x, y) for all subsequent drawing calls.
@@ -552,6 +630,48 @@ STATIC mp_obj_t mod_trezorui_Display_save(mp_obj_t self, mp_obj_t prefix) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorui_Display_save_obj,
                                  mod_trezorui_Display_save);
 
+/// def save_frame(self) -> None:
+///     """
+///     Hashes current display contents and keeps them in memory instead of
+///     saving them to a PNG file.
+///     """
+STATIC mp_obj_t mod_trezorui_Display_save_frame(mp_obj_t self) {
+  display_save_frame();
+  return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorui_Display_save_frame_obj,
+                                 mod_trezorui_Display_save_frame);
+
+/// def save_kept(self, prefix: str) -> None:
+///     """
+///     Saves display contents kept by save_frame to PNG files with given
+///     prefix.
+///     """
+STATIC mp_obj_t mod_trezorui_Display_save_kept(mp_obj_t self,
+                                               mp_obj_t prefix) {
+  mp_buffer_info_t pfx;
+  mp_get_buffer_raise(prefix, &pfx, MP_BUFFER_READ);
+  if (pfx.len > 0) {
+    display_save_kept(pfx.buf);
+  }
+  return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorui_Display_save_kept_obj,
+                                 mod_trezorui_Display_save_kept);
+
+/// def save_hash(self) -> bytes:
+///     """
+///     Returns SHA-256 of the raw contents of all distinct frames saved since
+///     the last clear_save.
+///     """
+STATIC mp_obj_t mod_trezorui_Display_save_hash(mp_obj_t self) {
+  uint8_t hash[32];
+  display_save_hash(hash);
+  return mp_obj_new_bytes(hash, sizeof(hash));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorui_Display_save_hash_obj,
+                                 mod_trezorui_Display_save_hash);
+
 /// def clear_save(self) -> None:
 ///     """
 ///     Clears buffers in display saving.
@@ -572,6 +692,10 @@ STATIC const mp_rom_map_elem_t mod_trezorui_Display_locals_dict_table[] = {
      MP_ROM_PTR(&mod_trezorui_Display_bar_radius_obj)},
     {MP_ROM_QSTR(MP_QSTR_image), MP_ROM_PTR(&mod_trezorui_Display_image_obj)},
     {MP_ROM_QSTR(MP_QSTR_avatar), MP_ROM_PTR(&mod_trezorui_Display_avatar_obj)},
+    {MP_ROM_QSTR(MP_QSTR_avatar_preload),
+     MP_ROM_PTR(&mod_trezorui_Display_avatar_preload_obj)},
+    {MP_ROM_QSTR(MP_QSTR_avatar_preloaded),
+     MP_ROM_PTR(&mod_trezorui_Display_avatar_preloaded_obj)},
     {MP_ROM_QSTR(MP_QSTR_icon), MP_ROM_PTR(&mod_trezorui_Display_icon_obj)},
     {MP_ROM_QSTR(MP_QSTR_loader), MP_ROM_PTR(&mod_trezorui_Display_loader_obj)},
     {MP_ROM_QSTR(MP_QSTR_print), MP_ROM_PTR(&mod_trezorui_Display_print_obj)},
@@ -589,8 +713,18 @@ STATIC const mp_rom_map_elem_t mod_trezorui_Display_locals_dict_table[] = {
      MP_ROM_PTR(&mod_trezorui_Display_orientation_obj)},
     {MP_ROM_QSTR(MP_QSTR_backlight),
      MP_ROM_PTR(&mod_trezorui_Display_backlight_obj)},
+    {MP_ROM_QSTR(MP_QSTR_backlight_fade),
+     MP_ROM_PTR(&mod_trezorui_Display_backlight_fade_obj)},
+    {MP_ROM_QSTR(MP_QSTR_backlight_fading),
+     MP_ROM_PTR(&mod_trezorui_Display_backlight_fading_obj)},
     {MP_ROM_QSTR(MP_QSTR_offset), MP_ROM_PTR(&mod_trezorui_Display_offset_obj)},
     {MP_ROM_QSTR(MP_QSTR_save), MP_ROM_PTR(&mod_trezorui_Display_save_obj)},
+    {MP_ROM_QSTR(MP_QSTR_save_frame),
+     MP_ROM_PTR(&mod_trezorui_Display_save_frame_obj)},
+    {MP_ROM_QSTR(MP_QSTR_save_kept),
+     MP_ROM_PTR(&mod_trezorui_Display_save_kept_obj)},
+    {MP_ROM_QSTR(MP_QSTR_save_hash),
+     MP_ROM_PTR(&mod_trezorui_Display_save_hash_obj)},
     {MP_ROM_QSTR(MP_QSTR_clear_save),
      MP_ROM_PTR(&mod_trezorui_Display_clear_save_obj)},
     {MP_ROM_QSTR(MP_QSTR_WIDTH), MP_ROM_INT(DISPLAY_RESX)},
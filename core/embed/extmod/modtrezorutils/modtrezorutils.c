@@ -26,7 +26,12 @@
 #include "embed/extmod/trezorobj.h"
 
 #include <string.h>
+#include "boottime.h"
 #include "common.h"
+#include "trace.h"
+#ifndef TREZOR_EMULATOR
+#include "supervise.h"
+#endif
 
 /// def consteq(sec: bytes, pub: bytes) -> bool:
 ///     """
@@ -89,6 +94,92 @@ STATIC mp_obj_t mod_trezorutils_memcpy(size_t n_args, const mp_obj_t *args) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_trezorutils_memcpy_obj, 5, 5,
                                            mod_trezorutils_memcpy);
 
+/// def write_uint(
+///     w: Any, n: int, length: int, big_endian: bool = False
+/// ) -> int:
+///     """
+///     Writes the `length` lowest bytes of `n` to `w` with a single
+///     `w.extend()` call, in little endian order unless `big_endian` is set.
+///     Returns `length`.
+///     """
+STATIC mp_obj_t mod_trezorutils_write_uint(size_t n_args,
+                                           const mp_obj_t *args) {
+  uint64_t n = trezor_obj_get_uint64(args[1]);
+  mp_uint_t length = trezor_obj_get_uint(args[2]);
+  bool big_endian = n_args > 3 && mp_obj_is_true(args[3]);
+  if (length > 8) {
+    mp_raise_ValueError("Invalid length");
+  }
+
+  uint8_t buf[8];
+  for (mp_uint_t i = 0; i < length; i++) {
+    buf[big_endian ? length - 1 - i : i] = n & 0xFF;
+    n >>= 8;
+  }
+
+  mp_obj_t dest[3];
+  mp_load_method(args[0], MP_QSTR_extend, dest);
+  dest[2] = mp_obj_new_bytes(buf, length);
+  mp_call_method_n_kw(1, 0, dest);
+  return MP_OBJ_NEW_SMALL_INT(length);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_trezorutils_write_uint_obj, 3, 4,
+                                           mod_trezorutils_write_uint);
+
+static inline uint32_t read_uint32_le(const uint8_t *b) {
+  return b[0] | (b[1] << 8) | (b[2] << 16) | ((uint32_t)b[3] << 24);
+}
+
+/// def match_path(pattern: bytes, path: Sequence[int]) -> int:
+///     """
+///     Matches `path` against the alternatives of a pattern compiled by
+///     `apps.common.paths.compile_pattern()`. Returns the index of the first
+///     matching alternative, or -1 if no alternative matches.
+///     """
+STATIC mp_obj_t mod_trezorutils_match_path(mp_obj_t pattern, mp_obj_t path) {
+  mp_buffer_info_t pat;
+  mp_get_buffer_raise(pattern, &pat, MP_BUFFER_READ);
+  size_t len = 0;
+  mp_obj_t *items = NULL;
+  mp_obj_get_array(path, &len, &items);
+
+  // Each alternative is min_len, max_len (255 for no limit) and the number
+  // of constrained components, followed by the components. A component is
+  // the number of its ranges followed by the ranges as little endian
+  // (lo: uint32, hi: uint32) pairs, both bounds inclusive.
+  const uint8_t *p = pat.buf;
+  const uint8_t *end = p + pat.len;
+  for (mp_int_t index = 0; p < end; index++) {
+    if (end - p < 3) {
+      mp_raise_ValueError("Invalid pattern");
+    }
+    size_t min_len = p[0], max_len = p[1], count = p[2];
+    p += 3;
+    bool match = len >= min_len && (max_len == 255 || len <= max_len);
+    for (size_t i = 0; i < count; i++) {
+      if (p >= end || (size_t)(end - p - 1) < (size_t)p[0] * 8) {
+        mp_raise_ValueError("Invalid pattern");
+      }
+      size_t ranges = *p++;
+      if (match && i < len) {
+        mp_uint_t c = trezor_obj_get_uint(items[i]);
+        match = false;
+        for (size_t r = 0; r < ranges && !match; r++) {
+          match = read_uint32_le(p + r * 8) <= c &&
+                  c <= read_uint32_le(p + r * 8 + 4);
+        }
+      }
+      p += ranges * 8;
+    }
+    if (match) {
+      return MP_OBJ_NEW_SMALL_INT(index);
+    }
+  }
+  return MP_OBJ_NEW_SMALL_INT(-1);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorutils_match_path_obj,
+                                 mod_trezorutils_match_path);
+
 /// def halt(msg: str = None) -> None:
 ///     """
 ///     Halts execution.
@@ -105,6 +196,90 @@ STATIC mp_obj_t mod_trezorutils_halt(size_t n_args, const mp_obj_t *args) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_trezorutils_halt_obj, 0, 1,
                                            mod_trezorutils_halt);
 
+/// def boottime_mark(stage: int) -> None:
+///     """
+///     Records the time of a boot stage, see `boottime()`.
+///     """
+STATIC mp_obj_t mod_trezorutils_boottime_mark(mp_obj_t stage) {
+#ifndef TREZOR_EMULATOR
+  svc_boottime_mark(trezor_obj_get_uint(stage));
+#endif
+  return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorutils_boottime_mark_obj,
+                                 mod_trezorutils_boottime_mark);
+
+/// def boottime() -> Tuple[int, ...]:
+///     """
+///     Returns the milliseconds since the boardloader started at which each
+///     stage of the last cold boot was reached, up to the Python apps.
+///     Unreached stages, and all stages on the emulator and in production
+///     builds, are 0.
+///     """
+STATIC mp_obj_t mod_trezorutils_boottime(void) {
+  mp_obj_t items[BOOTTIME_COUNT];
+  for (int i = 0; i < BOOTTIME_COUNT; i++) {
+#ifndef TREZOR_EMULATOR
+    items[i] = mp_obj_new_int_from_uint(boottime_get(i));
+#else
+    items[i] = MP_OBJ_NEW_SMALL_INT(0);
+#endif
+  }
+  return mp_obj_new_tuple(BOOTTIME_COUNT, items);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(mod_trezorutils_boottime_obj,
+                                 mod_trezorutils_boottime);
+
+/// def cycles() -> int:
+///     """
+///     Returns the CPU cycle counter, which wraps after 2^32 cycles. The
+///     emulator returns nanoseconds of the host clock instead.
+///     """
+STATIC mp_obj_t mod_trezorutils_cycles(void) {
+  return mp_obj_new_int_from_uint(trace_cycles());
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(mod_trezorutils_cycles_obj,
+                                 mod_trezorutils_cycles);
+
+/// def trace(tag: int, arg: int = 0) -> None:
+///     """
+///     Pushes an event into the trace ring buffer, see `trace_dump()`. The
+///     tag must be lower than 0x8000. Does nothing unless built with TRACE=1.
+///     """
+STATIC mp_obj_t mod_trezorutils_trace(size_t n_args, const mp_obj_t *args) {
+  uint32_t tag = trezor_obj_get_uint(args[0]);
+  uint32_t arg = (n_args > 1) ? trezor_obj_get_uint(args[1]) : 0;
+  if (tag >= TRACE_PYTHON) {
+    mp_raise_ValueError("Invalid tag");
+  }
+  trace_event(TRACE_PYTHON + tag, arg);
+  return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_trezorutils_trace_obj, 1, 2,
+                                           mod_trezorutils_trace);
+
+/// def trace_dump(clear: bool = False) -> bytes:
+///     """
+///     Returns the events in the trace ring buffer, oldest first, as packed
+///     little endian (cycles: uint32, tag: uint16, arg: uint16) records.
+///     Events pushed from Python have 0x8000 added to their tag. The buffer
+///     is emptied afterwards if `clear` is set.
+///     """
+STATIC mp_obj_t mod_trezorutils_trace_dump(size_t n_args,
+                                           const mp_obj_t *args) {
+  vstr_t vstr;
+  vstr_init_len(&vstr, TRACE_SIZE * sizeof(trace_event_t));
+  // both the device and the emulator hosts are little endian
+  size_t n = trace_read((trace_event_t *)vstr.buf, TRACE_SIZE);
+  vstr.len = n * sizeof(trace_event_t);
+  if (n_args > 0 && args[0] == mp_const_true) {
+    trace_clear();
+  }
+  return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_trezorutils_trace_dump_obj, 0,
+                                           1, mod_trezorutils_trace_dump);
+
 #define PASTER(s) MP_QSTR_##s
 #define MP_QSTR(s) PASTER(s)
 
@@ -115,12 +290,25 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_trezorutils_halt_obj, 0, 1,
 /// MODEL: str
 /// EMULATOR: bool
 /// BITCOIN_ONLY: bool
+/// BOOTTIME_STORAGE_UNLOCKED: int
+/// BOOTTIME_APPS_IMPORTED: int
 
 STATIC const mp_rom_map_elem_t mp_module_trezorutils_globals_table[] = {
     {MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_trezorutils)},
     {MP_ROM_QSTR(MP_QSTR_consteq), MP_ROM_PTR(&mod_trezorutils_consteq_obj)},
     {MP_ROM_QSTR(MP_QSTR_memcpy), MP_ROM_PTR(&mod_trezorutils_memcpy_obj)},
+    {MP_ROM_QSTR(MP_QSTR_write_uint),
+     MP_ROM_PTR(&mod_trezorutils_write_uint_obj)},
+    {MP_ROM_QSTR(MP_QSTR_match_path),
+     MP_ROM_PTR(&mod_trezorutils_match_path_obj)},
     {MP_ROM_QSTR(MP_QSTR_halt), MP_ROM_PTR(&mod_trezorutils_halt_obj)},
+    {MP_ROM_QSTR(MP_QSTR_boottime_mark),
+     MP_ROM_PTR(&mod_trezorutils_boottime_mark_obj)},
+    {MP_ROM_QSTR(MP_QSTR_boottime), MP_ROM_PTR(&mod_trezorutils_boottime_obj)},
+    {MP_ROM_QSTR(MP_QSTR_cycles), MP_ROM_PTR(&mod_trezorutils_cycles_obj)},
+    {MP_ROM_QSTR(MP_QSTR_trace), MP_ROM_PTR(&mod_trezorutils_trace_obj)},
+    {MP_ROM_QSTR(MP_QSTR_trace_dump),
+     MP_ROM_PTR(&mod_trezorutils_trace_dump_obj)},
     // various built-in constants
     {MP_ROM_QSTR(MP_QSTR_GITREV), MP_ROM_QSTR(MP_QSTR(GITREV))},
     {MP_ROM_QSTR(MP_QSTR_VERSION_MAJOR), MP_ROM_INT(VERSION_MAJOR)},
@@ -137,6 +325,10 @@ STATIC const mp_rom_map_elem_t mp_module_trezorutils_globals_table[] = {
 #else
     {MP_ROM_QSTR(MP_QSTR_BITCOIN_ONLY), mp_const_false},
 #endif
+    {MP_ROM_QSTR(MP_QSTR_BOOTTIME_STORAGE_UNLOCKED),
+     MP_ROM_INT(BOOTTIME_STORAGE_UNLOCKED)},
+    {MP_ROM_QSTR(MP_QSTR_BOOTTIME_APPS_IMPORTED),
+     MP_ROM_INT(BOOTTIME_APPS_IMPORTED)},
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_trezorutils_globals,
@@ -75,4 +75,57 @@ static inline uint8_t trezor_obj_get_uint8(mp_obj_t obj) {
   return u;
 }
 
+// Casts int object into uint64_t, without any conversions. Raises if object is
+// not int or if it does not fit into 64 bits (or is less than 0).
+static inline uint64_t trezor_obj_get_uint64(mp_const_obj_t obj) {
+  if (MP_OBJ_IS_SMALL_INT(obj)) {
+    mp_int_t i = MP_OBJ_SMALL_INT_VALUE(obj);
+    if (i < 0) {
+      mp_raise_msg(&mp_type_OverflowError,
+                   "value does not fit into unsigned int type");
+    }
+    return i;
+  } else if (MP_OBJ_IS_TYPE(obj, &mp_type_int)) {
+    byte buff[8];
+    uint64_t u = 0;
+    mp_obj_int_t *self = MP_OBJ_TO_PTR(obj);
+    if (self->mpz.neg || mpz_max_num_bits(&self->mpz) > 64) {
+      mp_raise_msg(&mp_type_OverflowError,
+                   "value does not fit into unsigned int type");
+    }
+    mp_obj_int_to_bytes_impl((mp_obj_t)obj, true, sizeof(buff), buff);
+    for (size_t i = 0; i < sizeof(buff); i++) {
+      u = (u << 8) | buff[i];
+    }
+    return u;
+  } else {
+    mp_raise_TypeError("value is not int");
+  }
+}
+
+// Gets the read buffer of args[0], narrowed by the optional offset args[1] and
+// length args[2] (None means up to the end). The buffer is not copied. Raises
+// if the range does not fit into the buffer.
+static inline void trezor_obj_get_buffer_range(size_t n_args,
+                                               const mp_obj_t *args,
+                                               mp_buffer_info_t *bufinfo) {
+  mp_get_buffer_raise(args[0], bufinfo, MP_BUFFER_READ);
+  if (n_args < 2) {
+    return;
+  }
+  mp_uint_t offset = trezor_obj_get_uint(args[1]);
+  if (offset > bufinfo->len) {
+    mp_raise_ValueError("Illegal offset/length");
+  }
+  mp_uint_t length = bufinfo->len - offset;
+  if (n_args >= 3 && args[2] != mp_const_none) {
+    length = trezor_obj_get_uint(args[2]);
+    if (length > bufinfo->len - offset) {
+      mp_raise_ValueError("Illegal offset/length");
+    }
+  }
+  bufinfo->buf = (uint8_t *)bufinfo->buf + offset;
+  bufinfo->len = length;
+}
+
 #endif
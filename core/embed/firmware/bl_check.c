@@ -99,11 +99,9 @@ void check_and_replace_bootloader(void) {
       (const uint32_t)&_binary_embed_firmware_bootloader_bin_size;
   ensure(flash_erase(FLASH_SECTOR_BOOTLOADER), NULL);
   ensure(flash_unlock_write(), NULL);
-  for (int i = 0; i < len / sizeof(uint32_t); i++) {
-    ensure(flash_write_word(FLASH_SECTOR_BOOTLOADER, i * sizeof(uint32_t),
-                            data[i]),
-           NULL);
-  }
+  ensure(flash_write_block(FLASH_SECTOR_BOOTLOADER, 0, data,
+                           len / sizeof(uint32_t)),
+         NULL);
   for (int i = len / sizeof(uint32_t); i < 128 * 1024 / sizeof(uint32_t); i++) {
     ensure(flash_write_word(FLASH_SECTOR_BOOTLOADER, i * sizeof(uint32_t),
                             0x00000000),
@@ -36,7 +36,9 @@
 #include "ports/stm32/pendsv.h"
 
 #include "bl_check.h"
+#include "boottime.h"
 #include "common.h"
+#include "crc32.h"
 #include "display.h"
 #include "flash.h"
 #include "mpu.h"
@@ -49,6 +51,8 @@
 #include "touch.h"
 
 int main(void) {
+  boottime_mark(BOOTTIME_FIRMWARE);
+
   // initialize pseudo-random number generator
   drbg_init();
 #ifdef RDI
@@ -70,6 +74,7 @@ int main(void) {
 
   // Init peripherals
   pendsv_init();
+  crc32_init();
 
 #if TREZOR_MODEL == 1
   display_init();
@@ -81,6 +86,8 @@ int main(void) {
   touch_init();
   touch_power_on();
 
+  boottime_mark(BOOTTIME_FIRMWARE_INIT);
+
   // jump to unprivileged mode
   // http://infocenter.arm.com/help/topic/com.arm.doc.dui0552a/CHDBIBGJ.html
   __asm__ volatile("msr control, %0" ::"r"(0x1));
@@ -109,6 +116,7 @@ int main(void) {
       MP_OBJ_NEW_QSTR(MP_QSTR_));  // current dir (or base dir of the script)
 
   // Execute the main script
+  svc_boottime_mark(BOOTTIME_MICROPYTHON);
   printf("CORE: Executing main script\n");
   pyexec_frozen_module("main.py");
 
@@ -162,6 +170,12 @@ void SVC_C_Handler(uint32_t *stack) {
     case SVC_SET_PRIORITY:
       NVIC_SetPriority(stack[0], stack[1]);
       break;
+    case SVC_BOOTTIME_MARK:
+      boottime_mark(stack[0]);
+      break;
+    case SVC_CYCLES:
+      stack[0] = DWT->CYCCNT;
+      break;
     default:
       stack[0] = 0xffffffff;
       break;
@@ -31,31 +31,48 @@
 #include "sbu.h"
 #include "sdcard.h"
 #include "secbool.h"
+#include "sha2.h"
 #include "touch.h"
 
 static void progress_callback(int pos, int len) { display_printf("."); }
 
-static void flash_from_sdcard(uint8_t sector, uint32_t source,
-                              uint32_t length) {
-  static uint32_t buf[SDCARD_BLOCK_SIZE / sizeof(uint32_t)];
+// The image is copied in chunks of several SD card blocks. While one chunk is
+// programmed and hashed, the SD card reads the next one into the other buffer
+// with DMA, so the copy runs at the speed of the slower of the two.
+#define REFLASH_CHUNK_SIZE (8 * SDCARD_BLOCK_SIZE)
+
+static void flash_from_sdcard(uint8_t sector, uint32_t source, uint32_t length,
+                              SHA256_CTX *ctx) {
+  static uint32_t buf[2][REFLASH_CHUNK_SIZE / sizeof(uint32_t)];
 
   ensure(sectrue * (source % SDCARD_BLOCK_SIZE == 0),
          "source not a multiple of block size");
-  ensure(sectrue * (length % SDCARD_BLOCK_SIZE == 0),
-         "length not a multiple of block size");
-
-  for (uint32_t i = 0; i < length / SDCARD_BLOCK_SIZE; i++) {
-    display_printf("read %d\n", (unsigned int)(i + source / SDCARD_BLOCK_SIZE));
-
-    ensure(sdcard_read_blocks(buf, i + source / SDCARD_BLOCK_SIZE, 1),
-           "sdcard_read_blocks");
-
-    for (uint32_t j = 0; j < SDCARD_BLOCK_SIZE / sizeof(uint32_t); j++) {
-      ensure(flash_write_word(
-                 sector, i * SDCARD_BLOCK_SIZE + j * sizeof(uint32_t), buf[j]),
-             NULL);
+  ensure(sectrue * (length % REFLASH_CHUNK_SIZE == 0),
+         "length not a multiple of chunk size");
+
+  const uint32_t chunks = length / REFLASH_CHUNK_SIZE;
+  const uint32_t chunk_blocks = REFLASH_CHUNK_SIZE / SDCARD_BLOCK_SIZE;
+  const uint32_t first_block = source / SDCARD_BLOCK_SIZE;
+
+  ensure(sdcard_read_blocks_start(buf[0], first_block, chunk_blocks),
+         "sdcard_read_blocks");
+  for (uint32_t i = 0; i < chunks; i++) {
+    ensure(sdcard_read_blocks_finish(), "sdcard_read_blocks");
+    const uint32_t *data = buf[i % 2];
+    if (i + 1 < chunks) {
+      ensure(sdcard_read_blocks_start(buf[(i + 1) % 2],
+                                      first_block + (i + 1) * chunk_blocks,
+                                      chunk_blocks),
+             "sdcard_read_blocks");
     }
+
+    display_printf(".");
+    ensure(flash_write_block(sector, i * REFLASH_CHUNK_SIZE, data,
+                             REFLASH_CHUNK_SIZE / sizeof(uint32_t)),
+           NULL);
+    sha256_Update(ctx, (const uint8_t *)data, REFLASH_CHUNK_SIZE);
   }
+  display_printf("\n");
 }
 
 int main(void) {
@@ -90,13 +107,23 @@ int main(void) {
 #define BOARDLOADER_TOTAL_SIZE (3 * BOARDLOADER_CHUNK_SIZE)
 #define BOOTLOADER_TOTAL_SIZE (128 * 1024)
 
+  // hash of the whole copied image, to be compared with the one of the image
+  // file (sha256sum of its first 176 KiB)
+  SHA256_CTX ctx;
+  sha256_Init(&ctx);
+
   flash_from_sdcard(FLASH_SECTOR_BOARDLOADER_START, 0 * BOARDLOADER_CHUNK_SIZE,
-                    BOARDLOADER_CHUNK_SIZE);
-  flash_from_sdcard(1, 1 * BOARDLOADER_CHUNK_SIZE, BOARDLOADER_CHUNK_SIZE);
+                    BOARDLOADER_CHUNK_SIZE, &ctx);
+  flash_from_sdcard(1, 1 * BOARDLOADER_CHUNK_SIZE, BOARDLOADER_CHUNK_SIZE,
+                    &ctx);
   flash_from_sdcard(FLASH_SECTOR_BOARDLOADER_END, 2 * BOARDLOADER_CHUNK_SIZE,
-                    BOARDLOADER_CHUNK_SIZE);
+                    BOARDLOADER_CHUNK_SIZE, &ctx);
   flash_from_sdcard(FLASH_SECTOR_BOOTLOADER, BOARDLOADER_TOTAL_SIZE,
-                    BOOTLOADER_TOTAL_SIZE);
+                    BOOTLOADER_TOTAL_SIZE, &ctx);
+
+  char hash[SHA256_DIGEST_STRING_LENGTH];
+  sha256_End(&ctx, hash);
+  display_printf("sha256 %s\n", hash);
 
   display_printf("done\n");
   sdcard_power_off();
@@ -0,0 +1,67 @@
+/*
+ * This file is part of the Trezor project, https://trezor.io/
+ *
+ * Copyright (c) SatoshiLabs
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include STM32_HAL_H
+
+#include "boottime.h"
+
+// The SysTick millisecond counter restarts in every stage, so each one adds
+// its ticks to this base. A stage entered by a jump sets the base so that it
+// continues from the last mark of the previous one. Unlike the cycle counter,
+// which wraps after 25 s, the ticks stay valid across a long PIN entry.
+static uint32_t boottime_base = 0;
+
+static void boottime_enable_backup(void) {
+  __HAL_RCC_PWR_CLK_ENABLE();
+  PWR->CR |= PWR_CR_DBP;  // allow writes to the backup domain
+}
+
+void boottime_start(void) {
+  boottime_enable_backup();
+  for (int i = 0; i < BOOTTIME_COUNT; i++) {
+    (&RTC->BKP0R)[i] = 0;
+  }
+}
+
+void boottime_mark(uint32_t stage) {
+  if (stage >= BOOTTIME_COUNT) {
+    return;
+  }
+  boottime_enable_backup();
+  if (stage == BOOTTIME_BOARDLOADER || stage == BOOTTIME_BOOTLOADER ||
+      stage == BOOTTIME_FIRMWARE) {
+    uint32_t last = 0;
+    for (uint32_t i = 0; i < stage; i++) {
+      if ((&RTC->BKP0R)[i] > last) {
+        last = (&RTC->BKP0R)[i];
+      }
+    }
+    boottime_base = last - HAL_GetTick();
+  }
+  // 0 means not reached
+  uint32_t ms = boottime_base + HAL_GetTick();
+  (&RTC->BKP0R)[stage] = (ms != 0) ? ms : 1;
+}
+
+uint32_t boottime_get(uint32_t stage) {
+  if (stage >= BOOTTIME_COUNT) {
+    return 0;
+  }
+  return (&RTC->BKP0R)[stage];
+}
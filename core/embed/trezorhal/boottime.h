@@ -0,0 +1,67 @@
+/*
+ * This file is part of the Trezor project, https://trezor.io/
+ *
+ * Copyright (c) SatoshiLabs
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TREZORHAL_BOOTTIME_H
+#define TREZORHAL_BOOTTIME_H
+
+#include <stdint.h>
+
+// Fixed points of the cold boot, from the boardloader to the Python apps.
+// Each one stores the milliseconds since the boardloader started into an RTC
+// backup register, which, unlike RAM, is not wiped when one stage jumps to the
+// next. Only non-production builds record them.
+typedef enum {
+  BOOTTIME_BOARDLOADER = 0,            // boardloader main() entered
+  BOOTTIME_BOARDLOADER_CHECKED,        // bootloader image verified
+  BOOTTIME_BOOTLOADER,                 // bootloader main() entered
+  BOOTTIME_BOOTLOADER_INIT,            // bootloader peripherals initialized
+  BOOTTIME_BOOTLOADER_TOUCH_WAIT,      // touch detection delay over
+  BOOTTIME_BOOTLOADER_VENDOR_HEADER,   // vendor header checked
+  BOOTTIME_BOOTLOADER_IMAGE_HEADER,    // firmware header checked
+  BOOTTIME_BOOTLOADER_IMAGE_CONTENTS,  // firmware image hashed
+  BOOTTIME_BOOTLOADER_CHECKED,         // firmware image verified again
+  BOOTTIME_BOOTLOADER_BOOT_SCREEN,     // vendor boot screen done
+  BOOTTIME_FIRMWARE,                   // firmware main() entered
+  BOOTTIME_FIRMWARE_INIT,              // firmware peripherals initialized
+  BOOTTIME_MICROPYTHON,                // interpreter started, main.py not run
+  BOOTTIME_STORAGE_UNLOCKED,           // boot.py unlocked the storage
+  BOOTTIME_APPS_IMPORTED,              // main.py imported and booted the apps
+  BOOTTIME_COUNT,
+} boottime_stage_t;
+
+#if PRODUCTION
+
+static inline void boottime_start(void) {}
+static inline void boottime_mark(uint32_t stage) { (void)stage; }
+static inline uint32_t boottime_get(uint32_t stage) {
+  (void)stage;
+  return 0;
+}
+
+#else
+
+// Clears all stages. Called by the first stage.
+void boottime_start(void);
+void boottime_mark(uint32_t stage);
+// Returns the milliseconds of a stage, or 0 if it was not reached.
+uint32_t boottime_get(uint32_t stage);
+
+#endif
+
+#endif
@@ -0,0 +1,46 @@
+/*
+ * This file is part of the Trezor project, https://trezor.io/
+ *
+ * Copyright (c) SatoshiLabs
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include STM32_HAL_H
+
+#include "crc32.h"
+
+void crc32_init(void) {
+  // enable CRC peripheral clock
+  __HAL_RCC_CRC_CLK_ENABLE();
+}
+
+// The CRC unit computes the MSB-first CRC-32 with polynomial 0x04C11DB7
+// over 32-bit words, starting from 0xFFFFFFFF after reset. The zlib CRC32
+// is the same CRC bit-reflected, so words and state go through __RBIT.
+// Writing a word to DR xors it into the state before the 32 shift steps,
+// therefore the first write also replaces the reset value with `crc`.
+// `crc` and the return value are the uninverted zlib state, like in
+// checksum_crc32.
+uint32_t crc32_words(uint32_t crc, const uint32_t *words, size_t count) {
+  if (count == 0) {
+    return crc;
+  }
+  CRC->CR = CRC_CR_RESET;
+  CRC->DR = __RBIT(words[0]) ^ __RBIT(crc) ^ 0xFFFFFFFF;
+  for (size_t i = 1; i < count; i++) {
+    CRC->DR = __RBIT(words[i]);
+  }
+  return __RBIT(CRC->DR);
+}
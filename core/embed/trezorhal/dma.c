@@ -97,7 +97,26 @@ static const DMA_InitTypeDef dma_init_struct_sdio = {
 #define DMA1_ENABLE_MASK (0x00ff) // Bits in dma_enable_mask corresponding to DMA1
 #define DMA2_ENABLE_MASK (0xff00) // Bits in dma_enable_mask corresponding to DMA2
 
+// Parameters to dma_nohal_init() for pushing pixels to the display. Only DMA2
+// can do memory-to-memory transfers. The source (peripheral) increment is
+// passed in the config, the destination is the fixed display data address.
+static const DMA_InitTypeDef dma_init_struct_display = {
+    .Channel             = 0,
+    .Direction           = 0,
+    .PeriphInc           = DMA_PINC_DISABLE,
+    .MemInc              = DMA_MINC_DISABLE,
+    .PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD,
+    .MemDataAlignment    = DMA_MDATAALIGN_HALFWORD,
+    .Mode                = DMA_NORMAL,
+    .Priority            = DMA_PRIORITY_HIGH,
+    .FIFOMode            = DMA_FIFOMODE_ENABLE,
+    .FIFOThreshold       = DMA_FIFO_THRESHOLD_HALFFULL,
+    .MemBurst            = DMA_MBURST_SINGLE,
+    .PeriphBurst         = DMA_PBURST_SINGLE,
+};
+
 const dma_descr_t dma_SDIO_0 = { DMA2_Stream3, DMA_CHANNEL_4, dma_id_11,  &dma_init_struct_sdio };
+const dma_descr_t dma_DISPLAY = { DMA2_Stream0, DMA_CHANNEL_0, dma_id_8,  &dma_init_struct_display };
 
 static const uint8_t dma_irqn[NSTREAM] = {
     DMA1_Stream0_IRQn,
@@ -264,6 +283,71 @@ void dma_invalidate_channel(const dma_descr_t *dma_descr) {
         }
     }
 }
+void dma_nohal_init(const dma_descr_t *descr, uint32_t config) {
+    DMA_Stream_TypeDef *dma = descr->instance;
+
+    // Enable the DMA peripheral
+    dma_enable_clock(descr->id);
+
+    // Set main configuration register
+    const DMA_InitTypeDef *init = descr->init;
+    dma->CR =
+        descr->sub_instance             // CHSEL
+        | init->MemBurst                // MBURST
+        | init->PeriphBurst             // PBURST
+        | init->Priority                // PL
+        | init->MemInc                  // MINC
+        | init->PeriphInc               // PINC
+        | config                        // MSIZE | PSIZE | PINC | CIRC | DIR
+        ;
+
+    // Set FIFO control register
+    dma->FCR =
+        init->FIFOMode                  // DMDIS
+        | init->FIFOThreshold           // FTH
+        ;
+}
+
+void dma_nohal_deinit(const dma_descr_t *descr) {
+    DMA_Stream_TypeDef *dma = descr->instance;
+    dma->CR &= ~DMA_SxCR_EN;
+    dma_nohal_wait(descr);
+    dma->NDTR = 0;
+    dma_disable_clock(descr->id);
+}
+
+void dma_nohal_start(const dma_descr_t *descr, uint32_t src_addr, uint32_t dst_addr, uint16_t len) {
+    // The event flags of the stream must be cleared before it is enabled.
+    static const uint8_t flag_shift[4] = {0, 6, 16, 22};
+    DMA_TypeDef *controller = (descr->id < NSTREAMS_PER_CONTROLLER) ? DMA1 : DMA2;
+    const uint32_t stream = descr->id % NSTREAMS_PER_CONTROLLER;
+    const uint32_t flags = 0x3dU << flag_shift[stream % 4];
+    if (stream < 4) {
+        controller->LIFCR = flags;
+    } else {
+        controller->HIFCR = flags;
+    }
+
+    DMA_Stream_TypeDef *dma = descr->instance;
+    dma->CR &= ~DMA_SxCR_DBM;
+    dma->NDTR = len;
+    if ((dma->CR & DMA_SxCR_DIR) == DMA_MEMORY_TO_PERIPH) {
+        dma->PAR = dst_addr;
+        dma->M0AR = src_addr;
+    } else {
+        // peripheral to memory and memory to memory read from PAR
+        dma->M0AR = dst_addr;
+        dma->PAR = src_addr;
+    }
+    dma->CR |= DMA_SxCR_EN;
+}
+
+void dma_nohal_wait(const dma_descr_t *descr) {
+    // The stream disables itself once the transfer completes.
+    while (descr->instance->CR & DMA_SxCR_EN) {
+    }
+}
+
 // Called from the SysTick handler
 // We use LSB of tick to select which controller to process
 static void dma_idle_handler(uint32_t tick) {
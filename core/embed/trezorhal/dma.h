@@ -33,6 +33,7 @@
 typedef struct _dma_descr_t dma_descr_t;
 
 extern const dma_descr_t dma_SDIO_0;
+extern const dma_descr_t dma_DISPLAY;
 
 void dma_init(DMA_HandleTypeDef *dma, const dma_descr_t *dma_descr, uint32_t dir, void *data);
 void dma_init_handle(DMA_HandleTypeDef *dma, const dma_descr_t *dma_descr, uint32_t dir, void *data);
@@ -42,5 +43,6 @@ void dma_invalidate_channel(const dma_descr_t *dma_descr);
 void dma_nohal_init(const dma_descr_t *descr, uint32_t config);
 void dma_nohal_deinit(const dma_descr_t *descr);
 void dma_nohal_start(const dma_descr_t *descr, uint32_t src_addr, uint32_t dst_addr, uint16_t len);
+void dma_nohal_wait(const dma_descr_t *descr);
 
 #endif // MICROPY_INCLUDED_STM32_DMA_H
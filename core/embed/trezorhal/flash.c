@@ -23,6 +23,7 @@
 
 #include "common.h"
 #include "flash.h"
+#include "trace.h"
 
 // see docs/memory.md for more information
 
@@ -106,8 +107,25 @@ const void *flash_get_address(uint8_t sector, uint32_t offset, uint32_t size) {
   return (const void *)addr;
 }
 
+// The ART data cache is not kept coherent with erasing and programming, so it
+// stays off except around long read-only passes such as hashing an image.
+// Without it every data load from flash waits the full latency.
+void flash_read_cache_enable(void) {
+  FLASH->ACR &= ~FLASH_ACR_DCEN;
+  FLASH->ACR |= FLASH_ACR_DCRST;  // drop lines cached before the last write
+  FLASH->ACR &= ~FLASH_ACR_DCRST;
+  FLASH->ACR |= FLASH_ACR_DCEN;
+}
+
+void flash_read_cache_disable(void) {
+  FLASH->ACR &= ~FLASH_ACR_DCEN;
+  FLASH->ACR |= FLASH_ACR_DCRST;
+  FLASH->ACR &= ~FLASH_ACR_DCRST;
+}
+
 secbool flash_erase_sectors(const uint8_t *sectors, int len,
                             void (*progress)(int pos, int len)) {
+  trace_event(TRACE_FLASH_ERASE, TRACE_BEGIN);
   ensure(flash_unlock_write(), NULL);
   FLASH_EraseInitTypeDef EraseInitStruct;
   EraseInitStruct.TypeErase = FLASH_TYPEERASE_SECTORS;
@@ -121,6 +139,7 @@ secbool flash_erase_sectors(const uint8_t *sectors, int len,
     uint32_t SectorError;
     if (HAL_FLASHEx_Erase(&EraseInitStruct, &SectorError) != HAL_OK) {
       ensure(flash_lock_write(), NULL);
+      trace_event(TRACE_FLASH_ERASE, TRACE_END);
       return secfalse;
     }
     // check whether the sector was really deleted (contains only 0xFF)
@@ -129,6 +148,7 @@ secbool flash_erase_sectors(const uint8_t *sectors, int len,
     for (uint32_t addr = addr_start; addr < addr_end; addr += 4) {
       if (*((const uint32_t *)addr) != 0xFFFFFFFF) {
         ensure(flash_lock_write(), NULL);
+        trace_event(TRACE_FLASH_ERASE, TRACE_END);
         return secfalse;
       }
     }
@@ -137,9 +157,55 @@ secbool flash_erase_sectors(const uint8_t *sectors, int len,
     }
   }
   ensure(flash_lock_write(), NULL);
+  trace_event(TRACE_FLASH_ERASE, TRACE_END);
   return sectrue;
 }
 
+// Starts erasing a sector and returns without waiting for it. The flash stays
+// unlocked until flash_erase_finish() is called for the same sector. Nothing
+// may read the bank being erased in the meantime, so only sectors of the other
+// bank than the running code are worth erasing this way.
+secbool flash_erase_start(uint8_t sector) {
+  if (sector >= FLASH_SECTOR_COUNT) {
+    return secfalse;
+  }
+  ensure(flash_unlock_write(), NULL);
+  while (FLASH->SR & FLASH_SR_BSY) {
+  }
+  // sectors of the second bank are numbered from 16 in FLASH_CR_SNB
+  const uint32_t snb =
+      (sector < FLASH_SECTOR_BANK2_START) ? sector : sector + 4;
+  FLASH->CR = (FLASH->CR & ~(FLASH_CR_PSIZE | FLASH_CR_SNB)) |
+              FLASH_PSIZE_WORD | FLASH_CR_SER | (snb << FLASH_CR_SNB_Pos);
+  FLASH->CR |= FLASH_CR_STRT;
+  return sectrue;
+}
+
+secbool flash_erase_finish(uint8_t sector) {
+  if (sector >= FLASH_SECTOR_COUNT) {
+    return secfalse;
+  }
+  while (FLASH->SR & FLASH_SR_BSY) {
+  }
+  FLASH->CR &= ~(FLASH_CR_SER | FLASH_CR_SNB);
+  secbool ok = sectrue;
+  if (FLASH->SR & (FLASH_SR_PGSERR | FLASH_SR_PGPERR | FLASH_SR_PGAERR |
+                   FLASH_SR_WRPERR)) {
+    ok = secfalse;
+  }
+  // check whether the sector was really deleted (contains only 0xFF)
+  const uint32_t addr_start = FLASH_SECTOR_TABLE[sector],
+                 addr_end = FLASH_SECTOR_TABLE[sector + 1];
+  for (uint32_t addr = addr_start; addr < addr_end; addr += 4) {
+    if (*((const uint32_t *)addr) != 0xFFFFFFFF) {
+      ok = secfalse;
+      break;
+    }
+  }
+  ensure(flash_lock_write(), NULL);
+  return ok;
+}
+
 secbool flash_write_byte(uint8_t sector, uint32_t offset, uint8_t data) {
   uint32_t address = (uint32_t)flash_get_address(sector, offset, 1);
   if (address == 0) {
@@ -177,6 +243,45 @@ secbool flash_write_word(uint8_t sector, uint32_t offset, uint32_t data) {
   return sectrue;
 }
 
+secbool flash_write_block(uint8_t sector, uint32_t offset,
+                          const uint32_t *data, uint32_t count) {
+  if (offset % sizeof(uint32_t)) {  // we write only at 4-byte boundary
+    return secfalse;
+  }
+  volatile uint32_t *address = (volatile uint32_t *)flash_get_address(
+      sector, offset, count * sizeof(uint32_t));
+  if (address == NULL) {
+    return secfalse;
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    if (data[i] != (data[i] & address[i])) {
+      return secfalse;
+    }
+  }
+  // Program in x32 parallelism, which matches FLASH_VOLTAGE_RANGE_3. Writes
+  // issued while the previous word is being programmed stall the bus until
+  // the flash is ready, so the busy flag is polled only once at the end.
+  while (FLASH->SR & FLASH_SR_BSY) {
+  }
+  FLASH->CR = (FLASH->CR & ~FLASH_CR_PSIZE) | FLASH_PSIZE_WORD | FLASH_CR_PG;
+  for (uint32_t i = 0; i < count; i++) {
+    address[i] = data[i];
+  }
+  while (FLASH->SR & FLASH_SR_BSY) {
+  }
+  FLASH->CR &= ~FLASH_CR_PG;
+  if (FLASH->SR & (FLASH_SR_PGSERR | FLASH_SR_PGPERR | FLASH_SR_PGAERR |
+                   FLASH_SR_WRPERR)) {
+    return secfalse;
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    if (data[i] != address[i]) {
+      return secfalse;
+    }
+  }
+  return sectrue;
+}
+
 #define FLASH_OTP_LOCK_BASE 0x1FFF7A00U
 
 secbool flash_otp_read(uint8_t block, uint8_t offset, uint8_t *data,
@@ -72,6 +72,10 @@
 //                                          22
 #define FLASH_SECTOR_FIRMWARE_EXTRA_END 23
 
+// first sector of the second flash bank; code running from the first bank
+// keeps running while a sector of the second bank is erased
+#define FLASH_SECTOR_BANK2_START 12
+
 #define BOOTLOADER_SECTORS_COUNT (1)
 #define STORAGE_SECTORS_COUNT (2)
 #define FIRMWARE_SECTORS_COUNT (6 + 7)
@@ -96,13 +100,22 @@ secbool __wur flash_lock_write(void);
 
 const void *flash_get_address(uint8_t sector, uint32_t offset, uint32_t size);
 
+void flash_read_cache_enable(void);
+void flash_read_cache_disable(void);
+
 secbool __wur flash_erase_sectors(const uint8_t *sectors, int len,
                                   void (*progress)(int pos, int len));
+secbool __wur flash_erase_start(uint8_t sector);
+secbool __wur flash_erase_finish(uint8_t sector);
 static inline secbool flash_erase(uint8_t sector) {
   return flash_erase_sectors(&sector, 1, NULL);
 }
 secbool __wur flash_write_byte(uint8_t sector, uint32_t offset, uint8_t data);
 secbool __wur flash_write_word(uint8_t sector, uint32_t offset, uint32_t data);
+// Writes count words starting at the word-aligned offset. Faster than calling
+// flash_write_word() for each word, as the flash is kept programming.
+secbool __wur flash_write_block(uint8_t sector, uint32_t offset,
+                                const uint32_t *data, uint32_t count);
 
 #define FLASH_OTP_NUM_BLOCKS 16
 #define FLASH_OTP_BLOCK_SIZE 32
@@ -187,8 +187,9 @@ secbool check_single_hash(const uint8_t *const hash, const uint8_t *const data,
   return sectrue * (0 == memcmp(h, hash, BLAKE2S_DIGEST_LENGTH));
 }
 
-secbool check_image_contents(const image_header *const hdr, uint32_t firstskip,
-                             const uint8_t *sectors, int blocks) {
+static secbool check_image_chunks(const image_header *const hdr,
+                                  uint32_t firstskip, const uint8_t *sectors,
+                                  int blocks) {
   if (0 == sectors || blocks < 1) {
     return secfalse;
   }
@@ -222,3 +223,12 @@ secbool check_image_contents(const image_header *const hdr, uint32_t firstskip,
   }
   return sectrue;
 }
+
+secbool check_image_contents(const image_header *const hdr, uint32_t firstskip,
+                             const uint8_t *sectors, int blocks) {
+  // the whole image is read once, in order, and hashing waits on every load
+  flash_read_cache_enable();
+  secbool ret = check_image_chunks(hdr, firstskip, sectors, blocks);
+  flash_read_cache_disable();
+  return ret;
+}
@@ -32,9 +32,14 @@ void rng_init(void) {
   RNG->CR = RNG_CR_RNGEN;  // enable TRNG
 }
 
+static uint32_t stall_count = 0;
+
 uint32_t rng_read(const uint32_t previous, const uint32_t compare_previous) {
   uint32_t temp = previous;
   do {
+    if ((RNG->SR & (RNG_SR_SECS | RNG_SR_CECS | RNG_SR_DRDY)) != RNG_SR_DRDY) {
+      stall_count++;
+    }
     while ((RNG->SR & (RNG_SR_SECS | RNG_SR_CECS | RNG_SR_DRDY)) != RNG_SR_DRDY)
       ;              // wait until TRNG is ready
     temp = RNG->DR;  // read the data from the TRNG
@@ -56,3 +61,5 @@ uint32_t rng_get(void) {
   current = rng_read(previous, 1);
   return current;
 }
+
+uint32_t rng_stall_count(void) { return stall_count; }
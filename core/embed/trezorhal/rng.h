@@ -26,4 +26,7 @@ void rng_init(void);
 uint32_t rng_read(const uint32_t previous, const uint32_t compare_previous);
 uint32_t rng_get(void);
 
+// number of reads that had to wait for the TRNG to produce a word
+uint32_t rng_stall_count(void);
+
 #endif
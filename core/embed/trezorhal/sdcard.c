@@ -266,8 +266,14 @@ static HAL_StatusTypeDef sdcard_wait_finished(SD_HandleTypeDef *sd,
   return HAL_OK;
 }
 
-secbool sdcard_read_blocks(uint32_t *dest, uint32_t block_num,
-                           uint32_t num_blocks) {
+// The DMA handles and the IRQ priority of a read started by
+// sdcard_read_blocks_start(), they must outlive the call.
+static DMA_HandleTypeDef sd_read_dma;
+static DMA_HandleTypeDef sd_read_dummy_dma;
+static uint32_t sd_read_basepri;
+
+secbool sdcard_read_blocks_start(uint32_t *dest, uint32_t block_num,
+                                 uint32_t num_blocks) {
   // check that SD card is initialised
   if (sd_handle.Instance == NULL) {
     return secfalse;
@@ -278,38 +284,51 @@ secbool sdcard_read_blocks(uint32_t *dest, uint32_t block_num,
     return secfalse;
   }
 
-  HAL_StatusTypeDef err = HAL_OK;
-
   // we must disable USB irqs to prevent MSC contention with SD card
   uint32_t basepri = raise_irq_pri(IRQ_PRI_OTG_FS);
 
-  DMA_HandleTypeDef sd_dma;
-  dma_init(&sd_dma, &SDMMC_DMA, DMA_PERIPH_TO_MEMORY, &sd_handle);
-  sd_handle.hdmarx = &sd_dma;
+  dma_init(&sd_read_dma, &SDMMC_DMA, DMA_PERIPH_TO_MEMORY, &sd_handle);
+  sd_handle.hdmarx = &sd_read_dma;
 
   // we need to assign hdmatx even though it's unused
   // because STMHAL tries to access its error code in SD_DMAError()
   // even though it shouldn't :-/
   // this will get removed eventually when we update to new STMHAL
-  DMA_HandleTypeDef dummy_dma;
-  memset(&dummy_dma, 0, sizeof(dummy_dma));
-  sd_handle.hdmatx = &dummy_dma;
+  memset(&sd_read_dummy_dma, 0, sizeof(sd_read_dummy_dma));
+  sd_handle.hdmatx = &sd_read_dummy_dma;
 
   sdcard_reset_periph();
-  err =
-      HAL_SD_ReadBlocks_DMA(&sd_handle, (uint8_t *)dest, block_num, num_blocks);
-  if (err == HAL_OK) {
-    err = sdcard_wait_finished(&sd_handle, 5000);
+  if (HAL_SD_ReadBlocks_DMA(&sd_handle, (uint8_t *)dest, block_num,
+                            num_blocks) != HAL_OK) {
+    dma_deinit(&SDMMC_DMA);
+    sd_handle.hdmarx = NULL;
+    restore_irq_pri(basepri);
+    return secfalse;
   }
 
+  sd_read_basepri = basepri;
+  return sectrue;
+}
+
+secbool sdcard_read_blocks_finish(void) {
+  HAL_StatusTypeDef err = sdcard_wait_finished(&sd_handle, 5000);
+
   dma_deinit(&SDMMC_DMA);
   sd_handle.hdmarx = NULL;
 
-  restore_irq_pri(basepri);
+  restore_irq_pri(sd_read_basepri);
 
   return sectrue * (err == HAL_OK);
 }
 
+secbool sdcard_read_blocks(uint32_t *dest, uint32_t block_num,
+                           uint32_t num_blocks) {
+  if (sectrue != sdcard_read_blocks_start(dest, block_num, num_blocks)) {
+    return secfalse;
+  }
+  return sdcard_read_blocks_finish();
+}
+
 secbool sdcard_write_blocks(const uint32_t *src, uint32_t block_num,
                             uint32_t num_blocks) {
   // check that SD card is initialised
@@ -58,6 +58,12 @@ secbool __wur sdcard_is_present(void);
 uint64_t sdcard_get_capacity_in_bytes(void);
 secbool __wur sdcard_read_blocks(uint32_t *dest, uint32_t block_num,
                                  uint32_t num_blocks);
+// Starts reading the blocks with DMA and returns before the transfer
+// completes. The caller must not touch dest nor call any other sdcard function
+// before sdcard_read_blocks_finish() returns.
+secbool __wur sdcard_read_blocks_start(uint32_t *dest, uint32_t block_num,
+                                       uint32_t num_blocks);
+secbool __wur sdcard_read_blocks_finish(void);
 secbool __wur sdcard_write_blocks(const uint32_t *src, uint32_t block_num,
                                   uint32_t num_blocks);
 
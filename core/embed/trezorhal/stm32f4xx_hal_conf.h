@@ -49,6 +49,10 @@
 /* Exported constants --------------------------------------------------------*/
 
 #ifdef STM32F427xx
+/* The OTG_HS core is wired to PB14/PB15 and runs on its embedded full-speed
+   PHY. There is no ULPI transceiver on the board and the F4 has no internal
+   high-speed PHY, so high speed (USE_USB_HS without USE_USB_HS_IN_FS) is only
+   possible on a board with an external ULPI PHY. */
 #define USE_USB_HS
 #define USE_USB_HS_IN_FS
 #elif STM32F405xx
@@ -1,8 +1,12 @@
 // supervisor call functions
 
+#include "boottime.h"
+
 #define SVC_ENABLE_IRQ 0
 #define SVC_DISABLE_IRQ 1
 #define SVC_SET_PRIORITY 2
+#define SVC_BOOTTIME_MARK 3
+#define SVC_CYCLES 4
 
 static inline uint32_t is_mode_unprivileged(void) {
   uint32_t r0;
@@ -38,3 +42,22 @@ static inline void svc_setpriority(uint32_t IRQn, uint32_t priority) {
     NVIC_SetPriority(IRQn, priority);
   }
 }
+
+static inline void svc_boottime_mark(uint32_t stage) {
+  if (is_mode_unprivileged()) {
+    register uint32_t r0 __asm__("r0") = stage;
+    __asm__ __volatile__("svc %0" ::"i"(SVC_BOOTTIME_MARK), "r"(r0) : "memory");
+  } else {
+    boottime_mark(stage);
+  }
+}
+
+static inline uint32_t svc_cycles(void) {
+  if (is_mode_unprivileged()) {
+    register uint32_t r0 __asm__("r0");
+    __asm__ __volatile__("svc %1" : "=r"(r0) : "i"(SVC_CYCLES) : "memory");
+    return r0;
+  } else {
+    return DWT->CYCCNT;
+  }
+}
@@ -1,7 +1,9 @@
 #include <string.h>
 
 #include "common.h"
+#include "irq.h"
 #include "secbool.h"
+#include "supervise.h"
 
 #define TOUCH_ADDRESS \
   (0x38U << 1)  // the HAL requires the 7-bit address to be shifted by one bit
@@ -18,6 +20,15 @@
 
 static I2C_HandleTypeDef i2c_handle;
 
+// Touch events are read by the interrupt of the CTP_INT line (PC4) and handed
+// to touch_read through this ring buffer. The interrupt only advances the
+// head and touch_read only advances the tail, so no locking is needed.
+#define TOUCH_QUEUE_SIZE 16  // power of two
+static volatile uint32_t touch_queue[TOUCH_QUEUE_SIZE];
+static volatile uint32_t touch_queue_head, touch_queue_tail;
+static volatile int touch_touching;
+static volatile int touch_i2c_stuck;
+
 static void touch_default_pin_state(void) {
   // set power off and other pins as per section 3.5 of FT6236 datasheet
   HAL_GPIO_WritePin(GPIOB, GPIO_PIN_10,
@@ -67,8 +78,10 @@ static void touch_active_pin_state(void) {
   GPIO_InitStructure.Pin = GPIO_PIN_6 | GPIO_PIN_7;
   HAL_GPIO_Init(GPIOB, &GPIO_InitStructure);
 
-  // PC4 capacitive touch panel module (CTPM) interrupt (INT) input
-  GPIO_InitStructure.Mode = GPIO_MODE_INPUT;
+  // PC4 capacitive touch panel module (CTPM) interrupt (INT) input, the CTPM
+  // pulls it low whenever it has a new touch report
+  __HAL_RCC_SYSCFG_CLK_ENABLE();
+  GPIO_InitStructure.Mode = GPIO_MODE_IT_FALLING;
   GPIO_InitStructure.Pull = GPIO_PULLUP;
   GPIO_InitStructure.Speed = GPIO_SPEED_FREQ_LOW;
   GPIO_InitStructure.Pin = GPIO_PIN_4;
@@ -189,9 +202,10 @@ void touch_power_on(void) {
   // I2C device interface configuration
   _i2c_init();
 
-  // set register 0xA4 G_MODE to interrupt polling mode (0x00). basically, CTPM
-  // keeps this input line (to PC4) low while a finger is on the screen.
-  uint8_t touch_panel_config[] = {0xA4, 0x00};
+  // set register 0xA4 G_MODE to interrupt trigger mode (0x01). the CTPM
+  // pulses its interrupt line (PC4) low for every new touch report, which
+  // EXTI4_IRQHandler reads into the touch queue.
+  uint8_t touch_panel_config[] = {0xA4, 0x01};
   ensure(
       sectrue * (HAL_OK == HAL_I2C_Master_Transmit(
                                &i2c_handle, TOUCH_ADDRESS, touch_panel_config,
@@ -199,9 +213,16 @@ void touch_power_on(void) {
       NULL);
 
   touch_sensitivity(0x06);
+
+  touch_queue_tail = touch_queue_head;
+  touch_touching = 0;
+  __HAL_GPIO_EXTI_CLEAR_IT(GPIO_PIN_4);
+  svc_setpriority(EXTI4_IRQn, IRQ_PRI_EXTINT);
+  svc_enableIRQ(EXTI4_IRQn);
 }
 
 void touch_power_off(void) {
+  svc_disableIRQ(EXTI4_IRQn);
   _i2c_deinit();
   // turn off CTP circuitry
   HAL_Delay(50);
@@ -211,44 +232,32 @@ void touch_power_off(void) {
 void touch_sensitivity(uint8_t value) {
   // set panel threshold (TH_GROUP) - default value is 0x12
   uint8_t touch_panel_threshold[] = {0x80, value};
-  ensure(sectrue *
-             (HAL_OK == HAL_I2C_Master_Transmit(
-                            &i2c_handle, TOUCH_ADDRESS, touch_panel_threshold,
-                            sizeof(touch_panel_threshold), 10)),
-         NULL);
+  // keep the interrupt off the bus while we use it
+  svc_disableIRQ(EXTI4_IRQn);
+  int result = HAL_I2C_Master_Transmit(&i2c_handle, TOUCH_ADDRESS,
+                                       touch_panel_threshold,
+                                       sizeof(touch_panel_threshold), 10);
+  svc_enableIRQ(EXTI4_IRQn);
+  ensure(sectrue * (HAL_OK == result), NULL);
 }
 
 uint32_t touch_is_detected(void) {
-  // check the interrupt line coming in from the CTPM.
-  // the line goes low when a touch event is actively detected.
-  // reference section 1.2 of "Application Note for FT6x06 CTPM".
-  // we configure the touch controller to use "interrupt polling mode".
-  return GPIO_PIN_RESET == HAL_GPIO_ReadPin(GPIOC, GPIO_PIN_4);
+  // the interrupt line only pulses in trigger mode, so rely on the events
+  // read by the interrupt handler instead of its level.
+  return touch_touching || touch_queue_head != touch_queue_tail;
 }
 
-uint32_t touch_read(void) {
+// Reads and decodes one touch report, called from EXTI4_IRQHandler.
+static uint32_t touch_read_packet(void) {
   static uint8_t touch_data[TOUCH_PACKET_SIZE],
       previous_touch_data[TOUCH_PACKET_SIZE];
-  static uint32_t xy;
-  static int touching;
-
-  int last_packet = 0;
-  if (!touch_is_detected()) {
-    // only poll when the touch interrupt is active.
-    // when it's inactive, we might need to read one last data packet to get to
-    // the TOUCH_END event, which clears the `touching` flag.
-    if (touching) {
-      last_packet = 1;
-    } else {
-      return 0;
-    }
-  }
 
   uint8_t outgoing[] = {0x00};  // start reading from address 0x00
   int result = HAL_I2C_Master_Transmit(&i2c_handle, TOUCH_ADDRESS, outgoing,
                                        sizeof(outgoing), 1);
   if (result != HAL_OK) {
-    if (result == HAL_BUSY) _i2c_cycle();
+    // the recovery sleeps, leave it to touch_read
+    if (result == HAL_BUSY) touch_i2c_stuck = 1;
     return 0;
   }
 
@@ -258,7 +267,7 @@ uint32_t touch_read(void) {
   }
 
   if (0 == memcmp(previous_touch_data, touch_data, TOUCH_PACKET_SIZE)) {
-    return 0;  // polled and got the same event again
+    return 0;  // got the same event again
   } else {
     memcpy(previous_touch_data, touch_data, TOUCH_PACKET_SIZE);
   }
@@ -268,25 +277,56 @@ uint32_t touch_read(void) {
                              // first touch) (tested with FT6206)
   const uint32_t event_flag = touch_data[3] & 0xC0;
   if (touch_data[1] == GESTURE_NO_GESTURE) {
-    xy = touch_pack_xy((X_POS_MSB << 8) | X_POS_LSB,
-                       (Y_POS_MSB << 8) | Y_POS_LSB);
+    const uint32_t xy = touch_pack_xy((X_POS_MSB << 8) | X_POS_LSB,
+                                      (Y_POS_MSB << 8) | Y_POS_LSB);
     if ((number_of_touch_points == 1) && (event_flag == EVENT_PRESS_DOWN)) {
-      touching = 1;
+      touch_touching = 1;
       return TOUCH_START | xy;
     } else if ((number_of_touch_points == 1) && (event_flag == EVENT_CONTACT)) {
       return TOUCH_MOVE | xy;
     } else if ((number_of_touch_points == 0) && (event_flag == EVENT_LIFT_UP)) {
-      touching = 0;
+      touch_touching = 0;
       return TOUCH_END | xy;
     }
   }
 
-  if (last_packet) {
-    // interrupt line is inactive, we didn't read valid touch data, and as far
-    // as we know, we never sent a TOUCH_END event.
-    touching = 0;
-    return TOUCH_END | xy;
+  return 0;
+}
+
+void EXTI4_IRQHandler(void) {
+  IRQ_ENTER(EXTI4_IRQn);
+  __HAL_GPIO_EXTI_CLEAR_IT(GPIO_PIN_4);
+  const uint32_t evt = touch_read_packet();
+  if (evt) {
+    const uint32_t head = touch_queue_head;
+    const uint32_t tail = touch_queue_tail;
+    const uint32_t last = (head - 1) % TOUCH_QUEUE_SIZE;
+    if ((evt & TOUCH_MOVE) && head - tail >= 2 &&
+        (touch_queue[last] & TOUCH_MOVE)) {
+      // touch_read is not reading the last entry, coalesce the moves
+      touch_queue[last] = evt;
+    } else if (head - tail < TOUCH_QUEUE_SIZE) {
+      touch_queue[head % TOUCH_QUEUE_SIZE] = evt;
+      touch_queue_head = head + 1;
+    }
+  }
+  IRQ_EXIT(EXTI4_IRQn);
+}
+
+uint32_t touch_read(void) {
+  if (touch_i2c_stuck) {
+    svc_disableIRQ(EXTI4_IRQn);
+    _i2c_cycle();
+    touch_i2c_stuck = 0;
+    svc_enableIRQ(EXTI4_IRQn);
   }
 
-  return 0;
+  // only drain the queue, the bus is read by the interrupt handler
+  const uint32_t tail = touch_queue_tail;
+  if (tail == touch_queue_head) {
+    return 0;
+  }
+  const uint32_t evt = touch_queue[tail % TOUCH_QUEUE_SIZE];
+  touch_queue_tail = tail + 1;
+  return evt;
 }
@@ -0,0 +1,86 @@
+/*
+ * This file is part of the Trezor project, https://trezor.io/
+ *
+ * Copyright (c) SatoshiLabs
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef TREZORHAL_TRACE_H
+#define TREZORHAL_TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Timeline of events for profiling on the device. An event is pushed with
+// the current cycle counter into a fixed-size ring buffer, overwriting the
+// oldest one when full. Pushing takes no lock and is safe from interrupt
+// handlers, but an event pushed concurrently with trace_read() may be read
+// half-written. The ring buffer is only compiled in with USE_TRACE.
+
+#ifndef USE_TRACE
+#define USE_TRACE 0
+#endif
+
+// must be a power of two
+#define TRACE_SIZE 256
+
+// Tags of the events pushed by C code. Spans are marked by two events with
+// TRACE_BEGIN and TRACE_END as their argument, a span left by an exception
+// has no end event.
+typedef enum {
+  TRACE_STORAGE_UNLOCK = 1,  // config.unlock(), including PIN stretching
+  TRACE_STORAGE_SET,         // config.set()
+  TRACE_FLASH_ERASE,         // flash_erase_sectors()
+  TRACE_DISPLAY_REFRESH,     // Display.refresh()
+  TRACE_BIP32_DERIVE_PATH,   // HDNode.derive_path()
+  TRACE_SECP256K1_SIGN,      // secp256k1.sign()
+  TRACE_PYTHON = 0x8000,     // utils.trace() adds this to its tag
+} trace_tag_t;
+
+#define TRACE_BEGIN 0
+#define TRACE_END 1
+
+typedef struct {
+  uint32_t cycles;
+  uint16_t tag;
+  uint16_t arg;
+} trace_event_t;
+
+// Returns the CPU cycle counter, which wraps after 2^32 cycles (25 s at
+// 168 MHz). Callable in unprivileged mode. The emulator counts nanoseconds
+// of the host monotonic clock instead.
+uint32_t trace_cycles(void);
+
+#if USE_TRACE
+void trace_event(uint16_t tag, uint16_t arg);
+// Copies at most max of the buffered events, oldest first, and returns how
+// many were copied.
+size_t trace_read(trace_event_t *events, size_t max);
+void trace_clear(void);
+#else
+static inline void trace_event(uint16_t tag, uint16_t arg) {
+  (void)tag;
+  (void)arg;
+}
+static inline size_t trace_read(trace_event_t *events, size_t max) {
+  (void)events;
+  (void)max;
+  return 0;
+}
+static inline void trace_clear(void) {}
+#endif
+
+#endif
@@ -30,8 +30,8 @@
 
 #if defined(USE_USB_FS)
 #define USB_PHY_ID USB_PHY_FS_ID
-#elif defined(USE_USB_HS) && defined(USE_USB_HS_IN_FS)
-#define USB_PHY_ID USB_PHY_HS_ID
+#elif defined(USE_USB_HS)
+#define USB_PHY_ID USB_PHY_HS_ID  // OTG_HS core, both in FS and ULPI mode
 #else
 #error Unable to determine proper USB_PHY_ID to use
 #endif
@@ -180,6 +180,45 @@ static void usb_desc_add_iface(size_t desc_len) {
                                      usb_config_desc->wTotalLength);
 }
 
+/*
+ * Report queues of the HID and WebUSB interfaces
+ */
+
+static secbool rqueue_init(usb_rqueue_t *q, uint8_t *buf, uint8_t cap,
+                           uint8_t packet_len) {
+  if (buf == NULL || cap == 0 || cap > USB_RQUEUE_MAX_LEN ||
+      (cap & (cap - 1)) != 0) {
+    return secfalse;
+  }
+  q->buf = buf;
+  q->cap = cap;
+  q->packet_len = packet_len;
+  q->read = 0;
+  q->write = 0;
+  return sectrue;
+}
+
+static inline uint8_t rqueue_length(volatile usb_rqueue_t *q) {
+  return (uint8_t)(q->write - q->read);
+}
+
+static inline int rqueue_empty(volatile usb_rqueue_t *q) {
+  return rqueue_length(q) == 0;
+}
+
+static inline int rqueue_full(volatile usb_rqueue_t *q) {
+  return rqueue_length(q) == q->cap;
+}
+
+static inline uint8_t *rqueue_slot(volatile usb_rqueue_t *q, uint8_t i) {
+  return q->buf + (i & (q->cap - 1)) * q->packet_len;
+}
+
+static inline volatile uint8_t *rqueue_len(volatile usb_rqueue_t *q,
+                                           uint8_t i) {
+  return &q->len[i & (q->cap - 1)];
+}
+
 /*
  * USB interface implementations
  */
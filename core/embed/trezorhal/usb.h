@@ -126,6 +126,21 @@ typedef enum {
   USB_IFACE_TYPE_WEBUSB = 3,
 } usb_iface_type_t;
 
+// Maximal number of reports in a usb_rqueue_t
+#define USB_RQUEUE_MAX_LEN 8
+
+/* usb_rqueue_t is used internally by the HID and WebUSB interfaces to queue
+ * whole reports.  The IRQ handler advances one counter and the API functions
+ * the other one, so no locking is needed. */
+typedef struct {
+  uint8_t *buf;  // cap * packet_len bytes
+  uint8_t cap;   // Number of reports in buf, a power of 2
+  uint8_t packet_len;
+  volatile uint8_t read;
+  volatile uint8_t write;
+  uint8_t len[USB_RQUEUE_MAX_LEN];  // Length of each queued report
+} usb_rqueue_t;
+
 #include "usb_hid-defs.h"
 #include "usb_vcp-defs.h"
 #include "usb_webusb-defs.h"
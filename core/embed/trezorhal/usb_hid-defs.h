@@ -39,14 +39,19 @@ typedef struct __attribute__((packed)) {
  * (usb_stop is called). */
 typedef struct {
   const uint8_t *report_desc;  // With length of report_desc_len bytes
-  uint8_t *rx_buffer;          // With length of max_packet_len bytes
+  uint8_t *rx_buffer;  // With length of rx_queue_len * max_packet_len bytes
+  uint8_t *tx_buffer;  // With length of tx_queue_len * max_packet_len bytes
   uint8_t iface_num;           // Address of this HID interface
   uint8_t ep_in;     // Address of IN endpoint (with the highest bit set)
   uint8_t ep_out;    // Address of OUT endpoint
   uint8_t subclass;  // usb_iface_subclass_t
   uint8_t protocol;  // usb_iface_protocol_t
   uint8_t polling_interval;  // In units of 1ms
-  uint8_t max_packet_len;    // Length of the biggest report and of rx_buffer
+  uint8_t rx_queue_len;  // Number of reports queued in rx_buffer, a power of 2
+                         // of at most USB_RQUEUE_MAX_LEN
+  uint8_t tx_queue_len;  // Number of reports queued in tx_buffer, a power of 2
+                         // of at most USB_RQUEUE_MAX_LEN
+  uint8_t max_packet_len;    // Length of the biggest report
   uint8_t report_desc_len;   // Length of report_desc
 } usb_hid_info_t;
 
@@ -57,7 +62,8 @@ typedef struct {
 typedef struct {
   const usb_hid_descriptor_block_t *desc_block;
   const uint8_t *report_desc;
-  uint8_t *rx_buffer;
+  usb_rqueue_t rx_queue;
+  usb_rqueue_t tx_queue;
   uint8_t ep_in;
   uint8_t ep_out;
   uint8_t max_packet_len;
@@ -66,7 +72,7 @@ typedef struct {
   uint8_t protocol;       // For SET_PROTOCOL/GET_PROTOCOL setup reqs
   uint8_t idle_rate;      // For SET_IDLE/GET_IDLE setup reqs
   uint8_t alt_setting;    // For SET_INTERFACE/GET_INTERFACE setup reqs
-  uint8_t last_read_len;  // Length of data read into rx_buffer
+  uint8_t rx_paused;      // Set to 1 when OUT endpoint waits for a free slot
   uint8_t ep_in_is_idle;  // Set to 1 after IN endpoint gets idle
 } usb_hid_state_t;
 
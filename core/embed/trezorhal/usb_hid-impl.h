@@ -52,13 +52,20 @@ secbool usb_hid_add(const usb_hid_info_t *info) {
   if ((info->ep_out & USB_EP_DIR_MASK) != USB_EP_DIR_OUT) {
     return secfalse;  // OUT EP is invalid
   }
-  if (info->rx_buffer == NULL) {
-    return secfalse;
-  }
   if (info->report_desc == NULL) {
     return secfalse;
   }
 
+  usb_rqueue_t rx_queue, tx_queue;
+  if (sectrue != rqueue_init(&rx_queue, info->rx_buffer, info->rx_queue_len,
+                             info->max_packet_len)) {
+    return secfalse;  // Invalid receiving queue
+  }
+  if (sectrue != rqueue_init(&tx_queue, info->tx_buffer, info->tx_queue_len,
+                             info->max_packet_len)) {
+    return secfalse;  // Invalid sending queue
+  }
+
   // Interface descriptor
   d->iface.bLength = sizeof(usb_interface_descriptor_t);
   d->iface.bDescriptorType = USB_DESC_TYPE_INTERFACE;
@@ -102,7 +109,8 @@ secbool usb_hid_add(const usb_hid_info_t *info) {
   iface->type = USB_IFACE_TYPE_HID;
   iface->hid.desc_block = d;
   iface->hid.report_desc = info->report_desc;
-  iface->hid.rx_buffer = info->rx_buffer;
+  iface->hid.rx_queue = rx_queue;
+  iface->hid.tx_queue = tx_queue;
   iface->hid.ep_in = info->ep_in;
   iface->hid.ep_out = info->ep_out;
   iface->hid.max_packet_len = info->max_packet_len;
@@ -110,7 +118,7 @@ secbool usb_hid_add(const usb_hid_info_t *info) {
   iface->hid.protocol = 0;
   iface->hid.idle_rate = 0;
   iface->hid.alt_setting = 0;
-  iface->hid.last_read_len = 0;
+  iface->hid.rx_paused = 0;
   iface->hid.ep_in_is_idle = 1;
 
   return sectrue;
@@ -124,8 +132,8 @@ secbool usb_hid_can_read(uint8_t iface_num) {
   if (iface->type != USB_IFACE_TYPE_HID) {
     return secfalse;  // Invalid interface type
   }
-  if (iface->hid.last_read_len == 0) {
-    return secfalse;  // Nothing in the receiving buffer
+  if (rqueue_empty(&iface->hid.rx_queue)) {
+    return secfalse;  // Nothing in the receiving queue
   }
   if (usb_dev_handle.dev_state != USBD_STATE_CONFIGURED) {
     return secfalse;  // Device is not configured
@@ -141,8 +149,8 @@ secbool usb_hid_can_write(uint8_t iface_num) {
   if (iface->type != USB_IFACE_TYPE_HID) {
     return secfalse;  // Invalid interface type
   }
-  if (iface->hid.ep_in_is_idle == 0) {
-    return secfalse;  // Last transmission is not over yet
+  if (rqueue_full(&iface->hid.tx_queue)) {
+    return secfalse;  // Sending queue is full
   }
   if (usb_dev_handle.dev_state != USBD_STATE_CONFIGURED) {
     return secfalse;  // Device is not configured
@@ -160,21 +168,29 @@ int usb_hid_read(uint8_t iface_num, uint8_t *buf, uint32_t len) {
   }
   volatile usb_hid_state_t *state = &iface->hid;
 
-  // Copy maximum possible amount of data
-  uint32_t last_read_len = state->last_read_len;
-  if (len < last_read_len) {
-    return 0;  // Not enough data in the read buffer
+  volatile usb_rqueue_t *q = &state->rx_queue;
+  if (rqueue_empty(q)) {
+    return 0;  // Nothing in the receiving queue
   }
-  memcpy(buf, state->rx_buffer, last_read_len);
-
-  // Reset the length to indicate we are ready to read next packet
-  state->last_read_len = 0;
 
-  // Prepare the OUT EP to receive next packet
-  USBD_LL_PrepareReceive(&usb_dev_handle, state->ep_out, state->rx_buffer,
-                         state->max_packet_len);
+  // Copy the oldest report
+  const uint8_t read = q->read;
+  const uint32_t read_len = *rqueue_len(q, read);
+  if (len < read_len) {
+    return 0;  // Not enough space in the buffer
+  }
+  memcpy(buf, rqueue_slot(q, read), read_len);
+  q->read = read + 1;
+
+  // The OUT EP stops receiving when the queue gets full, resume it now that a
+  // slot is free
+  if (state->rx_paused) {
+    state->rx_paused = 0;
+    USBD_LL_PrepareReceive(&usb_dev_handle, state->ep_out,
+                           rqueue_slot(q, q->write), state->max_packet_len);
+  }
 
-  return last_read_len;
+  return read_len;
 }
 
 int usb_hid_write(uint8_t iface_num, const uint8_t *buf, uint32_t len) {
@@ -187,12 +203,26 @@ int usb_hid_write(uint8_t iface_num, const uint8_t *buf, uint32_t len) {
   }
   volatile usb_hid_state_t *state = &iface->hid;
 
-  if (state->ep_in_is_idle == 0) {
-    return 0;  // Last transmission is not over yet
+  volatile usb_rqueue_t *q = &state->tx_queue;
+  if (rqueue_full(q)) {
+    return 0;  // Sending queue is full
+  }
+  if (len > state->max_packet_len) {
+    return -3;  // Report is too long
   }
 
-  state->ep_in_is_idle = 0;
-  USBD_LL_Transmit(&usb_dev_handle, state->ep_in, UNCONST(buf), (uint16_t)len);
+  // Queue a copy of the report
+  const uint8_t write = q->write;
+  memcpy(rqueue_slot(q, write), buf, len);
+  *rqueue_len(q, write) = len;
+  q->write = write + 1;
+
+  // Start sending unless usb_hid_class_data_in will pick it up
+  if (state->ep_in_is_idle) {
+    state->ep_in_is_idle = 0;
+    USBD_LL_Transmit(&usb_dev_handle, state->ep_in, rqueue_slot(q, q->read),
+                     *rqueue_len(q, q->read));
+  }
 
   return len;
 }
@@ -247,11 +277,15 @@ static void usb_hid_class_init(USBD_HandleTypeDef *dev, usb_hid_state_t *state,
   state->protocol = 0;
   state->idle_rate = 0;
   state->alt_setting = 0;
-  state->last_read_len = 0;
+  state->rx_queue.read = 0;
+  state->rx_queue.write = 0;
+  state->tx_queue.read = 0;
+  state->tx_queue.write = 0;
+  state->rx_paused = 0;
   state->ep_in_is_idle = 1;
 
   // Prepare the OUT EP to receive next packet
-  USBD_LL_PrepareReceive(dev, state->ep_out, state->rx_buffer,
+  USBD_LL_PrepareReceive(dev, state->ep_out, rqueue_slot(&state->rx_queue, 0),
                          state->max_packet_len);
 }
 
@@ -340,15 +374,35 @@ static int usb_hid_class_setup(USBD_HandleTypeDef *dev, usb_hid_state_t *state,
 static void usb_hid_class_data_in(USBD_HandleTypeDef *dev,
                                   usb_hid_state_t *state, uint8_t ep_num) {
   if ((ep_num | USB_EP_DIR_IN) == state->ep_in) {
-    state->ep_in_is_idle = 1;
+    usb_rqueue_t *q = &state->tx_queue;
+    if (!rqueue_empty(q)) {
+      q->read++;  // The oldest report has been sent
+    }
+    if (rqueue_empty(q)) {
+      state->ep_in_is_idle = 1;
+    } else {
+      // Send the next queued report
+      USBD_LL_Transmit(dev, state->ep_in, rqueue_slot(q, q->read),
+                       *rqueue_len(q, q->read));
+    }
   }
 }
 
 static void usb_hid_class_data_out(USBD_HandleTypeDef *dev,
                                    usb_hid_state_t *state, uint8_t ep_num) {
   if (ep_num == state->ep_out) {
-    // Save the report length to indicate we have read something, but don't
-    // schedule next reading until user reads this one
-    state->last_read_len = USBD_LL_GetRxDataSize(dev, ep_num);
+    // Queue the received report and keep receiving into the next slot. When
+    // the queue is full, the OUT EP is left unprepared, so the host gets NAKs
+    // until usb_hid_read frees a slot.
+    usb_rqueue_t *q = &state->rx_queue;
+    const uint8_t write = q->write;
+    *rqueue_len(q, write) = USBD_LL_GetRxDataSize(dev, ep_num);
+    q->write = write + 1;
+    if (rqueue_full(q)) {
+      state->rx_paused = 1;
+    } else {
+      USBD_LL_PrepareReceive(dev, state->ep_out, rqueue_slot(q, write + 1),
+                             state->max_packet_len);
+    }
   }
 }
@@ -30,14 +30,19 @@ typedef struct __attribute__((packed)) {
  * All passed pointers need to live at least until the interface is disabled
  * (usb_stop is called). */
 typedef struct {
-  uint8_t *rx_buffer;  // With length of max_packet_len bytes
+  uint8_t *rx_buffer;  // With length of rx_queue_len * max_packet_len bytes
+  uint8_t *tx_buffer;  // With length of tx_queue_len * max_packet_len bytes
   uint8_t iface_num;   // Address of this WebUSB interface
   uint8_t ep_in;       // Address of IN endpoint (with the highest bit set)
   uint8_t ep_out;      // Address of OUT endpoint
   uint8_t subclass;    // usb_iface_subclass_t
   uint8_t protocol;    // usb_iface_protocol_t
   uint8_t polling_interval;  // In units of 1ms
-  uint8_t max_packet_len;    // Length of the biggest report and of rx_buffer
+  uint8_t rx_queue_len;  // Number of reports queued in rx_buffer, a power of 2
+                         // of at most USB_RQUEUE_MAX_LEN
+  uint8_t tx_queue_len;  // Number of reports queued in tx_buffer, a power of 2
+                         // of at most USB_RQUEUE_MAX_LEN
+  uint8_t max_packet_len;    // Length of the biggest report
 } usb_webusb_info_t;
 
 /* usb_webusb_state_t encapsulates all state used by enabled WebUSB interface.
@@ -46,13 +51,14 @@ typedef struct {
  * configuration fields. */
 typedef struct {
   const usb_webusb_descriptor_block_t *desc_block;
-  uint8_t *rx_buffer;
+  usb_rqueue_t rx_queue;
+  usb_rqueue_t tx_queue;
   uint8_t ep_in;
   uint8_t ep_out;
   uint8_t max_packet_len;
 
   uint8_t alt_setting;    // For SET_INTERFACE/GET_INTERFACE setup reqs
-  uint8_t last_read_len;  // Length of data read into rx_buffer
+  uint8_t rx_paused;      // Set to 1 when OUT endpoint waits for a free slot
   uint8_t ep_in_is_idle;  // Set to 1 after IN endpoint gets idle
 } usb_webusb_state_t;
 
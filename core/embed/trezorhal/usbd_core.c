@@ -478,7 +478,12 @@ USBD_StatusTypeDef USBD_LL_SetSpeed(USBD_HandleTypeDef  *pdev, USBD_SpeedTypeDef
 
 USBD_StatusTypeDef USBD_LL_Suspend(USBD_HandleTypeDef  *pdev)
 {
-  pdev->dev_old_state =  pdev->dev_state;
+  /* A repeated suspend event must not overwrite the state to resume to,
+     otherwise the device stays suspended until the host enumerates it again */
+  if (pdev->dev_state != USBD_STATE_SUSPENDED)
+  {
+    pdev->dev_old_state =  pdev->dev_state;
+  }
   pdev->dev_state  = USBD_STATE_SUSPENDED;
   return USBD_OK;
 }
@@ -492,7 +497,12 @@ USBD_StatusTypeDef USBD_LL_Suspend(USBD_HandleTypeDef  *pdev)
 
 USBD_StatusTypeDef USBD_LL_Resume(USBD_HandleTypeDef  *pdev)
 {
-  pdev->dev_state = pdev->dev_old_state;
+  /* The configuration, the endpoints and the class state are kept while the
+     bus is suspended, so the device continues where it stopped */
+  if (pdev->dev_state == USBD_STATE_SUSPENDED)
+  {
+    pdev->dev_state = pdev->dev_old_state;
+  }
   return USBD_OK;
 }
 
@@ -0,0 +1 @@
+../trezorhal/boottime.h
\ No newline at end of file
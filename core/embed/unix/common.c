@@ -24,6 +24,7 @@
 #include "common.h"
 #include "display.h"
 #include "memzero.h"
+#include "py/mphal.h"
 
 extern void main_clean_exit();
 
@@ -105,7 +106,50 @@ error_shutdown(const char *line1, const char *line2, const char *line3,
   exit(4);
 }
 
-void hal_delay(uint32_t ms) { usleep(1000 * ms); }
+void hal_delay(uint32_t ms) {
+  if (emulator_headless()) {
+    emulator_clock_advance(ms);
+  } else {
+    usleep(1000 * ms);
+  }
+}
+
+int emulator_headless(void) {
+  static int headless = -1;
+  if (headless < 0) {
+    const char *variable = getenv("TREZOR_HEADLESS");
+    headless = variable ? atoi(variable) : 0;
+  }
+  return headless;
+}
+
+static uint32_t clock_offset = 0;
+
+uint32_t emulator_clock_offset(void) { return clock_offset; }
+
+#ifdef __APPLE__
+
+// the macOS linker has no --wrap, so the clock stays real there
+void emulator_clock_advance(uint32_t ms) { usleep(1000 * ms); }
+
+#else
+
+void emulator_clock_advance(uint32_t ms) { clock_offset += ms; }
+
+// The MicroPython tick functions are wrapped at link time (--wrap), so that
+// utime and io.poll run on the virtual clock as well.
+mp_uint_t __real_mp_hal_ticks_ms(void);
+mp_uint_t __real_mp_hal_ticks_us(void);
+
+mp_uint_t __wrap_mp_hal_ticks_ms(void) {
+  return __real_mp_hal_ticks_ms() + clock_offset;
+}
+
+mp_uint_t __wrap_mp_hal_ticks_us(void) {
+  return __real_mp_hal_ticks_us() + clock_offset * 1000;
+}
+
+#endif
 
 void wait_random(void) {}
 
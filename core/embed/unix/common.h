@@ -58,6 +58,21 @@ error_shutdown(const char *line1, const char *line2, const char *line3,
 void hal_delay(uint32_t ms);
 void wait_random(void);
 
+// TREZOR_HEADLESS=1: nothing is rendered and idle waits fast-forward a
+// virtual clock instead of sleeping
+// waits of io.poll up to this long are skipped in headless mode, it must stay
+// below the 1 s that the event loop waits for when it has nothing scheduled
+#define EMULATOR_SKIP_WAIT_MS 500
+int emulator_headless(void);
+void emulator_clock_advance(uint32_t ms);
+uint32_t emulator_clock_offset(void);
+
+// sends queued USB reports and sleeps until a report arrives on any emulated
+// interface or the timeout expires
+// with a display the wait is capped so that SDL events keep being handled
+#define EMULATOR_USB_WAIT_MS 1
+void usb_emulated_wait(uint32_t timeout_ms);
+
 void collect_hw_entropy(void);
 #define HW_ENTROPY_LEN (12 + 32)
 extern uint8_t HW_ENTROPY_DATA[HW_ENTROPY_LEN];
@@ -17,11 +17,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <fcntl.h>
 #include <stdlib.h>
 #include <sys/mman.h>
-#include <sys/stat.h>
-#include <sys/types.h>
 #include <unistd.h>
 
 #include <string.h>
@@ -29,6 +26,7 @@
 #include "common.h"
 #include "flash.h"
 #include "profile.h"
+#include "snapshot.h"
 
 #ifndef FLASH_FILE
 #define FLASH_FILE profile_flash_path()
@@ -93,6 +91,9 @@ static uint8_t *FLASH_BUFFER = NULL;
 static uint32_t FLASH_SIZE;
 
 static void flash_exit(void) {
+  if (profile_sync() == PROFILE_SYNC_EXIT) {
+    msync(FLASH_BUFFER, FLASH_SIZE, MS_SYNC);
+  }
   int r = munmap(FLASH_BUFFER, FLASH_SIZE);
   ensure(sectrue * (r == 0), "munmap failed");
 }
@@ -102,33 +103,12 @@ void flash_init(void) {
 
   FLASH_SIZE = FLASH_SECTOR_TABLE[FLASH_SECTOR_COUNT] - FLASH_SECTOR_TABLE[0];
 
-  // check whether the file exists and it has the correct size
-  struct stat sb;
-  int r = stat(FLASH_FILE, &sb);
-
-  // (re)create if non existant or wrong size
-  if (r != 0 || sb.st_size != FLASH_SIZE) {
-    int fd = open(FLASH_FILE, O_RDWR | O_CREAT | O_TRUNC, (mode_t)0600);
-    ensure(sectrue * (fd >= 0), "open failed");
-    for (int i = 0; i < FLASH_SIZE / 16; i++) {
-      ssize_t s = write(
-          fd,
-          "\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF",
-          16);
-      ensure(sectrue * (s >= 0), "write failed");
-    }
-    r = close(fd);
-    ensure(sectrue * (r == 0), "close failed");
+  int created;
+  FLASH_BUFFER = (uint8_t *)profile_map(FLASH_FILE, FLASH_SIZE, &created);
+  if (created) {
+    memset(FLASH_BUFFER, 0xFF, FLASH_SIZE);
   }
-
-  // mmap file
-  int fd = open(FLASH_FILE, O_RDWR);
-  ensure(sectrue * (fd >= 0), "open failed");
-
-  void *map = mmap(0, FLASH_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
-  ensure(sectrue * (map != MAP_FAILED), "mmap failed");
-
-  FLASH_BUFFER = (uint8_t *)map;
+  snapshot_register(FLASH_BUFFER, FLASH_SIZE);
 
   atexit(flash_exit);
 }
@@ -149,6 +129,10 @@ const void *flash_get_address(uint8_t sector, uint32_t offset, uint32_t size) {
   return FLASH_BUFFER + addr - FLASH_SECTOR_TABLE[0];
 }
 
+void flash_read_cache_enable(void) {}
+
+void flash_read_cache_disable(void) {}
+
 secbool flash_erase_sectors(const uint8_t *sectors, int len,
                             void (*progress)(int pos, int len)) {
   if (progress) {
@@ -164,6 +148,18 @@ secbool flash_erase_sectors(const uint8_t *sectors, int len,
       progress(i + 1, len);
     }
   }
+  if (profile_sync() == PROFILE_SYNC_ERASE && !profile_memory()) {
+    msync(FLASH_BUFFER, FLASH_SIZE, MS_SYNC);
+  }
+  return sectrue;
+}
+
+secbool flash_erase_start(uint8_t sector) {
+  return flash_erase_sectors(&sector, 1, NULL);
+}
+
+secbool flash_erase_finish(uint8_t sector) {
+  (void)sector;
   return sectrue;
 }
 
@@ -194,6 +190,25 @@ secbool flash_write_word(uint8_t sector, uint32_t offset, uint32_t data) {
   return sectrue;
 }
 
+secbool flash_write_block(uint8_t sector, uint32_t offset,
+                          const uint32_t *data, uint32_t count) {
+  if (offset % sizeof(uint32_t)) {  // we write only at 4-byte boundary
+    return secfalse;
+  }
+  uint32_t *flash = (uint32_t *)flash_get_address(sector, offset,
+                                                  count * sizeof(uint32_t));
+  if (!flash) {
+    return secfalse;
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    if ((flash[i] & data[i]) != data[i]) {
+      return secfalse;  // we cannot change zeroes to ones
+    }
+  }
+  memcpy(flash, data, count * sizeof(uint32_t));
+  return sectrue;
+}
+
 secbool flash_otp_read(uint8_t block, uint8_t offset, uint8_t *data,
                        uint8_t datalen) {
   return secfalse;
@@ -50,6 +50,7 @@
 #include "py/stackctrl.h"
 
 #include "common.h"
+#include "snapshot.h"
 
 // Command line options, with their defaults
 STATIC bool compile_only = false;
@@ -459,6 +460,8 @@ MP_NOINLINE int main_(int argc, char **argv) {
   signal(SIGPIPE, SIG_IGN);
 #endif
 
+  snapshot_init();
+
   mp_stack_set_limit(600000 * (BYTES_PER_WORD / 4));
 
   pre_process_options(argc, argv);
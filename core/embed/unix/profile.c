@@ -18,9 +18,15 @@
  */
 
 #define _GNU_SOURCE
+#include <fcntl.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
+#include "common.h"
 #include "profile.h"
 
 #define SVAR(varname)   \
@@ -66,3 +72,64 @@ const char *profile_sdcard_path(void) {
   FILE_PATH(_sdcard_path, "/trezor.sdcard");
   return _sdcard_path;
 }
+
+int profile_memory(void) {
+  static int memory = -1;
+  if (memory < 0) {
+    const char *variable = getenv("TREZOR_PROFILE_MEMORY");
+    memory = variable ? atoi(variable) : 0;
+  }
+  return memory;
+}
+
+profile_sync_t profile_sync(void) {
+  static int sync = -1;
+  if (sync < 0) {
+    const char *variable = getenv("TREZOR_PROFILE_SYNC");
+    if (variable && 0 == strcmp(variable, "exit")) {
+      sync = PROFILE_SYNC_EXIT;
+    } else if (variable && 0 == strcmp(variable, "erase")) {
+      sync = PROFILE_SYNC_ERASE;
+    } else {
+      sync = PROFILE_SYNC_NEVER;
+    }
+  }
+  return sync;
+}
+
+// Maps size bytes of the file at path, or of anonymous memory when
+// TREZOR_PROFILE_MEMORY is set. A missing or wrongly sized file is
+// (re)created and *created is set, the caller then has to clear the memory.
+void *profile_map(const char *path, size_t size, int *created) {
+  if (profile_memory()) {
+    void *map = mmap(0, size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ensure(sectrue * (map != MAP_FAILED), "mmap failed");
+    *created = 1;
+    return map;
+  }
+
+  // check whether the file exists and it has the correct size
+  struct stat sb;
+  int r = stat(path, &sb);
+  *created = 0;
+
+  // (re)create if non existant or wrong size
+  if (r != 0 || sb.st_size != (off_t)size) {
+    int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, (mode_t)0600);
+    ensure(sectrue * (fd >= 0), "open failed");
+    r = ftruncate(fd, size);
+    ensure(sectrue * (r == 0), "truncate failed");
+    r = close(fd);
+    ensure(sectrue * (r == 0), "close failed");
+    *created = 1;
+  }
+
+  // mmap file
+  int fd = open(path, O_RDWR);
+  ensure(sectrue * (fd >= 0), "open failed");
+
+  void *map = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ensure(sectrue * (map != MAP_FAILED), "mmap failed");
+  return map;
+}
@@ -20,9 +20,16 @@
 #ifndef __TREZOR_PROFILE_H__
 #define __TREZOR_PROFILE_H__
 
+#include <stddef.h>
+
 // Environment variables meaning:
 // TREZOR_PROFILE_NAME sets the title of the emulator window.
 // TREZOR_PROFILE_DIR contains flash files.
+// TREZOR_PROFILE_MEMORY=1 keeps flash and SD card in anonymous memory instead,
+// so they start empty and nothing is written to the profile directory.
+// TREZOR_PROFILE_SYNC selects when the flash and SD card files are msync'ed:
+// "never" (left to the kernel), "exit" or "erase" (after every flash erase
+// and SD card write).
 //
 // If those are not set int the environment these default values are used.
 
@@ -34,4 +41,14 @@ const char *profile_dir(void);
 const char *profile_flash_path(void);
 const char *profile_sdcard_path(void);
 
+typedef enum {
+  PROFILE_SYNC_NEVER,
+  PROFILE_SYNC_EXIT,
+  PROFILE_SYNC_ERASE,
+} profile_sync_t;
+
+int profile_memory(void);
+profile_sync_t profile_sync(void);
+void *profile_map(const char *path, size_t size, int *created);
+
 #endif  // __TREZOR_PROFILE_H__
@@ -17,16 +17,14 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <fcntl.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/mman.h>
-#include <sys/stat.h>
-#include <sys/types.h>
 #include <unistd.h>
 
 #include "common.h"
 #include "profile.h"
+#include "snapshot.h"
 #include "sdcard.h"
 
 #ifndef SDCARD_FILE
@@ -40,6 +38,9 @@ static uint8_t *sdcard_buffer = NULL;
 static secbool sdcard_powered = secfalse;
 
 static void sdcard_exit(void) {
+  if (profile_sync() == PROFILE_SYNC_EXIT) {
+    msync(sdcard_buffer, SDCARD_SIZE, MS_SYNC);
+  }
   int r = munmap(sdcard_buffer, SDCARD_SIZE);
   ensure(sectrue * (r == 0), "munmap failed");
   sdcard_buffer = NULL;
@@ -50,37 +51,14 @@ void sdcard_init(void) {
     return;
   }
 
-  // check whether the file exists and it has the correct size
-  struct stat sb;
-  int r = stat(SDCARD_FILE, &sb);
-  int should_clear = 0;
-
-  // (re)create if non existant or wrong size
-  if (r != 0 || sb.st_size != SDCARD_SIZE) {
-    int fd = open(SDCARD_FILE, O_RDWR | O_CREAT | O_TRUNC, (mode_t)0600);
-    ensure(sectrue * (fd >= 0), "open failed");
-    r = ftruncate(fd, SDCARD_SIZE);
-    ensure(sectrue * (r == 0), "truncate failed");
-    r = close(fd);
-    ensure(sectrue * (r == 0), "close failed");
-
-    should_clear = 1;
-  }
-
-  // mmap file
-  int fd = open(SDCARD_FILE, O_RDWR);
-  ensure(sectrue * (fd >= 0), "open failed");
-
-  void *map = mmap(0, SDCARD_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
-  ensure(sectrue * (map != MAP_FAILED), "mmap failed");
-
-  sdcard_buffer = (uint8_t *)map;
-
-  if (should_clear) {
-    for (int i = 0; i < SDCARD_SIZE; ++i) sdcard_buffer[i] = 0xFF;
+  int created;
+  sdcard_buffer = (uint8_t *)profile_map(SDCARD_FILE, SDCARD_SIZE, &created);
+  if (created) {
+    memset(sdcard_buffer, 0xFF, SDCARD_SIZE);
   }
 
   sdcard_powered = secfalse;
+  snapshot_register(sdcard_buffer, SDCARD_SIZE);
 
   atexit(sdcard_exit);
 }
@@ -115,6 +93,14 @@ secbool sdcard_read_blocks(uint32_t *dest, uint32_t block_num,
   return sectrue;
 }
 
+// the emulated card completes the read immediately
+secbool sdcard_read_blocks_start(uint32_t *dest, uint32_t block_num,
+                                 uint32_t num_blocks) {
+  return sdcard_read_blocks(dest, block_num, num_blocks);
+}
+
+secbool sdcard_read_blocks_finish(void) { return sectrue; }
+
 secbool sdcard_write_blocks(const uint32_t *src, uint32_t block_num,
                             uint32_t num_blocks) {
   if (sectrue != sdcard_powered) {
@@ -128,5 +114,12 @@ secbool sdcard_write_blocks(const uint32_t *src, uint32_t block_num,
   }
   memcpy(sdcard_buffer + block_num * SDCARD_BLOCK_SIZE, src,
          num_blocks * SDCARD_BLOCK_SIZE);
+  if (profile_sync() == PROFILE_SYNC_ERASE && !profile_memory()) {
+    // msync needs a page aligned start
+    const uint32_t page = sysconf(_SC_PAGESIZE);
+    const uint32_t start = block_num * SDCARD_BLOCK_SIZE / page * page;
+    const uint32_t end = (block_num + num_blocks) * SDCARD_BLOCK_SIZE;
+    msync(sdcard_buffer + start, end - start, MS_SYNC);
+  }
   return sectrue;
 }
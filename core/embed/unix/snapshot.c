@@ -0,0 +1,127 @@
+/*
+ * This file is part of the Trezor project, https://trezor.io/
+ *
+ * Copyright (c) SatoshiLabs
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define _GNU_SOURCE
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "common.h"
+#include "profile.h"
+#include "snapshot.h"
+
+#define SNAPSHOT_REGIONS 4
+
+static struct {
+  void *buffer;
+  void *saved;
+  size_t size;
+} regions[SNAPSHOT_REGIONS];
+static int region_count = 0;
+
+static volatile sig_atomic_t snapshot_requested = 0;
+
+static void snapshot_request(int sig) {
+  (void)sig;
+  snapshot_requested = 1;
+}
+
+void snapshot_init(void) { signal(SIGUSR1, snapshot_request); }
+
+void snapshot_register(void *buffer, size_t size) {
+  ensure(sectrue * (region_count < SNAPSHOT_REGIONS), "too many regions");
+  // anonymous pages are only backed once the snapshot writes them
+  void *saved =
+      mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+  ensure(sectrue * (saved != MAP_FAILED), "mmap failed");
+  regions[region_count].buffer = buffer;
+  regions[region_count].saved = saved;
+  regions[region_count].size = size;
+  region_count++;
+}
+
+static void write_child_pid(pid_t child) {
+  char *path = NULL;
+  if (asprintf(&path, "%s/trezor.snapshot", profile_dir()) < 0) {
+    return;
+  }
+  FILE *f = fopen(path, "w");
+  if (f) {
+    fprintf(f, "%d\n", (int)child);
+    fclose(f);
+  }
+  free(path);
+}
+
+// Returns in the child, the template itself never returns.
+static void snapshot_serve(void) {
+  sigset_t set, old;
+  sigemptyset(&set);
+  sigaddset(&set, SIGUSR2);
+  sigaddset(&set, SIGTERM);
+  sigaddset(&set, SIGINT);
+  sigaddset(&set, SIGCHLD);
+  sigprocmask(SIG_BLOCK, &set, &old);
+
+  for (;;) {
+    fflush(stdout);
+    pid_t child = fork();
+    ensure(sectrue * (child >= 0), "fork failed");
+    if (child == 0) {
+      sigprocmask(SIG_SETMASK, &old, NULL);
+      return;
+    }
+    write_child_pid(child);
+
+    int sig = 0, status = 0;
+    do {
+      sigwait(&set, &sig);
+      // the child stopped on its own, e.g. after a shutdown
+      if (sig == SIGCHLD && waitpid(child, &status, WNOHANG) == child) {
+        _exit(WIFEXITED(status) ? WEXITSTATUS(status) : 1);
+      }
+    } while (sig == SIGCHLD);
+
+    kill(child, SIGKILL);
+    waitpid(child, NULL, 0);
+    if (sig != SIGUSR2) {
+      _exit(0);
+    }
+    for (int i = 0; i < region_count; i++) {
+      memcpy(regions[i].buffer, regions[i].saved, regions[i].size);
+    }
+  }
+}
+
+void snapshot_poll(void) {
+  if (!snapshot_requested) {
+    return;
+  }
+  snapshot_requested = 0;
+  // a child can not become a template of its own
+  signal(SIGUSR1, SIG_IGN);
+  for (int i = 0; i < region_count; i++) {
+    memcpy(regions[i].saved, regions[i].buffer, regions[i].size);
+  }
+  snapshot_serve();
+}
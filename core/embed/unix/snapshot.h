@@ -0,0 +1,43 @@
+/*
+ * This file is part of the Trezor project, https://trezor.io/
+ *
+ * Copyright (c) SatoshiLabs
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __TREZORUNIX_SNAPSHOT_H__
+#define __TREZORUNIX_SNAPSHOT_H__
+
+#include <stddef.h>
+
+// Snapshots let tests return to a known state without booting again.
+//
+// SIGUSR1 takes a snapshot: at the next idle point the process saves the
+// registered memory regions (flash, SD card) and forks. The parent keeps
+// the state and becomes a template, the child continues.
+//
+// SIGUSR2 sent to the template restores the snapshot: the running child is
+// killed, the regions are copied back and a new child is forked from the
+// template, with the RAM state of the moment of the snapshot.
+//
+// After each fork, the template writes the pid of the new child to
+// trezor.snapshot in the profile directory. SIGTERM and SIGINT stop the
+// template together with its child.
+
+void snapshot_init(void);
+void snapshot_register(void *buffer, size_t size);
+void snapshot_poll(void);
+
+#endif
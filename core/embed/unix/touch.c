@@ -20,6 +20,7 @@
 #include <SDL2/SDL.h>
 #include <stdint.h>
 
+#include "common.h"
 #include "touch.h"
 
 extern int sdl_display_res_x, sdl_display_res_y;
@@ -29,6 +30,9 @@ extern void __shutdown(void);
 extern const char *display_save(const char *prefix);
 
 uint32_t touch_read(void) {
+  if (emulator_headless()) {
+    return 0;
+  }
   SDL_Event event;
   SDL_PumpEvents();
   if (SDL_PollEvent(&event) > 0) {
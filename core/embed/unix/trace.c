@@ -0,0 +1,60 @@
+/*
+ * This file is part of the Trezor project, https://trezor.io/
+ *
+ * Copyright (c) SatoshiLabs
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <time.h>
+
+#include "trace.h"
+
+uint32_t trace_cycles(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint32_t)t.tv_sec * 1000000000 + (uint32_t)t.tv_nsec;
+}
+
+#if USE_TRACE
+
+static trace_event_t trace_buffer[TRACE_SIZE];
+// number of events pushed since the last trace_clear()
+static uint32_t trace_head = 0;
+
+void trace_event(uint16_t tag, uint16_t arg) {
+  // reserve the slot first so that an interrupt cannot write into it
+  uint32_t i = __atomic_fetch_add(&trace_head, 1, __ATOMIC_RELAXED);
+  trace_event_t *e = &trace_buffer[i & (TRACE_SIZE - 1)];
+  e->cycles = trace_cycles();
+  e->tag = tag;
+  e->arg = arg;
+}
+
+size_t trace_read(trace_event_t *events, size_t max) {
+  uint32_t head = __atomic_load_n(&trace_head, __ATOMIC_RELAXED);
+  size_t n = (head < TRACE_SIZE) ? head : TRACE_SIZE;
+  if (n > max) {
+    n = max;
+  }
+  for (size_t i = 0; i < n; i++) {
+    events[i] = trace_buffer[(head - n + i) & (TRACE_SIZE - 1)];
+  }
+  return n;
+}
+
+void trace_clear(void) { __atomic_store_n(&trace_head, 0, __ATOMIC_RELAXED); }
+
+#endif
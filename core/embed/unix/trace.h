@@ -0,0 +1 @@
+../trezorhal/trace.h
\ No newline at end of file
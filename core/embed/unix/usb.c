@@ -17,6 +17,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#define _GNU_SOURCE  // recvmmsg, sendmmsg
+
 #include <arpa/inet.h>
 #include <assert.h>
 #include <fcntl.h>
@@ -29,17 +31,9 @@
 #include "touch.h"
 #include "usb.h"
 
+#include "common.h"
 #include "memzero.h"
 
-void __attribute__((noreturn))
-__fatal_error(const char *expr, const char *msg, const char *file, int line,
-              const char *func);
-
-#define ensure(expr, msg) \
-  (((expr) == sectrue)    \
-       ? (void)0          \
-       : __fatal_error(#expr, msg, __FILE__, __LINE__, __func__))
-
 // emulator opens UDP server on TREZOR_UDP_PORT port
 // and emulates HID/WebUSB interface TREZOR_UDP_IFACE
 // gracefully ignores all other USB interfaces
@@ -47,11 +41,29 @@ __fatal_error(const char *expr, const char *msg, const char *file, int line,
 #define USBD_MAX_NUM_INTERFACES 8
 #define TREZOR_UDP_PORT 21324
 
+// Reports are moved between the socket and a small per-interface queue in
+// batches of up to USB_UDP_BATCH datagrams, one recvmmsg/sendmmsg call per
+// batch on Linux. Queued writes are sent when the queue fills up or when the
+// emulator is about to wait for input (usb_emulated_wait).
+#define USB_UDP_BATCH 32
+#define USB_UDP_PACKET_SIZE 64
+
+typedef struct {
+  uint8_t data[USB_UDP_PACKET_SIZE];
+  uint32_t len;
+  struct sockaddr_in addr;
+  socklen_t addrlen;
+} usb_udp_packet_t;
+
 static struct {
   usb_iface_type_t type;
   int sock;
   struct sockaddr_in si_me, si_other;
   socklen_t slen;
+  usb_udp_packet_t rx[USB_UDP_BATCH];
+  int rx_pos, rx_count;
+  usb_udp_packet_t tx[USB_UDP_BATCH];
+  int tx_count;
 } usb_ifaces[USBD_MAX_NUM_INTERFACES];
 
 void usb_init(const usb_dev_info_t *dev_info) {
@@ -62,6 +74,9 @@ void usb_init(const usb_dev_info_t *dev_info) {
     memzero(&usb_ifaces[i].si_me, sizeof(struct sockaddr_in));
     memzero(&usb_ifaces[i].si_other, sizeof(struct sockaddr_in));
     usb_ifaces[i].slen = 0;
+    usb_ifaces[i].rx_pos = 0;
+    usb_ifaces[i].rx_count = 0;
+    usb_ifaces[i].tx_count = 0;
   }
 }
 
@@ -129,47 +144,186 @@ secbool usb_vcp_add(const usb_vcp_info_t *info) {
   return sectrue;
 }
 
-static secbool usb_emulated_poll(uint8_t iface_num, short dir) {
-  struct pollfd fds[] = {
-      {usb_ifaces[iface_num].sock, dir, 0},
-  };
-  int r = poll(fds, 1, 0);
-  return sectrue * (r > 0);
+static int usb_udp_recv_batch(int sock, usb_udp_packet_t *pkts, int count) {
+#ifdef __linux__
+  struct mmsghdr msgs[USB_UDP_BATCH];
+  struct iovec iovs[USB_UDP_BATCH];
+  memzero(msgs, sizeof(msgs));
+  for (int i = 0; i < count; i++) {
+    iovs[i].iov_base = pkts[i].data;
+    iovs[i].iov_len = sizeof(pkts[i].data);
+    msgs[i].msg_hdr.msg_iov = &iovs[i];
+    msgs[i].msg_hdr.msg_iovlen = 1;
+    msgs[i].msg_hdr.msg_name = &pkts[i].addr;
+    msgs[i].msg_hdr.msg_namelen = sizeof(pkts[i].addr);
+  }
+  int r = recvmmsg(sock, msgs, count, MSG_DONTWAIT, NULL);
+  for (int i = 0; i < r; i++) {
+    pkts[i].len = msgs[i].msg_len;
+    pkts[i].addrlen = msgs[i].msg_hdr.msg_namelen;
+  }
+  return r < 0 ? 0 : r;
+#else
+  int n = 0;
+  for (; n < count; n++) {
+    pkts[n].addrlen = sizeof(pkts[n].addr);
+    ssize_t r = recvfrom(sock, pkts[n].data, sizeof(pkts[n].data),
+                         MSG_DONTWAIT, (struct sockaddr *)&pkts[n].addr,
+                         &pkts[n].addrlen);
+    if (r < 0) {
+      break;
+    }
+    pkts[n].len = r;
+  }
+  return n;
+#endif
 }
 
-static int usb_emulated_read(uint8_t iface_num, uint8_t *buf, uint32_t len) {
-  struct sockaddr_in si;
-  socklen_t sl = sizeof(si);
-  ssize_t r = recvfrom(usb_ifaces[iface_num].sock, buf, len, MSG_DONTWAIT,
-                       (struct sockaddr *)&si, &sl);
-  if (r < 0) {
-    return r;
-  }
-  usb_ifaces[iface_num].si_other = si;
-  usb_ifaces[iface_num].slen = sl;
+static int usb_udp_send_batch(int sock, const usb_udp_packet_t *pkts,
+                              int count) {
+#ifdef __linux__
+  struct mmsghdr msgs[USB_UDP_BATCH];
+  struct iovec iovs[USB_UDP_BATCH];
+  memzero(msgs, sizeof(msgs));
+  for (int i = 0; i < count; i++) {
+    iovs[i].iov_base = (void *)pkts[i].data;
+    iovs[i].iov_len = pkts[i].len;
+    msgs[i].msg_hdr.msg_iov = &iovs[i];
+    msgs[i].msg_hdr.msg_iovlen = 1;
+    msgs[i].msg_hdr.msg_name = (void *)&pkts[i].addr;
+    msgs[i].msg_hdr.msg_namelen = pkts[i].addrlen;
+  }
+  int r = sendmmsg(sock, msgs, count, MSG_DONTWAIT);
+  return r < 0 ? 0 : r;
+#else
+  int n = 0;
+  for (; n < count; n++) {
+    if (sendto(sock, pkts[n].data, pkts[n].len, MSG_DONTWAIT,
+               (const struct sockaddr *)&pkts[n].addr, pkts[n].addrlen) < 0) {
+      break;
+    }
+  }
+  return n;
+#endif
+}
+
+static void usb_emulated_flush(uint8_t iface_num) {
+  int count = usb_ifaces[iface_num].tx_count;
+  if (count == 0) {
+    return;
+  }
+  int sent = usb_udp_send_batch(usb_ifaces[iface_num].sock,
+                                usb_ifaces[iface_num].tx, count);
+  if (sent == 0) {
+    // The socket buffer is full or the host is gone. Keep the reports and
+    // try again later, like a USB endpoint that has not been read yet.
+    return;
+  }
+  memmove(usb_ifaces[iface_num].tx, usb_ifaces[iface_num].tx + sent,
+          (count - sent) * sizeof(usb_udp_packet_t));
+  usb_ifaces[iface_num].tx_count = count - sent;
+}
+
+static void usb_emulated_fill(uint8_t iface_num) {
   static const char *ping_req = "PINGPING";
   static const char *ping_resp = "PONGPONG";
-  if (r == strlen(ping_req) && 0 == memcmp(ping_req, buf, strlen(ping_req))) {
-    if (usb_ifaces[iface_num].slen > 0) {
+
+  int count = usb_udp_recv_batch(usb_ifaces[iface_num].sock,
+                                 usb_ifaces[iface_num].rx, USB_UDP_BATCH);
+  // answer liveness pings right away and drop them from the queue
+  int kept = 0;
+  for (int i = 0; i < count; i++) {
+    usb_udp_packet_t *p = &usb_ifaces[iface_num].rx[i];
+    if (p->len == strlen(ping_req) &&
+        0 == memcmp(ping_req, p->data, strlen(ping_req))) {
       sendto(usb_ifaces[iface_num].sock, ping_resp, strlen(ping_resp),
-             MSG_DONTWAIT,
-             (const struct sockaddr *)&usb_ifaces[iface_num].si_other,
-             usb_ifaces[iface_num].slen);
+             MSG_DONTWAIT, (const struct sockaddr *)&p->addr, p->addrlen);
+      usb_ifaces[iface_num].si_other = p->addr;
+      usb_ifaces[iface_num].slen = p->addrlen;
+      continue;
+    }
+    if (kept != i) {
+      usb_ifaces[iface_num].rx[kept] = *p;
+    }
+    kept++;
+  }
+  usb_ifaces[iface_num].rx_pos = 0;
+  usb_ifaces[iface_num].rx_count = kept;
+}
+
+static secbool usb_emulated_poll(uint8_t iface_num, short dir) {
+  if (dir == POLLIN) {
+    if (usb_ifaces[iface_num].rx_count == 0) {
+      usb_emulated_fill(iface_num);
+    }
+    return sectrue * (usb_ifaces[iface_num].rx_count > 0);
+  }
+  if (usb_ifaces[iface_num].tx_count == USB_UDP_BATCH) {
+    usb_emulated_flush(iface_num);
+  }
+  return sectrue * (usb_ifaces[iface_num].tx_count < USB_UDP_BATCH);
+}
+
+static int usb_emulated_read(uint8_t iface_num, uint8_t *buf, uint32_t len) {
+  if (usb_ifaces[iface_num].rx_count == 0) {
+    usb_emulated_fill(iface_num);
+    if (usb_ifaces[iface_num].rx_count == 0) {
+      return -1;
     }
-    return 0;
   }
+  const usb_udp_packet_t *p =
+      &usb_ifaces[iface_num].rx[usb_ifaces[iface_num].rx_pos];
+  usb_ifaces[iface_num].rx_pos++;
+  usb_ifaces[iface_num].rx_count--;
+  usb_ifaces[iface_num].si_other = p->addr;
+  usb_ifaces[iface_num].slen = p->addrlen;
+  uint32_t r = MIN(len, p->len);
+  memcpy(buf, p->data, r);
   return r;
 }
 
 static int usb_emulated_write(uint8_t iface_num, const uint8_t *buf,
                               uint32_t len) {
-  ssize_t r = len;
-  if (usb_ifaces[iface_num].slen > 0) {
-    r = sendto(usb_ifaces[iface_num].sock, buf, len, MSG_DONTWAIT,
-               (const struct sockaddr *)&usb_ifaces[iface_num].si_other,
-               usb_ifaces[iface_num].slen);
+  if (usb_ifaces[iface_num].slen == 0) {
+    return len;
   }
-  return r;
+  if (usb_ifaces[iface_num].tx_count == USB_UDP_BATCH) {
+    usb_emulated_flush(iface_num);
+    if (usb_ifaces[iface_num].tx_count == USB_UDP_BATCH) {
+      return -1;
+    }
+  }
+  usb_udp_packet_t *p =
+      &usb_ifaces[iface_num].tx[usb_ifaces[iface_num].tx_count];
+  p->len = MIN(len, sizeof(p->data));
+  memcpy(p->data, buf, p->len);
+  p->addr = usb_ifaces[iface_num].si_other;
+  p->addrlen = usb_ifaces[iface_num].slen;
+  usb_ifaces[iface_num].tx_count++;
+  if (usb_ifaces[iface_num].tx_count == USB_UDP_BATCH) {
+    usb_emulated_flush(iface_num);
+  }
+  return p->len;
+}
+
+void usb_emulated_wait(uint32_t timeout_ms) {
+  struct pollfd fds[USBD_MAX_NUM_INTERFACES];
+  nfds_t nfds = 0;
+  for (int i = 0; i < USBD_MAX_NUM_INTERFACES; i++) {
+    if (usb_ifaces[i].sock < 0) {
+      continue;
+    }
+    // everything written so far goes out before the emulator blocks
+    usb_emulated_flush(i);
+    if (usb_ifaces[i].rx_count > 0) {
+      return;
+    }
+    fds[nfds].fd = usb_ifaces[i].sock;
+    fds[nfds].events = POLLIN;
+    fds[nfds].revents = 0;
+    nfds++;
+  }
+  poll(fds, nfds, timeout_ms);
 }
 
 secbool usb_hid_can_read(uint8_t iface_num) {
@@ -92,6 +92,7 @@ def _from_env(name):
 @click.option("-h", "--headless", is_flag=True, help="Headless mode (no display)")
 @click.option("--heap-size", metavar="SIZE", default="20M", help="Configure heap size")
 @click.option("--main", help="Path to python main file")
+@click.option("--memory-storage", is_flag=True, default=_from_env("TREZOR_PROFILE_MEMORY"), help="Keep flash and SD card in memory only")
 @click.option("--mnemonic", "mnemonics", multiple=True, help="Initialize device with given mnemonic. Specify multiple times for Shamir shares.")
 @click.option("--log-memory/--no-log-memory", default=_from_env("TREZOR_LOG_MEMORY"), help="Print memory usage after workflows")
 @click.option("-o", "--output", type=click.File("w"), default="-", help="Redirect emulator output to file")
@@ -114,6 +115,7 @@ def cli(
     headless,
     heap_size,
     main,
+    memory_storage,
     mnemonics,
     log_memory,
     profile,
@@ -231,6 +233,9 @@ def cli(
     if log_memory:
         os.environ["TREZOR_LOG_MEMORY"] = "1"
 
+    if memory_storage:
+        os.environ["TREZOR_PROFILE_MEMORY"] = "1"
+
     if debugger:
         run_debugger(emulator)
         raise RuntimeError("run_debugger should not return")
@@ -108,6 +108,17 @@ def set(app: int, key: int, value: bytes, public: bool = False) -> None:
     """
 
 
+# extmod/modtrezorconfig/modtrezorconfig.c
+def set_many(
+    app: int, values: Dict[int, bytes], public: bool = False
+) -> None:
+    """
+    Sets the values of several keys of given app at once. The values are
+    appended in one run and the storage authentication tag is updated only
+    once.
+    """
+
+
 # extmod/modtrezorconfig/modtrezorconfig.c
 def delete(app: int, key: int, public: bool = False) -> bool:
     """
@@ -115,6 +126,14 @@ def delete(app: int, key: int, public: bool = False) -> bool:
     """
 
 
+# extmod/modtrezorconfig/modtrezorconfig.c
+def iter(app: int, public: bool = False) -> List[int]:
+    """
+    Returns the sorted list of the keys of the given app which are set,
+    using a single pass over the storage.
+    """
+
+
 # extmod/modtrezorconfig/modtrezorconfig.c
 def set_counter(
     app: int, key: int, count: int, writable_locked: bool = False
@@ -139,3 +158,11 @@ def wipe() -> None:
     """
     Erases the whole config. Use with caution!
     """
+
+
+# extmod/modtrezorconfig/modtrezorconfig.c
+def compact_step() -> bool:
+    """
+    Performs one bounded step of incremental storage compaction. Returns
+    True if more steps are needed to complete it.
+    """
@@ -41,9 +41,12 @@ class blake256:
         Creates a hash context object.
         """
 
-    def update(self, data: bytes) -> None:
+    def update(
+        self, data: bytes, offset: int = 0, length: Optional[int] = None
+    ) -> None:
         """
-        Update the hash context with hashed data.
+        Update the hash context with hashed data. If offset or length are
+        given, only that part of data is hashed, without copying it.
         """
 
     def digest(self) -> bytes:
@@ -51,6 +54,11 @@ class blake256:
         Returns the digest of hashed data.
         """
 
+    def copy(self) -> blake256:
+        """
+        Returns the copy of the digest object with the current state
+        """
+
 
 # extmod/modtrezorcrypto/modtrezorcrypto-blake2b.h
 class blake2b:
@@ -71,9 +79,12 @@ class blake2b:
         Creates a hash context object.
         """
 
-    def update(self, data: bytes) -> None:
+    def update(
+        self, data: bytes, offset: int = 0, length: Optional[int] = None
+    ) -> None:
         """
-        Update the hash context with hashed data.
+        Update the hash context with hashed data. If offset or length are
+        given, only that part of data is hashed, without copying it.
         """
 
     def digest(self) -> bytes:
@@ -81,6 +92,11 @@ class blake2b:
         Returns the digest of hashed data.
         """
 
+    def copy(self) -> blake2b:
+        """
+        Returns the copy of the digest object with the current state
+        """
+
 
 # extmod/modtrezorcrypto/modtrezorcrypto-blake2s.h
 class blake2s:
@@ -101,9 +117,12 @@ class blake2s:
         Creates a hash context object.
         """
 
-    def update(self, data: bytes) -> None:
+    def update(
+        self, data: bytes, offset: int = 0, length: Optional[int] = None
+    ) -> None:
         """
-        Update the hash context with hashed data.
+        Update the hash context with hashed data. If offset or length are
+        given, only that part of data is hashed, without copying it.
         """
 
     def digest(self) -> bytes:
@@ -162,9 +181,12 @@ class groestl512:
         Creates a hash context object.
         """
 
-    def update(self, data: bytes) -> None:
+    def update(
+        self, data: bytes, offset: int = 0, length: Optional[int] = None
+    ) -> None:
         """
-        Update the hash context with hashed data.
+        Update the hash context with hashed data. If offset or length are
+        given, only that part of data is hashed, without copying it.
         """
 
     def digest(self) -> bytes:
@@ -217,9 +239,12 @@ class ripemd160:
         Creates a hash context object.
         """
 
-    def update(self, data: bytes) -> None:
+    def update(
+        self, data: bytes, offset: int = 0, length: Optional[int] = None
+    ) -> None:
         """
-        Update the hash context with hashed data.
+        Update the hash context with hashed data. If offset or length are
+        given, only that part of data is hashed, without copying it.
         """
 
     def digest(self) -> bytes:
@@ -228,6 +253,14 @@ class ripemd160:
         """
 
 
+# extmod/modtrezorcrypto/modtrezorcrypto-ripemd160.h
+def hash160(data: bytes) -> bytes:
+    """
+    Returns RIPEMD160(SHA256(data)) in one call, without creating the two
+    hash context objects.
+    """
+
+
 # extmod/modtrezorcrypto/modtrezorcrypto-sha1.h
 class sha1:
     """
@@ -241,9 +274,12 @@ class sha1:
         Creates a hash context object.
         """
 
-    def update(self, data: bytes) -> None:
+    def update(
+        self, data: bytes, offset: int = 0, length: Optional[int] = None
+    ) -> None:
         """
-        Update the hash context with hashed data.
+        Update the hash context with hashed data. If offset or length are
+        given, only that part of data is hashed, without copying it.
         """
 
     def digest(self) -> bytes:
@@ -265,9 +301,12 @@ class sha256:
         Creates a hash context object.
         """
 
-    def update(self, data: bytes) -> None:
+    def update(
+        self, data: bytes, offset: int = 0, length: Optional[int] = None
+    ) -> None:
         """
-        Update the hash context with hashed data.
+        Update the hash context with hashed data. If offset or length are
+        given, only that part of data is hashed, without copying it.
         """
 
     def digest(self) -> bytes:
@@ -275,6 +314,11 @@ class sha256:
         Returns the digest of hashed data.
         """
 
+    def copy(self) -> sha256:
+        """
+        Returns the copy of the digest object with the current state
+        """
+
 
 # extmod/modtrezorcrypto/modtrezorcrypto-sha3-256.h
 class sha3_256:
@@ -289,9 +333,25 @@ class sha3_256:
         Creates a hash context object.
         """
 
-    def update(self, data: bytes) -> None:
+    def update(
+        self, data: bytes, offset: int = 0, length: Optional[int] = None
+    ) -> None:
         """
-        Update the hash context with hashed data.
+        Update the hash context with hashed data. If offset or length are
+        given, only that part of data is hashed, without copying it.
+        """
+
+    def update_rlp(self, data: Union[bytes, int]) -> None:
+        """
+        Update the hash context with the RLP encoding of a string, without
+        building the encoding. Integers are encoded as big endian strings
+        without leading zeros.
+        """
+
+    def update_rlp_length(self, length: int, is_list: bool) -> None:
+        """
+        Update the hash context with the RLP header of a string or a list
+        whose encoded content is length bytes long.
         """
 
     def digest(self) -> bytes:
@@ -318,9 +378,12 @@ class sha3_512:
         Creates a hash context object.
         """
 
-    def update(self, data: bytes) -> None:
+    def update(
+        self, data: bytes, offset: int = 0, length: Optional[int] = None
+    ) -> None:
         """
-        Update the hash context with hashed data.
+        Update the hash context with hashed data. If offset or length are
+        given, only that part of data is hashed, without copying it.
         """
 
     def digest(self) -> bytes:
@@ -347,12 +410,75 @@ class sha512:
         Creates a hash context object.
         """
 
-    def update(self, data: bytes) -> None:
+    def update(
+        self, data: bytes, offset: int = 0, length: Optional[int] = None
+    ) -> None:
         """
-        Update the hash context with hashed data.
+        Update the hash context with hashed data. If offset or length are
+        given, only that part of data is hashed, without copying it.
         """
 
     def digest(self) -> bytes:
         """
         Returns the digest of hashed data.
         """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-sighash143.h
+class sighash143:
+    """
+    Signature hash of BIP-143 (segwit) or ZIP-143/ZIP-243 (Zcash)
+    transaction inputs.
+    """
+
+    def __init__(self, double: bool = False, zcash: bool = False) -> None:
+        """
+        Creates a signature hash context. BIP-143 uses SHA256, applied twice
+        if double is set. ZIP-143 and ZIP-243 use personalized BLAKE2b.
+        """
+
+    def add_input(
+        self, prev_hash: bytes, prev_index: int, sequence: int
+    ) -> None:
+        """
+        Adds the outpoint and the sequence number of a transaction input.
+        """
+
+    def add_output(self, amount: int, script_pubkey: bytes) -> None:
+        """
+        Adds the amount and the script of a transaction output.
+        """
+
+    def prevouts_hash(self) -> bytes:
+        """
+        Returns the hash of the outpoints added so far.
+        """
+
+    def sequence_hash(self) -> bytes:
+        """
+        Returns the hash of the sequence numbers added so far.
+        """
+
+    def outputs_hash(self) -> bytes:
+        """
+        Returns the hash of the outputs added so far.
+        """
+
+    def preimage_hash(
+        self,
+        prev_hash: bytes,
+        prev_index: int,
+        script_code: bytes,
+        amount: int,
+        sequence: int,
+        version: int,
+        lock_time: int,
+        hash_type: int,
+        version_group_id: int = 0,
+        expiry: int = 0,
+        branch_id: int = 0,
+    ) -> bytes:
+        """
+        Returns the signature hash of the given input. The last three
+        arguments are used only by Zcash, where version must be 3 or 4.
+        """
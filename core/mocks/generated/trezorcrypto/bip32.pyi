@@ -16,6 +16,7 @@ class HDNode:
         private_key: bytes = None,
         public_key: bytes = None,
         curve_name: str = None,
+        private_key_ext: bytes = None,
     ) -> None:
         """
         """
@@ -25,15 +26,39 @@ class HDNode:
         Derive a BIP0032 child node in place.
         """
 
+    def derive_public_keys(self, index: int, count: int) -> List[bytes]:
+        """
+        Derive the children index, ..., index + count - 1 with private
+        derivation and return their public keys. No child nodes are
+        allocated and the node itself is not modified.
+        """
+
     def derive_cardano(self, index: int) -> None:
         """
         Derive a BIP0032 child node in place using Cardano algorithm.
         """
 
-    def derive_path(self, path: List[int]) -> None:
+    def derive_cardano_batch(self, index: int, count: int) -> List[HDNode]:
+        """
+        Derive the children index, ..., index + count - 1 using Cardano
+        algorithm and return them as new nodes with public keys filled in.
+        The node itself is not modified.
+        """
+
+    def derive_path(self, path: List[int], public: bool = False) -> None:
         """
         Go through a list of indexes and iteratively derive a child node in
-        place.
+        place. Public derivation goes through the BIP32 cache, so deriving
+        many paths under one xpub recomputes the shared parent only once.
+        """
+
+    def derive_path_into(
+        self, dst: HDNode, path: List[int], public: bool = False
+    ) -> None:
+        """
+        Copy the node into dst and derive the path there, like clone()
+        followed by derive_path() but without allocating a new node. The
+        node itself is not modified.
         """
 
     def serialize_public(self, version: int) -> str:
@@ -5,4 +5,6 @@ from typing import *
 def crc32(data: bytes, crc: int = 0) -> int:
     """
     Computes a CRC32 checksum of `data`.
+    Pass the previous result as `crc` to continue the checksum over
+    another chunk, so crc32(b, crc32(a)) == crc32(a + b).
     """
@@ -244,6 +244,15 @@ def ge25519_scalarmult_base(
     """
 
 
+# extmod/modtrezorcrypto/modtrezorcrypto-monero.h
+def ge25519_scalarmult_h(
+    r: Optional[Ge25519], s: Union[Sc25519, int]
+) -> Ge25519:
+    """
+    s * H
+    """
+
+
 # extmod/modtrezorcrypto/modtrezorcrypto-monero.h
 def ge25519_scalarmult(
     r: Optional[Ge25519], p: Ge25519, s: Union[Sc25519, int]
@@ -386,6 +395,43 @@ def xmr_add_keys3_vartime(
     """
 
 
+# extmod/modtrezorcrypto/modtrezorcrypto-monero.h
+def xmr_multi_scalarmult(r: Optional[Ge25519], points: List[Ge25519], scalars: List[Sc25519]) -> Ge25519:
+    """
+    sum_i scalars_i points_i, constant time
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-monero.h
+def xmr_multi_scalarmult_vartime(r: Optional[Ge25519], points: List[Ge25519], scalars: List[Sc25519]) -> Ge25519:
+    """
+    sum_i scalars_i points_i
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-monero.h
+def xmr_sc_fold_vct(dst: bytearray, lo: bytes, hi: bytes, a: Sc25519, b: Sc25519) -> None:
+    """
+    dst_i = a lo_i + b hi_i over packed scalars, for i < len(dst) / 32.
+    dst may be the same buffer as lo.
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-monero.h
+def xmr_sc_muladd_vct(r: Sc25519, a: bytes, b: bytes) -> Sc25519:
+    """
+    r += sum_i a_i b_i over packed scalars, for i < len(a) / 32
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-monero.h
+def xmr_add_keys3_vct(dst: bytearray, a: Sc25519, A: bytes, b: Sc25519, B: bytes) -> None:
+    """
+    dst_i = a A_i + b B_i over packed points, for i < len(dst) / 32.
+    dst may be the same buffer as A.
+    """
+
+
 # extmod/modtrezorcrypto/modtrezorcrypto-monero.h
 def xmr_get_subaddress_secret_key(
     r: Optional[Sc25519], major: int, minor: int, m: Sc25519
@@ -402,8 +448,42 @@ def xmr_gen_c(r: Optional[Ge25519], a: Sc25519, amount: int) -> Ge25519:
     """
 
 
+# extmod/modtrezorcrypto/modtrezorcrypto-monero.h
+def xmr_gen_mlsag_simple(message: bytes, ring: bytes, x: Sc25519, z: Sc25519, Cout: Ge25519, index: int) -> Tuple[bytes, bytes]:
+    """
+    MLSAG for RctType.Simple over the ring of packed (P_i || C_i) pairs,
+    returns (ss, cc) with 2 packed scalars per ring member in ss
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-monero.h
+def xmr_gen_clsag_simple(message: bytes, ring: bytes, p: Sc25519, z: Sc25519, Cout: Ge25519, index: int) -> Tuple[bytes, bytes, bytes]:
+    """
+    CLSAG for RctType.Simple over the ring of packed (P_i || C_i) pairs,
+    returns (ss, c1, D) with 1 packed scalar per ring member in ss
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-monero.h
+def xmr_export_key_images(spend_key: Sc25519, out_keys: bytes, derivations: List[Ge25519], indices: List[int], subaddr_keys: List[Optional[Sc25519]]) -> bytes:
+    """
+    Key images of owned outputs with their signatures, packed as
+    (ki || c || r) per output. out_keys are packed, subaddr_keys are None
+    for the main address.
+    """
+
+
 # extmod/modtrezorcrypto/modtrezorcrypto-monero.h
 def ct_equals(a: bytes, b: bytes) -> bool:
     """
     Constant time buffer comparison
     """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-monero.h
+def xmr_prove_range_bulletproof(amounts: List[int], masks: List[Sc25519]) -> Tuple[List[bytes], bytes, bytes, bytes, bytes, bytes, bytes, List[bytes], List[bytes], bytes, bytes, bytes]:
+    """
+    Bulletproof range proof of the amounts with the given commitment masks,
+    returns (V, A, S, T1, T2, taux, mu, L, R, a, b, t). At most two
+    amounts are supported.
+    """
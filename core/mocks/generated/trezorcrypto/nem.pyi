@@ -13,3 +13,167 @@ def compute_address(public_key: bytes, network: int) -> str:
     """
     Compute a NEM address from a public key
     """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-nem.h
+def serialize_transfer(
+    network: int,
+    timestamp: int,
+    signer: bytes,
+    fee: int,
+    deadline: int,
+    recipient: str,
+    amount: int,
+    payload: Optional[bytes],
+    encrypted: bool,
+    mosaics: int,
+) -> bytes:
+    """
+    Serialize a transfer, without the mosaics that follow it.
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-nem.h
+def serialize_mosaic(namespace: str, mosaic: str, quantity: int) -> bytes:
+    """
+    Serialize a mosaic attached to a transfer.
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-nem.h
+def serialize_importance_transfer(
+    network: int,
+    timestamp: int,
+    signer: bytes,
+    fee: int,
+    deadline: int,
+    mode: int,
+    remote: bytes,
+) -> bytes:
+    """
+    Serialize an importance transfer.
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-nem.h
+def serialize_aggregate_modification(
+    network: int,
+    timestamp: int,
+    signer: bytes,
+    fee: int,
+    deadline: int,
+    modifications: int,
+    relative_change: bool,
+) -> bytes:
+    """
+    Serialize an aggregate modification, without the cosignatory
+    modifications and the minimum cosignatories that follow it.
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-nem.h
+def serialize_cosignatory_modification(
+    type: int, cosignatory: bytes
+) -> bytes:
+    """
+    Serialize a cosignatory modification of an aggregate modification.
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-nem.h
+def serialize_minimum_cosignatories(relative_change: int) -> bytes:
+    """
+    Serialize the change of the minimum number of cosignatories.
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-nem.h
+def serialize_provision_namespace(
+    network: int,
+    timestamp: int,
+    signer: bytes,
+    fee: int,
+    deadline: int,
+    namespace: str,
+    parent: Optional[str],
+    sink: str,
+    rental_fee: int,
+) -> bytes:
+    """
+    Serialize a namespace provision.
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-nem.h
+def serialize_mosaic_creation(
+    network: int,
+    timestamp: int,
+    signer: bytes,
+    fee: int,
+    deadline: int,
+    namespace: str,
+    mosaic: str,
+    description: str,
+    divisibility: int,
+    supply: int,
+    mutable_supply: bool,
+    transferable: bool,
+    levy: int,
+    levy_fee: int,
+    levy_address: Optional[str],
+    levy_namespace: Optional[str],
+    levy_mosaic: Optional[str],
+    sink: str,
+    creation_fee: int,
+) -> bytes:
+    """
+    Serialize a mosaic definition creation. The levy fields are only used
+    if levy is not zero.
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-nem.h
+def serialize_mosaic_supply_change(
+    network: int,
+    timestamp: int,
+    signer: bytes,
+    fee: int,
+    deadline: int,
+    namespace: str,
+    mosaic: str,
+    type: int,
+    delta: int,
+) -> bytes:
+    """
+    Serialize a mosaic supply change.
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-nem.h
+def serialize_multisig(
+    network: int,
+    timestamp: int,
+    signer: bytes,
+    fee: int,
+    deadline: int,
+    inner: bytes,
+) -> bytes:
+    """
+    Wrap the serialized inner transaction in a multisig transaction.
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-nem.h
+def serialize_multisig_signature(
+    network: int,
+    timestamp: int,
+    signer: bytes,
+    fee: int,
+    deadline: int,
+    inner: bytes,
+    inner_signer: bytes,
+) -> bytes:
+    """
+    Serialize the cosignature of the serialized inner transaction signed by
+    the multisig account inner_signer.
+    """
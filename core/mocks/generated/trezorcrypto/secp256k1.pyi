@@ -51,3 +51,38 @@ def multiply(secret_key: bytes, public_key: bytes) -> bytes:
     Multiplies point defined by public_key with scalar defined by
     secret_key. Useful for ECDH.
     """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-secp256k1.h
+def schnorr_publickey(secret_key: bytes) -> bytes:
+    """
+    Computes the 32-byte BIP-340 public key from secret key.
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-secp256k1.h
+def sign_schnorr(secret_key: bytes, digest: bytes) -> bytes:
+    """
+    Uses secret key to produce the BIP-340 signature of the digest.
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-secp256k1.h
+def verify_schnorr(
+    public_key: bytes, signature: bytes, digest: bytes
+) -> bool:
+    """
+    Uses the 32-byte public key to verify the BIP-340 signature of the
+    digest. Returns True on success.
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-secp256k1.h
+def verify_schnorr_batch(
+    public_keys: List[bytes], signatures: List[bytes], digests: List[bytes]
+) -> bool:
+    """
+    Verifies the BIP-340 signatures of the digests, BIP340_VERIFY_BATCH_SIZE
+    at a time with one multi-scalar multiplication. Returns True if all of
+    them are valid.
+    """
@@ -10,7 +10,8 @@ class Context:
 
     def __init__(self) -> None:
         """
-        Allocate and initialize secp256k1_context.
+        Allocate and initialize secp256k1_context. The verification tables are
+        built lazily on the first verify or verify_recover call.
         """
 
     def __del__(self) -> None:
@@ -20,7 +21,8 @@ class Context:
 
     def size(self) -> int:
         """
-        Return the size in bytes of the internal secp256k1_ctx_buf buffer.
+        Return the size in bytes of the internal secp256k1_ctx_buf buffer,
+        including the verification tables if they have been built.
         """
 
     def generate_secret(self) -> bytes:
@@ -13,3 +13,14 @@ def interpolate(shares: List[Tuple[int, bytes]], x: int) -> bytes:
     :return: Evaluations of the polynomials in x.
     :rtype: Array of bytes.
     """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-shamir.h
+def interpolate_multi(
+    shares: List[Tuple[int, bytes]], xs: Sequence[int]
+) -> List[bytes]:
+    """
+    Returns [f(x) for x in xs] given the Shamir shares (x_1, f(x_1)), ... ,
+    (x_k, f(x_k)). Faster than calling interpolate() for each x, because
+    the work which does not depend on x is done only once.
+    """
@@ -33,3 +33,44 @@ def get_word(index: int) -> str:
     """
     Returns word on position 'index'.
     """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-slip39.h
+def rs1024_verify_checksum(data: Sequence[int]) -> bool:
+    """
+    Verifies the RS1024 checksum of the word indices of a mnemonic, the
+    last three of which are the checksum.
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-slip39.h
+def rs1024_create_checksum(data: Sequence[int]) -> Tuple[int, int, int]:
+    """
+    Returns the RS1024 checksum of the word indices of a mnemonic.
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-slip39.h
+def encrypt(
+    master_secret: bytes,
+    passphrase: bytes,
+    iteration_exponent: int,
+    identifier: int,
+) -> bytes:
+    """
+    Converts the Master Secret to the Encrypted Master Secret by applying
+    the passphrase with the Feistel network of SLIP-39.
+    """
+
+
+# extmod/modtrezorcrypto/modtrezorcrypto-slip39.h
+def decrypt(
+    encrypted_master_secret: bytes,
+    passphrase: bytes,
+    iteration_exponent: int,
+    identifier: int,
+) -> bytes:
+    """
+    Converts the Encrypted Master Secret to the Master Secret by applying
+    the passphrase with the Feistel network of SLIP-39.
+    """
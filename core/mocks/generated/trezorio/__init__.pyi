@@ -66,6 +66,17 @@ class HID:
         Sends message using USB HID (device) or UDP (emulator).
         """
 
+    def write_ctaphid(
+        self, cid: int, cmd: int, data: bytes, offset: int, timeout_ms: int = 0
+    ) -> int:
+        """
+        Sends the CTAPHID frame of `data` that starts at `offset`, that is
+        the initialization frame of command `cmd` if `offset` is 0, otherwise
+        the continuation frame with the matching sequence number. Waits for
+        the interface up to `timeout_ms` if it is set. Returns the offset of
+        the next frame, or `offset` if the frame was not sent.
+        """
+
 
 # extmod/modtrezorio/modtrezorio-poll.h
 def poll(ifaces: Iterable[int], list_ref: List, timeout_ms: int) -> bool:
@@ -80,6 +91,14 @@ def poll(ifaces: Iterable[int], list_ref: List, timeout_ms: int) -> bool:
     """
 
 
+# extmod/modtrezorio/modtrezorio-poll.h
+def poll_stats() -> Tuple[int, int, int]:
+    """
+    Returns the number of `poll` calls, of wakeups while waiting and of
+    calls that returned an event, counted since boot.
+    """
+
+
 # extmod/modtrezorio/modtrezorio-sbu.h
 class SBU:
     """
@@ -68,6 +68,22 @@ class Display:
         AVATAR_IMAGE_SIZE pixels size.
         """
 
+    def avatar_preload(
+        self, image: Optional[bytes], fgcolor: int, bgcolor: int
+    ) -> bool:
+        """
+        Decompresses the avatar and renders its border into RAM once, so that
+        avatar_preloaded() draws it without inflating the image again. The
+        image has the same format as for avatar(). None frees the memory.
+        Returns False if the port cannot keep a preloaded avatar.
+        """
+
+    def avatar_preloaded(self, x: int, y: int) -> bool:
+        """
+        Renders the avatar loaded by avatar_preload() at position (x,y).
+        Returns False and draws nothing if there is no preloaded avatar.
+        """
+
     def icon(
         self, x: int, y: int, icon: bytes, fgcolor: int, bgcolor: int
     ) -> None:
@@ -184,6 +200,17 @@ class Display:
         Call without the val parameter to just perform the read of the value.
         """
 
+    def backlight_fade(self, val: int, duration: int) -> None:
+        """
+        Starts fading the backlight intensity to val over duration milliseconds
+        and returns immediately. Setting the backlight cancels the fade.
+        """
+
+    def backlight_fading(self) -> bool:
+        """
+        Returns True while a fade started by backlight_fade is running.
+        """
+
     def offset(self, xy: Tuple[int, int] = None) -> Tuple[int, int]:
         """
         Sets offset (x, y) for all subsequent drawing calls.
@@ -195,6 +222,24 @@ class Display:
         Saves current display contents to PNG file with given prefix.
         """
 
+    def save_frame(self) -> None:
+        """
+        Hashes current display contents and keeps them in memory instead of
+        saving them to a PNG file.
+        """
+
+    def save_kept(self, prefix: str) -> None:
+        """
+        Saves display contents kept by save_frame to PNG files with given
+        prefix.
+        """
+
+    def save_hash(self) -> bytes:
+        """
+        Returns SHA-256 of the raw contents of all distinct frames saved since
+        the last clear_save.
+        """
+
     def clear_save(self) -> None:
         """
         Clears buffers in display saving.
@@ -22,11 +22,74 @@ def memcpy(
     """
 
 
+# extmod/modtrezorutils/modtrezorutils.c
+def write_uint(
+    w: Any, n: int, length: int, big_endian: bool = False
+) -> int:
+    """
+    Writes the `length` lowest bytes of `n` to `w` with a single
+    `w.extend()` call, in little endian order unless `big_endian` is set.
+    Returns `length`.
+    """
+
+
+# extmod/modtrezorutils/modtrezorutils.c
+def match_path(pattern: bytes, path: Sequence[int]) -> int:
+    """
+    Matches `path` against the alternatives of a pattern compiled by
+    `apps.common.paths.compile_pattern()`. Returns the index of the first
+    matching alternative, or -1 if no alternative matches.
+    """
+
+
 # extmod/modtrezorutils/modtrezorutils.c
 def halt(msg: str = None) -> None:
     """
     Halts execution.
     """
+
+
+# extmod/modtrezorutils/modtrezorutils.c
+def boottime_mark(stage: int) -> None:
+    """
+    Records the time of a boot stage, see `boottime()`.
+    """
+
+
+# extmod/modtrezorutils/modtrezorutils.c
+def boottime() -> Tuple[int, ...]:
+    """
+    Returns the milliseconds since the boardloader started at which each
+    stage of the last cold boot was reached, up to the Python apps.
+    Unreached stages, and all stages on the emulator and in production
+    builds, are 0.
+    """
+
+
+# extmod/modtrezorutils/modtrezorutils.c
+def cycles() -> int:
+    """
+    Returns the CPU cycle counter, which wraps after 2^32 cycles. The
+    emulator returns nanoseconds of the host clock instead.
+    """
+
+
+# extmod/modtrezorutils/modtrezorutils.c
+def trace(tag: int, arg: int = 0) -> None:
+    """
+    Pushes an event into the trace ring buffer, see `trace_dump()`. The
+    tag must be lower than 0x8000. Does nothing unless built with TRACE=1.
+    """
+
+
+# extmod/modtrezorutils/modtrezorutils.c
+def trace_dump(clear: bool = False) -> bytes:
+    """
+    Returns the events in the trace ring buffer, oldest first, as packed
+    little endian (cycles: uint32, tag: uint16, arg: uint16) records.
+    Events pushed from Python have 0x8000 added to their tag. The buffer
+    is emptied afterwards if `clear` is set.
+    """
 GITREV: str
 VERSION_MAJOR: int
 VERSION_MINOR: int
@@ -34,3 +97,5 @@ VERSION_PATCH: int
 MODEL: str
 EMULATOR: bool
 BITCOIN_ONLY: bool
+BOOTTIME_STORAGE_UNLOCKED: int
+BOOTTIME_APPS_IMPORTED: int
@@ -1,7 +1,9 @@
+import gc
 import sys
 
 from uio import open
 from uos import getenv
+from utime import ticks_diff, ticks_us
 
 # We need to insert "" to sys.path so that the frozen build can import main from the
 # frozen modules, and regular build can import it from current directory.
@@ -9,6 +11,9 @@ sys.path.insert(0, "")
 
 PATH_PREFIX = (getenv("TREZOR_SRC") or ".") + "/"
 
+# number of functions listed in the summary printed at exit
+PROFILE_TOP = 40
+
 
 class Coverage:
     def __init__(self):
@@ -30,10 +35,71 @@ class Coverage:
         return lines_execution
 
 
+class Profile:
+    """
+    Per-function timing from the call and return trace events. Coroutines
+    are counted once per resumption, i.e. a call is one step of the task.
+    Allocations are the growth of the GC heap, so a collection inside a call
+    can make them undercount. The tracer itself runs inside the measured
+    time, which inflates small, frequently called functions. Recursive calls
+    add to the cumulative time of every level.
+    """
+
+    def __init__(self):
+        # key -> [calls, cumulative us, self us, allocated bytes]
+        self.__functions = {}
+        # path of names -> self us, for the collapsed-stack export
+        self.__stacks = {}
+        # [code, key, path, start us, children us, start alloc]
+        self.__frames = []
+
+    def call(self, code):
+        key = "%s:%d(%s)" % (code.co_filename, code.co_firstlineno, code.co_name)
+        if self.__frames:
+            path = self.__frames[-1][2] + ";" + key
+        else:
+            path = key
+        self.__frames.append([code, key, path, ticks_us(), 0, gc.mem_alloc()])
+
+    def ret(self, code):
+        frames = self.__frames
+        # drop frames left behind by returns that were never traced
+        while frames and frames[-1][0] is not code:
+            frames.pop()
+        if not frames:
+            return
+        _, key, path, start, children, alloc = frames.pop()
+        elapsed = ticks_diff(ticks_us(), start)
+        own = elapsed - children
+        alloc = max(0, gc.mem_alloc() - alloc)
+        stats = self.__functions.get(key)
+        if stats is None:
+            stats = self.__functions[key] = [0, 0, 0, 0]
+        stats[0] += 1
+        stats[1] += elapsed
+        stats[2] += own
+        stats[3] += alloc
+        self.__stacks[path] = self.__stacks.get(path, 0) + own
+        if frames:
+            frames[-1][4] += elapsed
+
+    def report(self, limit):
+        print("  calls    cum us   self us   alloc B  function")
+        items = sorted(self.__functions.items(), key=lambda i: i[1][2], reverse=True)
+        for key, (calls, cum, own, alloc) in items[:limit]:
+            print("%7d %9d %9d %9d  %s" % (calls, cum, own, alloc, key))
+
+    def write_collapsed(self, f):
+        # one "frame;frame;frame value" line per stack, as read by flamegraph.pl
+        for path, own in self.__stacks.items():
+            f.write("%s %d\n" % (path, own))
+
+
 class _Prof:
     trace_count = 0
     display_flags = 0
     __coverage = Coverage()
+    __profile = Profile()
 
     def trace_tick(self, frame, event, arg):
         self.trace_count += 1
@@ -43,10 +109,17 @@ class _Prof:
 
         if event == "line":
             self.__coverage.line_tick(frame.f_code.co_filename, frame.f_lineno)
+        elif event == "call":
+            self.__profile.call(frame.f_code)
+        elif event == "return":
+            self.__profile.ret(frame.f_code)
 
     def coverage_data(self):
         return self.__coverage.lines_execution()
 
+    def profile(self):
+        return self.__profile
+
 
 def trace_handler(frame, event, arg):
     __prof__.trace_tick(frame, event, arg)
@@ -62,6 +135,10 @@ def atexit():
         # poormans json
         f.write(str(__prof__.coverage_data()).replace("'", '"'))
 
+    __prof__.profile().report(PROFILE_TOP)
+    with open(".profile.collapsed", "w") as f:
+        __prof__.profile().write_collapsed(f)
+
 
 sys.atexit(atexit)
 
@@ -3,13 +3,15 @@ import storage.device
 import storage.recovery
 import storage.sd_salt
 from storage import cache
-from trezor import config, sdcard, utils, wire, workflow
+from trezor import config, loop, sdcard, utils, wire, workflow
 from trezor.messages import Capability, MessageType
 from trezor.messages.Features import Features
 from trezor.messages.Success import Success
 
+from apps import workflow_handlers
 from apps.common import mnemonic
 from apps.common.request_pin import verify_user_pin
+from apps.common.seed import clear_root_cache
 
 if False:
     import protobuf
@@ -20,6 +22,11 @@ if False:
     from trezor.messages.LockDevice import LockDevice
     from trezor.messages.Ping import Ping
 
+# Storage compaction runs after this period of inactivity, with a pause between
+# the steps, so that the event loop stays responsive.
+_STORAGE_COMPACT_IDLE_MS = 2000
+_STORAGE_COMPACT_STEP_MS = 20
+
 
 def get_features() -> Features:
     f = Features()
@@ -143,11 +150,23 @@ def set_homescreen() -> None:
 def lock_device() -> None:
     if config.has_pin():
         config.lock()
+        clear_root_cache()
+        cache.clear_sessions()
         wire.find_handler = get_pinlocked_handler
         set_homescreen()
         workflow.close_others()
 
 
+async def compact_storage_task() -> None:
+    while config.compact_step():
+        await loop.sleep(_STORAGE_COMPACT_STEP_MS)
+
+
+def compact_storage() -> None:
+    """Compact the storage in small steps, so that writes rarely have to."""
+    loop.schedule(compact_storage_task())
+
+
 async def unlock_device(ctx: wire.GenericContext = wire.DUMMY_CONTEXT) -> None:
     """Ensure the device is in unlocked state.
 
@@ -159,13 +178,13 @@ async def unlock_device(ctx: wire.GenericContext = wire.DUMMY_CONTEXT) -> None:
         await verify_user_pin(ctx)
 
     set_homescreen()
-    wire.find_handler = wire.find_registered_workflow_handler
+    wire.find_handler = workflow_handlers.find_registered_handler
 
 
 def get_pinlocked_handler(
     iface: wire.WireInterface, msg_type: int
 ) -> Optional[wire.Handler[wire.Msg]]:
-    orig_handler = wire.find_registered_workflow_handler(iface, msg_type)
+    orig_handler = workflow_handlers.find_registered_handler(iface, msg_type)
     if orig_handler is None:
         return None
 
@@ -195,3 +214,4 @@ def boot() -> None:
     wire.register(MessageType.Ping, handle_Ping)
 
     workflow.idle_timer.set(storage.device.get_autolock_delay_ms(), lock_device)
+    workflow.idle_timer.set(_STORAGE_COMPACT_IDLE_MS, compact_storage)
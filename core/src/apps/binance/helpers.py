@@ -3,80 +3,122 @@ from micropython import const
 from trezor.crypto import bech32
 from trezor.crypto.scripts import sha256_ripemd160_digest
 from trezor.messages.BinanceCancelMsg import BinanceCancelMsg
-from trezor.messages.BinanceInputOutput import BinanceInputOutput
 from trezor.messages.BinanceOrderMsg import BinanceOrderMsg
 from trezor.messages.BinanceSignTx import BinanceSignTx
 from trezor.messages.BinanceTransferMsg import BinanceTransferMsg
 
-from apps.common import HARDENED
+from apps.common import HARDENED, paths
 
-ENVELOPE_BLUEPRINT = '{{"account_number":"{account_number}","chain_id":"{chain_id}","data":null,"memo":"{memo}","msgs":[{msgs}],"sequence":"{sequence}","source":"{source}"}}'
-MSG_TRANSFER_BLUEPRINT = '{{"inputs":[{inputs}],"outputs":[{outputs}]}}'
-MSG_NEWORDER_BLUEPRINT = '{{"id":"{id}","ordertype":{ordertype},"price":{price},"quantity":{quantity},"sender":"{sender}","side":{side},"symbol":"{symbol}","timeinforce":{timeinforce}}}'
-MSG_CANCEL_BLUEPRINT = '{{"refid":"{refid}","sender":"{sender}","symbol":"{symbol}"}}'
-INPUT_OUTPUT_BLUEPRINT = '{{"address":"{address}","coins":[{coins}]}}'
-COIN_BLUEPRINT = '{{"amount":{amount},"denom":"{denom}"}}'
+if False:
+    from trezor.utils import Writer
 
 # 1*10^8 Jagers equal 1 BNB https://www.binance.vision/glossary/jager
 DECIMALS = const(8)
 
 
-def produce_json_for_signing(envelope: BinanceSignTx, msg) -> str:
+def write_json_for_signing(w: Writer, envelope: BinanceSignTx, msg) -> None:
+    """
+    Writes the JSON that is signed piece by piece, so that it can go straight
+    into the hash context without ever being built as one string.
+    """
     if isinstance(msg, BinanceTransferMsg):
-        json_msg = produce_transfer_json(msg)
+        write_msg = write_transfer_json
     elif isinstance(msg, BinanceOrderMsg):
-        json_msg = produce_neworder_json(msg)
+        write_msg = write_neworder_json
     elif isinstance(msg, BinanceCancelMsg):
-        json_msg = produce_cancel_json(msg)
+        write_msg = write_cancel_json
     else:
         raise ValueError("input message unrecognized, is of type " + type(msg).__name__)
 
     if envelope.source is None or envelope.source < 0:
         raise ValueError("source missing or invalid")
 
-    source = envelope.source
-
-    return ENVELOPE_BLUEPRINT.format(
-        account_number=envelope.account_number,
-        chain_id=envelope.chain_id,
-        memo=envelope.memo,
-        msgs=json_msg,
-        sequence=envelope.sequence,
-        source=source,
+    _write(
+        w,
+        b'{"account_number":"',
+        envelope.account_number,
+        b'","chain_id":"',
+        envelope.chain_id,
+        b'","data":null,"memo":"',
+        envelope.memo,
+        b'","msgs":[',
+    )
+    write_msg(w, msg)
+    _write(
+        w, b'],"sequence":"', envelope.sequence, b'","source":"', envelope.source, b'"}'
     )
 
 
-def produce_transfer_json(msg: BinanceTransferMsg) -> str:
-    def make_input_output(input_output: BinanceInputOutput):
-        coins = ",".join(
-            COIN_BLUEPRINT.format(amount=c.amount, denom=c.denom)
-            for c in input_output.coins
-        )
-        return INPUT_OUTPUT_BLUEPRINT.format(address=input_output.address, coins=coins)
+def produce_json_for_signing(envelope: BinanceSignTx, msg) -> str:
+    w = bytearray()
+    write_json_for_signing(w, envelope, msg)
+    return bytes(w).decode()
+
+
+def write_transfer_json(w: Writer, msg: BinanceTransferMsg) -> None:
+    w.extend(b'{"inputs":[')
+    _write_inputs_outputs(w, msg.inputs)
+    w.extend(b'],"outputs":[')
+    _write_inputs_outputs(w, msg.outputs)
+    w.extend(b"]}")
+
+
+def write_neworder_json(w: Writer, msg: BinanceOrderMsg) -> None:
+    _write(
+        w,
+        b'{"id":"',
+        msg.id,
+        b'","ordertype":',
+        msg.ordertype,
+        b',"price":',
+        msg.price,
+        b',"quantity":',
+        msg.quantity,
+        b',"sender":"',
+        msg.sender,
+        b'","side":',
+        msg.side,
+        b',"symbol":"',
+        msg.symbol,
+        b'","timeinforce":',
+        msg.timeinforce,
+        b"}",
+    )
 
-    inputs = ",".join(make_input_output(i) for i in msg.inputs)
-    outputs = ",".join(make_input_output(o) for o in msg.outputs)
 
-    return MSG_TRANSFER_BLUEPRINT.format(inputs=inputs, outputs=outputs)
+def write_cancel_json(w: Writer, msg: BinanceCancelMsg) -> None:
+    _write(
+        w,
+        b'{"refid":"',
+        msg.refid,
+        b'","sender":"',
+        msg.sender,
+        b'","symbol":"',
+        msg.symbol,
+        b'"}',
+    )
 
 
-def produce_neworder_json(msg: BinanceOrderMsg) -> str:
-    return MSG_NEWORDER_BLUEPRINT.format(
-        id=msg.id,
-        ordertype=msg.ordertype,
-        price=msg.price,
-        quantity=msg.quantity,
-        sender=msg.sender,
-        side=msg.side,
-        symbol=msg.symbol,
-        timeinforce=msg.timeinforce,
-    )
+def _write_inputs_outputs(w: Writer, inputs_outputs: list) -> None:
+    for i, input_output in enumerate(inputs_outputs):
+        if i:
+            w.extend(b",")
+        _write(w, b'{"address":"', input_output.address, b'","coins":[')
+        for j, coin in enumerate(input_output.coins):
+            if j:
+                w.extend(b",")
+            _write(w, b'{"amount":', coin.amount, b',"denom":"', coin.denom, b'"}')
+        w.extend(b"]}")
 
 
-def produce_cancel_json(msg: BinanceCancelMsg) -> str:
-    return MSG_CANCEL_BLUEPRINT.format(
-        refid=msg.refid, sender=msg.sender, symbol=msg.symbol
-    )
+def _write(w: Writer, *parts) -> None:
+    # the literal JSON parts are bytes, the values are formatted as str.format()
+    # would format them
+    for part in parts:
+        if isinstance(part, bytes):
+            w.extend(part)
+        else:
+            w.extend(str(part).encode())
 
 
 def address_from_public_key(pubkey: bytes, hrp: str) -> str:
@@ -93,6 +135,11 @@ def address_from_public_key(pubkey: bytes, hrp: str) -> str:
     return bech32.bech32_encode(hrp, convertedbits)
 
 
+_PATH_PATTERN = paths.compile_pattern(
+    (5, 5, (44 | HARDENED, 714 | HARDENED, paths.hardened(0, 1000000), 0, 0))
+)
+
+
 def validate_full_path(path: list) -> bool:
     """
     Validates derivation path to equal 44'/714'/a'/0/0,
@@ -100,16 +147,4 @@ def validate_full_path(path: list) -> bool:
     Similar to Ethereum this should be 44'/714'/a', but for
     compatibility with other HW vendors we use 44'/714'/a'/0/0.
     """
-    if len(path) != 5:
-        return False
-    if path[0] != 44 | HARDENED:
-        return False
-    if path[1] != 714 | HARDENED:
-        return False
-    if path[2] < HARDENED or path[2] > 1000000 | HARDENED:
-        return False
-    if path[3] != 0:
-        return False
-    if path[4] != 0:
-        return False
-    return True
+    return paths.match_path(_PATH_PATTERN, path) >= 0
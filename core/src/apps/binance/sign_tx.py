@@ -7,6 +7,7 @@ from trezor.messages.BinanceOrderMsg import BinanceOrderMsg
 from trezor.messages.BinanceSignedTx import BinanceSignedTx
 from trezor.messages.BinanceTransferMsg import BinanceTransferMsg
 from trezor.messages.BinanceTxRequest import BinanceTxRequest
+from trezor.utils import HashWriter
 
 from apps.binance import CURVE, SLIP44_ID, helpers, layout
 from apps.common import paths
@@ -36,7 +37,8 @@ async def sign_tx(ctx, envelope, keychain: Keychain):
     if envelope.source is None or envelope.source < 0:
         raise wire.DataError("Source missing or invalid.")
 
-    msg_json = helpers.produce_json_for_signing(envelope, msg)
+    h = HashWriter(sha256())
+    helpers.write_json_for_signing(h, envelope, msg)
 
     if isinstance(msg, BinanceTransferMsg):
         await layout.require_confirm_transfer(ctx, msg)
@@ -47,11 +49,14 @@ async def sign_tx(ctx, envelope, keychain: Keychain):
     else:
         raise ValueError("input message unrecognized, is of type " + type(msg).__name__)
 
-    signature_bytes = generate_content_signature(msg_json.encode(), node.private_key())
+    signature_bytes = sign_digest(h.get_digest(), node.private_key())
 
     return BinanceSignedTx(signature=signature_bytes, public_key=node.public_key())
 
 
 def generate_content_signature(json: bytes, private_key: bytes) -> bytes:
-    msghash = sha256(json).digest()
+    return sign_digest(sha256(json).digest(), private_key)
+
+
+def sign_digest(msghash: bytes, private_key: bytes) -> bytes:
     return secp256k1.sign(private_key, msghash)[1:65]
@@ -12,7 +12,7 @@ from .multisig import multisig_get_pubkeys, multisig_pubkey_index
 from .scripts import output_script_multisig, output_script_native_p2wpkh_or_p2wsh
 
 if False:
-    from typing import List
+    from typing import Dict, List
     from trezor.crypto import bip32
     from trezor.messages.TxInputType import EnumTypeInputScriptType
 
@@ -155,6 +155,10 @@ def address_short(coin: CoinInfo, address: str) -> str:
         return address
 
 
+# compiled patterns of validate_full_path, by slip44 id
+_full_path_patterns = {}  # type: Dict[int, bytes]
+
+
 def validate_full_path(
     path: list,
     coin: CoinInfo,
@@ -170,7 +174,24 @@ def validate_full_path(
     See docs/coins for what paths are allowed. Please note that this is not
     a comprehensive check, some nuances are omitted for simplification.
     """
-    if len(path) not in (4, 5, 6):
+    pattern = _full_path_patterns.get(coin.slip44)
+    if pattern is None:
+        pattern = paths.compile_pattern(
+            (
+                4,
+                6,
+                (
+                    paths.ANY,  # purpose, checked below
+                    [(0, 20), coin.slip44 | HARDENED],
+                    [(0, 20), paths.hardened(0, 20)],
+                    [(0, 1), paths.hardened(0, 2)],
+                    paths.unhardened(1000000),
+                    paths.unhardened(1000000),
+                ),
+            )
+        )
+        _full_path_patterns[coin.slip44] = pattern
+    if paths.match_path(pattern, path) < 0:
         return False
 
     if not validate_purpose(path[0], coin):
@@ -179,17 +200,6 @@ def validate_full_path(
         path[0], script_type
     ):
         return False
-
-    if path[1] > 20 and path[1] != coin.slip44 | HARDENED:
-        return False
-    if (20 < path[2] < HARDENED) or path[2] > 20 | HARDENED:
-        return False
-    if path[3] not in (0, 1, 0 | HARDENED, 1 | HARDENED, 2 | HARDENED):
-        return False
-    if len(path) > 4 and path[4] > 1000000:
-        return False
-    if len(path) > 5 and path[5] > 1000000:
-        return False
     return True
 
 
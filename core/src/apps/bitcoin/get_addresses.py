@@ -0,0 +1,52 @@
+from micropython import const
+
+from trezor import wire
+from trezor.messages import InputScriptType
+from trezor.messages.Addresses import Addresses
+
+from apps.common import HARDENED
+from apps.common.paths import validate_path
+
+from . import addresses
+from .keychain import with_keychain
+
+_MAX_ADDRESSES = const(100)
+
+
+@with_keychain
+async def get_addresses(ctx, msg, keychain, coin):
+    script_type = msg.script_type or InputScriptType.SPENDADDRESS
+    start = msg.start or 0
+    count = msg.count or 0
+    if count < 1 or count > _MAX_ADDRESSES or start + count > HARDENED:
+        raise wire.DataError("Invalid address range")
+
+    # The paths differ only in the last index, and only its upper bound is
+    # checked. Validating the first and the last path covers all of them.
+    first = msg.address_n + [start]
+    last = msg.address_n + [start + count - 1]
+    if addresses.validate_full_path(first, coin, script_type):
+        path = last
+    else:
+        path = first
+    await validate_path(
+        ctx,
+        addresses.validate_full_path,
+        keychain,
+        path,
+        coin.curve_name,
+        coin=coin,
+        script_type=script_type,
+    )
+
+    # derive the shared parent once, each address is then a single step into
+    # the same node
+    parent = keychain.derive(msg.address_n)
+    node = parent.clone()
+    result = []
+    for i in range(start, start + count):
+        parent.derive_path_into(node, [i])
+        result.append(addresses.get_address(script_type, coin, node))
+    del node
+
+    return Addresses(addresses=result)
@@ -5,6 +5,11 @@ from trezor.messages.PublicKey import PublicKey
 
 from apps.common import coins, layout, seed
 
+if False:
+    from trezor.crypto import bip32
+    from trezor.messages.GetPublicKey import EnumTypeInputScriptType
+    from apps.common.coininfo import CoinInfo
+
 
 async def get_public_key(ctx, msg):
     coin_name = msg.coin_name or "Bitcoin"
@@ -12,10 +17,22 @@ async def get_public_key(ctx, msg):
     coin = coins.by_name(coin_name)
     curve_name = msg.ecdsa_curve_name or coin.curve_name
 
-    keychain = await seed.get_keychain(ctx, [(curve_name, [])])
+    node = seed.get_cached_public_node(curve_name, msg.address_n)
+    if node is None:
+        keychain = await seed.get_keychain(ctx, [(curve_name, [])])
+        node = keychain.derive(msg.address_n)
+        seed.cache_public_node(curve_name, msg.address_n, node)
+    response = public_key(coin, script_type, node)
+
+    if msg.show_display:
+        await layout.show_pubkey(ctx, response.node.public_key)
+
+    return response
 
-    node = keychain.derive(msg.address_n)
 
+def public_key(
+    coin: CoinInfo, script_type: EnumTypeInputScriptType, node: bip32.HDNode
+) -> PublicKey:
     if (
         script_type in [InputScriptType.SPENDADDRESS, InputScriptType.SPENDMULTISIG]
         and coin.xpub_magic is not None
@@ -46,8 +63,4 @@ async def get_public_key(ctx, msg):
         chain_code=node.chain_code(),
         public_key=pubkey,
     )
-
-    if msg.show_display:
-        await layout.show_pubkey(ctx, pubkey)
-
     return PublicKey(node=node_type, xpub=node_xpub)
@@ -0,0 +1,33 @@
+from micropython import const
+
+from trezor import wire
+from trezor.messages import InputScriptType
+from trezor.messages.PublicKeys import PublicKeys
+
+from apps.common import coins, seed
+
+from .get_public_key import public_key
+
+_MAX_KEYS = const(32)
+
+
+async def get_public_keys(ctx, msg):
+    coin_name = msg.coin_name or "Bitcoin"
+    script_type = msg.script_type or InputScriptType.SPENDADDRESS
+    coin = coins.by_name(coin_name)
+    curve_name = msg.ecdsa_curve_name or coin.curve_name
+
+    if not msg.paths or len(msg.paths) > _MAX_KEYS:
+        raise wire.DataError("Invalid number of paths")
+
+    # one keychain for all keys, it keeps the account level nodes that the
+    # paths have in common
+    keychain = await seed.get_keychain(ctx, [(curve_name, [])])
+    with keychain:
+        keys = []
+        for path in msg.paths:
+            node = keychain.derive(path.address_n)
+            keys.append(public_key(coin, script_type, node))
+            del node
+
+    return PublicKeys(keys=keys)
@@ -1,3 +1,5 @@
+from micropython import const
+
 from trezor import wire
 from trezor.crypto import bip32
 from trezor.crypto.hashlib import sha256
@@ -8,7 +10,14 @@ from trezor.utils import HashWriter
 from .writers import write_bytes_fixed, write_uint32
 
 if False:
-    from typing import List
+    from typing import Dict, List, Tuple
+
+# Pubkeys derived from the cosigner xpubs, keyed by the xpub and the path.  While
+# signing, the same input is resolved several times (address check, pubkey index,
+# script code), so the last few inputs are enough.  The module is unimported after
+# every workflow, which wipes the cache.
+_PUBKEY_CACHE_SIZE = const(32)
+_pubkey_cache = {}  # type: Dict[Tuple[bytes, Tuple[int, ...]], bytes]
 
 
 def multisig_fingerprint(multisig: MultisigRedeemScriptType) -> bytes:
@@ -55,6 +64,17 @@ def multisig_pubkey_index(multisig: MultisigRedeemScriptType, pubkey: bytes) ->
 
 
 def multisig_get_pubkey(n: HDNodeType, p: list) -> bytes:
+    key = (bytes(n.chain_code) + bytes(n.public_key), tuple(p))
+    pubkey = _pubkey_cache.get(key)
+    if pubkey is None:
+        pubkey = _derive_pubkey(n, p)
+        if len(_pubkey_cache) >= _PUBKEY_CACHE_SIZE:
+            _pubkey_cache.clear()
+        _pubkey_cache[key] = pubkey
+    return pubkey
+
+
+def _derive_pubkey(n: HDNodeType, p: list) -> bytes:
     node = bip32.HDNode(
         depth=n.depth,
         fingerprint=n.fingerprint,
@@ -62,8 +82,7 @@ def multisig_get_pubkey(n: HDNodeType, p: list) -> bytes:
         chain_code=n.chain_code,
         public_key=n.public_key,
     )
-    for i in p:
-        node.derive(i, True)
+    node.derive_path(p, True)
     return node.public_key()
 
 
@@ -16,12 +16,24 @@ from .multisig import (
     multisig_get_pubkeys,
     multisig_pubkey_index,
 )
-from .writers import write_bytes_fixed, write_bytes_unchecked, write_op_push
+from .writers import write_bytes_unchecked, write_op_push
 
 if False:
-    from typing import List, Optional
+    from typing import List, Optional, Tuple
     from .writers import Writer
 
+    ScriptTemplate = Tuple[bytes, int, bytes]
+
+# Scripts which push a single hash, as (prefix, hash length, suffix).
+# OP_DUP OP_HASH160 <20 bytes> OP_EQUALVERIFY OP_CHECKSIG
+_P2PKH = (b"\x76\xa9\x14", 20, b"\x88\xac")
+# OP_HASH160 <20 bytes> OP_EQUAL
+_P2SH = (b"\xa9\x14", 20, b"\x87")
+_P2WPKH = (b"\x00\x14", 20, b"")  # witness version, pubkey hash length
+_P2WSH = (b"\x00\x20", 32, b"")  # witness version, script hash length
+_P2WPKH_IN_P2SH = (b"\x16\x00\x14", 20, b"")  # push of the P2WPKH script
+_P2WSH_IN_P2SH = (b"\x22\x00\x20", 32, b"")  # push of the P2WSH script
+
 
 def input_derive_script(
     txi: TxInputType,
@@ -140,27 +152,26 @@ def input_script_p2pkh_or_p2sh(
     return w
 
 
-def output_script_p2pkh(pubkeyhash: bytes) -> bytearray:
-    utils.ensure(len(pubkeyhash) == 20)
-    s = bytearray(25)
-    s[0] = 0x76  # OP_DUP
-    s[1] = 0xA9  # OP_HASH_160
-    s[2] = 0x14  # pushing 20 bytes
-    s[3:23] = pubkeyhash
-    s[23] = 0x88  # OP_EQUALVERIFY
-    s[24] = 0xAC  # OP_CHECKSIG
+def script_from_template(template: ScriptTemplate, digest: bytes) -> bytearray:
+    # Fills the template with one allocation and three slice copies.
+    prefix, length, suffix = template
+    utils.ensure(len(digest) == length)
+    start = len(prefix)
+    s = utils.arena_alloc(start + length + len(suffix))
+    s[:start] = prefix
+    s[start : start + length] = digest
+    s[start + length :] = suffix
     return s
 
 
+def output_script_p2pkh(pubkeyhash: bytes) -> bytearray:
+    # 76 A9 14 <pubkeyhash> 88 AC
+    return script_from_template(_P2PKH, pubkeyhash)
+
+
 def output_script_p2sh(scripthash: bytes) -> bytearray:
     # A9 14 <scripthash> 87
-    utils.ensure(len(scripthash) == 20)
-    s = bytearray(23)
-    s[0] = 0xA9  # OP_HASH_160
-    s[1] = 0x14  # pushing 20 bytes
-    s[2:22] = scripthash
-    s[22] = 0x87  # OP_EQUAL
-    return s
+    return script_from_template(_P2SH, scripthash)
 
 
 # SegWit: Native P2WPKH or P2WSH
@@ -184,14 +195,9 @@ def output_script_native_p2wpkh_or_p2wsh(witprog: bytes) -> bytearray:
     # Either:
     # 00 14 <20-byte-key-hash>
     # 00 20 <32-byte-script-hash>
-    length = len(witprog)
-    utils.ensure(length == 20 or length == 32)
-
-    w = empty_bytearray(3 + length)
-    w.append(0x00)  # witness version byte
-    w.append(length)  # pub key hash length is 20 (P2WPKH) or 32 (P2WSH) bytes
-    write_bytes_fixed(w, witprog, length)  # pub key hash
-    return w
+    if len(witprog) == 32:
+        return script_from_template(_P2WSH, witprog)
+    return script_from_template(_P2WPKH, witprog)
 
 
 # SegWit: P2WPKH nested in P2SH
@@ -205,14 +211,7 @@ def output_script_native_p2wpkh_or_p2wsh(witprog: bytes) -> bytearray:
 def input_script_p2wpkh_in_p2sh(pubkeyhash: bytes) -> bytearray:
     # 16 00 14 <pubkeyhash>
     # Signature is moved to the witness.
-    utils.ensure(len(pubkeyhash) == 20)
-
-    w = empty_bytearray(3 + len(pubkeyhash))
-    w.append(0x16)  # length of the data
-    w.append(0x00)  # witness version byte
-    w.append(0x14)  # P2WPKH witness program (pub key hash length)
-    write_bytes_fixed(w, pubkeyhash, 20)  # pub key hash
-    return w
+    return script_from_template(_P2WPKH_IN_P2SH, pubkeyhash)
 
 
 # SegWit: P2WSH nested in P2SH
@@ -230,12 +229,7 @@ def input_script_p2wsh_in_p2sh(script_hash: bytes) -> bytearray:
     if len(script_hash) != 32:
         raise wire.DataError("Redeem script hash should be 32 bytes long")
 
-    w = empty_bytearray(3 + len(script_hash))
-    w.append(0x22)  # length of the data
-    w.append(0x00)  # witness version byte
-    w.append(0x20)  # P2WSH witness program (redeem script hash length)
-    write_bytes_fixed(w, script_hash, 32)
-    return w
+    return script_from_template(_P2WSH_IN_P2SH, script_hash)
 
 
 # SegWit: Witness getters
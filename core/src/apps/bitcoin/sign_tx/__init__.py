@@ -44,7 +44,7 @@ async def sign_tx(
         if isinstance(req, TxRequest):
             if req.request_type == TXFINISHED:
                 break
-            res = await ctx.call(req, TxAck)
+            res = await ctx.call(req, TxAck, lazy=True)
         elif isinstance(req, helpers.UiConfirmOutput):
             mods = utils.unimport_begin()
             res = await layout.confirm_output(ctx, req.output, req.coin)
@@ -1,7 +1,8 @@
 import gc
 from micropython import const
 
-from trezor import wire
+from trezor import utils, wire
+from trezor.crypto import sighash143
 from trezor.crypto.hashlib import sha256
 from trezor.messages import InputScriptType
 from trezor.messages.SignTx import SignTx
@@ -23,7 +24,8 @@ from . import helpers, progress, tx_weight
 from .matchcheck import MultisigFingerprintChecker, WalletPathChecker
 
 if False:
-    from typing import Set, Tuple, Union
+    from typing import Dict, List, Optional, Set, Tuple, Union
+    from trezor.crypto import bip32
 
 # Default signature hash type in Bitcoin which signs all inputs and all outputs of the transaction.
 _SIGHASH_ALL = const(0x01)
@@ -38,6 +40,18 @@ _BIP32_MAX_LAST_ELEMENT = const(1000000)
 # the number of bytes to preallocate for serialized transaction chunks
 _MAX_SERIALIZED_CHUNK_SIZE = const(2048)
 
+# the maximum number of verified previous transaction output amounts kept for
+# later inputs, see get_prevtx_output_value()
+_MAX_PREVTX_AMOUNTS = const(128)
+
+# the maximum number of bytes of the transaction kept for rebuilding the legacy
+# sighash of the following inputs, see sign_nonsegwit_input()
+_MAX_LEGACY_CACHE_SIZE = const(8192)
+
+# the size of the arena for the output scripts derived while serializing, large
+# enough for any standard script
+_SCRIPT_ARENA_SIZE = const(64)
+
 
 class Bitcoin:
     async def signer(self) -> None:
@@ -95,6 +109,26 @@ class Bitcoin:
         self.tx_req.serialized = TxRequestSerializedType()
         self.tx_req.serialized.serialized_tx = self.serialized_tx
 
+        # amounts of the other outputs of the previous transactions streamed so far,
+        # (prev_hash, prev_index) -> amount, so that a previous transaction spent by
+        # several inputs is streamed and hashed only once
+        self.prevtx_amounts = {}  # type: Dict[Tuple[bytes, int], int]
+
+        # legacy signing derives every output script once per non-segwit input,
+        # the scripts are taken from this arena and released after each output
+        self.script_arena = utils.arena(_SCRIPT_ARENA_SIZE)
+
+        # if the host set SignTx.cache_legacy_tx, the inputs (with empty scripts) and
+        # outputs serialized while signing the first non-segwit input, together with
+        # the digests of the inputs, so that the following non-segwit inputs do not
+        # stream the whole transaction again
+        self.legacy_inputs = None  # type: Optional[List[bytes]]
+        self.legacy_input_digests = None  # type: Optional[List[bytes]]
+        self.legacy_outputs = None  # type: Optional[bytes]
+
+        # inputs and outputs received ahead of time if the host sends them in batches
+        self.batch = helpers.TxBatch(tx.batch_size)
+
         # h_confirmed is used to make sure that the inputs and outputs streamed for
         # confirmation in Steps 1 and 2 are the same as the ones streamed for signing
         # legacy inputs in Step 4.
@@ -110,7 +144,9 @@ class Bitcoin:
         for i in range(self.tx.inputs_count):
             # STAGE_REQUEST_1_INPUT in legacy
             progress.advance()
-            txi = await helpers.request_tx_input(self.tx_req, i, self.coin)
+            txi = await helpers.request_tx_input(
+                self.tx_req, i, self.coin, batch=self.batch, count=self.tx.inputs_count
+            )
             self.weight.add_input(txi)
             if input_is_segwit(txi):
                 self.segwit.add(i)
@@ -119,7 +155,9 @@ class Bitcoin:
     async def step2_confirm_outputs(self) -> None:
         for i in range(self.tx.outputs_count):
             # STAGE_REQUEST_3_OUTPUT in legacy
-            txo = await helpers.request_tx_output(self.tx_req, i, self.coin)
+            txo = await helpers.request_tx_output(
+                self.tx_req, i, self.coin, batch=self.batch, count=self.tx.outputs_count
+            )
             script_pubkey = self.output_derive_script(txo)
             self.weight.add_output(script_pubkey)
             await self.confirm_output(txo, script_pubkey)
@@ -203,7 +241,9 @@ class Bitcoin:
 
     async def serialize_segwit_input(self, i: int) -> None:
         # STAGE_REQUEST_SEGWIT_INPUT in legacy
-        txi = await helpers.request_tx_input(self.tx_req, i, self.coin)
+        txi = await helpers.request_tx_input(
+            self.tx_req, i, self.coin, batch=self.batch, count=self.tx.inputs_count
+        )
 
         if not input_is_segwit(txi):
             raise wire.ProcessError("Transaction has changed during signing")
@@ -235,7 +275,9 @@ class Bitcoin:
 
     async def sign_segwit_input(self, i: int) -> None:
         # STAGE_REQUEST_SEGWIT_WITNESS in legacy
-        txi = await helpers.request_tx_input(self.tx_req, i, self.coin)
+        txi = await helpers.request_tx_input(
+            self.tx_req, i, self.coin, batch=self.batch, count=self.tx.inputs_count
+        )
 
         if not input_is_segwit(txi):
             raise wire.ProcessError("Transaction has changed during signing")
@@ -257,39 +299,39 @@ class Bitcoin:
             )
 
     async def sign_nonsegwit_input(self, i_sign: int) -> None:
+        if self.legacy_outputs is not None:
+            await self.sign_nonsegwit_input_cached(i_sign)
+            return
+        cache = bool(self.tx.cache_legacy_tx)
+
         # hash of what we are signing with this input
         h_sign = self.create_hash_writer()
         # should come out the same as h_confirmed, checked before signing the digest
         h_check = self.create_hash_writer()
 
+        # the transaction kept for the following non-segwit inputs, if it fits
+        cache_size = 0
+        inputs = []  # type: List[bytes]
+        input_digests = []  # type: List[bytes]
+        outputs = bytearray()
+
         self.write_tx_header(h_sign, self.tx, witness_marker=False)
         write_bitcoin_varint(h_sign, self.tx.inputs_count)
 
         for i in range(self.tx.inputs_count):
             # STAGE_REQUEST_4_INPUT in legacy
-            txi = await helpers.request_tx_input(self.tx_req, i, self.coin)
+            txi = await helpers.request_tx_input(
+                self.tx_req, i, self.coin, batch=self.batch, count=self.tx.inputs_count
+            )
             writers.write_tx_input_check(h_check, txi)
+            if cache and cache_size <= _MAX_LEGACY_CACHE_SIZE:
+                w = bytearray()
+                self.write_tx_input(w, txi, bytes())
+                inputs.append(w)
+                input_digests.append(input_check_digest(txi))
+                cache_size += len(w) + 32
             if i == i_sign:
-                self.wallet_path.check_input(txi)
-                self.multisig_fingerprint.check_input(txi)
-                # NOTE: wallet_path is checked in write_tx_input_check()
-                node = self.keychain.derive(txi.address_n)
-                key_sign_pub = node.public_key()
-                # if multisig, do a sanity check to ensure we are signing with a key that is included in the multisig
-                if txi.multisig:
-                    multisig.multisig_pubkey_index(txi.multisig, key_sign_pub)
-
-                # For the signing process the previous UTXO's scriptPubKey is included in h_sign.
-                if txi.script_type == InputScriptType.SPENDMULTISIG:
-                    script_pubkey = scripts.output_script_multisig(
-                        multisig.multisig_get_pubkeys(txi.multisig), txi.multisig.m,
-                    )
-                elif txi.script_type == InputScriptType.SPENDADDRESS:
-                    script_pubkey = scripts.output_script_p2pkh(
-                        addresses.ecdsa_hash_pubkey(key_sign_pub, self.coin)
-                    )
-                else:
-                    raise wire.ProcessError("Unknown transaction type")
+                node, key_sign_pub, script_pubkey = self.derive_nonsegwit_script(txi)
                 txi_sign = txi
             else:
                 script_pubkey = bytes()
@@ -299,18 +341,94 @@ class Bitcoin:
 
         for i in range(self.tx.outputs_count):
             # STAGE_REQUEST_4_OUTPUT in legacy
-            txo = await helpers.request_tx_output(self.tx_req, i, self.coin)
-            script_pubkey = self.output_derive_script(txo)
-            self.write_tx_output(h_check, txo, script_pubkey)
-            self.write_tx_output(h_sign, txo, script_pubkey)
-
-        writers.write_uint32(h_sign, self.tx.lock_time)
-        writers.write_uint32(h_sign, self.get_hash_type())
+            txo = await helpers.request_tx_output(
+                self.tx_req, i, self.coin, batch=self.batch, count=self.tx.outputs_count
+            )
+            with self.script_arena:
+                script_pubkey = self.output_derive_script(txo)
+                self.write_tx_output(h_check, txo, script_pubkey)
+                self.write_tx_output(h_sign, txo, script_pubkey)
+                if cache and cache_size <= _MAX_LEGACY_CACHE_SIZE:
+                    cache_size -= len(outputs)
+                    self.write_tx_output(outputs, txo, script_pubkey)
+                    cache_size += len(outputs)
 
         # check the control digests
         if self.h_confirmed.get_digest() != h_check.get_digest():
             raise wire.ProcessError("Transaction has changed during signing")
 
+        # The cached transaction is what the user confirmed, so the sighash of the
+        # following inputs can be rebuilt from it.
+        if cache and cache_size <= _MAX_LEGACY_CACHE_SIZE:
+            self.legacy_inputs = inputs
+            self.legacy_input_digests = input_digests
+            self.legacy_outputs = outputs
+        del inputs, input_digests, outputs
+
+        self.sign_nonsegwit_digest(h_sign, node, txi_sign, key_sign_pub, i_sign)
+
+    async def sign_nonsegwit_input_cached(self, i_sign: int) -> None:
+        assert self.legacy_inputs is not None
+        assert self.legacy_input_digests is not None
+        assert self.legacy_outputs is not None
+
+        # STAGE_REQUEST_4_INPUT in legacy
+        txi_sign = await helpers.request_tx_input(
+            self.tx_req, i_sign, self.coin, batch=self.batch, count=self.tx.inputs_count
+        )
+        if input_check_digest(txi_sign) != self.legacy_input_digests[i_sign]:
+            raise wire.ProcessError("Transaction has changed during signing")
+        node, key_sign_pub, script_pubkey = self.derive_nonsegwit_script(txi_sign)
+
+        h_sign = self.create_hash_writer()
+        self.write_tx_header(h_sign, self.tx, witness_marker=False)
+        write_bitcoin_varint(h_sign, self.tx.inputs_count)
+        for i, serialized in enumerate(self.legacy_inputs):
+            if i == i_sign:
+                self.write_tx_input(h_sign, txi_sign, script_pubkey)
+            else:
+                h_sign.extend(serialized)
+        write_bitcoin_varint(h_sign, self.tx.outputs_count)
+        h_sign.extend(self.legacy_outputs)
+
+        self.sign_nonsegwit_digest(h_sign, node, txi_sign, key_sign_pub, i_sign)
+
+    def derive_nonsegwit_script(
+        self, txi: TxInputType
+    ) -> Tuple[bip32.HDNode, bytes, bytes]:
+        self.wallet_path.check_input(txi)
+        self.multisig_fingerprint.check_input(txi)
+        # NOTE: wallet_path is checked in write_tx_input_check()
+        node = self.keychain.derive(txi.address_n)
+        key_sign_pub = node.public_key()
+        # if multisig, do a sanity check to ensure we are signing with a key that is included in the multisig
+        if txi.multisig:
+            multisig.multisig_pubkey_index(txi.multisig, key_sign_pub)
+
+        # For the signing process the previous UTXO's scriptPubKey is included in h_sign.
+        if txi.script_type == InputScriptType.SPENDMULTISIG:
+            script_pubkey = scripts.output_script_multisig(
+                multisig.multisig_get_pubkeys(txi.multisig), txi.multisig.m,
+            )
+        elif txi.script_type == InputScriptType.SPENDADDRESS:
+            script_pubkey = scripts.output_script_p2pkh(
+                addresses.ecdsa_hash_pubkey(key_sign_pub, self.coin)
+            )
+        else:
+            raise wire.ProcessError("Unknown transaction type")
+        return node, key_sign_pub, script_pubkey
+
+    def sign_nonsegwit_digest(
+        self,
+        h_sign: HashWriter,
+        node: bip32.HDNode,
+        txi_sign: TxInputType,
+        key_sign_pub: bytes,
+        i_sign: int,
+    ) -> None:
+        writers.write_uint32(h_sign, self.tx.lock_time)
+        writers.write_uint32(h_sign, self.get_hash_type())
+
         # compute the signature from the tx digest
         signature = ecdsa_sign(
             node, writers.get_tx_hash(h_sign, double=self.coin.sign_hash_double)
@@ -324,12 +442,24 @@ class Bitcoin:
 
     async def serialize_output(self, i: int) -> None:
         # STAGE_REQUEST_5_OUTPUT in legacy
-        txo = await helpers.request_tx_output(self.tx_req, i, self.coin)
-        script_pubkey = self.output_derive_script(txo)
-        self.write_tx_output(self.serialized_tx, txo, script_pubkey)
+        txo = await helpers.request_tx_output(
+            self.tx_req, i, self.coin, batch=self.batch, count=self.tx.outputs_count
+        )
+        with self.script_arena:
+            script_pubkey = self.output_derive_script(txo)
+            self.write_tx_output(self.serialized_tx, txo, script_pubkey)
 
     async def get_prevtx_output_value(self, prev_hash: bytes, prev_index: int) -> int:
+        # bytearray is not hashable
+        prev_key = bytes(prev_hash)
+        amount_out = self.prevtx_amounts.pop((prev_key, prev_index), None)
+        if amount_out is not None:
+            # the previous transaction was already verified for an earlier input
+            return amount_out
+
         amount_out = 0  # output amount
+        amounts = {}  # type: Dict[Tuple[bytes, int], int]
+        room = _MAX_PREVTX_AMOUNTS - len(self.prevtx_amounts)
 
         # STAGE_REQUEST_2_PREV_META in legacy
         tx = await helpers.request_tx_meta(self.tx_req, self.coin, prev_hash)
@@ -345,7 +475,9 @@ class Bitcoin:
 
         for i in range(tx.inputs_cnt):
             # STAGE_REQUEST_2_PREV_INPUT in legacy
-            txi = await helpers.request_tx_input(self.tx_req, i, self.coin, prev_hash)
+            txi = await helpers.request_tx_input(
+                self.tx_req, i, self.coin, prev_hash, self.batch, tx.inputs_cnt
+            )
             self.write_tx_input(txh, txi, txi.script_sig)
 
         write_bitcoin_varint(txh, tx.outputs_cnt)
@@ -353,12 +485,19 @@ class Bitcoin:
         for i in range(tx.outputs_cnt):
             # STAGE_REQUEST_2_PREV_OUTPUT in legacy
             txo_bin = await helpers.request_tx_output(
-                self.tx_req, i, self.coin, prev_hash
+                self.tx_req, i, self.coin, prev_hash, self.batch, tx.outputs_cnt
             )
             self.write_tx_output(txh, txo_bin, txo_bin.script_pubkey)
             if i == prev_index:
                 amount_out = txo_bin.amount
                 self.check_prevtx_output(txo_bin)
+            elif len(amounts) < room:
+                try:
+                    self.check_prevtx_output(txo_bin)
+                    amounts[(prev_key, i)] = txo_bin.amount
+                except wire.Error:
+                    # not spendable, a later input will stream it and fail
+                    pass
 
         await self.write_prev_tx_footer(txh, tx, prev_hash)
 
@@ -368,6 +507,8 @@ class Bitcoin:
         ):
             raise wire.ProcessError("Encountered invalid prev_hash")
 
+        # the amounts are trusted only now that the hash has been verified
+        self.prevtx_amounts.update(amounts)
         return amount_out
 
     def check_prevtx_output(self, txo_bin: TxOutputBinType) -> None:
@@ -466,65 +607,31 @@ class Bitcoin:
     # ===
 
     def init_hash143(self) -> None:
-        self.h_prevouts = HashWriter(sha256())
-        self.h_sequence = HashWriter(sha256())
-        self.h_outputs = HashWriter(sha256())
+        self.hash143 = sighash143(self.coin.sign_hash_double)
 
     def hash143_add_input(self, txi: TxInputType) -> None:
-        writers.write_bytes_reversed(
-            self.h_prevouts, txi.prev_hash, writers.TX_HASH_SIZE
-        )
-        writers.write_uint32(self.h_prevouts, txi.prev_index)
-        writers.write_uint32(self.h_sequence, txi.sequence)
+        self.hash143.add_input(txi.prev_hash, txi.prev_index, txi.sequence)
 
     def hash143_add_output(self, txo: TxOutputType, script_pubkey) -> None:
-        writers.write_tx_output(self.h_outputs, txo, script_pubkey)
+        self.hash143.add_output(txo.amount, script_pubkey)
 
     def hash143_preimage_hash(self, txi: TxInputType, pubkeyhash: bytes) -> bytes:
-        h_preimage = HashWriter(sha256())
-
-        # nVersion
-        writers.write_uint32(h_preimage, self.tx.version)
-
-        # hashPrevouts
-        prevouts_hash = writers.get_tx_hash(
-            self.h_prevouts, double=self.coin.sign_hash_double
-        )
-        writers.write_bytes_fixed(h_preimage, prevouts_hash, writers.TX_HASH_SIZE)
-
-        # hashSequence
-        sequence_hash = writers.get_tx_hash(
-            self.h_sequence, double=self.coin.sign_hash_double
-        )
-        writers.write_bytes_fixed(h_preimage, sequence_hash, writers.TX_HASH_SIZE)
-
-        # outpoint
-        writers.write_bytes_reversed(h_preimage, txi.prev_hash, writers.TX_HASH_SIZE)
-        writers.write_uint32(h_preimage, txi.prev_index)
-
-        # scriptCode
-        script_code = scripts.bip143_derive_script_code(txi, pubkeyhash)
-        writers.write_bytes_prefixed(h_preimage, script_code)
-
-        # amount
-        writers.write_uint64(h_preimage, txi.amount)
-
-        # nSequence
-        writers.write_uint32(h_preimage, txi.sequence)
-
-        # hashOutputs
-        outputs_hash = writers.get_tx_hash(
-            self.h_outputs, double=self.coin.sign_hash_double
+        return self.hash143.preimage_hash(
+            txi.prev_hash,
+            txi.prev_index,
+            scripts.bip143_derive_script_code(txi, pubkeyhash),
+            txi.amount,
+            txi.sequence,
+            self.tx.version,
+            self.tx.lock_time,
+            self.get_hash_type(),
         )
-        writers.write_bytes_fixed(h_preimage, outputs_hash, writers.TX_HASH_SIZE)
-
-        # nLockTime
-        writers.write_uint32(h_preimage, self.tx.lock_time)
 
-        # nHashType
-        writers.write_uint32(h_preimage, self.get_hash_type())
 
-        return writers.get_tx_hash(h_preimage, double=self.coin.sign_hash_double)
+def input_check_digest(txi: TxInputType) -> bytes:
+    h = HashWriter(sha256())
+    writers.write_tx_input_check(h, txi)
+    return h.get_digest()
 
 
 def input_is_segwit(txi: TxInputType) -> bool:
@@ -72,6 +72,18 @@ class Decred(Bitcoin):
 
         prefix_hash = self.h_prefix.get_digest()
 
+        # The witness serializations signed for the inputs only differ in which
+        # script is not empty. The header and the empty scripts preceding the
+        # signed input are hashed once and the context is forked for each input.
+        witness_prefix = blake256()
+        h_witness_prefix = HashWriter(witness_prefix)
+        writers.write_uint32(
+            h_witness_prefix, self.tx.version | DECRED_SERIALIZE_WITNESS_SIGNING
+        )
+        write_bitcoin_varint(h_witness_prefix, self.tx.inputs_count)
+        # an empty script serializes to its zero length
+        empty_scripts = bytes(self.tx.inputs_count)
+
         for i_sign in range(self.tx.inputs_count):
             progress.advance()
 
@@ -95,17 +107,11 @@ class Decred(Bitcoin):
             else:
                 raise wire.DataError("Unsupported input script type")
 
-            h_witness = self.create_hash_writer()
-            writers.write_uint32(
-                h_witness, self.tx.version | DECRED_SERIALIZE_WITNESS_SIGNING
-            )
-            write_bitcoin_varint(h_witness, self.tx.inputs_count)
-
-            for ii in range(self.tx.inputs_count):
-                if ii == i_sign:
-                    writers.write_bytes_prefixed(h_witness, prev_pkscript)
-                else:
-                    write_bitcoin_varint(h_witness, 0)
+            witness = witness_prefix.copy()
+            h_witness = HashWriter(witness)
+            writers.write_bytes_prefixed(h_witness, prev_pkscript)
+            witness.update(empty_scripts, i_sign + 1)
+            write_bitcoin_varint(h_witness_prefix, 0)
 
             witness_hash = writers.get_tx_hash(
                 h_witness, double=self.coin.sign_hash_double, reverse=False
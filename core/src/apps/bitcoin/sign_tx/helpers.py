@@ -1,4 +1,5 @@
 import gc
+from micropython import const
 
 from trezor import utils, wire
 from trezor.messages import InputScriptType, OutputScriptType
@@ -21,7 +22,7 @@ from apps.common.coininfo import CoinInfo
 from ..writers import TX_HASH_SIZE
 
 if False:
-    from typing import Any, Awaitable, Dict
+    from typing import Any, Awaitable, Dict, Optional, Sequence, Tuple
     from trezor.messages.TxInputType import EnumTypeInputScriptType
     from trezor.messages.TxOutputType import EnumTypeOutputScriptType
 
@@ -55,6 +56,10 @@ NONSEGWIT_INPUT_SCRIPT_TYPES = (
     InputScriptType.SPENDMULTISIG,
 )
 
+# the maximum number of consecutive items asked for in one TxRequest, regardless
+# of SignTx.batch_size, to bound the heap taken by items received ahead of time
+_MAX_BATCH_SIZE = const(8)
+
 # Machine instructions
 # ===
 
@@ -118,6 +123,49 @@ def confirm_nondefault_locktime(lock_time: int) -> Awaitable[Any]:  # type: igno
     return (yield UiConfirmNonDefaultLocktime(lock_time))
 
 
+class TxBatch:
+    """
+    Inputs and outputs sent by the host ahead of time in a batched TxAck.
+
+    If SignTx.batch_size is above one, request_tx_input() and request_tx_output()
+    ask for up to that many consecutive items in one TxRequest and keep the extra
+    ones here. They are returned, each exactly once, only if the next request of
+    the same kind asks for the following index and the TxRequest carries no
+    serialized data or signature, which must reach the host before the signer
+    goes on; any other request drops them and goes to the host as usual. The
+    TxAck is loaded lazily, so an item is decoded only when it is returned.
+    """
+
+    def __init__(self, size: Optional[int]) -> None:
+        self.size = min(size or 1, _MAX_BATCH_SIZE)
+        # (request type, tx_hash) -> (index of the next item, items, position of
+        # the next item in items, end position)
+        self.items = {}  # type: Dict[Tuple[int, Optional[bytes]], Tuple[int, Sequence, int, int]]
+
+    def pop(self, request_type: int, tx_hash: Optional[bytes], i: int) -> Any:
+        key = (request_type, tx_hash)
+        entry = self.items.pop(key, None)
+        if entry is None or entry[0] != i:
+            return None
+        _, items, pos, end = entry
+        if pos + 1 < end:
+            self.items[key] = (i + 1, items, pos + 1, end)
+        return items[pos]
+
+    def push(
+        self,
+        request_type: int,
+        tx_hash: Optional[bytes],
+        i: int,
+        items: Sequence,
+        pos: int,
+        end: int,
+    ) -> None:
+        end = min(end, len(items))
+        if pos < end:
+            self.items[(request_type, tx_hash)] = (i, items, pos, end)
+
+
 def request_tx_meta(tx_req: TxRequest, coin: CoinInfo, tx_hash: bytes = None) -> Awaitable[Any]:  # type: ignore
     tx_req.request_type = TXMETA
     tx_req.details.tx_hash = tx_hash
@@ -140,27 +188,63 @@ def request_tx_extra_data(  # type: ignore
     return ack.tx.extra_data
 
 
-def request_tx_input(tx_req: TxRequest, i: int, coin: CoinInfo, tx_hash: bytes = None) -> Awaitable[Any]:  # type: ignore
+def request_tx_input(  # type: ignore
+    tx_req: TxRequest,
+    i: int,
+    coin: CoinInfo,
+    tx_hash: bytes = None,
+    batch: TxBatch = None,
+    count: int = 0,
+) -> Awaitable[Any]:
+    if batch is not None:
+        txi = batch.pop(TXINPUT, tx_hash, i)
+        if txi is not None and not _has_serialized(tx_req):
+            return sanitize_tx_input(txi, coin)
     tx_req.request_type = TXINPUT
     tx_req.details.request_index = i
     tx_req.details.tx_hash = tx_hash
+    n = _set_request_count(tx_req, batch, count - i)
     ack = yield tx_req
     _clear_tx_request(tx_req)
     gc.collect()
-    return sanitize_tx_input(ack.tx, coin)
-
-
-def request_tx_output(tx_req: TxRequest, i: int, coin: CoinInfo, tx_hash: bytes = None) -> Awaitable[Any]:  # type: ignore
+    txis = ack.tx.inputs
+    if batch is not None:
+        batch.push(TXINPUT, tx_hash, i + 1, txis, 1, n)
+    return sanitize_tx_input(txis[0], coin)
+
+
+def request_tx_output(  # type: ignore
+    tx_req: TxRequest,
+    i: int,
+    coin: CoinInfo,
+    tx_hash: bytes = None,
+    batch: TxBatch = None,
+    count: int = 0,
+) -> Awaitable[Any]:
+    if batch is not None:
+        txo = batch.pop(TXOUTPUT, tx_hash, i)
+        if txo is not None and not _has_serialized(tx_req):
+            if tx_hash is None:
+                return sanitize_tx_output(txo, coin)
+            else:
+                return sanitize_tx_binoutput(txo, coin)
     tx_req.request_type = TXOUTPUT
     tx_req.details.request_index = i
     tx_req.details.tx_hash = tx_hash
+    n = _set_request_count(tx_req, batch, count - i)
     ack = yield tx_req
     _clear_tx_request(tx_req)
     gc.collect()
     if tx_hash is None:
-        return sanitize_tx_output(ack.tx, coin)
+        txos = ack.tx.outputs
     else:
-        return sanitize_tx_binoutput(ack.tx, coin)
+        txos = ack.tx.bin_outputs
+    if batch is not None:
+        batch.push(TXOUTPUT, tx_hash, i + 1, txos, 1, n)
+    if tx_hash is None:
+        return sanitize_tx_output(txos[0], coin)
+    else:
+        return sanitize_tx_binoutput(txos[0], coin)
 
 
 def request_tx_finish(tx_req: TxRequest) -> Awaitable[Any]:  # type: ignore
@@ -170,12 +254,30 @@ def request_tx_finish(tx_req: TxRequest) -> Awaitable[Any]:  # type: ignore
     gc.collect()
 
 
+def _has_serialized(tx_req: TxRequest) -> bool:
+    serialized = tx_req.serialized
+    return serialized is not None and (
+        serialized.signature is not None or bool(serialized.serialized_tx)
+    )
+
+
+def _set_request_count(tx_req: TxRequest, batch: Optional[TxBatch], left: int) -> int:
+    # Returns the number of items the host is asked for. With the default
+    # batch size of one the request stays exactly as old hosts expect it.
+    if batch is None or batch.size <= 1 or left <= 1:
+        return 1
+    n = min(batch.size, left)
+    tx_req.details.request_count = n
+    return n
+
+
 def _clear_tx_request(tx_req: TxRequest) -> None:
     tx_req.request_type = None
     tx_req.details.request_index = None
     tx_req.details.tx_hash = None
     tx_req.details.extra_data_len = None
     tx_req.details.extra_data_offset = None
+    tx_req.details.request_count = None
     tx_req.serialized.signature = None
     tx_req.serialized.signature_index = None
     tx_req.serialized.serialized_tx[:] = bytes()
@@ -234,8 +336,7 @@ def sanitize_tx_meta(tx: TransactionType, coin: CoinInfo) -> TransactionType:
     return tx
 
 
-def sanitize_tx_input(tx: TransactionType, coin: CoinInfo) -> TxInputType:
-    txi = tx.inputs[0]
+def sanitize_tx_input(txi: TxInputType, coin: CoinInfo) -> TxInputType:
     if txi.script_type is None:
         txi.script_type = InputScriptType.SPENDADDRESS
     if txi.sequence is None:
@@ -256,8 +357,7 @@ def sanitize_tx_input(tx: TransactionType, coin: CoinInfo) -> TxInputType:
     return txi
 
 
-def sanitize_tx_output(tx: TransactionType, coin: CoinInfo) -> TxOutputType:
-    txo = tx.outputs[0]
+def sanitize_tx_output(txo: TxOutputType, coin: CoinInfo) -> TxOutputType:
     if txo.multisig and txo.script_type not in MULTISIG_OUTPUT_SCRIPT_TYPES:
         raise wire.DataError("Multisig field provided but not expected.")
     if txo.address_n and txo.script_type not in CHANGE_OUTPUT_SCRIPT_TYPES:
@@ -284,8 +384,7 @@ def sanitize_tx_output(tx: TransactionType, coin: CoinInfo) -> TxOutputType:
     return txo
 
 
-def sanitize_tx_binoutput(tx: TransactionType, coin: CoinInfo) -> TxOutputBinType:
-    txo_bin = tx.bin_outputs[0]
+def sanitize_tx_binoutput(txo_bin: TxOutputBinType, coin: CoinInfo) -> TxOutputBinType:
     if txo_bin.amount is None:
         raise wire.DataError("Missing amount field.")
     if txo_bin.script_pubkey is None:
@@ -31,6 +31,17 @@ _TXSIZE_MULTISIGSCRIPT = const(3)
 _TXSIZE_WITNESSPKHASH = const(22)
 # size of a p2wsh script (1 version, 1 push, 32 hash)
 _TXSIZE_WITNESSSCRIPT = const(34)
+# size of a single-signature script (1 push, signature, 1 push, pubkey)
+_TXSIZE_SINGLESIG_SCRIPT = const(1 + _TXSIZE_SIGNATURE + 1 + _TXSIZE_PUBKEY)
+
+# Weight of a single-signature input by script type. The witness header is not
+# included, because it is counted once per transaction.
+_SINGLESIG_INPUT_WEIGHTS = {
+    InputScriptType.SPENDADDRESS: 4 * (_TXSIZE_INPUT + 1 + _TXSIZE_SINGLESIG_SCRIPT),
+    InputScriptType.SPENDWITNESS: 4 * (_TXSIZE_INPUT + 1) + _TXSIZE_SINGLESIG_SCRIPT,
+    InputScriptType.SPENDP2SHWITNESS: 4 * (_TXSIZE_INPUT + 2 + _TXSIZE_WITNESSPKHASH)
+    + _TXSIZE_SINGLESIG_SCRIPT,
+}
 
 
 class TxWeightCalculator:
@@ -51,6 +62,11 @@ class TxWeightCalculator:
             self.segwit = True
 
     def add_input(self, i: TxInputType) -> None:
+        if not i.multisig and i.script_type in _SINGLESIG_INPUT_WEIGHTS:
+            if i.script_type != InputScriptType.SPENDADDRESS:
+                self.add_witness_header()
+            self.counter += _SINGLESIG_INPUT_WEIGHTS[i.script_type]
+            return
 
         if i.multisig:
             multisig_script_size = _TXSIZE_MULTISIGSCRIPT + len(i.multisig.pubkeys) * (
@@ -1,13 +1,12 @@
-import ustruct as struct
 from micropython import const
 
 from trezor import wire
-from trezor.crypto.hashlib import blake2b
+from trezor.crypto import sighash143
 from trezor.messages import InputScriptType
 from trezor.messages.SignTx import SignTx
 from trezor.messages.TransactionType import TransactionType
 from trezor.messages.TxInputType import TxInputType
-from trezor.utils import HashWriter, ensure
+from trezor.utils import ensure
 
 from apps.common.coininfo import CoinInfo
 from apps.common.seed import Keychain
@@ -15,15 +14,7 @@ from apps.common.writers import write_bitcoin_varint
 
 from ..multisig import multisig_get_pubkeys
 from ..scripts import output_script_multisig, output_script_p2pkh
-from ..writers import (
-    TX_HASH_SIZE,
-    get_tx_hash,
-    write_bytes_fixed,
-    write_bytes_prefixed,
-    write_bytes_reversed,
-    write_uint32,
-    write_uint64,
-)
+from ..writers import write_uint32, write_uint64
 from . import helpers
 from .bitcoinlike import Bitcoinlike
 
@@ -86,72 +77,26 @@ class Overwintered(Bitcoinlike):
     # ===
 
     def init_hash143(self) -> None:
-        self.h_prevouts = HashWriter(blake2b(outlen=32, personal=b"ZcashPrevoutHash"))
-        self.h_sequence = HashWriter(blake2b(outlen=32, personal=b"ZcashSequencHash"))
-        self.h_outputs = HashWriter(blake2b(outlen=32, personal=b"ZcashOutputsHash"))
+        self.hash143 = sighash143(zcash=True)
 
     def hash143_preimage_hash(self, txi: TxInputType, pubkeyhash: bytes) -> bytes:
-        h_preimage = HashWriter(
-            blake2b(
-                outlen=32,
-                personal=b"ZcashSigHash" + struct.pack("<I", self.tx.branch_id),
-            )
-        )
-
-        # 1. nVersion | fOverwintered
-        write_uint32(h_preimage, self.tx.version | OVERWINTERED)
-        # 2. nVersionGroupId
-        write_uint32(h_preimage, self.tx.version_group_id)
-        # 3. hashPrevouts
-        write_bytes_fixed(h_preimage, get_tx_hash(self.h_prevouts), TX_HASH_SIZE)
-        # 4. hashSequence
-        write_bytes_fixed(h_preimage, get_tx_hash(self.h_sequence), TX_HASH_SIZE)
-        # 5. hashOutputs
-        write_bytes_fixed(h_preimage, get_tx_hash(self.h_outputs), TX_HASH_SIZE)
-
-        if self.tx.version == 3:
-            # 6. hashJoinSplits
-            write_bytes_fixed(h_preimage, b"\x00" * TX_HASH_SIZE, TX_HASH_SIZE)
-            # 7. nLockTime
-            write_uint32(h_preimage, self.tx.lock_time)
-            # 8. expiryHeight
-            write_uint32(h_preimage, self.tx.expiry)
-            # 9. nHashType
-            write_uint32(h_preimage, self.get_hash_type())
-        elif self.tx.version == 4:
-            zero_hash = b"\x00" * TX_HASH_SIZE
-            # 6. hashJoinSplits
-            write_bytes_fixed(h_preimage, zero_hash, TX_HASH_SIZE)
-            # 7. hashShieldedSpends
-            write_bytes_fixed(h_preimage, zero_hash, TX_HASH_SIZE)
-            # 8. hashShieldedOutputs
-            write_bytes_fixed(h_preimage, zero_hash, TX_HASH_SIZE)
-            # 9. nLockTime
-            write_uint32(h_preimage, self.tx.lock_time)
-            # 10. expiryHeight
-            write_uint32(h_preimage, self.tx.expiry)
-            # 11. valueBalance
-            write_uint64(h_preimage, 0)
-            # 12. nHashType
-            write_uint32(h_preimage, self.get_hash_type())
-        else:
+        if self.tx.version not in (3, 4):
             raise wire.DataError("Unsupported version for overwintered transaction")
 
-        # 10a /13a. outpoint
-        write_bytes_reversed(h_preimage, txi.prev_hash, TX_HASH_SIZE)
-        write_uint32(h_preimage, txi.prev_index)
-
-        # 10b / 13b. scriptCode
-        script_code = derive_script_code(txi, pubkeyhash)
-        write_bytes_prefixed(h_preimage, script_code)
-
-        # 10c / 13c. value
-        write_uint64(h_preimage, txi.amount)
-
-        # 10d / 13d. nSequence
-        write_uint32(h_preimage, txi.sequence)
-
-        return get_tx_hash(h_preimage)
+        # ZIP-0143 for version 3, ZIP-0243 for version 4
+        return self.hash143.preimage_hash(
+            txi.prev_hash,
+            txi.prev_index,
+            derive_script_code(txi, pubkeyhash),
+            txi.amount,
+            txi.sequence,
+            self.tx.version,
+            self.tx.lock_time,
+            self.get_hash_type(),
+            self.tx.version_group_id,
+            self.tx.expiry,
+            self.tx.branch_id,
+        )
 
 
 def derive_script_code(txi: TxInputType, pubkeyhash: bytes) -> bytearray:
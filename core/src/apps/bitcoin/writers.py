@@ -4,7 +4,7 @@ from trezor.crypto.hashlib import sha256
 from trezor.messages.TxInputType import TxInputType
 from trezor.messages.TxOutputBinType import TxOutputBinType
 from trezor.messages.TxOutputType import TxOutputType
-from trezor.utils import ensure
+from trezor.utils import ensure, write_uint
 
 from apps.common.writers import (  # noqa: F401
     empty_bytearray,
@@ -69,14 +69,10 @@ def write_op_push(w: Writer, n: int) -> None:
         w.append(n & 0xFF)
     elif n < 0xFFFF:
         w.append(0x4D)
-        w.append(n & 0xFF)
-        w.append((n >> 8) & 0xFF)
+        write_uint(w, n, 2)
     else:
         w.append(0x4E)
-        w.append(n & 0xFF)
-        w.append((n >> 8) & 0xFF)
-        w.append((n >> 16) & 0xFF)
-        w.append((n >> 24) & 0xFF)
+        write_uint(w, n, 4)
 
 
 def get_tx_hash(w: HashWriter, double: bool = False, reverse: bool = False) -> bytes:
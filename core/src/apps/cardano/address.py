@@ -1,7 +1,7 @@
 from trezor import log
 from trezor.crypto import base58, crc, hashlib
 
-from apps.common import HARDENED, cbor
+from apps.common import HARDENED, cbor, paths
 from apps.common.seed import remove_ed25519_prefix
 
 
@@ -27,6 +27,19 @@ def derive_address_and_node(keychain, path: list):
     return (_encode_address_raw(address_data_encoded), node)
 
 
+def derive_addresses(keychain, path: list, index: int, count: int) -> list:
+    """
+    Derives the addresses of the children index, ..., index + count - 1
+    of path at once, for enumerating the addresses of an account.
+    """
+    addresses = []
+    for node in keychain.derive_batch(path, index, count):
+        address_root = _get_address_root(node, None)
+        address_data_encoded = cbor.encode([address_root, {}, 0])
+        addresses.append(_encode_address_raw(address_data_encoded))
+    return addresses
+
+
 def is_safe_output_address(address) -> bool:
     """
     Determines whether it is safe to include the address as-is as
@@ -51,6 +64,21 @@ def is_safe_output_address(address) -> bool:
     return _encode_address_raw(address_data_encoded) == address
 
 
+_PATH_PATTERN = paths.compile_pattern(
+    (
+        5,
+        5,
+        (
+            44 | HARDENED,
+            1815 | HARDENED,
+            paths.hardened(0, 20),
+            paths.unhardened(1),
+            paths.unhardened(1000000),
+        ),
+    )
+)
+
+
 def validate_full_path(path: list) -> bool:
     """
     Validates derivation path to fit 44'/1815'/a'/{0,1}/i,
@@ -59,19 +87,7 @@ def validate_full_path(path: list) -> bool:
     The derivation scheme v1 allowed a'/0/i only,
     but in v2 it can be a'/1/i as well.
     """
-    if len(path) != 5:
-        return False
-    if path[0] != 44 | HARDENED:
-        return False
-    if path[1] != 1815 | HARDENED:
-        return False
-    if path[2] < HARDENED or path[2] > 20 | HARDENED:
-        return False
-    if path[3] != 0 and path[3] != 1:
-        return False
-    if path[4] > 1000000:
-        return False
-    return True
+    return paths.match_path(_PATH_PATTERN, path) >= 0
 
 
 def _address_hash(data) -> bytes:
@@ -1,4 +1,4 @@
-from storage import cache, device
+from storage import cache, derived, device
 from trezor import wire
 from trezor.crypto import bip32
 
@@ -7,7 +7,7 @@ from apps.common import mnemonic
 from apps.common.passphrase import get as get_passphrase
 
 if False:
-    from typing import Tuple
+    from typing import List, Optional, Tuple
 
     from apps.common.seed import Bip32Path, MsgIn, MsgOut, Handler, HandlerWithKeychain
 
@@ -31,6 +31,13 @@ class Keychain:
             node.derive_cardano(i)
         return node
 
+    def derive_batch(
+        self, node_path: Bip32Path, index: int, count: int
+    ) -> List[bip32.HDNode]:
+        """Derive the children index, ..., index + count - 1 of node_path."""
+        node = self.derive(node_path)
+        return node.derive_cardano_batch(index, count)
+
     # XXX the root node remains in session cache so we should not delete it
     # def __del__(self) -> None:
     #     self.root.__del__()
@@ -42,6 +49,11 @@ async def get_keychain(ctx: wire.Context) -> Keychain:
         raise wire.NotInitialized("Device is not initialized")
 
     passphrase = await get_passphrase(ctx)
+    if not passphrase:
+        root = _load_root()
+        if root is not None:
+            return Keychain(root)
+
     if mnemonic.is_bip39():
         # derive the root node from mnemonic and passphrase via Cardano Icarus algorithm
         root = bip32.from_mnemonic_cardano(mnemonic.get_secret().decode(), passphrase)
@@ -54,10 +66,45 @@ async def get_keychain(ctx: wire.Context) -> Keychain:
     for i in SEED_NAMESPACE:
         root.derive_cardano(i)
 
+    if not passphrase:
+        _store_root(root)
+
     keychain = Keychain(root)
     return keychain
 
 
+# The Icarus derivation runs 4096 rounds of PBKDF2, so the namespaced root of
+# the wallet without a passphrase is kept in the encrypted storage.
+
+
+def _store_root(root: bip32.HDNode) -> None:
+    derived.set_cardano_root(
+        root.depth().to_bytes(4, "big")
+        + root.fingerprint().to_bytes(4, "big")
+        + root.child_num().to_bytes(4, "big")
+        + root.chain_code()
+        + root.private_key()
+        + root.private_key_ext()
+        + root.public_key()
+    )
+
+
+def _load_root() -> Optional[bip32.HDNode]:
+    data = derived.get_cardano_root()
+    if data is None:
+        return None
+    return bip32.HDNode(
+        depth=int.from_bytes(data[0:4], "big"),
+        fingerprint=int.from_bytes(data[4:8], "big"),
+        child_num=int.from_bytes(data[8:12], "big"),
+        chain_code=data[12:44],
+        private_key=data[44:76],
+        private_key_ext=data[76:108],
+        public_key=data[108:141],
+        curve_name="ed25519 cardano seed",
+    )
+
+
 def with_keychain(func: HandlerWithKeychain[MsgIn, MsgOut]) -> Handler[MsgIn, MsgOut]:
     async def wrapper(ctx: wire.Context, msg: MsgIn) -> MsgOut:
         keychain = await get_keychain(ctx)
@@ -27,9 +27,8 @@ KNOWN_PROTOCOL_MAGICS = {764824073: "Mainnet", 1097911063: "Testnet"}
 
 
 # we consider addresses from the external chain as possible change addresses as well
-def is_change(output, inputs):
-    for input in inputs:
-        inp = input.address_n
+def is_change(output, input_paths):
+    for inp in input_paths:
         if (
             not output[:ACCOUNT_PREFIX_DEPTH] == inp[:ACCOUNT_PREFIX_DEPTH]
             or not output[-2] < 2
@@ -49,7 +48,7 @@ async def show_tx(
     raw_outputs: list,
 ) -> None:
     for index, output in enumerate(outputs):
-        if is_change(raw_outputs[index].address_n, raw_inputs):
+        if is_change(raw_outputs[index].address_n, [i.address_n for i in raw_inputs]):
             continue
 
         await confirm_sending(ctx, outcoins[index], output)
@@ -63,8 +62,27 @@ async def request_transaction(ctx, tx_req: CardanoTxRequest, index: int):
     return await ctx.call(tx_req, CardanoTxAck)
 
 
+async def request_input(ctx, index: int, tx_part: bytes):
+    tx_req = CardanoTxRequest(input_index=index, tx_body=tx_part or None)
+    tx_ack = await ctx.call(tx_req, CardanoTxAck)
+    if tx_ack.input is None:
+        raise wire.ProcessError("Input " + str(index) + " was not sent")
+    return tx_ack.input
+
+
+async def request_output(ctx, index: int, tx_part: bytes):
+    tx_req = CardanoTxRequest(output_index=index, tx_body=tx_part or None)
+    tx_ack = await ctx.call(tx_req, CardanoTxAck)
+    if tx_ack.output is None:
+        raise wire.ProcessError("Output " + str(index) + " was not sent")
+    return tx_ack.output
+
+
 @seed.with_keychain
 async def sign_tx(ctx, msg, keychain: seed.Keychain):
+    if msg.inputs_count is not None:
+        return await sign_tx_streamed(ctx, msg, keychain)
+
     progress.init(msg.transactions_count, "Loading data")
 
     try:
@@ -122,6 +140,163 @@ async def sign_tx(ctx, msg, keychain: seed.Keychain):
     return tx
 
 
+async def sign_tx_streamed(ctx, msg, keychain: seed.Keychain):
+    """
+    Signs a transaction whose inputs and outputs are requested one by one.
+    The tx body is serialised item by item into a running hash and handed
+    back to the host in parts, piggybacked on the following request, so the
+    memory use does not grow with the size of the transaction.  The outputs
+    are serialised in the order they are sent and the witnesses are computed
+    at the end, asking for the inputs a second time.
+    """
+    if msg.inputs or msg.outputs:
+        raise wire.ProcessError("Inputs and outputs must be requested one by one")
+    if not msg.inputs_count or not msg.outputs_count:
+        raise wire.ProcessError("Transaction must have inputs and outputs")
+
+    inputs_count = msg.inputs_count
+    outputs_count = msg.outputs_count
+    transactions_count = msg.transactions_count or 0
+    network_name = KNOWN_PROTOCOL_MAGICS.get(msg.protocol_magic, "Unknown")
+
+    steps = 2 * inputs_count + transactions_count + outputs_count
+    progress.init(steps, "Loading data")
+
+    tx_hasher = hashlib.blake2b(outlen=32)
+    # the inputs are hashed on both passes to make sure they do not change
+    inputs_check = hashlib.sha256()
+    inputs_check_second = hashlib.sha256()
+    # the parts of the tx body that were not handed to the host yet
+    tx_part = (
+        cbor.create_array_header(2)
+        + cbor.create_array_header(3)
+        + cbor.create_indefinite_array_header()
+    )
+    tx_hasher.update(tx_part[1:])
+
+    try:
+        # the previous outputs spent by the inputs, {prev_hash: [prev_index]}
+        spent = {}
+        input_paths = []
+        for index in range(inputs_count):
+            progress.advance()
+            input = await request_input(ctx, index, tx_part)
+            await validate_path(
+                ctx, validate_full_path, keychain, input.address_n, CURVE
+            )
+            if input.prev_hash is None or input.prev_index is None:
+                raise wire.ProcessError(
+                    "Each input must have prev_hash and prev_index"
+                )
+            tx_part = cbor.encode(input_cbor(input))
+            tx_hasher.update(tx_part)
+            inputs_check.update(tx_part)
+            inputs_check.update(cbor.encode(input.address_n))
+            spent.setdefault(bytes(input.prev_hash), []).append(input.prev_index)
+            # only the account matters for the change outputs
+            account = input.address_n[:ACCOUNT_PREFIX_DEPTH]
+            if account not in input_paths:
+                input_paths.append(account)
+
+        # add up the spent amounts, consuming the previous transactions one by one
+        input_coins_sum = 0
+        for index in range(transactions_count):
+            progress.advance()
+            tx_req = CardanoTxRequest(tx_body=tx_part or None)
+            tx_ack = await request_transaction(ctx, tx_req, index)
+            tx_part = b""
+            prev_hash = hashlib.blake2b(
+                data=bytes(tx_ack.transaction), outlen=32
+            ).digest()
+            prev_indices = spent.pop(prev_hash, None)
+            if prev_indices is None:
+                continue
+            prev_outputs = cbor.decode(tx_ack.transaction)[1]
+            for prev_index in prev_indices:
+                input_coins_sum += prev_outputs[prev_index][1]
+
+        if spent:
+            raise wire.ProcessError("No tx data sent for some of the inputs")
+
+        separator = cbor.create_break() + cbor.create_indefinite_array_header()
+        tx_hasher.update(separator)
+        tx_part += separator
+
+        outgoing_coins_sum = 0
+        change_coins_sum = 0
+        for index in range(outputs_count):
+            progress.advance()
+            output = await request_output(ctx, index, tx_part)
+            if output.address_n:
+                address, _ = derive_address_and_node(keychain, output.address_n)
+                change = is_change(output.address_n, input_paths)
+            else:
+                if output.address is None:
+                    raise wire.ProcessError(
+                        "Each output must have address or address_n field!"
+                    )
+                if not is_safe_output_address(output.address):
+                    raise wire.ProcessError("Invalid output address!")
+                address = output.address
+                change = False
+            tx_part = cbor.encode([cbor.Raw(base58.decode(address)), output.amount])
+            tx_hasher.update(tx_part)
+
+            if change:
+                change_coins_sum += output.amount
+            else:
+                outgoing_coins_sum += output.amount
+                await confirm_sending(ctx, output.amount, address)
+                progress.report_init("Loading data")
+
+        fee = input_coins_sum - outgoing_coins_sum - change_coins_sum
+        await confirm_transaction(ctx, outgoing_coins_sum, fee, network_name)
+        progress.report_init("Signing")
+
+        # the attributes are always empty
+        separator = cbor.create_break() + cbor.create_map_header(0)
+        tx_hasher.update(separator)
+        tx_hash = tx_hasher.digest()
+        tx_part += separator
+
+        tx_part += cbor.create_array_header(inputs_count)
+        for index in range(inputs_count):
+            progress.advance()
+            input = await request_input(ctx, index, tx_part)
+            inputs_check_second.update(cbor.encode(input_cbor(input)))
+            inputs_check_second.update(cbor.encode(input.address_n))
+            witness = build_witness(keychain, msg.protocol_magic, input, tx_hash)
+            tx_part = cbor.encode(witness)
+
+        if inputs_check.digest() != inputs_check_second.digest():
+            raise wire.ProcessError("Transaction has changed during signing")
+
+    except ValueError as e:
+        if __debug__:
+            log.exception(__name__, e)
+        raise wire.ProcessError("Signing failed")
+
+    return CardanoSignedTx(tx_hash=tx_hash, tx_body=tx_part)
+
+
+def input_cbor(input) -> list:
+    return [
+        (input.type or 0),
+        cbor.Tagged(24, cbor.encode([input.prev_hash, input.prev_index])),
+    ]
+
+
+def build_witness(keychain, protocol_magic: int, input, tx_aux_hash: bytes) -> list:
+    _, node = derive_address_and_node(keychain, input.address_n)
+    message = b"\x01" + cbor.encode(protocol_magic) + b"\x58\x20" + tx_aux_hash
+    signature = ed25519.sign_ext(node.private_key(), node.private_key_ext(), message)
+    extended_public_key = remove_ed25519_prefix(node.public_key()) + node.chain_code()
+    return [
+        (input.type or 0),
+        cbor.Tagged(24, cbor.encode([extended_public_key, signature])),
+    ]
+
+
 class Transaction:
     def __init__(
         self,
@@ -171,27 +346,11 @@ class Transaction:
         self.change_coins = change_coins
         self.change_derivation_paths = change_derivation_paths
 
-    def _build_witnesses(self, tx_aux_hash: str):
-        witnesses = []
-        for input in self.inputs:
-            _, node = derive_address_and_node(self.keychain, input.address_n)
-            message = (
-                b"\x01" + cbor.encode(self.protocol_magic) + b"\x58\x20" + tx_aux_hash
-            )
-            signature = ed25519.sign_ext(
-                node.private_key(), node.private_key_ext(), message
-            )
-            extended_public_key = (
-                remove_ed25519_prefix(node.public_key()) + node.chain_code()
-            )
-            witnesses.append(
-                [
-                    (input.type or 0),
-                    cbor.Tagged(24, cbor.encode([extended_public_key, signature])),
-                ]
-            )
-
-        return witnesses
+    def _build_witnesses(self, tx_aux_hash: bytes):
+        return [
+            build_witness(self.keychain, self.protocol_magic, input, tx_aux_hash)
+            for input in self.inputs
+        ]
 
     @staticmethod
     def compute_fee(input_coins_sum: int, outgoing_coins: list, change_coins: list):
@@ -204,15 +363,7 @@ class Transaction:
 
         self._process_outputs()
 
-        inputs_cbor = []
-        for input in self.inputs:
-            inputs_cbor.append(
-                [
-                    (input.type or 0),
-                    cbor.Tagged(24, cbor.encode([input.prev_hash, input.prev_index])),
-                ]
-            )
-
+        inputs_cbor = [input_cbor(input) for input in self.inputs]
         inputs_cbor = cbor.IndefiniteLengthArray(inputs_cbor)
 
         outputs_cbor = []
@@ -229,10 +380,12 @@ class Transaction:
         outputs_cbor = cbor.IndefiniteLengthArray(outputs_cbor)
 
         tx_aux_cbor = [inputs_cbor, outputs_cbor, self.attributes]
-        tx_hash = hashlib.blake2b(data=cbor.encode(tx_aux_cbor), outlen=32).digest()
+        tx_aux = cbor.encode(tx_aux_cbor)
+        tx_hash = hashlib.blake2b(data=tx_aux, outlen=32).digest()
 
         witnesses = self._build_witnesses(tx_hash)
-        tx_body = cbor.encode([tx_aux_cbor, witnesses])
+        # reuse the encoded tx_aux instead of encoding it a second time
+        tx_body = cbor.encode([cbor.Raw(tx_aux), witnesses])
 
         self.fee = self.compute_fee(
             self.input_coins_sum, self.outgoing_coins, self.change_coins
@@ -99,108 +99,98 @@ def _cbor_encode(value: Value) -> Iterable[bytes]:
         raise NotImplementedError
 
 
-def _read_length(cbor: bytes, aux: int) -> Tuple[int, bytes]:
+def _read_length(cbor: bytes, offset: int, aux: int) -> Tuple[int, int]:
     if aux < _CBOR_UINT8_FOLLOWS:
-        return (aux, cbor)
+        return (aux, offset)
     elif aux == _CBOR_UINT8_FOLLOWS:
-        return (cbor[0], cbor[1:])
+        return (cbor[offset], offset + 1)
     elif aux == _CBOR_UINT16_FOLLOWS:
-        res = cbor[1]
-        res += cbor[0] << 8
-        return (res, cbor[2:])
+        return (struct.unpack_from(">H", cbor, offset)[0], offset + 2)
     elif aux == _CBOR_UINT32_FOLLOWS:
-        res = cbor[3]
-        res += cbor[2] << 8
-        res += cbor[1] << 16
-        res += cbor[0] << 24
-        return (res, cbor[4:])
+        return (struct.unpack_from(">I", cbor, offset)[0], offset + 4)
     elif aux == _CBOR_UINT64_FOLLOWS:
-        res = cbor[7]
-        res += cbor[6] << 8
-        res += cbor[5] << 16
-        res += cbor[4] << 24
-        res += cbor[3] << 32
-        res += cbor[2] << 40
-        res += cbor[1] << 48
-        res += cbor[0] << 56
-        return (res, cbor[8:])
+        return (struct.unpack_from(">Q", cbor, offset)[0], offset + 8)
     else:
         raise NotImplementedError("Length %d not suppported" % aux)
 
 
-def _cbor_decode(cbor: bytes) -> Tuple[Value, bytes]:
-    fb = cbor[0]
-    data = b""
+def _cbor_decode(cbor: bytes, offset: int) -> Tuple[Value, int]:
+    """
+    Decodes the item starting at `offset`, returns it together with the offset
+    of the next item.  The input is never copied, only the decoded strings are.
+    """
+    fb = cbor[offset]
+    offset += 1
     fb_type = fb & _CBOR_TYPE_MASK
     fb_aux = fb & _CBOR_INFO_BITS
     if fb_type == _CBOR_UNSIGNED_INT:
-        return _read_length(cbor[1:], fb_aux)
+        return _read_length(cbor, offset, fb_aux)
     elif fb_type == _CBOR_NEGATIVE_INT:
-        val, data = _read_length(cbor[1:], fb_aux)
-        return (-1 - val, data)
+        val, offset = _read_length(cbor, offset, fb_aux)
+        return (-1 - val, offset)
     elif fb_type == _CBOR_BYTE_STRING:
-        ln, data = _read_length(cbor[1:], fb_aux)
-        return (data[0:ln], data[ln:])
+        ln, offset = _read_length(cbor, offset, fb_aux)
+        if offset + ln > len(cbor):
+            raise ValueError
+        return (cbor[offset : offset + ln], offset + ln)
     elif fb_type == _CBOR_TEXT_STRING:
-        ln, data = _read_length(cbor[1:], fb_aux)
-        return (data[0:ln].decode(), data[ln:])
+        ln, offset = _read_length(cbor, offset, fb_aux)
+        if offset + ln > len(cbor):
+            raise ValueError
+        return (cbor[offset : offset + ln].decode(), offset + ln)
     elif fb_type == _CBOR_ARRAY:
+        res = []  # type: Value
         if fb_aux == _CBOR_VAR_FOLLOWS:
-            res = []  # type: Value
-            data = cbor[1:]
             while True:
-                item, data = _cbor_decode(data)
+                item, offset = _cbor_decode(cbor, offset)
                 if item == _CBOR_PRIMITIVE + _CBOR_BREAK:
                     break
                 res.append(item)
-            return (res, data)
         else:
-            ln, data = _read_length(cbor[1:], fb_aux)
-            res = []
+            ln, offset = _read_length(cbor, offset, fb_aux)
             for i in range(ln):
-                item, data = _cbor_decode(data)
+                item, offset = _cbor_decode(cbor, offset)
                 res.append(item)
-            return (res, data)
+        return (res, offset)
     elif fb_type == _CBOR_MAP:
         res = {}
         if fb_aux == _CBOR_VAR_FOLLOWS:
-            data = cbor[1:]
             while True:
-                key, data = _cbor_decode(data)
+                key, offset = _cbor_decode(cbor, offset)
                 if key in res:
                     raise ValueError
                 if key == _CBOR_PRIMITIVE + _CBOR_BREAK:
                     break
-                value, data = _cbor_decode(data)
+                value, offset = _cbor_decode(cbor, offset)
                 res[key] = value
         else:
-            ln, data = _read_length(cbor[1:], fb_aux)
+            ln, offset = _read_length(cbor, offset, fb_aux)
             for i in range(ln):
-                key, data = _cbor_decode(data)
+                key, offset = _cbor_decode(cbor, offset)
                 if key in res:
                     raise ValueError
-                value, data = _cbor_decode(data)
+                value, offset = _cbor_decode(cbor, offset)
                 res[key] = value
-        return res, data
+        return res, offset
     elif fb_type == _CBOR_TAG:
-        val, data = _read_length(cbor[1:], fb_aux)
-        item, data = _cbor_decode(data)
+        val, offset = _read_length(cbor, offset, fb_aux)
+        item, offset = _cbor_decode(cbor, offset)
         if val == _CBOR_RAW_TAG:  # only tag 24 (0x18) is supported
-            return item, data
+            return item, offset
         else:
-            return Tagged(val, item), data
+            return Tagged(val, item), offset
     elif fb_type == _CBOR_PRIMITIVE:
         if fb_aux == _CBOR_FALSE:
-            return (False, cbor[1:])
+            return (False, offset)
         elif fb_aux == _CBOR_TRUE:
-            return (True, cbor[1:])
+            return (True, offset)
         elif fb_aux == _CBOR_BREAK:
-            return (cbor[0], cbor[1:])
+            return (fb, offset)
         else:
             raise NotImplementedError
     else:
         if __debug__:
-            log.debug(__name__, "not implemented (decode): %s", cbor[0])
+            log.debug(__name__, "not implemented (decode): %s", fb)
         raise NotImplementedError
 
 
@@ -239,8 +229,28 @@ def encode(value: Value) -> bytes:
     return b"".join(_cbor_encode(value))
 
 
+# The headers below let a long structure be encoded part by part, so that
+# the whole encoding never has to be held in memory.
+
+
+def create_array_header(size: int) -> bytes:
+    return _header(_CBOR_ARRAY, size)
+
+
+def create_map_header(size: int) -> bytes:
+    return _header(_CBOR_MAP, size)
+
+
+def create_indefinite_array_header() -> bytes:
+    return bytes([_CBOR_ARRAY + _CBOR_VAR_FOLLOWS])
+
+
+def create_break() -> bytes:
+    return bytes([_CBOR_PRIMITIVE + _CBOR_BREAK])
+
+
 def decode(cbor: bytes) -> Value:
-    res, check = _cbor_decode(cbor)
-    if not (check == b""):
+    res, offset = _cbor_decode(cbor, 0)
+    if offset != len(cbor):
         raise ValueError
     return res
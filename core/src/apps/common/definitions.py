@@ -0,0 +1,195 @@
+import ustruct
+from micropython import const
+from ubinascii import unhexlify
+
+from trezor import fatfs, sdcard
+from trezor.crypto.curve import ed25519
+from trezor.crypto.hashlib import sha256
+
+if False:
+    from typing import Dict, Optional
+
+# A definitions blob is a signed, sorted table of fixed size records, which is
+# stored on the SD card and searched in place:
+#
+#   header     magic "trdf", version, kind, key size and record size (u8),
+#              record count (u32), records per block (u16), reserved (u16)
+#   index      the key of the first record and the SHA-256 of every block
+#   signature  Ed25519 signature of SHA-256(header || index)
+#   records    records sorted by their key, blocks of `records per block`
+#
+# Only the header and the index are read and verified when the blob is
+# loaded. A lookup binary-searches the index in RAM, then reads one block of
+# records from the card and checks it against the hash in the index.
+
+_MAGIC = b"trdf"
+_VERSION = const(1)
+_HEADER_LEN = const(16)
+_HASH_LEN = const(32)
+_SIGNATURE_LEN = const(64)
+# the index is kept in RAM, this is enough for about 300 blocks
+_MAX_INDEX_LEN = const(16 * 1024)
+# a block of records is read into RAM on every lookup
+_MAX_BLOCK_LEN = const(4 * 1024)
+
+KIND_ETHEREUM_TOKENS = const(1)
+
+# There is no production signing key yet, so release builds do not read any
+# definitions from the SD card and only use the built-in ones.
+if __debug__:
+    # development key, the secret key is b"A" * 32 (see common/tools/cointool.py)
+    PUBLIC_KEYS = (
+        unhexlify("db995fe25169d141cab9bbba92baa01f9f2e1ece7df4cb2ac05190f37fcc1f9d"),
+    )
+else:
+    PUBLIC_KEYS = ()
+
+# verified blobs by their path on the SD card
+_loaded = {}  # type: Dict[str, Definitions]
+
+
+class Definitions:
+    def __init__(
+        self,
+        key_size: int,
+        record_size: int,
+        count: int,
+        per_block: int,
+        index: bytes,
+        records_offset: int,
+    ) -> None:
+        self.key_size = key_size
+        self.record_size = record_size
+        self.count = count
+        self.per_block = per_block
+        self.index = index
+        self.records_offset = records_offset
+
+    def find(self, f: fatfs.FatFSFile, key: bytes) -> Optional[bytes]:
+        """
+        Returns the value of the record with `key`, or None if there is no
+        such record. Raises ValueError if the blob in `f` has changed since it
+        was loaded.
+        """
+        if len(key) != self.key_size:
+            return None
+        key_size = self.key_size
+        entry = key_size + _HASH_LEN
+        index = self.index
+
+        # find the last block whose first key is not greater than key
+        lo = 0
+        hi = len(index) // entry
+        while lo < hi:
+            mid = (lo + hi) // 2
+            if index[mid * entry : mid * entry + key_size] <= key:
+                lo = mid + 1
+            else:
+                hi = mid
+        block = lo - 1
+        if block < 0:
+            return None
+
+        size = self.record_size
+        first = block * self.per_block
+        records = bytearray(min(self.per_block, self.count - first) * size)
+        f.seek(self.records_offset + first * size)
+        offset = block * entry + key_size
+        if (
+            f.read(records) != len(records)
+            or sha256(records).digest() != index[offset : offset + _HASH_LEN]
+        ):
+            raise ValueError("Definitions changed")
+
+        lo = 0
+        hi = len(records) // size
+        while lo < hi:
+            mid = (lo + hi) // 2
+            offset = mid * size
+            k = records[offset : offset + key_size]
+            if key < k:
+                hi = mid
+            elif key > k:
+                lo = mid + 1
+            else:
+                return bytes(records[offset + key_size : offset + size])
+        return None
+
+
+def load(f: fatfs.FatFSFile, size: int, kind: int) -> Optional[Definitions]:
+    """
+    Reads the header and the index of a definitions blob of `kind` and
+    verifies their signature. `size` is the length of the file. Returns None if
+    the blob is not valid.
+    """
+    header = bytearray(_HEADER_LEN)
+    if f.read(header) != _HEADER_LEN:
+        return None
+    magic, version, k, key_size, record_size, count, per_block, _ = ustruct.unpack(
+        "<4sBBBBIHH", header
+    )
+    if magic != _MAGIC or version != _VERSION or k != kind:
+        return None
+    if key_size == 0 or record_size < key_size or per_block == 0:
+        return None
+    if per_block * record_size > _MAX_BLOCK_LEN:
+        return None
+
+    # the header is not verified yet, check the sizes before allocating
+    blocks = (count + per_block - 1) // per_block
+    index_len = blocks * (key_size + _HASH_LEN)
+    if index_len > _MAX_INDEX_LEN:
+        return None
+    records_offset = _HEADER_LEN + index_len + _SIGNATURE_LEN
+    if records_offset + count * record_size != size:
+        return None
+
+    index = bytearray(index_len)
+    signature = bytearray(_SIGNATURE_LEN)
+    if f.read(index) != len(index) or f.read(signature) != _SIGNATURE_LEN:
+        return None
+
+    h = sha256(header)
+    h.update(index)
+    digest = h.digest()
+    for public_key in PUBLIC_KEYS:
+        if ed25519.verify(public_key, signature, digest):
+            break
+    else:
+        return None
+
+    return Definitions(
+        key_size, record_size, count, per_block, bytes(index), records_offset
+    )
+
+
+def lookup(path: str, kind: int, key: bytes) -> Optional[bytes]:
+    """
+    Returns the value of the record with `key` in the definitions blob at
+    `path` on the SD card, or None if there is no card, no valid blob or no
+    such record. The blob is verified once and kept loaded.
+    """
+    if not PUBLIC_KEYS or not sdcard.is_present():
+        return None
+    try:
+        with sdcard.filesystem():
+            with fatfs.open(path, "r") as f:
+                definitions = _loaded.get(path)
+                if definitions is None:
+                    definitions = load(f, fatfs.stat(path)[0], kind)
+                    if definitions is None:
+                        return None
+                    _loaded[path] = definitions
+                return definitions.find(f, key)
+    except ValueError:
+        # the card was swapped or the blob was rewritten, load it again the
+        # next time
+        _loaded.pop(path, None)
+    except OSError:
+        # no card filesystem or no blob, fatfs.FatFSError is an OSError
+        pass
+    except MemoryError:
+        # the blob is within the limits, but the heap is too fragmented, try
+        # again the next time
+        _loaded.pop(path, None)
+    return None
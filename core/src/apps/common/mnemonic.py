@@ -1,6 +1,8 @@
+from micropython import const
+
 import storage.device
-from trezor import ui, utils, workflow
-from trezor.crypto import bip39, slip39
+from trezor import loop, ui, utils, workflow
+from trezor.crypto import bip39, pbkdf2, slip39
 from trezor.messages import BackupType
 from trezor.ui.text import Text
 
@@ -8,6 +10,9 @@ if False:
     from typing import Optional, Tuple
     from trezor.messages.ResetDevice import EnumTypeBackupType
 
+_BIP39_PBKDF2_ROUNDS = const(2048)
+_BIP39_PBKDF2_STEPS = const(16)  # the event loop runs between the steps
+
 
 def get() -> Tuple[Optional[bytes], int]:
     return get_secret(), get_type()
@@ -55,6 +60,36 @@ def get_seed(passphrase: str = "", progress_bar: bool = True) -> bytes:
     return seed
 
 
+async def get_seed_async(passphrase: str = "", progress_bar: bool = True) -> bytes:
+    """
+    Same as get_seed(), but a BIP-39 seed is derived in steps, giving the event
+    loop a turn after each of them, so that USB and the UI are still serviced
+    during the derivation.
+    """
+    if not is_bip39():
+        return get_seed(passphrase, progress_bar)
+
+    mnemonic_secret = get_secret()
+    if mnemonic_secret is None:
+        raise ValueError("Mnemonic not set")
+
+    render = progress_bar and not utils.DISABLE_ANIMATION
+    if render:
+        _start_progress()
+
+    # same as mnemonic_to_seed() in crypto/bip39.c, which ends the passphrase
+    # at the first zero byte
+    salt = b"mnemonic" + passphrase.encode().split(b"\x00", 1)[0]
+    pbkdf = pbkdf2(pbkdf2.HMAC_SHA512, mnemonic_secret, salt)
+    for step in range(_BIP39_PBKDF2_STEPS):
+        pbkdf.update(_BIP39_PBKDF2_ROUNDS // _BIP39_PBKDF2_STEPS)
+        if render:
+            _render_progress(step + 1, _BIP39_PBKDF2_STEPS)
+        await loop.sleep(0)
+
+    return pbkdf.key()
+
+
 def _start_progress() -> None:
     # Because we are drawing to the screen manually, without a layout, we
     # should make sure that no other layout is running.
@@ -66,4 +101,5 @@ def _start_progress() -> None:
 def _render_progress(progress: int, total: int) -> None:
     p = 1000 * progress // total
     ui.display.loader(p, False, 18, ui.WHITE, ui.BG)
-    ui.refresh()
+    if ui.frame_due():
+        ui.refresh()
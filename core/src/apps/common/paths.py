@@ -1,17 +1,31 @@
+import ustruct
 from micropython import const
 
 from trezor import ui
 from trezor.messages import ButtonRequestType
 from trezor.ui.text import Text
+from trezor.utils import match_path
 
 from apps.common import HARDENED
 from apps.common.confirm import require_confirm
 
 if False:
-    from typing import Any, Callable, List
+    from typing import Any, Callable, Dict, List, Sequence, Tuple, Union
     from trezor import wire
     from apps.common import seed
 
+    Constraint = Union[int, Tuple[int, int], List[Union[int, Tuple[int, int]]]]
+    Alternative = Tuple[int, int, Sequence[Constraint]]
+
+# maximal path length of a pattern alternative that does not limit the length
+UNLIMITED = const(255)
+
+# any value of a path component
+ANY = (0, 0xFFFFFFFF)
+
+# compiled patterns of validate_path_for_get_public_key, by slip44 id
+_get_public_key_patterns = {}  # type: Dict[int, bytes]
+
 
 async def validate_path(
     ctx: wire.Context,
@@ -35,26 +49,59 @@ async def show_path_warning(ctx: wire.Context, path: List[int]) -> None:
     await require_confirm(ctx, text, ButtonRequestType.UnknownDerivationPath)
 
 
+def compile_pattern(*alternatives: Alternative) -> bytes:
+    """
+    Compiles the alternatives of a path pattern for `trezor.utils.match_path`.
+    An alternative is the minimal and maximal length of the path and the
+    constraints of its leading components, the other components may have any
+    value. A constraint is a value, an inclusive (lo, hi) range or a list of
+    values and ranges.
+    """
+    pattern = bytearray()
+    for min_len, max_len, constraints in alternatives:
+        pattern.extend(bytes((min_len, max_len, len(constraints))))
+        for constraint in constraints:
+            if not isinstance(constraint, list):
+                constraint = [constraint]
+            pattern.append(len(constraint))
+            for r in constraint:
+                if isinstance(r, int):
+                    r = (r, r)
+                pattern.extend(ustruct.pack("<II", r[0], r[1]))
+    return bytes(pattern)
+
+
+def hardened(lo: int, hi: int) -> Tuple[int, int]:
+    return (lo | HARDENED, hi | HARDENED)
+
+
+def unhardened(hi: int = HARDENED - 1) -> Tuple[int, int]:
+    return (0, hi)
+
+
 def validate_path_for_get_public_key(path: list, slip44_id: int) -> bool:
     """
     Checks if path has at least three hardened items and slip44 id matches.
     The path is allowed to have more than three items, but all the following
     items have to be non-hardened.
     """
-    length = len(path)
-    if length < 3 or length > 5:
-        return False
-    if path[0] != 44 | HARDENED:
-        return False
-    if path[1] != slip44_id | HARDENED:
-        return False
-    if path[2] < HARDENED or path[2] > 20 | HARDENED:
-        return False
-    if length > 3 and is_hardened(path[3]):
-        return False
-    if length > 4 and is_hardened(path[4]):
-        return False
-    return True
+    pattern = _get_public_key_patterns.get(slip44_id)
+    if pattern is None:
+        pattern = compile_pattern(
+            (
+                3,
+                5,
+                (
+                    44 | HARDENED,
+                    slip44_id | HARDENED,
+                    hardened(0, 20),
+                    unhardened(),
+                    unhardened(),
+                ),
+            )
+        )
+        _get_public_key_patterns[slip44_id] = pattern
+    return match_path(pattern, path) >= 0
 
 
 def is_hardened(i: int) -> bool:
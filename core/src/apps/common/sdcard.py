@@ -125,6 +125,10 @@ async def request_sd_salt(
     if not storage.sd_salt.is_enabled():
         return None
 
+    salt = storage.sd_salt.load_cached_sd_salt()
+    if salt is not None:
+        return salt
+
     while True:
         await ensure_sdcard(ctx, ensure_filesystem=False)
         try:
@@ -2,7 +2,7 @@ from storage import cache, device
 from trezor import wire
 from trezor.crypto import bip32, hashlib, hmac
 
-from apps.common import HARDENED, mnemonic
+from apps.common import HARDENED, mnemonic, paths
 from apps.common.passphrase import get as get_passphrase
 
 if False:
@@ -12,6 +12,7 @@ if False:
         Callable,
         Dict,
         List,
+        Optional,
         Sequence,
         Tuple,
         TypeVar,
@@ -63,11 +64,30 @@ class Slip21Node:
         return Slip21Node(data=self.data)
 
 
+# maximum number of namespace and account nodes kept in the session cache
+_ROOT_CACHE_SIZE = 16
+
+
 class Keychain:
-    def __init__(self, seed: bytes, namespaces: Sequence[Namespace]) -> None:
+    def __init__(
+        self,
+        seed: bytes,
+        namespaces: Sequence[Namespace],
+        root_cache: Dict[Tuple, NodeType] = None,
+    ) -> None:
         self.seed = seed
         self.namespaces = namespaces  # type: Sequence[Namespace]
-        self.roots = {}  # type: Dict[int, NodeType]
+        # BIP-32 namespaces are compiled into a single pattern, so that every
+        # path of the workflow is matched against all of them at once
+        self.namespace_pattern = None  # type: Optional[bytes]
+        if all(curve != "slip21" for curve, _ in namespaces):
+            self.namespace_pattern = paths.compile_pattern(
+                *[(len(ns), paths.UNLIMITED, ns) for _, ns in namespaces]
+            )
+        self.roots = {}  # type: Dict[Tuple, NodeType]
+        # nodes shared by all keychains of the session, owned by the session
+        # cache and wiped in clear_root_cache()
+        self.root_cache = root_cache
 
     def __del__(self) -> None:
         for root in self.roots.values():
@@ -76,13 +96,21 @@ class Keychain:
         del self.seed
 
     def match_path(self, path: PathType) -> Tuple[int, PathType]:
-        for i, (curve, ns) in enumerate(self.namespaces):
-            if path[: len(ns)] == ns:
-                if "ed25519" in curve and not _path_hardened(path):
-                    raise wire.DataError("Forbidden key path")
-                return i, path[len(ns) :]
-
-        raise wire.DataError("Forbidden key path")
+        if self.namespace_pattern is not None:
+            i = paths.match_path(self.namespace_pattern, path)
+        else:
+            i = -1
+            for j, (_, ns) in enumerate(self.namespaces):
+                if path[: len(ns)] == ns:
+                    i = j
+                    break
+        if i < 0:
+            raise wire.DataError("Forbidden key path")
+
+        curve, ns = self.namespaces[i]
+        if "ed25519" in curve and not _path_hardened(path):
+            raise wire.DataError("Forbidden key path")
+        return i, path[len(ns) :]
 
     def _new_root(self, curve: str) -> NodeType:
         if curve == "slip21":
@@ -90,16 +118,39 @@ class Keychain:
         else:
             return bip32.from_seed(self.seed, curve)
 
+    def _get_node(
+        self, curve: str, path: PathType, parent: NodeType = None
+    ) -> NodeType:
+        key = (curve, tuple(path))
+        if self.root_cache is not None and key in self.root_cache:
+            return self.root_cache[key]
+        if key in self.roots:
+            return self.roots[key]
+
+        if parent is None:
+            node = self._new_root(curve)
+            node.derive_path(path)
+        else:
+            node = parent.clone()
+            node.derive_path(path[-1:])
+
+        if self.root_cache is not None and len(self.root_cache) < _ROOT_CACHE_SIZE:
+            self.root_cache[key] = node
+        else:
+            self.roots[key] = node
+        return node
+
     def derive(self, path: PathType) -> NodeType:
         root_index, suffix = self.match_path(path)
+        curve, prefix = self.namespaces[root_index]
 
-        if root_index not in self.roots:
-            curve, prefix = self.namespaces[root_index]
-            root = self._new_root(curve)
-            root.derive_path(prefix)
-            self.roots[root_index] = root
+        node = self._get_node(curve, prefix)
+        if suffix and isinstance(suffix[0], int) and suffix[0] & HARDENED:
+            # keep the hardened account level node, e.g. m/44'/coin'/account'
+            node = self._get_node(curve, path[: len(prefix) + 1], node)
+            suffix = suffix[1:]
 
-        node = self.roots[root_index].clone()
+        node = node.clone()
         node.derive_path(suffix)
         return node
 
@@ -115,7 +166,7 @@ async def _get_seed(ctx: wire.Context) -> bytes:
     if not device.is_initialized():
         raise wire.NotInitialized("Device is not initialized")
     passphrase = await get_passphrase(ctx)
-    return mnemonic.get_seed(passphrase)
+    return await mnemonic.get_seed_async(passphrase)
 
 
 @cache.stored(cache.APP_COMMON_SEED_WITHOUT_PASSPHRASE)
@@ -127,10 +178,22 @@ def _get_seed_without_passphrase() -> bytes:
 
 async def get_keychain(ctx: wire.Context, namespaces: Sequence[Namespace]) -> Keychain:
     seed = await _get_seed(ctx)
-    keychain = Keychain(seed, namespaces)
+    root_cache = cache.get(cache.APP_COMMON_KEYCHAIN_ROOTS)
+    if root_cache is None:
+        root_cache = {}
+        cache.set(cache.APP_COMMON_KEYCHAIN_ROOTS, root_cache)
+    keychain = Keychain(seed, namespaces, root_cache)
     return keychain
 
 
+def clear_root_cache() -> None:
+    """Wipe the cached keychain nodes of all sessions."""
+    for root_cache in cache.pop_all(cache.APP_COMMON_KEYCHAIN_ROOTS):
+        for node in root_cache.values():
+            node.__del__()
+        root_cache.clear()
+
+
 def derive_node_without_passphrase(
     path: Bip32Path, curve_name: str = "secp256k1"
 ) -> bip32.HDNode:
@@ -147,6 +210,40 @@ def derive_slip21_node_without_passphrase(path: Slip21Path) -> Slip21Node:
     return node
 
 
+# Public nodes at hardened paths, e.g. account xpubs asked for during wallet
+# discovery, are kept next to the keychain roots in the session cache. Only the
+# public part of the node is kept, the key tags it apart from the roots.
+_PUBLIC_NODE = "public"
+
+
+def get_cached_public_node(curve_name: str, path: Bip32Path) -> Optional[bip32.HDNode]:
+    if not _path_hardened(path):
+        return None
+    root_cache = cache.get(cache.APP_COMMON_KEYCHAIN_ROOTS)
+    if root_cache is None:
+        return None
+    node = root_cache.get((_PUBLIC_NODE, curve_name, tuple(path)))
+    if node is None:
+        return None
+    return node.clone()
+
+
+def cache_public_node(curve_name: str, path: Bip32Path, node: bip32.HDNode) -> None:
+    if not _path_hardened(path):
+        return
+    root_cache = cache.get(cache.APP_COMMON_KEYCHAIN_ROOTS)
+    if root_cache is None or len(root_cache) >= _ROOT_CACHE_SIZE:
+        return
+    root_cache[(_PUBLIC_NODE, curve_name, tuple(path))] = bip32.HDNode(
+        depth=node.depth(),
+        fingerprint=node.fingerprint(),
+        child_num=node.child_num(),
+        chain_code=node.chain_code(),
+        public_key=node.public_key(),
+        curve_name=curve_name,
+    )
+
+
 def remove_ed25519_prefix(pubkey: bytes) -> bytes:
     # 0x01 prefix is not part of the actual public key, hence removed
     return pubkey[1:]
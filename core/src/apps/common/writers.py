@@ -1,4 +1,4 @@
-from trezor.utils import ensure
+from trezor.utils import ensure, write_uint
 
 if False:
     from trezor.utils import Writer
@@ -22,60 +22,32 @@ def write_uint8(w: Writer, n: int) -> int:
 
 def write_uint16_le(w: Writer, n: int) -> int:
     ensure(0 <= n <= 0xFFFF)
-    w.append(n & 0xFF)
-    w.append((n >> 8) & 0xFF)
-    return 2
+    return write_uint(w, n, 2)
 
 
 def write_uint16_be(w: Writer, n: int) -> int:
     ensure(0 <= n <= 0xFFFF)
-    w.append((n >> 8) & 0xFF)
-    w.append(n & 0xFF)
-    return 2
+    return write_uint(w, n, 2, True)
 
 
 def write_uint32_le(w: Writer, n: int) -> int:
     ensure(0 <= n <= 0xFFFFFFFF)
-    w.append(n & 0xFF)
-    w.append((n >> 8) & 0xFF)
-    w.append((n >> 16) & 0xFF)
-    w.append((n >> 24) & 0xFF)
-    return 4
+    return write_uint(w, n, 4)
 
 
 def write_uint32_be(w: Writer, n: int) -> int:
     ensure(0 <= n <= 0xFFFFFFFF)
-    w.append((n >> 24) & 0xFF)
-    w.append((n >> 16) & 0xFF)
-    w.append((n >> 8) & 0xFF)
-    w.append(n & 0xFF)
-    return 4
+    return write_uint(w, n, 4, True)
 
 
 def write_uint64_le(w: Writer, n: int) -> int:
     ensure(0 <= n <= 0xFFFFFFFFFFFFFFFF)
-    w.append(n & 0xFF)
-    w.append((n >> 8) & 0xFF)
-    w.append((n >> 16) & 0xFF)
-    w.append((n >> 24) & 0xFF)
-    w.append((n >> 32) & 0xFF)
-    w.append((n >> 40) & 0xFF)
-    w.append((n >> 48) & 0xFF)
-    w.append((n >> 56) & 0xFF)
-    return 8
+    return write_uint(w, n, 8)
 
 
 def write_uint64_be(w: Writer, n: int) -> int:
     ensure(0 <= n <= 0xFFFFFFFFFFFFFFFF)
-    w.append((n >> 56) & 0xFF)
-    w.append((n >> 48) & 0xFF)
-    w.append((n >> 40) & 0xFF)
-    w.append((n >> 32) & 0xFF)
-    w.append((n >> 24) & 0xFF)
-    w.append((n >> 16) & 0xFF)
-    w.append((n >> 8) & 0xFF)
-    w.append(n & 0xFF)
-    return 8
+    return write_uint(w, n, 8, True)
 
 
 def write_bytes_unchecked(w: Writer, b: bytes) -> int:
@@ -101,11 +73,7 @@ def write_bitcoin_varint(w: Writer, n: int) -> None:
         w.append(n & 0xFF)
     elif n < 0x10000:
         w.append(253)
-        w.append(n & 0xFF)
-        w.append((n >> 8) & 0xFF)
+        write_uint(w, n, 2)
     else:
         w.append(254)
-        w.append(n & 0xFF)
-        w.append((n >> 8) & 0xFF)
-        w.append((n >> 16) & 0xFF)
-        w.append((n >> 24) & 0xFF)
+        write_uint(w, n, 4)
@@ -7,7 +7,7 @@ if __debug__:
     from trezor import io, ui, wire
     from trezor.messages import MessageType, DebugSwipeDirection
     from trezor.messages.DebugLinkLayout import DebugLinkLayout
-    from trezor import config, crypto, log, loop, utils
+    from trezor import config, crypto, log, loop, utils, workflow
     from trezor.messages.Success import Success
 
     if False:
@@ -22,6 +22,7 @@ if __debug__:
 
     save_screen = False
     save_screen_directory = "."
+    save_screen_hash_only = False
 
     reset_internal_entropy = None  # type: Optional[bytes]
     reset_current_words = loop.chan()
@@ -39,17 +40,24 @@ if __debug__:
     layout_change_chan = loop.chan()
     current_content = None  # type: Optional[List[str]]
     watch_layout_changes = False
+    # set while the changes are pushed to the host, see push_layout_changes
+    layout_push_chan = None  # type: Optional[loop.chan]
 
     def screenshot() -> bool:
         if save_screen:
-            ui.display.save(save_screen_directory + "/refresh-")
+            if save_screen_hash_only:
+                ui.display.save_frame()
+            else:
+                ui.display.save(save_screen_directory + "/refresh-")
             return True
         return False
 
     def notify_layout_change(layout: ui.Layout) -> None:
         global current_content
         current_content = layout.read_content()
-        if watch_layout_changes:
+        if layout_push_chan is not None:
+            layout_push_chan.publish(current_content)
+        elif watch_layout_changes:
             layout_change_chan.publish(current_content)
 
     async def debuglink_decision_dispatcher() -> None:
@@ -79,14 +87,35 @@ if __debug__:
         content = await layout_change_chan.take()
         await ctx.write(DebugLinkLayout(lines=content))
 
+    async def push_layout_changes(ctx: wire.Context, changes: loop.chan) -> None:
+        while True:
+            content = await changes.take()
+            if content is None:
+                # stopped by DebugLinkWatchLayout
+                break
+            await ctx.write(DebugLinkLayout(lines=content))
+
     async def dispatch_DebugLinkWatchLayout(
         ctx: wire.Context, msg: DebugLinkWatchLayout
-    ) -> Success:
+    ) -> Optional[Success]:
         global watch_layout_changes
+        global layout_push_chan
         layout_change_chan.putters.clear()
+        if layout_push_chan is not None:
+            # drop the changes not pushed yet, so that none follows the response
+            layout_push_chan.putters.clear()
+            layout_push_chan.publish(None)
+            layout_push_chan = None
         watch_layout_changes = bool(msg.watch)
         log.debug(__name__, "Watch layout changes: {}".format(watch_layout_changes))
-        return Success()
+        if not (watch_layout_changes and msg.push):
+            return Success()
+
+        # confirm with the current layout before the first change is pushed
+        await ctx.write(DebugLinkLayout(lines=current_content or []))
+        layout_push_chan = loop.chan()
+        loop.schedule(push_layout_changes(ctx, layout_push_chan))
+        return None
 
     async def dispatch_DebugLinkDecision(
         ctx: wire.Context, msg: DebugLinkDecision
@@ -102,7 +131,7 @@ if __debug__:
         else:
             debuglink_decision_chan.publish(msg)
 
-        if msg.wait:
+        if msg.wait and layout_push_chan is None:
             loop.schedule(return_layout_change(ctx))
 
     async def dispatch_DebugLinkGetState(
@@ -116,6 +145,14 @@ if __debug__:
         m.mnemonic_type = mnemonic.get_type()
         m.passphrase_protection = passphrase.is_enabled()
         m.reset_entropy = reset_internal_entropy
+        m.boot_times = list(utils.boottime())
+        m.trace = utils.trace_dump()
+        m.workflow_peak_heap = workflow.last_heap_stats[0]
+        m.workflow_gc_count = workflow.last_heap_stats[1]
+        m.workflow_gc_time = workflow.last_heap_stats[2]
+        m.gc_max_pause = loop.gc_max_pause
+        if save_screen:
+            m.screen_hash = ui.display.save_hash()
 
         if msg.wait_layout or current_content is None:
             m.layout_lines = await layout_change_chan.take()
@@ -133,9 +170,14 @@ if __debug__:
     ) -> Success:
         global save_screen_directory
         global save_screen
+        global save_screen_hash_only
 
         if msg.target_directory:
             save_screen_directory = msg.target_directory
+            save_screen_hash_only = bool(msg.hash_only)
+            if not save_screen_hash_only:
+                # write out the frames that were only hashed so far
+                ui.display.save_kept(save_screen_directory + "/refresh-")
             save_screen = True
         else:
             save_screen = False
@@ -175,8 +217,6 @@ if __debug__:
         if not utils.EMULATOR:
             config.wipe()
 
-        wire.add(MessageType.LoadDevice, __name__, "load_device")
-        wire.add(MessageType.DebugLinkShowText, __name__, "show_text")
         wire.register(MessageType.DebugLinkDecision, dispatch_DebugLinkDecision)  # type: ignore
         wire.register(MessageType.DebugLinkGetState, dispatch_DebugLinkGetState)
         wire.register(MessageType.DebugLinkReseedRandom, dispatch_DebugLinkReseedRandom)
@@ -2,7 +2,7 @@ from trezor import wire
 from trezor.crypto import base58
 from trezor.messages.EosAsset import EosAsset
 
-from apps.common import HARDENED
+from apps.common import HARDENED, paths
 
 
 def base58_encode(prefix: str, sig_prefix: str, data: bytes) -> str:
@@ -42,6 +42,11 @@ def eos_asset_to_string(asset: EosAsset) -> str:
         return "{} {}".format(amount_digits, symbol)
 
 
+_PATH_PATTERN = paths.compile_pattern(
+    (5, 5, (44 | HARDENED, 194 | HARDENED, paths.hardened(0, 1000000), 0, 0))
+)
+
+
 def validate_full_path(path: list) -> bool:
     """
     Validates derivation path to equal 44'/194'/a'/0/0,
@@ -49,19 +54,7 @@ def validate_full_path(path: list) -> bool:
     Similar to Ethereum this should be 44'/194'/a', but for
     compatibility with other HW vendors we use 44'/194'/a'/0/0.
     """
-    if len(path) != 5:
-        return False
-    if path[0] != 44 | HARDENED:
-        return False
-    if path[1] != 194 | HARDENED:
-        return False
-    if path[2] < HARDENED or path[2] > 1000000 | HARDENED:
-        return False
-    if path[3] != 0:
-        return False
-    if path[4] != 0:
-        return False
-    return True
+    return paths.match_path(_PATH_PATTERN, path) >= 0
 
 
 def public_key_to_wif(pub_key: bytes) -> str:
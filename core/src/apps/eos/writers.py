@@ -1,3 +1,5 @@
+import ustruct
+
 from apps.common.writers import (
     write_bytes_unchecked,
     write_uint8,
@@ -55,18 +57,20 @@ def write_header(hasher: Writer, header: EosTxHeader) -> None:
     write_variant32(hasher, header.delay_sec)
 
 
+# The most common actions have a fixed layout and are packed in one call
+# instead of field by field.
+
+
 def write_action_transfer(w: Writer, msg: EosActionTransfer) -> None:
-    write_uint64_le(w, msg.sender)
-    write_uint64_le(w, msg.receiver)
-    write_asset(w, msg.quantity)
+    q = msg.quantity
+    w.extend(ustruct.pack("<QQQQ", msg.sender, msg.receiver, q.amount, q.symbol))
     write_variant32(w, len(msg.memo))
     write_bytes_unchecked(w, msg.memo)
 
 
 def write_action_buyram(w: Writer, msg: EosActionBuyRam) -> None:
-    write_uint64_le(w, msg.payer)
-    write_uint64_le(w, msg.receiver)
-    write_asset(w, msg.quantity)
+    q = msg.quantity
+    w.extend(ustruct.pack("<QQQQ", msg.payer, msg.receiver, q.amount, q.symbol))
 
 
 def write_action_buyrambytes(w: Writer, msg: EosActionBuyRamBytes) -> None:
@@ -81,11 +85,20 @@ def write_action_sellram(w: Writer, msg: EosActionSellRam) -> None:
 
 
 def write_action_delegate(w: Writer, msg: EosActionDelegate) -> None:
-    write_uint64_le(w, msg.sender)
-    write_uint64_le(w, msg.receiver)
-    write_asset(w, msg.net_quantity)
-    write_asset(w, msg.cpu_quantity)
-    write_uint8(w, 1 if msg.transfer else 0)
+    net = msg.net_quantity
+    cpu = msg.cpu_quantity
+    w.extend(
+        ustruct.pack(
+            "<QQQQQQB",
+            msg.sender,
+            msg.receiver,
+            net.amount,
+            net.symbol,
+            cpu.amount,
+            cpu.symbol,
+            1 if msg.transfer else 0,
+        )
+    )
 
 
 def write_action_undelegate(w: Writer, msg: EosActionUndelegate) -> None:
@@ -154,12 +167,10 @@ def write_asset(w: Writer, asset: EosAsset) -> None:
 
 
 def write_variant32(w: Writer, value: int) -> None:
-    variant = bytearray()
     while True:
         b = value & 0x7F
         value >>= 7
         b |= (value > 0) << 7
-        variant.append(b)
+        w.append(b)
         if value == 0:
             break
-    write_bytes_unchecked(w, bytes(variant))
@@ -5,6 +5,9 @@ from trezor import wire
 from apps.common import HARDENED, paths
 from apps.ethereum import networks
 
+if False:
+    from typing import Optional, Tuple
+
 
 """
 We believe Ethereum should use 44'/60'/a' for everything, because it is
@@ -14,25 +17,50 @@ iterate the address index i. Therefore for compatibility reasons we use
 the same scheme: 44'/60'/0'/0/i and only the i is being iterated.
 """
 
+# compiled patterns of validate_path_for_get_public_key and validate_full_path
+_path_patterns = None  # type: Optional[Tuple[bytes, bytes]]
+
+
+def _get_path_patterns() -> Tuple[bytes, bytes]:
+    global _path_patterns
+    if _path_patterns is None:
+        slip44_ids = list(set(networks.all_slip44_ids_hardened()))
+        _path_patterns = (
+            paths.compile_pattern(
+                (
+                    3,
+                    5,
+                    (
+                        44 | HARDENED,
+                        slip44_ids,
+                        0 | HARDENED,
+                        paths.unhardened(),
+                        paths.unhardened(),
+                    ),
+                )
+            ),
+            paths.compile_pattern(
+                (
+                    5,
+                    5,
+                    (
+                        44 | HARDENED,
+                        slip44_ids,
+                        0 | HARDENED,
+                        0,
+                        paths.unhardened(1000000),
+                    ),
+                )
+            ),
+        )
+    return _path_patterns
+
 
 def validate_path_for_get_public_key(path: list) -> bool:
     """
     This should be 44'/60'/0', but other non-hardened items are allowed.
     """
-    length = len(path)
-    if length < 3 or length > 5:
-        return False
-    if path[0] != 44 | HARDENED:
-        return False
-    if path[1] not in networks.all_slip44_ids_hardened():
-        return False
-    if path[2] != 0 | HARDENED:
-        return False
-    if length > 3 and paths.is_hardened(path[3]):
-        return False
-    if length > 4 and paths.is_hardened(path[4]):
-        return False
-    return True
+    return paths.match_path(_get_path_patterns()[0], path) >= 0
 
 
 def validate_full_path(path: list) -> bool:
@@ -40,19 +68,7 @@ def validate_full_path(path: list) -> bool:
     Validates derivation path to equal 44'/60'/0'/0/i,
     where `i` is an address index from 0 to 1 000 000.
     """
-    if len(path) != 5:
-        return False
-    if path[0] != 44 | HARDENED:
-        return False
-    if path[1] not in networks.all_slip44_ids_hardened():
-        return False
-    if path[2] != 0 | HARDENED:
-        return False
-    if path[3] != 0:
-        return False
-    if path[4] > 1000000:
-        return False
-    return True
+    return paths.match_path(_get_path_patterns()[1], path) >= 0
 
 
 def address_from_bytes(address_bytes: bytes, network=None) -> str:
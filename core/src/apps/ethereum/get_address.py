@@ -16,7 +16,9 @@ async def get_address(ctx, msg, keychain):
     node = keychain.derive(msg.address_n)
     seckey = node.private_key()
     public_key = secp256k1.publickey(seckey, False)  # uncompressed
-    address_bytes = sha3_256(public_key[1:], keccak=True).digest()[12:]
+    h = sha3_256(keccak=True)
+    h.update(public_key, 1)
+    address_bytes = h.digest()[12:]
 
     if len(msg.address_n) > 1:  # path has slip44 network identifier
         network = networks.by_slip44(msg.address_n[1] & 0x7FFFFFFF)
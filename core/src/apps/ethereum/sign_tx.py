@@ -5,7 +5,6 @@ from trezor.crypto.hashlib import sha3_256
 from trezor.messages.EthereumSignTx import EthereumSignTx
 from trezor.messages.EthereumTxAck import EthereumTxAck
 from trezor.messages.EthereumTxRequest import EthereumTxRequest
-from trezor.utils import HashWriter
 
 from apps.common import paths
 from apps.ethereum import CURVE, address, tokens
@@ -20,6 +19,9 @@ from apps.ethereum.layout import (
 # maximum supported chain id
 MAX_CHAIN_ID = 2147483629
 
+# maximum number of data bytes requested in one EthereumTxRequest
+MAX_DATA_CHUNK = 8192
+
 
 @with_keychain_from_chain_id
 async def sign_tx(ctx, msg, keychain):
@@ -59,39 +61,39 @@ async def sign_tx(ctx, msg, keychain):
         msg.tx_type,
     )
 
-    data = bytearray()
-    data += msg.data_initial_chunk
     data_left = data_total - len(msg.data_initial_chunk)
 
     total_length = get_total_length(msg, data_total)
 
-    sha = HashWriter(sha3_256(keccak=True))
-    sha.extend(rlp.encode_length(total_length, True))  # total length
+    # the fields are RLP-encoded straight into the hash context, so no
+    # encoded copies of them are created
+    sha = sha3_256(keccak=True)
+    sha.update_rlp_length(total_length, True)  # total length
 
     if msg.tx_type is not None:
-        sha.extend(rlp.encode(msg.tx_type))
+        sha.update_rlp(msg.tx_type)
 
     for field in (msg.nonce, msg.gas_price, msg.gas_limit, address_bytes, msg.value):
-        sha.extend(rlp.encode(field))
+        sha.update_rlp(field)
 
     if data_left == 0:
-        sha.extend(rlp.encode(data))
+        sha.update_rlp(msg.data_initial_chunk)
     else:
-        sha.extend(rlp.encode_length(data_total, False))
-        sha.extend(rlp.encode(data, False))
+        sha.update_rlp_length(data_total, False)
+        sha.update(msg.data_initial_chunk)
 
     while data_left > 0:
         resp = await send_request_chunk(ctx, data_left)
         data_left -= len(resp.data_chunk)
-        sha.extend(resp.data_chunk)
+        sha.update(resp.data_chunk)
 
     # eip 155 replay protection
     if msg.chain_id:
-        sha.extend(rlp.encode(msg.chain_id))
-        sha.extend(rlp.encode(0))
-        sha.extend(rlp.encode(0))
+        sha.update_rlp(msg.chain_id)
+        sha.update_rlp(0)
+        sha.update_rlp(0)
 
-    digest = sha.get_digest()
+    digest = sha.digest()
     result = sign_digest(msg, keychain, digest)
 
     return result
@@ -129,10 +131,10 @@ def get_total_length(msg: EthereumSignTx, data_total: int) -> int:
 async def send_request_chunk(ctx, data_left: int):
     # TODO: layoutProgress ?
     req = EthereumTxRequest()
-    if data_left <= 1024:
+    if data_left <= MAX_DATA_CHUNK:
         req.data_length = data_left
     else:
-        req.data_length = 1024
+        req.data_length = MAX_DATA_CHUNK
 
     return await ctx.call(req, EthereumTxAck)
 
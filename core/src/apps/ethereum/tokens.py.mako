@@ -7,24 +7,83 @@ from collections import defaultdict
 
 def group_tokens(tokens):
     r = defaultdict(list)
-    for t in sorted(tokens, key=lambda t: t.chain_id):
+    for t in sorted(tokens, key=lambda t: (t.chain_id, t.address_bytes)):
         r[t.chain_id].append(t)
     return r
+
+def symbol_width(tokens):
+    return max(len(t.symbol.encode()) for t in tokens)
+
+def token_info(t, width):
+    symbol = t.symbol.encode()
+    return bytes([t.decimals, len(symbol)]) + symbol + bytes(width - len(symbol))
 %>\
 
+from apps.common import definitions
+
 UNKNOWN_TOKEN = (None, None, None, None)
 
+# signed definitions blob of the tokens that are not built in, see
+# apps.common.definitions
+DEFINITIONS_PATH = "/trezor/definitions/ethereum_tokens.dat"
+
 
 def token_by_chain_address(chain_id, address):
+    token = _builtin_token(chain_id, address)
+    if token is UNKNOWN_TOKEN:
+        token = _external_token(chain_id, address)
+    return token
+
+
+def _builtin_token(chain_id, address):
     if False:
         pass
 % for token_chain_id, tokens in group_tokens(supported_on("trezor2", erc20)).items():
     elif chain_id == ${token_chain_id}:
-        if False:
-            pass
+        width = ${symbol_width(tokens)}
+        table = (
         % for t in tokens:
-        elif address == ${black_repr(t.address_bytes)}:
-            return (chain_id, address, ${black_repr(t.symbol)}, ${t.decimals})  # ${t.chain} / ${t.name.strip()}
+            ${black_repr(t.address_bytes)} ${black_repr(token_info(t, symbol_width(tokens)))}  # ${t.chain} / ${t.name.strip()}
         % endfor
+        )
 % endfor
+    else:
+        return UNKNOWN_TOKEN
+    return _find_token(chain_id, address, table, width)
+
+
+def _find_token(chain_id, address, table, width):
+    # The table is sorted by address, each record holds the address, decimals,
+    # symbol length and the symbol padded to width bytes.
+    if len(address) != 20:
+        return UNKNOWN_TOKEN
+    address = bytes(address)
+    size = 22 + width
+    lo = 0
+    hi = len(table) // size
+    while lo < hi:
+        mid = (lo + hi) // 2
+        offset = mid * size
+        a = table[offset : offset + 20]
+        if address < a:
+            hi = mid
+        elif address > a:
+            lo = mid + 1
+        else:
+            decimals = table[offset + 20]
+            symbol = table[offset + 22 : offset + 22 + table[offset + 21]]
+            return (chain_id, address, symbol.decode(), decimals)
     return UNKNOWN_TOKEN
+
+
+def _external_token(chain_id, address):
+    # The record key is the big endian chain id and the address, the value is
+    # the decimals, the symbol length and the padded symbol.
+    if len(address) != 20 or not 0 <= chain_id <= 0xFFFFFFFF:
+        return UNKNOWN_TOKEN
+    key = chain_id.to_bytes(4, "big") + bytes(address)
+    value = definitions.lookup(DEFINITIONS_PATH, definitions.KIND_ETHEREUM_TOKENS, key)
+    if value is None:
+        return UNKNOWN_TOKEN
+    symbol = value[2 : 2 + value[1]]
+    return (chain_id, bytes(address), symbol.decode(), value[0])
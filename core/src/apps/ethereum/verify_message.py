@@ -19,7 +19,9 @@ async def verify_message(ctx, msg):
     if not pubkey:
         raise wire.DataError("Invalid signature")
 
-    pkh = sha3_256(pubkey[1:], keccak=True).digest()[-20:]
+    h = sha3_256(keccak=True)
+    h.update(pubkey, 1)
+    pkh = h.digest()[-20:]
 
     address_bytes = bytes_from_address(msg.address)
     if address_bytes != pkh:
@@ -1,6 +1,13 @@
 import storage.device
 from trezor import io, loop, res, ui
 
+if False:
+    from typing import Optional
+
+# The image last handed to display.avatar_preload(). The display keeps it
+# decompressed, so the homescreen does not inflate it on every repaint.
+_preloaded_image = None  # type: Optional[bytes]
+
 
 class HomescreenBase(ui.Layout):
     RENDER_SLEEP = loop.SLEEP_FOREVER
@@ -10,6 +17,16 @@ class HomescreenBase(ui.Layout):
         self.image = storage.device.get_homescreen() or res.load(
             "apps/homescreen/res/bg.toif"
         )
+        global _preloaded_image
+        if self.image != _preloaded_image:
+            ui.display.avatar_preload(self.image, ui.WHITE, ui.BLACK)
+            _preloaded_image = self.image
+        else:
+            self.image = _preloaded_image
+
+    def render_image(self, x: int, y: int) -> None:
+        if not ui.display.avatar_preloaded(x, y):
+            ui.display.avatar(x, y, self.image, ui.WHITE, ui.BLACK)
 
     def on_tap(self) -> None:
         """Called when the user taps the screen."""
@@ -29,5 +29,5 @@ class Homescreen(HomescreenBase):
             ui.display.bar(0, 0, ui.WIDTH, ui.HEIGHT, ui.BG)
 
         # homescreen with shifted avatar and text on bottom
-        ui.display.avatar(48, 48 - 10, self.image, ui.WHITE, ui.BLACK)
+        self.render_image(48, 48 - 10)
         ui.display.text_center(ui.WIDTH // 2, 220, self.label, ui.BOLD, ui.FG, ui.BG)
@@ -1,6 +1,6 @@
 from trezor.crypto.hashlib import sha256
 
-from apps.common import HARDENED
+from apps.common import HARDENED, paths
 
 
 def get_address_from_public_key(pubkey):
@@ -9,6 +9,13 @@ def get_address_from_public_key(pubkey):
     return str(address) + "L"
 
 
+def get_addresses_from_node(node, index, count):
+    """Returns the addresses of the children index, ..., index + count - 1."""
+    pubkeys = node.derive_public_keys(index, count)
+    # skip ed25519 pubkey marker
+    return [get_address_from_public_key(pubkey[1:]) for pubkey in pubkeys]
+
+
 def get_votes_count(votes):
     plus, minus = 0, 0
     for vote in votes:
@@ -33,17 +40,14 @@ def _text_with_plural(txt, value):
     return "%s %s %s" % (txt, value, ("votes" if value != 1 else "vote"))
 
 
+_PATH_PATTERN = paths.compile_pattern(
+    (3, 3, (44 | HARDENED, 134 | HARDENED, paths.hardened(0, 1000000)))
+)
+
+
 def validate_full_path(path: list) -> bool:
     """
     Validates derivation path to equal 44'/134'/a',
     where `a` is an account index from 0 to 1 000 000.
     """
-    if len(path) != 3:
-        return False
-    if path[0] != 44 | HARDENED:
-        return False
-    if path[1] != 134 | HARDENED:
-        return False
-    if path[2] < HARDENED or path[2] > 1000000 | HARDENED:
-        return False
-    return True
+    return paths.match_path(_PATH_PATTERN, path) >= 0
@@ -11,8 +11,18 @@ from apps.common.seed import get_keychain
 async def cipher_key_value(ctx, msg):
     keychain = await get_keychain(ctx, [("secp256k1", [])])
 
-    if len(msg.value) % 16 > 0:
-        raise wire.DataError("Value length must be a multiple of 16")
+    if msg.values:
+        if msg.value is not None:
+            raise wire.DataError("Cannot combine value and values")
+        if msg.ivs and len(msg.ivs) != len(msg.values):
+            raise wire.DataError("Number of ivs must match number of values")
+        values = msg.values
+    else:
+        values = [msg.value]
+
+    for value in values:
+        if len(value) % 16 > 0:
+            raise wire.DataError("Value length must be a multiple of 16")
 
     encrypt = msg.encrypt
     decrypt = not msg.encrypt
@@ -26,11 +36,20 @@ async def cipher_key_value(ctx, msg):
         await require_confirm(ctx, text)
 
     node = keychain.derive(msg.address_n)
-    value = compute_cipher_key_value(msg, node.private_key())
-    return CipheredKeyValue(value=value)
+    # the key is derived once and shared by all the values of a batch
+    key, iv = compute_cipher_key(msg, node.private_key())
+
+    if not msg.values:
+        return CipheredKeyValue(value=cipher_value(msg.encrypt, key, iv, msg.value))
 
+    result = []
+    for i, value in enumerate(values):
+        value_iv = msg.ivs[i] if msg.ivs and len(msg.ivs[i]) == 16 else iv
+        result.append(cipher_value(msg.encrypt, key, value_iv, value))
+    return CipheredKeyValue(values=result)
 
-def compute_cipher_key_value(msg, seckey: bytes) -> bytes:
+
+def compute_cipher_key(msg, seckey: bytes) -> tuple:
     data = msg.key
     data += "E1" if msg.ask_on_encrypt else "E0"
     data += "D1" if msg.ask_on_decrypt else "D0"
@@ -40,9 +59,12 @@ def compute_cipher_key_value(msg, seckey: bytes) -> bytes:
         iv = msg.iv
     else:
         iv = data[32:48]
+    return key, iv
+
 
+def cipher_value(encrypt: bool, key: bytes, iv: bytes, value: bytes) -> bytes:
     ctx = aes(aes.CBC, key, iv)
-    if msg.encrypt:
-        return ctx.encrypt(msg.value)
+    if encrypt:
+        return ctx.encrypt(value)
     else:
-        return ctx.decrypt(msg.value)
+        return ctx.decrypt(value)
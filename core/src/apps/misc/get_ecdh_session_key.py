@@ -1,5 +1,6 @@
 from ustruct import pack, unpack
 
+from storage import cache
 from trezor import wire
 from trezor.crypto.hashlib import sha256
 from trezor.messages.ECDHSessionKey import ECDHSessionKey
@@ -12,6 +13,11 @@ from apps.common.seed import get_keychain
 
 from .sign_identity import serialize_identity, serialize_identity_without_proto
 
+# Session keys remembered per session, keyed by curve, path and peer key. Host
+# apps ask for the same peer in every message, and the session cache is wiped
+# when the device locks.
+_MAX_CACHED_SESSION_KEYS = 8
+
 
 async def get_ecdh_session_key(ctx, msg):
     if msg.ecdsa_curve_name is None:
@@ -23,13 +29,25 @@ async def get_ecdh_session_key(ctx, msg):
     await require_confirm_ecdh_session_key(ctx, msg.identity)
 
     address_n = get_ecdh_path(identity, msg.identity.index or 0)
-    node = keychain.derive(address_n)
 
-    session_key = ecdh(
-        seckey=node.private_key(),
-        peer_public_key=msg.peer_public_key,
-        curve=msg.ecdsa_curve_name,
-    )
+    session_keys = cache.get(cache.APP_MISC_ECDH_SESSION_KEYS)
+    if session_keys is None:
+        session_keys = {}
+        cache.set(cache.APP_MISC_ECDH_SESSION_KEYS, session_keys)
+    cache_key = (msg.ecdsa_curve_name, tuple(address_n), bytes(msg.peer_public_key))
+    session_key = session_keys.get(cache_key)
+
+    if session_key is None:
+        node = keychain.derive(address_n)
+        session_key = ecdh(
+            seckey=node.private_key(),
+            peer_public_key=msg.peer_public_key,
+            curve=msg.ecdsa_curve_name,
+        )
+        if len(session_keys) >= _MAX_CACHED_SESSION_KEYS:
+            session_keys.clear()
+        session_keys[cache_key] = session_key
+
     return ECDHSessionKey(session_key=session_key)
 
 
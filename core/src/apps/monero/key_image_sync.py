@@ -41,6 +41,7 @@ class KeyImageSync:
         self.enc_key = None
         self.creds = None
         self.subaddresses = {}
+        self.subaddr_keys = {}
         self.hasher = crypto.get_keccak()
 
 
@@ -70,33 +71,35 @@ async def _sync_step(s, ctx, tds):
         raise wire.DataError("Empty")
 
     kis = []
-    buff = bytearray(32 * 3)
-    buff_mv = memoryview(buff)
-
     await confirms.keyimage_sync_step(ctx, s.current_output, s.num_outputs)
 
-    for td in tds.tdis:
-        s.current_output += 1
-        if s.current_output >= s.num_outputs:
-            raise wire.DataError("Too many outputs")
+    if s.current_output + len(tds.tdis) >= s.num_outputs:
+        raise wire.DataError("Too many outputs")
 
-        if __debug__:
-            log.debug(__name__, "ki_sync, step i: %d", s.current_output)
+    if __debug__:
+        log.debug(
+            __name__,
+            "ki_sync, step i: %d, batch: %d",
+            s.current_output + 1,
+            len(tds.tdis),
+        )
 
-        # Update the control hash
+    # Update the control hash
+    for td in tds.tdis:
         s.hasher.update(key_image.compute_hash(td))
 
-        # Compute keyimage + signature
-        ki, sig = key_image.export_key_image(s.creds, s.subaddresses, td)
-
-        # Serialize into buff
-        crypto.encodepoint_into(buff_mv[0:32], ki)
-        crypto.encodeint_into(buff_mv[32:64], sig[0][0])
-        crypto.encodeint_into(buff_mv[64:], sig[0][1])
+    # Compute keyimages + signatures, packed as (ki || c || r)
+    buff = key_image.export_key_images(
+        s.creds, s.subaddresses, s.subaddr_keys, tds.tdis
+    )
+    buff_mv = memoryview(buff)
+    s.current_output += len(tds.tdis)
 
+    for i in range(len(tds.tdis)):
         # Encrypt with enc_key
-        nonce, ciph, _ = chacha_poly.encrypt(s.enc_key, buff)
-
+        nonce, ciph, _ = chacha_poly.encrypt(
+            s.enc_key, buff_mv[96 * i : 96 * (i + 1)]
+        )
         kis.append(MoneroExportedKeyImage(iv=nonce, blob=ciph))
 
     return MoneroKeyImageSyncStepAck(kis=kis)
@@ -1,8 +1,13 @@
 import gc
+from micropython import const
 
 import storage.cache
-from trezor import log
+from trezor import log, wire
 from trezor.messages import MessageType
+from trezor.messages.MoneroLiveRefreshBatchStepAck import MoneroLiveRefreshBatchStepAck
+from trezor.messages.MoneroLiveRefreshBatchStepRequest import (
+    MoneroLiveRefreshBatchStepRequest,
+)
 from trezor.messages.MoneroLiveRefreshFinalAck import MoneroLiveRefreshFinalAck
 from trezor.messages.MoneroLiveRefreshStartAck import MoneroLiveRefreshStartAck
 from trezor.messages.MoneroLiveRefreshStartRequest import MoneroLiveRefreshStartRequest
@@ -13,9 +18,16 @@ from apps.common import paths
 from apps.common.seed import with_slip44_keychain
 from apps.monero import CURVE, SLIP44_ID, misc
 from apps.monero.layout import confirms
-from apps.monero.xmr import crypto, key_image, monero
+from apps.monero.xmr import crypto, monero
 from apps.monero.xmr.crypto import chacha_poly
 
+if False:
+    from typing import Dict, List, Optional, Tuple
+    from apps.monero.xmr.types import Sc25519
+
+# outputs in one MoneroLiveRefreshBatchStepRequest
+_MAX_BATCH_OUTPUTS = const(64)
+
 
 @with_slip44_keychain(SLIP44_ID, CURVE, allow_testnet=True)
 async def live_refresh(ctx, msg: MoneroLiveRefreshStartRequest, keychain):
@@ -26,11 +38,14 @@ async def live_refresh(ctx, msg: MoneroLiveRefreshStartRequest, keychain):
         msg = await ctx.call_any(
             res,
             MessageType.MoneroLiveRefreshStepRequest,
+            MessageType.MoneroLiveRefreshBatchStepRequest,
             MessageType.MoneroLiveRefreshFinalRequest,
         )
         del res
         if msg.MESSAGE_WIRE_TYPE == MessageType.MoneroLiveRefreshStepRequest:
             res = await _refresh_step(state, ctx, msg)
+        elif msg.MESSAGE_WIRE_TYPE == MessageType.MoneroLiveRefreshBatchStepRequest:
+            res = await _refresh_batch_step(state, ctx, msg)
         else:
             return MoneroLiveRefreshFinalAck()
         gc.collect()
@@ -42,6 +57,8 @@ class LiveRefreshState:
     def __init__(self):
         self.current_output = 0
         self.creds = None
+        # subaddress secret keys by (major, minor) index
+        self.subaddr_keys = {}  # type: Dict[Tuple[int, int], Sc25519]
 
 
 async def _init_step(
@@ -61,38 +78,82 @@ async def _init_step(
 
 
 async def _refresh_step(s: LiveRefreshState, ctx, msg: MoneroLiveRefreshStepRequest):
-    buff = bytearray(32 * 3)
-    buff_mv = memoryview(buff)
-
     await confirms.live_refresh_step(ctx, s.current_output)
     s.current_output += 1
 
     if __debug__:
         log.debug(__name__, "refresh, step i: %d", s.current_output)
 
+    return _export_key_images(s, [msg])[0]
+
+
+async def _refresh_batch_step(
+    s: LiveRefreshState, ctx, msg: MoneroLiveRefreshBatchStepRequest
+):
+    if not msg.outputs or len(msg.outputs) > _MAX_BATCH_OUTPUTS:
+        raise wire.DataError("Invalid number of outputs")
+
+    await confirms.live_refresh_step(ctx, s.current_output)
+    s.current_output += len(msg.outputs)
+
+    if __debug__:
+        log.debug(__name__, "refresh, batch step i: %d", s.current_output)
+
+    return MoneroLiveRefreshBatchStepAck(
+        key_images=_export_key_images(s, msg.outputs)
+    )
+
+
+def _export_key_images(
+    s: LiveRefreshState, outputs: List[MoneroLiveRefreshStepRequest]
+) -> List[MoneroLiveRefreshStepAck]:
     # Compute spending secret key and the key image
     # spend_priv = Hs(recv_deriv || real_out_idx) + spend_key_private
     # If subaddr:
     #   spend_priv += Hs("SubAddr" || view_key_private || major || minor)
     # out_key = spend_priv * G, KI: spend_priv * Hp(out_key)
-    out_key = crypto.decodepoint(msg.out_key)
-    recv_deriv = crypto.decodepoint(msg.recv_deriv)
-    received_index = msg.sub_addr_major, msg.sub_addr_minor
-    spend_priv, ki = monero.generate_tx_spend_and_key_image(
-        s.creds, out_key, recv_deriv, msg.real_out_idx, received_index
+    # The key images and their signatures are computed natively for the whole
+    # batch, spend_priv never leaves the device.
+    if not crypto.sc_isnonzero(s.creds.spend_key_private):
+        raise ValueError("Watch-only wallet not supported")
+
+    out_keys = bytearray(32 * len(outputs))
+    recv_derivations = []
+    indices = []
+    sub_keys = []
+    for i, out in enumerate(outputs):
+        out_keys[32 * i : 32 * (i + 1)] = out.out_key
+        recv_derivations.append(crypto.decodepoint(out.recv_deriv))
+        indices.append(out.real_out_idx)
+        sub_keys.append(_subaddress_secret_key(s, out))
+
+    sigs = crypto.export_key_images(
+        s.creds.spend_key_private, out_keys, recv_derivations, indices, sub_keys
     )
+    del recv_derivations, sub_keys
+
+    res = []
+    for i, out in enumerate(outputs):
+        # (ki || c || r), encrypted with view key private based key - so host
+        # can decrypt and verify HMAC
+        enc_key, salt = misc.compute_enc_key_host(
+            s.creds.view_key_private, out.out_key
+        )
+        resp = chacha_poly.encrypt_pack(enc_key, sigs[96 * i : 96 * (i + 1)])
+        res.append(MoneroLiveRefreshStepAck(salt=salt, key_image=resp))
+    return res
 
-    ki_enc = crypto.encodepoint(ki)
-    sig = key_image.generate_ring_signature(ki_enc, ki, [out_key], spend_priv, 0, False)
-    del spend_priv  # spend_priv never leaves the device
-
-    # Serialize into buff
-    buff[0:32] = ki_enc
-    crypto.encodeint_into(buff_mv[32:64], sig[0][0])
-    crypto.encodeint_into(buff_mv[64:], sig[0][1])
-
-    # Encrypt with view key private based key - so host can decrypt and verify HMAC
-    enc_key, salt = misc.compute_enc_key_host(s.creds.view_key_private, msg.out_key)
-    resp = chacha_poly.encrypt_pack(enc_key, buff)
 
-    return MoneroLiveRefreshStepAck(salt=salt, key_image=resp)
+def _subaddress_secret_key(
+    s: LiveRefreshState, out: MoneroLiveRefreshStepRequest
+) -> Optional[Sc25519]:
+    index = out.sub_addr_major, out.sub_addr_minor
+    if index == (0, 0):
+        return None
+    key = s.subaddr_keys.get(index)
+    if key is None:
+        key = monero.get_subaddress_secret_key(
+            s.creds.view_key_private, major=index[0], minor=index[1]
+        )
+        s.subaddr_keys[index] = key
+    return key
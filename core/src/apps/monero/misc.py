@@ -1,4 +1,4 @@
-from apps.common import HARDENED
+from apps.common import HARDENED, paths
 
 if False:
     from typing import Tuple
@@ -18,20 +18,17 @@ def get_creds(keychain, address_n=None, network_type=None):
     return creds
 
 
+_PATH_PATTERN = paths.compile_pattern(
+    (3, 3, (44 | HARDENED, 128 | HARDENED, paths.hardened(0, 1000000)))
+)
+
+
 def validate_full_path(path: list) -> bool:
     """
     Validates derivation path to equal 44'/128'/a',
     where `a` is an account index from 0 to 1 000 000.
     """
-    if len(path) != 3:
-        return False
-    if path[0] != 44 | HARDENED:
-        return False
-    if path[1] != 128 | HARDENED:
-        return False
-    if path[2] < HARDENED or path[2] > 1000000 | HARDENED:
-        return False
-    return True
+    return paths.match_path(_PATH_PATTERN, path) >= 0
 
 
 def compute_tx_key(
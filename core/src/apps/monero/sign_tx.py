@@ -22,6 +22,8 @@ async def sign_tx(ctx, received_msg, keychain):
         gc.threshold(gc.mem_free() // 4 + gc.mem_alloc())
 
         result_msg, accept_msgs = await sign_tx_dispatch(state, received_msg, keychain)
+        if __debug__:
+            state.mem_step_done(received_msg.MESSAGE_WIRE_TYPE)
         if accept_msgs is None:
             break
 
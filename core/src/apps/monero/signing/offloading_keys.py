@@ -122,6 +122,14 @@ def det_comm_masks(key_enc, idx: int) -> Sc25519:
     return crypto.decodeint(_build_key(key_enc, b"out-mask", idx))
 
 
+def det_additional_txkey(key_enc, idx: int) -> Sc25519:
+    """
+    Deterministic additional tx private keys, rederived in the final step
+    instead of being kept in the state for all outputs
+    """
+    return crypto.decodeint(_build_key(key_enc, b"out-txkey", idx))
+
+
 async def gen_hmac_vini(
     key, src_entr: MoneroTransactionSourceEntry, vini_bin: bytes, idx: int
 ) -> bytes:
@@ -75,9 +75,9 @@ class State:
         # wallet sub-address major index
         self.account_idx = 0
 
-        # contains additional tx keys if need_additional_tx_keys is True
-        self.additional_tx_private_keys = []  # type: List[Sc25519]
-        self.additional_tx_public_keys = []  # type: List[bytes]
+        # packed additional tx public keys if need_additional_tx_keys is True,
+        # the private keys are rederived from key_enc when needed
+        self.additional_tx_public_keys = None  # type: Optional[bytearray]
 
         # currently processed input/output index
         self.current_input_index = -1
@@ -90,8 +90,8 @@ class State:
         self.summary_inputs_money = 0
         self.summary_outs_money = 0
 
-        # output commitments
-        self.output_pk_commitments = []  # type: List[bytes]
+        # packed output commitments, allocated once for all outputs
+        self.output_pk_commitments = None  # type: Optional[bytearray]
 
         self.output_amounts = []  # type: List[int]
         # output *range proof* masks. HP10+ makes them deterministic.
@@ -125,6 +125,9 @@ class State:
         # Step transition automaton
         self.last_step = self.STEP_INIT
 
+        # Peak heap usage seen by mem_trace in the current step
+        self.mem_peak = 0
+
         """
         Tx prefix hasher/hash. We use the hasher to incrementally hash and then
         store the final hash in tx_prefix_hash.
@@ -143,15 +146,28 @@ class State:
 
     def mem_trace(self, x=None, collect=False):
         if __debug__:
+            alloc = gc.mem_alloc()
+            self.mem_peak = max(self.mem_peak, alloc)
             log.debug(
-                __name__,
-                "Log trace: %s, ... F: %s A: %s",
-                x,
-                gc.mem_free(),
-                gc.mem_alloc(),
+                __name__, "Log trace: %s, ... F: %s A: %s", x, gc.mem_free(), alloc,
             )
         if collect:
             gc.collect()
 
+    def mem_step_done(self, step):
+        """
+        Reports the peak heap usage of the finished step and starts a new one
+        """
+        if __debug__:
+            alloc = gc.mem_alloc()
+            log.debug(
+                __name__,
+                "Step %s peak A: %s, now A: %s",
+                step,
+                max(self.mem_peak, alloc),
+                alloc,
+            )
+            self.mem_peak = alloc
+
     def change_address(self):
         return self.output_change.addr if self.output_change else None
@@ -47,6 +47,7 @@ async def init_transaction(
 
     state.input_count = tsx_data.num_inputs
     state.output_count = len(tsx_data.outputs)
+    state.output_pk_commitments = bytearray(32 * state.output_count)
     state.progress_total = 4 + 3 * state.input_count + state.output_count
     state.progress_cur = 0
 
@@ -162,6 +163,8 @@ def _check_subaddresses(state: State, outputs: List[MoneroTransactionDestination
     state.need_additional_txkeys = num_subaddresses > 0 and (
         num_stdaddresses > 0 or num_subaddresses > 1
     )
+    if state.need_additional_txkeys:
+        state.additional_tx_public_keys = bytearray(32 * state.output_count)
     state.mem_trace(4, True)
 
 
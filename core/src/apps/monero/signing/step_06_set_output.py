@@ -100,7 +100,8 @@ async def set_output(
 
     # output_pk_commitment is stored to the state as it is used during the signature and hashed to the
     # RctSigBase later. No need to store amount, it was already stored.
-    state.output_pk_commitments.append(out_pk_commitment)
+    offset = 32 * state.current_output_index
+    state.output_pk_commitments[offset : offset + 32] = out_pk_commitment
     state.last_step = state.STEP_OUT
     state.mem_trace(14, True)
 
@@ -475,7 +476,9 @@ def _set_out_additional_keys(
     if not state.need_additional_txkeys:
         return None
 
-    additional_txkey_priv = crypto.random_scalar()
+    additional_txkey_priv = offloading_keys.det_additional_txkey(
+        state.key_enc, state.current_output_index
+    )
 
     if dst_entr.is_subaddress:
         # R=r*D
@@ -487,8 +490,11 @@ def _set_out_additional_keys(
         # R=r*G
         additional_txkey = crypto.scalarmult_base(additional_txkey_priv)
 
-    state.additional_tx_public_keys.append(crypto.encodepoint(additional_txkey))
-    state.additional_tx_private_keys.append(additional_txkey_priv)
+    offset = 32 * state.current_output_index
+    crypto.encodepoint_into(
+        memoryview(state.additional_tx_public_keys)[offset : offset + 32],
+        additional_txkey,
+    )
     return additional_txkey_priv
 
 
@@ -121,7 +121,7 @@ def _set_tx_extra(state: State) -> bytes:
     len_size = 0
 
     if state.need_additional_txkeys:
-        num_keys = len(state.additional_tx_public_keys)
+        num_keys = state.output_count
         len_size = int_serialize.uvarint_size(num_keys)
 
         # TX_EXTRA_TAG_ADDITIONAL_PUBKEYS (1B) | varint | keys
@@ -140,9 +140,8 @@ def _set_tx_extra(state: State) -> bytes:
         int_serialize.dump_uvarint_b_into(num_keys, extra, offset + 1)
         offset += 1 + len_size
 
-        for idx in range(num_keys):
-            extra[offset : offset + 32] = state.additional_tx_public_keys[idx]
-            offset += 32
+        extra[offset : offset + 32 * num_keys] = state.additional_tx_public_keys
+        offset += 32 * num_keys
 
     if state.extra_nonce:
         utils.memcpy(extra, offset, state.extra_nonce, 0, len(state.extra_nonce))
@@ -172,8 +171,9 @@ def _out_pk(state: State):
     """
     Hashes out_pk into the full message.
     """
-    if state.output_count != len(state.output_pk_commitments):
+    if 32 * state.output_count != len(state.output_pk_commitments):
         raise ValueError("Invalid number of ecdh")
 
-    for out in state.output_pk_commitments:
-        state.full_message_hasher.set_out_pk_commitment(out)
+    out_pks = memoryview(state.output_pk_commitments)
+    for offset in range(0, len(out_pks), 32):
+        state.full_message_hasher.set_out_pk_commitment(out_pks[offset : offset + 32])
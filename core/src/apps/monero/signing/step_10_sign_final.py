@@ -11,6 +11,7 @@ The private tx keys are used in other numerous Monero features.
 from trezor.messages.MoneroTransactionFinalAck import MoneroTransactionFinalAck
 
 from apps.monero import misc
+from apps.monero.signing import offloading_keys
 from apps.monero.xmr import crypto
 from apps.monero.xmr.crypto import chacha_poly
 
@@ -31,9 +32,15 @@ async def final_msg(state: State) -> MoneroTransactionFinalAck:
         state.creds.spend_key_private, state.tx_prefix_hash
     )
 
-    key_buff = crypto.encodeint(state.tx_priv) + b"".join(
-        [crypto.encodeint(x) for x in state.additional_tx_private_keys]
-    )
+    num_keys = state.output_count if state.need_additional_txkeys else 0
+    key_buff = bytearray(32 * (1 + num_keys))
+    crypto.encodeint_into(key_buff, state.tx_priv)
+    for idx in range(num_keys):
+        crypto.encodeint_into(
+            key_buff,
+            offloading_keys.det_additional_txkey(state.key_enc, idx),
+            32 * (1 + idx),
+        )
     tx_enc_keys = chacha_poly.encrypt_pack(tx_key, key_buff)
     state.last_step = None
 
@@ -310,6 +310,12 @@ class KeyVBase:
             res[i - start] = self[i]
         return res
 
+    def view(self, start, stop):
+        """
+        Returns packed elements [start, stop) if stored contiguously, None otherwise
+        """
+        return None
+
     def slice_view(self, start, stop):
         return KeyVSliced(self, start, stop)
 
@@ -407,6 +413,14 @@ class KeyV(KeyVBase):
         else:
             memcpy(self.d, idx << 5, buff, offset, 32)
 
+    def view(self, start, stop):
+        if self.chunked:
+            if start >> _CHBITS != (stop - 1) >> _CHBITS:
+                return None
+            off = (start & (_CHSIZE - 1)) << 5
+            return memoryview(self.d[start >> _CHBITS])[off : off + ((stop - start) << 5)]
+        return self.mv[start << 5 : stop << 5]
+
     def resize(self, nsize, chop=False, realloc=False):
         if self.size == nsize:
             return self
@@ -845,6 +859,27 @@ def _vector_power_sum(x, n, dst=None):
     return crypto.encodeint_into(dst, _tmp_sc_3)
 
 
+def _vct_runs(n, *vcts):
+    """
+    Splits n elements of the (vector, offset) pairs into contiguous packed runs
+    for the fused vector operations. Returns None if some vector is not
+    stored contiguously.
+    """
+    step = min(n, _CHSIZE)
+    if step == 0 or n % step != 0:
+        return None
+    runs = []
+    for i in range(0, n, step):
+        run = []
+        for j in range(0, len(vcts), 2):
+            mv = vcts[j].view(vcts[j + 1] + i, vcts[j + 1] + i + step)
+            if mv is None:
+                return None
+            run.append(mv)
+        runs.append(run)
+    return runs
+
+
 def _inner_product(a, b, dst=None):
     """
     \\sum_{i=0}^{|a|} a_i b_i
@@ -854,6 +889,12 @@ def _inner_product(a, b, dst=None):
     dst = _ensure_dst_key(dst)
     crypto.sc_init_into(_tmp_sc_1, 0)
 
+    runs = _vct_runs(len(a), a, 0, b, 0)
+    if runs is not None:
+        for ra, rb in runs:
+            crypto.sc_muladd_vct(_tmp_sc_1, ra, rb)
+        return crypto.encodeint_into(dst, _tmp_sc_1)
+
     for i in range(len(a)):
         crypto.decodeint_into_noreduce(_tmp_sc_2, a.to(i))
         crypto.decodeint_into_noreduce(_tmp_sc_3, b.to(i))
@@ -876,6 +917,12 @@ def _hadamard_fold(v, a, b, into=None, into_offset=0, vR=None, vRoff=0):
     crypto.decodeint_into_noreduce(_tmp_sc_2, b)
     into = into if into else v
 
+    runs = _vct_runs(h, into, into_offset, v, 0, vR if vR else v, vRoff if vR else h)
+    if runs is not None:
+        for rd, rl, rh in runs:
+            crypto.add_keys3_vct(rd, _tmp_sc_1, rl, _tmp_sc_2, rh)
+        return into
+
     for i in range(h):
         crypto.decodepoint_into(_tmp_pt_1, v.to(i))
         crypto.decodepoint_into(_tmp_pt_2, v.to(h + i) if not vR else vR.to(i + vRoff))
@@ -929,6 +976,12 @@ def _scalar_fold(v, a, b, into=None, into_offset=0):
     crypto.decodeint_into_noreduce(_tmp_sc_2, b)
     into = into if into else v
 
+    runs = _vct_runs(h, into, into_offset, v, 0, v, h)
+    if runs is not None:
+        for rd, rl, rh in runs:
+            crypto.sc_fold_vct(rd, rl, rh, _tmp_sc_1, _tmp_sc_2)
+        return into
+
     for i in range(h):
         crypto.decodeint_into_noreduce(_tmp_sc_3, v.to(i))
         crypto.decodeint_into_noreduce(_tmp_sc_4, v.to(h + i))
@@ -217,15 +217,25 @@ hash_to_point_into = tcry.xmr_hash_to_ec
 xmr_H = tcry.ge25519_set_h
 
 
-def scalarmult_h(i) -> Ge25519:
-    return scalarmult(xmr_H(), sc_init(i) if isinstance(i, int) else i)
+scalarmult_h = tcry.ge25519_scalarmult_h
+scalarmult_h_into = tcry.ge25519_scalarmult_h
 
 
 add_keys2 = tcry.xmr_add_keys2_vartime
 add_keys2_into = tcry.xmr_add_keys2_vartime
 add_keys3 = tcry.xmr_add_keys3_vartime
 add_keys3_into = tcry.xmr_add_keys3_vartime
+multi_scalarmult = tcry.xmr_multi_scalarmult
+multi_scalarmult_into = tcry.xmr_multi_scalarmult
+multi_scalarmult_vartime = tcry.xmr_multi_scalarmult_vartime
+multi_scalarmult_vartime_into = tcry.xmr_multi_scalarmult_vartime
+add_keys3_vct = tcry.xmr_add_keys3_vct
+sc_fold_vct = tcry.xmr_sc_fold_vct
+sc_muladd_vct = tcry.xmr_sc_muladd_vct
 gen_commitment = tcry.xmr_gen_c
+gen_mlsag_simple = tcry.xmr_gen_mlsag_simple
+gen_clsag_simple = tcry.xmr_gen_clsag_simple
+export_key_images = tcry.xmr_export_key_images
 
 
 def generate_key_derivation(pub: Ge25519, sec: Sc25519) -> Ge25519:
@@ -22,66 +22,103 @@ def compute_hash(rr: MoneroTransferDetails) -> bytes:
     return kck.digest()
 
 
-def export_key_image(
-    creds: AccountCreds, subaddresses: Subaddresses, td: MoneroTransferDetails
-) -> Tuple[Ge25519, Sig]:
-    out_key = crypto.decodepoint(td.out_key)
-    tx_pub_key = crypto.decodepoint(td.tx_pub_key)
-
-    additional_tx_pub_key = None
-    if len(td.additional_tx_pub_keys) == 1:  # compression
-        additional_tx_pub_key = crypto.decodepoint(td.additional_tx_pub_keys[0])
-    elif td.additional_tx_pub_keys:
-        if td.internal_output_index >= len(td.additional_tx_pub_keys):
-            raise ValueError("Wrong number of additional derivations")
-        additional_tx_pub_key = crypto.decodepoint(
-            td.additional_tx_pub_keys[td.internal_output_index]
-        )
-
-    ki, sig = _export_key_image(
-        creds,
-        subaddresses,
-        out_key,
-        tx_pub_key,
-        additional_tx_pub_key,
-        td.internal_output_index,
-        True,
-        td.sub_addr_major,
-        td.sub_addr_minor,
-    )
-    return ki, sig
-
-
-def _export_key_image(
+def export_key_images(
     creds: AccountCreds,
     subaddresses: Subaddresses,
-    pkey: Ge25519,
-    tx_pub_key: Ge25519,
-    additional_tx_pub_key: Optional[Ge25519],
-    out_idx: int,
-    test: bool = True,
-    sub_addr_major: int = None,
-    sub_addr_minor: int = None,
-) -> Tuple[Ge25519, Sig]:
+    subaddr_keys: Dict[Tuple[int, int], Sc25519],
+    tds: List[MoneroTransferDetails],
+) -> bytes:
     """
-    Generates key image for the TXO + signature for the key image
+    Generates key images for the batch of TXOs + signatures for the key images,
+    packed as (ki || c || r) per TXO. Outputs of one transaction share the
+    derivation, subaddress secret keys are cached in subaddr_keys.
     """
-    r = monero.generate_tx_spend_and_key_image_and_derivation(
-        creds,
-        subaddresses,
-        pkey,
-        tx_pub_key,
-        additional_tx_pub_key,
-        out_idx,
-        sub_addr_major,
-        sub_addr_minor,
+    if not crypto.sc_isnonzero(creds.spend_key_private):
+        raise ValueError("Watch-only wallet not supported")
+
+    derivations = {}  # type: Dict[bytes, Ge25519]
+    out_keys = bytearray(32 * len(tds))
+    recv_derivations = []
+    indices = []
+    sub_keys = []
+
+    for i, td in enumerate(tds):
+        out_key = crypto.decodepoint(td.out_key)
+        out_keys[32 * i : 32 * (i + 1)] = td.out_key
+
+        additional_tx_pub_key = None
+        if len(td.additional_tx_pub_keys) == 1:  # compression
+            additional_tx_pub_key = td.additional_tx_pub_keys[0]
+        elif td.additional_tx_pub_keys:
+            if td.internal_output_index >= len(td.additional_tx_pub_keys):
+                raise ValueError("Wrong number of additional derivations")
+            additional_tx_pub_key = td.additional_tx_pub_keys[td.internal_output_index]
+
+        # the subaddress is looked up in the dict, computed once per index
+        if td.sub_addr_major is not None and td.sub_addr_minor is not None:
+            _subaddress_secret_key(
+                creds,
+                subaddresses,
+                subaddr_keys,
+                td.sub_addr_major,
+                td.sub_addr_minor,
+            )
+
+        subaddr_recv_info = monero.is_out_to_account(
+            subaddresses,
+            out_key,
+            _derivation(creds, derivations, td.tx_pub_key),
+            _derivation(creds, derivations, additional_tx_pub_key)
+            if additional_tx_pub_key
+            else None,
+            td.internal_output_index,
+        )
+        if subaddr_recv_info is None:
+            raise monero.XmrNoSuchAddressException("No such addr")
+
+        received_index, recv_derivation = subaddr_recv_info
+        recv_derivations.append(recv_derivation)
+        indices.append(td.internal_output_index)
+        sub_keys.append(
+            None
+            if received_index == (0, 0)
+            else _subaddress_secret_key(
+                creds, subaddresses, subaddr_keys, *received_index
+            )
+        )
+
+    return crypto.export_key_images(
+        creds.spend_key_private, out_keys, recv_derivations, indices, sub_keys
     )
-    xi, ki, recv_derivation = r[:3]
 
-    phash = crypto.encodepoint(ki)
-    sig = generate_ring_signature(phash, ki, [pkey], xi, 0, test)
 
-    return ki, sig
+def _derivation(
+    creds: AccountCreds, derivations: Dict[bytes, Ge25519], tx_pub_key: bytes
+) -> Ge25519:
+    derivation = derivations.get(tx_pub_key)
+    if derivation is None:
+        derivation = crypto.generate_key_derivation(
+            crypto.decodepoint(tx_pub_key), creds.view_key_private
+        )
+        derivations[tx_pub_key] = derivation
+    return derivation
+
+
+def _subaddress_secret_key(
+    creds: AccountCreds,
+    subaddresses: Subaddresses,
+    subaddr_keys: Dict[Tuple[int, int], Sc25519],
+    major: int,
+    minor: int,
+) -> Sc25519:
+    key = subaddr_keys.get((major, minor))
+    if key is None:
+        monero.compute_subaddresses(creds, major, [minor], subaddresses)
+        key = monero.get_subaddress_secret_key(
+            creds.view_key_private, major=major, minor=minor
+        )
+        subaddr_keys[(major, minor)] = key
+    return key
 
 
 def generate_ring_signature(
@@ -9,6 +9,7 @@ Author: Dusan Klinec, ph4r05, 2018
 """
 
 import gc
+from micropython import const
 
 from apps.monero.xmr import crypto
 
@@ -17,17 +18,36 @@ if False:
     from apps.monero.xmr.types import Sc25519
     from apps.monero.xmr.serialize_messages.tx_rsig_bulletproof import Bulletproof
 
+# XMR_BP_MAX_M in crypto/monero/bulletproof.h
+_NATIVE_BP_MAX_AMOUNTS = const(2)
+
 
 def prove_range_bp_batch(amounts: List[int], masks: List[Sc25519]) -> Bulletproof:
-    """Calculates Bulletproof in batches"""
-    from apps.monero.xmr import bulletproof as bp
+    """
+    Calculates Bulletproof in batches. The proof is computed natively for up to
+    two amounts, which is all the device proves itself; larger batches fall
+    back to the slower builder, which does not need a single large allocation.
+    """
+    if len(amounts) > _NATIVE_BP_MAX_AMOUNTS:
+        from apps.monero.xmr import bulletproof as bp
 
-    bpi = bp.BulletProofBuilder()
-    bp_proof = bpi.prove_batch([crypto.sc_init(a) for a in amounts], masks)
-    del (bpi, bp)
+        bpi = bp.BulletProofBuilder()
+        bp_proof = bpi.prove_batch([crypto.sc_init(a) for a in amounts], masks)
+        del (bpi, bp)
+        gc.collect()
+        return bp_proof
+
+    from trezor.crypto import monero as tcry
+    from apps.monero.xmr.serialize_messages.tx_rsig_bulletproof import Bulletproof
+
+    V, A, S, T1, T2, taux, mu, L, R, a, b, t = tcry.xmr_prove_range_bulletproof(
+        amounts, masks
+    )
     gc.collect()
 
-    return bp_proof
+    return Bulletproof(
+        V=V, A=A, S=S, T1=T1, T2=T2, taux=taux, mu=mu, L=L, R=R, a=a, b=b, t=t
+    )
 
 
 def verify_bp(bp_proof: Bulletproof, amounts: List[int], masks: List[Sc25519]) -> bool:
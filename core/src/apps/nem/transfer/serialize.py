@@ -1,21 +1,10 @@
-from trezor.crypto import random
+from trezor.crypto import nem, random
 from trezor.messages.NEMImportanceTransfer import NEMImportanceTransfer
 from trezor.messages.NEMMosaic import NEMMosaic
 from trezor.messages.NEMTransactionCommon import NEMTransactionCommon
 from trezor.messages.NEMTransfer import NEMTransfer
 
-from ..helpers import (
-    AES_BLOCK_SIZE,
-    NEM_SALT_SIZE,
-    NEM_TRANSACTION_TYPE_IMPORTANCE_TRANSFER,
-    NEM_TRANSACTION_TYPE_TRANSFER,
-)
-from ..writers import (
-    serialize_tx_common,
-    write_bytes_with_len,
-    write_uint32_le,
-    write_uint64_le,
-)
+from ..helpers import AES_BLOCK_SIZE, NEM_SALT_SIZE
 
 
 def serialize_transfer(
@@ -25,56 +14,39 @@ def serialize_transfer(
     payload: bytes = None,
     encrypted: bool = False,
 ) -> bytearray:
-    tx = serialize_tx_common(
-        common,
+    tx = nem.serialize_transfer(
+        common.network,
+        common.timestamp,
         public_key,
-        NEM_TRANSACTION_TYPE_TRANSFER,
-        _get_version(common.network, transfer.mosaics),
+        common.fee,
+        common.deadline,
+        transfer.recipient,
+        transfer.amount,
+        payload,
+        encrypted,
+        len(transfer.mosaics) if transfer.mosaics else 0,
     )
-
-    write_bytes_with_len(tx, transfer.recipient.encode())
-    write_uint64_le(tx, transfer.amount)
-
-    if payload:
-        # payload + payload size (u32) + encryption flag (u32)
-        write_uint32_le(tx, len(payload) + 2 * 4)
-        if encrypted:
-            write_uint32_le(tx, 0x02)
-        else:
-            write_uint32_le(tx, 0x01)
-        write_bytes_with_len(tx, payload)
-    else:
-        write_uint32_le(tx, 0)
-
-    if transfer.mosaics:
-        write_uint32_le(tx, len(transfer.mosaics))
-
-    return tx
+    # the mosaics are appended by serialize_mosaic()
+    return bytearray(tx)
 
 
 def serialize_mosaic(w: bytearray, namespace: str, mosaic: str, quantity: int):
-    identifier_w = bytearray()
-    write_bytes_with_len(identifier_w, namespace.encode())
-    write_bytes_with_len(identifier_w, mosaic.encode())
-
-    mosaic_w = bytearray()
-    write_bytes_with_len(mosaic_w, identifier_w)
-    write_uint64_le(mosaic_w, quantity)
-
-    write_bytes_with_len(w, mosaic_w)
+    w.extend(nem.serialize_mosaic(namespace, mosaic, quantity))
 
 
 def serialize_importance_transfer(
     common: NEMTransactionCommon, imp: NEMImportanceTransfer, public_key: bytes
-) -> bytearray:
-    w = serialize_tx_common(
-        common, public_key, NEM_TRANSACTION_TYPE_IMPORTANCE_TRANSFER
+) -> bytes:
+    return nem.serialize_importance_transfer(
+        common.network,
+        common.timestamp,
+        public_key,
+        common.fee,
+        common.deadline,
+        imp.mode,
+        imp.public_key,
     )
 
-    write_uint32_le(w, imp.mode)
-    write_bytes_with_len(w, imp.public_key)
-    return w
-
 
 def get_transfer_payload(transfer: NEMTransfer, node) -> [bytes, bool]:
     payload = transfer.payload
@@ -95,12 +67,6 @@ def _encrypt(node, public_key: bytes, payload: bytes) -> bytes:
     return iv + salt + encrypted
 
 
-def _get_version(network, mosaics=None) -> int:
-    if mosaics:
-        return network << 24 | 2
-    return network << 24 | 1
-
-
 def canonicalize_mosaics(mosaics: list):
     if len(mosaics) <= 1:
         return mosaics
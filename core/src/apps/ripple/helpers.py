@@ -2,7 +2,7 @@ from micropython import const
 
 from trezor.crypto.hashlib import ripemd160, sha256
 
-from apps.common import HARDENED
+from apps.common import HARDENED, paths
 
 from . import base58_ripple
 
@@ -52,6 +52,11 @@ def decode_address(address: str):
     return adr[1:]
 
 
+_PATH_PATTERN = paths.compile_pattern(
+    (5, 5, (44 | HARDENED, 144 | HARDENED, paths.hardened(0, 1000000), 0, 0))
+)
+
+
 def validate_full_path(path: list) -> bool:
     """
     Validates derivation path to equal 44'/144'/a'/0/0,
@@ -59,16 +64,4 @@ def validate_full_path(path: list) -> bool:
     Similar to Ethereum this should be 44'/144'/a', but for
     compatibility with other HW vendors we use 44'/144'/a'/0/0.
     """
-    if len(path) != 5:
-        return False
-    if path[0] != 44 | HARDENED:
-        return False
-    if path[1] != 144 | HARDENED:
-        return False
-    if path[2] < HARDENED or path[2] > 1000000 | HARDENED:
-        return False
-    if path[3] != 0:
-        return False
-    if path[4] != 0:
-        return False
-    return True
+    return paths.match_path(_PATH_PATTERN, path) >= 0
@@ -8,10 +8,17 @@
 # the actual data follow. This currently only supports the Payment
 # transaction type and the fields that are required for it.
 
+from micropython import const
+
 from trezor.messages.RippleSignTx import RippleSignTx
 
+from apps.common.writers import empty_bytearray, write_uint16_be, write_uint32_be
+
 from . import helpers
 
+if False:
+    from trezor.utils import Writer
+
 FIELD_TYPE_INT16 = 1
 FIELD_TYPE_INT32 = 2
 FIELD_TYPE_AMOUNT = 6
@@ -34,9 +41,24 @@ FIELDS_MAP = {
 
 TRANSACTION_TYPES = {"Payment": 0}
 
+# Size of a payment with all the fields above, a compressed public key and a
+# DER signature of at most 72 bytes, so that serialize() never reallocates.
+_PAYMENT_SIZE = const(195)
+
 
 def serialize(msg: RippleSignTx, source_address: str, pubkey=None, signature=None):
-    w = bytearray()
+    w = empty_bytearray(_PAYMENT_SIZE)
+    write_payment(w, msg, source_address, pubkey, signature)
+    return w
+
+
+def write_payment(
+    w: Writer, msg: RippleSignTx, source_address: str, pubkey=None, signature=None
+):
+    """
+    Serializes the payment into any writer, e.g. straight into the hash
+    context that is signed.
+    """
     # must be sorted numerically first by type and then by name
     write(w, FIELDS_MAP["type"], TRANSACTION_TYPES["Payment"])
     write(w, FIELDS_MAP["flags"], msg.flags)
@@ -49,17 +71,16 @@ def serialize(msg: RippleSignTx, source_address: str, pubkey=None, signature=Non
     write(w, FIELDS_MAP["txnSignature"], signature)
     write(w, FIELDS_MAP["account"], source_address)
     write(w, FIELDS_MAP["destination"], msg.payment.destination)
-    return w
 
 
-def write(w: bytearray, field: dict, value):
+def write(w: Writer, field: dict, value):
     if value is None:
         return
     write_type(w, field)
     if field["type"] == FIELD_TYPE_INT16:
-        w.extend(value.to_bytes(2, "big"))
+        write_uint16_be(w, value)
     elif field["type"] == FIELD_TYPE_INT32:
-        w.extend(value.to_bytes(4, "big"))
+        write_uint32_be(w, value)
     elif field["type"] == FIELD_TYPE_AMOUNT:
         w.extend(serialize_amount(value))
     elif field["type"] == FIELD_TYPE_ACCOUNT:
@@ -70,7 +91,7 @@ def write(w: bytearray, field: dict, value):
         raise ValueError("Unknown field type")
 
 
-def write_type(w: bytearray, field: dict):
+def write_type(w: Writer, field: dict):
     if field["key"] <= 0xF:
         w.append((field["type"] << 4) | field["key"])
     else:
@@ -91,13 +112,13 @@ def serialize_amount(value: int) -> bytearray:
     return b
 
 
-def write_bytes_varint(w: bytearray, value: bytes):
+def write_bytes_varint(w: Writer, value: bytes):
     """Serialize a variable length bytes."""
     write_varint(w, len(value))
     w.extend(value)
 
 
-def write_varint(w: bytearray, val: int):
+def write_varint(w: Writer, val: int):
     """
     Implements variable-length int encoding from Ripple.
     See: https://ripple.com/wiki/Binary_Format#Variable_Length_Data_Encoding
@@ -3,12 +3,13 @@ from trezor.crypto.curve import secp256k1
 from trezor.crypto.hashlib import sha512
 from trezor.messages.RippleSignedTx import RippleSignedTx
 from trezor.messages.RippleSignTx import RippleSignTx
+from trezor.utils import HashWriter
 from trezor.wire import ProcessError
 
 from apps.common import paths
 from apps.common.seed import with_slip44_keychain
 from apps.ripple import CURVE, SLIP44_ID, helpers, layout
-from apps.ripple.serialize import serialize
+from apps.ripple.serialize import serialize, write_payment
 
 
 @with_slip44_keychain(SLIP44_ID, CURVE, allow_testnet=True)
@@ -23,8 +24,10 @@ async def sign_tx(ctx, msg: RippleSignTx, keychain):
     source_address = helpers.address_from_public_key(node.public_key())
 
     set_canonical_flag(msg)
-    tx = serialize(msg, source_address, pubkey=node.public_key())
-    to_sign = get_network_prefix() + tx
+    # the network prefix and the transaction go straight into the hash
+    h = HashWriter(sha512())
+    h.extend(get_network_prefix())
+    write_payment(h, msg, source_address, pubkey=node.public_key())
 
     check_fee(msg.fee)
     if msg.payment.destination_tag is not None:
@@ -32,7 +35,7 @@ async def sign_tx(ctx, msg: RippleSignTx, keychain):
     await layout.require_confirm_fee(ctx, msg.fee)
     await layout.require_confirm_tx(ctx, msg.payment.destination, msg.payment.amount)
 
-    signature = ecdsa_sign(node.private_key(), first_half_of_sha512(to_sign))
+    signature = ecdsa_sign(node.private_key(), first_half_of_sha512(h))
     tx = serialize(msg, source_address, pubkey=node.public_key(), signature=signature)
     return RippleSignedTx(signature, tx)
 
@@ -47,10 +50,9 @@ def get_network_prefix():
     return helpers.HASH_TX_SIGN.to_bytes(4, "big")
 
 
-def first_half_of_sha512(b):
+def first_half_of_sha512(h: HashWriter):
     """First half of SHA512, which Ripple uses"""
-    hash = sha512(b)
-    return hash.digest()[:32]
+    return h.get_digest()[:32]
 
 
 def ecdsa_sign(private_key: bytes, digest: bytes) -> bytes:
@@ -3,7 +3,7 @@ import ustruct
 from trezor.crypto import base32
 from trezor.wire import ProcessError
 
-from apps.common import HARDENED
+from apps.common import HARDENED, paths
 
 
 def public_key_from_address(address: str) -> bytes:
@@ -26,20 +26,24 @@ def address_from_public_key(pubkey: bytes):
     return base32.encode(address)
 
 
+def addresses_from_node(node, index: int, count: int) -> list:
+    """Returns the addresses of the children index, ..., index + count - 1"""
+    pubkeys = node.derive_public_keys(index, count)
+    # skip ed25519 pubkey marker
+    return [address_from_public_key(pubkey[1:]) for pubkey in pubkeys]
+
+
+_PATH_PATTERN = paths.compile_pattern(
+    (3, 3, (44 | HARDENED, 148 | HARDENED, paths.hardened(0, 1000000)))
+)
+
+
 def validate_full_path(path: list) -> bool:
     """
     Validates derivation path to equal 44'/148'/a',
     where `a` is an account index from 0 to 1 000 000.
     """
-    if len(path) != 3:
-        return False
-    if path[0] != 44 | HARDENED:
-        return False
-    if path[1] != 148 | HARDENED:
-        return False
-    if path[2] < HARDENED or path[2] > 1000000 | HARDENED:
-        return False
-    return True
+    return paths.match_path(_PATH_PATTERN, path) >= 0
 
 
 def _crc16_checksum_verify(data: bytes, checksum: bytes):
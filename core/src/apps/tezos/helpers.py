@@ -2,7 +2,7 @@ from micropython import const
 
 from trezor.crypto import base58
 
-from apps.common import HARDENED
+from apps.common import HARDENED, paths
 from apps.common.writers import write_bytes_unchecked, write_uint8
 
 TEZOS_AMOUNT_DECIMALS = const(6)
@@ -66,6 +66,16 @@ def base58_decode_check(enc, prefix=None):
     return decoded
 
 
+_PATH_PATTERN = paths.compile_pattern(
+    (3, 3, (44 | HARDENED, 1729 | HARDENED, paths.hardened(0, 1000000))),
+    (
+        4,
+        4,
+        (44 | HARDENED, 1729 | HARDENED, 0 | HARDENED, paths.hardened(0, 1000000)),
+    ),
+)
+
+
 def validate_full_path(path: list) -> bool:
     """
     Validates derivation path to equal 44'/1729'/a',
@@ -73,22 +83,7 @@ def validate_full_path(path: list) -> bool:
     Additional component added to allow ledger migration
     44'/1729'/0'/b' where `b` is an account index from 0 to 1 000 000
     """
-    length = len(path)
-    if length < 3 or length > 4:
-        return False
-    if path[0] != 44 | HARDENED:
-        return False
-    if path[1] != 1729 | HARDENED:
-        return False
-    if length == 3:
-        if path[2] < HARDENED or path[2] > 1000000 | HARDENED:
-            return False
-    if length == 4:
-        if path[2] != 0 | HARDENED:
-            return False
-        if path[3] < HARDENED or path[3] > 1000000 | HARDENED:
-            return False
-    return True
+    return paths.match_path(_PATH_PATTERN, path) >= 0
 
 
 def write_bool(w: bytearray, boolean: bool):
@@ -8,10 +8,20 @@ from trezor.messages.TezosSignedTx import TezosSignedTx
 
 from apps.common import paths
 from apps.common.seed import with_slip44_keychain
-from apps.common.writers import write_bytes_unchecked, write_uint8, write_uint32_be
+from apps.common.writers import (
+    empty_bytearray,
+    write_bytes_unchecked,
+    write_uint8,
+    write_uint32_be,
+)
 from apps.tezos import CURVE, SLIP44_ID, helpers, layout
 
 PROPOSAL_LENGTH = const(32)
+SIGNATURE_LENGTH = const(64)
+
+# generous size of the operations without their scripts, parameters and
+# proposals, used to preallocate the operation bytes
+_OPERATION_SIZE = const(320)
 
 
 @with_slip44_keychain(SLIP44_ID, CURVE, allow_testnet=True)
@@ -99,19 +109,18 @@ async def sign_tx(ctx, msg, keychain):
     else:
         raise wire.DataError("Invalid operation")
 
-    w = bytearray()
-    _get_operation_bytes(w, msg)
-
-    opbytes = bytes(w)
+    # the signature is appended to the same buffer later
+    sig_op_contents = empty_bytearray(_get_operation_size(msg) + SIGNATURE_LENGTH)
+    _get_operation_bytes(sig_op_contents, msg)
 
     # watermark 0x03 is prefix for transactions, delegations, originations, reveals...
-    watermark = bytes([3])
-    wm_opbytes = watermark + opbytes
-    wm_opbytes_hash = hashlib.blake2b(wm_opbytes, outlen=32).digest()
+    wm_opbytes = hashlib.blake2b(bytes([3]), outlen=32)
+    wm_opbytes.update(sig_op_contents)
+    wm_opbytes_hash = wm_opbytes.digest()
 
     signature = ed25519.sign(node.private_key(), wm_opbytes_hash)
 
-    sig_op_contents = opbytes + signature
+    write_bytes_unchecked(sig_op_contents, signature)
     sig_op_contents_hash = hashlib.blake2b(sig_op_contents, outlen=32).digest()
     ophash = helpers.base58_encode_check(sig_op_contents_hash, prefix="o")
 
@@ -158,6 +167,17 @@ def _get_ballot(ballot):
         return "pass"
 
 
+def _get_operation_size(msg) -> int:
+    size = _OPERATION_SIZE
+    if msg.transaction is not None and msg.transaction.parameters:
+        size += len(msg.transaction.parameters)
+    if msg.origination is not None and msg.origination.script:
+        size += len(msg.origination.script)
+    if msg.proposal is not None:
+        size += len(msg.proposal.proposals) * PROPOSAL_LENGTH
+    return size
+
+
 def _get_operation_bytes(w: bytearray, msg):
     write_bytes_unchecked(w, msg.branch)
 
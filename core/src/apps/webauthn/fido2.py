@@ -49,8 +49,10 @@ _TYPE_CONT = const(0x00)  # continuation frame identifier
 
 # U2F HID sizes
 _HID_RPT_SIZE = const(64)
-_FRAME_INIT_SIZE = const(57)
-_FRAME_CONT_SIZE = const(59)
+_FRAME_INIT_HEADER = const(7)
+_FRAME_CONT_HEADER = const(5)
+_FRAME_INIT_SIZE = const(_HID_RPT_SIZE - _FRAME_INIT_HEADER)
+_FRAME_CONT_SIZE = const(_HID_RPT_SIZE - _FRAME_CONT_HEADER)
 _MAX_U2FHID_MSG_PAYLOAD_LEN = const(_FRAME_INIT_SIZE + 128 * _FRAME_CONT_SIZE)
 _CMD_INIT_NONCE_SIZE = const(8)
 
@@ -247,31 +249,6 @@ class CborError(Exception):
         self.code = code
 
 
-def frame_init() -> dict:
-    # uint32_t cid;     // Channel identifier
-    # uint8_t cmd;      // Command - b7 set
-    # uint8_t bcnth;    // Message byte count - high part
-    # uint8_t bcntl;    // Message byte count - low part
-    # uint8_t data[HID_RPT_SIZE - 7];   // Data payload
-    return {
-        "cid": 0 | uctypes.UINT32,
-        "cmd": 4 | uctypes.UINT8,
-        "bcnt": 5 | uctypes.UINT16,
-        "data": (7 | uctypes.ARRAY, (_HID_RPT_SIZE - 7) | uctypes.UINT8),
-    }
-
-
-def frame_cont() -> dict:
-    # uint32_t cid;                     // Channel identifier
-    # uint8_t seq;                      // Sequence number - b7 cleared
-    # uint8_t data[HID_RPT_SIZE - 5];   // Data payload
-    return {
-        "cid": 0 | uctypes.UINT32,
-        "seq": 4 | uctypes.UINT8,
-        "data": (5 | uctypes.ARRAY, (_HID_RPT_SIZE - 5) | uctypes.UINT8),
-    }
-
-
 def resp_cmd_init() -> dict:
     # uint8_t nonce[8];         // Client application nonce
     # uint32_t cid;             // Channel identifier
@@ -391,55 +368,53 @@ class Cmd:
 
 
 async def read_cmd(iface: io.HID) -> Optional[Cmd]:
-    desc_init = frame_init()
-    desc_cont = frame_cont()
     read = loop.wait(iface.iface_num() | io.POLL_READ)
 
     buf = await read
     while True:
-        ifrm = overlay_struct(bytearray(buf), desc_init)
-        bcnt = ifrm.bcnt
-        data = ifrm.data
-        datalen = len(data)
-        seq = 0
+        # init frame: uint32 cid, uint8 cmd, uint16 bcnt, data
+        cid, cmd, bcnt = ustruct.unpack_from(">LBH", buf)
 
-        if ifrm.cmd & _TYPE_MASK == _TYPE_CONT:
+        if cmd & _TYPE_MASK == _TYPE_CONT:
             # unexpected cont packet, abort current msg
             if __debug__:
                 log.warning(__name__, "_TYPE_CONT")
             return None
 
-        if ifrm.cid == 0 or ((ifrm.cid == _CID_BROADCAST) and (ifrm.cmd != _CMD_INIT)):
+        if cid == 0 or ((cid == _CID_BROADCAST) and (cmd != _CMD_INIT)):
             # CID 0 is reserved for future use and _CID_BROADCAST is reserved for channel allocation
-            await send_cmd(cmd_error(ifrm.cid, _ERR_INVALID_CID), iface)
+            await send_cmd(cmd_error(cid, _ERR_INVALID_CID), iface)
             return None
 
         if bcnt > _MAX_U2FHID_MSG_PAYLOAD_LEN:
             # invalid payload length, abort current msg
             if __debug__:
                 log.warning(__name__, "_MAX_U2FHID_MSG_PAYLOAD_LEN")
-            await send_cmd(cmd_error(ifrm.cid, _ERR_INVALID_LEN), iface)
+            await send_cmd(cmd_error(cid, _ERR_INVALID_LEN), iface)
             return None
 
-        if datalen < bcnt:
-            databuf = bytearray(bcnt)
-            utils.memcpy(databuf, 0, data, 0, bcnt)
-            data = databuf
-        else:
-            data = data[:bcnt]
+        if bcnt <= _FRAME_INIT_SIZE:
+            return Cmd(cid, cmd, buf[_FRAME_INIT_HEADER : _FRAME_INIT_HEADER + bcnt])
+
+        # the payload is copied straight from the reports, without parsing them
+        # into intermediate buffers
+        data = bytearray(bcnt)
+        datalen = utils.memcpy(data, 0, buf, _FRAME_INIT_HEADER, bcnt)
+        seq = 0
 
         while datalen < bcnt:
             buf = await loop.race(read, loop.sleep(_CTAP_HID_TIMEOUT_MS))
             if not isinstance(buf, bytes):
                 if __debug__:
                     log.warning(__name__, "_ERR_MSG_TIMEOUT")
-                await send_cmd(cmd_error(ifrm.cid, _ERR_MSG_TIMEOUT), iface)
+                await send_cmd(cmd_error(cid, _ERR_MSG_TIMEOUT), iface)
                 return None
 
-            cfrm = overlay_struct(bytearray(buf), desc_cont)
+            # cont frame: uint32 cid, uint8 seq, data
+            ccid, cseq = ustruct.unpack_from(">LB", buf)
 
-            if cfrm.seq == _CMD_INIT:
-                if cfrm.cid == ifrm.cid:
+            if cseq == _CMD_INIT:
+                if ccid == cid:
                     # _CMD_INIT command on current channel, abort current transaction.
                     if __debug__:
                         log.warning(
@@ -454,25 +429,21 @@ async def read_cmd(iface: io.HID) -> Optional[Cmd]:
                             __name__,
                             "U2FHID: received CMD_INIT command for different CID",
                         )
-                    cfrm = overlay_struct(bytearray(buf), desc_init)
-                    await send_cmd(
-                        cmd_init(
-                            Cmd(cfrm.cid, cfrm.cmd, bytes(cfrm.data[: cfrm.bcnt]))
-                        ),
-                        iface,
-                    )
+                    _, _, cbcnt = ustruct.unpack_from(">LBH", buf)
+                    cdata = buf[_FRAME_INIT_HEADER : _FRAME_INIT_HEADER + cbcnt]
+                    await send_cmd(cmd_init(Cmd(ccid, cseq, cdata)), iface)
                     continue
 
-            if cfrm.cid != ifrm.cid:
+            if ccid != cid:
                 # Frame for a different channel, continue waiting for next frame on the active CID.
                 # For init frames reply with BUSY. Ignore continuation frames.
-                if cfrm.seq & _TYPE_MASK == _TYPE_INIT:
+                if cseq & _TYPE_MASK == _TYPE_INIT:
                     if __debug__:
                         log.warning(
                             __name__,
                             "U2FHID: received init frame for different CID, _ERR_CHANNEL_BUSY",
                         )
-                    await send_cmd(cmd_error(cfrm.cid, _ERR_CHANNEL_BUSY), iface)
+                    await send_cmd(cmd_error(ccid, _ERR_CHANNEL_BUSY), iface)
                 else:
                     if __debug__:
                         log.warning(
@@ -480,81 +451,45 @@ async def read_cmd(iface: io.HID) -> Optional[Cmd]:
                         )
                 continue
 
-            if cfrm.seq != seq:
+            if cseq != seq:
                 # cont frame for this channel, but incorrect seq number, abort
                 # current msg
                 if __debug__:
                     log.warning(__name__, "_ERR_INVALID_SEQ")
-                await send_cmd(cmd_error(cfrm.cid, _ERR_INVALID_SEQ), iface)
+                await send_cmd(cmd_error(ccid, _ERR_INVALID_SEQ), iface)
                 return None
 
-            datalen += utils.memcpy(data, datalen, cfrm.data, 0, bcnt - datalen)
+            datalen += utils.memcpy(
+                data, datalen, buf, _FRAME_CONT_HEADER, bcnt - datalen
+            )
             seq += 1
         else:
-            return Cmd(ifrm.cid, ifrm.cmd, bytes(data))
+            return Cmd(cid, cmd, bytes(data))
 
 
 async def send_cmd(cmd: Cmd, iface: io.HID) -> None:
-    init_desc = frame_init()
-    cont_desc = frame_cont()
-    offset = 0
-    seq = 0
+    # the frames are built and written by the HID interface
     datalen = len(cmd.data)
-
-    buf, frm = make_struct(init_desc)
-    frm.cid = cmd.cid
-    frm.cmd = cmd.cmd
-    frm.bcnt = datalen
-
-    offset += utils.memcpy(frm.data, 0, cmd.data, offset, datalen)
-    iface.write(buf)
-
-    if offset < datalen:
-        frm = overlay_struct(buf, cont_desc)
+    offset = iface.write_ctaphid(cmd.cid, cmd.cmd, cmd.data, 0)
 
     write = loop.wait(iface.iface_num() | io.POLL_WRITE)
     while offset < datalen:
-        frm.seq = seq
-        copied = utils.memcpy(frm.data, 0, cmd.data, offset, datalen)
-        offset += copied
-        if copied < _FRAME_CONT_SIZE:
-            frm.data[copied:] = bytearray(_FRAME_CONT_SIZE - copied)
-        while True:
-            ret = await loop.race(write, loop.sleep(_CTAP_HID_TIMEOUT_MS))
-            if ret is not None:
-                raise TimeoutError
-
-            if iface.write(buf) > 0:
-                break
-        seq += 1
+        ret = await loop.race(write, loop.sleep(_CTAP_HID_TIMEOUT_MS))
+        if ret is not None:
+            raise TimeoutError
+        offset = iface.write_ctaphid(cmd.cid, cmd.cmd, cmd.data, offset)
 
 
 def send_cmd_sync(cmd: Cmd, iface: io.HID) -> None:
-    init_desc = frame_init()
-    cont_desc = frame_cont()
-    offset = 0
-    seq = 0
     datalen = len(cmd.data)
-
-    buf, frm = make_struct(init_desc)
-    frm.cid = cmd.cid
-    frm.cmd = cmd.cmd
-    frm.bcnt = datalen
-
-    offset += utils.memcpy(frm.data, 0, cmd.data, offset, datalen)
-    iface.write(buf)
-
-    if offset < datalen:
-        frm = overlay_struct(buf, cont_desc)
+    offset = iface.write_ctaphid(cmd.cid, cmd.cmd, cmd.data, 0)
 
     while offset < datalen:
-        frm.seq = seq
-        copied = utils.memcpy(frm.data, 0, cmd.data, offset, datalen)
-        offset += copied
-        if copied < _FRAME_CONT_SIZE:
-            frm.data[copied:] = bytearray(_FRAME_CONT_SIZE - copied)
-        iface.write_blocking(buf, 1000)
-        seq += 1
+        sent = iface.write_ctaphid(cmd.cid, cmd.cmd, cmd.data, offset, 1000)
+        if sent == offset:
+            # timed out, the rest of the message would be of no use
+            break
+        offset = sent
 
 
 async def handle_reports(iface: io.HID) -> None:
@@ -1793,7 +1728,9 @@ def cbor_get_assertion_hmac_secret(
 
     # Compute the ECDH shared secret.
     ecdh_result = nist256p1.multiply(_KEY_AGREEMENT_PRIVKEY, b"\04" + x + y)
-    shared_secret = hashlib.sha256(ecdh_result[1:33]).digest()
+    h = hashlib.sha256()
+    h.update(ecdh_result, 1, 32)
+    shared_secret = h.digest()
 
     # Check the authentication tag and decrypt the salt.
     tag = hmac.Hmac(shared_secret, salt_enc, hashlib.sha256).digest()[:16]
@@ -21,14 +21,14 @@ def _credential_from_data(index: int, data: bytes) -> Fido2Credential:
 
 
 def find_all() -> Iterator[Fido2Credential]:
-    for index in range(MAX_RESIDENT_CREDENTIALS):
+    for index in storage.resident_credentials.indices():
         data = storage.resident_credentials.get(index)
         if data is not None:
             yield _credential_from_data(index, data)
 
 
 def find_by_rp_id_hash(rp_id_hash: bytes) -> Iterator[Fido2Credential]:
-    for index in range(MAX_RESIDENT_CREDENTIALS):
+    for index in storage.resident_credentials.find_by_prefix(rp_id_hash):
         data = storage.resident_credentials.get(index)
 
         if data is None:
@@ -55,12 +55,10 @@ def get_resident_credential(index: int) -> Optional[Fido2Credential]:
 
 def store_resident_credential(cred: Fido2Credential) -> bool:
     slot = None
-    for index in range(MAX_RESIDENT_CREDENTIALS):
+    used = storage.resident_credentials.indices()
+    for index in storage.resident_credentials.find_by_prefix(cred.rp_id_hash):
         stored_data = storage.resident_credentials.get(index)
         if stored_data is None:
-            # found candidate empty slot
-            if slot is None:
-                slot = index
             continue
 
         if cred.rp_id_hash != stored_data[:RP_ID_HASH_LENGTH]:
@@ -73,6 +71,13 @@ def store_resident_credential(cred: Fido2Credential) -> bool:
             slot = index
             break
 
+    if slot is None:
+        # use the first empty slot
+        for index in range(MAX_RESIDENT_CREDENTIALS):
+            if index not in used:
+                slot = index
+                break
+
     if slot is None:
         return False
 
@@ -17,6 +17,7 @@ async def bootscreen() -> None:
                 await lockscreen
             await verify_user_pin()
             storage.init_unlocked()
+            utils.boottime_mark(utils.BOOTTIME_STORAGE_UNLOCKED)
             return
         except wire.PinCancelled:
             # verify_user_pin will convert a SdCardUnavailable (in case of sd salt)
@@ -6,7 +6,17 @@ bytes, string, embedded message and repeated fields.
 from micropython import const
 
 if False:
-    from typing import Any, Dict, Iterable, List, Optional, Type, TypeVar, Union
+    from typing import (
+        Any,
+        Dict,
+        Iterable,
+        Iterator,
+        List,
+        Optional,
+        Type,
+        TypeVar,
+        Union,
+    )
     from typing_extensions import Protocol
 
     class AsyncReader(Protocol):
@@ -41,13 +51,26 @@ async def load_uvarint(reader: AsyncReader) -> int:
 async def dump_uvarint(writer: AsyncWriter, n: int) -> None:
     if n < 0:
         raise ValueError("Cannot dump signed value, convert it to unsigned first.")
-    buffer = _UVARINT_BUFFER
+    if n <= 0x7F:
+        # single byte, the common case of field keys and small values
+        buffer = _UVARINT_BUFFER
+        buffer[0] = n
+        await writer.awrite(buffer)
+        return
+    # encode the whole varint first and write it at once.  the buffer is not
+    # shared, the writer can yield before it consumes all of it
+    nbytes = 1
+    while n >> (7 * nbytes):
+        nbytes += 1
+    buffer = bytearray(nbytes)
+    i = 0
     shifted = 1
     while shifted:
         shifted = n >> 7
-        buffer[0] = (n & 0x7F) | (0x80 if shifted else 0x00)
-        await writer.awrite(buffer)
+        buffer[i] = (n & 0x7F) | (0x80 if shifted else 0x00)
+        i += 1
         n = shifted
+    await writer.awrite(buffer)
 
 
 def count_uvarint(n: int) -> int:
@@ -178,15 +201,93 @@ class LimitedReader:
             return nread
 
 
+class BufferReader:
+    """
+    Reader over a buffer in memory.  Never suspends, a message can be loaded
+    from it with `load_message_sync`.
+    """
+
+    def __init__(self, buf: bytes) -> None:
+        self.buf = buf
+        self.ofs = 0
+
+    async def areadinto(self, buf: bytearray) -> int:
+        end = self.ofs + len(buf)
+        if end > len(self.buf):
+            raise EOFError
+        buf[:] = self.buf[self.ofs : end]
+        self.ofs = end
+        return len(buf)
+
+
 FLAG_REPEATED = const(1)
 
 if False:
     LoadedMessageType = TypeVar("LoadedMessageType", bound=MessageType)
 
 
+class LazyRepeated:
+    """
+    Repeated embedded message or bytes field of a message loaded with
+    `lazy=True`.  The encoded entries are kept together in one buffer and an
+    entry is decoded every time it is accessed, so only the entries a handler
+    actually uses are turned into objects.  Supports `len()`, indexing,
+    slicing and iteration like a list.
+    """
+
+    def __init__(self, ftype: Any) -> None:
+        self.ftype = ftype
+        self.buf = bytearray()
+        self.ends = []  # type: List[int]
+
+    async def aload(self, reader: AsyncReader, size: int) -> None:
+        start = len(self.buf)
+        self.buf.extend(bytes(size))
+        await reader.areadinto(memoryview(self.buf)[start:])
+        self.ends.append(len(self.buf))
+
+    def __len__(self) -> int:
+        return len(self.ends)
+
+    def __getitem__(self, i: Any) -> Any:
+        if not isinstance(i, int):
+            return list(self)[i]
+        if i < 0:
+            i += len(self.ends)
+        end = self.ends[i]
+        start = self.ends[i - 1] if i > 0 else 0
+        data = memoryview(self.buf)[start:end]
+        if self.ftype is BytesType:
+            return bytearray(data)
+        return load_message_sync(data, self.ftype)
+
+    def __iter__(self) -> Iterator[Any]:
+        for i in range(len(self.ends)):
+            yield self[i]
+
+    def __eq__(self, rhs: Any) -> bool:
+        return list(self) == list(rhs)
+
+
+def load_message_sync(
+    buf: bytes, msg_type: Type[LoadedMessageType]
+) -> LoadedMessageType:
+    task = load_message(BufferReader(buf), msg_type)
+    try:
+        task.send(None)
+    except StopIteration as e:
+        return e.value
+    raise RuntimeError  # BufferReader never suspends
+
+
 async def load_message(
-    reader: AsyncReader, msg_type: Type[LoadedMessageType]
+    reader: AsyncReader, msg_type: Type[LoadedMessageType], lazy: bool = False
 ) -> LoadedMessageType:
+    """
+    Decodes a message from `reader`.  With `lazy`, repeated embedded message
+    and bytes fields, also of the embedded messages, are loaded as
+    `LazyRepeated` instead of lists.
+    """
     fields = msg_type.get_fields()
     msg = msg_type()
 
@@ -222,6 +323,14 @@ async def load_message(
 
         ivalue = await load_uvarint(reader)
 
+        if lazy and fflags & FLAG_REPEATED and wtype == 2 and ftype is not UnicodeType:
+            pvalue = getattr(msg, fname, None)
+            if not isinstance(pvalue, LazyRepeated):
+                pvalue = LazyRepeated(ftype)
+                setattr(msg, fname, pvalue)
+            await pvalue.aload(reader, ivalue)
+            continue
+
         if ftype is UVarintType:
             fvalue = ivalue
         elif ftype is SVarintType:
@@ -238,7 +347,7 @@ async def load_message(
             await reader.areadinto(fvalue)
             fvalue = bytes(fvalue).decode()
         elif issubclass(ftype, MessageType):
-            fvalue = await load_message(LimitedReader(reader, ivalue), ftype)
+            fvalue = await load_message(LimitedReader(reader, ivalue), ftype, lazy)
         else:
             raise TypeError  # field type is unknown
 
@@ -10,9 +10,12 @@ _SESSIONLESS_FLAG = 128
 APP_COMMON_SEED = 0
 APP_CARDANO_ROOT = 1
 APP_MONERO_LIVE_REFRESH = 2
+APP_COMMON_KEYCHAIN_ROOTS = 3
+APP_MISC_ECDH_SESSION_KEYS = 4
 
 # Keys that are valid across sessions
 APP_COMMON_SEED_WITHOUT_PASSPHRASE = 1 | _SESSIONLESS_FLAG
+APP_WEBAUTHN_RESIDENT_INDEX = 2 | _SESSIONLESS_FLAG
 
 
 _active_session_id = None  # type: Optional[bytes]
@@ -72,6 +75,20 @@ def get(key: int) -> Any:
     return _caches[_active_session_id].get(key)
 
 
+def pop_all(key: int) -> List[Any]:
+    """Remove the key from every session and return the removed values."""
+    values = []
+    if key & _SESSIONLESS_FLAG:
+        caches = [_sessionless_cache]
+    else:
+        caches = list(_caches.values())
+    for c in caches:
+        value = c.pop(key, None)
+        if value is not None:
+            values.append(value)
+    return values
+
+
 def stored(key: int) -> Callable[[F], F]:
     def decorator(func: F) -> F:
         # if we didn't check this, it would be easy to store an Awaitable[something]
@@ -109,6 +126,17 @@ def stored_async(key: int) -> Callable[[F], F]:
     return decorator
 
 
+def clear_sessions() -> None:
+    """
+    Forget the values cached in all sessions, e.g. the passphrase-derived seeds,
+    together with the seed without passphrase. The session ids stay valid, so a
+    host resuming its session is asked for the passphrase again.
+    """
+    for c in _caches.values():
+        c.clear()
+    _sessionless_cache.pop(APP_COMMON_SEED_WITHOUT_PASSPHRASE, None)
+
+
 def clear_all() -> None:
     global _active_session_id
     global _caches
@@ -3,7 +3,7 @@ from micropython import const
 from trezor import config
 
 if False:
-    from typing import Optional
+    from typing import Dict, List, Optional
 
 # Namespaces:
 # fmt: off
@@ -11,6 +11,7 @@ APP_DEVICE             = const(0x01)
 APP_RECOVERY           = const(0x02)
 APP_RECOVERY_SHARES    = const(0x03)
 APP_WEBAUTHN           = const(0x04)
+APP_DERIVED            = const(0x05)
 # fmt: on
 
 _FALSE_BYTE = b"\x00"
@@ -24,6 +25,10 @@ def set(app: int, key: int, data: bytes, public: bool = False) -> None:
     config.set(app, key, data, public)
 
 
+def set_many(app: int, values: Dict[int, bytes], public: bool = False) -> None:
+    config.set_many(app, values, public)
+
+
 def get(app: int, key: int, public: bool = False) -> Optional[bytes]:
     return config.get(app, key, public)
 
@@ -32,6 +37,10 @@ def delete(app: int, key: int, public: bool = False) -> None:
     config.delete(app, key, public)
 
 
+def keys(app: int, public: bool = False) -> List[int]:
+    return config.iter(app, public)
+
+
 def set_true_or_delete(app: int, key: int, value: bool) -> None:
     if value:
         set_bool(app, key, value)
@@ -0,0 +1,29 @@
+from micropython import const
+
+from storage import common
+
+if False:
+    from typing import Optional
+
+# Results of slow derivations from the seed, kept across reboots. The entries
+# are private, so they are encrypted with the storage key, and they are wiped
+# whenever the seed changes. Only the wallet without a passphrase is stored,
+# a hidden wallet must not leave anything behind in the flash.
+
+_NAMESPACE = common.APP_DERIVED
+
+# fmt: off
+_CARDANO_ROOT           = const(0x00)  # bytes
+# fmt: on
+
+
+def get_cardano_root() -> Optional[bytes]:
+    return common.get(_NAMESPACE, _CARDANO_ROOT)
+
+
+def set_cardano_root(data: bytes) -> None:
+    common.set(_NAMESPACE, _CARDANO_ROOT, data)
+
+
+def wipe() -> None:
+    common.delete(_NAMESPACE, _CARDANO_ROOT)
@@ -1,7 +1,7 @@
 from micropython import const
 from ubinascii import hexlify
 
-from storage import common
+from storage import common, derived
 from trezor.crypto import random
 from trezor.messages import BackupType
 
@@ -124,9 +124,16 @@ def store_mnemonic_secret(
     needs_backup: bool = False,
     no_backup: bool = False,
 ) -> None:
-    set_version(common.STORAGE_VERSION_CURRENT)
-    common.set(_NAMESPACE, _MNEMONIC_SECRET, secret)
-    common.set_uint8(_NAMESPACE, _BACKUP_TYPE, backup_type)
+    # whatever was derived from the previous seed is no longer valid
+    derived.wipe()
+    common.set_many(
+        _NAMESPACE,
+        {
+            _VERSION: common.STORAGE_VERSION_CURRENT,
+            _MNEMONIC_SECRET: secret,
+            _BACKUP_TYPE: backup_type.to_bytes(1, "big"),
+        },
+    )
     common.set_true_or_delete(_NAMESPACE, _NO_BACKUP, no_backup)
     common.set_bool(_NAMESPACE, INITIALIZED, True, public=True)
     if not no_backup:
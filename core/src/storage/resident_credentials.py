@@ -1,15 +1,45 @@
 from micropython import const
 
-from storage import common
+from storage import cache, common
 
 if False:
-    from typing import Optional
+    from typing import Dict, List, Optional
 
 
 _RESIDENT_CREDENTIAL_START_KEY = const(1)
 
 MAX_RESIDENT_CREDENTIALS = const(100)
 
+# Number of leading bytes of the stored data that are kept in the index.  The
+# data starts with the rp_id_hash of the credential.
+_INDEX_TAG_LENGTH = const(4)
+
+
+def _index() -> Dict[int, bytes]:
+    """
+    Maps used slots to the leading bytes of their data.  Built by reading every
+    slot on first use and kept in the sessionless cache, so that a lookup by
+    rp_id_hash does not have to read and decrypt every stored credential.
+    """
+    index = cache.get(cache.APP_WEBAUTHN_RESIDENT_INDEX)
+    if index is None:
+        index = {}
+        for i in indices():
+            data = get(i)
+            if data is not None:
+                index[i] = data[:_INDEX_TAG_LENGTH]
+        cache.set(cache.APP_WEBAUTHN_RESIDENT_INDEX, index)
+    return index
+
+
+def find_by_prefix(prefix: bytes) -> List[int]:
+    """
+    Returns the used slots whose data may start with `prefix`.  Only the
+    leading bytes are compared, the caller has to check the full data.
+    """
+    tag = prefix[:_INDEX_TAG_LENGTH]
+    return [i for i, t in _index().items() if t == tag]
+
 
 def get(index: int) -> Optional[bytes]:
     if not (0 <= index < MAX_RESIDENT_CREDENTIALS):
@@ -18,11 +48,23 @@ def get(index: int) -> Optional[bytes]:
     return common.get(common.APP_WEBAUTHN, index + _RESIDENT_CREDENTIAL_START_KEY)
 
 
+def indices() -> List[int]:
+    start = _RESIDENT_CREDENTIAL_START_KEY
+    return [
+        key - start
+        for key in common.keys(common.APP_WEBAUTHN)
+        if start <= key < start + MAX_RESIDENT_CREDENTIALS
+    ]
+
+
 def set(index: int, data: bytes) -> None:
     if not (0 <= index < MAX_RESIDENT_CREDENTIALS):
         raise ValueError  # invalid credential index
 
     common.set(common.APP_WEBAUTHN, index + _RESIDENT_CREDENTIAL_START_KEY, data)
+    cached = cache.get(cache.APP_WEBAUTHN_RESIDENT_INDEX)
+    if cached is not None:
+        cached[index] = data[:_INDEX_TAG_LENGTH]
 
 
 def delete(index: int) -> None:
@@ -30,8 +72,12 @@ def delete(index: int) -> None:
         raise ValueError  # invalid credential index
 
     common.delete(common.APP_WEBAUTHN, index + _RESIDENT_CREDENTIAL_START_KEY)
+    cached = cache.get(cache.APP_WEBAUTHN_RESIDENT_INDEX)
+    if cached is not None:
+        cached.pop(index, None)
 
 
 def delete_all() -> None:
-    for i in range(MAX_RESIDENT_CREDENTIALS):
+    for i in indices():
         common.delete(common.APP_WEBAUTHN, i + _RESIDENT_CREDENTIAL_START_KEY)
+    cache.set(cache.APP_WEBAUTHN_RESIDENT_INDEX, {})
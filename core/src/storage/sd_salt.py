@@ -8,14 +8,21 @@ from trezor.sdcard import with_filesystem
 from trezor.utils import consteq
 
 if False:
-    from typing import Optional, TypeVar, Callable
+    from typing import Optional, Tuple, TypeVar, Callable
 
     T = TypeVar("T", bound=Callable)
 
 SD_CARD_HOT_SWAPPABLE = False
+# Keep the verified salt in RAM until power off, so that unlocking the device
+# again does not need the SD card. Note that the card is then not required to
+# unlock a device which was locked without being powered off.
+SD_SALT_CACHE = False
 SD_SALT_LEN_BYTES = const(32)
 SD_SALT_AUTH_TAG_LEN_BYTES = const(16)
 
+# The salt authentication key and the salt loaded with it, see SD_SALT_CACHE.
+_cached_salt = None  # type: Optional[Tuple[bytes, bytes]]
+
 
 class WrongSdCard(Exception):
     pass
@@ -38,32 +45,58 @@ def _get_salt_path(new: bool = False) -> str:
     return "{}/salt{}".format(_get_device_dir(), ".new" if new else "")
 
 
-@with_filesystem
 def _load_salt(auth_key: bytes, path: str) -> Optional[bytearray]:
-    # Load the salt file if it exists.
+    # Load the salt file if it exists. The salt and the tag are read at once.
+    data = bytearray(SD_SALT_LEN_BYTES + SD_SALT_AUTH_TAG_LEN_BYTES)
     try:
         with fatfs.open(path, "r") as f:
-            salt = bytearray(SD_SALT_LEN_BYTES)
-            stored_tag = bytearray(SD_SALT_AUTH_TAG_LEN_BYTES)
-            f.read(salt)
-            f.read(stored_tag)
+            if f.read(data) != len(data):
+                return None
     except fatfs.FatFSError:
         return None
 
     # Check the salt's authentication tag.
+    salt = data[:SD_SALT_LEN_BYTES]
     computed_tag = compute_auth_tag(salt, auth_key)
-    if not consteq(computed_tag, stored_tag):
+    if not consteq(computed_tag, data[SD_SALT_LEN_BYTES:]):
         return None
 
     return salt
 
 
-@with_filesystem
+def _set_cached_salt(auth_key: Optional[bytes], salt: Optional[bytes]) -> None:
+    global _cached_salt
+    if SD_SALT_CACHE and auth_key is not None and salt is not None:
+        _cached_salt = (auth_key, bytes(salt))
+    else:
+        _cached_salt = None
+
+
+def load_cached_sd_salt() -> Optional[bytearray]:
+    salt_auth_key = storage.device.get_sd_salt_auth_key()
+    if salt_auth_key is None or _cached_salt is None:
+        return None
+    if not consteq(_cached_salt[0], salt_auth_key):
+        return None
+    return bytearray(_cached_salt[1])
+
+
 def load_sd_salt() -> Optional[bytearray]:
     salt_auth_key = storage.device.get_sd_salt_auth_key()
     if salt_auth_key is None:
         return None
 
+    salt = load_cached_sd_salt()
+    if salt is not None:
+        return salt
+
+    salt = _load_sd_salt(salt_auth_key)
+    _set_cached_salt(salt_auth_key, salt)
+    return salt
+
+
+@with_filesystem
+def _load_sd_salt(salt_auth_key: bytes) -> bytearray:
     salt_path = _get_salt_path()
     new_salt_path = _get_salt_path(new=True)
 
@@ -93,6 +126,7 @@ def load_sd_salt() -> Optional[bytearray]:
 
 @with_filesystem
 def set_sd_salt(salt: bytes, salt_tag: bytes, stage: bool = False) -> None:
+    _set_cached_salt(None, None)
     salt_path = _get_salt_path(stage)
     fatfs.mkdir("/trezor", True)
     fatfs.mkdir(_get_device_dir(), True)
@@ -103,6 +137,7 @@ def set_sd_salt(salt: bytes, salt_tag: bytes, stage: bool = False) -> None:
 
 @with_filesystem
 def commit_sd_salt() -> None:
+    _set_cached_salt(None, None)
     salt_path = _get_salt_path(new=False)
     new_salt_path = _get_salt_path(new=True)
 
@@ -115,6 +150,7 @@ def commit_sd_salt() -> None:
 
 @with_filesystem
 def remove_sd_salt() -> None:
+    _set_cached_salt(None, None)
     salt_path = _get_salt_path()
     # TODO Possibly overwrite salt file with random data.
     fatfs.unlink(salt_path)
@@ -6,6 +6,7 @@ from trezorcrypto import (  # noqa: F401
     crc,
     pbkdf2,
     random,
+    sighash143,
 )
 
 from trezor import utils
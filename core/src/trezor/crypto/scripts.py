@@ -1,10 +1,10 @@
-from trezor.crypto.hashlib import blake256, ripemd160, sha256
+from trezorcrypto import hash160
+
+from trezor.crypto.hashlib import blake256, ripemd160
 
 
 def sha256_ripemd160_digest(b: bytes) -> bytes:
-    h = sha256(b).digest()
-    h = ripemd160(h).digest()
-    return h
+    return hash160(b)
 
 
 def blake256_ripemd160_digest(b: bytes) -> bytes:
@@ -20,8 +20,9 @@
 
 """
 This implements the high-level functions for SLIP-39, also called "Shamir Backup".
-It uses crypto/shamir.c for the cryptographic operations and crypto.slip39.c for
-performance-heavy operations (mostly regarding the wordlist).
+It uses crypto/shamir.c for the cryptographic operations and crypto/slip39.c for
+performance-heavy operations (the wordlist, the RS1024 checksum and the Feistel
+network applying the passphrase).
 
 This consideres the Encrypted Master Secret, as defined in SLIP-39, as what is
 stored in the storage, then "decrypted" using a passphrase into a Master Secret,
@@ -33,7 +34,7 @@ See https://github.com/satoshilabs/slips/blob/master/slip-0039.md.
 from micropython import const
 from trezorcrypto import shamir, slip39
 
-from trezor.crypto import hashlib, hmac, pbkdf2, random
+from trezor.crypto import hashlib, hmac, random
 from trezor.errors import MnemonicError
 
 if False:
@@ -58,10 +59,6 @@ def _bits_to_words(n: int) -> int:
     return (n + _RADIX_BITS - 1) // _RADIX_BITS
 
 
-def _xor(a: bytes, b: bytes) -> bytes:
-    return bytes(x ^ y for x, y in zip(a, b))
-
-
 """
 ## Constants
 """
@@ -93,12 +90,6 @@ _MIN_STRENGTH_BITS = const(128)
 _MIN_MNEMONIC_LENGTH_WORDS = _METADATA_LENGTH_WORDS + _bits_to_words(_MIN_STRENGTH_BITS)
 """The minimum allowed length of the mnemonic in words."""
 
-_BASE_ITERATION_COUNT = const(10000)
-"""The minimum number of iterations to use in PBKDF2."""
-
-_ROUND_COUNT = const(4)
-"""The number of rounds to use in the Feistel cipher."""
-
 _SECRET_INDEX = const(255)
 """The index of the share containing the shared secret."""
 
@@ -176,15 +167,9 @@ def decrypt(
     here, because passphrase function is symmetric in SLIP-39. We are using the terms
     "encrypt" and "decrypt" instead.
     """
-    l = encrypted_master_secret[: len(encrypted_master_secret) // 2]
-    r = encrypted_master_secret[len(encrypted_master_secret) // 2 :]
-    salt = _get_salt(identifier)
-    for i in reversed(range(_ROUND_COUNT)):
-        (l, r) = (
-            r,
-            _xor(l, _round_function(i, passphrase, iteration_exponent, salt, r)),
-        )
-    return r + l
+    return slip39.decrypt(
+        encrypted_master_secret, passphrase, iteration_exponent, identifier
+    )
 
 
 def generate_random_identifier() -> int:
@@ -390,11 +375,7 @@ def _rs1024_create_checksum(data: Indices) -> Indices:
     detection of any error affecting at most 3 words and has less than a 1 in 10^9
     chance of failing to detect more errors.
     """
-    values = tuple(_CUSTOMIZATION_STRING) + data + _CHECKSUM_LENGTH_WORDS * (0,)
-    polymod = _rs1024_polymod(values) ^ 1
-    return tuple(
-        (polymod >> 10 * i) & 1023 for i in reversed(range(_CHECKSUM_LENGTH_WORDS))
-    )
+    return slip39.rs1024_create_checksum(data)
 
 
 def _rs1024_polymod(values: Indices) -> int:
@@ -423,7 +404,7 @@ def _rs1024_verify_checksum(data: Indices) -> bool:
     """
     Verifies a checksum of the given mnemonic, which was already parsed into Indices.
     """
-    return _rs1024_polymod(tuple(_CUSTOMIZATION_STRING) + data) == 1
+    return slip39.rs1024_verify_checksum(data)
 
 
 def _rs1024_error_index(data: Indices) -> Optional[int]:
@@ -462,22 +443,6 @@ def _rs1024_error_index(data: Indices) -> Optional[int]:
 """
 
 
-def _round_function(i: int, passphrase: bytes, e: int, salt: bytes, r: bytes) -> bytes:
-    """The round function used internally by the Feistel cipher."""
-    return pbkdf2(
-        pbkdf2.HMAC_SHA256,
-        bytes([i]) + passphrase,
-        salt + r,
-        (_BASE_ITERATION_COUNT << e) // _ROUND_COUNT,
-    ).key()[: len(r)]
-
-
-def _get_salt(identifier: int) -> bytes:
-    return _CUSTOMIZATION_STRING + identifier.to_bytes(
-        _bits_to_bytes(_ID_LENGTH_BITS), "big"
-    )
-
-
 def _create_digest(random_data: bytes, shared_secret: bytes) -> bytes:
     return hmac.new(random_data, shared_secret, hashlib.sha256).digest()[
         :_DIGEST_LENGTH_BYTES
@@ -522,8 +487,9 @@ def _split_secret(
         (_SECRET_INDEX, shared_secret),
     ]
 
-    for i in range(random_share_count, share_count):
-        shares.append((i, shamir.interpolate(base_shares, i)))
+    indices = list(range(random_share_count, share_count))
+    values = shamir.interpolate_multi(base_shares, indices)
+    shares.extend(zip(indices, values))
 
     return shares
 
@@ -533,8 +499,9 @@ def _recover_secret(threshold: int, shares: List[Tuple[int, bytes]]) -> bytes:
     if threshold == 1:
         return shares[0][1]
 
-    shared_secret = shamir.interpolate(shares, _SECRET_INDEX)
-    digest_share = shamir.interpolate(shares, _DIGEST_INDEX)
+    shared_secret, digest_share = shamir.interpolate_multi(
+        shares, (_SECRET_INDEX, _DIGEST_INDEX)
+    )
     digest = digest_share[:_DIGEST_LENGTH_BYTES]
     random_part = digest_share[_DIGEST_LENGTH_BYTES:]
 
@@ -5,10 +5,15 @@ stepped through until completion, and can get asynchronously blocked by
 `yield`ing or `await`ing a syscall.
 
 See `schedule`, `run`, and syscalls `sleep`, `wait`, `signal` and `race`.
+
+Background work that must not delay anything else runs at idle priority, see
+`schedule_idle` and the `idle` syscall.
 """
 
+import gc
 import utime
 import utimeq
+from micropython import const
 
 from trezor import io, log
 
@@ -32,18 +37,45 @@ if False:
 # function to call after every task step
 after_step_hook = None  # type: Optional[Callable[[], None]]
 
+if __debug__:
+    # function to call after every task step, used for workflow statistics
+    stats_hook = None  # type: Optional[Callable[[], None]]
+
 # tasks scheduled for execution in the future
 _queue = utimeq.utimeq(64)
 
 # tasks paused on I/O
 _paused = {}  # type: Dict[int, Set[Task]]
 
+# tasks stepped only when no interface is ready and no deadline has expired,
+# in a round-robin order
+_idle = []  # type: List[Tuple[Task, Any]]
+
+# time slice of an idle task step, see `idle_expired`
+IDLE_SLICE_MS = const(10)
+_idle_slice_start = 0
+
+# Garbage is collected while the loop waits at least GC_WAIT_MS for a message
+# or a deadline, once GC_ALLOC bytes were allocated since the last collection.
+# The pause is then not noticed by anyone, and the automatic collections that
+# would otherwise interrupt the running tasks become rarer.
+GC_WAIT_MS = const(20)
+GC_ALLOC = const(16 * 1024)
+_gc_heap = 0
+
+# longest of the collections above since boot, in microseconds
+gc_max_pause = 0
+
 # functions to execute after a task is finished
 _finalizers = {}  # type: Dict[int, Finalizer]
 
 # reference to the task that is currently executing
 this_task = None  # type: Optional[Task]
 
+# number of task switches, by what resumed the task: an expired deadline, an
+# I/O message or a synthetic event
+_switches = [0, 0, 0]
+
 if __debug__:
     # synthetic event queue
     synthetic_events = []  # type: List[Tuple[int, Any]]
@@ -80,6 +112,27 @@ def schedule(
     _queue.push(deadline, task, value)
 
 
+def schedule_idle(
+    task: Task, value: Any = None, finalizer: Finalizer = None
+) -> None:
+    """
+    Schedule task to be executed with `value` once there is nothing else to
+    do.  The task should do its work in short steps and `await idle()` in
+    between, so that it never delays the other tasks by much.
+    """
+    if finalizer is not None:
+        _finalizers[id(task)] = finalizer
+    _idle.append((task, value))
+
+
+def idle_expired() -> bool:
+    """
+    Return True once the running idle task has used up its time slice and
+    should `await idle()`.
+    """
+    return utime.ticks_diff(utime.ticks_ms(), _idle_slice_start) >= IDLE_SLICE_MS
+
+
 def pause(task: Task, iface: int) -> None:
     """
     Block task on given message interface.  Task is resumed when the interface
@@ -107,6 +160,10 @@ def close(task: Task) -> None:
     for iface in _paused:
         _paused[iface].discard(task)
     _queue.discard(task)
+    for i, entry in enumerate(_idle):
+        if entry[0] is task:
+            _idle.pop(i)
+            break
     task.close()
     finalize(task, GeneratorExit())
 
@@ -118,14 +175,20 @@ def run() -> None:
     Tasks yield back to the scheduler on any I/O, usually by calling `await` on
     a `Syscall`.
     """
+    global _idle_slice_start
+
     task_entry = [0, 0, 0]  # deadline, task, value
     msg_entry = [0, 0]  # iface | flags, value
-    while _queue or _paused:
+    while _queue or _paused or _idle:
         # compute the maximum amount of time we can wait for a message
         if _queue:
             delay = utime.ticks_diff(_queue.peektime(), utime.ticks_ms())
         else:
             delay = 1000  # wait for 1 sec maximum if queue is empty
+        if _idle and delay > 0:
+            delay = 0  # only poll, idle tasks are waiting for their turn
+        elif delay >= GC_WAIT_MS and _collect_waiting():
+            continue  # the collection took some of the time, start over
 
         if __debug__:
             # process synthetic events
@@ -134,21 +197,57 @@ def run() -> None:
                 msg_tasks = _paused.pop(iface, ())
                 if msg_tasks:
                     synthetic_events.pop(0)
+                    _switches[2] += len(msg_tasks)
                     for task in msg_tasks:
                         _step(task, event)
 
         if io.poll(_paused, msg_entry, delay):
             # message received, run tasks paused on the interface
             msg_tasks = _paused.pop(msg_entry[0], ())
+            _switches[1] += len(msg_tasks)
             for task in msg_tasks:
                 _step(task, msg_entry[1])
-        else:
+        elif _queue and (
+            not _idle
+            or utime.ticks_diff(_queue.peektime(), utime.ticks_ms()) <= 0
+        ):
             # timeout occurred, run the first scheduled task
-            if _queue:
-                _queue.pop(task_entry)
-                _step(task_entry[1], task_entry[2])  # type: ignore
-                # error: Argument 1 to "_step" has incompatible type "int"; expected "Coroutine[Any, Any, Any]"
-                # rationale: We use untyped lists here, because that is what the C API supports.
+            _queue.pop(task_entry)
+            _switches[0] += 1
+            _step(task_entry[1], task_entry[2])  # type: ignore
+            # error: Argument 1 to "_step" has incompatible type "int"; expected "Coroutine[Any, Any, Any]"
+            # rationale: We use untyped lists here, because that is what the C API supports.
+        elif _idle:
+            # nothing else to do, give the next idle task a time slice
+            task, value = _idle.pop(0)
+            _idle_slice_start = utime.ticks_ms()
+            _step(task, value)
+
+
+def _collect_waiting() -> bool:
+    global _gc_heap, gc_max_pause
+
+    heap = gc.mem_alloc()
+    if heap < _gc_heap:
+        # an automatic collection happened in the meantime
+        _gc_heap = heap
+    if heap - _gc_heap < GC_ALLOC:
+        return False
+    start = utime.ticks_us()
+    gc.collect()
+    pause = utime.ticks_diff(utime.ticks_us(), start)
+    if pause > gc_max_pause:
+        gc_max_pause = pause
+    _gc_heap = gc.mem_alloc()
+    return True
+
+
+def task_switches() -> Tuple[int, int, int]:
+    """
+    Return the number of task steps since boot, split by what resumed the task:
+    an expired deadline, an I/O message and a synthetic event.
+    """
+    return _switches[0], _switches[1], _switches[2]
 
 
 def clear() -> None:
@@ -157,6 +256,7 @@ def clear() -> None:
     while _queue:
         _queue.pop(_)
     _paused.clear()
+    _idle.clear()
     _finalizers.clear()
 
 
@@ -203,6 +303,8 @@ def _step(task: Task, value: Any) -> None:
                 log.error(__name__, "unknown syscall: %s", result)
         if after_step_hook:
             after_step_hook()
+        if __debug__ and stats_hook:
+            stats_hook()
 
 
 class Syscall:
@@ -245,6 +347,23 @@ class sleep(Syscall):
         schedule(task, deadline, deadline)
 
 
+class idle(Syscall):
+    """
+    Pause current task and resume it once no interface is ready and no
+    deadline has expired, after the other idle tasks had their turn.
+
+    Example:
+
+    >>> for chunk in work:
+    >>>     process(chunk)
+    >>>     if loop.idle_expired():
+    >>>         await loop.idle()
+    """
+
+    def handle(self, task: Task) -> None:
+        _idle.append((task, None))
+
+
 class wait(Syscall):
     """
     Pause current task, and resume only after a message on `msg_iface` is
@@ -0,0 +1,26 @@
+# Automatically generated by pb2py
+# fmt: off
+import protobuf as p
+
+if __debug__:
+    try:
+        from typing import Dict, List  # noqa: F401
+        from typing_extensions import Literal  # noqa: F401
+    except ImportError:
+        pass
+
+
+class Addresses(p.MessageType):
+    MESSAGE_WIRE_TYPE = 52
+
+    def __init__(
+        self,
+        addresses: List[str] = None,
+    ) -> None:
+        self.addresses = addresses if addresses is not None else []
+
+    @classmethod
+    def get_fields(cls) -> Dict:
+        return {
+            1: ('addresses', p.UnicodeType, p.FLAG_REPEATED),
+        }
@@ -2,6 +2,9 @@
 # fmt: off
 import protobuf as p
 
+from .CardanoTxInputType import CardanoTxInputType
+from .CardanoTxOutputType import CardanoTxOutputType
+
 if __debug__:
     try:
         from typing import Dict, List  # noqa: F401
@@ -16,11 +19,17 @@ class CardanoTxAck(p.MessageType):
     def __init__(
         self,
         transaction: bytes = None,
+        input: CardanoTxInputType = None,
+        output: CardanoTxOutputType = None,
     ) -> None:
         self.transaction = transaction
+        self.input = input
+        self.output = output
 
     @classmethod
     def get_fields(cls) -> Dict:
         return {
             1: ('transaction', p.BytesType, 0),
+            2: ('input', CardanoTxInputType, 0),
+            3: ('output', CardanoTxOutputType, 0),
         }
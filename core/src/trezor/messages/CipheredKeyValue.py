@@ -16,11 +16,14 @@ class CipheredKeyValue(p.MessageType):
     def __init__(
         self,
         value: bytes = None,
+        values: List[bytes] = None,
     ) -> None:
         self.value = value
+        self.values = values if values is not None else []
 
     @classmethod
     def get_fields(cls) -> Dict:
         return {
             1: ('value', p.BytesType, 0),
+            2: ('values', p.BytesType, p.FLAG_REPEATED),
         }
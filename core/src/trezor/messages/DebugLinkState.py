@@ -30,6 +30,13 @@ class DebugLinkState(p.MessageType):
         reset_word_pos: int = None,
         mnemonic_type: int = None,
         layout_lines: List[str] = None,
+        boot_times: List[int] = None,
+        workflow_peak_heap: int = None,
+        workflow_gc_count: int = None,
+        workflow_gc_time: int = None,
+        screen_hash: bytes = None,
+        trace: bytes = None,
+        gc_max_pause: int = None,
     ) -> None:
         self.layout = layout
         self.pin = pin
@@ -44,6 +51,13 @@ class DebugLinkState(p.MessageType):
         self.reset_word_pos = reset_word_pos
         self.mnemonic_type = mnemonic_type
         self.layout_lines = layout_lines if layout_lines is not None else []
+        self.boot_times = boot_times if boot_times is not None else []
+        self.workflow_peak_heap = workflow_peak_heap
+        self.workflow_gc_count = workflow_gc_count
+        self.workflow_gc_time = workflow_gc_time
+        self.screen_hash = screen_hash
+        self.trace = trace
+        self.gc_max_pause = gc_max_pause
 
     @classmethod
     def get_fields(cls) -> Dict:
@@ -61,4 +75,11 @@ class DebugLinkState(p.MessageType):
             11: ('reset_word_pos', p.UVarintType, 0),
             12: ('mnemonic_type', p.UVarintType, 0),
             13: ('layout_lines', p.UnicodeType, p.FLAG_REPEATED),
+            14: ('boot_times', p.UVarintType, p.FLAG_REPEATED),
+            15: ('workflow_peak_heap', p.UVarintType, 0),
+            16: ('workflow_gc_count', p.UVarintType, 0),
+            17: ('workflow_gc_time', p.UVarintType, 0),
+            18: ('screen_hash', p.BytesType, 0),
+            19: ('trace', p.BytesType, 0),
+            20: ('gc_max_pause', p.UVarintType, 0),
         }
@@ -16,11 +16,14 @@ class DebugLinkWatchLayout(p.MessageType):
     def __init__(
         self,
         watch: bool = None,
+        push: bool = None,
     ) -> None:
         self.watch = watch
+        self.push = push
 
     @classmethod
     def get_fields(cls) -> Dict:
         return {
             1: ('watch', p.BoolType, 0),
+            2: ('push', p.BoolType, 0),
         }
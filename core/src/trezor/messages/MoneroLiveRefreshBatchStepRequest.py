@@ -0,0 +1,28 @@
+# Automatically generated by pb2py
+# fmt: off
+import protobuf as p
+
+from .MoneroLiveRefreshStepRequest import MoneroLiveRefreshStepRequest
+
+if __debug__:
+    try:
+        from typing import Dict, List  # noqa: F401
+        from typing_extensions import Literal  # noqa: F401
+    except ImportError:
+        pass
+
+
+class MoneroLiveRefreshBatchStepRequest(p.MessageType):
+    MESSAGE_WIRE_TYPE = 558
+
+    def __init__(
+        self,
+        outputs: List[MoneroLiveRefreshStepRequest] = None,
+    ) -> None:
+        self.outputs = outputs if outputs is not None else []
+
+    @classmethod
+    def get_fields(cls) -> Dict:
+        return {
+            1: ('outputs', MoneroLiveRefreshStepRequest, p.FLAG_REPEATED),
+        }
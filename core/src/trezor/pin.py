@@ -44,6 +44,7 @@ def show_pin_timeout(seconds: int, progress: int, message: str) -> bool:
         )
         _previous_seconds = seconds
 
-    ui.refresh()
+    if ui.frame_due():
+        ui.refresh()
     _previous_progress = progress
     return False
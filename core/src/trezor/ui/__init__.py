@@ -55,6 +55,29 @@ else:
 if utils.EMULATOR:
     loop.after_step_hook = refresh
 
+# Frames are rendered at most once per this many milliseconds.  Requests coming
+# sooner are merged into the next frame, see `frame_due`.
+_FRAME_MS = const(10)
+_last_frame_ms = 0
+# number of render and refresh requests merged into a later frame
+frames_dropped = 0
+
+
+def frame_due(force: bool = False) -> bool:
+    """
+    Return True if a frame should be rendered now, or False if the last one is
+    younger than the frame budget.  Dropped requests are picked up by the next
+    frame, since components keep their re-paint marking and the display keeps
+    the drawn pixels.
+    """
+    global _last_frame_ms, frames_dropped
+    now = utime.ticks_ms()
+    if not force and utime.ticks_diff(now, _last_frame_ms) < _FRAME_MS:
+        frames_dropped += 1
+        return False
+    _last_frame_ms = now
+    return True
+
 
 def lerpi(a: int, b: int, t: float) -> int:
     return int(a + t * (b - a))
@@ -134,6 +157,25 @@ def backlight_fade(val: int, delay: int = 14000, step: int = 15) -> None:
         utime.sleep_us(delay)
 
 
+_FADE_DURATION_MS = const(140)
+_FADE_POLL_MS = const(10)
+
+
+def backlight_fade_task(
+    val: int, duration: int = _FADE_DURATION_MS
+) -> Generator[loop.Syscall, Any, None]:
+    """Fade the backlight in the background and wait for it without blocking
+    the event loop, so that other tasks (e.g. USB) keep running."""
+    if __debug__:
+        if utils.DISABLE_ANIMATION:
+            display.backlight(val)
+            return
+    display.backlight_fade(val, duration)
+    poll = loop.sleep(_FADE_POLL_MS)
+    while display.backlight_fading():
+        yield poll
+
+
 def header(
     title: str,
     icon: str = style.ICON_DEFAULT,
@@ -359,13 +401,15 @@ class Layout(Component):
             workflow.idle_timer.touch()
             self.dispatch(event, x, y)
             # We dispatch a render event right after the touch.  Quick and dirty
-            # way to get the lowest input-to-render latency.
-            self.dispatch(RENDER, 0, 0)
+            # way to get the lowest input-to-render latency.  Touches coming in
+            # a burst are rendered by the next frame of `handle_rendering`.
+            if frame_due():
+                self.dispatch(RENDER, 0, 0)
 
     def handle_rendering(self) -> loop.Task:  # type: ignore
         """Task that is rendering the layout in a busy loop."""
         # Before the first render, we dim the display.
-        backlight_fade(style.BACKLIGHT_DIM)
+        yield from backlight_fade_task(style.BACKLIGHT_DIM)
         # Clear the screen of any leftovers, make sure everything is marked for
         # repaint (we can be running the same layout instance multiple times)
         # and paint it.
@@ -384,7 +428,7 @@ class Layout(Component):
         # rendering everything synchronously, so refresh it manually and turn
         # the brightness on again.
         refresh()
-        backlight_fade(self.BACKLIGHT_LEVEL)
+        yield from backlight_fade_task(self.BACKLIGHT_LEVEL)
         sleep = self.RENDER_SLEEP
         while True:
             # Wait for a couple of ms and render the layout again.  Because
@@ -392,6 +436,7 @@ class Layout(Component):
             # display needlessly.  Using `yield` instead of `await` to avoid allocations.
             # TODO: remove the busy loop
             yield sleep
+            frame_due(force=True)
             self.dispatch(RENDER, 0, 0)
 
 
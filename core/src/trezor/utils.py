@@ -1,18 +1,35 @@
 import gc
 import sys
+from micropython import const
 from trezorutils import (  # noqa: F401
     BITCOIN_ONLY,
+    BOOTTIME_APPS_IMPORTED,
+    BOOTTIME_STORAGE_UNLOCKED,
     EMULATOR,
     GITREV,
     MODEL,
     VERSION_MAJOR,
     VERSION_MINOR,
     VERSION_PATCH,
+    boottime,
+    boottime_mark,
     consteq,
+    cycles,
     halt,
+    match_path,
     memcpy,
+    trace,
+    trace_dump,
+    write_uint,
 )
 
+# Spans in the trace are marked by two events with these arguments.
+TRACE_BEGIN = const(0)
+TRACE_END = const(1)
+
+# Tags of the trace events pushed from Python, see utils.trace().
+TRACE_WORKFLOW = const(1)
+
 DISABLE_ANIMATION = 0
 
 if __debug__:
@@ -25,7 +42,7 @@ if __debug__:
         LOG_MEMORY = 0
 
 if False:
-    from typing import Any, Iterable, Iterator, Protocol, TypeVar, Sequence
+    from typing import Any, Iterable, Iterator, Optional, Protocol, TypeVar, Sequence
 
 
 def unimport_begin() -> Iterable[str]:
@@ -73,7 +90,9 @@ def chunks(items: Chunkable, size: int) -> Iterator[Chunkable]:
 if False:
 
     class HashContext(Protocol):
-        def update(self, buf: bytes) -> None:
+        def update(
+            self, buf: bytes, offset: int = 0, length: Optional[int] = None
+        ) -> None:
             ...
 
         def digest(self) -> bytes:
@@ -110,6 +129,61 @@ class HashWriter:
         return self.ctx.digest()
 
 
+class Arena:
+    """
+    Bump allocator handing out slices of one preallocated buffer.
+
+    The MicroPython heap cannot be redirected, so only the buffers requested
+    through `arena_alloc()` come from the arena. They are released in bulk when
+    the `with` block of the arena ends, and must not be used after that.
+    Requests that do not fit fall back to the regular heap.
+    """
+
+    def __init__(self, size: int) -> None:
+        self.buf = memoryview(bytearray(size))
+        self.offset = 0
+        self.prev = None  # type: Optional[Arena]
+
+    def alloc(self, size: int) -> Optional[memoryview]:
+        end = self.offset + size
+        if end > len(self.buf):
+            return None
+        b = self.buf[self.offset : end]
+        self.offset = end
+        return b
+
+    def __enter__(self) -> "Arena":
+        global _arena
+        self.prev = _arena
+        _arena = self
+        return self
+
+    def __exit__(self, exc_type: Any, exc_value: Any, tb: Any) -> None:
+        global _arena
+        _arena = self.prev
+        self.prev = None
+        self.offset = 0
+
+
+_arena = None  # type: Optional[Arena]
+
+
+def arena(size: int) -> Arena:
+    return Arena(size)
+
+
+def arena_alloc(size: int) -> bytearray:
+    """
+    Returns a buffer of `size` bytes, from the innermost active arena if there
+    is one. Unlike a new bytearray, a buffer from an arena is not zeroed.
+    """
+    if _arena is not None:
+        b = _arena.alloc(size)
+        if b is not None:
+            return b  # type: ignore
+    return bytearray(size)
+
+
 def obj_eq(l: object, r: object) -> bool:
     """
     Compares object contents, supports __slots__.
@@ -11,19 +11,20 @@ Handles on-the-wire communication with a host computer. The communication is:
 This module:
 
 1. Provides API for registering messages. In other words binds what functions are invoked
-   when some particular message is received. See the `add` function.
+   when some particular message is received. See the `register` function.
 2. Runs workflows, also called `handlers`, to process the message.
 3. Creates and passes the `Context` object to the handlers. This provides an interface to
    wait, read, write etc. on the wire.
 
-## `add` function
+## `register` function
 
-The `add` function registers what function is invoked when some particular `message_type`
-is received. The following example binds the `apps.wallet.get_address` function with
-the `GetAddress` message:
+The `register` function binds a function that is already imported to some particular
+`message_type`. Handlers of app messages are not registered this way, they are looked up
+by `find_handler` and imported only when their message arrives, see
+`apps/workflow_handlers.py`:
 
 ```python
-wire.add(MessageType.GetAddress, "apps.wallet", "get_address")
+wire.register(MessageType.Ping, handle_Ping)
 ```
 
 ## Session handler
@@ -35,6 +36,8 @@ reads the message's header. When the message type is known the first handler is
 
 """
 
+import utime
+
 import protobuf
 from trezor import log, loop, messages, ui, utils, workflow
 from trezor.messages import FailureType
@@ -55,7 +58,6 @@ if False:
         Dict,
         Iterable,
         Optional,
-        Tuple,
         Type,
         TypeVar,
     )
@@ -69,15 +71,6 @@ if False:
 # Maps a wire type directly to a handler.
 workflow_handlers = {}  # type: Dict[int, Handler]
 
-# Maps a wire type to a tuple of package and module.  This allows handlers
-# to be dynamically imported when such message arrives.
-workflow_packages = {}  # type: Dict[int, Tuple[str, str]]
-
-
-def add(wire_type: int, pkgname: str, modname: str) -> None:
-    """Shortcut for registering a dynamically-imported Protobuf workflow."""
-    workflow_packages[wire_type] = (pkgname, modname)
-
 
 def register(wire_type: int, handler: Handler) -> None:
     """Register `handler` to get scheduled after `wire_type` message is received."""
@@ -92,7 +85,29 @@ def setup(iface: WireInterface, use_workflow: bool = True) -> None:
 def clear() -> None:
     """Remove all registered handlers."""
     workflow_handlers.clear()
-    workflow_packages.clear()
+
+
+if __debug__:
+
+    async def load_message(
+        reader: codec_v1.Reader,
+        msg_type: Type[protobuf.LoadedMessageType],
+        lazy: bool = False,
+    ) -> protobuf.LoadedMessageType:
+        """Decode a message like `protobuf.load_message` and log the time spent."""
+        start = utime.ticks_us()
+        msg = await protobuf.load_message(reader, msg_type, lazy)
+        log.debug(
+            __name__,
+            "%s decoded in %d us",
+            msg_type.__name__,
+            utime.ticks_diff(utime.ticks_us(), start),
+        )
+        return msg
+
+
+else:
+    load_message = protobuf.load_message
 
 
 if False:
@@ -103,10 +118,13 @@ if False:
             self,
             msg: protobuf.MessageType,
             expected_type: Type[protobuf.LoadedMessageType],
+            lazy: bool = False,
         ) -> Any:
             ...
 
-        async def read(self, expected_type: Type[protobuf.LoadedMessageType]) -> Any:
+        async def read(
+            self, expected_type: Type[protobuf.LoadedMessageType], lazy: bool = False
+        ) -> Any:
             ...
 
         async def write(self, msg: protobuf.MessageType) -> None:
@@ -138,13 +156,20 @@ class Context:
     def __init__(self, iface: WireInterface, sid: int) -> None:
         self.iface = iface
         self.sid = sid
+        # Holds a single token. Debuglink writes from a background task as well,
+        # and two messages must not get interleaved on the interface.
+        self.write_lock = loop.chan()
+        self.write_lock.publish(None)
 
     async def call(
-        self, msg: protobuf.MessageType, expected_type: Type[protobuf.LoadedMessageType]
+        self,
+        msg: protobuf.MessageType,
+        expected_type: Type[protobuf.LoadedMessageType],
+        lazy: bool = False,
     ) -> protobuf.LoadedMessageType:
         await self.write(msg)
         del msg
-        return await self.read(expected_type)
+        return await self.read(expected_type, lazy)
 
     async def call_any(
         self, msg: protobuf.MessageType, *expected_wire_types: int
@@ -154,8 +179,12 @@ class Context:
         return await self.read_any(expected_wire_types)
 
     async def read(
-        self, expected_type: Type[protobuf.LoadedMessageType]
+        self, expected_type: Type[protobuf.LoadedMessageType], lazy: bool = False
     ) -> protobuf.LoadedMessageType:
+        """
+        Read a message of `expected_type`.  With `lazy`, its repeated embedded
+        messages are decoded only when accessed, see `protobuf.LazyRepeated`.
+        """
         reader = self.make_reader()
 
         if __debug__:
@@ -188,7 +217,7 @@ class Context:
         workflow.idle_timer.touch()
 
         # parse the message and return it
-        return await protobuf.load_message(reader, expected_type)
+        return await load_message(reader, expected_type, lazy)
 
     async def read_any(
         self, expected_wire_types: Iterable[int]
@@ -224,7 +253,7 @@ class Context:
         workflow.idle_timer.touch()
 
         # parse the message and return it
-        return await protobuf.load_message(reader, exptype)
+        return await load_message(reader, exptype)
 
     async def write(self, msg: protobuf.MessageType) -> None:
         writer = self.make_writer()
@@ -239,9 +268,13 @@ class Context:
         size = protobuf.count_message(msg, fields)
 
         # write the message
-        writer.setheader(msg.MESSAGE_WIRE_TYPE, size)
-        await protobuf.dump_message(writer, msg, fields)
-        await writer.aclose()
+        await self.write_lock.take()
+        try:
+            writer.setheader(msg.MESSAGE_WIRE_TYPE, size)
+            await protobuf.dump_message(writer, msg, fields)
+            await writer.aclose()
+        finally:
+            self.write_lock.publish(None)
 
     def wait(self, *tasks: Awaitable) -> Any:
         """
@@ -336,7 +369,7 @@ async def handle_session(
 
                     # Try to decode the message according to schema from
                     # `req_type`. Raises if the message is malformed.
-                    req_msg = await protobuf.load_message(req_reader, req_type)
+                    req_msg = await load_message(req_reader, req_type)
 
                     # At this point, message reports are all processed and
                     # correctly parsed into `req_msg`.
@@ -409,7 +442,11 @@ async def handle_session(
             wf_task = None
 
             # Unload modules imported by the workflow.  Should not raise.
+            if __debug__:
+                gc_start = utime.ticks_us()
             utils.unimport_end(modules)
+            if __debug__ and use_workflow:
+                workflow.note_gc(utime.ticks_diff(utime.ticks_us(), gc_start))
 
         except Exception as exc:
             # The session handling should never exit, just log and continue.
@@ -420,20 +457,7 @@ async def handle_session(
 def find_registered_workflow_handler(
     iface: WireInterface, msg_type: int
 ) -> Optional[Handler]:
-    if msg_type in workflow_handlers:
-        # Message has a handler available, return it directly.
-        handler = workflow_handlers[msg_type]
-
-    elif msg_type in workflow_packages:
-        # Message needs a dynamically imported handler, import it.
-        pkgname, modname = workflow_packages[msg_type]
-        handler = import_workflow(pkgname, modname)
-
-    else:
-        # Message does not have any registered handler.
-        return None
-
-    return handler
+    return workflow_handlers.get(msg_type)
 
 
 find_handler = find_registered_workflow_handler
@@ -29,7 +29,10 @@ class Reader:
         self.type = INVALID_TYPE
         self.size = 0
         self.ofs = 0
+        self.end = 0
         self.data = bytes()
+        # the syscall is reused for every report, protobuf reads in tiny pieces
+        self.read = loop.wait(iface.iface_num() | io.POLL_READ)
 
     def __repr__(self) -> str:
         return "<Reader type: %s>" % self.type
@@ -40,10 +43,9 @@ class Reader:
         the first report contains the message header, `self.type` and
         `self.size` are initialized and available after `aopen()` returns.
         """
-        read = loop.wait(self.iface.iface_num() | io.POLL_READ)
         while True:
             # wait for initial report
-            report = await read
+            report = await self.read
             marker = report[0]
             if marker == _REP_MARKER:
                 _, m1, m2, mtype, msize = ustruct.unpack(_REP_INIT, report)
@@ -51,11 +53,13 @@ class Reader:
                     raise ValueError
                 break
 
-        # load received message header
+        # load received message header, the payload is read from the report in
+        # place, without slicing it
         self.type = mtype
         self.size = msize
-        self.data = report[_REP_INIT_DATA : _REP_INIT_DATA + msize]
-        self.ofs = 0
+        self.data = report
+        self.ofs = _REP_INIT_DATA
+        self.end = min(len(report), _REP_INIT_DATA + msize)
 
     async def areadinto(self, buf: bytearray) -> int:
         """
@@ -66,22 +70,22 @@ class Reader:
         if self.size < len(buf):
             raise EOFError
 
-        read = loop.wait(self.iface.iface_num() | io.POLL_READ)
         nread = 0
         while nread < len(buf):
-            if self.ofs == len(self.data):
+            if self.ofs == self.end:
                 # we are at the end of received data
                 # wait for continuation report
                 while True:
-                    report = await read
+                    report = await self.read
                     marker = report[0]
                     if marker == _REP_MARKER:
                         break
-                self.data = report[_REP_CONT_DATA : _REP_CONT_DATA + self.size]
-                self.ofs = 0
+                self.data = report
+                self.ofs = _REP_CONT_DATA
+                self.end = min(len(report), _REP_CONT_DATA + self.size)
 
             # copy as much as possible to target buffer
-            nbytes = utils.memcpy(buf, nread, self.data, self.ofs, len(buf))
+            nbytes = utils.memcpy(buf, nread, self.data, self.ofs, self.end - self.ofs)
             nread += nbytes
             self.ofs += nbytes
             self.size -= nbytes
@@ -3,17 +3,50 @@ import utime
 from trezor import log, loop
 
 if False:
-    from typing import Callable, Dict, Optional, Set
+    from typing import Callable, Dict, List, Optional, Set
 
     IdleCallback = Callable[[], None]
 
 if __debug__:
     # Used in `on_close` bellow for memory statistics.
 
+    import gc
     import micropython
 
     from trezor import utils
 
+    # Heap statistics of the running workflows, sampled after every task step:
+    # peak heap in bytes, number of garbage collections and the time spent in
+    # the explicit ones, in microseconds.  Automatic collections are only seen
+    # as a drop of the heap usage, their duration cannot be measured.
+    _heap_stats = {}  # type: Dict[loop.spawn, List[int]]
+    _heap_last = 0
+
+    # Heap statistics of the last finished workflow, read over debuglink.
+    last_heap_stats = [0, 0, 0]
+
+    def _sample_heap() -> None:
+        global _heap_last
+        heap = gc.mem_alloc()
+        collected = heap < _heap_last
+        _heap_last = heap
+        for stats in _heap_stats.values():
+            if heap > stats[0]:
+                stats[0] = heap
+            if collected:
+                stats[1] += 1
+
+    def note_gc(pause_us: int) -> None:
+        """Account an explicit garbage collection to the last finished workflow."""
+        global _heap_last
+        _heap_last = gc.mem_alloc()
+        last_heap_stats[1] += 1
+        last_heap_stats[2] += pause_us
+        if utils.LOG_MEMORY:
+            log.info(__name__, "gc: %d us, heap %d", pause_us, _heap_last)
+
+    loop.stats_hook = _sample_heap
+
 
 # Set of workflow tasks.  Multiple workflows can be running at the same time.
 tasks = set()  # type: Set[loop.spawn]
@@ -35,6 +68,9 @@ def _on_start(workflow: loop.spawn) -> None:
         log.debug(__name__, "start: %s", workflow.task)
     idle_timer.touch()
     tasks.add(workflow)
+    if __debug__:
+        _heap_stats[workflow] = [gc.mem_alloc(), 0, 0]
+        utils.trace(utils.TRACE_WORKFLOW, utils.TRACE_BEGIN)
 
 
 def _on_close(workflow: loop.spawn) -> None:
@@ -48,9 +84,13 @@ def _on_close(workflow: loop.spawn) -> None:
         # and run it.
         start_default()
     if __debug__:
+        utils.trace(utils.TRACE_WORKFLOW, utils.TRACE_END)
         # In debug builds, we dump a memory info right after a workflow is
         # finished.
+        stats = _heap_stats.pop(workflow)
+        last_heap_stats[:] = stats
         if utils.LOG_MEMORY:
+            log.info(__name__, "heap: peak %d, %d collections", stats[0], stats[1])
             micropython.mem_info()
 
 
@@ -2,7 +2,6 @@ from common import *
 
 from apps.bitcoin.scripts import output_derive_script
 from apps.bitcoin.sign_tx.bitcoin import Bitcoin
-from apps.bitcoin.writers import get_tx_hash
 from apps.common import coins
 from trezor.messages.SignTx import SignTx
 from trezor.messages.TxInputType import TxInputType
@@ -49,7 +48,7 @@ class TestSegwitBip143NativeP2WPKH(unittest.TestCase):
         bip143 = Bitcoin(self.tx, None, coin)
         bip143.hash143_add_input(self.inp1)
         bip143.hash143_add_input(self.inp2)
-        prevouts_hash = get_tx_hash(bip143.h_prevouts, double=coin.sign_hash_double)
+        prevouts_hash = bip143.hash143.prevouts_hash()
         self.assertEqual(hexlify(prevouts_hash), b'96b827c8483d4e9b96712b6713a7b68d6e8003a781feba36c31143470b4efd37')
 
     def test_sequence(self):
@@ -57,7 +56,7 @@ class TestSegwitBip143NativeP2WPKH(unittest.TestCase):
         bip143 = Bitcoin(self.tx, None, coin)
         bip143.hash143_add_input(self.inp1)
         bip143.hash143_add_input(self.inp2)
-        sequence_hash = get_tx_hash(bip143.h_sequence, double=coin.sign_hash_double)
+        sequence_hash = bip143.hash143.sequence_hash()
         self.assertEqual(hexlify(sequence_hash), b'52b0a642eea2fb7ae638c36f6252b6750293dbe574a806984b8e4d8548339a3b')
 
     def test_outputs(self):
@@ -72,7 +71,7 @@ class TestSegwitBip143NativeP2WPKH(unittest.TestCase):
             script_pubkey = output_derive_script(txo, coin)
             bip143.hash143_add_output(txo_bin, script_pubkey)
 
-        outputs_hash = get_tx_hash(bip143.h_outputs, double=coin.sign_hash_double)
+        outputs_hash = bip143.hash143.outputs_hash()
         self.assertEqual(hexlify(outputs_hash), b'863ef3e1a92afbfdb97f31ad0fc7683ee943e9abcf2501590ff8f6551f47e5e5')
 
     def test_preimage_testdata(self):
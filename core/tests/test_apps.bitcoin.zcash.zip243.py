@@ -5,7 +5,6 @@ from trezor.messages.TxInputType import TxInputType
 from trezor.messages.TxOutputBinType import TxOutputBinType
 
 from apps.common import coins
-from apps.bitcoin.writers import get_tx_hash
 
 if not utils.BITCOIN_ONLY:
     from apps.bitcoin.sign_tx.zcash import Overwintered
@@ -205,9 +204,9 @@ class TestZcashZip243(unittest.TestCase):
                 txo.script_pubkey = unhexlify(o["script_pubkey"])
                 zip243.hash143_add_output(txo, txo.script_pubkey)
 
-            self.assertEqual(hexlify(get_tx_hash(zip243.h_prevouts)), v["prevouts_hash"])
-            self.assertEqual(hexlify(get_tx_hash(zip243.h_sequence)), v["sequence_hash"])
-            self.assertEqual(hexlify(get_tx_hash(zip243.h_outputs)), v["outputs_hash"])
+            self.assertEqual(hexlify(zip243.hash143.prevouts_hash()), v["prevouts_hash"])
+            self.assertEqual(hexlify(zip243.hash143.sequence_hash()), v["sequence_hash"])
+            self.assertEqual(hexlify(zip243.hash143.outputs_hash()), v["outputs_hash"])
             self.assertEqual(hexlify(zip243.hash143_preimage_hash(txi, unhexlify(i["pubkeyhash"]))), v["preimage_hash"])
 
 
@@ -8,7 +8,8 @@ if not utils.BITCOIN_ONLY:
         _get_address_root,
         _address_hash,
         validate_full_path,
-        derive_address_and_node
+        derive_address_and_node,
+        derive_addresses,
     )
     from apps.cardano.seed import Keychain
 
@@ -34,6 +35,9 @@ class TestCardanoAddress(unittest.TestCase):
             address, _ = derive_address_and_node(keychain, [0x80000000 | 44, 0x80000000 | 1815, 0x80000000, 0, 0x80000000 + i])
             self.assertEqual(expected, address)
 
+        path = [0x80000000 | 44, 0x80000000 | 1815, 0x80000000, 0]
+        self.assertEqual(derive_addresses(keychain, path, 0x80000000, 3), addresses)
+
         nodes = [
             (
                 b"3881a8de77d069001010d7f7d5211552e7d539b0e253add710367f95e528ed51",
@@ -81,6 +85,9 @@ class TestCardanoAddress(unittest.TestCase):
             address, _ = derive_address_and_node(keychain, [0x80000000 | 44, 0x80000000 | 1815, 0x80000000, 0, i])
             self.assertEqual(address, expected)
 
+        path = [0x80000000 | 44, 0x80000000 | 1815, 0x80000000, 0]
+        self.assertEqual(derive_addresses(keychain, path, 0, 3), addresses)
+
         nodes = [
             (
                 b"d03ba81163fd55af97bd132bf651a0da5b5e6201b15b1caca60b0be8e028ed51",
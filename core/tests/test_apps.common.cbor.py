@@ -3,6 +3,10 @@ from common import *
 from apps.common.cbor import (
     Tagged,
     IndefiniteLengthArray,
+    create_array_header,
+    create_break,
+    create_indefinite_array_header,
+    create_map_header,
     decode,
     encode,
 )
@@ -70,5 +74,19 @@ class TestCardanoCbor(unittest.TestCase):
             self.assertEqual(unhexlify(encoded), encode(val))
             self.assertEqual(val, decode(unhexlify(encoded)))
 
+    def test_cbor_encoding_by_parts(self):
+        value = [IndefiniteLengthArray([1, [2, 3]]), list(range(1, 26)), {}]
+        parts = (
+            create_array_header(3)
+            + create_indefinite_array_header()
+            + encode(1)
+            + encode([2, 3])
+            + create_break()
+            + create_array_header(25)
+            + b"".join(encode(i) for i in range(1, 26))
+            + create_map_header(0)
+        )
+        self.assertEqual(parts, encode(value))
+
 if __name__ == '__main__':
     unittest.main()
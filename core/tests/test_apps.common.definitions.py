@@ -0,0 +1,97 @@
+from common import *
+
+import ustruct
+from trezor.crypto.curve import ed25519
+from trezor.crypto.hashlib import sha256
+from apps.common import definitions
+
+SECRET_KEY = b"A" * 32
+
+
+class BytesFile:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def seek(self, offset):
+        self.pos = offset
+
+    def read(self, buf):
+        chunk = self.data[self.pos : self.pos + len(buf)]
+        buf[: len(chunk)] = chunk
+        self.pos += len(chunk)
+        return len(chunk)
+
+
+def build(records, key_size, record_size, per_block, kind=1, secret_key=SECRET_KEY):
+    records = sorted(records)
+    header = b"trdf" + ustruct.pack(
+        "<BBBBIHH", 1, kind, key_size, record_size, len(records), per_block, 0
+    )
+    index = b""
+    blocks = b""
+    for i in range(0, len(records), per_block):
+        block = b"".join(records[i : i + per_block])
+        index += records[i][:key_size] + sha256(block).digest()
+        blocks += block
+    signature = ed25519.sign(secret_key, sha256(header + index).digest())
+    return header + index + signature + blocks
+
+
+@unittest.skipUnless(__debug__, "development key")
+class TestDefinitions(unittest.TestCase):
+
+    def setUp(self):
+        self.records = [bytes([k, k * 2, k * 3]) for k in range(10, 80, 7)]
+        self.blob = build(self.records, 1, 3, 3)
+
+    def test_find(self):
+        f = BytesFile(self.blob)
+        defs = definitions.load(f, len(f.data), 1)
+        self.assertIsNotNone(defs)
+        for r in self.records:
+            self.assertEqual(defs.find(f, r[:1]), r[1:])
+        for k in (0, 9, 11, 30, 80, 255):
+            self.assertIsNone(defs.find(f, bytes([k])))
+        self.assertIsNone(defs.find(f, b"\x0a\x00"))
+
+    def test_load_invalid(self):
+        size = len(self.blob)
+        # wrong kind
+        self.assertIsNone(definitions.load(BytesFile(self.blob), size, 2))
+        # truncated index
+        self.assertIsNone(definitions.load(BytesFile(self.blob[:40]), 40, 1))
+        # truncated records
+        blob = self.blob[:-1]
+        self.assertIsNone(definitions.load(BytesFile(blob), len(blob), 1))
+        # signed by another key
+        blob = build(self.records, 1, 3, 3, secret_key=b"B" * 32)
+        self.assertIsNone(definitions.load(BytesFile(blob), size, 1))
+        # modified index
+        blob = bytearray(self.blob)
+        blob[16] ^= 1
+        self.assertIsNone(definitions.load(BytesFile(blob), size, 1))
+
+    def test_load_oversized(self):
+        # a count of 2^32 - 1 must not allocate the index it implies
+        blob = bytearray(self.blob)
+        blob[8:12] = b"\xff\xff\xff\xff"
+        self.assertIsNone(definitions.load(BytesFile(blob), len(blob), 1))
+        # neither must a block larger than the limit
+        blob = build(self.records, 1, 3, 2000)
+        self.assertIsNone(definitions.load(BytesFile(blob), len(blob), 1))
+
+    def test_find_modified_records(self):
+        f = BytesFile(self.blob)
+        defs = definitions.load(f, len(f.data), 1)
+        blob = bytearray(self.blob)
+        blob[-1] ^= 1
+        f.data = blob
+        # the first block is intact, the last one is not
+        self.assertEqual(defs.find(f, self.records[0][:1]), self.records[0][1:])
+        with self.assertRaises(ValueError):
+            defs.find(f, self.records[-1][:1])
+
+
+if __name__ == '__main__':
+    unittest.main()
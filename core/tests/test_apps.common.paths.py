@@ -1,6 +1,7 @@
 from common import *
 from apps.common import HARDENED
 from apps.common.paths import validate_path_for_get_public_key, is_hardened
+from apps.common.paths import ANY, UNLIMITED, compile_pattern, hardened, match_path, unhardened
 
 
 class TestPaths(unittest.TestCase):
@@ -41,6 +42,26 @@ class TestPaths(unittest.TestCase):
         # # 44'/41'/0'/0/0'
         self.assertFalse(validate_path_for_get_public_key([44 | HARDENED, 41 | HARDENED, 0 | HARDENED, 0, 0 | HARDENED], 41))
 
+    def test_match_path(self):
+        pattern = compile_pattern(
+            (2, 3, (44 | HARDENED, [hardened(0, 1), 60 | HARDENED], unhardened(9))),
+            (1, UNLIMITED, (49 | HARDENED,)),
+            (0, 1, (ANY,)),
+        )
+        self.assertEqual(match_path(pattern, [44 | HARDENED, 1 | HARDENED]), 0)
+        self.assertEqual(match_path(pattern, [44 | HARDENED, 60 | HARDENED, 9]), 0)
+        self.assertEqual(match_path(pattern, [44 | HARDENED, 60 | HARDENED, 10]), -1)
+        self.assertEqual(match_path(pattern, [44 | HARDENED, 2 | HARDENED]), -1)
+        self.assertEqual(match_path(pattern, [44 | HARDENED, 0 | HARDENED, 0, 0]), -1)
+        self.assertEqual(match_path(pattern, [49 | HARDENED] + [HARDENED] * 300), 1)
+        self.assertEqual(match_path(pattern, [49]), 2)
+        self.assertEqual(match_path(pattern, []), 2)
+        self.assertEqual(match_path(pattern, [49, 0]), -1)
+        self.assertEqual(match_path(b"", [44 | HARDENED]), -1)
+
+        with self.assertRaises(ValueError):
+            match_path(pattern[:-1], [1, 2, 3])
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -2,7 +2,7 @@ from common import *
 
 from storage import cache
 from apps.common import HARDENED
-from apps.common.seed import Keychain, Slip21Node, _path_hardened, get_keychain, with_slip44_keychain
+from apps.common.seed import Keychain, Slip21Node, _path_hardened, cache_public_node, clear_root_cache, get_cached_public_node, get_keychain, with_slip44_keychain
 from trezor import wire
 from trezor.crypto import bip39
 
@@ -127,6 +127,55 @@ class TestKeychain(unittest.TestCase):
         with self.assertRaises(wire.DataError):
             keychain.derive([44])
 
+    def test_root_cache(self):
+        seed = bip39.seed(' '.join(['all'] * 12), '')
+        cache.start_session()
+        cache.set(cache.APP_COMMON_SEED, seed)
+
+        namespaces = [("secp256k1", [44 | HARDENED, 0 | HARDENED])]
+        path = [44 | HARDENED, 0 | HARDENED, 0 | HARDENED, 0, 1]
+        expected = Keychain(seed, namespaces).derive(path).public_key()
+
+        keychain = await_result(get_keychain(wire.DUMMY_CONTEXT, namespaces))
+        self.assertEqual(keychain.derive(path).public_key(), expected)
+        # namespace root and account node are kept for the session
+        root_cache = cache.get(cache.APP_COMMON_KEYCHAIN_ROOTS)
+        self.assertEqual(len(root_cache), 2)
+
+        keychain = await_result(get_keychain(wire.DUMMY_CONTEXT, namespaces))
+        self.assertEqual(keychain.derive(path).public_key(), expected)
+        self.assertEqual(len(root_cache), 2)
+
+        clear_root_cache()
+        self.assertIsNone(cache.get(cache.APP_COMMON_KEYCHAIN_ROOTS))
+
+    def test_cached_public_node(self):
+        seed = bip39.seed(' '.join(['all'] * 12), '')
+        cache.start_session()
+        cache.set(cache.APP_COMMON_SEED, seed)
+
+        path = [44 | HARDENED, 0 | HARDENED, 0 | HARDENED]
+        self.assertIsNone(get_cached_public_node("secp256k1", path))
+
+        keychain = await_result(get_keychain(wire.DUMMY_CONTEXT, [("secp256k1", [])]))
+        node = keychain.derive(path)
+        cache_public_node("secp256k1", path, node)
+        cached = get_cached_public_node("secp256k1", path)
+        self.assertEqual(cached.public_key(), node.public_key())
+        self.assertEqual(cached.chain_code(), node.chain_code())
+        self.assertEqual(cached.fingerprint(), node.fingerprint())
+        # no private key is kept
+        self.assertEqual(cached.private_key(), bytes(32))
+        self.assertIsNone(get_cached_public_node("ed25519", path))
+
+        # non-hardened paths are not cached
+        path = [44 | HARDENED, 0 | HARDENED, 0 | HARDENED, 0]
+        cache_public_node("secp256k1", path, keychain.derive(path))
+        self.assertIsNone(get_cached_public_node("secp256k1", path))
+
+        clear_root_cache()
+        self.assertIsNone(get_cached_public_node("secp256k1", path[:3]))
+
     def test_with_slip44(self):
         seed = bip39.seed(' '.join(['all'] * 12), '')
         cache.start_session()
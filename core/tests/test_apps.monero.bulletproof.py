@@ -361,6 +361,45 @@ class TestMoneroBulletproof(unittest.TestCase):
         proof = bpi.prove_batch(sv, gamma)
         bpi.verify_batch([proof])
 
+    def test_prove_native(self):
+        from apps.monero.xmr import range_signatures
+
+        bpi = bp.BulletProofBuilder()
+        # the largest batch the native prover supports
+        amounts = [123, (1 << 64) - 1]
+        masks = [crypto.random_scalar() for _ in amounts]
+        proof = range_signatures.prove_range_bp_batch(amounts, masks)
+        self.assertEqual(len(proof.V), 2)
+        self.assertEqual(len(proof.L), 7)
+        self.assertTrue(bpi.verify(proof))
+        self.assertTrue(range_signatures.verify_bp(proof, amounts, masks))
+
+        amounts[0] += 1
+        with self.assertRaises(Exception):
+            range_signatures.verify_bp(proof, amounts, masks)
+
+    def test_prove_fallback(self):
+        from apps.monero.xmr import range_signatures
+
+        amounts = [123, (1 << 30) - 1 + 16, (1 << 64) - 1]
+        masks = [crypto.random_scalar() for _ in amounts]
+        proof = range_signatures.prove_range_bp_batch(amounts, masks)
+        self.assertEqual(len(proof.V), 3)
+        self.assertEqual(len(proof.L), 8)
+        self.assertTrue(range_signatures.verify_bp(proof, amounts, masks))
+
+    def test_prove_native_invalid(self):
+        from trezor.crypto import monero as tcry
+
+        with self.assertRaises(ValueError):
+            tcry.xmr_prove_range_bulletproof([], [])
+        with self.assertRaises(ValueError):
+            tcry.xmr_prove_range_bulletproof([1, 2], [crypto.sc_init(1)])
+        with self.assertRaises(ValueError):
+            tcry.xmr_prove_range_bulletproof(
+                [1, 2, 3], [crypto.sc_init(1) for _ in range(3)]
+            )
+
 
 if __name__ == "__main__":
     unittest.main()
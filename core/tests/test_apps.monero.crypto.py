@@ -139,6 +139,19 @@ class TestMoneroCrypto(unittest.TestCase):
         )
         self.assertEqual(crypto.encodepoint(crypto.xmr_H()), H)
 
+    def test_scalarmult_h(self):
+        for i in (0, 1, 2, 255):
+            self.assertEqual(
+                crypto.encodepoint(crypto.scalarmult_h(i)),
+                crypto.encodepoint(crypto.scalarmult(crypto.xmr_H(), i)),
+            )
+        for _ in range(8):
+            x = crypto.random_scalar()
+            self.assertEqual(
+                crypto.encodepoint(crypto.scalarmult_h(x)),
+                crypto.encodepoint(crypto.scalarmult(crypto.xmr_H(), x)),
+            )
+
     def test_sc_inversion(self):
         res = crypto.new_scalar()
         inp = crypto.decodeint(
@@ -236,6 +249,85 @@ class TestMoneroCrypto(unittest.TestCase):
         )
         self.assertEqual(pkey_ex, crypto.encodepoint(pkey_comp))
 
+    def test_multi_scalarmult(self):
+        for n in (0, 1, 2, 20):
+            points = [crypto.scalarmult_base(crypto.sc_init(i + 3)) for i in range(n)]
+            scalars = [crypto.random_scalar() for _ in range(n)]
+            exp = crypto.identity()
+            for P, s in zip(points, scalars):
+                exp = crypto.point_add(exp, crypto.scalarmult(P, s))
+
+            res = crypto.multi_scalarmult(points, scalars)
+            self.assertTrue(crypto.point_eq(res, exp))
+            res = crypto.multi_scalarmult_vartime(points, scalars)
+            self.assertTrue(crypto.point_eq(res, exp))
+
+        with self.assertRaises(ValueError):
+            crypto.multi_scalarmult([crypto.xmr_H()], [])
+
+    def test_vct_ops(self):
+        n = 5
+        a = crypto.random_scalar()
+        b = crypto.random_scalar()
+        lo = b"".join(crypto.encodeint(crypto.random_scalar()) for _ in range(n))
+        hi = b"".join(crypto.encodeint(crypto.random_scalar()) for _ in range(n))
+        Lo = b"".join(crypto.encodepoint(crypto.scalarmult_base(crypto.decodeint(lo[32 * i : 32 * i + 32]))) for i in range(n))
+        Hi = b"".join(crypto.encodepoint(crypto.scalarmult_base(crypto.decodeint(hi[32 * i : 32 * i + 32]))) for i in range(n))
+
+        dst = bytearray(32 * n)
+        crypto.sc_fold_vct(dst, lo, hi, a, b)
+        ip = crypto.sc_muladd_vct(crypto.sc_0(), lo, hi)
+        ip_exp = crypto.sc_0()
+        for i in range(n):
+            x = crypto.decodeint(lo[32 * i : 32 * i + 32])
+            y = crypto.decodeint(hi[32 * i : 32 * i + 32])
+            exp = crypto.sc_add(crypto.sc_mul(a, x), crypto.sc_mul(b, y))
+            self.assertEqual(dst[32 * i : 32 * i + 32], crypto.encodeint(exp))
+            ip_exp = crypto.sc_muladd(x, y, ip_exp)
+        self.assertEqual(crypto.encodeint(ip), crypto.encodeint(ip_exp))
+
+        dst = bytearray(Lo)
+        crypto.add_keys3_vct(dst, a, dst, b, Hi)
+        for i in range(n):
+            exp = crypto.add_keys3(
+                a, crypto.decodepoint(Lo[32 * i : 32 * i + 32]),
+                b, crypto.decodepoint(Hi[32 * i : 32 * i + 32]),
+            )
+            self.assertEqual(dst[32 * i : 32 * i + 32], crypto.encodepoint(exp))
+
+        with self.assertRaises(ValueError):
+            crypto.sc_fold_vct(bytearray(64), lo[:32], hi, a, b)
+
+    def test_export_key_images(self):
+        view = crypto.random_scalar()
+        spend = crypto.random_scalar()
+        sub = monero.get_subaddress_secret_key(view, major=1, minor=2)
+        derivation = crypto.generate_key_derivation(
+            crypto.scalarmult_base(crypto.random_scalar()), view
+        )
+        subs = [None, sub, None]
+        out_keys = bytearray()
+        xis = []
+        for i in range(len(subs)):
+            xi = crypto.derive_secret_key(derivation, i, spend)
+            if subs[i]:
+                xi = crypto.sc_add(xi, subs[i])
+            xis.append(xi)
+            out_keys += crypto.encodepoint(crypto.scalarmult_base(xi))
+
+        res = crypto.export_key_images(
+            spend, out_keys, [derivation] * 3, [0, 1, 2], subs
+        )
+        self.assertEqual(len(res), 96 * 3)
+        for i in range(len(subs)):
+            ki = monero.generate_key_image(out_keys[32 * i : 32 * i + 32], xis[i])
+            self.assertEqual(res[96 * i : 96 * i + 32], crypto.encodepoint(ki))
+
+        with self.assertRaises(ValueError):
+            crypto.export_key_images(
+                spend, out_keys, [derivation] * 3, [0, 2, 1], subs
+            )
+
 
 if __name__ == "__main__":
     unittest.main()
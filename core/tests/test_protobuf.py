@@ -3,7 +3,7 @@ from common import *
 import protobuf
 
 if False:
-    from typing import Awaitable, Dict
+    from typing import Awaitable, Dict, List
 
 
 class Message(protobuf.MessageType):
@@ -19,6 +19,36 @@ class Message(protobuf.MessageType):
         }
 
 
+class Item(protobuf.MessageType):
+    def __init__(self, value: int = None, data: bytes = None) -> None:
+        self.value = value
+        self.data = data
+
+    @classmethod
+    def get_fields(cls) -> Dict:
+        return {
+            1: ("value", protobuf.UVarintType, 0),
+            2: ("data", protobuf.BytesType, 0),
+        }
+
+
+class Container(protobuf.MessageType):
+    def __init__(
+        self, items: List[Item] = None, blobs: List[bytes] = None, inner=None
+    ) -> None:
+        self.items = items if items is not None else []
+        self.blobs = blobs if blobs is not None else []
+        self.inner = inner
+
+    @classmethod
+    def get_fields(cls) -> Dict:
+        return {
+            1: ("items", Item, protobuf.FLAG_REPEATED),
+            2: ("blobs", protobuf.BytesType, protobuf.FLAG_REPEATED),
+            3: ("inner", Container, 0),
+        }
+
+
 class ByteReader:
     def __init__(self, data: bytes) -> None:
         self.data = data
@@ -107,6 +137,33 @@ class TestProtobuf(unittest.TestCase):
         with self.assertRaises(TypeError):
             await_result(protobuf.load_message(reader, Message))
 
+    def test_load_lazy(self):
+        items = [Item(value=i, data=bytes([i]) * i) for i in range(5)]
+        msg = Container(
+            items=items, blobs=[b"ab", b"", b"cde"], inner=Container(items=items[:2])
+        )
+        writer = ByteArrayWriter()
+        await_result(protobuf.dump_message(writer, msg))
+
+        reader = ByteReader(bytes(writer.buf))
+        nmsg = await_result(protobuf.load_message(reader, Container, lazy=True))
+        self.assertIsInstance(nmsg.items, protobuf.LazyRepeated)
+        self.assertIsInstance(nmsg.inner.items, protobuf.LazyRepeated)
+        self.assertEqual(len(nmsg.items), 5)
+        self.assertEqual(nmsg.items[3].value, 3)
+        self.assertEqual(nmsg.items[3].data, b"\x03\x03\x03")
+        self.assertEqual(nmsg.items[-1].value, 4)
+        self.assertEqual([i.value for i in nmsg.items[1:3]], [1, 2])
+        self.assertEqual([i.value for i in nmsg.inner.items], [0, 1])
+        self.assertEqual(list(nmsg.blobs), [b"ab", b"", b"cde"])
+        with self.assertRaises(IndexError):
+            nmsg.items[5]
+
+        # a lazily loaded message encodes the same as the original
+        nwriter = ByteArrayWriter()
+        await_result(protobuf.dump_message(nwriter, nmsg))
+        self.assertEqual(nwriter.buf, writer.buf)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -50,6 +50,23 @@ class TestStorageCache(unittest.TestCase):
         with self.assertRaises(RuntimeError):
             cache.get(KEY)
 
+    def test_clear_sessions(self):
+        session_id1 = cache.start_session()
+        cache.set(KEY, "hello")
+        session_id2 = cache.start_session()
+        cache.set(KEY, "world")
+        cache.set(cache.APP_COMMON_SEED_WITHOUT_PASSPHRASE, b"seed")
+        cache.set(cache.APP_WEBAUTHN_RESIDENT_INDEX, 1)
+
+        cache.clear_sessions()
+        self.assertIsNone(cache.get(KEY))
+        self.assertIsNone(cache.get(cache.APP_COMMON_SEED_WITHOUT_PASSPHRASE))
+        self.assertEqual(cache.get(cache.APP_WEBAUTHN_RESIDENT_INDEX), 1)
+        # the sessions can still be resumed
+        self.assertEqual(cache.start_session(session_id1), session_id1)
+        self.assertIsNone(cache.get(KEY))
+        self.assertEqual(cache.start_session(session_id2), session_id2)
+
     def test_decorator_mismatch(self):
         with self.assertRaises(AssertionError):
 
@@ -0,0 +1,17 @@
+from common import *
+from mock_storage import mock_storage
+
+from storage import derived
+
+
+class TestStorageDerived(unittest.TestCase):
+
+    @mock_storage
+    def test_wipe(self):
+        derived.set_cardano_root(b"root")
+        derived.wipe()
+        self.assertIsNone(derived.get_cardano_root())
+
+
+if __name__ == "__main__":
+    unittest.main()
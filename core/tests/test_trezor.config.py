@@ -144,6 +144,44 @@ class TestConfig(unittest.TestCase):
             value2 = config.get(appid, key)
             self.assertEqual(value, value2)
 
+    def test_set_many(self):
+        config.init()
+        config.wipe()
+        self.assertEqual(config.unlock(pin_to_int(''), None), True)
+        values = {key: random.bytes(64) for key in range(1, 9)}
+        config.set_many(1, values)
+        config.set_many(1, {1: b"public"}, True)
+        for key, value in values.items():
+            self.assertEqual(config.get(1, key), value)
+        self.assertEqual(config.get(1, 1, True), b"public")
+
+        # the storage authentication tag is checked after unlocking
+        config.lock()
+        self.assertEqual(config.unlock(pin_to_int(''), None), True)
+        for key, value in values.items():
+            self.assertEqual(config.get(1, key), value)
+
+        with self.assertRaises(ValueError):
+            config.set_many(1, {key: b"" for key in range(17)})
+
+    def test_iter(self):
+        config.init()
+        config.wipe()
+        self.assertEqual(config.unlock(pin_to_int(''), None), True)
+        for key in (7, 3, 250, 1):
+            config.set(4, key, b"value")
+        config.set(4, 5, b"public", True)
+        config.set(3, 2, b"other")
+        config.delete(4, 250)
+        self.assertEqual(config.iter(4), [1, 3, 7])
+        self.assertEqual(config.iter(4, True), [5])
+        self.assertEqual(config.iter(2), [])
+
+        config.lock()
+        with self.assertRaises(RuntimeError):
+            config.iter(4)
+        self.assertEqual(config.iter(4, True), [5])
+
     def test_compact(self):
         config.init()
         config.wipe()
@@ -150,6 +150,49 @@ class TestCryptoBip32(unittest.TestCase):
         ns = n.serialize_public(VERSION_PUBLIC)
         self.assertEqual(ns, 'xpub6FnCn6nSzZAw5Tw7cgR9bi15UV96gLZhjDstkXXxvCLsUXBGXPdSnLFbdpq8p9HmGsApME5hQTZ3emM2rnY5agb9rXpVGyy3bdW6EEgAtqt')
 
+    def test_derive_path_into(self):
+        m = bip32.from_seed(unhexlify('000102030405060708090a0b0c0d0e0f'), SECP256K1_NAME)
+        m_pub = m.public_key()
+        dst = m.clone()
+        dst.derive_path([HARDENED | 5])
+
+        for path in ([HARDENED | 0], [HARDENED | 0, 1], []):
+            n = m.clone()
+            n.derive_path(path)
+            m.derive_path_into(dst, path)
+            self.assertEqual(dst.fingerprint(), n.fingerprint())
+            self.assertEqual(dst.depth(), n.depth())
+            self.assertEqual(dst.chain_code(), n.chain_code())
+            self.assertEqual(dst.private_key(), n.private_key())
+            self.assertEqual(dst.public_key(), n.public_key())
+
+        # the source node is not modified
+        self.assertEqual(m.depth(), 0)
+        self.assertEqual(m.public_key(), m_pub)
+
+        with self.assertRaises(TypeError):
+            m.derive_path_into(None, [1])
+
+    def test_derive_public_keys(self):
+        seed = unhexlify('000102030405060708090a0b0c0d0e0f')
+        for curve, index in ((SECP256K1_NAME, 7), ('ed25519', HARDENED | 7)):
+            m = bip32.from_seed(seed, curve)
+            m_pub = m.public_key()
+            pubkeys = m.derive_public_keys(index, 5)
+            self.assertEqual(len(pubkeys), 5)
+            for i, pubkey in enumerate(pubkeys):
+                n = m.clone()
+                n.derive(index + i)
+                self.assertEqual(pubkey, n.public_key())
+
+            # the source node is not modified
+            self.assertEqual(m.depth(), 0)
+            self.assertEqual(m.public_key(), m_pub)
+
+        self.assertEqual(m.derive_public_keys(HARDENED, 0), [])
+        with self.assertRaises(ValueError):
+            m.derive_public_keys(HARDENED, 65)
+
     def test_secp256k1_vector_1_derive_path(self):
         # pylint: disable=C0301
         # test vector 1 from https://en.bitcoin.it/wiki/BIP_0032_TestVectors
@@ -283,5 +326,29 @@ class TestCryptoBip32(unittest.TestCase):
         self.assertEqual(ns, 'xpub6FnCn6nSzZAw5Tw7cgR9bi15UV96gLZhjDstkXXxvCLsUXBGXPdSnLFbdpq8p9HmGsApME5hQTZ3emM2rnY5agb9rXpVGyy3bdW6EEgAtqt')
 
 
+    def test_secp256k1_derive_path_public(self):
+        m = bip32.from_seed(unhexlify('fffcf9f6f3f0edeae7e4e1dedbd8d5d2cfccc9c6c3c0bdbab7b4b1aeaba8a5a29f9c999693908d8a8784817e7b7875726f6c696663605d5a5754514e4b484542'), SECP256K1_NAME)
+        m.derive_path([HARDENED | 44, HARDENED | 0, HARDENED | 0])
+        xpub = bip32.HDNode(
+            depth=m.depth(),
+            fingerprint=m.fingerprint(),
+            child_num=m.child_num(),
+            chain_code=m.chain_code(),
+            public_key=m.public_key(),
+        )
+        for path in ([], [5], [0, 1], [1, 1], [0, 2], [1, 2, 3], [0, 2, 3]):
+            n = m.clone()
+            n.derive_path(path)
+            p = xpub.clone()
+            p.derive_path(path, True)
+            self.assertEqual(p.public_key(), n.public_key())
+            self.assertEqual(p.chain_code(), n.chain_code())
+            self.assertEqual(p.fingerprint(), n.fingerprint())
+            self.assertEqual(p.depth(), n.depth())
+            self.assertEqual(p.serialize_public(VERSION_PUBLIC), n.serialize_public(VERSION_PUBLIC))
+        with self.assertRaises(ValueError):
+            xpub.clone().derive_path([0, HARDENED | 1], True)
+
+
 if __name__ == '__main__':
     unittest.main()
@@ -17,6 +17,15 @@ class TestCryptoCrc(unittest.TestCase):
         for i, o in self.vectors_crc32:
             self.assertEqual(crc.crc32(i), o)
 
+    def test_crc32_chunks(self):
+        data = bytes(range(256)) * 5
+        o = crc.crc32(data)
+        for a, b in ((0, 0), (1, 3), (2, 17), (3, 640), (8, 1279), (0, 1280)):
+            c = crc.crc32(data[:a])
+            c = crc.crc32(data[a:b], c)
+            c = crc.crc32(data[b:], c)
+            self.assertEqual(c, o)
+
 
 if __name__ == '__main__':
     unittest.main()
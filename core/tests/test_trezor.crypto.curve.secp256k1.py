@@ -141,6 +141,33 @@ class TestCryptoSecp256k1(Secp256k1Common, unittest.TestCase):
     def __init__(self):
         self.impl = secp256k1
 
+    def test_schnorr(self):
+        # test vector 0 from BIP-340
+        sk = unhexlify("0000000000000000000000000000000000000000000000000000000000000003")
+        pk = unhexlify("f9308a019258c31049344f85f89d5229b531c845836f99b08601f113bce036f9")
+        sig = unhexlify("e907831f80848d1069a5371b402410364bdf1c5f8307b0084c55f1ce2dca821525f66a4a85ea8b71e482a74f382d2ce5ebeee8fdb2172f477df4900d310536c0")
+        digest = bytes(32)
+        self.assertEqual(self.impl.schnorr_publickey(sk), pk)
+        self.assertTrue(self.impl.verify_schnorr(pk, sig, digest))
+        self.assertFalse(self.impl.verify_schnorr(pk, sig, b"\x01" * 32))
+
+        sig2 = self.impl.sign_schnorr(sk, digest)
+        self.assertTrue(self.impl.verify_schnorr(pk, sig2, digest))
+
+    def test_schnorr_batch(self):
+        pks, sigs, digests = [], [], []
+        # more than one chunk of BIP340_VERIFY_BATCH_SIZE signatures
+        for _ in range(10):
+            sk = self.impl.generate_secret()
+            digest = random.bytes(32)
+            pks.append(self.impl.schnorr_publickey(sk))
+            sigs.append(self.impl.sign_schnorr(sk, digest))
+            digests.append(digest)
+        self.assertTrue(self.impl.verify_schnorr_batch(pks, sigs, digests))
+        self.assertTrue(self.impl.verify_schnorr_batch([], [], []))
+        digests[9] = random.bytes(32)
+        self.assertFalse(self.impl.verify_schnorr_batch(pks, sigs, digests))
+
 @unittest.skipUnless(not utils.BITCOIN_ONLY, "altcoin")
 class TestCryptoSecp256k1Zkp(Secp256k1Common, unittest.TestCase):
     def __init__(self):
@@ -49,6 +49,32 @@ class TestCryptoBlake256(unittest.TestCase):
         self.assertEqual(d0, d1)
         self.assertEqual(d0, d2)
 
+    def test_copy(self):
+        x = hashlib.blake256(b'prefix')
+        y = x.copy()
+        x.update(b'abc')
+        y.update(b'abc')
+        self.assertEqual(x.digest(), y.digest())
+        self.assertEqual(y.digest(), hashlib.blake256(b'prefixabc').digest())
+        y.update(b'def')
+        self.assertNotEqual(x.digest(), y.digest())
+
+    def test_update_range(self):
+        data = b'xxabcyy'
+        x = hashlib.blake256()
+        x.update(data, 2, 3)
+        self.assertEqual(x.digest(), hashlib.blake256(b'abc').digest())
+        x = hashlib.blake256()
+        x.update(memoryview(data), 2)
+        self.assertEqual(x.digest(), hashlib.blake256(b'abcyy').digest())
+        x = hashlib.blake256()
+        x.update(data, 7, 0)
+        self.assertEqual(x.digest(), hashlib.blake256().digest())
+        with self.assertRaises(ValueError):
+            x.update(data, 8)
+        with self.assertRaises(ValueError):
+            x.update(data, 2, 6)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -44,6 +44,32 @@ class TestCryptoBlake2b(unittest.TestCase):
         self.assertEqual(d0, d1)
         self.assertEqual(d0, d2)
 
+    def test_copy(self):
+        x = hashlib.blake2b(b'prefix')
+        y = x.copy()
+        x.update(b'abc')
+        y.update(b'abc')
+        self.assertEqual(x.digest(), y.digest())
+        self.assertEqual(y.digest(), hashlib.blake2b(b'prefixabc').digest())
+        y.update(b'def')
+        self.assertNotEqual(x.digest(), y.digest())
+
+    def test_update_range(self):
+        data = b'xxabcyy'
+        x = hashlib.blake2b()
+        x.update(data, 2, 3)
+        self.assertEqual(x.digest(), hashlib.blake2b(b'abc').digest())
+        x = hashlib.blake2b()
+        x.update(memoryview(data), 2)
+        self.assertEqual(x.digest(), hashlib.blake2b(b'abcyy').digest())
+        x = hashlib.blake2b()
+        x.update(data, 7, 0)
+        self.assertEqual(x.digest(), hashlib.blake2b().digest())
+        with self.assertRaises(ValueError):
+            x.update(data, 8)
+        with self.assertRaises(ValueError):
+            x.update(data, 2, 6)
+
 
 if __name__ == '__main__':
     unittest.main()
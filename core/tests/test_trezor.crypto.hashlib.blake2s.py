@@ -45,6 +45,22 @@ class TestCryptoBlake2s(unittest.TestCase):
         self.assertEqual(d0, d1)
         self.assertEqual(d0, d2)
 
+    def test_update_range(self):
+        data = b'xxabcyy'
+        x = hashlib.blake2s()
+        x.update(data, 2, 3)
+        self.assertEqual(x.digest(), hashlib.blake2s(b'abc').digest())
+        x = hashlib.blake2s()
+        x.update(memoryview(data), 2)
+        self.assertEqual(x.digest(), hashlib.blake2s(b'abcyy').digest())
+        x = hashlib.blake2s()
+        x.update(data, 7, 0)
+        self.assertEqual(x.digest(), hashlib.blake2s().digest())
+        with self.assertRaises(ValueError):
+            x.update(data, 8)
+        with self.assertRaises(ValueError):
+            x.update(data, 2, 6)
+
 
 if __name__ == '__main__':
     unittest.main()
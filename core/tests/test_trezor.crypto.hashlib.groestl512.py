@@ -49,6 +49,22 @@ class TestCryptoGroestl512(unittest.TestCase):
         self.assertEqual(d0, d1)
         self.assertEqual(d0, d2)
 
+    def test_update_range(self):
+        data = b'xxabcyy'
+        x = hashlib.groestl512()
+        x.update(data, 2, 3)
+        self.assertEqual(x.digest(), hashlib.groestl512(b'abc').digest())
+        x = hashlib.groestl512()
+        x.update(memoryview(data), 2)
+        self.assertEqual(x.digest(), hashlib.groestl512(b'abcyy').digest())
+        x = hashlib.groestl512()
+        x.update(data, 7, 0)
+        self.assertEqual(x.digest(), hashlib.groestl512().digest())
+        with self.assertRaises(ValueError):
+            x.update(data, 8)
+        with self.assertRaises(ValueError):
+            x.update(data, 2, 6)
+
 
 if __name__ == '__main__':
     unittest.main()
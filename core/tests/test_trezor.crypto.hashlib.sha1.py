@@ -43,6 +43,22 @@ class TestCryptoSha1(unittest.TestCase):
         self.assertEqual(d0, d1)
         self.assertEqual(d0, d2)
 
+    def test_update_range(self):
+        data = b'xxabcyy'
+        x = hashlib.sha1()
+        x.update(data, 2, 3)
+        self.assertEqual(x.digest(), hashlib.sha1(b'abc').digest())
+        x = hashlib.sha1()
+        x.update(memoryview(data), 2)
+        self.assertEqual(x.digest(), hashlib.sha1(b'abcyy').digest())
+        x = hashlib.sha1()
+        x.update(data, 7, 0)
+        self.assertEqual(x.digest(), hashlib.sha1().digest())
+        with self.assertRaises(ValueError):
+            x.update(data, 8)
+        with self.assertRaises(ValueError):
+            x.update(data, 2, 6)
+
 
 if __name__ == '__main__':
     unittest.main()
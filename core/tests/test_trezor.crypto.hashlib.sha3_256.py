@@ -1,6 +1,6 @@
 from common import *
 
-from trezor.crypto import hashlib
+from trezor.crypto import hashlib, rlp
 
 
 class TestCryptoSha3_256(unittest.TestCase):
@@ -68,6 +68,42 @@ class TestCryptoSha3_256(unittest.TestCase):
         self.assertEqual(d0, d1)
         self.assertEqual(d0, d2)
 
+    def test_update_range(self):
+        data = b'xxabcyy'
+        x = hashlib.sha3_256()
+        x.update(data, 2, 3)
+        self.assertEqual(x.digest(), hashlib.sha3_256(b'abc').digest())
+        x = hashlib.sha3_256()
+        x.update(memoryview(data), 2)
+        self.assertEqual(x.digest(), hashlib.sha3_256(b'abcyy').digest())
+        x = hashlib.sha3_256()
+        x.update(data, 7, 0)
+        self.assertEqual(x.digest(), hashlib.sha3_256().digest())
+        with self.assertRaises(ValueError):
+            x.update(data, 8)
+        with self.assertRaises(ValueError):
+            x.update(data, 2, 6)
+
+    def test_update_rlp(self):
+        values = [
+            0, 1, 127, 128, 1000, 100000, 0xFFFFFFFF,
+            b'', b'\x00', b'\x7f', b'\x80', b'dog',
+            b'x' * 55, b'x' * 56, b'x' * 256, b'x' * 70000,
+        ]
+        for value in values:
+            x = hashlib.sha3_256(keccak=True)
+            x.update_rlp(value)
+            y = hashlib.sha3_256(rlp.encode(value), keccak=True)
+            self.assertEqual(x.digest(), y.digest())
+
+    def test_update_rlp_length(self):
+        for length in (0, 55, 56, 255, 256, 65536, 16000000):
+            for is_list in (False, True):
+                x = hashlib.sha3_256(keccak=True)
+                x.update_rlp_length(length, is_list)
+                y = hashlib.sha3_256(rlp.encode_length(length, is_list), keccak=True)
+                self.assertEqual(x.digest(), y.digest())
+
 
 if __name__ == '__main__':
     unittest.main()
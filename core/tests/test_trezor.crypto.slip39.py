@@ -1,5 +1,6 @@
 from common import *
 from trezor.crypto import slip39, random
+from trezorcrypto import slip39 as trezorcrypto_slip39
 from slip39_vectors import vectors
 
 def combinations(iterable, r):
@@ -153,6 +154,22 @@ class TestCryptoSlip39(unittest.TestCase):
                     slip39.recover_ems(mnemonics)
 
 
+    def test_encrypt_decrypt(self):
+        identifier = slip39.generate_random_identifier()
+        for passphrase in (b"", b"TREZOR", b"x" * 100):
+            ems = trezorcrypto_slip39.encrypt(self.EMS, passphrase, 0, identifier)
+            self.assertEqual(slip39.decrypt(ems, passphrase, 0, identifier), self.EMS)
+        with self.assertRaises(ValueError):
+            trezorcrypto_slip39.decrypt(b"odd", b"", 0, identifier)
+
+
+    def test_checksum(self):
+        data = tuple(slip39._mnemonic_to_indices(vectors[0][0][0]))
+        self.assertTrue(slip39._rs1024_verify_checksum(data))
+        self.assertEqual(slip39._rs1024_create_checksum(data[:-3]), data[-3:])
+        self.assertFalse(slip39._rs1024_verify_checksum(data[:-1] + (data[-1] ^ 1,)))
+
+
     def test_error_location(self):
         mnemonics = [
             "duckling enlarge academic academic agency result length solution fridge kidney coal piece deal husband erode duke ajar critical decision keyboard",
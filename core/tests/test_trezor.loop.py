@@ -0,0 +1,49 @@
+from common import *
+
+from trezor import loop
+
+
+class TestLoop(unittest.TestCase):
+
+    def test_idle(self):
+        order = []
+
+        async def foreground():
+            for i in range(3):
+                order.append("fg%d" % i)
+                await loop.sleep(20)
+
+        async def background(name):
+            for i in range(3):
+                order.append("%s%d" % (name, i))
+                await loop.idle()
+
+        loop.clear()
+        loop.schedule(foreground())
+        loop.schedule_idle(background("a"))
+        loop.schedule_idle(background("b"))
+        loop.run()
+
+        # idle tasks take turns while the foreground task sleeps
+        self.assertEqual(
+            order, ["fg0", "a0", "b0", "a1", "b1", "a2", "b2", "fg1", "fg2"]
+        )
+
+    def test_idle_close(self):
+        order = []
+
+        async def background():
+            while True:
+                order.append(0)
+                await loop.idle()
+
+        loop.clear()
+        task = background()
+        loop.schedule_idle(task)
+        loop.close(task)
+        loop.run()
+        self.assertEqual(order, [])
+
+
+if __name__ == '__main__':
+    unittest.main()
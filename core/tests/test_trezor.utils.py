@@ -1,6 +1,9 @@
 from common import *
 
+import ustruct
+
 from trezor import utils
+from trezor.crypto.hashlib import sha256
 
 
 class TestUtils(unittest.TestCase):
@@ -35,6 +38,62 @@ class TestUtils(unittest.TestCase):
         self.assertEqual(utils.truncate_utf8("\u1234\u5678", 6), "\u1234\u5678")  # b'\xe1\x88\xb4\xe5\x99\xb8
         self.assertEqual(utils.truncate_utf8("\u1234\u5678", 7), "\u1234\u5678")  # b'\xe1\x88\xb4\xe5\x99\xb8
 
+    def test_write_uint(self):
+        w = bytearray()
+        self.assertEqual(utils.write_uint(w, 0x0102, 2), 2)
+        self.assertEqual(utils.write_uint(w, 0x01020304, 4, True), 4)
+        self.assertEqual(utils.write_uint(w, 0xFFFFFFFFFFFFFFFF, 8), 8)
+        self.assertEqual(w, b"\x02\x01\x01\x02\x03\x04" + b"\xff" * 8)
+
+        ctx = utils.HashWriter(sha256())
+        utils.write_uint(ctx, 0x01020304, 4)
+        self.assertEqual(ctx.get_digest(), sha256(b"\x04\x03\x02\x01").digest())
+
+        with self.assertRaises(ValueError):
+            utils.write_uint(w, 0, 9)
+
+    def test_trace(self):
+        utils.trace_dump(True)
+        start = utils.cycles()
+        utils.trace(5, 7)
+        dump = utils.trace_dump(True)
+        # empty unless built with TRACE=1
+        if dump:
+            cycles, tag, arg = ustruct.unpack("<IHH", dump[-8:])
+            self.assertEqual(tag, 0x8005)
+            self.assertEqual(arg, 7)
+            self.assertTrue((cycles - start) & 0xFFFFFFFF < 0x80000000)
+        self.assertEqual(utils.trace_dump(), b"")
+
+        with self.assertRaises(ValueError):
+            utils.trace(0x8000)
+
+    def test_arena(self):
+        # no active arena, regular heap
+        b = utils.arena_alloc(4)
+        self.assertEqual(b, bytearray(4))
+
+        a = utils.arena(8)
+        with a:
+            b1 = utils.arena_alloc(3)
+            b2 = utils.arena_alloc(5)
+            b1[:] = b"abc"
+            b2[:] = b"defgh"
+            self.assertEqual(bytes(a.buf), b"abcdefgh")
+            # does not fit, falls back to the heap
+            b3 = utils.arena_alloc(1)
+            self.assertEqual(b3, bytearray(1))
+            self.assertEqual(bytes(a.buf), b"abcdefgh")
+        self.assertEqual(a.offset, 0)
+
+        with a:
+            with utils.arena(2):
+                utils.arena_alloc(2)
+                self.assertEqual(a.offset, 0)
+            utils.arena_alloc(2)
+            self.assertEqual(a.offset, 2)
+        self.assertIsNone(utils._arena)
+
 
 if __name__ == '__main__':
     unittest.main()
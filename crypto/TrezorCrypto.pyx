@@ -0,0 +1,240 @@
+cimport c
+from libc.stdint cimport uint8_t, uint32_t
+from libc.stdlib cimport free, malloc
+
+# The functions taking lists do all their work in C with the GIL released,
+# so that several Python threads can use them at the same time.
+
+VERSION_PUBLIC = 0x0488B21E
+ADDRESS_LEGACY = 0
+ADDRESS_P2SH_SEGWIT = 1
+
+
+cdef class HDNode:
+
+    cdef c.HDNode node
+
+    def __init__(self, bytes seed=None, str xpub=None, str curve="secp256k1"):
+        cdef bytes name = curve.encode()
+        cdef bytes s
+        if seed is not None:
+            if not c.hdnode_from_seed(<const uint8_t *><const char *>seed, len(seed), name, &self.node):
+                raise ValueError("Invalid seed")
+            c.hdnode_fill_public_key(&self.node)
+        elif xpub is not None:
+            s = xpub.encode()
+            if c.hdnode_deserialize_public(s, VERSION_PUBLIC, name, &self.node, NULL) != 0:
+                raise ValueError("Invalid xpub")
+        else:
+            raise ValueError("Either seed or xpub is required")
+
+    def private_ckd(self, uint32_t i):
+        if not c.hdnode_private_ckd(&self.node, i):
+            raise ValueError("Failed to derive")
+        c.hdnode_fill_public_key(&self.node)
+
+    def public_ckd(self, uint32_t i):
+        if not c.hdnode_public_ckd(&self.node, i):
+            raise ValueError("Failed to derive")
+
+    def public_key(self) -> bytes:
+        return bytes(self.node.public_key[:33])
+
+    def xpub(self, uint32_t fingerprint=0) -> str:
+        cdef char s[112]
+        if not c.hdnode_serialize_public(&self.node, fingerprint, VERSION_PUBLIC, s, sizeof(s)):
+            raise ValueError("Failed to serialize")
+        return s.decode()
+
+    def address(self, uint32_t version=0) -> str:
+        cdef char addr[c.MAX_ADDR_SIZE]
+        c.hdnode_get_address(&self.node, version, addr, sizeof(addr))
+        return addr.decode()
+
+    def addresses(self, uint32_t start, size_t count, uint32_t version=0, int addrformat=ADDRESS_LEGACY) -> list:
+        """Returns the addresses of the non-hardened children start, ...,
+        start + count - 1, derived in batches sharing the field inversions."""
+        cdef c.curve_point pub
+        cdef int addrsize = c.MAX_ADDR_SIZE
+        cdef char *addrs
+        cdef int ok
+        cdef size_t i
+        if count == 0:
+            return []
+        if not c.ecdsa_read_pubkey(self.node.curve.params, self.node.public_key, &pub):
+            raise ValueError("Invalid public key")
+        addrs = <char *>malloc(count * addrsize)
+        if addrs == NULL:
+            raise MemoryError()
+        try:
+            with nogil:
+                ok = c.hdnode_public_ckd_address_optimized_batch(
+                    &pub, self.node.chain_code, start, count, version,
+                    c.HASHER_SHA2_RIPEMD, c.HASHER_SHA2D, addrs, addrsize, addrformat)
+            if not ok:
+                raise ValueError("Hardened derivation is not possible")
+            return [(<bytes>(addrs + i * addrsize)).decode() for i in range(count)]
+        finally:
+            free(addrs)
+
+
+cdef const c.ecdsa_curve *get_curve(str name) except NULL:
+    if name == "secp256k1":
+        return &c.secp256k1
+    if name == "nist256p1":
+        return &c.nist256p1
+    raise ValueError("Unknown curve")
+
+
+def verify_digests(str curve, list pubkeys, list sigs, list digests) -> list:
+    """Verifies signatures of 32-byte digests, returns a list of booleans.
+    The signatures are checked together, a failing one splits the batch."""
+    cdef const c.ecdsa_curve *cp = get_curve(curve)
+    cdef size_t n = len(pubkeys)
+    cdef size_t done = 0
+    cdef size_t i
+    cdef int r
+    cdef const uint8_t **ptrs
+    if len(sigs) != n or len(digests) != n:
+        raise ValueError("Lists must have the same length")
+    for i in range(n):
+        if len(pubkeys[i]) not in (33, 65) or len(sigs[i]) != 64 or len(digests[i]) != 32:
+            raise ValueError("Invalid length")
+    # the lists keep the bytes objects, and so the buffers, alive
+    keep = [bytes(x) for x in pubkeys + sigs + digests]
+    ptrs = <const uint8_t **>malloc(3 * n * sizeof(uint8_t *) + 1)
+    if ptrs == NULL:
+        raise MemoryError()
+    result = [True] * n
+    try:
+        for i in range(3 * n):
+            ptrs[i] = <const uint8_t *><const char *>keep[i]
+        while done < n:
+            with nogil:
+                r = c.ecdsa_verify_digest_batch(cp, n - done, ptrs + done, ptrs + n + done, ptrs + 2 * n + done)
+            if r == 0:
+                break
+            done += r
+            result[done - 1] = False
+        return result
+    finally:
+        free(ptrs)
+
+
+def schnorr_publickey(bytes secret_key) -> bytes:
+    """Returns the 32-byte BIP-340 public key of the secret key."""
+    cdef uint8_t pub_key[32]
+    if len(secret_key) != 32:
+        raise ValueError("Invalid length of secret key")
+    if c.bip340_get_public_key(&c.secp256k1, <const uint8_t *><const char *>secret_key, pub_key) != 0:
+        raise ValueError("Invalid secret key")
+    return pub_key[:32]
+
+
+def schnorr_sign_digest(bytes secret_key, bytes digest, bytes aux_rand=None) -> bytes:
+    """Signs the 32-byte digest as specified by BIP-340."""
+    cdef uint8_t sig[64]
+    cdef const uint8_t *aux = NULL
+    if len(secret_key) != 32 or len(digest) != 32:
+        raise ValueError("Invalid length")
+    if aux_rand is not None:
+        if len(aux_rand) != 32:
+            raise ValueError("Invalid length of auxiliary randomness")
+        aux = <const uint8_t *><const char *>aux_rand
+    if c.bip340_sign_digest(&c.secp256k1, <const uint8_t *><const char *>secret_key, <const uint8_t *><const char *>digest, aux, sig) != 0:
+        raise ValueError("Signing failed")
+    return sig[:64]
+
+
+def schnorr_verify_digests(list pubkeys, list sigs, list digests) -> list:
+    """Verifies BIP-340 signatures of 32-byte digests, returns a list of
+    booleans. The signatures are checked together, a failing one splits the
+    batch."""
+    cdef size_t n = len(pubkeys)
+    cdef size_t done = 0
+    cdef size_t i
+    cdef int r
+    cdef const uint8_t **ptrs
+    if len(sigs) != n or len(digests) != n:
+        raise ValueError("Lists must have the same length")
+    for i in range(n):
+        if len(pubkeys[i]) != 32 or len(sigs[i]) != 64 or len(digests[i]) != 32:
+            raise ValueError("Invalid length")
+    keep = [bytes(x) for x in pubkeys + sigs + digests]
+    ptrs = <const uint8_t **>malloc(3 * n * sizeof(uint8_t *) + 1)
+    if ptrs == NULL:
+        raise MemoryError()
+    result = [True] * n
+    try:
+        for i in range(3 * n):
+            ptrs[i] = <const uint8_t *><const char *>keep[i]
+        while done < n:
+            with nogil:
+                r = c.bip340_verify_digest_batch(&c.secp256k1, n - done, ptrs + done, ptrs + n + done, ptrs + 2 * n + done)
+            if r == 0:
+                break
+            done += r
+            result[done - 1] = False
+        return result
+    finally:
+        free(ptrs)
+
+
+def recover_pubkeys(str curve, list sigs, list digests, list recids) -> list:
+    """Recovers the uncompressed public keys of 64-byte signatures of 32-byte
+    digests, returns a list with None for the signatures without a key."""
+    cdef const c.ecdsa_curve *cp = get_curve(curve)
+    cdef size_t n = len(sigs)
+    cdef const uint8_t **ptrs
+    cdef int *ids
+    cdef uint8_t *keys
+    cdef size_t i
+    if len(digests) != n or len(recids) != n:
+        raise ValueError("Lists must have the same length")
+    for i in range(n):
+        if len(sigs[i]) != 64 or len(digests[i]) != 32:
+            raise ValueError("Invalid length")
+    keep = [bytes(x) for x in sigs + digests]
+    ptrs = <const uint8_t **>malloc(2 * n * sizeof(uint8_t *) + 1)
+    ids = <int *>malloc(n * sizeof(int) + 1)
+    keys = <uint8_t *>malloc(n * 65 + 1)
+    try:
+        if ptrs == NULL or ids == NULL or keys == NULL:
+            raise MemoryError()
+        for i in range(2 * n):
+            ptrs[i] = <const uint8_t *><const char *>keep[i]
+        for i in range(n):
+            ids[i] = recids[i]
+        with nogil:
+            c.ecdsa_recover_pub_from_sig_batch(cp, n, keys, ptrs, ptrs + n, ids)
+        return [keys[i * 65:(i + 1) * 65] if keys[i * 65] == 0x04 else None for i in range(n)]
+    finally:
+        free(ptrs)
+        free(ids)
+        free(keys)
+
+
+def sha256_many(list msgs) -> list:
+    """Hashes independent messages, several at a time in SIMD lanes."""
+    cdef size_t n = len(msgs)
+    cdef const uint8_t **ptrs
+    cdef size_t *lens
+    cdef uint8_t *digests
+    cdef size_t i
+    keep = [bytes(m) for m in msgs]
+    ptrs = <const uint8_t **>malloc(n * sizeof(uint8_t *) + 1)
+    lens = <size_t *>malloc(n * sizeof(size_t) + 1)
+    digests = <uint8_t *>malloc(n * 32 + 1)
+    try:
+        if ptrs == NULL or lens == NULL or digests == NULL:
+            raise MemoryError()
+        for i in range(n):
+            ptrs[i] = <const uint8_t *><const char *>keep[i]
+            lens[i] = len(keep[i])
+        with nogil:
+            c.sha256_Raw_multi(ptrs, lens, n, digests)
+        return [digests[i * 32:(i + 1) * 32] for i in range(n)]
+    finally:
+        free(ptrs)
+        free(lens)
+        free(digests)
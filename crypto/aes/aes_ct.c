@@ -0,0 +1,508 @@
+/*
+ * Copyright (c) 2016 Thomas Pornin <pornin@bolet.org>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "aes_ct.h"
+#include "memzero.h"
+
+static inline uint32_t dec32le(const uint8_t *src) {
+  return (uint32_t)src[0] | ((uint32_t)src[1] << 8) |
+         ((uint32_t)src[2] << 16) | ((uint32_t)src[3] << 24);
+}
+
+static inline void enc32le(uint8_t *dst, uint32_t x) {
+  dst[0] = (uint8_t)x;
+  dst[1] = (uint8_t)(x >> 8);
+  dst[2] = (uint8_t)(x >> 16);
+  dst[3] = (uint8_t)(x >> 24);
+}
+
+// The bitsliced AES S-box, the circuit of Boyar and Peralta. q[i] holds
+// bit i of all 32 bytes of the state of the two blocks.
+static void bitslice_sbox(uint32_t *q) {
+  uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
+  uint32_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+  uint32_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+  uint32_t y20, y21;
+  uint32_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+  uint32_t z10, z11, z12, z13, z14, z15, z16, z17;
+  uint32_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+  uint32_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+  uint32_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+  uint32_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+  uint32_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+  uint32_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+  uint32_t t60, t61, t62, t63, t64, t65, t66, t67;
+  uint32_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+  x0 = q[7];
+  x1 = q[6];
+  x2 = q[5];
+  x3 = q[4];
+  x4 = q[3];
+  x5 = q[2];
+  x6 = q[1];
+  x7 = q[0];
+
+  // top linear transformation
+  y14 = x3 ^ x5;
+  y13 = x0 ^ x6;
+  y9 = x0 ^ x3;
+  y8 = x0 ^ x5;
+  t0 = x1 ^ x2;
+  y1 = t0 ^ x7;
+  y4 = y1 ^ x3;
+  y12 = y13 ^ y14;
+  y2 = y1 ^ x0;
+  y5 = y1 ^ x6;
+  y3 = y5 ^ y8;
+  t1 = x4 ^ y12;
+  y15 = t1 ^ x5;
+  y20 = t1 ^ x1;
+  y6 = y15 ^ x7;
+  y10 = y15 ^ t0;
+  y11 = y20 ^ y9;
+  y7 = x7 ^ y11;
+  y17 = y10 ^ y11;
+  y19 = y10 ^ y8;
+  y16 = t0 ^ y11;
+  y21 = y13 ^ y16;
+  y18 = x0 ^ y16;
+
+  // non-linear section
+  t2 = y12 & y15;
+  t3 = y3 & y6;
+  t4 = t3 ^ t2;
+  t5 = y4 & x7;
+  t6 = t5 ^ t2;
+  t7 = y13 & y16;
+  t8 = y5 & y1;
+  t9 = t8 ^ t7;
+  t10 = y2 & y7;
+  t11 = t10 ^ t7;
+  t12 = y9 & y11;
+  t13 = y14 & y17;
+  t14 = t13 ^ t12;
+  t15 = y8 & y10;
+  t16 = t15 ^ t12;
+  t17 = t4 ^ t14;
+  t18 = t6 ^ t16;
+  t19 = t9 ^ t14;
+  t20 = t11 ^ t16;
+  t21 = t17 ^ y20;
+  t22 = t18 ^ y19;
+  t23 = t19 ^ y21;
+  t24 = t20 ^ y18;
+
+  t25 = t21 ^ t22;
+  t26 = t21 & t23;
+  t27 = t24 ^ t26;
+  t28 = t25 & t27;
+  t29 = t28 ^ t22;
+  t30 = t23 ^ t24;
+  t31 = t22 ^ t26;
+  t32 = t31 & t30;
+  t33 = t32 ^ t24;
+  t34 = t23 ^ t33;
+  t35 = t27 ^ t33;
+  t36 = t24 & t35;
+  t37 = t36 ^ t34;
+  t38 = t27 ^ t36;
+  t39 = t29 & t38;
+  t40 = t25 ^ t39;
+
+  t41 = t40 ^ t37;
+  t42 = t29 ^ t33;
+  t43 = t29 ^ t40;
+  t44 = t33 ^ t37;
+  t45 = t42 ^ t41;
+  z0 = t44 & y15;
+  z1 = t37 & y6;
+  z2 = t33 & x7;
+  z3 = t43 & y16;
+  z4 = t40 & y1;
+  z5 = t29 & y7;
+  z6 = t42 & y11;
+  z7 = t45 & y17;
+  z8 = t41 & y10;
+  z9 = t44 & y12;
+  z10 = t37 & y3;
+  z11 = t33 & y4;
+  z12 = t43 & y13;
+  z13 = t40 & y5;
+  z14 = t29 & y2;
+  z15 = t42 & y9;
+  z16 = t45 & y14;
+  z17 = t41 & y8;
+
+  // bottom linear transformation
+  t46 = z15 ^ z16;
+  t47 = z10 ^ z11;
+  t48 = z5 ^ z13;
+  t49 = z9 ^ z10;
+  t50 = z2 ^ z12;
+  t51 = z2 ^ z5;
+  t52 = z7 ^ z8;
+  t53 = z0 ^ z3;
+  t54 = z6 ^ z7;
+  t55 = z16 ^ z17;
+  t56 = z12 ^ t48;
+  t57 = t50 ^ t53;
+  t58 = z4 ^ t46;
+  t59 = z3 ^ t54;
+  t60 = t46 ^ t57;
+  t61 = z14 ^ t57;
+  t62 = t52 ^ t58;
+  t63 = t49 ^ t58;
+  t64 = z4 ^ t59;
+  t65 = t61 ^ t62;
+  t66 = z1 ^ t63;
+  s0 = t59 ^ t63;
+  s6 = t56 ^ ~t62;
+  s7 = t48 ^ ~t60;
+  t67 = t64 ^ t65;
+  s3 = t53 ^ t66;
+  s4 = t51 ^ t66;
+  s5 = t47 ^ t65;
+  s1 = t64 ^ ~s3;
+  s2 = t55 ^ ~t67;
+
+  q[7] = s0;
+  q[6] = s1;
+  q[5] = s2;
+  q[4] = s3;
+  q[3] = s4;
+  q[2] = s5;
+  q[1] = s6;
+  q[0] = s7;
+}
+
+// The inverse S-box, computed with the forward one as
+// InvS(x) = A^-1(S(A^-1(x ^ 0x63)) ^ 0x63) where A is the affine map of AES.
+static void inv_affine(uint32_t *q) {
+  uint32_t q0 = ~q[0], q1 = ~q[1], q2 = q[2], q3 = q[3];
+  uint32_t q4 = q[4], q5 = ~q[5], q6 = ~q[6], q7 = q[7];
+  q[7] = q1 ^ q4 ^ q6;
+  q[6] = q0 ^ q3 ^ q5;
+  q[5] = q7 ^ q2 ^ q4;
+  q[4] = q6 ^ q1 ^ q3;
+  q[3] = q5 ^ q0 ^ q2;
+  q[2] = q4 ^ q7 ^ q1;
+  q[1] = q3 ^ q6 ^ q0;
+  q[0] = q2 ^ q5 ^ q7;
+}
+
+static void bitslice_inv_sbox(uint32_t *q) {
+  inv_affine(q);
+  bitslice_sbox(q);
+  inv_affine(q);
+}
+
+#define SWAPN(cl, ch, s, x, y)                                  \
+  do {                                                          \
+    uint32_t a = (x), b = (y);                                  \
+    (x) = (a & (uint32_t)(cl)) | ((b & (uint32_t)(cl)) << (s)); \
+    (y) = ((a & (uint32_t)(ch)) >> (s)) | (b & (uint32_t)(ch)); \
+  } while (0)
+
+#define SWAP2(x, y) SWAPN(0x55555555, 0xAAAAAAAA, 1, x, y)
+#define SWAP4(x, y) SWAPN(0x33333333, 0xCCCCCCCC, 2, x, y)
+#define SWAP8(x, y) SWAPN(0x0F0F0F0F, 0xF0F0F0F0, 4, x, y)
+
+// converts between the bytes of the two blocks and the bitsliced state, the
+// transformation is its own inverse
+static void ortho(uint32_t *q) {
+  SWAP2(q[0], q[1]);
+  SWAP2(q[2], q[3]);
+  SWAP2(q[4], q[5]);
+  SWAP2(q[6], q[7]);
+
+  SWAP4(q[0], q[2]);
+  SWAP4(q[1], q[3]);
+  SWAP4(q[4], q[6]);
+  SWAP4(q[5], q[7]);
+
+  SWAP8(q[0], q[4]);
+  SWAP8(q[1], q[5]);
+  SWAP8(q[2], q[6]);
+  SWAP8(q[3], q[7]);
+}
+
+static void load_blocks(uint32_t *q, const uint8_t *b0, const uint8_t *b1) {
+  for (int i = 0; i < 4; i++) {
+    q[2 * i] = dec32le(b0 + 4 * i);
+    q[2 * i + 1] = dec32le(b1 + 4 * i);
+  }
+  ortho(q);
+}
+
+static void store_blocks(uint8_t *b0, uint8_t *b1, uint32_t *q) {
+  ortho(q);
+  for (int i = 0; i < 4; i++) {
+    enc32le(b0 + 4 * i, q[2 * i]);
+    enc32le(b1 + 4 * i, q[2 * i + 1]);
+  }
+}
+
+static inline void add_round_key(uint32_t *q, const uint32_t *sk) {
+  for (int i = 0; i < 8; i++) {
+    q[i] ^= sk[i];
+  }
+}
+
+static inline void shift_rows(uint32_t *q) {
+  for (int i = 0; i < 8; i++) {
+    uint32_t x = q[i];
+    q[i] = (x & 0x000000FF) | ((x & 0x0000FC00) >> 2) |
+           ((x & 0x00000300) << 6) | ((x & 0x00F00000) >> 4) |
+           ((x & 0x000F0000) << 4) | ((x & 0xC0000000) >> 6) |
+           ((x & 0x3F000000) << 2);
+  }
+}
+
+static inline void inv_shift_rows(uint32_t *q) {
+  for (int i = 0; i < 8; i++) {
+    uint32_t x = q[i];
+    q[i] = (x & 0x000000FF) | ((x & 0x00003F00) << 2) |
+           ((x & 0x0000C000) >> 6) | ((x & 0x000F0000) << 4) |
+           ((x & 0x00F00000) >> 4) | ((x & 0x03000000) << 6) |
+           ((x & 0xFC000000) >> 2);
+  }
+}
+
+static inline uint32_t rotr8(uint32_t x) { return (x << 24) | (x >> 8); }
+
+static inline uint32_t rotr16(uint32_t x) { return (x << 16) | (x >> 16); }
+
+static void mix_columns(uint32_t *q) {
+  uint32_t q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+  uint32_t q4 = q[4], q5 = q[5], q6 = q[6], q7 = q[7];
+  uint32_t r0 = rotr8(q0), r1 = rotr8(q1), r2 = rotr8(q2), r3 = rotr8(q3);
+  uint32_t r4 = rotr8(q4), r5 = rotr8(q5), r6 = rotr8(q6), r7 = rotr8(q7);
+
+  q[0] = q7 ^ r7 ^ r0 ^ rotr16(q0 ^ r0);
+  q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ rotr16(q1 ^ r1);
+  q[2] = q1 ^ r1 ^ r2 ^ rotr16(q2 ^ r2);
+  q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ rotr16(q3 ^ r3);
+  q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ rotr16(q4 ^ r4);
+  q[5] = q4 ^ r4 ^ r5 ^ rotr16(q5 ^ r5);
+  q[6] = q5 ^ r5 ^ r6 ^ rotr16(q6 ^ r6);
+  q[7] = q6 ^ r6 ^ r7 ^ rotr16(q7 ^ r7);
+}
+
+// InvMixColumns is MixColumns after multiplying every column by
+// {04}x^2 + {05}, i.e. a_i ^= {04} * (a_i ^ a_{i+2})
+static void inv_mix_columns(uint32_t *q) {
+  uint32_t u[8];
+  for (int i = 0; i < 8; i++) {
+    u[i] = q[i] ^ rotr16(q[i]);
+  }
+  // u = {04} * u, two doublings with the reduction polynomial 0x11B
+  for (int k = 0; k < 2; k++) {
+    uint32_t h = u[7];
+    u[7] = u[6];
+    u[6] = u[5];
+    u[5] = u[4];
+    u[4] = u[3] ^ h;
+    u[3] = u[2] ^ h;
+    u[2] = u[1];
+    u[1] = u[0] ^ h;
+    u[0] = h;
+  }
+  for (int i = 0; i < 8; i++) {
+    q[i] ^= u[i];
+  }
+  mix_columns(q);
+}
+
+static void encrypt2(const aes_ct_ctx *ctx, uint32_t *q) {
+  add_round_key(q, ctx->sk);
+  for (unsigned int r = 1; r < ctx->rounds; r++) {
+    bitslice_sbox(q);
+    shift_rows(q);
+    mix_columns(q);
+    add_round_key(q, ctx->sk + 8 * r);
+  }
+  bitslice_sbox(q);
+  shift_rows(q);
+  add_round_key(q, ctx->sk + 8 * ctx->rounds);
+}
+
+static void decrypt2(const aes_ct_ctx *ctx, uint32_t *q) {
+  add_round_key(q, ctx->sk + 8 * ctx->rounds);
+  for (unsigned int r = ctx->rounds - 1; r > 0; r--) {
+    inv_shift_rows(q);
+    bitslice_inv_sbox(q);
+    add_round_key(q, ctx->sk + 8 * r);
+    inv_mix_columns(q);
+  }
+  inv_shift_rows(q);
+  bitslice_inv_sbox(q);
+  add_round_key(q, ctx->sk);
+}
+
+static uint32_t sub_word(uint32_t x) {
+  uint32_t q[8] = {x, 0, 0, 0, 0, 0, 0, 0};
+  ortho(q);
+  bitslice_sbox(q);
+  ortho(q);
+  return q[0];
+}
+
+int aes_ct_set_key(aes_ct_ctx *ctx, const uint8_t *key, size_t key_len) {
+  static const uint8_t rcon[10] = {0x01, 0x02, 0x04, 0x08, 0x10,
+                                   0x20, 0x40, 0x80, 0x1B, 0x36};
+  uint32_t w[4 * 15] = {0};
+
+  if (key_len != 16 && key_len != 24 && key_len != 32) {
+    return -1;
+  }
+  size_t nk = key_len / 4;
+  ctx->rounds = nk + 6;
+  size_t nw = 4 * (ctx->rounds + 1);
+
+  for (size_t i = 0; i < nk; i++) {
+    w[i] = dec32le(key + 4 * i);
+  }
+  uint32_t tmp = w[nk - 1];
+  for (size_t i = nk, j = 0, k = 0; i < nw; i++) {
+    if (j == 0) {
+      tmp = (tmp << 24) | (tmp >> 8);
+      tmp = sub_word(tmp) ^ rcon[k];
+    } else if (nk > 6 && j == 4) {
+      tmp = sub_word(tmp);
+    }
+    tmp ^= w[i - nk];
+    w[i] = tmp;
+    if (++j == nk) {
+      j = 0;
+      k++;
+    }
+  }
+
+  // the same round key for both blocks
+  for (size_t i = 0; i < nw; i += 4) {
+    uint32_t *q = ctx->sk + 2 * i;
+    q[0] = q[1] = w[i];
+    q[2] = q[3] = w[i + 1];
+    q[4] = q[5] = w[i + 2];
+    q[6] = q[7] = w[i + 3];
+    ortho(q);
+  }
+
+  memzero(w, sizeof(w));
+  tmp = 0;
+  return 0;
+}
+
+static void ctr_inc(uint8_t ctr[AES_CT_BLOCK_SIZE]) {
+  for (int i = AES_CT_BLOCK_SIZE - 1; i >= 0; i--) {
+    if (++ctr[i] != 0) {
+      return;
+    }
+  }
+}
+
+void aes_ct_ctr_crypt(const aes_ct_ctx *ctx, const uint8_t *in, uint8_t *out,
+                      size_t len, uint8_t ctr[AES_CT_BLOCK_SIZE]) {
+  uint8_t ks[2 * AES_CT_BLOCK_SIZE];
+  uint8_t ctr1[AES_CT_BLOCK_SIZE];
+  uint32_t q[8];
+
+  while (len > 0) {
+    memcpy(ctr1, ctr, AES_CT_BLOCK_SIZE);
+    ctr_inc(ctr1);
+    load_blocks(q, ctr, ctr1);
+    encrypt2(ctx, q);
+    store_blocks(ks, ks + AES_CT_BLOCK_SIZE, q);
+
+    size_t n = len < sizeof(ks) ? len : sizeof(ks);
+    for (size_t i = 0; i < n; i++) {
+      out[i] = in[i] ^ ks[i];
+    }
+    // advance by the number of started blocks
+    ctr_inc(ctr);
+    if (n > AES_CT_BLOCK_SIZE) {
+      ctr_inc(ctr);
+    }
+    in += n;
+    out += n;
+    len -= n;
+  }
+
+  memzero(ks, sizeof(ks));
+  memzero(q, sizeof(q));
+}
+
+void aes_ct_cbc_encrypt(const aes_ct_ctx *ctx, const uint8_t *in, uint8_t *out,
+                        size_t len, uint8_t iv[AES_CT_BLOCK_SIZE]) {
+  uint8_t block[AES_CT_BLOCK_SIZE];
+  uint32_t q[8];
+
+  // the blocks are chained, the second slot of the state is unused
+  for (; len >= AES_CT_BLOCK_SIZE; len -= AES_CT_BLOCK_SIZE) {
+    for (int i = 0; i < AES_CT_BLOCK_SIZE; i++) {
+      block[i] = in[i] ^ iv[i];
+    }
+    load_blocks(q, block, block);
+    encrypt2(ctx, q);
+    store_blocks(iv, block, q);
+    memcpy(out, iv, AES_CT_BLOCK_SIZE);
+    in += AES_CT_BLOCK_SIZE;
+    out += AES_CT_BLOCK_SIZE;
+  }
+
+  memzero(block, sizeof(block));
+  memzero(q, sizeof(q));
+}
+
+void aes_ct_cbc_decrypt(const aes_ct_ctx *ctx, const uint8_t *in, uint8_t *out,
+                        size_t len, uint8_t iv[AES_CT_BLOCK_SIZE]) {
+  uint8_t c[2 * AES_CT_BLOCK_SIZE];
+  uint8_t p[2 * AES_CT_BLOCK_SIZE];
+  uint32_t q[8];
+
+  while (len >= AES_CT_BLOCK_SIZE) {
+    size_t n = len >= sizeof(c) ? sizeof(c) : AES_CT_BLOCK_SIZE;
+    // keep the ciphertext, in and out may overlap
+    memcpy(c, in, n);
+    load_blocks(q, c, c + n - AES_CT_BLOCK_SIZE);
+    decrypt2(ctx, q);
+    store_blocks(p, p + AES_CT_BLOCK_SIZE, q);
+    for (int i = 0; i < AES_CT_BLOCK_SIZE; i++) {
+      out[i] = p[i] ^ iv[i];
+    }
+    for (size_t i = AES_CT_BLOCK_SIZE; i < n; i++) {
+      out[i] = p[i] ^ c[i - AES_CT_BLOCK_SIZE];
+    }
+    memcpy(iv, c + n - AES_CT_BLOCK_SIZE, AES_CT_BLOCK_SIZE);
+    in += n;
+    out += n;
+    len -= n;
+  }
+
+  memzero(p, sizeof(p));
+  memzero(q, sizeof(q));
+}
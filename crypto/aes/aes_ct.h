@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2016 Thomas Pornin <pornin@bolet.org>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __AES_CT_H__
+#define __AES_CT_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Constant-time AES without lookup tables, after the aes_ct implementation
+// of BearSSL. The state of two blocks is kept bitsliced in eight 32-bit words,
+// so the modes that do not chain the blocks (CTR, CBC decryption) process
+// two blocks per round function.
+
+#define AES_CT_BLOCK_SIZE 16
+
+typedef struct {
+  // bitsliced round keys, 8 words per round
+  uint32_t sk[8 * 15];
+  unsigned int rounds;
+} aes_ct_ctx;
+
+// key_len is 16, 24 or 32, returns 0 on success
+int aes_ct_set_key(aes_ct_ctx *ctx, const uint8_t *key, size_t key_len);
+
+// counter mode with a 128-bit big-endian counter, as aes_ctr_cbuf_inc()
+// increments it. ctr is updated to the first unused counter value, so
+// consecutive calls continue the key stream if len is a multiple of the block
+// size in all but the last of them.
+void aes_ct_ctr_crypt(const aes_ct_ctx *ctx, const uint8_t *in, uint8_t *out,
+                      size_t len, uint8_t ctr[AES_CT_BLOCK_SIZE]);
+
+// len is a multiple of the block size, iv is updated to the last ciphertext
+// block. in and out may be the same buffer.
+void aes_ct_cbc_encrypt(const aes_ct_ctx *ctx, const uint8_t *in, uint8_t *out,
+                        size_t len, uint8_t iv[AES_CT_BLOCK_SIZE]);
+void aes_ct_cbc_decrypt(const aes_ct_ctx *ctx, const uint8_t *in, uint8_t *out,
+                        size_t len, uint8_t iv[AES_CT_BLOCK_SIZE]);
+
+#endif
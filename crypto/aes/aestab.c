@@ -22,6 +22,7 @@ Issue Date: 20/12/2007
 
 #include "aes.h"
 #include "aesopt.h"
+#include "options.h"
 
 #if defined(STATIC_TABLES)
 
@@ -88,6 +88,8 @@ extern "C" {
 
 #if defined(_MSC_VER) && defined(TABLE_ALIGN)
 #define ALIGN __declspec(align(TABLE_ALIGN))
+#elif defined(DO_TABLES) && USE_FAST_TABLE_AES
+#define ALIGN FAST_TABLE_SECTION
 #else
 #define ALIGN
 #endif
@@ -46,6 +46,27 @@ typedef uint32_t b58_almostmaxint_t;
 static const b58_almostmaxint_t b58_almostmaxint_mask =
     ((((b58_maxint_t)1) << b58_almostmaxint_bits) - 1);
 
+// The conversions work on limbs holding several base58 digits at once.
+// Decoding multiplies the 32-bit output words by 58^5 < 2^30 per step, which
+// only needs a 32x32->64 bit multiplication. Encoding divides by the limb
+// base, so 64-bit hosts take 4 input bytes at a time into 58^5 limbs, while
+// 32-bit targets take 1 byte at a time into 58^4 limbs to stay within native
+// 32-bit division by a constant.
+#define B58_DECODE_DIGITS 5
+static const b58_almostmaxint_t b58_powers[B58_DECODE_DIGITS + 1] = {
+    1, 58, 3364, 195112, 11316496, 656356768};
+
+#if UINTPTR_MAX > 0xFFFFFFFF
+typedef uint64_t b58_wideint_t;
+#define B58_ENCODE_BYTES 4
+#define B58_ENCODE_DIGITS 5
+#else
+typedef uint32_t b58_wideint_t;
+#define B58_ENCODE_BYTES 1
+#define B58_ENCODE_DIGITS 4
+#endif
+#define B58_ENCODE_BASE ((b58_wideint_t)b58_powers[B58_ENCODE_DIGITS])
+
 // Decodes a null-terminated Base58 string `b58` to binary and writes the result
 // at the end of the buffer `bin` of size `*binszp`. On success `*binszp` is set
 // to the number of valid bytes at the end of the buffer.
@@ -62,8 +83,8 @@ bool b58tobin(void *bin, size_t *binszp, const char *b58) {
       (binsz + sizeof(b58_almostmaxint_t) - 1) / sizeof(b58_almostmaxint_t);
   b58_almostmaxint_t outi[outisz];
   b58_maxint_t t = 0;
-  b58_almostmaxint_t c = 0;
-  size_t i = 0, j = 0;
+  b58_almostmaxint_t c = 0, m = 0;
+  size_t i = 0, j = 0, k = 0;
   uint8_t bytesleft = binsz % sizeof(b58_almostmaxint_t);
   b58_almostmaxint_t zeromask =
       bytesleft ? (b58_almostmaxint_mask << (bytesleft * 8)) : 0;
@@ -76,16 +97,21 @@ bool b58tobin(void *bin, size_t *binszp, const char *b58) {
   // Leading zeros, just count
   for (i = 0; i < b58sz && b58u[i] == '1'; ++i) ++zerocount;
 
-  for (; i < b58sz; ++i) {
-    if (b58u[i] & 0x80)
-      // High-bit set on invalid digit
-      return false;
-    if (b58digits_map[b58u[i]] == -1)
-      // Invalid base58 digit
-      return false;
-    c = (unsigned)b58digits_map[b58u[i]];
+  while (i < b58sz) {
+    // Collect up to B58_DECODE_DIGITS digits into c
+    c = 0;
+    for (k = 0; k < B58_DECODE_DIGITS && i < b58sz; ++k, ++i) {
+      if (b58u[i] & 0x80)
+        // High-bit set on invalid digit
+        return false;
+      if (b58digits_map[b58u[i]] == -1)
+        // Invalid base58 digit
+        return false;
+      c = c * 58 + (unsigned)b58digits_map[b58u[i]];
+    }
+    m = b58_powers[k];
     for (j = outisz; j--;) {
-      t = ((b58_maxint_t)outi[j]) * 58 + c;
+      t = ((b58_maxint_t)outi[j]) * m + c;
       c = t >> b58_almostmaxint_bits;
       outi[j] = t & b58_almostmaxint_mask;
     }
@@ -147,21 +173,29 @@ int b58check(const void *bin, size_t binsz, HasherType hasher_type,
 
 bool b58enc(char *b58, size_t *b58sz, const void *data, size_t binsz) {
   const uint8_t *bin = data;
-  int carry = 0;
-  size_t i = 0, j = 0, high = 0, zcount = 0;
-  size_t size = 0;
+  b58_wideint_t carry = 0;
+  size_t i = 0, j = 0, k = 0, high = 0, zcount = 0, digits = 0;
+  size_t size = 0, step = 0;
 
   while (zcount < binsz && !bin[zcount]) ++zcount;
 
-  size = (binsz - zcount) * 138 / 100 + 1;
-  uint8_t buf[size];
-  memzero(buf, size);
+  // One spare limb keeps buf[0] zero, like the spare digit of the bytewise
+  // version, so the early exit on j == 0 below never drops a carry
+  size = ((binsz - zcount) * 138 / 100 + B58_ENCODE_DIGITS) / B58_ENCODE_DIGITS +
+         1;
+  b58_almostmaxint_t buf[size];
+  memzero(buf, sizeof(buf));
 
-  for (i = zcount, high = size - 1; i < binsz; ++i, high = j) {
-    for (carry = bin[i], j = size - 1; (j > high) || carry; --j) {
-      carry += 256 * buf[j];
-      buf[j] = carry % 58;
-      carry /= 58;
+  // The first step takes the bytes that do not fill a whole input word
+  step = (binsz - zcount) % B58_ENCODE_BYTES;
+  if (step == 0) step = B58_ENCODE_BYTES;
+  for (i = zcount, high = size - 1; i < binsz;
+       i += step, step = B58_ENCODE_BYTES, high = j) {
+    for (carry = 0, k = 0; k < step; ++k) carry = (carry << 8) | bin[i + k];
+    for (j = size - 1; (j > high) || carry; --j) {
+      carry += (b58_wideint_t)buf[j] << (8 * step);
+      buf[j] = carry % B58_ENCODE_BASE;
+      carry /= B58_ENCODE_BASE;
       if (!j) {
         // Otherwise j wraps to maxint which is > high
         break;
@@ -172,15 +206,29 @@ bool b58enc(char *b58, size_t *b58sz, const void *data, size_t binsz) {
   for (j = 0; j < size && !buf[j]; ++j)
     ;
 
-  if (*b58sz <= zcount + size - j) {
-    *b58sz = zcount + size - j + 1;
+  if (j < size) {
+    // Significant digits of the leading limb plus all digits of the others
+    for (digits = 1; digits < B58_ENCODE_DIGITS && buf[j] >= b58_powers[digits];
+         ++digits)
+      ;
+    digits += (size - j - 1) * B58_ENCODE_DIGITS;
+  }
+
+  if (*b58sz <= zcount + digits) {
+    *b58sz = zcount + digits + 1;
     return false;
   }
 
   if (zcount) memset(b58, '1', zcount);
-  for (i = zcount; j < size; ++i, ++j) b58[i] = b58digits_ordered[buf[j]];
-  b58[i] = '\0';
-  *b58sz = i + 1;
+  for (i = zcount + digits, k = size; k-- > j;) {
+    b58_almostmaxint_t limb = buf[k];
+    for (size_t d = 0; d < B58_ENCODE_DIGITS && i > zcount; ++d) {
+      b58[--i] = b58digits_ordered[limb % 58];
+      limb /= 58;
+    }
+  }
+  b58[zcount + digits] = '\0';
+  *b58sz = zcount + digits + 1;
 
   return true;
 }
@@ -519,10 +519,141 @@ void bn_mod(bignum256 *x, const bignum256 *prime) {
   memzero(&temp, sizeof(temp));
 }
 
+#if USE_BN_64BIT
+
+#if !defined(__SIZEOF_INT128__)
+#error "USE_BN_64BIT requires unsigned __int128"
+#endif
+
+#define BN_LIMBS_64 5
+
+// Auxiliary function for bn_multiply
+// out = x, written as little endian number in base 2**64
+// Assumes x is normalized
+static void bn_pack64(const bignum256 *x, uint64_t out[BN_LIMBS_64]) {
+  uint64_t acc = 0;
+  int bits = 0, j = 0;
+
+  for (int i = 0; i < BN_LIMBS; i++) {
+    acc |= (uint64_t)x->val[i] << bits;
+    bits += BN_BITS_PER_LIMB;
+    if (bits >= 64) {
+      out[j++] = acc;
+      bits -= 64;
+      // the bits of x->val[i] that didn't fit into out[j - 1]
+      acc = bits > 0 ? x->val[i] >> (BN_BITS_PER_LIMB - bits) : 0;
+    }
+  }
+  // j == BN_LIMBS_64 - 1 since 64 * 4 <= 29 * 9 < 64 * 5
+  out[j] = acc;
+}
+
+// Auxiliary function for bn_multiply
+// res = in, written as normalized little endian number in base 2**29
+// Assumes in is a little endian number of in_len digits in base 2**64
+// Assumes in < 2**(29 * res_len)
+static void bn_unpack64(const uint64_t *in, int in_len, uint32_t *res,
+                        int res_len) {
+  for (int i = 0; i < res_len; i++) {
+    int pos = i * BN_BITS_PER_LIMB;
+    int limb = pos / 64, shift = pos % 64;
+    uint64_t digit = in[limb] >> shift;
+    if (shift > 64 - BN_BITS_PER_LIMB && limb + 1 < in_len) {
+      digit |= in[limb + 1] << (64 - shift);
+    }
+    res[i] = digit & BN_LIMB_MASK;
+  }
+}
+
+// Auxiliary function for bn_multiply
+// res = k * x, written as little endian number in base 2**64
+// Assumes k and x are written as little endian numbers in base 2**64
+static void bn_multiply_long64(const uint64_t k[BN_LIMBS_64],
+                               const uint64_t x[BN_LIMBS_64],
+                               uint64_t res[2 * BN_LIMBS_64]) {
+  for (int i = 0; i < 2 * BN_LIMBS_64; i++) {
+    res[i] = 0;
+  }
+
+  for (int i = 0; i < BN_LIMBS_64; i++) {
+    unsigned __int128 acc = 0;
+    for (int j = 0; j < BN_LIMBS_64; j++) {
+      acc += (unsigned __int128)k[i] * x[j] + res[i + j];
+      // acc doesn't overflow 128 bits
+      // Proof:
+      //   acc <= (2**64 - 1) + (2**64 - 1) * (2**64 - 1) + (2**64 - 1)
+      //     == 2**128 - 1
+      res[i + j] = (uint64_t)acc;
+      acc >>= 64;
+    }
+    res[i + BN_LIMBS_64] = (uint64_t)acc;
+  }
+}
+
+// Auxiliary function for bn_multiply
+// Maximal bit length of 2**256 - prime for which bn_multiply_fold is used
+#define BN_FOLD_MAX_BITS 192
+#define BN_FOLD_LIMBS (BN_FOLD_MAX_BITS / 64)
+
+// Auxiliary function for bn_multiply
+// Partly reduces res modulo prime == 2**256 - c by repeatedly replacing
+//   res by res % 2**256 + (res // 2**256) * c
+// and stores the result in x
+// Assumes res < 2**522 is written as little endian number in base 2**64
+// Assumes c < 2**cbits, cbits <= BN_FOLD_MAX_BITS
+// Guarantees x is normalized and partly reduced modulo prime
+// The function has constant control flow with regard to res
+static void bn_multiply_fold(bignum256 *x, uint64_t res[2 * BN_LIMBS_64],
+                             const uint64_t c[BN_FOLD_LIMBS], int cbits) {
+  uint64_t tmp[2 * BN_LIMBS_64] = {0};
+
+  // res < 2**bound
+  int bound = 2 * BN_LIMBS * BN_BITS_PER_LIMB;
+  // 2**256 + 2**254 + 2 * c <= 2 * 2**256 - 2 * 2**224 <= 2 * prime
+  // hence res < 2**256 + 2**254 implies res is partly reduced
+  while (bound > 256) {
+    // tmp = res % 2**256 + (res // 2**256) * c
+    for (int i = 0; i < 2 * BN_LIMBS_64; i++) {
+      tmp[i] = i < 4 ? res[i] : 0;
+    }
+    for (int i = 0; i < (cbits + 63) / 64; i++) {
+      unsigned __int128 acc = 0;
+      for (int j = 0; j < 2 * BN_LIMBS_64 - 4; j++) {
+        acc += (unsigned __int128)c[i] * res[4 + j] + tmp[i + j];
+        tmp[i + j] = (uint64_t)acc;
+        acc >>= 64;
+      }
+      for (int j = i + 2 * BN_LIMBS_64 - 4; j < 2 * BN_LIMBS_64; j++) {
+        acc += tmp[j];
+        tmp[j] = (uint64_t)acc;
+        acc >>= 64;
+      }
+    }
+    for (int i = 0; i < 2 * BN_LIMBS_64; i++) {
+      res[i] = tmp[i];
+    }
+
+    // res < 2**256 + 2**(bound - 256) * c
+    int excess = bound - 256 + cbits;
+    if (excess <= 254) {
+      break;
+    }
+    bound = excess + 1;
+  }
+
+  bn_unpack64(res, BN_LIMBS_64, x->val, BN_LIMBS);
+
+  memzero(tmp, sizeof(tmp));
+}
+
+#endif
+
+#if !USE_BN_ARMV7M
 // Auxiliary function for bn_multiply
 // res = k * x
 // Assumes k and x are normalized
 // Guarantees res is normalized 18 digit little endian number in base 2**29
+// See bignum_armv7m.S for the assembly implementation used with USE_BN_ARMV7M
 void bn_multiply_long(const bignum256 *k, const bignum256 *x,
                       uint32_t res[2 * BN_LIMBS]) {
   // Uses long multiplication in base 2**29, see
@@ -568,6 +699,7 @@ void bn_multiply_long(const bignum256 *k, const bignum256 *x,
 
   res[2 * BN_LIMBS - 1] = acc;
 }
+#endif
 
 // Auxiliary function for bn_multiply
 // Assumes 0 <= d <= 8 == LIMBS - 1
@@ -690,6 +822,130 @@ void bn_multiply_reduce(bignum256 *x, uint32_t res[2 * BN_LIMBS],
   }
 }
 
+#define BN_SPECIAL_WORDS 8
+#define BN_SPECIAL_ROUNDS 3
+
+// Auxiliary function for bn_multiply
+// Partly reduces res modulo a prime of the form 2**256 - c, where c is a short
+// signed sum of powers of 2**32, and stores it in x
+// Assumes 2**256 == sum(coef[i] * 2**(32 * offset[i])) modulo prime
+// Assumes 2**256 - 2**224 <= prime <= 2**256
+// Assumes res in normalized and res < 2**519
+// Guarantees x is normalized and x < 2**256, hence partly reduced
+static inline void bn_multiply_reduce_special(bignum256 *x,
+                                              const uint32_t res[2 * BN_LIMBS],
+                                              int terms, const int offset[],
+                                              const int32_t coef[]) {
+  // Uses signed 32-bit words, folding the words above 2**256 down, see
+  // https://en.wikipedia.org/wiki/Solinas_prime
+  // Relies on the right shift of a negative number being arithmetic
+  int64_t t[2 * BN_SPECIAL_WORDS + 1] = {0};
+  uint64_t acc = 0;
+  int bits = 0, j = 0;
+
+  // t = res in base 2**32
+  for (int i = 0; i < 2 * BN_LIMBS; i++) {
+    acc |= (uint64_t)res[i] << bits;
+    bits += BN_BITS_PER_LIMB;
+    if (bits >= 32) {
+      t[j++] = acc & 0xFFFFFFFF;
+      acc >>= 32;
+      bits -= 32;
+    }
+  }
+  t[j] = acc;
+
+  // t[i] * 2**(32 * i) == t[i] * 2**(32 * (i - 8)) * 2**256
+  for (int i = 2 * BN_SPECIAL_WORDS; i >= BN_SPECIAL_WORDS; i--) {
+    for (int k = 0; k < terms; k++) {
+      t[i - BN_SPECIAL_WORDS + offset[k]] += coef[k] * t[i];
+    }
+    t[i] = 0;
+  }
+  // |t[i]| < 2**43 for i < 8
+
+  // Every round normalizes t and folds the carry above 2**256 back
+  // Proof that the carry of the last round is zero:
+  //   2**256 - prime < 2**224
+  //   first round: |carry| < 2**12, hence -2**236 < t < 2**256 + 2**236
+  //   second round: carry in {-1, 0, 1}
+  //     if carry == 1 then t < 2**236 + 2**224
+  //     if carry == -1 then 2**256 - 2**236 - 2**224 <= t < 2**256
+  //   third round: carry == 0
+  for (int round = 0; round < BN_SPECIAL_ROUNDS; round++) {
+    for (int i = 0; i < BN_SPECIAL_WORDS; i++) {
+      t[i + 1] += t[i] >> 32;
+      t[i] &= 0xFFFFFFFF;
+    }
+    int64_t carry = t[BN_SPECIAL_WORDS];
+    t[BN_SPECIAL_WORDS] = 0;
+    for (int k = 0; k < terms; k++) {
+      t[offset[k]] += coef[k] * carry;
+    }
+  }
+
+  // x = t in base 2**29
+  acc = 0;
+  bits = 0;
+  j = 0;
+  for (int i = 0; i < BN_SPECIAL_WORDS; i++) {
+    acc |= (uint64_t)t[i] << bits;
+    bits += 32;
+    while (bits >= BN_BITS_PER_LIMB) {
+      x->val[j++] = acc & BN_LIMB_MASK;
+      acc >>= BN_BITS_PER_LIMB;
+      bits -= BN_BITS_PER_LIMB;
+    }
+  }
+  x->val[j] = acc;
+
+  memzero(t, sizeof(t));
+}
+
+// Auxiliary function for bn_multiply, see bn_multiply_reduce_special
+// 2**256 == 2**32 + 977 modulo the secp256k1 prime
+static void bn_multiply_reduce_secp256k1(bignum256 *x,
+                                         const uint32_t res[2 * BN_LIMBS]) {
+  static const int offset[] = {0, 1};
+  static const int32_t coef[] = {977, 1};
+  bn_multiply_reduce_special(x, res, 2, offset, coef);
+}
+
+// Auxiliary function for bn_multiply, see bn_multiply_reduce_special
+// 2**256 == 2**224 - 2**192 - 2**96 + 1 modulo the nist256p1 prime
+static void bn_multiply_reduce_nist256p1(bignum256 *x,
+                                         const uint32_t res[2 * BN_LIMBS]) {
+  static const int offset[] = {0, 3, 6, 7};
+  static const int32_t coef[] = {1, -1, -1, 1};
+  bn_multiply_reduce_special(x, res, 4, offset, coef);
+}
+
+typedef struct {
+  bignum256 prime;
+  void (*reduce)(bignum256 *x, const uint32_t res[2 * BN_LIMBS]);
+} bn_special_prime;
+
+static const bn_special_prime bn_special_primes[] = {
+    {{{0x1ffffc2f, 0x1ffffff7, 0x1fffffff, 0x1fffffff, 0x1fffffff, 0x1fffffff,
+       0x1fffffff, 0x1fffffff, 0xffffff}},
+     bn_multiply_reduce_secp256k1},
+    {{{0x1fffffff, 0x1fffffff, 0x1fffffff, 0x000001ff, 0x00000000, 0x00000000,
+       0x00040000, 0x1fe00000, 0xffffff}},
+     bn_multiply_reduce_nist256p1},
+};
+
+// Returns the special reduction for prime or NULL if there is none
+static const bn_special_prime *bn_special_prime_find(const bignum256 *prime) {
+  for (size_t i = 0; i < sizeof(bn_special_primes) / sizeof(*bn_special_primes);
+       i++) {
+    if (bn_is_equal(prime, &bn_special_primes[i].prime)) {
+      return &bn_special_primes[i];
+    }
+  }
+  return NULL;
+}
+
+#if !USE_BN_64BIT
 // x = k * x % prime
 // Assumes k, x are normalized, k * x < 2**519
 // Guarantees x is normalized and partly reduced modulo prime
@@ -698,10 +954,66 @@ void bn_multiply(const bignum256 *k, bignum256 *x, const bignum256 *prime) {
   uint32_t res[2 * BN_LIMBS] = {0};
 
   bn_multiply_long(k, x, res);
-  bn_multiply_reduce(x, res, prime);
+  const bn_special_prime *special = bn_special_prime_find(prime);
+  if (special != NULL) {
+    special->reduce(x, res);
+  } else {
+    bn_multiply_reduce(x, res, prime);
+  }
 
   memzero(res, sizeof(res));
 }
+#else
+// x = k * x % prime
+// Assumes k, x are normalized, k * x < 2**519
+// Guarantees x is normalized and partly reduced modulo prime
+// Assumes prime is normalized, 2**256 - 2**224 <= prime <= 2**256
+void bn_multiply(const bignum256 *k, bignum256 *x, const bignum256 *prime) {
+  uint64_t k64[BN_LIMBS_64] = {0}, x64[BN_LIMBS_64] = {0};
+  uint64_t r64[2 * BN_LIMBS_64] = {0};
+  uint64_t c[BN_LIMBS_64] = {0};
+
+  // c = 2**256 - prime
+  bn_pack64(prime, c);
+  unsigned __int128 borrow = 0;
+  for (int i = 0; i < 4; i++) {
+    borrow = (unsigned __int128)0 - c[i] - (uint64_t)borrow;
+    c[i] = (uint64_t)borrow;
+    borrow = (borrow >> 64) & 1;
+  }
+  int cbits = 0;
+  for (int i = 3; i >= 0; i--) {
+    if (c[i] != 0) {
+      cbits = 64 * i + 64 - __builtin_clzll(c[i]);
+      break;
+    }
+  }
+
+  // cbits depends only on prime, so the branch leaks no secret data
+  if (cbits <= BN_FOLD_MAX_BITS) {
+    bn_pack64(k, k64);
+    bn_pack64(x, x64);
+    bn_multiply_long64(k64, x64, r64);
+    bn_multiply_fold(x, r64, c, cbits);
+  } else {
+    // folding would take too many rounds, e.g. for NIST P-256, which has a
+    // special reduction instead
+    uint32_t res[2 * BN_LIMBS] = {0};
+    bn_multiply_long(k, x, res);
+    const bn_special_prime *special = bn_special_prime_find(prime);
+    if (special != NULL) {
+      special->reduce(x, res);
+    } else {
+      bn_multiply_reduce(x, res, prime);
+    }
+    memzero(res, sizeof(res));
+  }
+
+  memzero(k64, sizeof(k64));
+  memzero(x64, sizeof(x64));
+  memzero(r64, sizeof(r64));
+}
+#endif
 
 // Partly reduces x modulo prime
 // Assumes limbs of x except the last (the most significant) one are normalized
@@ -1197,6 +1509,249 @@ void bn_inverse_fast(bignum256 *x, const bignum256 *prime) {
   memzero(&s, sizeof(s));
 }
 
+// Numbers in the safegcd inversion are kept as BN_LIMBS signed limbs of
+// SAFEGCD_BITS bits, sum([v[i] * 2**(30*i) for i in range(9)]), so that a
+// 270-bit number also fits the signed intermediate values
+#define SAFEGCD_BITS 30
+#define SAFEGCD_MASK ((1u << SAFEGCD_BITS) - 1)
+
+// A transition matrix [[u, v], [q, r]] of SAFEGCD_BITS divsteps scaled by
+// 2**SAFEGCD_BITS, all elements are in [-2**30, 2**30]
+typedef struct {
+  int32_t u, v, q, r;
+} safegcd_matrix;
+
+// res = x in the signed 30-bit representation
+// Assumes x is normalized and x < 2**256
+static void safegcd_from_bn(const bignum256 *x, int32_t res[BN_LIMBS]) {
+  for (int j = 0; j < BN_LIMBS; j++) {
+    // the bits 30*j to 30*j + 29 span at most two 29-bit limbs
+    int i = SAFEGCD_BITS * j / BN_BITS_PER_LIMB;
+    int shift = SAFEGCD_BITS * j % BN_BITS_PER_LIMB;
+    uint32_t limb = x->val[i] >> shift;
+    if (i + 1 < BN_LIMBS) {
+      limb |= x->val[i + 1] << (BN_BITS_PER_LIMB - shift);
+    }
+    res[j] = limb & SAFEGCD_MASK;
+  }
+}
+
+// res = x in the bignum256 representation
+// Assumes all limbs of x are in [0, 2**30) and x < 2**256
+// Guarantees res is normalized
+static void safegcd_to_bn(const int32_t x[BN_LIMBS], bignum256 *res) {
+  for (int i = 0; i < BN_LIMBS; i++) {
+    // the bits 29*i to 29*i + 28 span at most two 30-bit limbs
+    int j = BN_BITS_PER_LIMB * i / SAFEGCD_BITS;
+    int shift = BN_BITS_PER_LIMB * i % SAFEGCD_BITS;
+    uint32_t limb = (uint32_t)x[j] >> shift;
+    if (j + 1 < BN_LIMBS) {
+      limb |= (uint32_t)x[j + 1] << (SAFEGCD_BITS - shift);
+    }
+    res->val[i] = limb & BN_LIMB_MASK;
+  }
+}
+
+// Applies SAFEGCD_BITS divsteps to the low bits f0, g0 of f and g and returns
+// the new zeta == -(delta + 1/2), the transition matrix is stored in t
+// Assumes f0 is odd
+// The function has constant control flow and constant memory access flow
+static int32_t safegcd_divsteps(int32_t zeta, uint32_t f0, uint32_t g0,
+                                safegcd_matrix *t) {
+  // The matrix elements are signed, they are computed modulo 2**32 so that
+  // the left shifts are well defined
+  uint32_t u = 1, v = 0, q = 0, r = 1;
+  uint32_t f = f0, g = g0;
+  volatile uint32_t c1 = 0, c2 = 0;
+
+  for (int i = 0; i < SAFEGCD_BITS; i++) {
+    // mask1 = -1 if zeta < 0 else 0
+    c1 = (uint32_t)(zeta >> 31);
+    uint32_t mask1 = c1;
+    // mask2 = -1 if g is odd else 0
+    c2 = g & 1;
+    uint32_t mask2 = -c2;
+
+    // x, y, z = -f, -u, -v if zeta < 0 else f, u, v
+    uint32_t x = (f ^ mask1) - mask1;
+    uint32_t y = (u ^ mask1) - mask1;
+    uint32_t z = (v ^ mask1) - mask1;
+
+    // g, q, r += x, y, z if g is odd
+    g += x & mask2;
+    q += y & mask2;
+    r += z & mask2;
+
+    // if zeta < 0 and g was odd, swap the roles of f and g:
+    //   zeta = -zeta - 2, f, u, v += g, q, r
+    // otherwise
+    //   zeta = zeta - 1
+    mask1 &= mask2;
+    zeta = (zeta ^ (int32_t)mask1) - 1;
+    f += g & mask1;
+    u += q & mask1;
+    v += r & mask1;
+
+    g >>= 1;
+    u <<= 1;
+    v <<= 1;
+  }
+
+  t->u = (int32_t)u;
+  t->v = (int32_t)v;
+  t->q = (int32_t)q;
+  t->r = (int32_t)r;
+
+  return zeta;
+}
+
+// [d, e] = (t * [d, e] + prime * [md, me]) / 2**30, where md and me are
+// chosen so that the division is exact and d, e stay in (-2 * prime, prime)
+// prime_inv == (1 / prime) % 2**30
+static void safegcd_update_de(int32_t d[BN_LIMBS], int32_t e[BN_LIMBS],
+                              const safegcd_matrix *t,
+                              const int32_t prime[BN_LIMBS],
+                              uint32_t prime_inv) {
+  const int32_t u = t->u, v = t->v, q = t->q, r = t->r;
+
+  // [md, me] = [u, q] if d < 0 else 0, plus [v, r] if e < 0
+  int32_t sd = d[BN_LIMBS - 1] >> 31, se = e[BN_LIMBS - 1] >> 31;
+  int32_t md = (u & sd) + (v & se);
+  int32_t me = (q & sd) + (r & se);
+
+  int64_t cd = (int64_t)u * d[0] + (int64_t)v * e[0];
+  int64_t ce = (int64_t)q * d[0] + (int64_t)r * e[0];
+
+  // make the low 30 bits of t * [d, e] + prime * [md, me] zero
+  md -= (prime_inv * (uint32_t)cd + md) & SAFEGCD_MASK;
+  me -= (prime_inv * (uint32_t)ce + me) & SAFEGCD_MASK;
+
+  cd += (int64_t)prime[0] * md;
+  ce += (int64_t)prime[0] * me;
+  cd >>= SAFEGCD_BITS;
+  ce >>= SAFEGCD_BITS;
+
+  for (int i = 1; i < BN_LIMBS; i++) {
+    cd += (int64_t)u * d[i] + (int64_t)v * e[i] + (int64_t)prime[i] * md;
+    ce += (int64_t)q * d[i] + (int64_t)r * e[i] + (int64_t)prime[i] * me;
+    d[i - 1] = (int32_t)cd & SAFEGCD_MASK;
+    e[i - 1] = (int32_t)ce & SAFEGCD_MASK;
+    cd >>= SAFEGCD_BITS;
+    ce >>= SAFEGCD_BITS;
+  }
+
+  d[BN_LIMBS - 1] = (int32_t)cd;
+  e[BN_LIMBS - 1] = (int32_t)ce;
+}
+
+// [f, g] = t * [f, g] / 2**30
+// The division is exact as t is the matrix of 30 divsteps of f and g
+static void safegcd_update_fg(int32_t f[BN_LIMBS], int32_t g[BN_LIMBS],
+                              const safegcd_matrix *t) {
+  const int32_t u = t->u, v = t->v, q = t->q, r = t->r;
+
+  int64_t cf = (int64_t)u * f[0] + (int64_t)v * g[0];
+  int64_t cg = (int64_t)q * f[0] + (int64_t)r * g[0];
+  cf >>= SAFEGCD_BITS;
+  cg >>= SAFEGCD_BITS;
+
+  for (int i = 1; i < BN_LIMBS; i++) {
+    cf += (int64_t)u * f[i] + (int64_t)v * g[i];
+    cg += (int64_t)q * f[i] + (int64_t)r * g[i];
+    f[i - 1] = (int32_t)cf & SAFEGCD_MASK;
+    g[i - 1] = (int32_t)cg & SAFEGCD_MASK;
+    cf >>= SAFEGCD_BITS;
+    cg >>= SAFEGCD_BITS;
+  }
+
+  f[BN_LIMBS - 1] = (int32_t)cf;
+  g[BN_LIMBS - 1] = (int32_t)cg;
+}
+
+// x = -x if sign < 0 else x, reduced from (-2 * prime, prime) to [0, prime)
+// Guarantees all limbs of x are in [0, 2**30)
+static void safegcd_normalize(int32_t x[BN_LIMBS], int32_t sign,
+                              const int32_t prime[BN_LIMBS]) {
+  volatile int32_t cond_add = 0, cond_negate = 0;
+
+  // x = x + prime if x < 0, x is in (-prime, prime) then
+  cond_add = x[BN_LIMBS - 1] >> 31;
+  for (int i = 0; i < BN_LIMBS; i++) {
+    x[i] += prime[i] & cond_add;
+  }
+  cond_negate = sign >> 31;
+  for (int i = 0; i < BN_LIMBS; i++) {
+    x[i] = (x[i] ^ cond_negate) - cond_negate;
+  }
+  for (int i = 0; i < BN_LIMBS - 1; i++) {
+    x[i + 1] += x[i] >> SAFEGCD_BITS;
+    x[i] &= SAFEGCD_MASK;
+  }
+
+  // x = x + prime if x < 0, x is in [0, prime) then
+  cond_add = x[BN_LIMBS - 1] >> 31;
+  for (int i = 0; i < BN_LIMBS; i++) {
+    x[i] += prime[i] & cond_add;
+  }
+  for (int i = 0; i < BN_LIMBS - 1; i++) {
+    x[i + 1] += x[i] >> SAFEGCD_BITS;
+    x[i] &= SAFEGCD_MASK;
+  }
+}
+
+// x = 1/x % prime if x != 0 else 0
+// Assumes x is normalized
+// Assumes GCD(x, prime) = 1
+// Guarantees x is normalized and fully reduced modulo prime
+// Assumes prime is odd, normalized, 2**256 - 2**224 <= prime < 2**256
+// The function has constant control flow and constant memory access flow
+//   with regard to prime and x
+void bn_inverse_safegcd(bignum256 *x, const bignum256 *prime) {
+  // "Fast constant-time gcd computation and modular inversion" by Daniel J.
+  // Bernstein and Bo-Yin Yang, see https://gcd.cr.yp.to/safegcd-20190413.pdf
+  // The divsteps are batched 30 at a time on the low bits of f and g, as in
+  // the modinv32 module of libsecp256k1
+
+  /*
+    zeta, d, e, f, g = -1, 0, 1, prime, x % prime
+    # 590 divsteps suffice for 256-bit numbers
+    for i in range(20):
+      t = divsteps(zeta, f, g) # 30 divsteps
+      d, e = (t * [d, e] + prime * [md, me]) / 2**30
+      f, g = t * [f, g] / 2**30
+    # g == 0, f == +-1 and d == +-1/x % prime
+    return d if f > 0 else -d
+  */
+
+  bn_fast_mod(x, prime);
+  bn_mod(x, prime);
+
+  int32_t p[BN_LIMBS] = {0}, d[BN_LIMBS] = {0}, e[BN_LIMBS] = {0},
+          f[BN_LIMBS] = {0}, g[BN_LIMBS] = {0};
+  safegcd_from_bn(prime, p);
+  safegcd_from_bn(x, g);
+  memcpy(f, p, sizeof(f));
+  e[0] = 1;
+  uint32_t prime_inv = inverse_mod_power_two(p[0], SAFEGCD_BITS);
+
+  int32_t zeta = -1;
+  safegcd_matrix t = {0};
+  for (int i = 0; i < 20; i++) {
+    zeta = safegcd_divsteps(zeta, f[0], g[0], &t);
+    safegcd_update_de(d, e, &t, p, prime_inv);
+    safegcd_update_fg(f, g, &t);
+  }
+
+  safegcd_normalize(d, f[BN_LIMBS - 1], p);
+  safegcd_to_bn(d, x);
+
+  memzero(d, sizeof(d));
+  memzero(e, sizeof(e));
+  memzero(f, sizeof(f));
+  memzero(g, sizeof(g));
+  memzero(&t, sizeof(t));
+}
+
 #if false
 // x = 1/x % prime if x != 0 else 0
 // Assumes x is is_normalized
@@ -1816,7 +2371,11 @@ void bn_print_raw(const bignum256 *x) {
 }
 #endif
 
-#if USE_INVERSE_FAST
+#if USE_INVERSE_SAFEGCD
+void bn_inverse(bignum256 *x, const bignum256 *prime) {
+  bn_inverse_safegcd(x, prime);
+}
+#elif USE_INVERSE_FAST
 void bn_inverse(bignum256 *x, const bignum256 *prime) {
   bn_inverse_fast(x, prime);
 }
@@ -1825,3 +2384,71 @@ void bn_inverse(bignum256 *x, const bignum256 *prime) {
   bn_inverse_slow(x, prime);
 }
 #endif
+
+// xs[i] = 1/xs[i] % prime for all 0 <= i < n
+// Uses Montgomery's trick, i.e. a single inversion and 3 * (n - 1)
+// multiplications, see
+// https://en.wikipedia.org/wiki/Modular_multiplicative_inverse#Multiple_inverses
+// scratch is a buffer of n elements
+// Assumes all xs[i] are normalized and non-zero modulo prime
+// Guarantees all xs[i] are normalized and fully reduced modulo prime
+// Assumes prime is a prime number
+// Assumes prime is normalized, 2**256 - 2**224 <= prime <= 2**256
+static void bn_inverse_batch_with(bignum256 *xs, size_t n,
+                                  const bignum256 *prime, bignum256 *scratch,
+                                  void (*inverse)(bignum256 *,
+                                                  const bignum256 *)) {
+  bignum256 inv = {0}, tmp = {0};
+
+  if (n == 0) {
+    return;
+  }
+
+  // scratch[i] = xs[0] * ... * xs[i]
+  scratch[0] = xs[0];
+  for (size_t i = 1; i < n; i++) {
+    scratch[i] = scratch[i - 1];
+    bn_multiply(&xs[i], &scratch[i], prime);
+  }
+
+  inv = scratch[n - 1];
+  inverse(&inv, prime);
+  // inv = 1 / (xs[0] * ... * xs[n - 1])
+
+  for (size_t i = n - 1; i > 0; i--) {
+    // tmp = 1 / xs[i]
+    tmp = inv;
+    bn_multiply(&scratch[i - 1], &tmp, prime);
+    bn_mod(&tmp, prime);
+    // inv = 1 / (xs[0] * ... * xs[i - 1])
+    bn_multiply(&xs[i], &inv, prime);
+    bn_mod(&inv, prime);
+    xs[i] = tmp;
+  }
+  xs[0] = inv;
+
+  memzero(scratch, n * sizeof(bignum256));
+  memzero(&tmp, sizeof(tmp));
+  memzero(&inv, sizeof(inv));
+}
+
+// xs[i] = 1/xs[i] % prime for all 0 <= i < n using a single bn_inverse
+// scratch is a buffer of n elements
+// Assumes all xs[i] are normalized and non-zero modulo prime
+// Guarantees all xs[i] are normalized and fully reduced modulo prime
+// Assumes prime is a prime number
+// Assumes prime is normalized, 2**256 - 2**224 <= prime <= 2**256
+// The function has the same control flow and memory access flow properties as
+//   bn_inverse with regard to xs
+void bn_inverse_batch(bignum256 *xs, size_t n, const bignum256 *prime,
+                      bignum256 *scratch) {
+  bn_inverse_batch_with(xs, n, prime, scratch, bn_inverse);
+}
+
+// Same as bn_inverse_batch but uses bn_inverse_slow
+// The function has constant control flow and constant memory access flow with
+//   regard to xs, use it for secret inputs
+void bn_inverse_batch_slow(bignum256 *xs, size_t n, const bignum256 *prime,
+                           bignum256 *scratch) {
+  bn_inverse_batch_with(xs, n, prime, scratch, bn_inverse_slow);
+}
@@ -93,6 +93,8 @@ void bn_xor(bignum256 *res, const bignum256 *x, const bignum256 *y);
 void bn_mult_half(bignum256 *x, const bignum256 *prime);
 void bn_mult_k(bignum256 *x, uint8_t k, const bignum256 *prime);
 void bn_mod(bignum256 *x, const bignum256 *prime);
+void bn_multiply_long(const bignum256 *k, const bignum256 *x,
+                      uint32_t res[2 * BN_LIMBS]);
 void bn_multiply(const bignum256 *k, bignum256 *x, const bignum256 *prime);
 void bn_fast_mod_old(bignum256 *x, const bignum256 *prime);
 void bn_fast_mod(bignum256 *x, const bignum256 *prime);
@@ -102,10 +104,12 @@ void bn_sqrt(bignum256 *x, const bignum256 *prime);
 uint32_t inverse_mod_power_two(uint32_t a, uint32_t n);
 void bn_divide_base(bignum256 *x, const bignum256 *prime);
 void bn_inverse_slow(bignum256 *x, const bignum256 *prime);
+void bn_inverse_fast(bignum256 *x, const bignum256 *prime);
 void bn_inverse_fast_1(bignum256 *x, const bignum256 *prime);
 void bn_inverse_fast_2(bignum256 *x, const bignum256 *prime);
 void bn_inverse_fast_3(bignum256 *x, const bignum256 *prime);
 void bn_inverse_old(bignum256 *x, const bignum256 *prime);
+void bn_inverse_safegcd(bignum256 *x, const bignum256 *prime);
 void bn_normalize(bignum256 *x);
 void bn_add(bignum256 *x, const bignum256 *y);
 void bn_addmod(bignum256 *x, const bignum256 *y, const bignum256 *prime);
@@ -118,6 +122,10 @@ void bn_long_division(bignum256 *x, uint32_t d, bignum256 *q, uint32_t *r);
 void bn_divmod58(bignum256 *x, uint32_t *r);
 void bn_divmod1000(bignum256 *x, uint32_t *r);
 void bn_inverse(bignum256 *x, const bignum256 *prime);
+void bn_inverse_batch(bignum256 *xs, size_t n, const bignum256 *prime,
+                      bignum256 *scratch);
+void bn_inverse_batch_slow(bignum256 *xs, size_t n, const bignum256 *prime,
+                           bignum256 *scratch);
 size_t bn_format(const bignum256 *amount, const char *prefix,
                  const char *suffix, unsigned int decimals, int exponent,
                  bool trailing, char *output, size_t output_length);
@@ -115,6 +115,7 @@ int hdnode_from_xpub(uint32_t depth, uint32_t child_num,
   memcpy(out->chain_code, chain_code, 32);
   memzero(out->private_key, 32);
   memzero(out->private_key_extension, 32);
+  memzero(out->private_key_expanded, sizeof(out->private_key_expanded));
   memcpy(out->public_key, public_key, 33);
   return 1;
 }
@@ -150,6 +151,7 @@ int hdnode_from_xprv(uint32_t depth, uint32_t child_num,
   memcpy(out->private_key, private_key, 32);
   memzero(out->public_key, sizeof(out->public_key));
   memzero(out->private_key_extension, sizeof(out->private_key_extension));
+  memzero(out->private_key_expanded, sizeof(out->private_key_expanded));
   return 1;
 }
 
@@ -260,6 +262,7 @@ int hdnode_private_ckd(HDNode *inout, uint32_t i) {
   inout->depth++;
   inout->child_num = i;
   memzero(inout->public_key, sizeof(inout->public_key));
+  memzero(inout->private_key_expanded, sizeof(inout->private_key_expanded));
 
   // making sure to wipe our memory
   memzero(&a, sizeof(a));
@@ -289,11 +292,12 @@ static void scalar_add_256bits(const uint8_t *src1, const uint8_t *src2,
   }
 }
 
-int hdnode_private_ckd_cardano(HDNode *inout, uint32_t index) {
-  if (inout->depth >= CARDANO_MAX_NODE_DEPTH) {
-    return 0;
-  }
-
+// Derives the child index of parent into out, key_ctx is the HMAC-SHA512
+// context of the parent chain code before any data was added
+// for public derivation parent must have its public key filled in
+static void hdnode_private_ckd_cardano_ctx(const HDNode *parent,
+                                           const HMAC_SHA512_CTX *key_ctx,
+                                           uint32_t index, HDNode *out) {
   // checks for hardened/non-hardened derivation, keysize 32 means we are
   // dealing with public key and thus non-h, keysize 64 is for private key
   int keysize = 32;
@@ -308,21 +312,20 @@ int hdnode_private_ckd_cardano(HDNode *inout, uint32_t index) {
 
   write_le(data + keysize + 1, index);
 
-  memcpy(priv_key, inout->private_key, 32);
-  memcpy(priv_key + 32, inout->private_key_extension, 32);
+  memcpy(priv_key, parent->private_key, 32);
+  memcpy(priv_key + 32, parent->private_key_extension, 32);
 
   if (keysize == 64) {  // private derivation
     data[0] = 0;
-    memcpy(data + 1, inout->private_key, 32);
-    memcpy(data + 1 + 32, inout->private_key_extension, 32);
+    memcpy(data + 1, parent->private_key, 32);
+    memcpy(data + 1 + 32, parent->private_key_extension, 32);
   } else {  // public derivation
-    hdnode_fill_public_key(inout);
     data[0] = 2;
-    memcpy(data + 1, inout->public_key + 1, 32);
+    memcpy(data + 1, parent->public_key + 1, 32);
   }
 
   static CONFIDENTIAL HMAC_SHA512_CTX ctx;
-  hmac_sha512_Init(&ctx, inout->chain_code, 32);
+  memcpy(&ctx, key_ctx, sizeof(ctx));
   hmac_sha512_Update(&ctx, data, 1 + keysize + 4);
   hmac_sha512_Final(&ctx, z);
 
@@ -337,28 +340,77 @@ int hdnode_private_ckd_cardano(HDNode *inout, uint32_t index) {
   /* Kr = Zr + parent(K)r */
   scalar_add_256bits(z + 32, priv_key + 32, res_key + 32);
 
-  memcpy(inout->private_key, res_key, 32);
-  memcpy(inout->private_key_extension, res_key + 32, 32);
-
   if (keysize == 64) {
     data[0] = 1;
   } else {
     data[0] = 3;
   }
-  hmac_sha512_Init(&ctx, inout->chain_code, 32);
+  memcpy(&ctx, key_ctx, sizeof(ctx));
   hmac_sha512_Update(&ctx, data, 1 + keysize + 4);
   hmac_sha512_Final(&ctx, z);
 
-  memcpy(inout->chain_code, z + 32, 32);
-  inout->depth++;
-  inout->child_num = index;
-  memzero(inout->public_key, sizeof(inout->public_key));
+  // out may alias parent, so it is only written once parent is not needed
+  memcpy(out->private_key, res_key, 32);
+  memcpy(out->private_key_extension, res_key + 32, 32);
+  memzero(out->private_key_expanded, sizeof(out->private_key_expanded));
+  memcpy(out->chain_code, z + 32, 32);
+  out->depth = parent->depth + 1;
+  out->child_num = index;
+  out->curve = parent->curve;
+  memzero(out->public_key, sizeof(out->public_key));
 
   // making sure to wipe our memory
   memzero(z, sizeof(z));
+  memzero(zl8, sizeof(zl8));
   memzero(data, sizeof(data));
   memzero(priv_key, sizeof(priv_key));
   memzero(res_key, sizeof(res_key));
+  memzero(&ctx, sizeof(ctx));
+}
+
+int hdnode_private_ckd_cardano(HDNode *inout, uint32_t index) {
+  if (inout->depth >= CARDANO_MAX_NODE_DEPTH) {
+    return 0;
+  }
+  if (!(index & 0x80000000)) {
+    hdnode_fill_public_key(inout);
+  }
+
+  static CONFIDENTIAL HMAC_SHA512_CTX key_ctx;
+  hmac_sha512_Init(&key_ctx, inout->chain_code, 32);
+  hdnode_private_ckd_cardano_ctx(inout, &key_ctx, index, inout);
+  memzero(&key_ctx, sizeof(key_ctx));
+  return 1;
+}
+
+// Derives the children i, ..., i + count - 1 of parent at once, the HMAC key
+// schedule of the parent chain code and the parent public key are computed
+// only once for all of them
+// children must hold count nodes, their public keys are filled in
+// returns 0 if the children would cross the hardened boundary or exceed the
+// maximal depth, 1 otherwise
+int hdnode_private_ckd_cardano_batch(HDNode *parent, uint32_t i, size_t count,
+                                     HDNode *children) {
+  if (parent->depth >= CARDANO_MAX_NODE_DEPTH) {
+    return 0;
+  }
+  if (count == 0) {
+    return 1;
+  }
+  if (count - 1 > 0x7FFFFFFF - (i & 0x7FFFFFFF)) {
+    return 0;
+  }
+  if (!(i & 0x80000000)) {
+    hdnode_fill_public_key(parent);
+  }
+
+  static CONFIDENTIAL HMAC_SHA512_CTX key_ctx;
+  hmac_sha512_Init(&key_ctx, parent->chain_code, 32);
+  for (size_t j = 0; j < count; j++) {
+    hdnode_private_ckd_cardano_ctx(parent, &key_ctx, i + j, &children[j]);
+    hdnode_fill_public_key(&children[j]);
+  }
+  memzero(&key_ctx, sizeof(key_ctx));
   return 1;
 }
 
@@ -438,8 +490,17 @@ int hdnode_public_ckd_cp(const ecdsa_curve *curve, const curve_point *parent,
     hmac_sha512(parent_chain_code, 32, data, sizeof(data), I);
     bn_read_be(I, &c);
     if (bn_is_less(&c, &curve->order)) {  // < order
+#if USE_SECP256K1_ENDOMORPHISM && !USE_PRECOMPUTED_CP
+      // without the precomputed table the variable time multiplication
+      // is faster, c is derived from the public parent node only
+      bignum256 one = {0};
+      bn_one(&one);
+      // b = c * G + a
+      point_multiply_double(curve, &c, &curve->G, &one, parent, child);
+#else
       scalar_multiply(curve, &c, child);  // b = c * G
       point_add(curve, parent, child);    // b = a + b
+#endif
       if (!point_is_infinity(child)) {
         if (child_chain_code) {
           memcpy(child_chain_code, I + 32, 32);
@@ -469,6 +530,7 @@ int hdnode_public_ckd(HDNode *inout, uint32_t i) {
     return 0;
   }
   memzero(inout->private_key, 32);
+  memzero(inout->private_key_expanded, sizeof(inout->private_key_expanded));
   inout->depth++;
   inout->child_num = i;
   inout->public_key[0] = 0x02 | (child.y.val[0] & 0x01);
@@ -481,18 +543,75 @@ int hdnode_public_ckd(HDNode *inout, uint32_t i) {
   return 1;
 }
 
-void hdnode_public_ckd_address_optimized(const curve_point *pub,
-                                         const uint8_t *chain_code, uint32_t i,
-                                         uint32_t version,
-                                         HasherType hasher_pubkey,
-                                         HasherType hasher_base58, char *addr,
-                                         int addrsize, int addrformat) {
+// Derives the public children i, ..., i + count - 1 of parent at once
+// The child points are converted to affine coordinates in batches sharing a
+// single inversion, see scalar_multiply_add_batch
+// children must hold count points, child chain codes are not computed
+int hdnode_public_ckd_cp_batch(const ecdsa_curve *curve,
+                               const curve_point *parent,
+                               const uint8_t *parent_chain_code, uint32_t i,
+                               size_t count, curve_point *children) {
+  uint8_t data[(1 + 32) + 4] = {0};
+  uint8_t I[32 + 32] = {0};
+  bignum256 c[SCALAR_MULTIPLY_BATCH_SIZE] = {0};
+  int valid[SCALAR_MULTIPLY_BATCH_SIZE] = {0};
+
+  if (count == 0) {
+    return 1;
+  }
+  if ((i & 0x80000000) || count - 1 > 0x7FFFFFFF - i) {  // private derivation
+    return 0;
+  }
+
+  data[0] = 0x02 | (parent->y.val[0] & 0x01);
+  bn_write_be(&parent->x, data + 1);
+
+  for (size_t start = 0; start < count; start += SCALAR_MULTIPLY_BATCH_SIZE) {
+    size_t n = count - start;
+    if (n > SCALAR_MULTIPLY_BATCH_SIZE) {
+      n = SCALAR_MULTIPLY_BATCH_SIZE;
+    }
+
+    for (size_t j = 0; j < n; j++) {
+      write_be(data + 33, i + start + j);
+      hmac_sha512(parent_chain_code, 32, data, sizeof(data), I);
+      bn_read_be(I, &c[j]);
+      valid[j] = bn_is_less(&c[j], &curve->order);
+      if (!valid[j]) {
+        bn_zero(&c[j]);
+      }
+    }
+
+    // b = c * G + a
+    scalar_multiply_add_batch(curve, n, c, parent, children + start);
+
+    for (size_t j = 0; j < n; j++) {
+      // fall back to the slow path for the (practically impossible) cases
+      // where the child has to be derived again
+      if (!valid[j] || point_is_infinity(&children[start + j])) {
+        hdnode_public_ckd_cp(curve, parent, parent_chain_code, i + start + j,
+                             &children[start + j], NULL);
+      }
+    }
+  }
+
+  // Wipe all stack data.
+  memzero(data, sizeof(data));
+  memzero(I, sizeof(I));
+  memzero(c, sizeof(c));
+  return 1;
+}
+
+static void hdnode_public_address_optimized(const curve_point *b,
+                                            uint32_t version,
+                                            HasherType hasher_pubkey,
+                                            HasherType hasher_base58,
+                                            char *addr, int addrsize,
+                                            int addrformat) {
   uint8_t child_pubkey[33] = {0};
-  curve_point b = {0};
 
-  hdnode_public_ckd_cp(&secp256k1, pub, chain_code, i, &b, NULL);
-  child_pubkey[0] = 0x02 | (b.y.val[0] & 0x01);
-  bn_write_be(&b.x, child_pubkey + 1);
+  child_pubkey[0] = 0x02 | (b->y.val[0] & 0x01);
+  bn_write_be(&b->x, child_pubkey + 1);
 
   switch (addrformat) {
     case 1:  // Segwit-in-P2SH
@@ -506,20 +625,149 @@ void hdnode_public_ckd_address_optimized(const curve_point *pub,
   }
 }
 
+void hdnode_public_ckd_address_optimized(const curve_point *pub,
+                                         const uint8_t *chain_code, uint32_t i,
+                                         uint32_t version,
+                                         HasherType hasher_pubkey,
+                                         HasherType hasher_base58, char *addr,
+                                         int addrsize, int addrformat) {
+  curve_point b = {0};
+
+  hdnode_public_ckd_cp(&secp256k1, pub, chain_code, i, &b, NULL);
+  hdnode_public_address_optimized(&b, version, hasher_pubkey, hasher_base58,
+                                  addr, addrsize, addrformat);
+}
+
+// Same as hdnode_public_ckd_address_optimized for the children
+// i, ..., i + count - 1, the address of child i + j is stored at
+// addrs + j * addrsize
+// returns 0 if any of the children would be hardened, 1 otherwise
+int hdnode_public_ckd_address_optimized_batch(
+    const curve_point *pub, const uint8_t *chain_code, uint32_t i,
+    size_t count, uint32_t version, HasherType hasher_pubkey,
+    HasherType hasher_base58, char *addrs, int addrsize, int addrformat) {
+  curve_point b[SCALAR_MULTIPLY_BATCH_SIZE] = {0};
+
+  for (size_t start = 0; start < count; start += SCALAR_MULTIPLY_BATCH_SIZE) {
+    size_t n = count - start;
+    if (n > SCALAR_MULTIPLY_BATCH_SIZE) {
+      n = SCALAR_MULTIPLY_BATCH_SIZE;
+    }
+    if (!hdnode_public_ckd_cp_batch(&secp256k1, pub, chain_code, i + start, n,
+                                    b)) {
+      return 0;
+    }
+    for (size_t j = 0; j < n; j++) {
+      hdnode_public_address_optimized(&b[j], version, hasher_pubkey,
+                                      hasher_base58,
+                                      addrs + (start + j) * addrsize, addrsize,
+                                      addrformat);
+    }
+  }
+  return 1;
+}
+
 #if USE_BIP32_CACHE
-static bool private_ckd_cache_root_set = false;
-static CONFIDENTIAL HDNode private_ckd_cache_root;
-static int private_ckd_cache_index = 0;
+// Roots and derived parents are evicted least recently used first. Each
+// cached parent belongs to one root, so roots on different curves or from
+// different seeds do not evict each other's entries on every switch.
+static uint32_t bip32_cache_tick = 0;
+static uint32_t bip32_cache_hits = 0;
+static uint32_t bip32_cache_misses = 0;
 
 static CONFIDENTIAL struct {
   bool set;
+  uint32_t used;
+  HDNode node;
+} bip32_cache_roots[BIP32_CACHE_ROOTS];
+
+static CONFIDENTIAL struct {
+  bool set;
+  uint32_t used;
+  size_t root;
+  bool public;
   size_t depth;
   uint32_t i[BIP32_CACHE_MAXDEPTH];
   HDNode node;
-} private_ckd_cache[BIP32_CACHE_SIZE];
+} bip32_cache[BIP32_CACHE_SIZE];
+
+// returns the root slot of node, replacing the least recently used root
+// (and all parents cached under it) if node is not there yet
+static size_t bip32_cache_root(const HDNode *node) {
+  size_t j = 0, victim = 0;
+  for (j = 0; j < BIP32_CACHE_ROOTS; j++) {
+    if (bip32_cache_roots[j].set &&
+        memcmp(&bip32_cache_roots[j].node, node, sizeof(HDNode)) == 0) {
+      bip32_cache_roots[j].used = ++bip32_cache_tick;
+      return j;
+    }
+    if (!bip32_cache_roots[j].set ||
+        (bip32_cache_roots[victim].set &&
+         bip32_cache_roots[j].used < bip32_cache_roots[victim].used)) {
+      victim = j;
+    }
+  }
+  for (j = 0; j < BIP32_CACHE_SIZE; j++) {
+    if (bip32_cache[j].set && bip32_cache[j].root == victim) {
+      memzero(&bip32_cache[j], sizeof(bip32_cache[j]));
+    }
+  }
+  memcpy(&bip32_cache_roots[victim].node, node, sizeof(HDNode));
+  bip32_cache_roots[victim].set = true;
+  bip32_cache_roots[victim].used = ++bip32_cache_tick;
+  return victim;
+}
+
+// returns the entry with the longest prefix of i[0 .. depth - 1] cached
+// under root for the same kind of derivation, or -1
+static int bip32_cache_find(size_t root, bool public, const uint32_t *i,
+                            size_t depth) {
+  int best = -1;
+  for (int j = 0; j < BIP32_CACHE_SIZE; j++) {
+    if (bip32_cache[j].set && bip32_cache[j].root == root &&
+        bip32_cache[j].public == public && bip32_cache[j].depth <= depth &&
+        (best < 0 || bip32_cache[j].depth > bip32_cache[best].depth) &&
+        memcmp(bip32_cache[j].i, i, bip32_cache[j].depth * sizeof(uint32_t)) ==
+            0) {
+      best = j;
+    }
+  }
+  if (best >= 0) {
+    bip32_cache[best].used = ++bip32_cache_tick;
+  }
+  return best;
+}
+
+static void bip32_cache_store(size_t root, bool public, const uint32_t *i,
+                              size_t depth, const HDNode *node) {
+  int j = 0, victim = 0;
+  if (depth == 0 || depth > BIP32_CACHE_MAXDEPTH) {
+    return;
+  }
+  for (j = 0; j < BIP32_CACHE_SIZE; j++) {
+    if (!bip32_cache[j].set) {
+      victim = j;
+      break;
+    }
+    if (bip32_cache[j].used < bip32_cache[victim].used) {
+      victim = j;
+    }
+  }
+  memzero(&bip32_cache[victim], sizeof(bip32_cache[victim]));
+  bip32_cache[victim].set = true;
+  bip32_cache[victim].used = ++bip32_cache_tick;
+  bip32_cache[victim].root = root;
+  bip32_cache[victim].public = public;
+  bip32_cache[victim].depth = depth;
+  memcpy(bip32_cache[victim].i, i, depth * sizeof(uint32_t));
+  memcpy(&bip32_cache[victim].node, node, sizeof(HDNode));
+}
+
+static int hdnode_ckd_cached(HDNode *inout, const uint32_t *i, size_t i_count,
+                             uint32_t *fingerprint, bool public) {
+  int (*ckd)(HDNode *, uint32_t) =
+      public ? hdnode_public_ckd : hdnode_private_ckd;
 
-int hdnode_private_ckd_cached(HDNode *inout, const uint32_t *i, size_t i_count,
-                              uint32_t *fingerprint) {
   if (i_count == 0) {
     // no way how to compute parent fingerprint
     return 1;
@@ -528,61 +776,66 @@ int hdnode_private_ckd_cached(HDNode *inout, const uint32_t *i, size_t i_count,
     if (fingerprint) {
       *fingerprint = hdnode_fingerprint(inout);
     }
-    if (hdnode_private_ckd(inout, i[0]) == 0) return 0;
+    if (ckd(inout, i[0]) == 0) return 0;
     return 1;
   }
 
-  bool found = false;
-  // if root is not set or not the same
-  if (!private_ckd_cache_root_set ||
-      memcmp(&private_ckd_cache_root, inout, sizeof(HDNode)) != 0) {
-    // clear the cache
-    private_ckd_cache_index = 0;
-    memzero(private_ckd_cache, sizeof(private_ckd_cache));
-    // setup new root
-    memcpy(&private_ckd_cache_root, inout, sizeof(HDNode));
-    private_ckd_cache_root_set = true;
+  size_t root = bip32_cache_root(inout);
+  size_t depth = i_count - 1, k = 0;
+  int j = bip32_cache_find(root, public, i, depth);
+  if (j >= 0) {
+    memcpy(inout, &(bip32_cache[j].node), sizeof(HDNode));
+    k = bip32_cache[j].depth;
+  }
+  if (k == depth) {
+    bip32_cache_hits++;
   } else {
-    // try to find parent
-    int j = 0;
-    for (j = 0; j < BIP32_CACHE_SIZE; j++) {
-      if (private_ckd_cache[j].set &&
-          private_ckd_cache[j].depth == i_count - 1 &&
-          memcmp(private_ckd_cache[j].i, i, (i_count - 1) * sizeof(uint32_t)) ==
-              0 &&
-          private_ckd_cache[j].node.curve == inout->curve) {
-        memcpy(inout, &(private_ckd_cache[j].node), sizeof(HDNode));
-        found = true;
-        break;
+    bip32_cache_misses++;
+    // derive the rest of the parent and save it, together with the
+    // grandparent so that sibling chains (e.g. change) start from there
+    for (; k < depth; k++) {
+      if (k == depth - 1 && k > 0 && (j < 0 || bip32_cache[j].depth < k)) {
+        bip32_cache_store(root, public, i, k, inout);
       }
+      if (ckd(inout, i[k]) == 0) return 0;
     }
-  }
-
-  // else derive parent
-  if (!found) {
-    size_t k = 0;
-    for (k = 0; k < i_count - 1; k++) {
-      if (hdnode_private_ckd(inout, i[k]) == 0) return 0;
-    }
-    // and save it
-    memzero(&(private_ckd_cache[private_ckd_cache_index]),
-            sizeof(private_ckd_cache[private_ckd_cache_index]));
-    private_ckd_cache[private_ckd_cache_index].set = true;
-    private_ckd_cache[private_ckd_cache_index].depth = i_count - 1;
-    memcpy(private_ckd_cache[private_ckd_cache_index].i, i,
-           (i_count - 1) * sizeof(uint32_t));
-    memcpy(&(private_ckd_cache[private_ckd_cache_index].node), inout,
-           sizeof(HDNode));
-    private_ckd_cache_index = (private_ckd_cache_index + 1) % BIP32_CACHE_SIZE;
+    bip32_cache_store(root, public, i, depth, inout);
   }
 
   if (fingerprint) {
     *fingerprint = hdnode_fingerprint(inout);
   }
-  if (hdnode_private_ckd(inout, i[i_count - 1]) == 0) return 0;
+  if (ckd(inout, i[i_count - 1]) == 0) return 0;
 
   return 1;
 }
+
+int hdnode_private_ckd_cached(HDNode *inout, const uint32_t *i, size_t i_count,
+                              uint32_t *fingerprint) {
+  return hdnode_ckd_cached(inout, i, i_count, fingerprint, false);
+}
+
+int hdnode_public_ckd_cached(HDNode *inout, const uint32_t *i, size_t i_count,
+                             uint32_t *fingerprint) {
+  return hdnode_ckd_cached(inout, i, i_count, fingerprint, true);
+}
+
+void hdnode_ckd_cache_stats(uint32_t *hits, uint32_t *misses) {
+  if (hits) {
+    *hits = bip32_cache_hits;
+  }
+  if (misses) {
+    *misses = bip32_cache_misses;
+  }
+}
+
+void hdnode_ckd_cache_clear(void) {
+  memzero(bip32_cache, sizeof(bip32_cache));
+  memzero(bip32_cache_roots, sizeof(bip32_cache_roots));
+  bip32_cache_tick = 0;
+  bip32_cache_hits = 0;
+  bip32_cache_misses = 0;
+}
 #endif
 
 void hdnode_get_address_raw(HDNode *node, uint32_t version, uint8_t *addr_raw) {
@@ -765,22 +1018,39 @@ int hdnode_sign(HDNode *node, const uint8_t *msg, uint32_t msg_len,
   } else if (node->curve == &curve25519_info) {
     return 1;  // signatures are not supported
   } else {
+    void (*expand)(const ed25519_secret_key, ed25519_keypair_expanded *) = NULL;
+    void (*sign)(const unsigned char *, size_t,
+                 const ed25519_keypair_expanded *, ed25519_signature) = NULL;
     if (node->curve == &ed25519_info) {
-      hdnode_fill_public_key(node);
-      ed25519_sign(msg, msg_len, node->private_key, node->public_key + 1, sig);
+      expand = ed25519_keypair_expand;
+      sign = ed25519_sign_with_expanded;
     } else if (node->curve == &ed25519_sha3_info) {
-      hdnode_fill_public_key(node);
-      ed25519_sign_sha3(msg, msg_len, node->private_key, node->public_key + 1,
-                        sig);
+      expand = ed25519_keypair_expand_sha3;
+      sign = ed25519_sign_with_expanded_sha3;
 #if USE_KECCAK
     } else if (node->curve == &ed25519_keccak_info) {
-      hdnode_fill_public_key(node);
-      ed25519_sign_keccak(msg, msg_len, node->private_key, node->public_key + 1,
-                          sig);
+      expand = ed25519_keypair_expand_keccak;
+      sign = ed25519_sign_with_expanded_keccak;
 #endif
     } else {
       return 1;  // unknown or unsupported curve
     }
+
+    ed25519_keypair_expanded kp = {0};
+    // an expanded key always has bit 254 set, so it is never all zero
+    if ((node->private_key_expanded[31] & 0x40) == 0) {
+      // keep the expanded key, so that further signatures skip the hashing
+      expand(node->private_key, &kp);
+      memcpy(node->private_key_expanded, kp.sk, sizeof(kp.sk));
+      node->public_key[0] = 1;
+      memcpy(node->public_key + 1, kp.pk, sizeof(kp.pk));
+    } else {
+      hdnode_fill_public_key(node);
+      memcpy(kp.sk, node->private_key_expanded, sizeof(kp.sk));
+      memcpy(kp.pk, node->public_key + 1, sizeof(kp.pk));
+    }
+    sign(msg, msg_len, &kp, sig);
+    memzero(&kp, sizeof(kp));
     return 0;
   }
 }
@@ -876,6 +1146,7 @@ static int hdnode_deserialize(const char *str, uint32_t version,
     }
     memcpy(node->private_key, node_data + 46, 32);
     memzero(node->public_key, sizeof(node->public_key));
+    memzero(node->private_key_expanded, sizeof(node->private_key_expanded));
   } else {
     memzero(node->private_key, sizeof(node->private_key));
     memcpy(node->public_key, node_data + 45, 33);
@@ -48,6 +48,9 @@ typedef struct {
 
   uint8_t private_key[32];
   uint8_t private_key_extension[32];
+  // ed25519 secret key expanded by the curve hash, all zero until the node
+  // signs for the first time and whenever private_key changes
+  uint8_t private_key_expanded[64];
 
   uint8_t public_key[33];
   const curve_info *curve;
@@ -71,6 +74,8 @@ int hdnode_private_ckd(HDNode *inout, uint32_t i);
 
 #if USE_CARDANO
 int hdnode_private_ckd_cardano(HDNode *inout, uint32_t i);
+int hdnode_private_ckd_cardano_batch(HDNode *parent, uint32_t i, size_t count,
+                                     HDNode *children);
 int hdnode_from_seed_cardano(const uint8_t *seed, int seed_len, HDNode *out);
 int hdnode_from_entropy_cardano_icarus(const uint8_t *pass, int pass_len,
                                        const uint8_t *seed, int seed_len,
@@ -81,6 +86,11 @@ int hdnode_public_ckd_cp(const ecdsa_curve *curve, const curve_point *parent,
                          const uint8_t *parent_chain_code, uint32_t i,
                          curve_point *child, uint8_t *child_chain_code);
 
+int hdnode_public_ckd_cp_batch(const ecdsa_curve *curve,
+                               const curve_point *parent,
+                               const uint8_t *parent_chain_code, uint32_t i,
+                               size_t count, curve_point *children);
+
 int hdnode_public_ckd(HDNode *inout, uint32_t i);
 
 void hdnode_public_ckd_address_optimized(const curve_point *pub,
@@ -90,9 +100,25 @@ void hdnode_public_ckd_address_optimized(const curve_point *pub,
                                          HasherType hasher_base58, char *addr,
                                          int addrsize, int addrformat);
 
+int hdnode_public_ckd_address_optimized_batch(
+    const curve_point *pub, const uint8_t *chain_code, uint32_t i,
+    size_t count, uint32_t version, HasherType hasher_pubkey,
+    HasherType hasher_base58, char *addrs, int addrsize, int addrformat);
+
 #if USE_BIP32_CACHE
 int hdnode_private_ckd_cached(HDNode *inout, const uint32_t *i, size_t i_count,
                               uint32_t *fingerprint);
+
+// same as hdnode_private_ckd_cached, but with public derivation, so inout
+// only needs the public key and the resulting node has no private key
+int hdnode_public_ckd_cached(HDNode *inout, const uint32_t *i, size_t i_count,
+                             uint32_t *fingerprint);
+
+// number of cached derivations that found / did not find their parent node
+void hdnode_ckd_cache_stats(uint32_t *hits, uint32_t *misses);
+
+// wipes all cached nodes and resets the statistics
+void hdnode_ckd_cache_clear(void);
 #endif
 
 uint32_t hdnode_fingerprint(HDNode *node);
@@ -26,6 +26,7 @@
 
 #include "bip39.h"
 #include "bip39_english.h"
+#include "bip39_english_index.h"
 #include "hmac.h"
 #include "memzero.h"
 #include "options.h"
@@ -228,9 +229,49 @@ void mnemonic_to_seed(const char *mnemonic, const char *passphrase,
 #endif
 }
 
+void mnemonic_to_seed_batch(const char *const mnemonics[],
+                            const char *const passphrases[], size_t n,
+                            uint8_t seeds[][512 / 8]) {
+  // enough contexts for the lanes of sha512_Transform_x4
+  PBKDF2_HMAC_SHA512_CTX pctx[4] = {0};
+  uint8_t salt[8 + 256] = {0};
+  memcpy(salt, "mnemonic", 8);
+  for (size_t i = 0; i < n; i += 4) {
+    size_t lanes = (n - i < 4) ? n - i : 4;
+    for (size_t l = 0; l < lanes; l++) {
+      int passphraselen = strnlen(passphrases[i + l], 256);
+      memcpy(salt + 8, passphrases[i + l], passphraselen);
+      pbkdf2_hmac_sha512_Init(&pctx[l], (const uint8_t *)mnemonics[i + l],
+                              strlen(mnemonics[i + l]), salt,
+                              passphraselen + 8, 1);
+    }
+    pbkdf2_hmac_sha512_Update_batch(pctx, lanes, BIP39_PBKDF2_ROUNDS);
+    for (size_t l = 0; l < lanes; l++) {
+      pbkdf2_hmac_sha512_Final(&pctx[l], seeds[i + l]);
+    }
+  }
+  memzero(salt, sizeof(salt));
+}
+
+// returns the bucket of words starting with the two letters at prefix
+static bool word_bucket(const char *prefix, int *lo, int *hi) {
+  if (prefix[0] < 'a' || prefix[0] > 'z' || prefix[1] < 'a' ||
+      prefix[1] > 'z') {
+    return false;
+  }
+  int pair = (prefix[0] - 'a') * 26 + (prefix[1] - 'a');
+  *lo = wordlist_index[pair];
+  *hi = wordlist_index[pair + 1];
+  return true;
+}
+
 // binary search for finding the word in the wordlist
 int mnemonic_find_word(const char *word) {
-  int lo = 0, hi = BIP39_WORDS - 1;
+  int lo = 0, hi = 0;
+  if (!word_bucket(word, &lo, &hi)) {
+    return -1;
+  }
+  hi--;
   while (lo <= hi) {
     int mid = lo + (hi - lo) / 2;
     int cmp = strcmp(word, wordlist[mid]);
@@ -247,11 +288,28 @@ int mnemonic_find_word(const char *word) {
 }
 
 const char *mnemonic_complete_word(const char *prefix, int len) {
-  // we need to perform linear search,
-  // because we want to return the first match
-  for (const char *const *w = wordlist; *w != 0; w++) {
-    if (strncmp(*w, prefix, len) == 0) {
-      return *w;
+  if (len <= 0) {
+    return wordlist[0];
+  }
+  if (prefix[0] < 'a' || prefix[0] > 'z') {
+    return NULL;
+  }
+  if (len == 1) {
+    int letter = (prefix[0] - 'a') * 26;
+    if (wordlist_index[letter] == wordlist_index[letter + 26]) {
+      return NULL;
+    }
+    return wordlist[wordlist_index[letter]];
+  }
+  // the words sharing the first two letters are a sorted bucket,
+  // so the first match in it is the first match in the wordlist
+  int lo = 0, hi = 0;
+  if (!word_bucket(prefix, &lo, &hi)) {
+    return NULL;
+  }
+  for (int i = lo; i < hi; i++) {
+    if (strncmp(wordlist[i], prefix, len) == 0) {
+      return wordlist[i];
     }
   }
   return NULL;
@@ -269,9 +327,26 @@ uint32_t mnemonic_word_completion_mask(const char *prefix, int len) {
   if (len <= 0) {
     return 0x3ffffff;  // all letters (bits 1-26 set)
   }
+  if (prefix[0] < 'a' || prefix[0] > 'z') {
+    return 0;
+  }
   uint32_t res = 0;
-  for (const char *const *w = wordlist; *w != 0; w++) {
-    const char *word = *w;
+  if (len == 1) {
+    // every word has at least two letters
+    int letter = (prefix[0] - 'a') * 26;
+    for (int i = 0; i < 26; i++) {
+      if (wordlist_index[letter + i] != wordlist_index[letter + i + 1]) {
+        res |= 1 << i;
+      }
+    }
+    return res;
+  }
+  int lo = 0, hi = 0;
+  if (!word_bucket(prefix, &lo, &hi)) {
+    return 0;
+  }
+  for (int i = lo; i < hi; i++) {
+    const char *word = wordlist[i];
     if (strncmp(word, prefix, len) == 0 && word[len] >= 'a' &&
         word[len] <= 'z') {
       res |= 1 << (word[len] - 'a');
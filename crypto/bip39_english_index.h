@@ -0,0 +1,64 @@
+// clang-format off
+// This file is generated by tools/mkwordindex.py from bip39_english.h, do not edit.
+
+// words in [wordlist_index[26 * a + b], wordlist_index[26 * a + b + 1])
+// start with the letters a and b
+static const uint16_t wordlist_index[26 * 26 + 1] = {
+       0,    0,   10,   24,   33,   34,   37,   41,   42,   46,   46,   46,
+      61,   66,   82,   82,   88,   88,  106,  113,  119,  126,  129,  135,
+     136,  136,  136,  155,  155,  155,  155,  175,  175,  175,  175,  183,
+     183,  183,  197,  197,  197,  214,  214,  214,  234,  234,  234,  253,
+     253,  253,  253,  253,  253,  295,  295,  295,  295,  302,  302,  302,
+     327,  333,  333,  333,  357,  357,  357,  398,  398,  398,  427,  427,
+     427,  438,  438,  438,  438,  439,  439,  449,  449,  449,  449,  487,
+     487,  487,  487,  514,  514,  514,  514,  514,  514,  527,  527,  527,
+     542,  542,  542,  549,  549,  550,  550,  551,  551,  559,  559,  562,
+     565,  565,  566,  567,  567,  569,  569,  569,  578,  586,  607,  607,
+     608,  610,  616,  620,  622,  622,  626,  626,  649,  651,  651,  673,
+     673,  673,  673,  685,  685,  685,  685,  705,  705,  705,  720,  720,
+     720,  739,  739,  739,  751,  751,  751,  757,  757,  757,  757,  757,
+     757,  774,  774,  774,  774,  780,  780,  780,  781,  788,  788,  788,
+     800,  800,  800,  810,  810,  810,  826,  826,  826,  832,  832,  832,
+     832,  833,  833,  848,  848,  848,  848,  859,  859,  859,  859,  866,
+     866,  866,  866,  866,  866,  884,  884,  884,  884,  884,  884,  896,
+     896,  896,  896,  897,  897,  897,  897,  899,  902,  902,  902,  903,
+     903,  903,  903,  903,  906,  914,  946,  946,  946,  946,  947,  950,
+     951,  951,  952,  952,  952,  952,  952,  956,  956,  956,  956,  960,
+     960,  960,  960,  960,  960,  960,  960,  960,  960,  965,  965,  965,
+     965,  965,  965,  972,  972,  972,  972,  972,  972,  973,  973,  973,
+     973,  977,  977,  977,  977,  988,  988,  988,  988,  988,  992,  992,
+     992,  992,  992,  992,  992,  992,  992,  992,  992,  992,  992, 1012,
+    1012, 1012, 1012, 1030, 1030, 1030, 1030, 1047, 1047, 1047, 1047, 1047,
+    1047, 1061, 1061, 1061, 1061, 1061, 1061, 1067, 1067, 1067, 1067, 1068,
+    1068, 1101, 1101, 1101, 1101, 1122, 1122, 1122, 1122, 1139, 1139, 1139,
+    1139, 1139, 1139, 1160, 1160, 1160, 1160, 1160, 1160, 1170, 1170, 1170,
+    1170, 1173, 1173, 1180, 1180, 1180, 1180, 1195, 1195, 1195, 1195, 1197,
+    1197, 1197, 1197, 1197, 1197, 1210, 1210, 1210, 1210, 1210, 1210, 1214,
+    1214, 1214, 1214, 1214, 1214, 1215, 1222, 1225, 1226, 1226, 1230, 1230,
+    1230, 1231, 1231, 1232, 1235, 1236, 1241, 1241, 1246, 1246, 1255, 1256,
+    1257, 1261, 1264, 1266, 1267, 1268, 1269, 1294, 1294, 1294, 1294, 1308,
+    1308, 1308, 1312, 1326, 1326, 1326, 1336, 1336, 1336, 1355, 1355, 1355,
+    1384, 1384, 1384, 1400, 1400, 1400, 1400, 1401, 1401, 1401, 1401, 1401,
+    1401, 1401, 1401, 1401, 1401, 1401, 1401, 1401, 1401, 1401, 1401, 1401,
+    1401, 1401, 1401, 1401, 1401, 1409, 1409, 1409, 1409, 1409, 1409, 1430,
+    1430, 1430, 1430, 1478, 1478, 1478, 1479, 1495, 1495, 1495, 1495, 1495,
+    1495, 1510, 1510, 1510, 1510, 1510, 1510, 1517, 1517, 1517, 1517, 1517,
+    1517, 1536, 1536, 1551, 1551, 1574, 1574, 1574, 1597, 1616, 1616, 1623,
+    1635, 1640, 1645, 1666, 1691, 1694, 1694, 1694, 1727, 1752, 1752, 1763,
+    1763, 1767, 1767, 1780, 1780, 1780, 1780, 1790, 1790, 1790, 1805, 1816,
+    1816, 1816, 1816, 1816, 1816, 1844, 1844, 1844, 1872, 1872, 1872, 1880,
+    1880, 1886, 1886, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1889,
+    1889, 1889, 1889, 1889, 1889, 1890, 1908, 1908, 1914, 1914, 1916, 1922,
+    1923, 1923, 1923, 1923, 1923, 1923, 1923, 1935, 1935, 1935, 1935, 1946,
+    1946, 1946, 1946, 1962, 1962, 1962, 1962, 1962, 1962, 1969, 1969, 1969,
+    1969, 1969, 1969, 1969, 1969, 1969, 1969, 1969, 1969, 1985, 1985, 1985,
+    1985, 1997, 1997, 1997, 2005, 2022, 2022, 2022, 2022, 2022, 2022, 2032,
+    2032, 2032, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038,
+    2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038,
+    2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038,
+    2038, 2039, 2039, 2039, 2039, 2041, 2041, 2041, 2041, 2041, 2041, 2041,
+    2041, 2041, 2041, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
+    2044, 2044, 2044, 2044, 2044, 2044, 2044, 2046, 2046, 2046, 2046, 2046,
+    2046, 2046, 2046, 2046, 2046, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+    2048, 2048, 2048, 2048, 2048,
+};
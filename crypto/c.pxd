@@ -0,0 +1,61 @@
+from libc.stdint cimport uint8_t, uint32_t
+
+cdef extern from "hasher.h" nogil:
+
+    ctypedef enum HasherType:
+        HASHER_SHA2
+        HASHER_SHA2D
+        HASHER_SHA2_RIPEMD
+
+cdef extern from "ecdsa.h" nogil:
+
+    ctypedef struct ecdsa_curve:
+        pass
+
+    ctypedef struct curve_point:
+        pass
+
+    enum: MAX_ADDR_SIZE
+
+    int ecdsa_read_pubkey(const ecdsa_curve *curve, const uint8_t *pub_key, curve_point *pub)
+    int ecdsa_verify_digest(const ecdsa_curve *curve, const uint8_t *pub_key, const uint8_t *sig, const uint8_t *digest)
+    int ecdsa_verify_digest_batch(const ecdsa_curve *curve, size_t n, const uint8_t *const *pub_keys, const uint8_t *const *sigs, const uint8_t *const *digests)
+    size_t ecdsa_recover_pub_from_sig_batch(const ecdsa_curve *curve, size_t n, uint8_t *pub_keys, const uint8_t *const *sigs, const uint8_t *const *digests, const int *recids)
+    int bip340_get_public_key(const ecdsa_curve *curve, const uint8_t *priv_key, uint8_t *pub_key)
+    int bip340_sign_digest(const ecdsa_curve *curve, const uint8_t *priv_key, const uint8_t *digest, const uint8_t *aux_rand, uint8_t *sig)
+    int bip340_verify_digest_batch(const ecdsa_curve *curve, size_t n, const uint8_t *const *pub_keys, const uint8_t *const *sigs, const uint8_t *const *digests)
+
+cdef extern from "secp256k1.h" nogil:
+
+    const ecdsa_curve secp256k1
+
+cdef extern from "nist256p1.h" nogil:
+
+    const ecdsa_curve nist256p1
+
+cdef extern from "bip32.h" nogil:
+
+    ctypedef struct curve_info:
+        const ecdsa_curve *params
+
+    ctypedef struct HDNode:
+        uint32_t depth
+        uint32_t child_num
+        uint8_t chain_code[32]
+        uint8_t private_key[32]
+        uint8_t public_key[33]
+        const curve_info *curve
+
+    int hdnode_from_seed(const uint8_t *seed, int seed_len, const char *curve, HDNode *out)
+    int hdnode_private_ckd(HDNode *inout, uint32_t i)
+    int hdnode_public_ckd(HDNode *inout, uint32_t i)
+    int hdnode_fill_public_key(HDNode *node)
+    void hdnode_get_address(HDNode *node, uint32_t version, char *addr, int addrsize)
+    int hdnode_serialize_public(const HDNode *node, uint32_t fingerprint, uint32_t version, char *str, int strsize)
+    int hdnode_deserialize_public(const char *str, uint32_t version, const char *curve, HDNode *node, uint32_t *fingerprint)
+    int hdnode_public_ckd_address_optimized_batch(const curve_point *pub, const uint8_t *chain_code, uint32_t i, size_t count, uint32_t version, HasherType hasher_pubkey, HasherType hasher_base58, char *addrs, int addrsize, int addrformat)
+
+cdef extern from "sha2.h" nogil:
+
+    void sha256_Raw(const uint8_t *data, size_t len, uint8_t *digest)
+    void sha256_Raw_multi(const uint8_t *const msgs[], const size_t lens[], size_t n, uint8_t *digests)
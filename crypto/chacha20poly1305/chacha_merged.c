@@ -59,6 +59,58 @@ void ECRYPT_ivsetup(ECRYPT_ctx *x,const u8 *iv)
   x->input[15] = U8TO32_LITTLE(iv + 4);
 }
 
+#if defined(__GNUC__) && (defined(__SSE2__) || defined(__ARM_NEON))
+/*
+Four blocks at once, with the same word of the four states in one vector,
+so the quarterrounds compile to SSE2 or NEON instructions.
+*/
+#define CHACHA_4BLOCKS 1
+
+typedef u32 u32x4 __attribute__((vector_size(16)));
+
+#define ROTATE4(v,c) (((v) << (c)) | ((v) >> (32 - (c))))
+
+#define QUARTERROUND4(a,b,c,d) \
+  a += b; d = ROTATE4(d ^ a,16); \
+  c += d; b = ROTATE4(b ^ c,12); \
+  a += b; d = ROTATE4(d ^ a, 8); \
+  c += d; b = ROTATE4(b ^ c, 7);
+
+static void chacha_4blocks(const u32 j[16],const u8 *m,u8 *c)
+{
+  u32x4 x[16], s[16];
+  int i = 0, k = 0;
+
+  for (i = 0;i < 16;++i) {
+    s[i] = (u32x4){j[i], j[i], j[i], j[i]};
+  }
+  for (k = 0;k < 4;++k) {
+    s[12][k] = j[12] + k;
+    s[13][k] = j[13] + (s[12][k] < j[12]);
+  }
+  for (i = 0;i < 16;++i) x[i] = s[i];
+
+  for (i = 20;i > 0;i -= 2) {
+    QUARTERROUND4( x[0], x[4], x[8],x[12])
+    QUARTERROUND4( x[1], x[5], x[9],x[13])
+    QUARTERROUND4( x[2], x[6],x[10],x[14])
+    QUARTERROUND4( x[3], x[7],x[11],x[15])
+    QUARTERROUND4( x[0], x[5],x[10],x[15])
+    QUARTERROUND4( x[1], x[6],x[11],x[12])
+    QUARTERROUND4( x[2], x[7], x[8],x[13])
+    QUARTERROUND4( x[3], x[4], x[9],x[14])
+  }
+
+  for (i = 0;i < 16;++i) x[i] += s[i];
+
+  for (k = 0;k < 4;++k) {
+    for (i = 0;i < 16;++i) {
+      U32TO8_LITTLE(c + 64 * k + 4 * i,XOR(x[i][k],U8TO32_LITTLE(m + 64 * k + 4 * i)));
+    }
+  }
+}
+#endif
+
 void ECRYPT_encrypt_bytes(ECRYPT_ctx *x,const u8 *m,u8 *c,u32 bytes)
 {
   u32 x0 = 0, x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, x9 = 0, x10 = 0, x11 = 0, x12 = 0, x13 = 0, x14 = 0, x15 = 0;
@@ -86,6 +138,22 @@ void ECRYPT_encrypt_bytes(ECRYPT_ctx *x,const u8 *m,u8 *c,u32 bytes)
   j14 = x->input[14];
   j15 = x->input[15];
 
+#ifdef CHACHA_4BLOCKS
+  while (bytes >= 256) {
+    chacha_4blocks(x->input,m,c);
+    j12 = PLUS(j12,4);
+    if (j12 < 4) {
+      j13 = PLUSONE(j13);
+    }
+    x->input[12] = j12;
+    x->input[13] = j13;
+    bytes -= 256;
+    c += 256;
+    m += 256;
+  }
+  if (!bytes) return;
+#endif
+
   for (;;) {
     if (bytes < 64) {
       for (i = 0;i < (int)bytes;++i) tmp[i] = m[i];
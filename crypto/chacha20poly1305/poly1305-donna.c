@@ -1,5 +1,11 @@
 #include "poly1305-donna.h"
+
+/* use the 64 bit implementation where 64 bit * 64 bit = 128 bit multiplication is available */
+#if defined(__GNUC__) && defined(__SIZEOF_INT128__) && !defined(POLY1305_32BIT)
+#include "poly1305-donna-64.h"
+#else
 #include "poly1305-donna-32.h"
+#endif
 
 void
 poly1305_update(poly1305_context *ctx, const unsigned char *m, size_t bytes) {
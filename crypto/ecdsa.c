@@ -36,6 +36,7 @@
 #include "rand.h"
 #include "rfc6979.h"
 #include "secp256k1.h"
+#include "sha2.h"
 
 // Set cp2 = cp1
 void point_copy(const curve_point *cp1, curve_point *cp2) { *cp2 = *cp1; }
@@ -215,14 +216,18 @@ void jacobian_to_curve(const jacobian_curve_point *jp, curve_point *p,
   bn_mod(&p->y, prime);
 }
 
-void point_jacobian_add(const curve_point *p1, jacobian_curve_point *p2,
-                        const ecdsa_curve *curve) {
+// The point arithmetic is written once for a generic coefficient a and
+// inlined into a copy per supported value of a, so that the compiler drops
+// the terms of a == 0 (secp256k1) and folds the constant of a == -3
+// (nist256p1). Other curves use the generic copy.
+
+static inline void jacobian_add_a(const curve_point *p1,
+                                  jacobian_curve_point *p2,
+                                  const bignum256 *prime, int a) {
   bignum256 r = {0}, h = {0}, r2 = {0};
   bignum256 hcby = {0}, hsqx = {0};
   bignum256 xz = {0}, yz = {0}, az = {0};
   int is_doubling = 0;
-  const bignum256 *prime = &curve->prime;
-  int a = curve->a;
 
   assert(-3 <= a && a <= 0);
 
@@ -263,7 +268,15 @@ void point_jacobian_add(const curve_point *p1, jacobian_curve_point *p2,
   yz = p2->z;
   bn_multiply(&xz, &yz, prime);  // yz = z2^3
 
-  if (a != 0) {
+  if (a == -3) {
+    // r2 = 3*x2^2 - 3*z2^4 = 3*(x2 - z2^2)*(x2 + z2^2), one multiplication
+    // less than squaring both terms
+    bn_subtractmod(&p2->x, &xz, &r2, prime);
+    az = xz;
+    bn_addmod(&az, &p2->x, prime);
+    bn_multiply(&az, &r2, prime);
+    bn_mult_k(&r2, 3, prime);
+  } else if (a != 0) {
     az = xz;
     bn_multiply(&az, &az, prime);  // az = z2^4
     bn_mult_k(&az, -a, prime);     // az = -az2^4
@@ -291,13 +304,15 @@ void point_jacobian_add(const curve_point *p1, jacobian_curve_point *p2,
   bn_add(&yz, &p2->y);
   // yz = y1' + y2
 
-  r2 = p2->x;
-  bn_multiply(&r2, &r2, prime);
-  bn_mult_k(&r2, 3, prime);
+  if (a != -3) {
+    r2 = p2->x;
+    bn_multiply(&r2, &r2, prime);
+    bn_mult_k(&r2, 3, prime);
 
-  if (a != 0) {
-    // subtract -a z2^4, i.e, add a z2^4
-    bn_subtractmod(&r2, &az, &r2, prime);
+    if (a != 0) {
+      // subtract -a z2^4, i.e, add a z2^4
+      bn_subtractmod(&r2, &az, &r2, prime);
+    }
   }
   bn_cmov(&r, is_doubling, &r2, &r);
   bn_cmov(&h, is_doubling, &yz, &h);
@@ -334,11 +349,26 @@ void point_jacobian_add(const curve_point *p1, jacobian_curve_point *p2,
   bn_fast_mod(&p2->y, prime);
 }
 
-void point_jacobian_double(jacobian_curve_point *p, const ecdsa_curve *curve) {
+void point_jacobian_add(const curve_point *p1, jacobian_curve_point *p2,
+                        const ecdsa_curve *curve) {
+  switch (curve->a) {
+    case 0:
+      jacobian_add_a(p1, p2, &curve->prime, 0);
+      break;
+    case -3:
+      jacobian_add_a(p1, p2, &curve->prime, -3);
+      break;
+    default:
+      jacobian_add_a(p1, p2, &curve->prime, curve->a);
+      break;
+  }
+}
+
+static inline void jacobian_double_a(jacobian_curve_point *p,
+                                     const bignum256 *prime, int a) {
   bignum256 az4 = {0}, m = {0}, msq = {0}, ysq = {0}, xysq = {0};
-  const bignum256 *prime = &curve->prime;
 
-  assert(-3 <= curve->a && curve->a <= 0);
+  assert(-3 <= a && a <= 0);
   /* usual algorithm:
    *
    * lambda  = (3((x/z^2)^2 + a) / 2y/z^3) = (3x^2 + az^4)/2yz
@@ -363,15 +393,27 @@ void point_jacobian_double(jacobian_curve_point *p, const ecdsa_curve *curve) {
    * z3 = y*z
    */
 
-  m = p->x;
-  bn_multiply(&m, &m, prime);
-  bn_mult_k(&m, 3, prime);
-
-  az4 = p->z;
-  bn_multiply(&az4, &az4, prime);
-  bn_multiply(&az4, &az4, prime);
-  bn_mult_k(&az4, -curve->a, prime);
-  bn_subtractmod(&m, &az4, &m, prime);
+  if (a == -3) {
+    // 3*x^2 - 3*z^4 = 3*(x - z^2)*(x + z^2), one multiplication less
+    az4 = p->z;
+    bn_multiply(&az4, &az4, prime);
+    bn_subtractmod(&p->x, &az4, &m, prime);
+    bn_addmod(&az4, &p->x, prime);
+    bn_multiply(&az4, &m, prime);
+    bn_mult_k(&m, 3, prime);
+  } else {
+    m = p->x;
+    bn_multiply(&m, &m, prime);
+    bn_mult_k(&m, 3, prime);
+
+    if (a != 0) {
+      az4 = p->z;
+      bn_multiply(&az4, &az4, prime);
+      bn_multiply(&az4, &az4, prime);
+      bn_mult_k(&az4, -a, prime);
+      bn_subtractmod(&m, &az4, &m, prime);
+    }
+  }
   bn_mult_half(&m, prime);
 
   // msq = m^2
@@ -402,6 +444,20 @@ void point_jacobian_double(jacobian_curve_point *p, const ecdsa_curve *curve) {
   bn_fast_mod(&p->y, prime);
 }
 
+void point_jacobian_double(jacobian_curve_point *p, const ecdsa_curve *curve) {
+  switch (curve->a) {
+    case 0:
+      jacobian_double_a(p, &curve->prime, 0);
+      break;
+    case -3:
+      jacobian_double_a(p, &curve->prime, -3);
+      break;
+    default:
+      jacobian_double_a(p, &curve->prime, curve->a);
+      break;
+  }
+}
+
 // res = k * p
 void point_multiply(const ecdsa_curve *curve, const bignum256 *k,
                     const curve_point *p, curve_point *res) {
@@ -526,22 +582,29 @@ void point_multiply(const ecdsa_curve *curve, const bignum256 *k,
 
 #if USE_PRECOMPUTED_CP
 
-// res = k * G
+// bits of k per position of curve->cp
+#define CP_WINDOW USE_PRECOMPUTED_CP_WINDOW
+#define CP_MASK ((1 << CP_WINDOW) - 1)
+// 2^CP_BITS is added to k, 256 <= CP_BITS <= 260
+#define CP_BITS (CP_WINDOW * CP_POSITIONS)
+
+// jres = k * G
+// returns 0 if the result is the point at infinity (k == 0), 1 otherwise
 // k must be a normalized number with 0 <= k < curve->order
-void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k,
-                     curve_point *res) {
+static int scalar_multiply_jacobian(const ecdsa_curve *curve,
+                                    const bignum256 *k,
+                                    jacobian_curve_point *jres) {
   assert(bn_is_less(k, &curve->order));
 
   int i = {0}, j = {0};
   static CONFIDENTIAL bignum256 a;
   uint32_t is_even = (k->val[0] & 1) - 1;
   uint32_t lowbits = 0;
-  static CONFIDENTIAL jacobian_curve_point jres;
   const bignum256 *prime = &curve->prime;
 
   // is_even = 0xffffffff if k is even, 0 otherwise.
 
-  // add 2^256.
+  // add 2^CP_BITS.
   // make number odd: subtract curve->order if even
   uint32_t tmp = 1;
   uint32_t is_non_zero = 0;
@@ -552,64 +615,79 @@ void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k,
     tmp >>= BN_BITS_PER_LIMB;
   }
   is_non_zero |= k->val[j];
-  a.val[j] = tmp + 0xffffff + k->val[j] - (curve->order.val[j] & is_even);
+  a.val[j] = tmp + ((1 << (CP_BITS - 8 * BN_BITS_PER_LIMB)) - 1) + k->val[j] -
+             (curve->order.val[j] & is_even);
   assert((a.val[0] & 1) != 0);
 
   // special case 0*G:  just return zero. We don't care about constant time.
   if (!is_non_zero) {
-    point_set_infinity(res);
-    return;
+    return 0;
   }
 
-  // Now a = k + 2^256 (mod curve->order) and a is odd.
+  // Now a = k + 2^CP_BITS (mod curve->order) and a is odd.
+  // Let w = CP_WINDOW and n = CP_POSITIONS, so that CP_BITS = w * n.
   //
   // The idea is to bring the new a into the form.
-  // sum_{i=0..64} a[i] 16^i,  where |a[i]| < 16 and a[i] is odd.
+  // sum_{i=0..n} a[i] 2^(w*i),  where |a[i]| < 2^w and a[i] is odd.
   // a[0] is odd, since a is odd.  If a[i] would be even, we can
-  // add 1 to it and subtract 16 from a[i-1].  Afterwards,
-  // a[64] = 1, which is the 2^256 that we added before.
+  // add 1 to it and subtract 2^w from a[i-1].  Afterwards,
+  // a[n] = 1, which is the 2^CP_BITS that we added before.
   //
-  // Since k = a - 2^256 (mod curve->order), we can compute
-  //   k*G = sum_{i=0..63} a[i] 16^i * G
+  // Since k = a - 2^CP_BITS (mod curve->order), we can compute
+  //   k*G = sum_{i=0..n-1} a[i] 2^(w*i) * G
   //
   // We have a big table curve->cp that stores all possible
-  // values of |a[i]| 16^i * G.
-  // curve->cp[i][j] = (2*j+1) * 16^i * G
-
-  // now compute  res = sum_{i=0..63} a[i] * 16^i * G step by step.
-  // initial res = |a[0]| * G.  Note that a[0] = a & 0xf if (a&0x10) != 0
-  // and - (16 - (a & 0xf)) otherwise.   We can compute this as
-  //   ((a ^ (((a >> 4) & 1) - 1)) & 0xf) >> 1
+  // values of |a[i]| 2^(w*i) * G.
+  // curve->cp[i][j] = (2*j+1) * 2^(w*i) * G
+
+  // now compute  res = sum_{i=0..n-1} a[i] * 2^(w*i) * G step by step.
+  // initial res = |a[0]| * G.  Note that a[0] = a & CP_MASK if
+  // (a & 2^w) != 0 and - (2^w - (a & CP_MASK)) otherwise.  We can compute
+  // this as
+  //   ((a ^ (((a >> w) & 1) - 1)) & CP_MASK) >> 1
   // since a is odd.
-  lowbits = a.val[0] & ((1 << 5) - 1);
-  lowbits ^= (lowbits >> 4) - 1;
-  lowbits &= 15;
-  curve_to_jacobian(&curve->cp[0][lowbits >> 1], &jres, prime);
-  for (i = 1; i < 64; i++) {
-    // invariant res = sign(a[i-1]) sum_{j=0..i-1} (a[j] * 16^j * G)
-
-    // shift a by 4 places.
+  lowbits = a.val[0] & ((1 << (CP_WINDOW + 1)) - 1);
+  lowbits ^= (lowbits >> CP_WINDOW) - 1;
+  lowbits &= CP_MASK;
+  curve_to_jacobian(&curve->cp[0][lowbits >> 1], jres, prime);
+  for (i = 1; i < CP_POSITIONS; i++) {
+    // invariant res = sign(a[i-1]) sum_{j=0..i-1} (a[j] * 2^(w*j) * G)
+
+    // shift a by w places.
     for (j = 0; j < 8; j++) {
-      a.val[j] =
-          (a.val[j] >> 4) | ((a.val[j + 1] & 0xf) << (BN_BITS_PER_LIMB - 4));
+      a.val[j] = (a.val[j] >> CP_WINDOW) |
+                 ((a.val[j + 1] & CP_MASK) << (BN_BITS_PER_LIMB - CP_WINDOW));
     }
-    a.val[j] >>= 4;
-    // a = old(a)>>(4*i)
+    a.val[j] >>= CP_WINDOW;
+    // a = old(a)>>(w*i)
     // a is even iff sign(a[i-1]) = -1
 
-    lowbits = a.val[0] & ((1 << 5) - 1);
-    lowbits ^= (lowbits >> 4) - 1;
-    lowbits &= 15;
+    lowbits = a.val[0] & ((1 << (CP_WINDOW + 1)) - 1);
+    lowbits ^= (lowbits >> CP_WINDOW) - 1;
+    lowbits &= CP_MASK;
     // negate last result to make signs of this round and the
     // last round equal.
-    bn_cnegate(~lowbits & 1, &jres.y, prime);
+    bn_cnegate(~lowbits & 1, &jres->y, prime);
 
     // add odd factor
-    point_jacobian_add(&curve->cp[i][lowbits >> 1], &jres, curve);
+    point_jacobian_add(&curve->cp[i][lowbits >> 1], jres, curve);
   }
-  bn_cnegate(~(a.val[0] >> 4) & 1, &jres.y, prime);
-  jacobian_to_curve(&jres, res, prime);
+  bn_cnegate(~(a.val[0] >> CP_WINDOW) & 1, &jres->y, prime);
   memzero(&a, sizeof(a));
+  return 1;
+}
+
+// res = k * G
+// k must be a normalized number with 0 <= k < curve->order
+void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k,
+                     curve_point *res) {
+  static CONFIDENTIAL jacobian_curve_point jres;
+
+  if (scalar_multiply_jacobian(curve, k, &jres)) {
+    jacobian_to_curve(&jres, res, &curve->prime);
+  } else {
+    point_set_infinity(res);
+  }
   memzero(&jres, sizeof(jres));
 }
 
@@ -622,6 +700,422 @@ void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k,
 
 #endif
 
+// p = jp in affine coordinates, where zinv == 1 / jp->z
+// Guarantees p is fully reduced
+static void jacobian_to_curve_zinv(const jacobian_curve_point *jp,
+                                   const bignum256 *zinv, curve_point *p,
+                                   const bignum256 *prime) {
+  p->x = *zinv;
+  bn_multiply(zinv, &p->x, prime);
+  // x = z^-2
+  p->y = p->x;
+  bn_multiply(zinv, &p->y, prime);
+  // y = z^-3
+  bn_multiply(&jp->x, &p->x, prime);
+  bn_multiply(&jp->y, &p->y, prime);
+  bn_mod(&p->x, prime);
+  bn_mod(&p->y, prime);
+}
+
+// returns 1 if jp is not the point at infinity, i.e. jp->z != 0 modulo prime
+static int jacobian_is_finite(const jacobian_curve_point *jp,
+                              const bignum256 *prime) {
+  bignum256 z = jp->z;
+  bn_mod(&z, prime);
+  return !bn_is_zero(&z);
+}
+
+// window size of the wNAF representation used by point_multiply_double
+#define WNAF_WINDOW 5
+#define WNAF_TABLE_SIZE (1 << (WNAF_WINDOW - 2))
+
+// Computes the width-w NAF representation of k, i.e.
+//   k = sum_{i=0..256} naf[i] * 2^i
+// where each naf[i] is either zero or odd with |naf[i]| < 2^(w-1) and
+// at most one of any w consecutive digits is non-zero.
+// Assumes k is normalized and k < 2**256, 2 <= w <= 8
+// The function doesn't have neither constant control flow nor constant memory
+//   access flow with regard to k
+static void wnaf_encode(const bignum256 *k, int w, int8_t naf[257]) {
+  int carry = 0;
+  int bit = 0;
+
+  memset(naf, 0, 257);
+  while (bit < 256) {
+    if ((int)bn_testbit(k, bit) == carry) {
+      bit++;
+      continue;
+    }
+
+    int now = w;
+    if (now > 256 - bit) {
+      now = 256 - bit;
+    }
+
+    // word = bits bit .. bit + now - 1 of k
+    int limb = bit / BN_BITS_PER_LIMB;
+    int shift = bit % BN_BITS_PER_LIMB;
+    uint32_t word = k->val[limb] >> shift;
+    if (shift + now > BN_BITS_PER_LIMB && limb + 1 < BN_LIMBS) {
+      word |= k->val[limb + 1] << (BN_BITS_PER_LIMB - shift);
+    }
+    word = (word & ((1u << now) - 1)) + carry;
+
+    carry = (word >> (w - 1)) & 1;
+    naf[bit] = (int)word - (carry << w);
+    bit += now;
+  }
+  naf[256] = carry;
+}
+
+// table[i] = (2 * i + 1) * p for 0 <= i < WNAF_TABLE_SIZE
+// Assumes p is not the point at infinity
+static void wnaf_table(const ecdsa_curve *curve, const curve_point *p,
+                       curve_point table[WNAF_TABLE_SIZE]) {
+  const bignum256 *prime = &curve->prime;
+  jacobian_curve_point jtable[WNAF_TABLE_SIZE] = {0};
+  bignum256 zinv[WNAF_TABLE_SIZE - 1] = {0};
+  bignum256 scratch[WNAF_TABLE_SIZE - 1] = {0};
+  curve_point p2 = *p;
+
+  point_double(curve, &p2);
+  jtable[0].x = p->x;
+  jtable[0].y = p->y;
+  bn_one(&jtable[0].z);
+  for (int i = 1; i < WNAF_TABLE_SIZE; i++) {
+    jtable[i] = jtable[i - 1];
+    point_jacobian_add(&p2, &jtable[i], curve);
+    zinv[i - 1] = jtable[i].z;
+  }
+
+  // convert all points to affine coordinates with a single inversion
+  bn_inverse_batch(zinv, WNAF_TABLE_SIZE - 1, prime, scratch);
+  table[0] = *p;
+  for (int i = 1; i < WNAF_TABLE_SIZE; i++) {
+    jacobian_to_curve_zinv(&jtable[i], &zinv[i - 1], &table[i], prime);
+  }
+}
+
+// jres += digit * p, where table contains the odd multiples of p
+// *is_infinity tracks whether jres is the point at infinity
+static void wnaf_add(const ecdsa_curve *curve,
+                     const curve_point table[WNAF_TABLE_SIZE], int digit,
+                     jacobian_curve_point *jres, int *is_infinity) {
+  curve_point q = {0};
+
+  if (digit > 0) {
+    q = table[(digit - 1) / 2];
+  } else {
+    q = table[(-digit - 1) / 2];
+    bn_subtract(&curve->prime, &q.y, &q.y);
+  }
+
+  if (*is_infinity) {
+    jres->x = q.x;
+    jres->y = q.y;
+    bn_one(&jres->z);
+    *is_infinity = 0;
+    return;
+  }
+
+  point_jacobian_add(&q, jres, curve);
+
+  // point_jacobian_add yields z == 0 if q == -jres
+  *is_infinity = !jacobian_is_finite(jres, &curve->prime);
+}
+
+// jres = sum(naf[j] * p[j] for 0 <= j < count), where tables[j] contains
+// the odd multiples of p[j] and naf[j] is its width-w NAF scalar
+// returns 0 if the result is the point at infinity, 1 otherwise
+// The function doesn't have neither constant control flow nor constant memory
+//   access flow, so it must be used only with public data
+static int wnaf_multiply_jacobian(const ecdsa_curve *curve, int count,
+                                  int8_t naf[][257],
+                                  const curve_point *const tables[],
+                                  jacobian_curve_point *jres) {
+  int is_infinity = 1;
+
+  for (int i = 256; i >= 0; i--) {
+    if (!is_infinity) {
+      point_jacobian_double(jres, curve);
+    }
+    for (int j = 0; j < count; j++) {
+      if (naf[j][i] != 0) {
+        wnaf_add(curve, tables[j], naf[j][i], jres, &is_infinity);
+      }
+    }
+  }
+
+  return !is_infinity;
+}
+
+#if USE_SECP256K1_ENDOMORPHISM
+// lambda * (x, y) == (beta * x, y) for every point (x, y) on secp256k1
+static const bignum256 secp256k1_lambda = {
+    .val = {0x1b23bd72, 0x1814b3e0, 0x00599e37, 0x1c45d441, 0x0645a122,
+            0x0e014409, 0x03829498, 0x09980b86, 0x005363ad}};
+static const bignum256 secp256k1_beta = {
+    .val = {0x119501ee, 0x09cb6143, 0x1d626570, 0x0092ea25, 0x034e99cf,
+            0x03cf561a, 0x1c41b991, 0x056caf80, 0x007ae96a}};
+
+// short basis (a1, b1), (a2, b2) of the lattice of all (k1, k2) with
+// k1 + k2 * lambda == 0 modulo order, b2 == a1
+static const bignum256 secp256k1_glv_a1 = {
+    .val = {0x1284eb15, 0x03648724, 0x151af37a, 0x0da4434f, 0x00000308}};
+static const bignum256 secp256k1_glv_minus_b1 = {
+    .val = {0x0abfe4c3, 0x1aa3fd48, 0x03a20a1b, 0x06fdac02, 0x00000e44}};
+
+// g1 == round(2**384 * b2 / order), g2 == round(2**384 * -b1 / order)
+static const bignum256 secp256k1_glv_g1 = {
+    .val = {0x05dbb031, 0x049904d2, 0x1a329ffa, 0x151428e3, 0x0eb153da,
+            0x08724942, 0x0f37a1b2, 0x0434fa8d, 0x003086d2}};
+static const bignum256 secp256k1_glv_g2 = {
+    .val = {0x0ac47f71, 0x0b8da574, 0x1d41b185, 0x0411593b, 0x1e4c4221,
+            0x1fd4855f, 0x00a1bd51, 0x1ac021d1, 0x00e4437e}};
+
+// c = round(k * g / 2**384)
+// Assumes k, g are normalized, k, g < 2**256
+// Guarantees c is normalized, c < 2**128
+static void glv_round(const bignum256 *k, const bignum256 *g, bignum256 *c) {
+  uint32_t res[2 * BN_LIMBS] = {0};
+  // 384 == 13 * BN_BITS_PER_LIMB + 7
+  const int limb = 13, shift = 7;
+
+  bn_multiply_long(k, g, res);
+
+  // res += 2**383
+  uint32_t carry = 1u << (shift - 1);
+  for (int i = limb; i < 2 * BN_LIMBS; i++) {
+    carry += res[i];
+    res[i] = carry & BN_LIMB_MASK;
+    carry >>= BN_BITS_PER_LIMB;
+  }
+
+  bn_zero(c);
+  for (int i = 0; limb + i < 2 * BN_LIMBS; i++) {
+    c->val[i] = res[limb + i] >> shift;
+    if (limb + i + 1 < 2 * BN_LIMBS) {
+      c->val[i] |= (res[limb + i + 1] << (BN_BITS_PER_LIMB - shift)) &
+                   BN_LIMB_MASK;
+    }
+  }
+}
+
+// Splits k into k == (-1)**neg1 * k1 + (-1)**neg2 * k2 * lambda modulo
+// order with k1, k2 < 2**128, using the rounding method from
+// Gallant, Lambert, Vanstone: Faster Point Multiplication on Elliptic Curves
+// with Efficient Endomorphisms
+// Assumes k is normalized and k < secp256k1.order
+static void glv_split(const bignum256 *k, bignum256 *k1, int *neg1,
+                      bignum256 *k2, int *neg2) {
+  const bignum256 *order = &secp256k1.order;
+  bignum256 c1 = {0}, c2 = {0};
+
+  glv_round(k, &secp256k1_glv_g1, &c1);
+  glv_round(k, &secp256k1_glv_g2, &c2);
+
+  // k2 = c1 * -b1 - c2 * b2
+  bn_multiply(&secp256k1_glv_minus_b1, &c1, order);
+  bn_multiply(&secp256k1_glv_a1, &c2, order);
+  bn_mod(&c2, order);
+  bn_subtractmod(&c1, &c2, k2, order);
+  bn_fast_mod(k2, order);
+  bn_mod(k2, order);
+
+  // k1 = k - k2 * lambda
+  c1 = *k2;
+  bn_multiply(&secp256k1_lambda, &c1, order);
+  bn_mod(&c1, order);
+  bn_subtractmod(k, &c1, k1, order);
+  bn_fast_mod(k1, order);
+  bn_mod(k1, order);
+
+  *neg1 = bn_is_less(&secp256k1.order_half, k1);
+  if (*neg1) {
+    bn_subtract(order, k1, k1);
+  }
+  *neg2 = bn_is_less(&secp256k1.order_half, k2);
+  if (*neg2) {
+    bn_subtract(order, k2, k2);
+  }
+}
+
+// naf = width-w NAF of (-1)**neg * k, see wnaf_encode
+static void wnaf_encode_signed(const bignum256 *k, int neg, int8_t naf[257]) {
+  wnaf_encode(k, WNAF_WINDOW, naf);
+  if (neg) {
+    for (int i = 0; i < 257; i++) {
+      naf[i] = -naf[i];
+    }
+  }
+}
+
+// out[i] = lambda * table[i] for 0 <= i < WNAF_TABLE_SIZE
+static void glv_table(const curve_point table[WNAF_TABLE_SIZE],
+                      curve_point out[WNAF_TABLE_SIZE]) {
+  for (int i = 0; i < WNAF_TABLE_SIZE; i++) {
+    out[i].x = table[i].x;
+    bn_multiply(&secp256k1_beta, &out[i].x, &secp256k1.prime);
+    bn_mod(&out[i].x, &secp256k1.prime);
+    out[i].y = table[i].y;
+  }
+}
+#endif
+
+// jres = k1 * p1 + k2 * p2
+// returns 0 if the result is the point at infinity, 1 otherwise
+// Uses interleaved width-w NAF (Straus' method), so all doublings are
+// shared between both scalars. If p1 is the base point of the curve, odd
+// multiples of G are taken from the precomputed table curve->cp. On secp256k1
+// both scalars are split into 128-bit halves using the endomorphism if
+// USE_SECP256K1_ENDOMORPHISM is enabled, which halves the number of doublings.
+// Assumes k1, k2 are normalized and k1, k2 < curve->order
+// Assumes p1 and p2 are valid points other than the point at infinity
+// The function doesn't have neither constant control flow nor constant memory
+//   access flow, so it must be used only with public data
+static int point_multiply_double_jacobian(const ecdsa_curve *curve,
+                                          const bignum256 *k1,
+                                          const curve_point *p1,
+                                          const bignum256 *k2,
+                                          const curve_point *p2,
+                                          jacobian_curve_point *jres) {
+  curve_point table1_buf[WNAF_TABLE_SIZE] = {0};
+  curve_point table2[WNAF_TABLE_SIZE] = {0};
+  const curve_point *table1 = table1_buf;
+
+#if USE_PRECOMPUTED_CP
+  // curve->cp[0][i] = (2 * i + 1) * G
+  if (point_is_equal(p1, &curve->G)) {
+    table1 = curve->cp[0];
+  } else
+#endif
+  {
+    wnaf_table(curve, p1, table1_buf);
+  }
+  wnaf_table(curve, p2, table2);
+
+#if USE_SECP256K1_ENDOMORPHISM
+  if (curve == &secp256k1) {
+    int8_t naf[4][257] = {0};
+    curve_point table1_lambda[WNAF_TABLE_SIZE] = {0};
+    curve_point table2_lambda[WNAF_TABLE_SIZE] = {0};
+    const curve_point *const tables[4] = {table1, table1_lambda, table2,
+                                          table2_lambda};
+    bignum256 a = {0}, b = {0};
+    int neg_a = 0, neg_b = 0;
+
+    glv_split(k1, &a, &neg_a, &b, &neg_b);
+    wnaf_encode_signed(&a, neg_a, naf[0]);
+    wnaf_encode_signed(&b, neg_b, naf[1]);
+    glv_split(k2, &a, &neg_a, &b, &neg_b);
+    wnaf_encode_signed(&a, neg_a, naf[2]);
+    wnaf_encode_signed(&b, neg_b, naf[3]);
+
+    glv_table(table1, table1_lambda);
+    glv_table(table2, table2_lambda);
+
+    return wnaf_multiply_jacobian(curve, 4, naf, tables, jres);
+  }
+#endif
+
+  int8_t naf[2][257] = {0};
+  const curve_point *const tables[2] = {table1, table2};
+
+  wnaf_encode(k1, WNAF_WINDOW, naf[0]);
+  wnaf_encode(k2, WNAF_WINDOW, naf[1]);
+
+  return wnaf_multiply_jacobian(curve, 2, naf, tables, jres);
+}
+
+// res = k1 * p1 + k2 * p2
+// Assumes k1, k2 are normalized and k1, k2 < curve->order
+// Assumes p1 and p2 are valid points other than the point at infinity
+// The function is not constant time, use it only with public data
+void point_multiply_double(const ecdsa_curve *curve, const bignum256 *k1,
+                           const curve_point *p1, const bignum256 *k2,
+                           const curve_point *p2, curve_point *res) {
+  jacobian_curve_point jres = {0};
+
+  if (point_multiply_double_jacobian(curve, k1, p1, k2, p2, &jres)) {
+    jacobian_to_curve(&jres, res, &curve->prime);
+  } else {
+    point_set_infinity(res);
+  }
+}
+
+// jres = k * G + p
+// returns 0 if the result is the point at infinity, 1 otherwise
+static int scalar_multiply_add_jacobian(const ecdsa_curve *curve,
+                                        const bignum256 *k,
+                                        const curve_point *p,
+                                        jacobian_curve_point *jres) {
+#if USE_PRECOMPUTED_CP
+  if (!scalar_multiply_jacobian(curve, k, jres)) {
+    jres->x = p->x;
+    jres->y = p->y;
+    bn_one(&jres->z);
+    return 1;
+  }
+  point_jacobian_add(p, jres, curve);
+  return jacobian_is_finite(jres, &curve->prime);
+#else
+  bignum256 one = {0};
+  bn_one(&one);
+  return point_multiply_double_jacobian(curve, k, &curve->G, &one, p, jres);
+#endif
+}
+
+// res[i] = k[i] * G + p for 0 <= i < n
+// The results are kept in Jacobian coordinates and every
+// SCALAR_MULTIPLY_BATCH_SIZE of them are converted to affine coordinates
+// with a single inversion, see bn_inverse_batch
+// Assumes all k[i] are normalized and k[i] < curve->order
+// Assumes p is a valid point other than the point at infinity
+// Without USE_PRECOMPUTED_CP the function is not constant time, use it only
+//   with public data
+void scalar_multiply_add_batch(const ecdsa_curve *curve, size_t n,
+                               const bignum256 *k, const curve_point *p,
+                               curve_point *res) {
+  const bignum256 *prime = &curve->prime;
+  jacobian_curve_point jres[SCALAR_MULTIPLY_BATCH_SIZE] = {0};
+  bignum256 zinv[SCALAR_MULTIPLY_BATCH_SIZE] = {0};
+  bignum256 scratch[SCALAR_MULTIPLY_BATCH_SIZE] = {0};
+  int is_finite[SCALAR_MULTIPLY_BATCH_SIZE] = {0};
+
+  for (size_t start = 0; start < n; start += SCALAR_MULTIPLY_BATCH_SIZE) {
+    size_t count = n - start;
+    if (count > SCALAR_MULTIPLY_BATCH_SIZE) {
+      count = SCALAR_MULTIPLY_BATCH_SIZE;
+    }
+
+    size_t finite = 0;
+    for (size_t i = 0; i < count; i++) {
+      is_finite[i] =
+          scalar_multiply_add_jacobian(curve, &k[start + i], p, &jres[i]);
+      if (is_finite[i]) {
+        zinv[finite++] = jres[i].z;
+      }
+    }
+
+    if (finite > 0) {
+      bn_inverse_batch(zinv, finite, prime, scratch);
+    }
+
+    finite = 0;
+    for (size_t i = 0; i < count; i++) {
+      if (is_finite[i]) {
+        jacobian_to_curve_zinv(&jres[i], &zinv[finite++], &res[start + i],
+                               prime);
+      } else {
+        point_set_infinity(&res[start + i]);
+      }
+    }
+  }
+
+  memzero(jres, sizeof(jres));
+  memzero(zinv, sizeof(zinv));
+}
+
 int ecdh_multiply(const ecdsa_curve *curve, const uint8_t *priv_key,
                   const uint8_t *pub_key, uint8_t *session_key) {
   curve_point point = {0};
@@ -801,13 +1295,17 @@ int ecdsa_uncompress_pubkey(const ecdsa_curve *curve, const uint8_t *pub_key,
 void ecdsa_get_pubkeyhash(const uint8_t *pub_key, HasherType hasher_pubkey,
                           uint8_t *pubkeyhash) {
   uint8_t h[HASHER_DIGEST_LENGTH] = {0};
+  size_t len = 33;           // expecting compressed format
   if (pub_key[0] == 0x04) {  // uncompressed format
-    hasher_Raw(hasher_pubkey, pub_key, 65, h);
+    len = 65;
   } else if (pub_key[0] == 0x00) {  // point at infinity
-    hasher_Raw(hasher_pubkey, pub_key, 1, h);
-  } else {  // expecting compressed format
-    hasher_Raw(hasher_pubkey, pub_key, 33, h);
+    len = 1;
+  }
+  if (hasher_pubkey == HASHER_SHA2_RIPEMD) {
+    hash160(pub_key, len, pubkeyhash);
+    return;
   }
+  hasher_Raw(hasher_pubkey, pub_key, len, h);
   memcpy(pubkeyhash, h, 20);
   memzero(h, sizeof(h));
 }
@@ -894,6 +1392,53 @@ void uncompress_coords(const ecdsa_curve *curve, uint8_t odd,
   }
 }
 
+#if USE_PUBKEY_CACHE
+// Multisig cosigner keys, xpubs and message signers are read again and again.
+// An entry only supplies the y coordinate, the point is validated as if it
+// were computed, so a stale or concurrently overwritten entry cannot produce
+// a wrong point, at worst the square root is computed after all.
+static uint32_t pubkey_cache_tick = 0;
+
+static struct {
+  const ecdsa_curve *curve;
+  uint32_t used;
+  uint8_t pub_key[33];
+  bignum256 y;
+} pubkey_cache[PUBKEY_CACHE_SIZE];
+
+static bool pubkey_cache_find(const ecdsa_curve *curve, const uint8_t *pub_key,
+                              curve_point *pub) {
+  for (size_t j = 0; j < PUBKEY_CACHE_SIZE; j++) {
+    if (pubkey_cache[j].curve == curve &&
+        memcmp(pubkey_cache[j].pub_key, pub_key, 33) == 0) {
+      memcpy(&pub->y, &pubkey_cache[j].y, sizeof(bignum256));
+      pubkey_cache[j].used = ++pubkey_cache_tick;
+      return (pub->y.val[0] & 1) == (pub_key[0] & 1) &&
+             ecdsa_validate_pubkey(curve, pub);
+    }
+  }
+  return false;
+}
+
+static void pubkey_cache_store(const ecdsa_curve *curve, const uint8_t *pub_key,
+                               const curve_point *pub) {
+  size_t victim = 0;
+  for (size_t j = 0; j < PUBKEY_CACHE_SIZE; j++) {
+    if (pubkey_cache[j].curve == NULL) {
+      victim = j;
+      break;
+    }
+    if (pubkey_cache[j].used < pubkey_cache[victim].used) {
+      victim = j;
+    }
+  }
+  pubkey_cache[victim].curve = curve;
+  pubkey_cache[victim].used = ++pubkey_cache_tick;
+  memcpy(pubkey_cache[victim].pub_key, pub_key, 33);
+  memcpy(&pubkey_cache[victim].y, &pub->y, sizeof(bignum256));
+}
+#endif
+
 int ecdsa_read_pubkey(const ecdsa_curve *curve, const uint8_t *pub_key,
                       curve_point *pub) {
   if (!curve) {
@@ -906,8 +1451,20 @@ int ecdsa_read_pubkey(const ecdsa_curve *curve, const uint8_t *pub_key,
   }
   if (pub_key[0] == 0x02 || pub_key[0] == 0x03) {  // compute missing y coords
     bn_read_be(pub_key + 1, &(pub->x));
+#if USE_PUBKEY_CACHE
+    if (pubkey_cache_find(curve, pub_key, pub)) {
+      return 1;
+    }
+    uncompress_coords(curve, pub_key[0], &(pub->x), &(pub->y));
+    if (!ecdsa_validate_pubkey(curve, pub)) {
+      return 0;
+    }
+    pubkey_cache_store(curve, pub_key, pub);
+    return 1;
+#else
     uncompress_coords(curve, pub_key[0], &(pub->x), &(pub->y));
     return ecdsa_validate_pubkey(curve, pub);
+#endif
   }
   // error
   return 0;
@@ -967,13 +1524,53 @@ int ecdsa_verify(const ecdsa_curve *curve, HasherType hasher_sign,
   return res;
 }
 
+// jres = the public key that produced signature (r, s) of digest, with
+// R = k * G given by r and recid, and rinv = r^-1 modulo curve->order
+// returns 0 if there is no such public key, 1 otherwise
+// Assumes 0 < r, s < curve->order
+static int ecdsa_recover_jacobian(const ecdsa_curve *curve, const bignum256 *r,
+                                  const bignum256 *rinv, const bignum256 *s,
+                                  const uint8_t *digest, int recid,
+                                  jacobian_curve_point *jres) {
+  bignum256 e = {0}, u = {0};
+  curve_point cp = {0};
+
+  // cp = R = k * G (k is secret nonce when signing)
+  cp.x = *r;
+  if (recid & 2) {
+    bn_add(&cp.x, &curve->order);
+    if (!bn_is_less(&cp.x, &curve->prime)) {
+      return 0;
+    }
+  }
+  // compute y from x
+  uncompress_coords(curve, recid & 1, &cp.x, &cp.y);
+  if (!ecdsa_validate_pubkey(curve, &cp)) {
+    return 0;
+  }
+  // e = -digest * r^-1
+  bn_read_be(digest, &e);
+  bn_mod(&e, &curve->order);
+  bn_subtract(&curve->order, &e, &e);
+  bn_multiply(rinv, &e, &curve->order);
+  bn_mod(&e, &curve->order);
+  // u = s * r^-1
+  u = *s;
+  bn_multiply(rinv, &u, &curve->order);
+  bn_mod(&u, &curve->order);
+  // jres = -digest * r^-1 * G + s * r^-1 * k * G
+  //      = (s * r^-1 * k - digest * r^-1) * G = Pub
+  return point_multiply_double_jacobian(curve, &e, &curve->G, &u, &cp, jres);
+}
+
 // Compute public key from signature and recovery id.
 // returns 0 if the key is successfully recovered
 int ecdsa_recover_pub_from_sig(const ecdsa_curve *curve, uint8_t *pub_key,
                                const uint8_t *sig, const uint8_t *digest,
                                int recid) {
-  bignum256 r = {0}, s = {0}, e = {0};
-  curve_point cp = {0}, cp2 = {0};
+  bignum256 r = {0}, rinv = {0}, s = {0};
+  jacobian_curve_point jres = {0};
+  curve_point cp = {0};
 
   // read r and s
   bn_read_be(sig, &r);
@@ -984,47 +1581,151 @@ int ecdsa_recover_pub_from_sig(const ecdsa_curve *curve, uint8_t *pub_key,
   if (!bn_is_less(&s, &curve->order) || bn_is_zero(&s)) {
     return 1;
   }
-  // cp = R = k * G (k is secret nonce when signing)
-  memcpy(&cp.x, &r, sizeof(bignum256));
-  if (recid & 2) {
-    bn_add(&cp.x, &curve->order);
-    if (!bn_is_less(&cp.x, &curve->prime)) {
-      return 1;
-    }
-  }
-  // compute y from x
-  uncompress_coords(curve, recid & 1, &cp.x, &cp.y);
-  if (!ecdsa_validate_pubkey(curve, &cp)) {
+  rinv = r;
+  bn_inverse(&rinv, &curve->order);
+  if (!ecdsa_recover_jacobian(curve, &r, &rinv, &s, digest, recid, &jres)) {
     return 1;
   }
-  // e = -digest
-  bn_read_be(digest, &e);
-  bn_mod(&e, &curve->order);
-  bn_subtract(&curve->order, &e, &e);
-  // r = r^-1
-  bn_inverse(&r, &curve->order);
-  // e = -digest * r^-1
-  bn_multiply(&r, &e, &curve->order);
-  bn_mod(&e, &curve->order);
-  // s = s * r^-1
-  bn_multiply(&r, &s, &curve->order);
-  bn_mod(&s, &curve->order);
-  // cp = s * r^-1 * k * G
-  point_multiply(curve, &s, &cp, &cp);
-  // cp2 = -digest * r^-1 * G
-  scalar_multiply(curve, &e, &cp2);
-  // cp = (s * r^-1 * k - digest * r^-1) * G = Pub
-  point_add(curve, &cp2, &cp);
+  jacobian_to_curve(&jres, &cp, &curve->prime);
   pub_key[0] = 0x04;
   bn_write_be(&cp.x, pub_key + 1);
   bn_write_be(&cp.y, pub_key + 33);
   return 0;
 }
 
+// Recovers up to ECDSA_VERIFY_BATCH_SIZE public keys sharing one inversion
+// modulo the curve order and one modulo the prime between them.
+// returns the number of recovered keys
+static size_t ecdsa_recover_pub_from_sig_chunk(const ecdsa_curve *curve,
+                                               size_t n, uint8_t *pub_keys,
+                                               const uint8_t *const *sigs,
+                                               const uint8_t *const *digests,
+                                               const int *recids) {
+  bignum256 r[ECDSA_VERIFY_BATCH_SIZE] = {0};
+  bignum256 s[ECDSA_VERIFY_BATCH_SIZE] = {0};
+  bignum256 inv[ECDSA_VERIFY_BATCH_SIZE] = {0};
+  bignum256 scratch[ECDSA_VERIFY_BATCH_SIZE] = {0};
+  jacobian_curve_point jres[ECDSA_VERIFY_BATCH_SIZE] = {0};
+  int ok[ECDSA_VERIFY_BATCH_SIZE] = {0};
+  curve_point cp = {0};
+  size_t count = 0, recovered = 0;
+
+  for (size_t i = 0; i < n; i++) {
+    bn_read_be(sigs[i], &r[i]);
+    bn_read_be(sigs[i] + 32, &s[i]);
+    ok[i] = !bn_is_zero(&r[i]) && !bn_is_zero(&s[i]) &&
+            bn_is_less(&r[i], &curve->order) &&
+            bn_is_less(&s[i], &curve->order);
+    if (ok[i]) {
+      inv[count++] = r[i];
+    }
+  }
+
+  // inv = r[i]^-1 for the valid signatures
+  if (count > 0) {
+    bn_inverse_batch(inv, count, &curve->order, scratch);
+  }
+  count = 0;
+  for (size_t i = 0; i < n; i++) {
+    if (ok[i]) {
+      ok[i] = ecdsa_recover_jacobian(curve, &r[i], &inv[count++], &s[i],
+                                     digests[i], recids[i], &jres[i]);
+    }
+  }
+
+  // inv = jres[i].z^-1 for the recovered keys
+  count = 0;
+  for (size_t i = 0; i < n; i++) {
+    if (ok[i]) {
+      inv[count++] = jres[i].z;
+    }
+  }
+  if (count > 0) {
+    bn_inverse_batch(inv, count, &curve->prime, scratch);
+  }
+  count = 0;
+  for (size_t i = 0; i < n; i++) {
+    uint8_t *pub_key = pub_keys + 65 * i;
+    if (!ok[i]) {
+      memzero(pub_key, 65);
+      continue;
+    }
+    jacobian_to_curve_zinv(&jres[i], &inv[count++], &cp, &curve->prime);
+    pub_key[0] = 0x04;
+    bn_write_be(&cp.x, pub_key + 1);
+    bn_write_be(&cp.y, pub_key + 33);
+    recovered++;
+  }
+
+  return recovered;
+}
+
+// sigs, digests and recids are arrays of n entries, with the same formats as
+// the respective arguments of ecdsa_recover_pub_from_sig, and pub_keys
+// receives n uncompressed keys of 65 bytes each, the key of a signature that
+// cannot be recovered is set to zeros
+// returns the number of recovered keys
+size_t ecdsa_recover_pub_from_sig_batch(const ecdsa_curve *curve, size_t n,
+                                        uint8_t *pub_keys,
+                                        const uint8_t *const *sigs,
+                                        const uint8_t *const *digests,
+                                        const int *recids) {
+  size_t recovered = 0;
+  for (size_t start = 0; start < n; start += ECDSA_VERIFY_BATCH_SIZE) {
+    size_t len = n - start;
+    if (len > ECDSA_VERIFY_BATCH_SIZE) {
+      len = ECDSA_VERIFY_BATCH_SIZE;
+    }
+    recovered += ecdsa_recover_pub_from_sig_chunk(
+        curve, len, pub_keys + 65 * start, sigs + start, digests + start,
+        recids + start);
+  }
+  return recovered;
+}
+
+// returns true iff jp is not the point at infinity and the affine
+// x coordinate of jp is congruent to r modulo curve->order
+// Assumes 0 < r < curve->order
+static int jacobian_x_matches(const ecdsa_curve *curve,
+                              const jacobian_curve_point *jp,
+                              const bignum256 *r) {
+  const bignum256 *prime = &curve->prime;
+  bignum256 zz = {0}, x = {0}, rz = {0};
+
+  // x / z^2 == r  <=>  x == r * z^2, no inversion needed
+  zz = jp->z;
+  bn_multiply(&jp->z, &zz, prime);
+  bn_mod(&zz, prime);
+  if (bn_is_zero(&zz)) {
+    return 0;
+  }
+
+  x = jp->x;
+  bn_mod(&x, prime);
+
+  rz = *r;
+  bn_multiply(&zz, &rz, prime);
+  bn_mod(&rz, prime);
+  if (bn_is_equal(&x, &rz)) {
+    return 1;
+  }
+
+  // the x coordinate might have been reduced modulo the order
+  rz = *r;
+  bn_add(&rz, &curve->order);
+  if (!bn_is_less(&rz, prime)) {
+    return 0;
+  }
+  bn_multiply(&zz, &rz, prime);
+  bn_mod(&rz, prime);
+  return bn_is_equal(&x, &rz);
+}
+
 // returns 0 if verification succeeded
 int ecdsa_verify_digest(const ecdsa_curve *curve, const uint8_t *pub_key,
                         const uint8_t *sig, const uint8_t *digest) {
-  curve_point pub = {0}, res = {0};
+  curve_point pub = {0};
+  jacobian_curve_point jres = {0};
   bignum256 r = {0}, s = {0}, z = {0};
 
   if (!ecdsa_read_pubkey(curve, pub_key, &pub)) {
@@ -1051,24 +1752,15 @@ int ecdsa_verify_digest(const ecdsa_curve *curve, const uint8_t *pub_key,
     // our message hashes to zero
     // I don't expect this to happen any time soon
     result = 3;
-  } else {
-    scalar_multiply(curve, &z, &res);
-  }
-
-  if (result == 0) {
-    // both pub and res can be infinity, can have y = 0 OR can be equal -> false
-    // negative
-    point_multiply(curve, &s, &pub, &pub);
-    point_add(curve, &pub, &res);
-    bn_mod(&(res.x), &curve->order);
+  } else if (!point_multiply_double_jacobian(curve, &z, &curve->G, &s, &pub,
+                                             &jres) ||
+             !jacobian_x_matches(curve, &jres, &r)) {
     // signature does not match
-    if (!bn_is_equal(&res.x, &r)) {
-      result = 5;
-    }
+    result = 5;
   }
 
   memzero(&pub, sizeof(pub));
-  memzero(&res, sizeof(res));
+  memzero(&jres, sizeof(jres));
   memzero(&r, sizeof(r));
   memzero(&s, sizeof(s));
   memzero(&z, sizeof(z));
@@ -1077,6 +1769,388 @@ int ecdsa_verify_digest(const ecdsa_curve *curve, const uint8_t *pub_key,
   return result;
 }
 
+// Verifies up to ECDSA_VERIFY_BATCH_SIZE signatures sharing one inversion
+// modulo the curve order between them.
+// returns 0 if all signatures are valid
+static int ecdsa_verify_digest_chunk(const ecdsa_curve *curve, size_t n,
+                                     const uint8_t *const *pub_keys,
+                                     const uint8_t *const *sigs,
+                                     const uint8_t *const *digests) {
+  bignum256 r[ECDSA_VERIFY_BATCH_SIZE] = {0};
+  bignum256 w[ECDSA_VERIFY_BATCH_SIZE] = {0};
+  bignum256 scratch[ECDSA_VERIFY_BATCH_SIZE] = {0};
+  bignum256 u1 = {0}, u2 = {0};
+  curve_point pub = {0};
+  jacobian_curve_point jres = {0};
+  int result = 0;
+
+  for (size_t i = 0; i < n; i++) {
+    bn_read_be(sigs[i], &r[i]);
+    bn_read_be(sigs[i] + 32, &w[i]);
+    if (bn_is_zero(&r[i]) || bn_is_zero(&w[i]) ||
+        !bn_is_less(&r[i], &curve->order) ||
+        !bn_is_less(&w[i], &curve->order)) {
+      return 2;
+    }
+  }
+
+  // w[i] = s[i]^-1
+  bn_inverse_batch(w, n, &curve->order, scratch);
+
+  for (size_t i = 0; i < n && result == 0; i++) {
+    if (!ecdsa_read_pubkey(curve, pub_keys[i], &pub)) {
+      result = 1;
+      break;
+    }
+
+    // u1 = z * s^-1, u2 = r * s^-1
+    bn_read_be(digests[i], &u1);
+    bn_multiply(&w[i], &u1, &curve->order);
+    bn_mod(&u1, &curve->order);
+    u2 = r[i];
+    bn_multiply(&w[i], &u2, &curve->order);
+    bn_mod(&u2, &curve->order);
+
+    if (bn_is_zero(&u1)) {
+      result = 3;
+      break;
+    }
+
+    if (!point_multiply_double_jacobian(curve, &u1, &curve->G, &u2, &pub,
+                                        &jres) ||
+        !jacobian_x_matches(curve, &jres, &r[i])) {
+      result = 5;
+    }
+  }
+
+  memzero(w, sizeof(w));
+  memzero(&u1, sizeof(u1));
+  memzero(&u2, sizeof(u2));
+  memzero(&pub, sizeof(pub));
+  memzero(&jres, sizeof(jres));
+
+  return result;
+}
+
+// pub_keys, sigs and digests are arrays of n pointers each, with the same
+// formats as the respective arguments of ecdsa_verify_digest
+// returns 0 if all signatures are valid, otherwise returns i + 1 where i is
+// the index of the first signature that failed to verify
+int ecdsa_verify_digest_batch(const ecdsa_curve *curve, size_t n,
+                              const uint8_t *const *pub_keys,
+                              const uint8_t *const *sigs,
+                              const uint8_t *const *digests) {
+  for (size_t start = 0; start < n; start += ECDSA_VERIFY_BATCH_SIZE) {
+    size_t len = n - start;
+    if (len > ECDSA_VERIFY_BATCH_SIZE) {
+      len = ECDSA_VERIFY_BATCH_SIZE;
+    }
+    if (ecdsa_verify_digest_chunk(curve, len, pub_keys + start, sigs + start,
+                                  digests + start) == 0) {
+      continue;
+    }
+    // fall back to single verification to find the offending signature
+    for (size_t i = start; i < start + len; i++) {
+      if (ecdsa_verify_digest(curve, pub_keys[i], sigs[i], digests[i]) != 0) {
+        return i + 1;
+      }
+    }
+  }
+  return 0;
+}
+
+// SHA256(SHA256(tag) || SHA256(tag) || ...), see BIP-340
+static void bip340_tagged_hash_init(SHA256_CTX *ctx, const char *tag) {
+  uint8_t tag_hash[SHA256_DIGEST_LENGTH] = {0};
+  sha256_Raw((const uint8_t *)tag, strlen(tag), tag_hash);
+  sha256_Init(ctx);
+  sha256_Update(ctx, tag_hash, sizeof(tag_hash));
+  sha256_Update(ctx, tag_hash, sizeof(tag_hash));
+}
+
+// e = hash_challenge(r || pub_key || digest) % order
+static void bip340_challenge(const ecdsa_curve *curve, const uint8_t *r,
+                             const uint8_t *pub_key, const uint8_t *digest,
+                             bignum256 *e) {
+  SHA256_CTX ctx = {0};
+  uint8_t hash[SHA256_DIGEST_LENGTH] = {0};
+
+  bip340_tagged_hash_init(&ctx, "BIP0340/challenge");
+  sha256_Update(&ctx, r, 32);
+  sha256_Update(&ctx, pub_key, 32);
+  sha256_Update(&ctx, digest, 32);
+  sha256_Final(&ctx, hash);
+  bn_read_be(hash, e);
+  bn_mod(e, &curve->order);
+}
+
+// Reads the point with the x coordinate x and an even y coordinate
+// returns 1 if the point is valid, 0 otherwise
+static int bip340_lift_x(const ecdsa_curve *curve, const uint8_t *x,
+                         curve_point *p) {
+  uint8_t pub_key[33] = {0x02};
+  memcpy(pub_key + 1, x, 32);
+  return ecdsa_read_pubkey(curve, pub_key, p);
+}
+
+// pub_key - 32 bytes, the x coordinate of priv_key * G
+// returns 0 on success
+int bip340_get_public_key(const ecdsa_curve *curve, const uint8_t *priv_key,
+                          uint8_t *pub_key) {
+  curve_point point = {0};
+  bignum256 d = {0};
+
+  bn_read_be(priv_key, &d);
+  if (bn_is_zero(&d) || !bn_is_less(&d, &curve->order)) {
+    return 1;
+  }
+  scalar_multiply(curve, &d, &point);
+  bn_write_be(&point.x, pub_key);
+
+  memzero(&point, sizeof(point));
+  memzero(&d, sizeof(d));
+  return 0;
+}
+
+// Signs the 32-byte digest as specified by BIP-340
+// aux_rand - 32 bytes of auxiliary randomness mixed into the nonce, or NULL
+// sig - 64 bytes, the x coordinate of R followed by s
+// returns 0 on success
+int bip340_sign_digest(const ecdsa_curve *curve, const uint8_t *priv_key,
+                       const uint8_t *digest, const uint8_t *aux_rand,
+                       uint8_t *sig) {
+  static const uint8_t zero_aux[32] = {0};
+  const bignum256 *order = &curve->order;
+  curve_point point = {0};
+  bignum256 d = {0}, k = {0}, e = {0};
+  uint8_t pub_key[32] = {0};
+  uint8_t t[32] = {0};
+  uint8_t hash[SHA256_DIGEST_LENGTH] = {0};
+  SHA256_CTX ctx = {0};
+  int result = 0;
+
+  bn_read_be(priv_key, &d);
+  if (bn_is_zero(&d) || !bn_is_less(&d, order)) {
+    return 1;
+  }
+
+  // d = -d if P = d * G has an odd y coordinate
+  scalar_multiply(curve, &d, &point);
+  bn_write_be(&point.x, pub_key);
+  bn_cnegate(bn_is_odd(&point.y), &d, order);
+  bn_fast_mod(&d, order);
+  bn_mod(&d, order);
+
+  // t = d ^ hash_aux(aux_rand)
+  bip340_tagged_hash_init(&ctx, "BIP0340/aux");
+  sha256_Update(&ctx, aux_rand ? aux_rand : zero_aux, 32);
+  sha256_Final(&ctx, hash);
+  bn_write_be(&d, t);
+  for (int i = 0; i < 32; i++) {
+    t[i] ^= hash[i];
+  }
+
+  // k = hash_nonce(t || P.x || digest) % order
+  bip340_tagged_hash_init(&ctx, "BIP0340/nonce");
+  sha256_Update(&ctx, t, sizeof(t));
+  sha256_Update(&ctx, pub_key, sizeof(pub_key));
+  sha256_Update(&ctx, digest, 32);
+  sha256_Final(&ctx, hash);
+  bn_read_be(hash, &k);
+  bn_mod(&k, order);
+
+  if (bn_is_zero(&k)) {
+    result = 2;
+  } else {
+    // k = -k if R = k * G has an odd y coordinate
+    scalar_multiply(curve, &k, &point);
+    bn_cnegate(bn_is_odd(&point.y), &k, order);
+    bn_fast_mod(&k, order);
+    bn_mod(&k, order);
+    bn_write_be(&point.x, sig);
+
+    // s = k + e * d
+    bip340_challenge(curve, sig, pub_key, digest, &e);
+    bn_multiply(&d, &e, order);
+    bn_addmod(&e, &k, order);
+    bn_fast_mod(&e, order);
+    bn_mod(&e, order);
+    bn_write_be(&e, sig + 32);
+  }
+
+  memzero(&point, sizeof(point));
+  memzero(&d, sizeof(d));
+  memzero(&k, sizeof(k));
+  memzero(&e, sizeof(e));
+  memzero(t, sizeof(t));
+  memzero(hash, sizeof(hash));
+  memzero(&ctx, sizeof(ctx));
+  return result;
+}
+
+// pub_key - 32 bytes, see bip340_get_public_key
+// sig - 64 bytes, see bip340_sign_digest
+// returns 0 if verification succeeded
+int bip340_verify_digest(const ecdsa_curve *curve, const uint8_t *pub_key,
+                         const uint8_t *sig, const uint8_t *digest) {
+  curve_point pub = {0}, res = {0};
+  jacobian_curve_point jres = {0};
+  bignum256 r = {0}, s = {0}, e = {0};
+
+  if (!bip340_lift_x(curve, pub_key, &pub)) {
+    return 1;
+  }
+
+  bn_read_be(sig, &r);
+  bn_read_be(sig + 32, &s);
+  if (!bn_is_less(&r, &curve->prime) || !bn_is_less(&s, &curve->order)) {
+    return 2;
+  }
+
+  // R = s * G - e * P
+  bip340_challenge(curve, sig, pub_key, digest, &e);
+  if (!bn_is_zero(&e)) {
+    bn_subtract(&curve->order, &e, &e);
+  }
+  if (!point_multiply_double_jacobian(curve, &s, &curve->G, &e, &pub,
+                                      &jres)) {
+    return 5;
+  }
+  jacobian_to_curve(&jres, &res, &curve->prime);
+  if (bn_is_odd(&res.y) || !bn_is_equal(&res.x, &r)) {
+    return 5;
+  }
+
+  return 0;
+}
+
+// Verifies up to BIP340_VERIFY_BATCH_SIZE signatures at once, see
+// "Batch Verification" in BIP-340: with a[0] = 1 and 128-bit a[i]
+//   (sum a[i] * s[i]) * G - sum a[i] * R[i] - sum (a[i] * e[i]) * P[i] == O
+// holds for valid signatures and fails with probability 1 - 2^-128 if any
+// of them is invalid. All terms share the doublings of a single
+// interleaved wNAF multiplication.
+// The a[i] are hashed from fresh randomness and all signatures, keys and
+// digests of the batch, so that they cannot be chosen around even when
+// random_buffer is predictable, e.g. in host builds.
+// returns 0 if all signatures are valid
+static int bip340_verify_digest_chunk(const ecdsa_curve *curve, size_t n,
+                                      const uint8_t *const *pub_keys,
+                                      const uint8_t *const *sigs,
+                                      const uint8_t *const *digests) {
+  const bignum256 *order = &curve->order;
+  curve_point tables_buf[2 * BIP340_VERIFY_BATCH_SIZE + 1][WNAF_TABLE_SIZE] =
+      {0};
+  const curve_point *tables[2 * BIP340_VERIFY_BATCH_SIZE + 1] = {0};
+  int8_t naf[2 * BIP340_VERIFY_BATCH_SIZE + 1][257] = {0};
+  jacobian_curve_point jres = {0};
+  curve_point point = {0};
+  bignum256 g = {0}, a = {0}, s = {0}, e = {0};
+  uint8_t seed[SHA256_DIGEST_LENGTH] = {0};
+  uint8_t a_bytes[SHA256_DIGEST_LENGTH] = {0};
+  SHA256_CTX ctx = {0};
+
+  random_buffer(seed, sizeof(seed));
+  sha256_Init(&ctx);
+  sha256_Update(&ctx, seed, sizeof(seed));
+  for (size_t i = 0; i < n; i++) {
+    sha256_Update(&ctx, sigs[i], 64);
+    sha256_Update(&ctx, pub_keys[i], 32);
+    sha256_Update(&ctx, digests[i], 32);
+  }
+  sha256_Final(&ctx, seed);
+
+  for (size_t i = 0; i < n; i++) {
+    if (i == 0) {
+      bn_one(&a);
+    } else {
+      // a[i] = SHA-256(seed || i) truncated to 128 bits
+      uint8_t index[4] = {0};
+      write_be(index, i);
+      sha256_Init(&ctx);
+      sha256_Update(&ctx, seed, sizeof(seed));
+      sha256_Update(&ctx, index, sizeof(index));
+      sha256_Final(&ctx, a_bytes);
+      memzero(a_bytes, 16);
+      bn_read_be(a_bytes, &a);
+    }
+
+    bn_read_be(sigs[i] + 32, &s);
+    if (!bn_is_less(&s, order)) {
+      return 2;
+    }
+    bip340_challenge(curve, sigs[i], pub_keys[i], digests[i], &e);
+
+    // g += a * s
+    bn_multiply(&a, &s, order);
+    bn_addmod(&g, &s, order);
+    bn_fast_mod(&g, order);
+    bn_mod(&g, order);
+
+    // - a * R
+    if (!bip340_lift_x(curve, sigs[i], &point)) {
+      return 5;
+    }
+    bn_subtract(&curve->prime, &point.y, &point.y);
+    wnaf_table(curve, &point, tables_buf[2 * i + 1]);
+    wnaf_encode(&a, WNAF_WINDOW, naf[2 * i + 1]);
+
+    // - (a * e) * P
+    if (!bip340_lift_x(curve, pub_keys[i], &point)) {
+      return 1;
+    }
+    bn_subtract(&curve->prime, &point.y, &point.y);
+    wnaf_table(curve, &point, tables_buf[2 * i + 2]);
+    bn_multiply(&a, &e, order);
+    bn_mod(&e, order);
+    wnaf_encode(&e, WNAF_WINDOW, naf[2 * i + 2]);
+  }
+
+#if USE_PRECOMPUTED_CP
+  // curve->cp[0][i] = (2 * i + 1) * G
+  tables[0] = curve->cp[0];
+#else
+  wnaf_table(curve, &curve->G, tables_buf[0]);
+  tables[0] = tables_buf[0];
+#endif
+  for (size_t i = 1; i < 2 * n + 1; i++) {
+    tables[i] = tables_buf[i];
+  }
+  wnaf_encode(&g, WNAF_WINDOW, naf[0]);
+
+  if (wnaf_multiply_jacobian(curve, 2 * n + 1, naf, tables, &jres)) {
+    return 5;
+  }
+  return 0;
+}
+
+// pub_keys, sigs and digests are arrays of n pointers each, with the same
+// formats as the respective arguments of bip340_verify_digest
+// returns 0 if all signatures are valid, otherwise returns i + 1 where i is
+// the index of the first signature that failed to verify
+int bip340_verify_digest_batch(const ecdsa_curve *curve, size_t n,
+                               const uint8_t *const *pub_keys,
+                               const uint8_t *const *sigs,
+                               const uint8_t *const *digests) {
+  for (size_t start = 0; start < n; start += BIP340_VERIFY_BATCH_SIZE) {
+    size_t len = n - start;
+    if (len > BIP340_VERIFY_BATCH_SIZE) {
+      len = BIP340_VERIFY_BATCH_SIZE;
+    }
+    if (bip340_verify_digest_chunk(curve, len, pub_keys + start,
+                                   sigs + start, digests + start) == 0) {
+      continue;
+    }
+    // fall back to single verification to find the offending signature
+    for (size_t i = start; i < start + len; i++) {
+      if (bip340_verify_digest(curve, pub_keys[i], sigs[i], digests[i]) != 0) {
+        return i + 1;
+      }
+    }
+  }
+  return 0;
+}
+
 int ecdsa_sig_to_der(const uint8_t *sig, uint8_t *der) {
   int i = 0;
   uint8_t *p = der, *len = NULL, *len1 = NULL, *len2 = NULL;
@@ -24,11 +24,30 @@
 #ifndef __ECDSA_H__
 #define __ECDSA_H__
 
+#include <stddef.h>
 #include <stdint.h>
 #include "bignum.h"
 #include "hasher.h"
 #include "options.h"
 
+#if USE_PRECOMPUTED_CP
+#if USE_PRECOMPUTED_CP_WINDOW < 4 || USE_PRECOMPUTED_CP_WINDOW > 8
+#error "USE_PRECOMPUTED_CP_WINDOW must be between 4 and 8"
+#endif
+// curve->cp[i][j] = (2 * j + 1) * 2^(i * USE_PRECOMPUTED_CP_WINDOW) * G
+#define CP_ENTRIES (1 << (USE_PRECOMPUTED_CP_WINDOW - 1))
+#define CP_POSITIONS \
+  ((256 + USE_PRECOMPUTED_CP_WINDOW - 1) / USE_PRECOMPUTED_CP_WINDOW)
+// name of the table file for windows other than the default,
+// e.g. "secp256k1_w8.table"
+#define CP_TABLE_STR(s) #s
+#define CP_TABLE_XSTR(s) CP_TABLE_STR(s)
+#define CP_TABLE_CAT2(c, w) c##_w##w
+#define CP_TABLE_CAT(c, w) CP_TABLE_CAT2(c, w)
+#define CP_TABLE_FILE(c) \
+  CP_TABLE_XSTR(CP_TABLE_CAT(c, USE_PRECOMPUTED_CP_WINDOW).table)
+#endif
+
 // curve point x and y
 typedef struct {
   bignum256 x, y;
@@ -43,7 +62,7 @@ typedef struct {
   bignum256 b;           // coefficient 'b' of the elliptic curve
 
 #if USE_PRECOMPUTED_CP
-  const curve_point cp[64][8];
+  const curve_point cp[CP_POSITIONS][CP_ENTRIES];
 #endif
 
 } ecdsa_curve;
@@ -67,6 +86,12 @@ void point_add(const ecdsa_curve *curve, const curve_point *cp1,
 void point_double(const ecdsa_curve *curve, curve_point *cp);
 void point_multiply(const ecdsa_curve *curve, const bignum256 *k,
                     const curve_point *p, curve_point *res);
+void point_multiply_double(const ecdsa_curve *curve, const bignum256 *k1,
+                           const curve_point *p1, const bignum256 *k2,
+                           const curve_point *p2, curve_point *res);
+void scalar_multiply_add_batch(const ecdsa_curve *curve, size_t n,
+                               const bignum256 *k, const curve_point *p,
+                               curve_point *res);
 void point_set_infinity(curve_point *p);
 int point_is_infinity(const curve_point *p);
 int point_is_equal(const curve_point *p, const curve_point *q);
@@ -119,9 +144,30 @@ int ecdsa_verify(const ecdsa_curve *curve, HasherType hasher_sign,
                  uint32_t msg_len);
 int ecdsa_verify_digest(const ecdsa_curve *curve, const uint8_t *pub_key,
                         const uint8_t *sig, const uint8_t *digest);
+int ecdsa_verify_digest_batch(const ecdsa_curve *curve, size_t n,
+                              const uint8_t *const *pub_keys,
+                              const uint8_t *const *sigs,
+                              const uint8_t *const *digests);
 int ecdsa_recover_pub_from_sig(const ecdsa_curve *curve, uint8_t *pub_key,
                                const uint8_t *sig, const uint8_t *digest,
                                int recid);
+size_t ecdsa_recover_pub_from_sig_batch(const ecdsa_curve *curve, size_t n,
+                                        uint8_t *pub_keys,
+                                        const uint8_t *const *sigs,
+                                        const uint8_t *const *digests,
+                                        const int *recids);
 int ecdsa_sig_to_der(const uint8_t *sig, uint8_t *der);
 
+int bip340_get_public_key(const ecdsa_curve *curve, const uint8_t *priv_key,
+                          uint8_t *pub_key);
+int bip340_sign_digest(const ecdsa_curve *curve, const uint8_t *priv_key,
+                       const uint8_t *digest, const uint8_t *aux_rand,
+                       uint8_t *sig);
+int bip340_verify_digest(const ecdsa_curve *curve, const uint8_t *pub_key,
+                         const uint8_t *sig, const uint8_t *digest);
+int bip340_verify_digest_batch(const ecdsa_curve *curve, size_t n,
+                               const uint8_t *const *pub_keys,
+                               const uint8_t *const *sigs,
+                               const uint8_t *const *digests);
+
 #endif
@@ -317,6 +317,74 @@ void ge25519_double_scalarmult_vartime(ge25519 *r, const ge25519 *p1, const bign
 	memzero(slide2, sizeof(slide2));
 }
 
+/* computes [sbase]base + sum [s[j]]p[j], for n <= GE25519_MULTI_SCALARMULT_MAX */
+void ge25519_multi_scalarmult_vartime(ge25519 *r, const ge25519 *p, const bignum256modm *s, size_t n, const bignum256modm sbase) {
+	signed char slide[GE25519_MULTI_SCALARMULT_MAX][256], slideb[256] = {0};
+	ge25519_pniels pre[GE25519_MULTI_SCALARMULT_MAX][S1_TABLE_SIZE];
+#ifdef ED25519_NO_PRECOMP
+	ge25519_pniels preb[S2_TABLE_SIZE] = {0};
+#endif
+	ge25519 dp = {0};
+	ge25519_p1p1 t = {0};
+	int32_t i = 0;
+	size_t j = 0;
+	signed char nonzero = 0;
+
+	assert(n <= GE25519_MULTI_SCALARMULT_MAX);
+
+	memzero(&t, sizeof(ge25519_p1p1));
+	contract256_slidingwindow_modm(slideb, sbase, S2_SWINDOWSIZE);
+
+	for (j = 0; j < n; j++) {
+		contract256_slidingwindow_modm(slide[j], s[j], S1_SWINDOWSIZE);
+		ge25519_double(&dp, &p[j]);
+		ge25519_full_to_pniels(pre[j], &p[j]);
+		for (i = 0; i < S1_TABLE_SIZE - 1; i++)
+			ge25519_pnielsadd(&pre[j][i+1], &dp, &pre[j][i]);
+	}
+
+#ifdef ED25519_NO_PRECOMP
+	ge25519_double(&dp, &ge25519_basepoint);
+	ge25519_full_to_pniels(preb, &ge25519_basepoint);
+	for (i = 0; i < S2_TABLE_SIZE - 1; i++)
+		ge25519_pnielsadd(&preb[i+1], &dp, &preb[i]);
+#endif
+
+	ge25519_set_neutral(r);
+
+	for (i = 255; i >= 0; i--) {
+		nonzero = slideb[i];
+		for (j = 0; j < n; j++)
+			nonzero |= slide[j][i];
+		if (nonzero)
+			break;
+	}
+
+	/* all points share the doublings, each one only adds its own digits */
+	for (; i >= 0; i--) {
+		ge25519_double_p1p1(&t, r);
+
+		for (j = 0; j < n; j++) {
+			if (slide[j][i]) {
+				ge25519_p1p1_to_full(r, &t);
+				ge25519_pnielsadd_p1p1(&t, r, &pre[j][abs(slide[j][i]) / 2], (unsigned char)slide[j][i] >> 7);
+			}
+		}
+
+		if (slideb[i]) {
+			ge25519_p1p1_to_full(r, &t);
+#ifdef ED25519_NO_PRECOMP
+			ge25519_pnielsadd_p1p1(&t, r, &preb[abs(slideb[i]) / 2], (unsigned char)slideb[i] >> 7);
+#else
+			ge25519_nielsadd2_p1p1(&t, r, &ge25519_niels_sliding_multiples[abs(slideb[i]) / 2], (unsigned char)slideb[i] >> 7);
+#endif
+		}
+
+		ge25519_p1p1_to_partial(r, &t);
+	}
+	curve25519_mul(r->t, t.x, t.y);
+}
+
 /* computes [s1]p1 + [s2]p2 */
 #if USE_MONERO
 void ge25519_double_scalarmult_vartime2(ge25519 *r, const ge25519 *p1, const bignum256modm s1, const ge25519 *p2, const bignum256modm s2) {
@@ -702,18 +770,19 @@ setsign:
 
 #if !defined(NDEBUG)
 	{
-		bignum25519 check_x={0}, check_y={0}, check_iz={0}, check_v={0};
-		curve25519_recip(check_iz, r->z);
-		curve25519_mul(check_x, r->x, check_iz);
-		curve25519_mul(check_y, r->y, check_iz);
-		curve25519_square(check_x, check_x);
-		curve25519_square(check_y, check_y);
+		/* -X^2 Z^2 + Y^2 Z^2 == Z^4 + d X^2 Y^2, the projective curve
+		 * equation, so that the check does not need an inversion */
+		bignum25519 check_x={0}, check_y={0}, check_z={0}, check_v={0};
+		curve25519_square(check_x, r->x);
+		curve25519_square(check_y, r->y);
+		curve25519_square(check_z, r->z);
 		curve25519_mul(check_v, check_x, check_y);
 		curve25519_mul(check_v, fe_d, check_v);
-		curve25519_add_reduce(check_v, check_v, check_x);
+		curve25519_sub_reduce(check_y, check_y, check_x);
+		curve25519_mul(check_y, check_y, check_z);
+		curve25519_square(check_z, check_z);
+		curve25519_add_reduce(check_v, check_v, check_z);
 		curve25519_sub_reduce(check_v, check_v, check_y);
-		curve25519_set(check_x, 1);
-		curve25519_add_reduce(check_v, check_v, check_x);
 		assert(!curve25519_isnonzero(check_v));
 	}
 #endif
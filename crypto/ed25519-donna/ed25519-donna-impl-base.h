@@ -56,6 +56,15 @@ void ge25519_set_neutral(ge25519 *r);
 /* computes [s1]p1 + [s2]base */
 void ge25519_double_scalarmult_vartime(ge25519 *r, const ge25519 *p1, const bignum256modm s1, const bignum256modm s2);
 
+/* maximum number of points taken by ge25519_multi_scalarmult_vartime */
+#define GE25519_MULTI_SCALARMULT_MAX (2 * ED25519_BATCH_SIZE)
+
+/* computes [sbase]base + sum [s[j]]p[j] */
+void ge25519_multi_scalarmult_vartime(ge25519 *r, const ge25519 *p, const bignum256modm *s, size_t n, const bignum256modm sbase);
+
+/* constant time r = p[pos], for pos < n */
+void ge25519_move_conditional_pniels_array(ge25519_pniels *r, const ge25519_pniels *p, int pos, int n);
+
 /* computes [s1]p1, constant time */
 void ge25519_scalarmult(ge25519 *r, const ge25519 *p1, const bignum256modm s1);
 
@@ -11,6 +11,8 @@
 #ifndef ED25519_DONNA_H
 #define ED25519_DONNA_H
 
+#include "options.h"
+
 #include "ed25519-donna-portable.h"
 
 #include "curve25519-donna-32bit.h"
@@ -8,9 +8,12 @@ extern "C" {
 #endif
 
 void ed25519_publickey_keccak(const ed25519_secret_key sk, ed25519_public_key pk);
+void ed25519_keypair_expand_keccak(const ed25519_secret_key sk, ed25519_keypair_expanded *kp);
 
 int ed25519_sign_open_keccak(const unsigned char *m, size_t mlen, const ed25519_public_key pk, const ed25519_signature RS);
+int ed25519_sign_open_batch_keccak(const unsigned char *const *m, const size_t *mlen, const unsigned char *const *pk, const unsigned char *const *RS, size_t num, int *valid);
 void ed25519_sign_keccak(const unsigned char *m, size_t mlen, const ed25519_secret_key sk, const ed25519_public_key pk, ed25519_signature RS);
+void ed25519_sign_with_expanded_keccak(const unsigned char *m, size_t mlen, const ed25519_keypair_expanded *kp, ed25519_signature RS);
 
 int ed25519_scalarmult_keccak(ed25519_public_key res, const ed25519_secret_key sk, const ed25519_public_key pk);
 
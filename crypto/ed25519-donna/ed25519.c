@@ -16,6 +16,8 @@
 
 #include "ed25519-donna.h"
 #include "ed25519.h"
+#include "memzero.h"
+#include "rand.h"
 
 #include "ed25519-hash-custom.h"
 
@@ -54,6 +56,19 @@ ED25519_FN(ed25519_publickey) (const ed25519_secret_key sk, ed25519_public_key p
 	ge25519_pack(pk, &A);
 }
 
+void
+ED25519_FN(ed25519_keypair_expand) (const ed25519_secret_key sk, ed25519_keypair_expanded *kp) {
+	bignum256modm a = {0};
+	ge25519 ALIGN(16) A;
+
+	/* A = aB, keeping the expanded secret key for signing */
+	ed25519_extsk(kp->sk, sk);
+
+	expand256_modm(a, kp->sk, 32);
+	ge25519_scalarmult_base_niels(&A, ge25519_niels_base_multiples, a);
+	ge25519_pack(kp->pk, &A);
+}
+
 #if USE_CARDANO
 void
 ED25519_FN(ed25519_publickey_ext) (const ed25519_secret_key sk, const ed25519_secret_key skext, ed25519_public_key pk) {
@@ -98,18 +113,15 @@ ED25519_FN(ed25519_cosi_sign) (const unsigned char *m, size_t mlen, const ed2551
 }
 
 void
-ED25519_FN(ed25519_sign) (const unsigned char *m, size_t mlen, const ed25519_secret_key sk, const ed25519_public_key pk, ed25519_signature RS) {
+ED25519_FN(ed25519_sign_with_expanded) (const unsigned char *m, size_t mlen, const ed25519_keypair_expanded *kp, ed25519_signature RS) {
 	ed25519_hash_context ctx;
 	bignum256modm r = {0}, S = {0}, a = {0};
 	ge25519 ALIGN(16) R = {0};
-	hash_512bits extsk = {0}, hashr = {0}, hram = {0};
-
-	ed25519_extsk(extsk, sk);
-
+	hash_512bits hashr = {0}, hram = {0};
 
 	/* r = H(aExt[32..64], m) */
 	ed25519_hash_init(&ctx);
-	ed25519_hash_update(&ctx, extsk + 32, 32);
+	ed25519_hash_update(&ctx, kp->sk + 32, 32);
 	ed25519_hash_update(&ctx, m, mlen);
 	ed25519_hash_final(&ctx, hashr);
 	expand256_modm(r, hashr, 64);
@@ -119,11 +131,11 @@ ED25519_FN(ed25519_sign) (const unsigned char *m, size_t mlen, const ed25519_sec
 	ge25519_pack(RS, &R);
 
 	/* S = H(R,A,m).. */
-	ed25519_hram(hram, RS, pk, m, mlen);
+	ed25519_hram(hram, RS, kp->pk, m, mlen);
 	expand256_modm(S, hram, 64);
 
 	/* S = H(R,A,m)a */
-	expand256_modm(a, extsk, 32);
+	expand256_modm(a, kp->sk, 32);
 	mul256_modm(S, S, a);
 
 	/* S = (r + H(R,A,m)a) */
@@ -133,44 +145,27 @@ ED25519_FN(ed25519_sign) (const unsigned char *m, size_t mlen, const ed25519_sec
 	contract256_modm(RS + 32, S);
 }
 
+void
+ED25519_FN(ed25519_sign) (const unsigned char *m, size_t mlen, const ed25519_secret_key sk, const ed25519_public_key pk, ed25519_signature RS) {
+	ed25519_keypair_expanded kp = {0};
+
+	ed25519_extsk(kp.sk, sk);
+	memcpy(kp.pk, pk, 32);
+	ED25519_FN(ed25519_sign_with_expanded)(m, mlen, &kp, RS);
+	memzero(&kp, sizeof(kp));
+}
+
 #if USE_CARDANO
 void
 ED25519_FN(ed25519_sign_ext) (const unsigned char *m, size_t mlen, const ed25519_secret_key sk, const ed25519_secret_key skext, const ed25519_public_key pk, ed25519_signature RS) {
-	ed25519_hash_context ctx;
-	bignum256modm r = {0}, S = {0}, a = {0};
-	ge25519 ALIGN(16) R = {0};
-	hash_512bits extsk = {0}, hashr = {0}, hram = {0};
+	ed25519_keypair_expanded kp = {0};
 
 	/* we don't stretch the key through hashing first since its already 64 bytes */
-	
-	memcpy(extsk, sk, 32);
-	memcpy(extsk+32, skext, 32);
-
-
-	/* r = H(aExt[32..64], m) */
-	ed25519_hash_init(&ctx);
-	ed25519_hash_update(&ctx, extsk + 32, 32);
-	ed25519_hash_update(&ctx, m, mlen);
-	ed25519_hash_final(&ctx, hashr);
-	expand256_modm(r, hashr, 64);
-
-	/* R = rB */
-	ge25519_scalarmult_base_niels(&R, ge25519_niels_base_multiples, r);
-	ge25519_pack(RS, &R);
-
-	/* S = H(R,A,m).. */
-	ed25519_hram(hram, RS, pk, m, mlen);
-	expand256_modm(S, hram, 64);
-
-	/* S = H(R,A,m)a */
-	expand256_modm(a, extsk, 32);
-	mul256_modm(S, S, a);
-
-	/* S = (r + H(R,A,m)a) */
-	add256_modm(S, S, r);
-
-	/* S = (r + H(R,A,m)a) mod L */
-	contract256_modm(RS + 32, S);
+	memcpy(kp.sk, sk, 32);
+	memcpy(kp.sk + 32, skext, 32);
+	memcpy(kp.pk, pk, 32);
+	ED25519_FN(ed25519_sign_with_expanded)(m, mlen, &kp, RS);
+	memzero(&kp, sizeof(kp));
 }
 #endif
 
@@ -201,6 +196,161 @@ ED25519_FN(ed25519_sign_open) (const unsigned char *m, size_t mlen, const ed2551
 	return ed25519_verify(RS, checkR, 32) ? 0 : -1;
 }
 
+/*
+	R has to be the canonical encoding of its point, because that is what
+	ed25519_sign_open compares it against: y < p and no sign bit on x = 0
+*/
+static int
+ed25519_is_canonical_point(const unsigned char p[32]) {
+	size_t i = 0;
+	int top = (p[31] & 0x7f) == 0x7f, zero = (p[31] & 0x7f) == 0;
+
+	for (i = 1; i < 31; i++) {
+		top &= (p[i] == 0xff);
+		zero &= (p[i] == 0);
+	}
+	/* y >= 2^255 - 19 */
+	if (top && p[0] >= 0xed)
+		return 0;
+	/* y = 1 or y = -1 makes x = 0 */
+	if ((p[31] & 0x80) && ((zero && p[0] == 1) || (top && p[0] == 0xec)))
+		return 0;
+	return 1;
+}
+
+/*
+	Returns 1 if p has a small order, i.e. 8p is the neutral element, whose
+	x is the only x = 0 among the multiples of 8
+*/
+static int
+ed25519_is_small_order(const ge25519 *p) {
+	ge25519 ALIGN(16) q;
+
+	ge25519_double(&q, p);
+	ge25519_double(&q, &q);
+	ge25519_double(&q, &q);
+	return !curve25519_isnonzero(q.x);
+}
+
+/*
+	Checks num signatures, ED25519_BATCH_SIZE at a time, by testing whether
+	sum z_i (S_i B - H(R_i,A_i,m_i) A_i - R_i) is neutral for 128 bit z_i,
+	which shares the doublings of one multi-scalar multiplication between
+	all signatures of a batch.
+
+	valid[i] is set to 1 for the good signatures and to 0 for the bad ones;
+	when a batch fails its signatures are checked one by one to find them.
+	Returns 0 if all signatures are valid, -1 otherwise.
+
+	The z_i are hashed from fresh randomness and all signatures, keys and
+	messages of the batch, so they cannot be chosen around even when
+	random_buffer is predictable. A forgery then passes a batch with a
+	probability of at most 2^-128, unless R or A has a small order
+	component: ed25519_sign_open does not multiply by the cofactor and
+	rejects those, while a batch may cancel them. Signatures with a small
+	order R or A, or a non-canonical A, are therefore checked with
+	ed25519_sign_open instead of in a batch; a mixed order point, whose
+	torsion part is only found by a multiplication by the group order,
+	still passes a batch with a probability of up to 1/2.
+*/
+int
+ED25519_FN(ed25519_sign_open_batch) (const unsigned char *const *m, const size_t *mlen, const unsigned char *const *pk, const unsigned char *const *RS, size_t num, int *valid) {
+	static const unsigned char neutral[32] = {1};
+	ge25519 ALIGN(16) points[GE25519_MULTI_SCALARMULT_MAX], P;
+	bignum256modm scalars[GE25519_MULTI_SCALARMULT_MAX] = {0};
+	bignum256modm S[ED25519_BATCH_SIZE] = {0};
+	bignum256modm sbase = {0}, z = {0};
+	ed25519_hash_context ctx;
+	hash_512bits hash = {0}, seed = {0};
+	unsigned char check[32] = {0}, k = 0;
+	size_t index[ED25519_BATCH_SIZE] = {0};
+	size_t i = 0, j = 0, batch = 0, count = 0;
+	int ret = 0;
+
+	for (i = 0; i < num; i += batch) {
+		batch = (num - i < ED25519_BATCH_SIZE) ? num - i : ED25519_BATCH_SIZE;
+		set256_modm(sbase, 0);
+		count = 0;
+
+		ed25519_hash_init(&ctx);
+		random_buffer(seed, 32);
+		ed25519_hash_update(&ctx, seed, 32);
+
+		for (j = i; j < i + batch; j++) {
+			valid[j] = 0;
+
+			/* -A and -R, the reasons for rejecting are the same as in ed25519_sign_open */
+			if ((RS[j][63] & 224) || !ed25519_is_canonical_point(RS[j]) ||
+			    !ge25519_unpack_negative_vartime(&points[2 * count], pk[j]) ||
+			    !ge25519_unpack_negative_vartime(&points[2 * count + 1], RS[j])) {
+				ret = -1;
+				continue;
+			}
+
+			expand_raw256_modm(S[count], RS[j] + 32);
+			if (!is_reduced256_modm(S[count])) {
+				ret = -1;
+				continue;
+			}
+
+			if (!ed25519_is_canonical_point(pk[j]) ||
+			    ed25519_is_small_order(&points[2 * count]) ||
+			    ed25519_is_small_order(&points[2 * count + 1])) {
+				valid[j] = (ED25519_FN(ed25519_sign_open)(m[j], mlen[j], pk[j], RS[j]) == 0);
+				if (!valid[j])
+					ret = -1;
+				continue;
+			}
+
+			/* hram = H(R,A,m) */
+			ed25519_hram(hash, RS[j], pk[j], m[j], mlen[j]);
+			expand256_modm(scalars[2 * count], hash, 64);
+
+			ed25519_hash_update(&ctx, RS[j], 64);
+			ed25519_hash_update(&ctx, pk[j], 32);
+			ed25519_hash_update(&ctx, hash, 64);
+			index[count++] = j;
+		}
+
+		if (count == 0)
+			continue;
+
+		ed25519_hash_final(&ctx, seed);
+
+		for (j = 0; j < count; j++) {
+			/* z = H(seed, j) truncated to 128 bits */
+			ed25519_hash_init(&ctx);
+			ed25519_hash_update(&ctx, seed, 64);
+			k = (unsigned char)j;
+			ed25519_hash_update(&ctx, &k, 1);
+			ed25519_hash_final(&ctx, hash);
+			memset(hash + 16, 0, 16);
+			expand_raw256_modm(z, hash);
+
+			/* z hram (-A) + z (-R) + z S B */
+			mul256_modm(scalars[2 * j], z, scalars[2 * j]);
+			copy256_modm(scalars[2 * j + 1], z);
+			muladd256_modm(sbase, z, S[j], sbase);
+		}
+
+		ge25519_multi_scalarmult_vartime(&P, points, (const bignum256modm *)scalars, 2 * count, sbase);
+		ge25519_pack(check, &P);
+
+		if (ed25519_verify(check, neutral, 32)) {
+			for (j = 0; j < count; j++)
+				valid[index[j]] = 1;
+		} else {
+			for (j = 0; j < count; j++) {
+				valid[index[j]] = (ED25519_FN(ed25519_sign_open)(m[index[j]], mlen[index[j]], pk[index[j]], RS[index[j]]) == 0);
+				if (!valid[index[j]])
+					ret = -1;
+			}
+		}
+	}
+
+	return ret;
+}
+
 int
 ED25519_FN(ed25519_scalarmult) (ed25519_public_key res, const ed25519_secret_key sk, const ed25519_public_key pk) {
 	bignum256modm a = {0};
@@ -298,6 +448,9 @@ curve25519_scalarmult_basepoint(curve25519_key pk, const curve25519_key e) {
 	curve25519_recip(zminusy, zminusy);
 	curve25519_mul(yplusz, yplusz, zminusy);
 	curve25519_contract(pk, yplusz);
+
+	memzero(ec, sizeof(ec));
+	memzero(s, sizeof(s));
 }
 
 void
@@ -305,11 +458,20 @@ curve25519_scalarmult(curve25519_key mypublic, const curve25519_key secret, cons
 	curve25519_key e = {0};
 	size_t i = 0;
 
+	/* the standard basepoint (u = 9) goes through the fixed-base table,
+	   the comparison only depends on the public basepoint */
+	for (i = 1; i < 32; ++i) if (basepoint[i]) break;
+	if (i == 32 && basepoint[0] == 9) {
+		curve25519_scalarmult_basepoint(mypublic, secret);
+		return;
+	}
+
 	for (i = 0;i < 32;++i) e[i] = secret[i];
 	e[0] &= 0xf8;
 	e[31] &= 0x7f;
 	e[31] |= 0x40;
 	curve25519_scalarmult_donna(mypublic, e, basepoint);
+	memzero(e, sizeof(e));
 }
 
 #endif // ED25519_SUFFIX
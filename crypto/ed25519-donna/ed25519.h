@@ -15,13 +15,22 @@ typedef unsigned char curve25519_key[32];
 
 typedef unsigned char ed25519_cosi_signature[32];
 
+// secret key expanded by hashing, with its public key, for repeated signing
+typedef struct {
+	unsigned char sk[64];
+	ed25519_public_key pk;
+} ed25519_keypair_expanded;
+
 void ed25519_publickey(const ed25519_secret_key sk, ed25519_public_key pk);
+void ed25519_keypair_expand(const ed25519_secret_key sk, ed25519_keypair_expanded *kp);
 #if USE_CARDANO
 void ed25519_publickey_ext(const ed25519_secret_key sk, const ed25519_secret_key skext, ed25519_public_key pk);
 #endif
 
 int ed25519_sign_open(const unsigned char *m, size_t mlen, const ed25519_public_key pk, const ed25519_signature RS);
+int ed25519_sign_open_batch(const unsigned char *const *m, const size_t *mlen, const unsigned char *const *pk, const unsigned char *const *RS, size_t num, int *valid);
 void ed25519_sign(const unsigned char *m, size_t mlen, const ed25519_secret_key sk, const ed25519_public_key pk, ed25519_signature RS);
+void ed25519_sign_with_expanded(const unsigned char *m, size_t mlen, const ed25519_keypair_expanded *kp, ed25519_signature RS);
 #if USE_CARDANO
 void ed25519_sign_ext(const unsigned char *m, size_t mlen, const ed25519_secret_key sk, const ed25519_secret_key skext, const ed25519_public_key pk, ed25519_signature RS);
 #endif
@@ -20,7 +20,10 @@
  * OTHER DEALINGS IN THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "hasher.h"
+#include "memzero.h"
 #include "ripemd160.h"
 
 void hasher_InitParam(Hasher *hasher, HasherType type, const void *param,
@@ -106,7 +109,7 @@ void hasher_Final(Hasher *hasher, uint8_t hash[HASHER_DIGEST_LENGTH]) {
       break;
     case HASHER_SHA2_RIPEMD:
       sha256_Final(&hasher->ctx.sha2, hash);
-      ripemd160(hash, HASHER_DIGEST_LENGTH, hash);
+      ripemd160_32(hash, hash);
       break;
     case HASHER_SHA3:
       sha3_Final(&hasher->ctx.sha3, hash);
@@ -125,7 +128,7 @@ void hasher_Final(Hasher *hasher, uint8_t hash[HASHER_DIGEST_LENGTH]) {
       break;
     case HASHER_BLAKE_RIPEMD:
       blake256_Final(&hasher->ctx.blake, hash);
-      ripemd160(hash, HASHER_DIGEST_LENGTH, hash);
+      ripemd160_32(hash, hash);
       break;
     case HASHER_GROESTLD_TRUNC:
       groestl512_DoubleTrunc(&hasher->ctx.groestl, hash);
@@ -137,10 +140,106 @@ void hasher_Final(Hasher *hasher, uint8_t hash[HASHER_DIGEST_LENGTH]) {
   }
 }
 
+void hasher_Copy(Hasher *dst, const Hasher *src) {
+  memcpy(dst, src, sizeof(Hasher));
+}
+
+static size_t hasher_ctx_size(HasherType type) {
+  switch (type) {
+    case HASHER_SHA2:
+    case HASHER_SHA2D:
+    case HASHER_SHA2_RIPEMD:
+      return sizeof(SHA256_CTX);
+    case HASHER_SHA3:
+#if USE_KECCAK
+    case HASHER_SHA3K:
+#endif
+      return sizeof(SHA3_CTX);
+    case HASHER_BLAKE:
+    case HASHER_BLAKED:
+    case HASHER_BLAKE_RIPEMD:
+      return sizeof(BLAKE256_CTX);
+    case HASHER_GROESTLD_TRUNC:
+      return sizeof(GROESTL512_CTX);
+    case HASHER_BLAKE2B:
+    case HASHER_BLAKE2B_PERSONAL:
+      return sizeof(BLAKE2B_CTX);
+  }
+  return 0;
+}
+
+size_t hasher_export_midstate(const Hasher *hasher, uint8_t *out,
+                              size_t out_len) {
+  size_t size = hasher_ctx_size(hasher->type);
+  if (size == 0 || out_len < 1 + size) {
+    return 0;
+  }
+  out[0] = (uint8_t)hasher->type;
+  memcpy(out + 1, &hasher->ctx, size);
+  return 1 + size;
+}
+
+// hasher has to be initialized with the type (and param) of the midstate,
+// the buffer positions are checked so that a corrupted midstate cannot make
+// the next update write out of bounds
+bool hasher_import_midstate(Hasher *hasher, const uint8_t *in, size_t in_len) {
+  size_t size = hasher_ctx_size(hasher->type);
+  if (size == 0 || in_len != 1 + size || in[0] != (uint8_t)hasher->type) {
+    return false;
+  }
+  Hasher tmp = {0};
+  memcpy(&tmp.ctx, in + 1, size);
+  bool valid = false;
+  switch (hasher->type) {
+    case HASHER_SHA2:
+    case HASHER_SHA2D:
+    case HASHER_SHA2_RIPEMD:
+      valid = true;
+      break;
+    case HASHER_SHA3:
+#if USE_KECCAK
+    case HASHER_SHA3K:
+#endif
+      valid = tmp.ctx.sha3.block_size == SHA3_256_BLOCK_LENGTH &&
+              tmp.ctx.sha3.rest < SHA3_256_BLOCK_LENGTH;
+      break;
+    case HASHER_BLAKE:
+    case HASHER_BLAKED:
+    case HASHER_BLAKE_RIPEMD:
+      valid = tmp.ctx.blake.buflen < BLAKE256_BLOCK_LENGTH;
+      break;
+    case HASHER_GROESTLD_TRUNC:
+      valid = tmp.ctx.groestl.ptr < sizeof(tmp.ctx.groestl.buf);
+      break;
+    case HASHER_BLAKE2B:
+    case HASHER_BLAKE2B_PERSONAL:
+      valid = tmp.ctx.blake2b.buflen <= BLAKE2B_BLOCK_LENGTH &&
+              tmp.ctx.blake2b.outlen == 32;
+      break;
+  }
+  if (valid) {
+    memcpy(&hasher->ctx, &tmp.ctx, size);
+  }
+  memzero(&tmp, sizeof(tmp));
+  return valid;
+}
+
+void hash160(const uint8_t *data, size_t length, uint8_t hash[20]) {
+  uint8_t digest[SHA256_DIGEST_LENGTH];
+  sha256_Raw(data, length, digest);
+  ripemd160_32(digest, hash);
+  memzero(digest, sizeof(digest));
+}
+
 void hasher_Raw(HasherType type, const uint8_t *data, size_t length,
                 uint8_t hash[HASHER_DIGEST_LENGTH]) {
   Hasher hasher = {0};
 
+  if (type == HASHER_SHA2_RIPEMD) {
+    hash160(data, length, hash);
+    return;
+  }
+
   hasher_Init(&hasher, type);
   hasher_Update(&hasher, data, length);
   hasher_Final(&hasher, hash);
@@ -23,6 +23,7 @@
 #ifndef __HASHER_H__
 #define __HASHER_H__
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -69,6 +70,9 @@ typedef struct {
   uint32_t param_size;
 } Hasher;
 
+// type byte followed by the context of the largest hash function
+#define HASHER_MIDSTATE_MAX_LENGTH (1 + sizeof(((Hasher *)0)->ctx))
+
 void hasher_InitParam(Hasher *hasher, HasherType type, const void *param,
                       uint32_t param_size);
 void hasher_Init(Hasher *hasher, HasherType type);
@@ -76,6 +80,16 @@ void hasher_Reset(Hasher *hasher);
 void hasher_Update(Hasher *hasher, const uint8_t *data, size_t length);
 void hasher_Final(Hasher *hasher, uint8_t hash[HASHER_DIGEST_LENGTH]);
 
+void hasher_Copy(Hasher *dst, const Hasher *src);
+
+// the midstate is the raw context and only valid for the build exporting it
+size_t hasher_export_midstate(const Hasher *hasher, uint8_t *out,
+                              size_t out_len);
+bool hasher_import_midstate(Hasher *hasher, const uint8_t *in, size_t in_len);
+
+// RIPEMD-160(SHA-256(data)), the result of HASHER_SHA2_RIPEMD
+void hash160(const uint8_t *data, size_t length, uint8_t hash[20]);
+
 void hasher_Raw(HasherType type, const uint8_t *data, size_t length,
                 uint8_t hash[HASHER_DIGEST_LENGTH]);
 
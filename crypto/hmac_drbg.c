@@ -83,16 +83,21 @@ static void update_v(HMAC_DRBG_CTX *ctx) {
   sha256_Transform(ctx->odig, ctx->v, ctx->v);
 }
 
+// The inner digest and outer digest of K = 0x00 ... 0x00, that is the SHA-256
+// states after compressing a block of 0x36 ... 0x36 and 0x5c ... 0x5c.
+static const uint32_t zero_key_idig[SHA256_DIGEST_LENGTH / sizeof(uint32_t)] = {
+    0xf454dead, 0x9725214f, 0x90daf2a0, 0xdf1228ea,
+    0x64e5750f, 0xa3924181, 0x824a932b, 0xf8e04e32};
+static const uint32_t zero_key_odig[SHA256_DIGEST_LENGTH / sizeof(uint32_t)] = {
+    0xd385480f, 0x7abb6477, 0x37c9c538, 0x5dd82467,
+    0x8e043a72, 0x753434b0, 0xdeb82818, 0x361d45a6};
+
 void hmac_drbg_init(HMAC_DRBG_CTX *ctx, const uint8_t *entropy,
                     size_t entropy_len, const uint8_t *nonce,
                     size_t nonce_len) {
-  uint32_t h[SHA256_BLOCK_LENGTH / sizeof(uint32_t)] = {0};
-
-  // Precompute the inner digest and outer digest of K = 0x00 ... 0x00.
-  memset(h, 0x36, sizeof(h));
-  sha256_Transform(sha256_initial_hash_value, h, ctx->idig);
-  memset(h, 0x5c, sizeof(h));
-  sha256_Transform(sha256_initial_hash_value, h, ctx->odig);
+  // Start from the precomputed digests of K = 0x00 ... 0x00.
+  memcpy(ctx->idig, zero_key_idig, sizeof(zero_key_idig));
+  memcpy(ctx->odig, zero_key_odig, sizeof(zero_key_odig));
 
   // Let V = 0x01 ... 0x01.
   memset(ctx->v, 1, SHA256_DIGEST_LENGTH);
@@ -101,8 +106,6 @@ void hmac_drbg_init(HMAC_DRBG_CTX *ctx, const uint8_t *entropy,
   ctx->v[15] = (SHA256_BLOCK_LENGTH + SHA256_DIGEST_LENGTH) * 8;
 
   hmac_drbg_reseed(ctx, entropy, entropy_len, nonce, nonce_len);
-
-  memzero(h, sizeof(h));
 }
 
 void hmac_drbg_reseed(HMAC_DRBG_CTX *ctx, const uint8_t *entropy, size_t len,
@@ -79,14 +79,19 @@ void encode_block(const char* block, size_t size, char* res)
 {
 	assert(1 <= size && size <= full_block_size);
 
+	// Split off 58^5 limbs so that only three 64-bit divisions are needed and
+	// the digits come out of 32-bit arithmetic, as in b58enc
 	uint64_t num = uint_8be_to_64((uint8_t*)(block), size);
 	int i = ((int)(encoded_block_sizes[size])) - 1;
 	while (0 <= i)
 	{
-		uint64_t remainder = num % alphabet_size;
-		num /= alphabet_size;
-		res[i] = b58digits_ordered[remainder];
-		--i;
+		uint32_t limb = num % 656356768;
+		num /= 656356768;
+		for (int j = 0; j < 5 && 0 <= i; ++j, --i)
+		{
+			res[i] = b58digits_ordered[limb % alphabet_size];
+			limb /= alphabet_size;
+		}
 	}
 }
 
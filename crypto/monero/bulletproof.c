@@ -0,0 +1,556 @@
+//
+// Bulletproof range proof prover, follows the Monero prover
+// (bulletproofs.cc) and apps/monero/xmr/bulletproof.py
+//
+
+#include "bulletproof.h"
+#include "bignum.h"
+#include "memzero.h"
+#include "rand.h"
+#include "serialize.h"
+
+static const xmr_key_t xmr_bp_inv_eight = {
+    0x79, 0x2f, 0xdc, 0xe2, 0x29, 0xe5, 0x06, 0x61, 0xd0, 0xda, 0x1c,
+    0x7d, 0xb3, 0x9d, 0xd3, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06};
+
+typedef struct {
+  const xmr_key_t *Gi;
+  const xmr_key_t *Hi;
+  size_t gen_len;
+} xmr_bp_gens_t;
+
+// x = H_s(x), the reduced scalar is also packed into x
+static void xmr_bp_hash_reduce(bignum256modm r, xmr_key_t x,
+                               const uint8_t *hash) {
+  expand256_modm(r, hash, 32);
+  contract256_modm(x, r);
+}
+
+// hash_cache = H_s(hash_cache || a || b || c || d), r = hash_cache
+static void xmr_bp_hash_cache_mash(bignum256modm r, xmr_key_t hash_cache,
+                                   const xmr_key_t a, const xmr_key_t b,
+                                   const xmr_key_t c, const xmr_key_t d) {
+  uint8_t hash[HASHER_DIGEST_LENGTH] = {0};
+  Hasher kck = {0};
+  xmr_hasher_init(&kck);
+  xmr_hasher_update(&kck, hash_cache, 32);
+  xmr_hasher_update(&kck, a, 32);
+  xmr_hasher_update(&kck, b, 32);
+  if (c != NULL) {
+    xmr_hasher_update(&kck, c, 32);
+  }
+  if (d != NULL) {
+    xmr_hasher_update(&kck, d, 32);
+  }
+  xmr_hasher_final(&kck, hash);
+  xmr_bp_hash_reduce(r, hash_cache, hash);
+}
+
+// derives the idx-th exponent of H, Gi[i] = exp(2i + 1), Hi[i] = exp(2i)
+static void xmr_bp_get_exponent(ge25519 *r, uint32_t idx) {
+  static const char salt[] = "bulletproof";
+  uint8_t buff[32 + sizeof(salt) - 1 + 10] = {0};
+  uint8_t hash[HASHER_DIGEST_LENGTH] = {0};
+
+  ge25519_pack(buff, &xmr_h);
+  memcpy(buff + 32, salt, sizeof(salt) - 1);
+  int written = xmr_write_varint(buff + 32 + sizeof(salt) - 1,
+                                 sizeof(buff) - 32 - sizeof(salt) + 1, idx);
+  xmr_fast_hash(hash, buff, 32 + sizeof(salt) - 1 + written);
+  xmr_hash_to_ec(r, hash, sizeof(hash));
+}
+
+static void xmr_bp_gen(ge25519 *r, const xmr_bp_gens_t *gens, size_t i,
+                       int is_g) {
+  if (i < gens->gen_len) {
+    ge25519_unpack_vartime(r, is_g ? gens->Gi[i] : gens->Hi[i]);
+  } else {
+    xmr_bp_get_exponent(r, 2 * i + (is_g ? 1 : 0));
+  }
+}
+
+// deterministic masks sL, sR derived from a random proof secret
+static void xmr_bp_det_mask(bignum256modm r, const uint8_t proof_sec[64],
+                            size_t i, int is_sl) {
+  uint8_t buff[64 + 1 + 4] = {0};
+  memcpy(buff, proof_sec, 64);
+  buff[64] = is_sl ? 1 : 0;
+  xmr_write_varint(buff + 65, 4, i);
+  xmr_hash_to_scalar(r, buff, sizeof(buff));
+  memzero(buff, sizeof(buff));
+}
+
+static void xmr_bp_invert(bignum256modm r, const bignum256modm x) {
+  // curve order, little endian encoded
+  bignum256 bn_prime = {.val = {0x1cf5d3ed, 0x9318d2, 0x1de73596, 0x1df3bd45,
+                                0x14d, 0x0, 0x0, 0x0, 0x100000}};
+  bignum256 bn_x = {0};
+  uint8_t raw_x[32] = {0};
+
+  contract256_modm(raw_x, x);
+  bn_read_le(raw_x, &bn_x);
+  bn_inverse(&bn_x, &bn_prime);
+  bn_write_le(&bn_x, raw_x);
+  expand_raw256_modm(r, raw_x);
+}
+
+// r = aG + bH
+static void xmr_bp_commit(ge25519 *r, const bignum256modm a,
+                          const bignum256modm b) {
+  ge25519 bH = {0};
+
+  ge25519_scalarmult_base_niels(r, ge25519_niels_base_multiples, a);
+  ge25519_scalarmult_h(&bH, b);
+  ge25519_add(r, r, &bH, 0);
+}
+
+// r = 8^{-1} (P + sH)
+static void xmr_bp_finish_point(xmr_key_t r, const ge25519 *P,
+                                const bignum256modm s) {
+  ge25519 sH = {0}, acc = {0};
+  bignum256modm inv8 = {0};
+
+  ge25519_scalarmult_h(&sH, s);
+  ge25519_add(&acc, P, &sH, 0);
+  expand_raw256_modm(inv8, xmr_bp_inv_eight);
+  ge25519_scalarmult(&acc, &acc, inv8);
+  ge25519_pack(r, &acc);
+}
+
+// r = 8^{-1} (aG + P)
+static void xmr_bp_finish_point_base(xmr_key_t r, const ge25519 *P,
+                                     const bignum256modm a) {
+  ge25519 aG = {0}, acc = {0};
+  bignum256modm inv8 = {0};
+
+  ge25519_scalarmult_base_niels(&aG, ge25519_niels_base_multiples, a);
+  ge25519_add(&acc, P, &aG, 0);
+  expand_raw256_modm(inv8, xmr_bp_inv_eight);
+  ge25519_scalarmult(&acc, &acc, inv8);
+  ge25519_pack(r, &acc);
+}
+
+// sum_{i < n} a_i b_i
+static void xmr_bp_inner_product(bignum256modm r, const xmr_key_t *a,
+                                 const xmr_key_t *b, size_t n) {
+  bignum256modm x = {0}, y = {0};
+  set256_modm(r, 0);
+  for (size_t i = 0; i < n; i++) {
+    expand_raw256_modm(x, a[i]);
+    expand_raw256_modm(y, b[i]);
+    muladd256_modm(r, x, y, r);
+  }
+  memzero(x, sizeof(x));
+  memzero(y, sizeof(y));
+}
+
+// v_i = a v_i + b v_{n + i} for i < n
+static void xmr_bp_scalar_fold(xmr_key_t *v, const bignum256modm a,
+                               const bignum256modm b, size_t n) {
+  bignum256modm x = {0}, y = {0};
+  for (size_t i = 0; i < n; i++) {
+    expand_raw256_modm(x, v[i]);
+    expand_raw256_modm(y, v[n + i]);
+    mul256_modm(x, x, a);
+    muladd256_modm(x, y, b, x);
+    contract256_modm(v[i], x);
+  }
+  memzero(x, sizeof(x));
+  memzero(y, sizeof(y));
+}
+
+static int xmr_bp_prove_main(xmr_bulletproof_t *proof,
+                             const xmr_amount *amounts,
+                             const bignum256modm *masks, size_t count,
+                             size_t M, size_t logM, const xmr_bp_gens_t *gens,
+                             xmr_key_t *aprime, xmr_key_t *bprime,
+                             xmr_key_t *Gprime, xmr_key_t *Hprime) {
+  const size_t MN = M * XMR_BP_N;
+  const size_t logMN = logM + XMR_BP_LOG_N;
+  int ok = 0;
+
+  xmr_key_t hash_cache = {0};
+  uint8_t proof_sec[64] = {0};
+  uint8_t hash[HASHER_DIGEST_LENGTH] = {0};
+  bignum256modm alpha = {0}, rho = {0}, tau1 = {0}, tau2 = {0};
+  bignum256modm y = {0}, z = {0}, x = {0}, x_ip = {0}, w = {0}, winv = {0};
+  bignum256modm t1 = {0}, t2 = {0}, t = {0}, zpow = {0}, tmp = {0};
+  bignum256modm l0 = {0}, l1 = {0}, r0 = {0}, r1 = {0}, ypow = {0}, zt = {0};
+  bignum256modm p2 = {0}, two = {0}, one = {0}, sl = {0}, sr = {0};
+  bignum256modm yinv = {0}, ylo = {0}, yhi = {0}, sa = {0}, sb = {0};
+  ge25519 acc = {0}, P = {0}, Q = {0}, G = {0}, H = {0};
+  Hasher kck = {0};
+
+  set256_modm(one, 1);
+  set256_modm(two, 2);
+
+  xmr_hasher_init(&kck);
+  for (size_t j = 0; j < count; j++) {
+    xmr_hasher_update(&kck, proof->V[j], 32);
+  }
+  xmr_hasher_final(&kck, hash);
+  xmr_bp_hash_reduce(tmp, hash_cache, hash);
+
+  // A = 8^{-1} (alpha G + \sum aL_i Gi_i + aR_i Hi_i), with aL_i the bits of
+  // the amounts and aR_i = aL_i - 1, so every term is either Gi_i or -Hi_i
+  xmr_random_scalar(alpha);
+  ge25519_set_neutral(&acc);
+  for (size_t i = 0; i < MN; i++) {
+    const size_t j = i / XMR_BP_N;
+    const uint32_t bit =
+        j < count ? (uint32_t)(amounts[j] >> (i % XMR_BP_N)) & 1 : 0;
+    xmr_bp_gen(&G, gens, i, 1);
+    xmr_bp_gen(&H, gens, i, 0);
+    ge25519_neg_full(&H);
+    curve25519_swap_conditional(G.x, H.x, bit ^ 1);
+    curve25519_swap_conditional(G.y, H.y, bit ^ 1);
+    curve25519_swap_conditional(G.z, H.z, bit ^ 1);
+    curve25519_swap_conditional(G.t, H.t, bit ^ 1);
+    ge25519_add(&acc, &acc, &G, 0);
+  }
+  xmr_bp_finish_point_base(proof->A, &acc, alpha);
+
+  // S = 8^{-1} (rho G + \sum sL_i Gi_i + sR_i Hi_i)
+  // sL and sR are kept in aprime and bprime for computing l and r
+  random_buffer(proof_sec, sizeof(proof_sec));
+  xmr_random_scalar(rho);
+  ge25519_set_neutral(&acc);
+  for (size_t i = 0; i < MN; i++) {
+    xmr_bp_det_mask(sl, proof_sec, i, 1);
+    xmr_bp_det_mask(sr, proof_sec, i, 0);
+    contract256_modm(aprime[i], sl);
+    contract256_modm(bprime[i], sr);
+    xmr_bp_gen(&G, gens, i, 1);
+    xmr_bp_gen(&H, gens, i, 0);
+    xmr_add_keys3(&P, sl, &G, sr, &H);
+    ge25519_add(&acc, &acc, &P, 0);
+  }
+  xmr_bp_finish_point_base(proof->S, &acc, rho);
+
+  // y = H(hash_cache || A || S), z = H(y)
+  xmr_bp_hash_cache_mash(y, hash_cache, proof->A, proof->S, NULL, NULL);
+  if (iszero256_modm(y)) {
+    goto cleanup;
+  }
+  xmr_hash_to_scalar(z, hash_cache, 32);
+  contract256_modm(hash_cache, z);
+  if (iszero256_modm(z)) {
+    goto cleanup;
+  }
+
+  // l0_i = aL_i - z                      l1_i = sL_i
+  // r0_i = (aR_i + z) y^i + zt_i         r1_i = sR_i y^i
+  // zt_i = z^{2 + floor(i / N)} 2^{i % N}
+  // t1 = l0 . r1 + l1 . r0, t2 = l1 . r1
+  set256_modm(t1, 0);
+  set256_modm(t2, 0);
+  copy256_modm(ypow, one);
+  mul256_modm(zt, z, z);
+  copy256_modm(p2, one);
+  for (size_t i = 0; i < MN; i++) {
+    const size_t j = i / XMR_BP_N;
+    const uint64_t bit = j < count ? (amounts[j] >> (i % XMR_BP_N)) & 1 : 0;
+    if (i > 0) {
+      mul256_modm(ypow, ypow, y);
+      if (i % XMR_BP_N == 0) {
+        mul256_modm(zt, zt, z);
+        copy256_modm(p2, one);
+      } else {
+        mul256_modm(p2, p2, two);
+      }
+    }
+    set256_modm(tmp, bit);
+    sub256_modm(l0, tmp, z);
+    expand_raw256_modm(l1, aprime[i]);
+    sub256_modm(tmp, tmp, one);
+    add256_modm(tmp, tmp, z);
+    mul256_modm(tmp, tmp, ypow);
+    muladd256_modm(r0, zt, p2, tmp);
+    expand_raw256_modm(r1, bprime[i]);
+    mul256_modm(r1, r1, ypow);
+
+    muladd256_modm(t1, l0, r1, t1);
+    muladd256_modm(t1, l1, r0, t1);
+    muladd256_modm(t2, l1, r1, t2);
+
+    // keep r0 and r1 for the second pass
+    contract256_modm(bprime[i], r1);
+  }
+
+  // T1 = 8^{-1} (tau1 G + t1 H), T2 = 8^{-1} (tau2 G + t2 H)
+  xmr_random_scalar(tau1);
+  xmr_random_scalar(tau2);
+  xmr_bp_commit(&P, tau1, t1);
+  expand_raw256_modm(tmp, xmr_bp_inv_eight);
+  ge25519_scalarmult(&P, &P, tmp);
+  ge25519_pack(proof->T1, &P);
+  xmr_bp_commit(&P, tau2, t2);
+  ge25519_scalarmult(&P, &P, tmp);
+  ge25519_pack(proof->T2, &P);
+
+  // x = H(hash_cache || z || T1 || T2)
+  {
+    xmr_key_t zk = {0};
+    contract256_modm(zk, z);
+    xmr_bp_hash_cache_mash(x, hash_cache, zk, proof->T1, proof->T2, NULL);
+  }
+  if (iszero256_modm(x)) {
+    goto cleanup;
+  }
+
+  // l_i = l0_i + x l1_i, r_i = r0_i + x r1_i, t = l . r
+  set256_modm(t, 0);
+  copy256_modm(ypow, one);
+  mul256_modm(zt, z, z);
+  copy256_modm(p2, one);
+  for (size_t i = 0; i < MN; i++) {
+    const size_t j = i / XMR_BP_N;
+    const uint64_t bit = j < count ? (amounts[j] >> (i % XMR_BP_N)) & 1 : 0;
+    if (i > 0) {
+      mul256_modm(ypow, ypow, y);
+      if (i % XMR_BP_N == 0) {
+        mul256_modm(zt, zt, z);
+        copy256_modm(p2, one);
+      } else {
+        mul256_modm(p2, p2, two);
+      }
+    }
+    set256_modm(tmp, bit);
+    sub256_modm(l0, tmp, z);
+    sub256_modm(tmp, tmp, one);
+    add256_modm(tmp, tmp, z);
+    mul256_modm(tmp, tmp, ypow);
+    muladd256_modm(r0, zt, p2, tmp);
+
+    expand_raw256_modm(l1, aprime[i]);
+    muladd256_modm(l0, x, l1, l0);
+    expand_raw256_modm(r1, bprime[i]);
+    muladd256_modm(r0, x, r1, r0);
+    muladd256_modm(t, l0, r0, t);
+    contract256_modm(aprime[i], l0);
+    contract256_modm(bprime[i], r0);
+  }
+  contract256_modm(proof->t, t);
+
+  // taux = tau1 x + tau2 x^2 + \sum_j z^{2 + j} gamma_j
+  mul256_modm(tmp, tau1, x);
+  mul256_modm(zpow, x, x);
+  muladd256_modm(tmp, tau2, zpow, tmp);
+  mul256_modm(zpow, z, z);
+  for (size_t j = 0; j < count; j++) {
+    muladd256_modm(tmp, zpow, masks[j], tmp);
+    mul256_modm(zpow, zpow, z);
+  }
+  contract256_modm(proof->taux, tmp);
+
+  // mu = x rho + alpha
+  muladd256_modm(tmp, x, rho, alpha);
+  contract256_modm(proof->mu, tmp);
+
+  // x_ip = H(hash_cache || x || taux || mu || t)
+  {
+    xmr_key_t xk = {0};
+    contract256_modm(xk, x);
+    xmr_bp_hash_cache_mash(x_ip, hash_cache, xk, proof->taux, proof->mu,
+                           proof->t);
+  }
+  if (iszero256_modm(x_ip)) {
+    goto cleanup;
+  }
+
+  // Inner product argument, the initial H' is Hi_i y^{-i}, which is applied
+  // to the scalars in the first round, and G', H' are folded into Gprime and
+  // Hprime
+  xmr_bp_invert(yinv, y);
+  size_t nprime = MN;
+  for (size_t round = 0; nprime > 1; round++) {
+    nprime >>= 1;
+
+    // cL = a[:n'] . b[n':], cR = a[n':] . b[:n']
+    bignum256modm cL = {0}, cR = {0};
+    xmr_bp_inner_product(cL, aprime, bprime + nprime, nprime);
+    xmr_bp_inner_product(cR, aprime + nprime, bprime, nprime);
+
+    // L = 8^{-1} (\sum a_i G'_{n' + i} + b_{n' + i} H'_i + cL x_ip H)
+    // R = 8^{-1} (\sum a_{n' + i} G'_i + b_i H'_{n' + i} + cR x_ip H)
+    ge25519_set_neutral(&acc);
+    ge25519_set_neutral(&Q);
+    copy256_modm(ylo, one);
+    copy256_modm(yhi, one);
+    if (round == 0) {
+      for (size_t i = 0; i < nprime; i++) {
+        mul256_modm(yhi, yhi, yinv);
+      }
+    }
+    for (size_t i = 0; i < nprime; i++) {
+      if (round == 0) {
+        xmr_bp_gen(&G, gens, nprime + i, 1);
+        xmr_bp_gen(&H, gens, i, 0);
+      } else {
+        ge25519_unpack_vartime(&G, Gprime[nprime + i]);
+        ge25519_unpack_vartime(&H, Hprime[i]);
+      }
+      expand_raw256_modm(sa, aprime[i]);
+      expand_raw256_modm(sb, bprime[nprime + i]);
+      if (round == 0) {
+        mul256_modm(sb, sb, ylo);
+      }
+      xmr_add_keys3(&P, sa, &G, sb, &H);
+      ge25519_add(&acc, &acc, &P, 0);
+
+      if (round == 0) {
+        xmr_bp_gen(&G, gens, i, 1);
+        xmr_bp_gen(&H, gens, nprime + i, 0);
+      } else {
+        ge25519_unpack_vartime(&G, Gprime[i]);
+        ge25519_unpack_vartime(&H, Hprime[nprime + i]);
+      }
+      expand_raw256_modm(sa, aprime[nprime + i]);
+      expand_raw256_modm(sb, bprime[i]);
+      if (round == 0) {
+        mul256_modm(sb, sb, yhi);
+        mul256_modm(ylo, ylo, yinv);
+        mul256_modm(yhi, yhi, yinv);
+      }
+      xmr_add_keys3(&P, sa, &G, sb, &H);
+      ge25519_add(&Q, &Q, &P, 0);
+    }
+    mul256_modm(cL, cL, x_ip);
+    xmr_bp_finish_point(proof->L[round], &acc, cL);
+    mul256_modm(cR, cR, x_ip);
+    xmr_bp_finish_point(proof->R[round], &Q, cR);
+    memzero(cL, sizeof(cL));
+    memzero(cR, sizeof(cR));
+
+    // w = H(hash_cache || L || R)
+    xmr_bp_hash_cache_mash(w, hash_cache, proof->L[round], proof->R[round],
+                           NULL, NULL);
+    if (iszero256_modm(w)) {
+      goto cleanup;
+    }
+    xmr_bp_invert(winv, w);
+
+    // a_i = w a_i + w^{-1} a_{n' + i}, b_i = w^{-1} b_i + w b_{n' + i}
+    xmr_bp_scalar_fold(aprime, w, winv, nprime);
+    xmr_bp_scalar_fold(bprime, winv, w, nprime);
+
+    // G'_i = w^{-1} G'_i + w G'_{n' + i}, H'_i = w H'_i + w^{-1} H'_{n' + i}
+    // the challenges are public, so the folding can be variable time
+    copy256_modm(ylo, one);
+    copy256_modm(yhi, one);
+    if (round == 0) {
+      for (size_t i = 0; i < nprime; i++) {
+        mul256_modm(yhi, yhi, yinv);
+      }
+    }
+    for (size_t i = 0; i < nprime; i++) {
+      if (round == 0) {
+        xmr_bp_gen(&G, gens, i, 1);
+        xmr_bp_gen(&H, gens, nprime + i, 1);
+      } else {
+        ge25519_unpack_vartime(&G, Gprime[i]);
+        ge25519_unpack_vartime(&H, Gprime[nprime + i]);
+      }
+      xmr_add_keys3_vartime(&P, winv, &G, w, &H);
+      ge25519_pack(Gprime[i], &P);
+
+      if (round == 0) {
+        xmr_bp_gen(&G, gens, i, 0);
+        xmr_bp_gen(&H, gens, nprime + i, 0);
+        mul256_modm(sa, w, ylo);
+        mul256_modm(sb, winv, yhi);
+        mul256_modm(ylo, ylo, yinv);
+        mul256_modm(yhi, yhi, yinv);
+      } else {
+        ge25519_unpack_vartime(&G, Hprime[i]);
+        ge25519_unpack_vartime(&H, Hprime[nprime + i]);
+        copy256_modm(sa, w);
+        copy256_modm(sb, winv);
+      }
+      xmr_add_keys3_vartime(&P, sa, &G, sb, &H);
+      ge25519_pack(Hprime[i], &P);
+    }
+  }
+
+  proof->L_len = logMN;
+  memcpy(proof->a, aprime[0], 32);
+  memcpy(proof->b, bprime[0], 32);
+  ok = 1;
+
+cleanup:
+  memzero(proof_sec, sizeof(proof_sec));
+  memzero(alpha, sizeof(alpha));
+  memzero(rho, sizeof(rho));
+  memzero(tau1, sizeof(tau1));
+  memzero(tau2, sizeof(tau2));
+  memzero(t1, sizeof(t1));
+  memzero(t2, sizeof(t2));
+  memzero(tmp, sizeof(tmp));
+  memzero(l0, sizeof(l0));
+  memzero(l1, sizeof(l1));
+  memzero(r0, sizeof(r0));
+  memzero(r1, sizeof(r1));
+  memzero(sl, sizeof(sl));
+  memzero(sr, sizeof(sr));
+  memzero(sa, sizeof(sa));
+  memzero(sb, sizeof(sb));
+  memzero(&P, sizeof(P));
+  memzero(&acc, sizeof(acc));
+  memzero(&Q, sizeof(Q));
+  return ok;
+}
+
+size_t xmr_bulletproof_scratch_size(size_t count) {
+  size_t M = 1;
+  if (count == 0 || count > XMR_BP_MAX_M) {
+    return 0;
+  }
+  while (M < count) {
+    M <<= 1;
+  }
+  // a, b and the folded halves of G and H
+  return 3 * M * XMR_BP_N * sizeof(xmr_key_t);
+}
+
+int xmr_bulletproof_prove(xmr_bulletproof_t *proof, const xmr_amount *amounts,
+                          const bignum256modm *masks, size_t count,
+                          const xmr_key_t *Gi, const xmr_key_t *Hi,
+                          size_t gen_len, uint8_t *scratch) {
+  const xmr_bp_gens_t gens = {.Gi = Gi, .Hi = Hi, .gen_len = gen_len};
+  size_t M = 1, logM = 0;
+  bignum256modm a = {0}, inv8 = {0};
+  ge25519 V = {0};
+
+  if (count == 0 || count > XMR_BP_MAX_M) {
+    return 0;
+  }
+  while (M < count) {
+    logM++;
+    M <<= 1;
+  }
+  const size_t MN = M * XMR_BP_N;
+  xmr_key_t *aprime = (xmr_key_t *)scratch;
+  xmr_key_t *bprime = aprime + MN;
+  xmr_key_t *Gprime = bprime + MN;
+  xmr_key_t *Hprime = Gprime + MN / 2;
+
+  // V_j = 8^{-1} (gamma_j G + v_j H)
+  memzero(proof, sizeof(*proof));
+  proof->V_len = count;
+  expand_raw256_modm(inv8, xmr_bp_inv_eight);
+  for (size_t j = 0; j < count; j++) {
+    set256_modm(a, amounts[j]);
+    xmr_bp_commit(&V, masks[j], a);
+    ge25519_scalarmult(&V, &V, inv8);
+    ge25519_pack(proof->V[j], &V);
+  }
+  memzero(a, sizeof(a));
+
+  while (!xmr_bp_prove_main(proof, amounts, masks, count, M, logM, &gens,
+                            aprime, bprime, Gprime, Hprime)) {
+  }
+
+  memzero(scratch, xmr_bulletproof_scratch_size(count));
+  return 1;
+}
@@ -0,0 +1,48 @@
+//
+// Bulletproof range proof prover
+//
+
+#ifndef TREZOR_CRYPTO_BULLETPROOF_H
+#define TREZOR_CRYPTO_BULLETPROOF_H
+
+#include "range_proof.h"
+
+#define XMR_BP_LOG_N 6
+#define XMR_BP_N (1 << XMR_BP_LOG_N)
+// the device proves at most two outputs itself, larger transactions offload
+// the range proofs to the host, which keeps the scratch at 12 KiB of heap
+#define XMR_BP_MAX_LOG_M 1
+#define XMR_BP_MAX_M (1 << XMR_BP_MAX_LOG_M)
+
+typedef struct xmr_bulletproof {
+  size_t V_len;
+  xmr_key_t V[XMR_BP_MAX_M];
+  xmr_key_t A;
+  xmr_key_t S;
+  xmr_key_t T1;
+  xmr_key_t T2;
+  xmr_key_t taux;
+  xmr_key_t mu;
+  size_t L_len;  // number of L and R elements
+  xmr_key_t L[XMR_BP_LOG_N + XMR_BP_MAX_LOG_M];
+  xmr_key_t R[XMR_BP_LOG_N + XMR_BP_MAX_LOG_M];
+  xmr_key_t a;
+  xmr_key_t b;
+  xmr_key_t t;
+} xmr_bulletproof_t;
+
+/* size of the scratch buffer needed to prove count amounts, 0 if the count is
+ * not supported */
+size_t xmr_bulletproof_scratch_size(size_t count);
+
+/* Proves that count amounts are in range, masks are the commitment masks.
+ * Gi and Hi are the first gen_len packed generators of the proof, the rest is
+ * derived from H when needed. scratch must hold at least
+ * xmr_bulletproof_scratch_size(count) bytes, it is wiped on return.
+ * Returns 0 if count is not supported, 1 otherwise. */
+int xmr_bulletproof_prove(xmr_bulletproof_t *proof, const xmr_amount *amounts,
+                          const bignum256modm *masks, size_t count,
+                          const xmr_key_t *Gi, const xmr_key_t *Hi,
+                          size_t gen_len, uint8_t *scratch);
+
+#endif  // TREZOR_CRYPTO_BULLETPROOF_H
@@ -0,0 +1,55 @@
+//
+// Key image export for owned outputs, follows generate_key_image_helper() and
+// generate_ring_signature() in the Monero codebase
+//
+
+#include "key_image.h"
+#include "memzero.h"
+
+int xmr_export_key_image(xmr_key_t ki, xmr_key_t sig_c, xmr_key_t sig_r,
+                         const xmr_key_t out_key, const ge25519 *derivation,
+                         uint32_t output_index, const bignum256modm spend_key,
+                         const bignum256modm subaddr_key) {
+  bignum256modm x = {0}, k = {0}, c = {0}, r = {0};
+  ge25519 P = {0}, Hp = {0}, T = {0};
+  xmr_key_t pub = {0};
+  uint8_t buff[3 * 32] = {0};
+  int ok = 0;
+
+  xmr_derive_private_key(x, derivation, output_index, spend_key);
+  if (subaddr_key != NULL) {
+    add256_modm(x, x, subaddr_key);
+  }
+
+  ge25519_scalarmult_base_niels(&P, ge25519_niels_base_multiples, x);
+  ge25519_pack(pub, &P);
+  if (ge25519_unpack_vartime(&T, out_key) != 1 || !ge25519_eq(&P, &T)) {
+    goto cleanup;
+  }
+
+  // the same H_p(P) serves the key image and the signature
+  xmr_hash_to_ec(&Hp, pub, sizeof(pub));
+  ge25519_scalarmult(&T, &Hp, x);
+  ge25519_pack(ki, &T);
+
+  // c = H_s(ki || kG || kH_p(P)), r = k - cx
+  xmr_random_scalar(k);
+  memcpy(buff, ki, 32);
+  ge25519_scalarmult_base_niels(&T, ge25519_niels_base_multiples, k);
+  ge25519_pack(buff + 32, &T);
+  ge25519_scalarmult(&T, &Hp, k);
+  ge25519_pack(buff + 64, &T);
+  xmr_hash_to_scalar(c, buff, sizeof(buff));
+  mulsub256_modm(r, c, x, k);
+  contract256_modm(sig_c, c);
+  contract256_modm(sig_r, r);
+  ok = 1;
+
+cleanup:
+  memzero(x, sizeof(x));
+  memzero(k, sizeof(k));
+  memzero(r, sizeof(r));
+  memzero(&T, sizeof(T));
+  memzero(buff, sizeof(buff));
+  return ok;
+}
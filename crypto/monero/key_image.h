@@ -0,0 +1,19 @@
+//
+// Key image export for owned outputs
+//
+
+#ifndef TREZOR_CRYPTO_KEY_IMAGE_H
+#define TREZOR_CRYPTO_KEY_IMAGE_H
+
+#include "xmr.h"
+
+/* Key image ki = x H_p(out_key) of the output with the one member ring
+ * signature (sig_c, sig_r) over the packed key image, where
+ * x = H_s(derivation || output_index) + spend_key + subaddr_key. subaddr_key
+ * is NULL for the main address. Returns 0 if x G is not the out_key. */
+int xmr_export_key_image(xmr_key_t ki, xmr_key_t sig_c, xmr_key_t sig_r,
+                         const xmr_key_t out_key, const ge25519 *derivation,
+                         uint32_t output_index, const bignum256modm spend_key,
+                         const bignum256modm subaddr_key);
+
+#endif  // TREZOR_CRYPTO_KEY_IMAGE_H
@@ -0,0 +1,248 @@
+//
+// Ring signatures for RctType.Simple inputs, follows rctSigs.cpp and
+// apps/monero/xmr/mlsag.py
+//
+
+#include "mlsag.h"
+#include "memzero.h"
+
+static const uint8_t xmr_clsag_round[32] = "CLSAG_round";
+static const uint8_t xmr_clsag_agg_0[32] = "CLSAG_agg_0";
+static const uint8_t xmr_clsag_agg_1[32] = "CLSAG_agg_1";
+
+static const xmr_key_t xmr_inv_eight = {
+    0x79, 0x2f, 0xdc, 0xe2, 0x29, 0xe5, 0x06, 0x61, 0xd0, 0xda, 0x1c,
+    0x7d, 0xb3, 0x9d, 0xd3, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06};
+
+static void xmr_hasher_update_point(Hasher *hasher, const ge25519 *P) {
+  xmr_key_t buff = {0};
+  ge25519_pack(buff, P);
+  xmr_hasher_update(hasher, buff, sizeof(buff));
+}
+
+static void xmr_hasher_final_scalar(Hasher *hasher, bignum256modm r) {
+  uint8_t hash[HASHER_DIGEST_LENGTH] = {0};
+  xmr_hasher_final(hasher, hash);
+  expand256_modm(r, hash, sizeof(hash));
+}
+
+int xmr_gen_mlsag_simple(xmr_key_t *ss, xmr_key_t cc, const uint8_t *message,
+                         size_t message_len, const xmr_key_t *ring,
+                         size_t cols, const bignum256modm x,
+                         const bignum256modm z, const ge25519 *Cout,
+                         size_t index) {
+  bignum256modm alpha0 = {0}, alpha1 = {0}, c = {0}, s0 = {0}, s1 = {0};
+  ge25519 P = {0}, Hi = {0}, II = {0}, L = {0}, R = {0}, M1 = {0};
+  Hasher kck = {0};
+  xmr_key_t M1_packed = {0};
+  int ok = 0;
+
+  if (cols <= 1 || index >= cols) {
+    return 0;
+  }
+
+  // the rows are the public key P_i and the commitment difference C_i - Cout,
+  // the first one is linkable through the key image II = x H_p(P_index)
+  xmr_hasher_init(&kck);
+  xmr_hasher_update(&kck, message, message_len);
+  xmr_hasher_update(&kck, ring[2 * index], 32);
+  xmr_hash_to_ec(&Hi, ring[2 * index], 32);
+  xmr_random_scalar(alpha0);
+  ge25519_scalarmult_base_niels(&L, ge25519_niels_base_multiples, alpha0);
+  ge25519_scalarmult(&R, &Hi, alpha0);
+  ge25519_scalarmult(&II, &Hi, x);
+  xmr_hasher_update_point(&kck, &L);
+  xmr_hasher_update_point(&kck, &R);
+
+  if (ge25519_unpack_vartime(&M1, ring[2 * index + 1]) != 1) {
+    goto cleanup;
+  }
+  ge25519_add(&M1, &M1, Cout, 1);
+  ge25519_pack(M1_packed, &M1);
+  xmr_random_scalar(alpha1);
+  ge25519_scalarmult_base_niels(&L, ge25519_niels_base_multiples, alpha1);
+  xmr_hasher_update(&kck, M1_packed, 32);
+  xmr_hasher_update_point(&kck, &L);
+  xmr_hasher_final_scalar(&kck, c);
+
+  size_t i = (index + 1) % cols;
+  if (i == 0) {
+    contract256_modm(cc, c);
+  }
+
+  while (i != index) {
+    xmr_random_scalar(s0);
+    xmr_random_scalar(s1);
+    if (ge25519_unpack_vartime(&P, ring[2 * i]) != 1 ||
+        ge25519_unpack_vartime(&M1, ring[2 * i + 1]) != 1) {
+      goto cleanup;
+    }
+    ge25519_add(&M1, &M1, Cout, 1);
+    ge25519_pack(M1_packed, &M1);
+
+    xmr_hasher_init(&kck);
+    xmr_hasher_update(&kck, message, message_len);
+
+    // L = s0 G + c P_i, R = s0 H_p(P_i) + c II
+    xmr_add_keys2_vartime(&L, s0, c, &P);
+    xmr_hash_to_ec(&Hi, ring[2 * i], 32);
+    ge25519_double_scalarmult_vartime2(&R, &Hi, s0, &II, c);
+    xmr_hasher_update(&kck, ring[2 * i], 32);
+    xmr_hasher_update_point(&kck, &L);
+    xmr_hasher_update_point(&kck, &R);
+
+    // L = s1 G + c (C_i - Cout)
+    xmr_add_keys2_vartime(&L, s1, c, &M1);
+    xmr_hasher_update(&kck, M1_packed, 32);
+    xmr_hasher_update_point(&kck, &L);
+
+    contract256_modm(ss[2 * i], s0);
+    contract256_modm(ss[2 * i + 1], s1);
+    xmr_hasher_final_scalar(&kck, c);
+
+    i = (i + 1) % cols;
+    if (i == 0) {
+      contract256_modm(cc, c);
+    }
+  }
+
+  // close the ring, s_j = alpha_j - c x_j
+  mulsub256_modm(s0, c, x, alpha0);
+  mulsub256_modm(s1, c, z, alpha1);
+  contract256_modm(ss[2 * index], s0);
+  contract256_modm(ss[2 * index + 1], s1);
+  ok = 1;
+
+cleanup:
+  memzero(alpha0, sizeof(alpha0));
+  memzero(alpha1, sizeof(alpha1));
+  memzero(s0, sizeof(s0));
+  memzero(s1, sizeof(s1));
+  memzero(&II, sizeof(II));
+  memzero(&R, sizeof(R));
+  memzero(&kck, sizeof(kck));
+  return ok;
+}
+
+int xmr_gen_clsag_simple(xmr_key_t *ss, xmr_key_t c1, xmr_key_t D,
+                         const uint8_t *message, size_t message_len,
+                         const xmr_key_t *ring, size_t cols,
+                         const bignum256modm p, const bignum256modm z,
+                         const ge25519 *Cout, size_t index) {
+  bignum256modm a = {0}, c = {0}, s = {0}, mu_P = {0}, mu_C = {0};
+  bignum256modm tmp = {0};
+  bignum256modm scalars[2] = {0};
+  ge25519 H = {0}, I = {0}, Dfull = {0}, L = {0}, R = {0}, T = {0};
+  ge25519 points[2] = {0};
+  Hasher hsh_P = {0}, hsh_C = {0}, c_to_hash = {0}, chasher = {0};
+  xmr_key_t buff = {0}, Cout_packed = {0};
+  int ok = 0;
+
+  if (cols == 0 || index >= cols) {
+    return 0;
+  }
+
+  // I = p H_p(P_index), D = z H_p(P_index), the signature holds D / 8
+  xmr_hash_to_ec(&H, ring[2 * index], 32);
+  ge25519_scalarmult(&I, &H, p);
+  ge25519_scalarmult(&Dfull, &H, z);
+  expand_raw256_modm(tmp, xmr_inv_eight);
+  mul256_modm(tmp, tmp, z);
+  ge25519_scalarmult(&T, &H, tmp);
+  ge25519_pack(D, &T);
+  ge25519_pack(Cout_packed, Cout);
+
+  // mu_P, mu_C = H(domain || P || C || I || D || Cout)
+  xmr_hasher_init(&hsh_P);
+  xmr_hasher_init(&hsh_C);
+  xmr_hasher_update(&hsh_P, xmr_clsag_agg_0, sizeof(xmr_clsag_agg_0));
+  xmr_hasher_update(&hsh_C, xmr_clsag_agg_1, sizeof(xmr_clsag_agg_1));
+  for (size_t k = 0; k < 2; k++) {
+    for (size_t j = 0; j < cols; j++) {
+      xmr_hasher_update(&hsh_P, ring[2 * j + k], 32);
+      xmr_hasher_update(&hsh_C, ring[2 * j + k], 32);
+    }
+  }
+  ge25519_pack(buff, &I);
+  xmr_hasher_update(&hsh_P, buff, 32);
+  xmr_hasher_update(&hsh_C, buff, 32);
+  xmr_hasher_update(&hsh_P, D, 32);
+  xmr_hasher_update(&hsh_C, D, 32);
+  xmr_hasher_update(&hsh_P, Cout_packed, 32);
+  xmr_hasher_update(&hsh_C, Cout_packed, 32);
+  xmr_hasher_final_scalar(&hsh_P, mu_P);
+  xmr_hasher_final_scalar(&hsh_C, mu_C);
+
+  // c = H(domain || P || C || Cout || message || L || R)
+  xmr_hasher_init(&c_to_hash);
+  xmr_hasher_update(&c_to_hash, xmr_clsag_round, sizeof(xmr_clsag_round));
+  for (size_t k = 0; k < 2; k++) {
+    for (size_t j = 0; j < cols; j++) {
+      xmr_hasher_update(&c_to_hash, ring[2 * j + k], 32);
+    }
+  }
+  xmr_hasher_update(&c_to_hash, Cout_packed, 32);
+  xmr_hasher_update(&c_to_hash, message, message_len);
+
+  xmr_random_scalar(a);
+  xmr_hasher_copy(&chasher, &c_to_hash);
+  ge25519_scalarmult_base_niels(&T, ge25519_niels_base_multiples, a);
+  xmr_hasher_update_point(&chasher, &T);
+  ge25519_scalarmult(&T, &H, a);
+  xmr_hasher_update_point(&chasher, &T);
+  xmr_hasher_final_scalar(&chasher, c);
+
+  size_t i = (index + 1) % cols;
+  if (i == 0) {
+    contract256_modm(c1, c);
+  }
+
+  while (i != index) {
+    xmr_random_scalar(s);
+    contract256_modm(ss[i], s);
+    mul256_modm(scalars[0], mu_P, c);
+    mul256_modm(scalars[1], mu_C, c);
+
+    // L = s G + c_p P_i + c_c (C_i - Cout)
+    if (ge25519_unpack_vartime(&points[0], ring[2 * i]) != 1 ||
+        ge25519_unpack_vartime(&points[1], ring[2 * i + 1]) != 1) {
+      goto cleanup;
+    }
+    ge25519_add(&points[1], &points[1], Cout, 1);
+    ge25519_multi_scalarmult_vartime(&L, points,
+                                     (const bignum256modm *)scalars, 2, s);
+
+    // R = s H_p(P_i) + c_p I + c_c D
+    xmr_hash_to_ec(&T, ring[2 * i], 32);
+    ge25519_double_scalarmult_vartime2(&R, &T, s, &I, scalars[0]);
+    ge25519_scalarmult(&T, &Dfull, scalars[1]);
+    ge25519_add(&R, &R, &T, 0);
+
+    xmr_hasher_copy(&chasher, &c_to_hash);
+    xmr_hasher_update_point(&chasher, &L);
+    xmr_hasher_update_point(&chasher, &R);
+    xmr_hasher_final_scalar(&chasher, c);
+
+    i = (i + 1) % cols;
+    if (i == 0) {
+      contract256_modm(c1, c);
+    }
+  }
+
+  // s_index = a - c (mu_P p + mu_C z)
+  mul256_modm(tmp, mu_P, p);
+  muladd256_modm(tmp, mu_C, z, tmp);
+  mulsub256_modm(s, c, tmp, a);
+  contract256_modm(ss[index], s);
+  ok = 1;
+
+cleanup:
+  memzero(a, sizeof(a));
+  memzero(s, sizeof(s));
+  memzero(tmp, sizeof(tmp));
+  memzero(&T, sizeof(T));
+  memzero(&Dfull, sizeof(Dfull));
+  memzero(&chasher, sizeof(chasher));
+  return ok;
+}
@@ -0,0 +1,31 @@
+//
+// Ring signatures for RctType.Simple inputs
+//
+
+#ifndef TREZOR_CRYPTO_MLSAG_H
+#define TREZOR_CRYPTO_MLSAG_H
+
+#include "xmr.h"
+
+/* The ring is given as packed (P_i || C_i) pairs of cols members: P_i are
+ * the public keys, C_i the commitments. x is the spend key of member index, z
+ * the difference of its commitment mask and the pseudo output mask, Cout the
+ * pseudo output commitment. Both functions return 0 on an invalid input. */
+
+/* MLSAG, ss receives 2 packed scalars per ring member, cc the challenge of
+ * the first member */
+int xmr_gen_mlsag_simple(xmr_key_t *ss, xmr_key_t cc, const uint8_t *message,
+                         size_t message_len, const xmr_key_t *ring,
+                         size_t cols, const bignum256modm x,
+                         const bignum256modm z, const ge25519 *Cout,
+                         size_t index);
+
+/* CLSAG, ss receives 1 packed scalar per ring member, c1 the challenge of the
+ * first member and D = 8^{-1} z H_p(P_index) */
+int xmr_gen_clsag_simple(xmr_key_t *ss, xmr_key_t c1, xmr_key_t D,
+                         const uint8_t *message, size_t message_len,
+                         const xmr_key_t *ring, size_t cols,
+                         const bignum256modm p, const bignum256modm z,
+                         const ge25519 *Cout, size_t index);
+
+#endif  // TREZOR_CRYPTO_MLSAG_H
@@ -14,6 +14,9 @@
 #endif
 
 #include "base58.h"
+#include "bulletproof.h"
+#include "key_image.h"
+#include "mlsag.h"
 #include "range_proof.h"
 #include "serialize.h"
 #include "xmr.h"
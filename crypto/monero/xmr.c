@@ -4,6 +4,7 @@
 
 #include "xmr.h"
 #include "int-util.h"
+#include "memzero.h"
 #include "rand.h"
 #include "serialize.h"
 
@@ -19,6 +20,10 @@ const ge25519 ALIGN(16) xmr_h = {
 
 void ge25519_set_xmr_h(ge25519 *r) { ge25519_copy(r, &xmr_h); }
 
+void ge25519_scalarmult_h(ge25519 *r, const bignum256modm s) {
+  ge25519_scalarmult_base_niels(r, xmr_h_niels_multiples, s);
+}
+
 void xmr_random_scalar(bignum256modm m) {
   unsigned char buff[32] = {0};
   random_buffer(buff, sizeof(buff));
@@ -119,6 +124,169 @@ void xmr_add_keys3_vartime(ge25519 *r, const bignum256modm a, const ge25519 *A,
   ge25519_double_scalarmult_vartime2(r, A, a, B, b);
 }
 
+// c bits of the scalar starting at pos, c <= 8
+static uint32_t xmr_scalar_bits(const bignum256modm s, size_t pos, size_t c) {
+  const size_t limb = pos / 30, shift = pos % 30;
+  uint32_t v = 0;
+  if (limb > 8) {
+    return 0;
+  }
+  v = s[limb] >> shift;
+  if (shift + c > 30 && limb < 8) {
+    v |= s[limb + 1] << (30 - shift);
+  }
+  return v & ((1 << c) - 1);
+}
+
+// Signed digit w of the radix 2^c recoding, in [-2^{c-1}, 2^{c-1}]. The
+// carry into window w is the top bit of window w - 1, so no state is needed.
+static int32_t xmr_scalar_digit(const bignum256modm s, size_t w, size_t c) {
+  const uint32_t bits = xmr_scalar_bits(s, w * c, c);
+  const uint32_t carry = w > 0 ? xmr_scalar_bits(s, w * c - 1, 1) : 0;
+  return (int32_t)(bits + carry) - (int32_t)((bits >> (c - 1)) << c);
+}
+
+// Pippenger bucket method, the window c is at most XMR_MULTIEXP_MAX_WINDOW
+static void xmr_multi_scalarmult_pippenger(ge25519 *r, const ge25519 *points,
+                                           const bignum256modm *scalars,
+                                           size_t n, size_t c) {
+  ge25519 buckets[1 << (XMR_MULTIEXP_MAX_WINDOW - 1)];
+  uint8_t used[1 << (XMR_MULTIEXP_MAX_WINDOW - 1)] = {0};
+  ge25519 running = {0}, sum = {0};
+  // scalars are below 2^253, so the top window has no carry out
+  const size_t windows = (254 + c - 1) / c;
+  const size_t nbuckets = (size_t)1 << (c - 1);
+
+  ge25519_set_neutral(r);
+  for (size_t w = windows; w-- > 0;) {
+    for (size_t i = 0; i < c && w + 1 < windows; i++) {
+      ge25519_double(r, r);
+    }
+
+    memset(used, 0, nbuckets);
+    for (size_t j = 0; j < n; j++) {
+      const int32_t d = xmr_scalar_digit(scalars[j], w, c);
+      if (d == 0) {
+        continue;
+      }
+      const size_t k = (size_t)(d < 0 ? -d : d) - 1;
+      if (used[k]) {
+        ge25519_add(&buckets[k], &buckets[k], &points[j], d < 0);
+      } else {
+        ge25519_copy(&buckets[k], &points[j]);
+        if (d < 0) {
+          ge25519_neg_full(&buckets[k]);
+        }
+        used[k] = 1;
+      }
+    }
+
+    // sum_k (k + 1) B_k as a running sum from the top bucket down
+    int have_running = 0, have_sum = 0;
+    for (size_t k = nbuckets; k-- > 0;) {
+      if (used[k]) {
+        if (have_running) {
+          ge25519_add(&running, &running, &buckets[k], 0);
+        } else {
+          ge25519_copy(&running, &buckets[k]);
+          have_running = 1;
+        }
+      }
+      if (!have_running) {
+        continue;
+      }
+      if (have_sum) {
+        ge25519_add(&sum, &sum, &running, 0);
+      } else {
+        ge25519_copy(&sum, &running);
+        have_sum = 1;
+      }
+    }
+    if (have_sum) {
+      ge25519_add(r, r, &sum, 0);
+    }
+  }
+}
+
+void xmr_multi_scalarmult_vartime(ge25519 *r, const ge25519 *points,
+                                  const bignum256modm *scalars, size_t n) {
+  bignum256modm zero = {0};
+  ge25519 part = {0};
+
+  if (n >= XMR_MULTIEXP_PIPPENGER_MIN) {
+    size_t c = 6;
+    while (c < XMR_MULTIEXP_MAX_WINDOW && ((size_t)1 << (c + 1)) < n) {
+      c++;
+    }
+    xmr_multi_scalarmult_pippenger(r, points, scalars, n, c);
+    return;
+  }
+
+  // Straus, GE25519_MULTI_SCALARMULT_MAX points share the doublings
+  ge25519_set_neutral(r);
+  for (size_t i = 0; i < n; i += GE25519_MULTI_SCALARMULT_MAX) {
+    const size_t chunk = n - i < GE25519_MULTI_SCALARMULT_MAX
+                             ? n - i
+                             : GE25519_MULTI_SCALARMULT_MAX;
+    ge25519_multi_scalarmult_vartime(&part, points + i, scalars + i, chunk,
+                                     zero);
+    ge25519_add(r, r, &part, 0);
+  }
+}
+
+size_t xmr_multi_scalarmult_scratch_size(size_t n) {
+  // 0..8 multiples and 64 signed radix 16 digits per point
+  return n * (9 * sizeof(ge25519_pniels) + 64);
+}
+
+void xmr_multi_scalarmult(ge25519 *r, const ge25519 *points,
+                          const bignum256modm *scalars, size_t n,
+                          void *scratch) {
+  ge25519_pniels *pre = (ge25519_pniels *)scratch;
+  signed char *digits = (signed char *)(pre + 9 * n);
+  ge25519_pniels sel = {0};
+  ge25519_p1p1 t = {0};
+  ge25519 d = {0};
+
+  // Straus with fixed radix 16 windows and constant time table lookups, as
+  // in ge25519_scalarmult, all points share the doublings
+  ge25519_set_neutral(&d);
+  for (size_t j = 0; j < n; j++) {
+    ge25519_pniels *p = pre + 9 * j;
+    contract256_window4_modm(digits + 64 * j, scalars[j]);
+    ge25519_full_to_pniels(p, &d);
+    ge25519_full_to_pniels(p + 1, &points[j]);
+  }
+  for (size_t j = 0; j < n; j++) {
+    ge25519_pniels *p = pre + 9 * j;
+    ge25519_double(&d, &points[j]);
+    ge25519_full_to_pniels(p + 2, &d);
+    for (int i = 1; i < 7; i++) {
+      ge25519_pnielsadd(p + i + 2, &d, p + i);
+    }
+  }
+
+  ge25519_set_neutral(r);
+  for (int i = 63; i >= 0; i--) {
+    ge25519_double_partial(r, r);
+    ge25519_double_partial(r, r);
+    ge25519_double_partial(r, r);
+    ge25519_double_p1p1(&t, r);
+    ge25519_p1p1_to_full(r, &t);
+    for (size_t j = 0; j < n; j++) {
+      const signed char b = digits[64 * j + i];
+      ge25519_move_conditional_pniels_array(&sel, pre + 9 * j, abs(b), 9);
+      ge25519_pnielsadd_p1p1(&t, r, &sel, (unsigned char)b >> 7);
+      ge25519_p1p1_to_full(r, &t);
+    }
+  }
+
+  memzero(&sel, sizeof(sel));
+  memzero(&t, sizeof(t));
+  memzero(&d, sizeof(d));
+  memzero(scratch, xmr_multi_scalarmult_scratch_size(n));
+}
+
 void xmr_get_subaddress_secret_key(bignum256modm r, uint32_t major,
                                    uint32_t minor, const bignum256modm m) {
   const char prefix[] = "SubAddr";
@@ -138,6 +306,9 @@ void xmr_get_subaddress_secret_key(bignum256modm r, uint32_t major,
 void xmr_gen_c(ge25519 *r, const bignum256modm a, uint64_t amount) {
   // C = aG + bH
   bignum256modm b = {0};
+  ge25519 bH = {0};
   set256_modm(b, amount);
-  xmr_add_keys2(r, a, b, &xmr_h);
+  ge25519_scalarmult_base_niels(r, ge25519_niels_base_multiples, a);
+  ge25519_scalarmult_h(&bH, b);
+  ge25519_add(r, r, &bH, 0);
 }
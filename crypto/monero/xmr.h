@@ -10,6 +10,9 @@
 
 extern const ge25519 ALIGN(16) xmr_h;
 
+/* multiples of xmr_h in packed niels form, see xmr_h_table.c */
+extern const uint8_t ALIGN(16) xmr_h_niels_multiples[256][96];
+
 typedef unsigned char xmr_key_t[32];
 
 typedef struct xmr_ctkey {
@@ -20,6 +23,9 @@ typedef struct xmr_ctkey {
 /* sets H point to r */
 void ge25519_set_xmr_h(ge25519 *r);
 
+/* sH, fixed base through xmr_h_niels_multiples */
+void ge25519_scalarmult_h(ge25519 *r, const bignum256modm s);
+
 /* random scalar value */
 void xmr_random_scalar(bignum256modm m);
 
@@ -66,6 +72,19 @@ void xmr_add_keys3(ge25519 *r, const bignum256modm a, const ge25519 *A,
 void xmr_add_keys3_vartime(ge25519 *r, const bignum256modm a, const ge25519 *A,
                            const bignum256modm b, const ge25519 *B);
 
+/* sum_i s_i P_i, variable time */
+void xmr_multi_scalarmult_vartime(ge25519 *r, const ge25519 *points,
+                                  const bignum256modm *scalars, size_t n);
+
+/* number of scratch bytes taken by xmr_multi_scalarmult for n points */
+size_t xmr_multi_scalarmult_scratch_size(size_t n);
+
+/* sum_i s_i P_i, constant time. scratch must hold
+ * xmr_multi_scalarmult_scratch_size(n) bytes, it is wiped on return */
+void xmr_multi_scalarmult(ge25519 *r, const ge25519 *points,
+                          const bignum256modm *scalars, size_t n,
+                          void *scratch);
+
 /* subaddress secret */
 void xmr_get_subaddress_secret_key(bignum256modm r, uint32_t major,
                                    uint32_t minor, const bignum256modm m);
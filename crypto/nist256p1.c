@@ -23,6 +23,9 @@
 
 #include "nist256p1.h"
 
+#if USE_FAST_TABLE_NIST256P1
+FAST_TABLE_SECTION
+#endif
 const ecdsa_curve nist256p1 = {
     /* .prime */ {/*.val =*/{0x1fffffff, 0x1fffffff, 0x1fffffff, 0x000001ff,
                              0x00000000, 0x00000000, 0x00040000, 0x1fe00000,
@@ -54,7 +57,11 @@ const ecdsa_curve nist256p1 = {
     ,
     /* cp */
     {
+#if USE_PRECOMPUTED_CP_WINDOW == 4
 #include "nist256p1.table"
+#else
+#include CP_TABLE_FILE(nist256p1)
+#endif
     }
 #endif
 };
@@ -28,11 +28,37 @@
 #define USE_PRECOMPUTED_CP 1
 #endif
 
+// window size in bits of the precomputed Curve Points table (4 to 8),
+// scalar_multiply needs 256 / window point additions and the table takes
+// 2^(window - 1) * 256 / window points per curve; only the tables for the
+// default are checked in, the Makefile generates others with tools/mktable
+#ifndef USE_PRECOMPUTED_CP_WINDOW
+#define USE_PRECOMPUTED_CP_WINDOW 4
+#endif
+
 // use fast inverse method
 #ifndef USE_INVERSE_FAST
 #define USE_INVERSE_FAST 1
 #endif
 
+// use the constant time safegcd inverse method, takes precedence over
+// USE_INVERSE_FAST
+#ifndef USE_INVERSE_SAFEGCD
+#define USE_INVERSE_SAFEGCD 1
+#endif
+
+// use the Thumb-2 assembly bn_multiply_long from bignum_armv7m.S
+// (requires an ARMv7-M or ARMv7E-M target and bignum_armv7m.S in the build)
+#ifndef USE_BN_ARMV7M
+#define USE_BN_ARMV7M 0
+#endif
+
+// use native 64x64->128 bit multiplication in bn_multiply
+// (requires compiler support for unsigned __int128)
+#ifndef USE_BN_64BIT
+#define USE_BN_64BIT 0
+#endif
+
 // support for printing bignum256 structures via printf
 #ifndef USE_BN_PRINT
 #define USE_BN_PRINT 0
@@ -43,12 +69,57 @@
 #define USE_RFC6979 1
 #endif
 
+// number of signatures sharing one inversion in ecdsa_verify_digest_batch
+// and ecdsa_recover_pub_from_sig_batch
+#ifndef ECDSA_VERIFY_BATCH_SIZE
+#define ECDSA_VERIFY_BATCH_SIZE 8
+#endif
+
+// number of signatures checked at once by bip340_verify_digest_batch
+// (each one costs about 1.6 kB of stack in the multi-scalar multiplication)
+#ifndef BIP340_VERIFY_BATCH_SIZE
+#define BIP340_VERIFY_BATCH_SIZE 8
+#endif
+
+// number of points sharing one inversion in scalar_multiply_add_batch
+#ifndef SCALAR_MULTIPLY_BATCH_SIZE
+#define SCALAR_MULTIPLY_BATCH_SIZE 8
+#endif
+
+// number of signatures checked at once by ed25519_sign_open_batch
+// (each one costs about 3 kB of stack in the multi-scalar multiplication)
+#ifndef ED25519_BATCH_SIZE
+#define ED25519_BATCH_SIZE 8
+#endif
+
+// use the secp256k1 endomorphism (GLV) in variable time point multiplication
+#ifndef USE_SECP256K1_ENDOMORPHISM
+#define USE_SECP256K1_ENDOMORPHISM 1
+#endif
+
+// remember the y coordinates of the last PUBKEY_CACHE_SIZE compressed public
+// keys read by ecdsa_read_pubkey, which saves a modular square root each
+#ifndef USE_PUBKEY_CACHE
+#define USE_PUBKEY_CACHE 1
+#endif
+#ifndef PUBKEY_CACHE_SIZE
+#define PUBKEY_CACHE_SIZE 8
+#endif
+
 // implement BIP32 caching
+// (BIP32_CACHE_SIZE parent nodes shared by up to BIP32_CACHE_ROOTS roots)
 #ifndef USE_BIP32_CACHE
 #define USE_BIP32_CACHE 1
+#endif
+#ifndef BIP32_CACHE_SIZE
 #define BIP32_CACHE_SIZE 10
+#endif
+#ifndef BIP32_CACHE_MAXDEPTH
 #define BIP32_CACHE_MAXDEPTH 8
 #endif
+#ifndef BIP32_CACHE_ROOTS
+#define BIP32_CACHE_ROOTS 3
+#endif
 
 // support constructing BIP32 nodes from ed25519 and curve25519 curves.
 #ifndef USE_BIP32_25519_CURVES
@@ -81,6 +152,17 @@
 #define USE_MONERO 0
 #endif
 
+// number of points from which xmr_multi_scalarmult_vartime switches from
+// Straus to the Pippenger bucket method
+#ifndef XMR_MULTIEXP_PIPPENGER_MIN
+#define XMR_MULTIEXP_PIPPENGER_MIN 256
+#endif
+
+// largest Pippenger window (2^(w - 1) buckets of 160 bytes on the stack)
+#ifndef XMR_MULTIEXP_MAX_WINDOW
+#define XMR_MULTIEXP_MAX_WINDOW 7
+#endif
+
 // support CARDANO operations
 #ifndef USE_CARDANO
 #define USE_CARDANO 0
@@ -91,6 +173,51 @@
 #define USE_KECCAK 1
 #endif
 
+// use the bit-interleaved Keccak-f[1600] in sha3.c, which works on 32-bit
+// words and is faster on 32-bit CPUs like the Cortex-M
+#ifndef USE_SHA3_INTERLEAVED
+#define USE_SHA3_INTERLEAVED 0
+#endif
+
+// use the 64-bit Groestl-512 with eight 2 kB lookup tables instead of the
+// small footprint 32-bit one, which is faster on 64-bit hosts
+#ifndef USE_GROESTL_64BIT
+#define USE_GROESTL_64BIT 0
+#endif
+
+// serve short random_buffer requests from a ChaCha-DRBG pool seeded and
+// periodically reseeded from random32() instead of from random32() directly
+// (requests longer than RANDOM_POOL_MAX_REQUEST bytes, e.g. keys, always use
+// random32() so their entropy is not bounded by the 128-bit DRBG key)
+#ifndef USE_RANDOM_POOL
+#define USE_RANDOM_POOL 0
+#endif
+#ifndef RANDOM_POOL_MAX_REQUEST
+#define RANDOM_POOL_MAX_REQUEST 16
+#endif
+#ifndef RANDOM_POOL_RESEED_INTERVAL
+#define RANDOM_POOL_RESEED_INTERVAL 1024
+#endif
+
+// place the selected lookup tables in the section FAST_TABLE_SECTION, which
+// the firmware copies from flash to the CCM RAM at boot, so that the table
+// lookups do not wait for the flash
+#ifndef FAST_TABLE_SECTION
+#define FAST_TABLE_SECTION __attribute__((section(".fast_table")))
+#endif
+#ifndef USE_FAST_TABLE_SECP256K1
+#define USE_FAST_TABLE_SECP256K1 0
+#endif
+#ifndef USE_FAST_TABLE_NIST256P1
+#define USE_FAST_TABLE_NIST256P1 0
+#endif
+#ifndef USE_FAST_TABLE_ED25519
+#define USE_FAST_TABLE_ED25519 0
+#endif
+#ifndef USE_FAST_TABLE_AES
+#define USE_FAST_TABLE_AES 0
+#endif
+
 // add way how to mark confidential data
 #ifndef CONFIDENTIAL
 #define CONFIDENTIAL
@@ -143,6 +143,58 @@ void pbkdf2_hmac_sha512_Update(PBKDF2_HMAC_SHA512_CTX *pctx,
   pctx->first = 0;
 }
 
+// runs the iterations of 4 or 2 contexts in the lanes of sha512_Transform_x4
+// or sha512_Transform_x2, which must all be at the same first round
+static void pbkdf2_hmac_sha512_Update_lanes(PBKDF2_HMAC_SHA512_CTX *pctx,
+                                            int lanes, uint32_t iterations) {
+  const uint64_t *idig[4] = {0}, *odig[4] = {0}, *g[4] = {0};
+  uint64_t *out[4] = {0};
+  for (int l = 0; l < lanes; l++) {
+    idig[l] = pctx[l].idig;
+    odig[l] = pctx[l].odig;
+    g[l] = pctx[l].g;
+    out[l] = pctx[l].g;
+  }
+  for (uint32_t i = pctx->first; i < iterations; i++) {
+    if (lanes == 4) {
+      sha512_Transform_x4(idig, g, out);
+      sha512_Transform_x4(odig, g, out);
+    } else {
+      sha512_Transform_x2(idig, g, out);
+      sha512_Transform_x2(odig, g, out);
+    }
+    for (int l = 0; l < lanes; l++) {
+      for (uint32_t j = 0; j < SHA512_DIGEST_LENGTH / sizeof(uint64_t); j++) {
+        pctx[l].f[j] ^= pctx[l].g[j];
+      }
+    }
+  }
+  for (int l = 0; l < lanes; l++) {
+    pctx[l].first = 0;
+  }
+}
+
+void pbkdf2_hmac_sha512_Update_batch(PBKDF2_HMAC_SHA512_CTX *pctx, size_t n,
+                                     uint32_t iterations) {
+  size_t i = 0;
+  for (int lanes = 4; lanes >= 2; lanes /= 2) {
+    while (n - i >= (size_t)lanes) {
+      int same = 1;
+      for (int l = 1; l < lanes; l++) {
+        same &= pctx[i + l].first == pctx[i].first;
+      }
+      if (!same) {
+        break;
+      }
+      pbkdf2_hmac_sha512_Update_lanes(pctx + i, lanes, iterations);
+      i += lanes;
+    }
+  }
+  for (; i < n; i++) {
+    pbkdf2_hmac_sha512_Update(pctx + i, iterations);
+  }
+}
+
 void pbkdf2_hmac_sha512_Final(PBKDF2_HMAC_SHA512_CTX *pctx, uint8_t *key) {
 #if BYTE_ORDER == LITTLE_ENDIAN
   for (uint32_t k = 0; k < SHA512_DIGEST_LENGTH / sizeof(uint64_t); k++) {
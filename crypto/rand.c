@@ -23,6 +23,15 @@
 
 #include "rand.h"
 
+#include "options.h"
+
+#if USE_RANDOM_POOL
+#include "chacha_drbg.h"
+#include "memzero.h"
+
+static void random_pool_reset(void);
+#endif
+
 #ifndef RAND_PLATFORM_INDEPENDENT
 
 #pragma message( \
@@ -39,7 +48,13 @@
 
 static uint32_t seed = 0;
 
-void random_reseed(const uint32_t value) { seed = value; }
+void random_reseed(const uint32_t value) {
+  seed = value;
+#if USE_RANDOM_POOL
+  // the pool holds output of the old sequence, restart it from the new seed
+  random_pool_reset();
+#endif
+}
 
 uint32_t random32(void) {
   // Linear congruential generator from Numerical Recipes
@@ -54,7 +69,7 @@ uint32_t random32(void) {
 // The following code is platform independent
 //
 
-void __attribute__((weak)) random_buffer(uint8_t *buf, size_t len) {
+static void random_buffer_direct(uint8_t *buf, size_t len) {
   uint32_t r = 0;
   for (size_t i = 0; i < len; i++) {
     if (i % 4 == 0) {
@@ -64,9 +79,75 @@ void __attribute__((weak)) random_buffer(uint8_t *buf, size_t len) {
   }
 }
 
+#if USE_RANDOM_POOL
+
+#define RANDOM_POOL_LENGTH 64
+
+static CHACHA_DRBG_CTX pool_ctx;
+static uint8_t pool[RANDOM_POOL_LENGTH];
+static size_t pool_index = RANDOM_POOL_LENGTH;
+static int pool_seeded = 0;
+
+static void random_pool_refill(void) {
+  if (!pool_seeded || pool_ctx.reseed_counter > RANDOM_POOL_RESEED_INTERVAL) {
+    uint8_t entropy[CHACHA_DRBG_SEED_LENGTH] = {0};
+    random_buffer_direct(entropy, sizeof(entropy));
+    if (pool_seeded) {
+      chacha_drbg_reseed(&pool_ctx, entropy);
+    } else {
+      chacha_drbg_init(&pool_ctx, entropy);
+      pool_seeded = 1;
+    }
+    memzero(entropy, sizeof(entropy));
+  }
+  chacha_drbg_generate(&pool_ctx, pool, RANDOM_POOL_LENGTH);
+  pool_index = 0;
+}
+
+static void random_pool_reset(void) {
+  memzero(&pool_ctx, sizeof(pool_ctx));
+  memzero(pool, sizeof(pool));
+  pool_index = RANDOM_POOL_LENGTH;
+  pool_seeded = 0;
+}
+
+void __attribute__((weak)) random_buffer(uint8_t *buf, size_t len) {
+  if (len > RANDOM_POOL_MAX_REQUEST) {
+    random_buffer_direct(buf, len);
+    return;
+  }
+  for (size_t i = 0; i < len; i++) {
+    if (pool_index == RANDOM_POOL_LENGTH) {
+      random_pool_refill();
+    }
+    // wipe the served bytes, so they cannot be recovered from the pool
+    buf[i] = pool[pool_index];
+    pool[pool_index] = 0;
+    pool_index++;
+  }
+}
+
+#else
+
+void __attribute__((weak)) random_buffer(uint8_t *buf, size_t len) {
+  random_buffer_direct(buf, len);
+}
+
+#endif
+
+static uint32_t random_word(void) {
+#if USE_RANDOM_POOL
+  uint32_t x = 0;
+  random_buffer((uint8_t *)&x, sizeof(x));
+  return x;
+#else
+  return random32();
+#endif
+}
+
 uint32_t random_uniform(uint32_t n) {
   uint32_t x = 0, max = 0xFFFFFFFF - (0xFFFFFFFF % n);
-  while ((x = random32()) >= max)
+  while ((x = random_word()) >= max)
     ;
   return x / (max / n);
 }
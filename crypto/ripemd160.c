@@ -331,6 +331,36 @@ void ripemd160_Final( RIPEMD160_CTX *ctx, uint8_t output[RIPEMD160_DIGEST_LENGTH
     memzero(ctx, sizeof(RIPEMD160_CTX));
 }
 
+/*
+ * RIPEMD-160 of a 32-byte message, such as a SHA-256 digest. The message and
+ * its padding fit a single block, which is processed without the buffering
+ * of ripemd160_Update() and ripemd160_Final().
+ */
+void ripemd160_32( const uint8_t msg[32], uint8_t hash[RIPEMD160_DIGEST_LENGTH] )
+{
+    RIPEMD160_CTX ctx;
+    uint8_t *block = ctx.buffer;
+
+    memcpy( block, msg, 32 );
+    memcpy( block + 32, ripemd160_padding, 24 );
+    PUT_UINT32_LE( 32 << 3, block, 56 );
+    PUT_UINT32_LE( 0, block, 60 );
+
+    ctx.state[0] = 0x67452301;
+    ctx.state[1] = 0xEFCDAB89;
+    ctx.state[2] = 0x98BADCFE;
+    ctx.state[3] = 0x10325476;
+    ctx.state[4] = 0xC3D2E1F0;
+    ripemd160_process( &ctx, block );
+
+    PUT_UINT32_LE( ctx.state[0], hash,  0 );
+    PUT_UINT32_LE( ctx.state[1], hash,  4 );
+    PUT_UINT32_LE( ctx.state[2], hash,  8 );
+    PUT_UINT32_LE( ctx.state[3], hash, 12 );
+    PUT_UINT32_LE( ctx.state[4], hash, 16 );
+    memzero( &ctx, sizeof( ctx ) );
+}
+
 /*
  * output = RIPEMD-160( input buffer )
  */
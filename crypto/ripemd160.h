@@ -18,5 +18,7 @@ void ripemd160_Final(RIPEMD160_CTX *ctx,
                      uint8_t output[RIPEMD160_DIGEST_LENGTH]);
 void ripemd160(const uint8_t *msg, uint32_t msg_len,
                uint8_t hash[RIPEMD160_DIGEST_LENGTH]);
+void ripemd160_32(const uint8_t msg[32],
+                  uint8_t hash[RIPEMD160_DIGEST_LENGTH]);
 
 #endif
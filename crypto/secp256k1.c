@@ -23,6 +23,9 @@
 
 #include "secp256k1.h"
 
+#if USE_FAST_TABLE_SECP256K1
+FAST_TABLE_SECTION
+#endif
 const ecdsa_curve secp256k1 = {
     /* .prime */ {/*.val =*/{0x1ffffc2f, 0x1ffffff7, 0x1fffffff, 0x1fffffff,
                              0x1fffffff, 0x1fffffff, 0x1fffffff, 0x1fffffff,
@@ -52,7 +55,11 @@ const ecdsa_curve secp256k1 = {
     ,
     /* cp */
     {
+#if USE_PRECOMPUTED_CP_WINDOW == 4
 #include "secp256k1.table"
+#else
+#include CP_TABLE_FILE(secp256k1)
+#endif
     }
 #endif
 };
@@ -24,14 +24,21 @@
 
 #include "segwit_addr.h"
 
+/* bech32_generator[b] is the xor of the generator words selected by the
+ * five bits of b, so one step is a shift and a single table lookup. */
+static const uint32_t bech32_generator[32] = {
+    0x00000000UL, 0x3b6a57b2UL, 0x26508e6dUL, 0x1d3ad9dfUL,
+    0x1ea119faUL, 0x25cb4e48UL, 0x38f19797UL, 0x039bc025UL,
+    0x3d4233ddUL, 0x0628646fUL, 0x1b12bdb0UL, 0x2078ea02UL,
+    0x23e32a27UL, 0x18897d95UL, 0x05b3a44aUL, 0x3ed9f3f8UL,
+    0x2a1462b3UL, 0x117e3501UL, 0x0c44ecdeUL, 0x372ebb6cUL,
+    0x34b57b49UL, 0x0fdf2cfbUL, 0x12e5f524UL, 0x298fa296UL,
+    0x1756516eUL, 0x2c3c06dcUL, 0x3106df03UL, 0x0a6c88b1UL,
+    0x09f74894UL, 0x329d1f26UL, 0x2fa7c6f9UL, 0x14cd914bUL
+};
+
 uint32_t bech32_polymod_step(uint32_t pre) {
-    uint8_t b = pre >> 25;
-    return ((pre & 0x1FFFFFF) << 5) ^
-        (-((b >> 0) & 1) & 0x3b6a57b2UL) ^
-        (-((b >> 1) & 1) & 0x26508e6dUL) ^
-        (-((b >> 2) & 1) & 0x1ea119faUL) ^
-        (-((b >> 3) & 1) & 0x3d4233ddUL) ^
-        (-((b >> 4) & 1) & 0x2a1462b3UL);
+    return ((pre & 0x1FFFFFF) << 5) ^ bech32_generator[pre >> 25];
 }
 
 static const char* charset = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
@@ -47,9 +54,11 @@ static const int8_t charset_rev[128] = {
      1,  0,  3, 16, 11, 28, 12, 14,  6,  4,  2, -1, -1, -1, -1, -1
 };
 
-int bech32_encode(char *output, const char *hrp, const uint8_t *data, size_t data_len) {
-    uint32_t chk = 1;
+/* Checksum state after the human readable part, which is the same for every
+ * string with that hrp. Returns 0 if hrp is invalid. */
+static int bech32_hrp_checksum(uint32_t *chk, size_t *hrp_len, const char *hrp) {
     size_t i = 0;
+    *chk = 1;
     while (hrp[i] != 0) {
         int ch = hrp[i];
         if (ch < 33 || ch > 126) {
@@ -57,15 +66,22 @@ int bech32_encode(char *output, const char *hrp, const uint8_t *data, size_t dat
         }
 
         if (ch >= 'A' && ch <= 'Z') return 0;
-        chk = bech32_polymod_step(chk) ^ (ch >> 5);
+        *chk = bech32_polymod_step(*chk) ^ (ch >> 5);
         ++i;
     }
-    if (i + 7 + data_len > 90) return 0;
-    chk = bech32_polymod_step(chk);
-    while (*hrp != 0) {
-        chk = bech32_polymod_step(chk) ^ (*hrp & 0x1f);
-        *(output++) = *(hrp++);
+    *chk = bech32_polymod_step(*chk);
+    for (i = 0; hrp[i] != 0; ++i) {
+        *chk = bech32_polymod_step(*chk) ^ (hrp[i] & 0x1f);
     }
+    *hrp_len = i;
+    return 1;
+}
+
+static int bech32_encode_data(char *output, const char *hrp, size_t hrp_len, uint32_t chk, const uint8_t *data, size_t data_len) {
+    size_t i = 0;
+    if (hrp_len + 7 + data_len > 90) return 0;
+    memcpy(output, hrp, hrp_len);
+    output += hrp_len;
     *(output++) = '1';
     for (i = 0; i < data_len; ++i) {
         if (*data >> 5) return 0;
@@ -83,6 +99,13 @@ int bech32_encode(char *output, const char *hrp, const uint8_t *data, size_t dat
     return 1;
 }
 
+int bech32_encode(char *output, const char *hrp, const uint8_t *data, size_t data_len) {
+    uint32_t chk = 0;
+    size_t hrp_len = 0;
+    if (!bech32_hrp_checksum(&chk, &hrp_len, hrp)) return 0;
+    return bech32_encode_data(output, hrp, hrp_len, chk, data, data_len);
+}
+
 int bech32_decode(char* hrp, uint8_t *data, size_t *data_len, const char *input) {
     uint32_t chk = 1;
     size_t i = 0;
@@ -162,18 +185,38 @@ static int convert_bits(uint8_t* out, size_t* outlen, int outbits, const uint8_t
     return 1;
 }
 
-int segwit_addr_encode(char *output, const char *hrp, int witver, const uint8_t *witprog, size_t witprog_len) {
-    uint8_t data[65] = {0};
-    size_t datalen = 0;
+static int segwit_prog_to_data(uint8_t *data, size_t *datalen, int witver, const uint8_t *witprog, size_t witprog_len) {
+    *datalen = 0;
     if (witver > 16) return 0;
     if (witver == 0 && witprog_len != 20 && witprog_len != 32) return 0;
     if (witprog_len < 2 || witprog_len > 40) return 0;
     data[0] = witver;
-    convert_bits(data + 1, &datalen, 5, witprog, witprog_len, 8, 1);
-    ++datalen;
+    convert_bits(data + 1, datalen, 5, witprog, witprog_len, 8, 1);
+    ++(*datalen);
+    return 1;
+}
+
+int segwit_addr_encode(char *output, const char *hrp, int witver, const uint8_t *witprog, size_t witprog_len) {
+    uint8_t data[65] = {0};
+    size_t datalen = 0;
+    if (!segwit_prog_to_data(data, &datalen, witver, witprog, witprog_len)) return 0;
     return bech32_encode(output, hrp, data, datalen);
 }
 
+int segwit_addr_encode_many(char *const outputs[], const char *hrp, int witver, const uint8_t *const witprogs[], size_t witprog_len, size_t n) {
+    uint8_t data[65] = {0};
+    size_t datalen = 0;
+    uint32_t chk = 0;
+    size_t hrp_len = 0;
+    size_t i = 0;
+    if (!bech32_hrp_checksum(&chk, &hrp_len, hrp)) return 0;
+    for (i = 0; i < n; ++i) {
+        if (!segwit_prog_to_data(data, &datalen, witver, witprogs[i], witprog_len)) return 0;
+        if (!bech32_encode_data(outputs[i], hrp, hrp_len, chk, data, datalen)) return 0;
+    }
+    return 1;
+}
+
 int segwit_addr_decode(int* witver, uint8_t* witdata, size_t* witdata_len, const char* hrp, const char* addr) {
     uint8_t data[84] = {0};
     char hrp_actual[84] = {0};
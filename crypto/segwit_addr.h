@@ -38,6 +38,23 @@
 int segwit_addr_encode(char *output, const char *hrp, int ver,
                        const uint8_t *prog, size_t prog_len);
 
+/** Encode many SegWit addresses sharing hrp, version and program length
+ *
+ *  Out: outputs:     Array of n pointers to buffers of size 73 + strlen(hrp)
+ *                    that will be updated to contain the null-terminated
+ *                    addresses.
+ *  In:  hrp:         Pointer to the null-terminated human readable part.
+ *       ver:         Version of the witness programs.
+ *       progs:       Array of n pointers to the witness programs.
+ *       prog_len:    Number of data bytes in each program.
+ *       n:           Number of addresses to encode.
+ *  Returns 1 if all addresses were encoded. The checksum over the human
+ *  readable part is computed only once.
+ */
+int segwit_addr_encode_many(char *const outputs[], const char *hrp, int ver,
+                            const uint8_t *const progs[], size_t prog_len,
+                            size_t n);
+
 /** Decode a SegWit address
  *
  *  Out: ver:      Pointer to an int that will be updated to contain the witness
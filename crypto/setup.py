@@ -6,17 +6,39 @@ from Cython.Build import cythonize
 from Cython.Distutils import build_ext
 
 srcs = [
-    "nist256p1",
+    "address",
     "base58",
     "bignum",
     "bip32",
+    "bip39",
+    "blake256",
+    "blake2b",
+    "curves",
     "ecdsa",
-    "curve25519",
+    "ed25519-donna/curve25519-donna-32bit",
+    "ed25519-donna/curve25519-donna-helpers",
+    "ed25519-donna/curve25519-donna-scalarmult-base",
+    "ed25519-donna/ed25519",
+    "ed25519-donna/ed25519-donna-32bit-tables",
+    "ed25519-donna/ed25519-donna-basepoint-table",
+    "ed25519-donna/ed25519-donna-impl-base",
+    "ed25519-donna/ed25519-keccak",
+    "ed25519-donna/ed25519-sha3",
+    "ed25519-donna/modm-donna-32bit",
+    "groestl",
+    "hasher",
     "hmac",
+    "hmac_drbg",
+    "memzero",
+    "nist256p1",
+    "pbkdf2",
     "rand",
+    "rfc6979",
     "ripemd160",
     "secp256k1",
+    "segwit_addr",
     "sha2",
+    "sha3",
 ]
 
 extensions = [
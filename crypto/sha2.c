@@ -33,6 +33,20 @@
 #include "sha2.h"
 #include "memzero.h"
 
+#if !defined(SHA2_NO_HW_TRANSFORM) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SHA2_HW_TRANSFORM
+#define SHA2_HW_TRANSFORM_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#elif !defined(SHA2_NO_HW_TRANSFORM) && defined(__aarch64__) && (defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO))
+#define SHA2_HW_TRANSFORM
+#define SHA2_HW_TRANSFORM_ARM
+#include <arm_neon.h>
+#if defined(__linux__)
+#include <sys/auxv.h>
+#endif
+#endif
+
 /*
  * ASSERT NOTE:
  * Some sanity checking code is included using assert().  On my FreeBSD
@@ -51,6 +65,17 @@
  *
  *   #define SHA2_UNROLL_TRANSFORM
  *
+ * Define SHA256_UNROLL_TRANSFORM to unroll only the SHA-256 transform,
+ * which is what PBKDF2-HMAC-SHA256 spends its time in, without paying
+ * the code size of the unrolled SHA-1 and SHA-512 transforms.
+ *
+ * HARDWARE TRANSFORM NOTE:
+ * On x86-64 hosts, and on AArch64 targets compiled with the SHA2 (crypto)
+ * extension enabled, sha1_Transform and sha256_Transform use the CPU SHA
+ * instructions when a runtime check (CPUID, HWCAP on Linux) finds them
+ * and the portable code otherwise.  Define SHA2_NO_HW_TRANSFORM to always
+ * use the portable code.
+ *
  */
 
 
@@ -279,6 +304,402 @@ const sha2_word64 sha512_initial_hash_value[8] = {
 static const char *sha2_hex_digits = "0123456789abcdef";
 
 
+/*** SHA-1/256 HARDWARE TRANSFORMS ************************************/
+/*
+ * The transforms take the block as 16 words in host byte order (see the
+ * REVERSE32 loops of the callers), so unlike the usual implementations
+ * they load the message words without a byte shuffle.
+ */
+#if defined(SHA2_HW_TRANSFORM_X86)
+
+static int sha2_hw_transform_available(void) {
+	unsigned int	eax = 0, ebx = 0, ecx = 0, edx = 0;
+
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(ecx & bit_SSE4_1)) {
+		return 0;
+	}
+	if (__get_cpuid_max(0, 0) < 7) {
+		return 0;
+	}
+	__cpuid_count(7, 0, eax, ebx, ecx, edx);
+	/* CPUID.(EAX=7,ECX=0):EBX.SHA[bit 29] */
+	return (ebx & (1u << 29)) != 0;
+}
+
+__attribute__((target("sha,sse4.1")))
+static void sha1_Transform_hw(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
+	__m128i	abcd, abcd_save, e0, e0_save, e1, msg0, msg1, msg2, msg3;
+
+	/* abcd holds A in the highest lane, e0 holds E in the highest lane */
+	abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)state_in), 0x1b);
+	e0 = _mm_set_epi32(state_in[4], 0, 0, 0);
+	abcd_save = abcd;
+	e0_save = e0;
+
+	msg0 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)data), 0x1b);
+	/* Rounds 0 to 3 */
+	e0 = _mm_add_epi32(e0, msg0);
+	e1 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+	msg1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)(data + 4)), 0x1b);
+	/* Rounds 4 to 7 */
+	e1 = _mm_sha1nexte_epu32(e1, msg1);
+	e0 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+	msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+	msg2 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)(data + 8)), 0x1b);
+	/* Rounds 8 to 11 */
+	e0 = _mm_sha1nexte_epu32(e0, msg2);
+	e1 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+	msg0 = _mm_xor_si128(msg0, msg2);
+	msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+	msg3 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)(data + 12)), 0x1b);
+	/* Rounds 12 to 15 */
+	e1 = _mm_sha1nexte_epu32(e1, msg3);
+	e0 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+	msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+	msg1 = _mm_xor_si128(msg1, msg3);
+	msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+	/* Rounds 16 to 19 */
+	e0 = _mm_sha1nexte_epu32(e0, msg0);
+	e1 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+	msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+	msg2 = _mm_xor_si128(msg2, msg0);
+	msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+	/* Rounds 20 to 23 */
+	e1 = _mm_sha1nexte_epu32(e1, msg1);
+	e0 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+	msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+	msg3 = _mm_xor_si128(msg3, msg1);
+	msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+	/* Rounds 24 to 27 */
+	e0 = _mm_sha1nexte_epu32(e0, msg2);
+	e1 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e0, 1);
+	msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+	msg0 = _mm_xor_si128(msg0, msg2);
+	msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+	/* Rounds 28 to 31 */
+	e1 = _mm_sha1nexte_epu32(e1, msg3);
+	e0 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+	msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+	msg1 = _mm_xor_si128(msg1, msg3);
+	msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+	/* Rounds 32 to 35 */
+	e0 = _mm_sha1nexte_epu32(e0, msg0);
+	e1 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e0, 1);
+	msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+	msg2 = _mm_xor_si128(msg2, msg0);
+	msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+	/* Rounds 36 to 39 */
+	e1 = _mm_sha1nexte_epu32(e1, msg1);
+	e0 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+	msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+	msg3 = _mm_xor_si128(msg3, msg1);
+	msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+	/* Rounds 40 to 43 */
+	e0 = _mm_sha1nexte_epu32(e0, msg2);
+	e1 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+	msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+	msg0 = _mm_xor_si128(msg0, msg2);
+	msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+	/* Rounds 44 to 47 */
+	e1 = _mm_sha1nexte_epu32(e1, msg3);
+	e0 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e1, 2);
+	msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+	msg1 = _mm_xor_si128(msg1, msg3);
+	msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+	/* Rounds 48 to 51 */
+	e0 = _mm_sha1nexte_epu32(e0, msg0);
+	e1 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+	msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+	msg2 = _mm_xor_si128(msg2, msg0);
+	msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+	/* Rounds 52 to 55 */
+	e1 = _mm_sha1nexte_epu32(e1, msg1);
+	e0 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e1, 2);
+	msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+	msg3 = _mm_xor_si128(msg3, msg1);
+	msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+	/* Rounds 56 to 59 */
+	e0 = _mm_sha1nexte_epu32(e0, msg2);
+	e1 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+	msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+	msg0 = _mm_xor_si128(msg0, msg2);
+	msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+	/* Rounds 60 to 63 */
+	e1 = _mm_sha1nexte_epu32(e1, msg3);
+	e0 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+	msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+	msg1 = _mm_xor_si128(msg1, msg3);
+	msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+	/* Rounds 64 to 67 */
+	e0 = _mm_sha1nexte_epu32(e0, msg0);
+	e1 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+	msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+	msg2 = _mm_xor_si128(msg2, msg0);
+	msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+	/* Rounds 68 to 71 */
+	e1 = _mm_sha1nexte_epu32(e1, msg1);
+	e0 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+	msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+	msg3 = _mm_xor_si128(msg3, msg1);
+	/* Rounds 72 to 75 */
+	e0 = _mm_sha1nexte_epu32(e0, msg2);
+	e1 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+	msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+	/* Rounds 76 to 79 */
+	e1 = _mm_sha1nexte_epu32(e1, msg3);
+	e0 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+
+	/* Compute the current intermediate hash value */
+	e0 = _mm_sha1nexte_epu32(e0, e0_save);
+	abcd = _mm_add_epi32(abcd, abcd_save);
+	_mm_storeu_si128((__m128i*)state_out, _mm_shuffle_epi32(abcd, 0x1b));
+	state_out[4] = _mm_extract_epi32(e0, 3);
+}
+
+__attribute__((target("sha,sse4.1")))
+static void sha256_Transform_hw(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
+	__m128i	state0, state1, abef_save, cdgh_save, msg, tmp, msg0, msg1, msg2, msg3;
+
+	/* Rearrange a..h into the ABEF and CDGH order of sha256rnds2 */
+	tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&state_in[0]), 0xb1);
+	state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&state_in[4]), 0x1b);
+	state0 = _mm_alignr_epi8(tmp, state1, 8);
+	state1 = _mm_blend_epi16(state1, tmp, 0xf0);
+	abef_save = state0;
+	cdgh_save = state1;
+
+	msg0 = _mm_loadu_si128((const __m128i*)(data + 0));
+	msg1 = _mm_loadu_si128((const __m128i*)(data + 4));
+	msg2 = _mm_loadu_si128((const __m128i*)(data + 8));
+	msg3 = _mm_loadu_si128((const __m128i*)(data + 12));
+
+	/* Rounds 0 to 3 */
+	msg = _mm_add_epi32(msg0, _mm_loadu_si128((const __m128i*)&K256[0]));
+	state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+	msg = _mm_shuffle_epi32(msg, 0x0e);
+	state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+	/* Rounds 4 to 7 */
+	msg = _mm_add_epi32(msg1, _mm_loadu_si128((const __m128i*)&K256[4]));
+	state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+	msg = _mm_shuffle_epi32(msg, 0x0e);
+	state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+	msg0 = _mm_sha256msg1_epu32(msg0, msg1);
+	/* Rounds 8 to 11 */
+	msg = _mm_add_epi32(msg2, _mm_loadu_si128((const __m128i*)&K256[8]));
+	state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+	msg = _mm_shuffle_epi32(msg, 0x0e);
+	state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+	msg1 = _mm_sha256msg1_epu32(msg1, msg2);
+	/* Rounds 12 to 15 */
+	msg = _mm_add_epi32(msg3, _mm_loadu_si128((const __m128i*)&K256[12]));
+	state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+	msg0 = _mm_sha256msg2_epu32(_mm_add_epi32(msg0, _mm_alignr_epi8(msg3, msg2, 4)), msg3);
+	msg = _mm_shuffle_epi32(msg, 0x0e);
+	state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+	msg2 = _mm_sha256msg1_epu32(msg2, msg3);
+	/* Rounds 16 to 19 */
+	msg = _mm_add_epi32(msg0, _mm_loadu_si128((const __m128i*)&K256[16]));
+	state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+	msg1 = _mm_sha256msg2_epu32(_mm_add_epi32(msg1, _mm_alignr_epi8(msg0, msg3, 4)), msg0);
+	msg = _mm_shuffle_epi32(msg, 0x0e);
+	state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+	msg3 = _mm_sha256msg1_epu32(msg3, msg0);
+	/* Rounds 20 to 23 */
+	msg = _mm_add_epi32(msg1, _mm_loadu_si128((const __m128i*)&K256[20]));
+	state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+	msg2 = _mm_sha256msg2_epu32(_mm_add_epi32(msg2, _mm_alignr_epi8(msg1, msg0, 4)), msg1);
+	msg = _mm_shuffle_epi32(msg, 0x0e);
+	state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+	msg0 = _mm_sha256msg1_epu32(msg0, msg1);
+	/* Rounds 24 to 27 */
+	msg = _mm_add_epi32(msg2, _mm_loadu_si128((const __m128i*)&K256[24]));
+	state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+	msg3 = _mm_sha256msg2_epu32(_mm_add_epi32(msg3, _mm_alignr_epi8(msg2, msg1, 4)), msg2);
+	msg = _mm_shuffle_epi32(msg, 0x0e);
+	state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+	msg1 = _mm_sha256msg1_epu32(msg1, msg2);
+	/* Rounds 28 to 31 */
+	msg = _mm_add_epi32(msg3, _mm_loadu_si128((const __m128i*)&K256[28]));
+	state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+	msg0 = _mm_sha256msg2_epu32(_mm_add_epi32(msg0, _mm_alignr_epi8(msg3, msg2, 4)), msg3);
+	msg = _mm_shuffle_epi32(msg, 0x0e);
+	state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+	msg2 = _mm_sha256msg1_epu32(msg2, msg3);
+	/* Rounds 32 to 35 */
+	msg = _mm_add_epi32(msg0, _mm_loadu_si128((const __m128i*)&K256[32]));
+	state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+	msg1 = _mm_sha256msg2_epu32(_mm_add_epi32(msg1, _mm_alignr_epi8(msg0, msg3, 4)), msg0);
+	msg = _mm_shuffle_epi32(msg, 0x0e);
+	state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+	msg3 = _mm_sha256msg1_epu32(msg3, msg0);
+	/* Rounds 36 to 39 */
+	msg = _mm_add_epi32(msg1, _mm_loadu_si128((const __m128i*)&K256[36]));
+	state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+	msg2 = _mm_sha256msg2_epu32(_mm_add_epi32(msg2, _mm_alignr_epi8(msg1, msg0, 4)), msg1);
+	msg = _mm_shuffle_epi32(msg, 0x0e);
+	state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+	msg0 = _mm_sha256msg1_epu32(msg0, msg1);
+	/* Rounds 40 to 43 */
+	msg = _mm_add_epi32(msg2, _mm_loadu_si128((const __m128i*)&K256[40]));
+	state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+	msg3 = _mm_sha256msg2_epu32(_mm_add_epi32(msg3, _mm_alignr_epi8(msg2, msg1, 4)), msg2);
+	msg = _mm_shuffle_epi32(msg, 0x0e);
+	state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+	msg1 = _mm_sha256msg1_epu32(msg1, msg2);
+	/* Rounds 44 to 47 */
+	msg = _mm_add_epi32(msg3, _mm_loadu_si128((const __m128i*)&K256[44]));
+	state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+	msg0 = _mm_sha256msg2_epu32(_mm_add_epi32(msg0, _mm_alignr_epi8(msg3, msg2, 4)), msg3);
+	msg = _mm_shuffle_epi32(msg, 0x0e);
+	state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+	msg2 = _mm_sha256msg1_epu32(msg2, msg3);
+	/* Rounds 48 to 51 */
+	msg = _mm_add_epi32(msg0, _mm_loadu_si128((const __m128i*)&K256[48]));
+	state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+	msg1 = _mm_sha256msg2_epu32(_mm_add_epi32(msg1, _mm_alignr_epi8(msg0, msg3, 4)), msg0);
+	msg = _mm_shuffle_epi32(msg, 0x0e);
+	state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+	msg3 = _mm_sha256msg1_epu32(msg3, msg0);
+	/* Rounds 52 to 55 */
+	msg = _mm_add_epi32(msg1, _mm_loadu_si128((const __m128i*)&K256[52]));
+	state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+	msg2 = _mm_sha256msg2_epu32(_mm_add_epi32(msg2, _mm_alignr_epi8(msg1, msg0, 4)), msg1);
+	msg = _mm_shuffle_epi32(msg, 0x0e);
+	state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+	/* Rounds 56 to 59 */
+	msg = _mm_add_epi32(msg2, _mm_loadu_si128((const __m128i*)&K256[56]));
+	state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+	msg3 = _mm_sha256msg2_epu32(_mm_add_epi32(msg3, _mm_alignr_epi8(msg2, msg1, 4)), msg2);
+	msg = _mm_shuffle_epi32(msg, 0x0e);
+	state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+	/* Rounds 60 to 63 */
+	msg = _mm_add_epi32(msg3, _mm_loadu_si128((const __m128i*)&K256[60]));
+	state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+	msg = _mm_shuffle_epi32(msg, 0x0e);
+	state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+	/* Compute the current intermediate hash value */
+	state0 = _mm_add_epi32(state0, abef_save);
+	state1 = _mm_add_epi32(state1, cdgh_save);
+	tmp = _mm_shuffle_epi32(state0, 0x1b);
+	state1 = _mm_shuffle_epi32(state1, 0xb1);
+	state0 = _mm_blend_epi16(tmp, state1, 0xf0);
+	state1 = _mm_alignr_epi8(state1, tmp, 8);
+	_mm_storeu_si128((__m128i*)&state_out[0], state0);
+	_mm_storeu_si128((__m128i*)&state_out[4], state1);
+}
+
+#elif defined(SHA2_HW_TRANSFORM_ARM)
+
+static int sha2_hw_transform_available(void) {
+#if defined(__linux__) && defined(HWCAP_SHA1) && defined(HWCAP_SHA2)
+	unsigned long	hwcap = getauxval(AT_HWCAP);
+	return (hwcap & HWCAP_SHA1) && (hwcap & HWCAP_SHA2);
+#else
+	/* The compiler was told that the target has the extension */
+	return 1;
+#endif
+}
+
+static void sha1_Transform_hw(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
+	uint32x4_t	abcd, abcd_save, tmp, msg[4];
+	uint32_t	e0, e1;
+	int		j = 0;
+
+	abcd = abcd_save = vld1q_u32(state_in);
+	e0 = state_in[4];
+	for (j = 0; j < 4; j++) {
+		msg[j] = vld1q_u32(data + 4 * j);
+	}
+
+	for (j = 0; j < 20; j++) {
+		e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+		if (j < 5) {
+			tmp = vaddq_u32(msg[j & 3], vdupq_n_u32(K1_0_TO_19));
+			abcd = vsha1cq_u32(abcd, e0, tmp);
+		} else if (j < 10) {
+			tmp = vaddq_u32(msg[j & 3], vdupq_n_u32(K1_20_TO_39));
+			abcd = vsha1pq_u32(abcd, e0, tmp);
+		} else if (j < 15) {
+			tmp = vaddq_u32(msg[j & 3], vdupq_n_u32(K1_40_TO_59));
+			abcd = vsha1mq_u32(abcd, e0, tmp);
+		} else {
+			tmp = vaddq_u32(msg[j & 3], vdupq_n_u32(K1_60_TO_79));
+			abcd = vsha1pq_u32(abcd, e0, tmp);
+		}
+		e0 = e1;
+		/* Message words 4 * (j + 4) to 4 * (j + 4) + 3 */
+		if (j < 16) {
+			msg[j & 3] = vsha1su1q_u32(vsha1su0q_u32(msg[j & 3], msg[(j + 1) & 3], msg[(j + 2) & 3]), msg[(j + 3) & 3]);
+		}
+	}
+
+	/* Compute the current intermediate hash value */
+	vst1q_u32(state_out, vaddq_u32(abcd, abcd_save));
+	state_out[4] = state_in[4] + e0;
+}
+
+static void sha256_Transform_hw(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
+	uint32x4_t	state0, state1, abcd_save, efgh_save, tmp, tmp0, msg[4];
+	int		j = 0;
+
+	state0 = abcd_save = vld1q_u32(&state_in[0]);
+	state1 = efgh_save = vld1q_u32(&state_in[4]);
+	for (j = 0; j < 4; j++) {
+		msg[j] = vld1q_u32(data + 4 * j);
+	}
+
+	for (j = 0; j < 16; j++) {
+		tmp = vaddq_u32(msg[j & 3], vld1q_u32(&K256[4 * j]));
+		/* Message words 4 * (j + 4) to 4 * (j + 4) + 3 */
+		if (j < 12) {
+			msg[j & 3] = vsha256su1q_u32(vsha256su0q_u32(msg[j & 3], msg[(j + 1) & 3]), msg[(j + 2) & 3], msg[(j + 3) & 3]);
+		}
+		tmp0 = state0;
+		state0 = vsha256hq_u32(state0, state1, tmp);
+		state1 = vsha256h2q_u32(state1, tmp0, tmp);
+	}
+
+	/* Compute the current intermediate hash value */
+	vst1q_u32(&state_out[0], vaddq_u32(state0, abcd_save));
+	vst1q_u32(&state_out[4], vaddq_u32(state1, efgh_save));
+}
+
+#endif
+
+#ifdef SHA2_HW_TRANSFORM
+static int sha2_hw_transform(void) {
+	/* The check is cheap and idempotent, a race only repeats it */
+	static int	available = -1;
+
+	if (available < 0) {
+		available = sha2_hw_transform_available();
+	}
+	return available;
+}
+#endif
+
+
 /*** SHA-1: ***********************************************************/
 void sha1_Init(SHA1_CTX* context) {
 	MEMCPY_BCOPY(context->state, sha1_initial_hash_value, SHA1_DIGEST_LENGTH);
@@ -320,7 +741,7 @@ void sha1_Init(SHA1_CTX* context) {
 	(b) = ROTL32(30, b);	\
 	j++;
 
-void sha1_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
+static void sha1_Transform_generic(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
 	sha2_word32	a = 0, b = 0, c = 0, d = 0, e = 0;
 	sha2_word32	T1 = 0;
 	sha2_word32	W1[16] = {0};
@@ -438,7 +859,7 @@ void sha1_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2_w
 
 #else  /* SHA2_UNROLL_TRANSFORM */
 
-void sha1_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
+static void sha1_Transform_generic(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
 	sha2_word32	a = 0, b = 0, c = 0, d = 0, e = 0;
 	sha2_word32	T1 = 0;
 	sha2_word32	W1[16] = {0};
@@ -519,6 +940,16 @@ void sha1_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2_w
 
 #endif /* SHA2_UNROLL_TRANSFORM */
 
+void sha1_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
+#ifdef SHA2_HW_TRANSFORM
+	if (sha2_hw_transform()) {
+		sha1_Transform_hw(state_in, data, state_out);
+		return;
+	}
+#endif
+	sha1_Transform_generic(state_in, data, state_out);
+}
+
 void sha1_Update(SHA1_CTX* context, const sha2_byte *data, size_t len) {
 	unsigned int	freespace = 0, usedspace = 0;
 
@@ -667,6 +1098,10 @@ char* sha1_Data(const sha2_byte* data, size_t len, char digest[SHA1_DIGEST_STRIN
 }
 
 /*** SHA-256: *********************************************************/
+#if defined(SHA2_UNROLL_TRANSFORM) && !defined(SHA256_UNROLL_TRANSFORM)
+#define SHA256_UNROLL_TRANSFORM
+#endif
+
 void sha256_Init(SHA256_CTX* context) {
 	if (context == (SHA256_CTX*)0) {
 		return;
@@ -676,7 +1111,7 @@ void sha256_Init(SHA256_CTX* context) {
 	context->bitcount = 0;
 }
 
-#ifdef SHA2_UNROLL_TRANSFORM
+#ifdef SHA256_UNROLL_TRANSFORM
 
 /* Unrolled SHA-256 round macros: */
 
@@ -698,7 +1133,7 @@ void sha256_Init(SHA256_CTX* context) {
 	(h) = T1 + Sigma0_256(a) + Maj((a), (b), (c)); \
 	j++
 
-void sha256_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
+static void sha256_Transform_generic(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
 	sha2_word32	a = 0, b = 0, c = 0, d = 0, e = 0, f = 0, g = 0, h = 0, s0 = 0, s1 = 0;
 	sha2_word32	T1 = 0;
 	sha2_word32 W256[16] = {0};
@@ -753,9 +1188,9 @@ void sha256_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2
 	a = b = c = d = e = f = g = h = T1 = 0;
 }
 
-#else /* SHA2_UNROLL_TRANSFORM */
+#else /* SHA256_UNROLL_TRANSFORM */
 
-void sha256_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
+static void sha256_Transform_generic(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
 	sha2_word32	a = 0, b = 0, c = 0, d = 0, e = 0, f = 0, g = 0, h = 0, s0 = 0, s1 = 0;
 	sha2_word32	T1 = 0, T2 = 0 , W256[16] = {0};
 	int		j = 0;
@@ -824,7 +1259,17 @@ void sha256_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2
 	a = b = c = d = e = f = g = h = T1 = T2 = 0;
 }
 
-#endif /* SHA2_UNROLL_TRANSFORM */
+#endif /* SHA256_UNROLL_TRANSFORM */
+
+void sha256_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
+#ifdef SHA2_HW_TRANSFORM
+	if (sha2_hw_transform()) {
+		sha256_Transform_hw(state_in, data, state_out);
+		return;
+	}
+#endif
+	sha256_Transform_generic(state_in, data, state_out);
+}
 
 void sha256_Update(SHA256_CTX* context, const sha2_byte *data, size_t len) {
 	unsigned int	freespace = 0, usedspace = 0;
@@ -1281,3 +1726,209 @@ char* sha512_Data(const sha2_byte* data, size_t len, char digest[SHA512_DIGEST_S
 	sha512_Update(&context, data, len);
 	return sha512_End(&context, digest);
 }
+
+/*** MULTI-BUFFER TRANSFORMS ******************************************/
+/*
+ * The multi-buffer transforms process the blocks of independent messages
+ * side by side, one message per lane of a GCC vector type, which the
+ * compiler maps to SSE2/AVX2 or NEON registers and splits into narrower
+ * ones or plain words on targets without them.  Without vector types they
+ * fall back to the one block transforms.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+
+typedef sha2_word32 sha2_word32x4 __attribute__((vector_size(16)));
+typedef sha2_word32 sha2_word32x8 __attribute__((vector_size(32)));
+typedef sha2_word64 sha2_word64x2 __attribute__((vector_size(16)));
+typedef sha2_word64 sha2_word64x4 __attribute__((vector_size(32)));
+
+#define SHA2_TRANSFORM_LANES(vec, LANES, ROUNDS, K, S0, S1, s0, s1) do { \
+	vec	a = {0}, b = {0}, c = {0}, d = {0}, e = {0}, f = {0}, g = {0}, h = {0}; \
+	vec	T1 = {0}, T2 = {0}, W[16] = {{0}}; \
+	int	j = 0, l = 0; \
+	for (l = 0; l < LANES; l++) { \
+		a[l] = state_in[l][0]; b[l] = state_in[l][1]; \
+		c[l] = state_in[l][2]; d[l] = state_in[l][3]; \
+		e[l] = state_in[l][4]; f[l] = state_in[l][5]; \
+		g[l] = state_in[l][6]; h[l] = state_in[l][7]; \
+		for (j = 0; j < 16; j++) { \
+			W[j][l] = data[l][j]; \
+		} \
+	} \
+	for (j = 0; j < ROUNDS; j++) { \
+		if (j >= 16) { \
+			W[j&0x0f] += s1(W[(j+14)&0x0f]) + W[(j+9)&0x0f] + s0(W[(j+1)&0x0f]); \
+		} \
+		T1 = h + S1(e) + Ch(e, f, g) + K[j] + W[j&0x0f]; \
+		T2 = S0(a) + Maj(a, b, c); \
+		h = g; g = f; f = e; e = d + T1; \
+		d = c; c = b; b = a; a = T1 + T2; \
+	} \
+	for (l = 0; l < LANES; l++) { \
+		state_out[l][0] = state_in[l][0] + a[l]; state_out[l][1] = state_in[l][1] + b[l]; \
+		state_out[l][2] = state_in[l][2] + c[l]; state_out[l][3] = state_in[l][3] + d[l]; \
+		state_out[l][4] = state_in[l][4] + e[l]; state_out[l][5] = state_in[l][5] + f[l]; \
+		state_out[l][6] = state_in[l][6] + g[l]; state_out[l][7] = state_in[l][7] + h[l]; \
+	} \
+} while (0)
+
+#else
+
+#define SHA2_TRANSFORM_LANES(vec, LANES, ROUNDS, K, S0, S1, s0, s1) do { \
+	int	l = 0; \
+	for (l = 0; l < LANES; l++) { \
+		SHA2_TRANSFORM_ONE(state_in[l], data[l], state_out[l]); \
+	} \
+} while (0)
+
+#endif
+
+#define SHA256_TRANSFORM_LANES(LANES) \
+	SHA2_TRANSFORM_LANES(sha2_word32x ## LANES, LANES, 64, K256, Sigma0_256, Sigma1_256, sigma0_256, sigma1_256)
+#define SHA512_TRANSFORM_LANES(LANES) \
+	SHA2_TRANSFORM_LANES(sha2_word64x ## LANES, LANES, 80, K512, Sigma0_512, Sigma1_512, sigma0_512, sigma1_512)
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+/* 8 x 32 and 4 x 64 bit lanes fill an AVX2 register */
+#define SHA2_LANES_AVX2
+
+__attribute__((target("avx2")))
+static void sha256_Transform_x8_avx2(const sha2_word32* const state_in[8], const sha2_word32* const data[8], sha2_word32* const state_out[8]) {
+	SHA256_TRANSFORM_LANES(8);
+}
+
+__attribute__((target("avx2")))
+static void sha512_Transform_x4_avx2(const sha2_word64* const state_in[4], const sha2_word64* const data[4], sha2_word64* const state_out[4]) {
+	SHA512_TRANSFORM_LANES(4);
+}
+#endif
+
+#define SHA2_TRANSFORM_ONE sha256_Transform
+
+void sha256_Transform_x4(const sha2_word32* const state_in[4], const sha2_word32* const data[4], sha2_word32* const state_out[4]) {
+	SHA256_TRANSFORM_LANES(4);
+}
+
+void sha256_Transform_x8(const sha2_word32* const state_in[8], const sha2_word32* const data[8], sha2_word32* const state_out[8]) {
+#ifdef SHA2_LANES_AVX2
+	if (__builtin_cpu_supports("avx2")) {
+		sha256_Transform_x8_avx2(state_in, data, state_out);
+		return;
+	}
+#endif
+	SHA256_TRANSFORM_LANES(8);
+}
+
+#undef SHA2_TRANSFORM_ONE
+#define SHA2_TRANSFORM_ONE sha512_Transform
+
+void sha512_Transform_x2(const sha2_word64* const state_in[2], const sha2_word64* const data[2], sha2_word64* const state_out[2]) {
+	SHA512_TRANSFORM_LANES(2);
+}
+
+void sha512_Transform_x4(const sha2_word64* const state_in[4], const sha2_word64* const data[4], sha2_word64* const state_out[4]) {
+#ifdef SHA2_LANES_AVX2
+	if (__builtin_cpu_supports("avx2")) {
+		sha512_Transform_x4_avx2(state_in, data, state_out);
+		return;
+	}
+#endif
+	SHA512_TRANSFORM_LANES(4);
+}
+
+#undef SHA2_TRANSFORM_ONE
+
+/*
+ * Hashes n independent messages, digests receives n * SHA256_DIGEST_LENGTH
+ * bytes.  The messages go through sha256_Transform_x8 eight at a time,
+ * unless there are no SIMD lanes to gain from or sha256_Transform runs on
+ * the SHA instructions, which keep up with eight AVX2 lanes on their own.
+ */
+void sha256_Raw_multi(const sha2_byte* const msgs[], const size_t lens[], size_t n, sha2_byte* digests) {
+	sha2_word32	state[8][8] = {0}, scratch[8] = {0}, block[8][16] = {0};
+	const sha2_word32	*state_in[8] = {0}, *data[8] = {0};
+	sha2_word32	*state_out[8] = {0};
+	sha2_byte	buffer[SHA256_BLOCK_LENGTH] = {0};
+	size_t		i = 0, blocks[8] = {0}, max_blocks = 0, offset = 0, k = 0;
+	int		j = 0, l = 0, lanes = 0;
+
+#if !defined(__SSE2__) && !defined(__ARM_NEON)
+	const int use_lanes = 0;
+#elif defined(SHA2_HW_TRANSFORM)
+	const int use_lanes = !sha2_hw_transform();
+#else
+	const int use_lanes = 1;
+#endif
+	if (!use_lanes) {
+		for (i = 0; i < n; i++) {
+			sha256_Raw(msgs[i], lens[i], digests + i * SHA256_DIGEST_LENGTH);
+		}
+		return;
+	}
+
+	for (i = 0; i < n; i += 8) {
+		lanes = (n - i < 8) ? (int)(n - i) : 8;
+		max_blocks = 0;
+		for (l = 0; l < lanes; l++) {
+			/* 0x80 and the 64-bit length follow the message */
+			blocks[l] = (lens[i + l] + 1 + 8 + SHA256_BLOCK_LENGTH - 1) / SHA256_BLOCK_LENGTH;
+			if (blocks[l] > max_blocks) {
+				max_blocks = blocks[l];
+			}
+			memcpy(state[l], sha256_initial_hash_value, sizeof(state[l]));
+		}
+
+		for (k = 0; k < max_blocks; k++) {
+			for (l = 0; l < 8; l++) {
+				if (l >= lanes || k >= blocks[l]) {
+					/* finished or unused lane */
+					state_in[l] = scratch;
+					state_out[l] = scratch;
+					data[l] = block[l];
+					continue;
+				}
+				offset = k * SHA256_BLOCK_LENGTH;
+				memzero(buffer, sizeof(buffer));
+				if (offset < lens[i + l]) {
+					size_t	copy = lens[i + l] - offset;
+					if (copy > SHA256_BLOCK_LENGTH) {
+						copy = SHA256_BLOCK_LENGTH;
+					}
+					MEMCPY_BCOPY(buffer, msgs[i + l] + offset, copy);
+				}
+				if (lens[i + l] >= offset && lens[i + l] - offset < SHA256_BLOCK_LENGTH) {
+					buffer[lens[i + l] - offset] = 0x80;
+				}
+				if (k == blocks[l] - 1) {
+					sha2_word64	bitcount = (sha2_word64)lens[i + l] << 3;
+					int		m = 0;
+					for (m = 0; m < 8; m++) {
+						buffer[SHA256_BLOCK_LENGTH - 1 - m] = (sha2_byte)(bitcount >> (8 * m));
+					}
+				}
+				for (j = 0; j < 16; j++) {
+					block[l][j] = ((sha2_word32)buffer[4 * j] << 24) | ((sha2_word32)buffer[4 * j + 1] << 16) |
+					              ((sha2_word32)buffer[4 * j + 2] << 8) | (sha2_word32)buffer[4 * j + 3];
+				}
+				state_in[l] = state[l];
+				state_out[l] = state[l];
+				data[l] = block[l];
+			}
+			sha256_Transform_x8(state_in, data, state_out);
+		}
+
+		for (l = 0; l < lanes; l++) {
+			sha2_byte	*digest = digests + (i + l) * SHA256_DIGEST_LENGTH;
+			for (j = 0; j < 8; j++) {
+				digest[4 * j] = (sha2_byte)(state[l][j] >> 24);
+				digest[4 * j + 1] = (sha2_byte)(state[l][j] >> 16);
+				digest[4 * j + 2] = (sha2_byte)(state[l][j] >> 8);
+				digest[4 * j + 3] = (sha2_byte)state[l][j];
+			}
+		}
+	}
+
+	memzero(state, sizeof(state));
+	memzero(block, sizeof(block));
+	memzero(buffer, sizeof(buffer));
+}
@@ -105,6 +105,11 @@ char* sha256_End(SHA256_CTX*, char[SHA256_DIGEST_STRING_LENGTH]);
 void sha256_Raw(const uint8_t*, size_t, uint8_t[SHA256_DIGEST_LENGTH]);
 char* sha256_Data(const uint8_t*, size_t, char[SHA256_DIGEST_STRING_LENGTH]);
 
+// transforms of independent blocks computed in parallel SIMD lanes
+void sha256_Transform_x4(const uint32_t* const state_in[4], const uint32_t* const data[4], uint32_t* const state_out[4]);
+void sha256_Transform_x8(const uint32_t* const state_in[8], const uint32_t* const data[8], uint32_t* const state_out[8]);
+void sha256_Raw_multi(const uint8_t* const msgs[], const size_t lens[], size_t n, uint8_t* digests);
+
 void sha512_Transform(const uint64_t* state_in, const uint64_t* data, uint64_t* state_out);
 void sha512_Init(SHA512_CTX*);
 void sha512_Update(SHA512_CTX*, const uint8_t*, size_t);
@@ -113,4 +118,7 @@ char* sha512_End(SHA512_CTX*, char[SHA512_DIGEST_STRING_LENGTH]);
 void sha512_Raw(const uint8_t*, size_t, uint8_t[SHA512_DIGEST_LENGTH]);
 char* sha512_Data(const uint8_t*, size_t, char[SHA512_DIGEST_STRING_LENGTH]);
 
+void sha512_Transform_x2(const uint64_t* const state_in[2], const uint64_t* const data[2], uint64_t* const state_out[2]);
+void sha512_Transform_x4(const uint64_t* const state_in[4], const uint64_t* const data[4], uint64_t* const state_out[4]);
+
 #endif
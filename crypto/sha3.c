@@ -32,6 +32,74 @@
 /* constants */
 #define NumberOfRounds 24
 
+#if USE_SHA3_INTERLEAVED
+/*
+ * Bit-interleaved Keccak for 32-bit CPUs: every 64-bit lane of the state
+ * holds its even bits in the low and its odd bits in the high 32-bit word,
+ * so a 64-bit lane rotation becomes two 32-bit word rotations.  The state
+ * of SHA3_CTX stays interleaved between blocks, the lanes are converted
+ * when a block is absorbed and when the digest is extracted.
+ */
+#define ROTL32(dword, n) ((n) ? ((dword) << (n) ^ ((dword) >> (32 - (n)))) : (dword))
+
+/* 64-bit rotation by the constant n of the lane (e, o) into (re, ro) */
+#define KECCAK_BI_ROL(re, ro, e, o, n) do { \
+	uint32_t e_ = (e), o_ = (o); \
+	if ((n) & 1) { \
+		(re) = ROTL32(o_, ((n) + 1) / 2); \
+		(ro) = ROTL32(e_, ((n) - 1) / 2); \
+	} else { \
+		(re) = ROTL32(e_, (n) / 2); \
+		(ro) = ROTL32(o_, (n) / 2); \
+	} \
+} while (0)
+
+/* round constants with the even bits in [0] and the odd bits in [1] */
+static const uint32_t keccak_round_constants_bi[NumberOfRounds][2] = {
+	{0x00000001, 0x00000000}, {0x00000000, 0x00000089}, {0x00000000, 0x8000008B}, {0x00000000, 0x80008080},
+	{0x00000001, 0x0000008B}, {0x00000001, 0x00008000}, {0x00000001, 0x80008088}, {0x00000001, 0x80000082},
+	{0x00000000, 0x0000000B}, {0x00000000, 0x0000000A}, {0x00000001, 0x00008082}, {0x00000000, 0x00008003},
+	{0x00000001, 0x0000808B}, {0x00000001, 0x8000000B}, {0x00000001, 0x8000008A}, {0x00000001, 0x80000081},
+	{0x00000000, 0x80000081}, {0x00000000, 0x80000008}, {0x00000000, 0x00000083}, {0x00000000, 0x80008003},
+	{0x00000001, 0x80008088}, {0x00000000, 0x80000088}, {0x00000001, 0x00008000}, {0x00000000, 0x80008082}
+};
+
+/* moves the even bits of the lane to its low and the odd bits to its high word */
+static uint64_t keccak_interleave(uint64_t lane)
+{
+	uint32_t lo = (uint32_t)lane, hi = (uint32_t)(lane >> 32), t = 0;
+
+	t = (lo ^ (lo >> 1)) & 0x22222222; lo ^= t ^ (t << 1);
+	t = (lo ^ (lo >> 2)) & 0x0C0C0C0C; lo ^= t ^ (t << 2);
+	t = (lo ^ (lo >> 4)) & 0x00F000F0; lo ^= t ^ (t << 4);
+	t = (lo ^ (lo >> 8)) & 0x0000FF00; lo ^= t ^ (t << 8);
+	t = (hi ^ (hi >> 1)) & 0x22222222; hi ^= t ^ (t << 1);
+	t = (hi ^ (hi >> 2)) & 0x0C0C0C0C; hi ^= t ^ (t << 2);
+	t = (hi ^ (hi >> 4)) & 0x00F000F0; hi ^= t ^ (t << 4);
+	t = (hi ^ (hi >> 8)) & 0x0000FF00; hi ^= t ^ (t << 8);
+	return (uint64_t)((lo & 0x0000FFFF) | (hi << 16)) |
+	       (uint64_t)((lo >> 16) | (hi & 0xFFFF0000)) << 32;
+}
+
+/* the inverse of keccak_interleave() */
+static uint64_t keccak_deinterleave(uint64_t lane)
+{
+	uint32_t e = (uint32_t)lane, o = (uint32_t)(lane >> 32), t = 0;
+	uint32_t lo = (e & 0x0000FFFF) | (o << 16), hi = (e >> 16) | (o & 0xFFFF0000);
+
+	t = (lo ^ (lo >> 8)) & 0x0000FF00; lo ^= t ^ (t << 8);
+	t = (lo ^ (lo >> 4)) & 0x00F000F0; lo ^= t ^ (t << 4);
+	t = (lo ^ (lo >> 2)) & 0x0C0C0C0C; lo ^= t ^ (t << 2);
+	t = (lo ^ (lo >> 1)) & 0x22222222; lo ^= t ^ (t << 1);
+	t = (hi ^ (hi >> 8)) & 0x0000FF00; hi ^= t ^ (t << 8);
+	t = (hi ^ (hi >> 4)) & 0x00F000F0; hi ^= t ^ (t << 4);
+	t = (hi ^ (hi >> 2)) & 0x0C0C0C0C; hi ^= t ^ (t << 2);
+	t = (hi ^ (hi >> 1)) & 0x22222222; hi ^= t ^ (t << 1);
+	return (uint64_t)lo | (uint64_t)hi << 32;
+}
+
+#define sha3_lane_in(x) keccak_interleave(le2me_64(x))
+#else
 /* SHA3 (Keccak) constants for 24 rounds */
 static uint64_t keccak_round_constants[NumberOfRounds] = {
 	I64(0x0000000000000001), I64(0x0000000000008082), I64(0x800000000000808A), I64(0x8000000080008000),
@@ -42,6 +110,9 @@ static uint64_t keccak_round_constants[NumberOfRounds] = {
 	I64(0x8000000080008081), I64(0x8000000000008080), I64(0x0000000080000001), I64(0x8000000080008008)
 };
 
+#define sha3_lane_in(x) le2me_64(x)
+#endif /* USE_SHA3_INTERLEAVED */
+
 /* Initializing a sha3 context for given number of output bits */
 static void keccak_Init(SHA3_CTX *ctx, unsigned bits)
 {
@@ -93,6 +164,128 @@ void sha3_512_Init(SHA3_CTX *ctx)
 	keccak_Init(ctx, 512);
 }
 
+#if USE_SHA3_INTERLEAVED
+static void sha3_permutation(uint64_t *state)
+{
+	uint32_t A[50] = {0}, B[50] = {0};
+	uint32_t C0e = 0, C0o = 0, C1e = 0, C1o = 0, C2e = 0, C2o = 0, C3e = 0, C3o = 0, C4e = 0, C4o = 0;
+	uint32_t D0e = 0, D0o = 0, D1e = 0, D1o = 0, D2e = 0, D2o = 0, D3e = 0, D3o = 0, D4e = 0, D4o = 0;
+	int i = 0, round = 0;
+
+	for (i = 0; i < 25; i++) {
+		A[2 * i] = (uint32_t)state[i];
+		A[2 * i + 1] = (uint32_t)(state[i] >> 32);
+	}
+	for (round = 0; round < NumberOfRounds; round++)
+	{
+		/* theta */
+		C0e = A[ 0] ^ A[10] ^ A[20] ^ A[30] ^ A[40];
+		C0o = A[ 1] ^ A[11] ^ A[21] ^ A[31] ^ A[41];
+		C1e = A[ 2] ^ A[12] ^ A[22] ^ A[32] ^ A[42];
+		C1o = A[ 3] ^ A[13] ^ A[23] ^ A[33] ^ A[43];
+		C2e = A[ 4] ^ A[14] ^ A[24] ^ A[34] ^ A[44];
+		C2o = A[ 5] ^ A[15] ^ A[25] ^ A[35] ^ A[45];
+		C3e = A[ 6] ^ A[16] ^ A[26] ^ A[36] ^ A[46];
+		C3o = A[ 7] ^ A[17] ^ A[27] ^ A[37] ^ A[47];
+		C4e = A[ 8] ^ A[18] ^ A[28] ^ A[38] ^ A[48];
+		C4o = A[ 9] ^ A[19] ^ A[29] ^ A[39] ^ A[49];
+		D0e = C4e ^ ROTL32(C1o, 1);
+		D0o = C4o ^ C1e;
+		D1e = C0e ^ ROTL32(C2o, 1);
+		D1o = C0o ^ C2e;
+		D2e = C1e ^ ROTL32(C3o, 1);
+		D2o = C1o ^ C3e;
+		D3e = C2e ^ ROTL32(C4o, 1);
+		D3o = C2o ^ C4e;
+		D4e = C3e ^ ROTL32(C0o, 1);
+		D4o = C3o ^ C0e;
+		/* rho and pi */
+		KECCAK_BI_ROL(B[ 0], B[ 1], A[ 0] ^ D0e, A[ 1] ^ D0o,  0);
+		KECCAK_BI_ROL(B[20], B[21], A[ 2] ^ D1e, A[ 3] ^ D1o,  1);
+		KECCAK_BI_ROL(B[40], B[41], A[ 4] ^ D2e, A[ 5] ^ D2o, 62);
+		KECCAK_BI_ROL(B[10], B[11], A[ 6] ^ D3e, A[ 7] ^ D3o, 28);
+		KECCAK_BI_ROL(B[30], B[31], A[ 8] ^ D4e, A[ 9] ^ D4o, 27);
+		KECCAK_BI_ROL(B[32], B[33], A[10] ^ D0e, A[11] ^ D0o, 36);
+		KECCAK_BI_ROL(B[ 2], B[ 3], A[12] ^ D1e, A[13] ^ D1o, 44);
+		KECCAK_BI_ROL(B[22], B[23], A[14] ^ D2e, A[15] ^ D2o,  6);
+		KECCAK_BI_ROL(B[42], B[43], A[16] ^ D3e, A[17] ^ D3o, 55);
+		KECCAK_BI_ROL(B[12], B[13], A[18] ^ D4e, A[19] ^ D4o, 20);
+		KECCAK_BI_ROL(B[14], B[15], A[20] ^ D0e, A[21] ^ D0o,  3);
+		KECCAK_BI_ROL(B[34], B[35], A[22] ^ D1e, A[23] ^ D1o, 10);
+		KECCAK_BI_ROL(B[ 4], B[ 5], A[24] ^ D2e, A[25] ^ D2o, 43);
+		KECCAK_BI_ROL(B[24], B[25], A[26] ^ D3e, A[27] ^ D3o, 25);
+		KECCAK_BI_ROL(B[44], B[45], A[28] ^ D4e, A[29] ^ D4o, 39);
+		KECCAK_BI_ROL(B[46], B[47], A[30] ^ D0e, A[31] ^ D0o, 41);
+		KECCAK_BI_ROL(B[16], B[17], A[32] ^ D1e, A[33] ^ D1o, 45);
+		KECCAK_BI_ROL(B[36], B[37], A[34] ^ D2e, A[35] ^ D2o, 15);
+		KECCAK_BI_ROL(B[ 6], B[ 7], A[36] ^ D3e, A[37] ^ D3o, 21);
+		KECCAK_BI_ROL(B[26], B[27], A[38] ^ D4e, A[39] ^ D4o,  8);
+		KECCAK_BI_ROL(B[28], B[29], A[40] ^ D0e, A[41] ^ D0o, 18);
+		KECCAK_BI_ROL(B[48], B[49], A[42] ^ D1e, A[43] ^ D1o,  2);
+		KECCAK_BI_ROL(B[18], B[19], A[44] ^ D2e, A[45] ^ D2o, 61);
+		KECCAK_BI_ROL(B[38], B[39], A[46] ^ D3e, A[47] ^ D3o, 56);
+		KECCAK_BI_ROL(B[ 8], B[ 9], A[48] ^ D4e, A[49] ^ D4o, 14);
+		/* chi */
+		A[ 0] = B[ 0] ^ (~B[ 2] & B[ 4]);
+		A[ 1] = B[ 1] ^ (~B[ 3] & B[ 5]);
+		A[ 2] = B[ 2] ^ (~B[ 4] & B[ 6]);
+		A[ 3] = B[ 3] ^ (~B[ 5] & B[ 7]);
+		A[ 4] = B[ 4] ^ (~B[ 6] & B[ 8]);
+		A[ 5] = B[ 5] ^ (~B[ 7] & B[ 9]);
+		A[ 6] = B[ 6] ^ (~B[ 8] & B[ 0]);
+		A[ 7] = B[ 7] ^ (~B[ 9] & B[ 1]);
+		A[ 8] = B[ 8] ^ (~B[ 0] & B[ 2]);
+		A[ 9] = B[ 9] ^ (~B[ 1] & B[ 3]);
+		A[10] = B[10] ^ (~B[12] & B[14]);
+		A[11] = B[11] ^ (~B[13] & B[15]);
+		A[12] = B[12] ^ (~B[14] & B[16]);
+		A[13] = B[13] ^ (~B[15] & B[17]);
+		A[14] = B[14] ^ (~B[16] & B[18]);
+		A[15] = B[15] ^ (~B[17] & B[19]);
+		A[16] = B[16] ^ (~B[18] & B[10]);
+		A[17] = B[17] ^ (~B[19] & B[11]);
+		A[18] = B[18] ^ (~B[10] & B[12]);
+		A[19] = B[19] ^ (~B[11] & B[13]);
+		A[20] = B[20] ^ (~B[22] & B[24]);
+		A[21] = B[21] ^ (~B[23] & B[25]);
+		A[22] = B[22] ^ (~B[24] & B[26]);
+		A[23] = B[23] ^ (~B[25] & B[27]);
+		A[24] = B[24] ^ (~B[26] & B[28]);
+		A[25] = B[25] ^ (~B[27] & B[29]);
+		A[26] = B[26] ^ (~B[28] & B[20]);
+		A[27] = B[27] ^ (~B[29] & B[21]);
+		A[28] = B[28] ^ (~B[20] & B[22]);
+		A[29] = B[29] ^ (~B[21] & B[23]);
+		A[30] = B[30] ^ (~B[32] & B[34]);
+		A[31] = B[31] ^ (~B[33] & B[35]);
+		A[32] = B[32] ^ (~B[34] & B[36]);
+		A[33] = B[33] ^ (~B[35] & B[37]);
+		A[34] = B[34] ^ (~B[36] & B[38]);
+		A[35] = B[35] ^ (~B[37] & B[39]);
+		A[36] = B[36] ^ (~B[38] & B[30]);
+		A[37] = B[37] ^ (~B[39] & B[31]);
+		A[38] = B[38] ^ (~B[30] & B[32]);
+		A[39] = B[39] ^ (~B[31] & B[33]);
+		A[40] = B[40] ^ (~B[42] & B[44]);
+		A[41] = B[41] ^ (~B[43] & B[45]);
+		A[42] = B[42] ^ (~B[44] & B[46]);
+		A[43] = B[43] ^ (~B[45] & B[47]);
+		A[44] = B[44] ^ (~B[46] & B[48]);
+		A[45] = B[45] ^ (~B[47] & B[49]);
+		A[46] = B[46] ^ (~B[48] & B[40]);
+		A[47] = B[47] ^ (~B[49] & B[41]);
+		A[48] = B[48] ^ (~B[40] & B[42]);
+		A[49] = B[49] ^ (~B[41] & B[43]);
+		/* iota */
+		A[0] ^= keccak_round_constants_bi[round][0];
+		A[1] ^= keccak_round_constants_bi[round][1];
+	}
+	for (i = 0; i < 25; i++) {
+		state[i] = (uint64_t)A[2 * i] | (uint64_t)A[2 * i + 1] << 32;
+	}
+	memzero(B, sizeof(B));
+}
+#else
 /* Keccak theta() transformation */
 static void keccak_theta(uint64_t *A)
 {
@@ -203,6 +396,7 @@ static void sha3_permutation(uint64_t *state)
 		*state ^= keccak_round_constants[round];
 	}
 }
+#endif /* USE_SHA3_INTERLEAVED */
 
 /**
  * The core transformation. Process the specified block of data.
@@ -214,40 +408,40 @@ static void sha3_permutation(uint64_t *state)
 static void sha3_process_block(uint64_t hash[25], const uint64_t *block, size_t block_size)
 {
 	/* expanded loop */
-	hash[ 0] ^= le2me_64(block[ 0]);
-	hash[ 1] ^= le2me_64(block[ 1]);
-	hash[ 2] ^= le2me_64(block[ 2]);
-	hash[ 3] ^= le2me_64(block[ 3]);
-	hash[ 4] ^= le2me_64(block[ 4]);
-	hash[ 5] ^= le2me_64(block[ 5]);
-	hash[ 6] ^= le2me_64(block[ 6]);
-	hash[ 7] ^= le2me_64(block[ 7]);
-	hash[ 8] ^= le2me_64(block[ 8]);
+	hash[ 0] ^= sha3_lane_in(block[ 0]);
+	hash[ 1] ^= sha3_lane_in(block[ 1]);
+	hash[ 2] ^= sha3_lane_in(block[ 2]);
+	hash[ 3] ^= sha3_lane_in(block[ 3]);
+	hash[ 4] ^= sha3_lane_in(block[ 4]);
+	hash[ 5] ^= sha3_lane_in(block[ 5]);
+	hash[ 6] ^= sha3_lane_in(block[ 6]);
+	hash[ 7] ^= sha3_lane_in(block[ 7]);
+	hash[ 8] ^= sha3_lane_in(block[ 8]);
 	/* if not sha3-512 */
 	if (block_size > 72) {
-		hash[ 9] ^= le2me_64(block[ 9]);
-		hash[10] ^= le2me_64(block[10]);
-		hash[11] ^= le2me_64(block[11]);
-		hash[12] ^= le2me_64(block[12]);
+		hash[ 9] ^= sha3_lane_in(block[ 9]);
+		hash[10] ^= sha3_lane_in(block[10]);
+		hash[11] ^= sha3_lane_in(block[11]);
+		hash[12] ^= sha3_lane_in(block[12]);
 		/* if not sha3-384 */
 		if (block_size > 104) {
-			hash[13] ^= le2me_64(block[13]);
-			hash[14] ^= le2me_64(block[14]);
-			hash[15] ^= le2me_64(block[15]);
-			hash[16] ^= le2me_64(block[16]);
+			hash[13] ^= sha3_lane_in(block[13]);
+			hash[14] ^= sha3_lane_in(block[14]);
+			hash[15] ^= sha3_lane_in(block[15]);
+			hash[16] ^= sha3_lane_in(block[16]);
 			/* if not sha3-256 */
 			if (block_size > 136) {
-				hash[17] ^= le2me_64(block[17]);
+				hash[17] ^= sha3_lane_in(block[17]);
 #ifdef FULL_SHA3_FAMILY_SUPPORT
 				/* if not sha3-224 */
 				if (block_size > 144) {
-					hash[18] ^= le2me_64(block[18]);
-					hash[19] ^= le2me_64(block[19]);
-					hash[20] ^= le2me_64(block[20]);
-					hash[21] ^= le2me_64(block[21]);
-					hash[22] ^= le2me_64(block[22]);
-					hash[23] ^= le2me_64(block[23]);
-					hash[24] ^= le2me_64(block[24]);
+					hash[18] ^= sha3_lane_in(block[18]);
+					hash[19] ^= sha3_lane_in(block[19]);
+					hash[20] ^= sha3_lane_in(block[20]);
+					hash[21] ^= sha3_lane_in(block[21]);
+					hash[22] ^= sha3_lane_in(block[22]);
+					hash[23] ^= sha3_lane_in(block[23]);
+					hash[24] ^= sha3_lane_in(block[24]);
 				}
 #endif
 			}
@@ -330,6 +524,11 @@ void sha3_Final(SHA3_CTX *ctx, unsigned char* result)
 	}
 
 	assert(block_size > digest_length);
+#if USE_SHA3_INTERLEAVED
+	for (size_t i = 0; i < (digest_length + 7) / 8; i++) {
+		ctx->hash[i] = keccak_deinterleave(ctx->hash[i]);
+	}
+#endif
 	if (result) me64_to_le_str(result, ctx->hash, digest_length);
 	memzero(ctx, sizeof(SHA3_CTX));
 }
@@ -359,6 +558,11 @@ void keccak_Final(SHA3_CTX *ctx, unsigned char* result)
 	}
 
 	assert(block_size > digest_length);
+#if USE_SHA3_INTERLEAVED
+	for (size_t i = 0; i < (digest_length + 7) / 8; i++) {
+		ctx->hash[i] = keccak_deinterleave(ctx->hash[i]);
+	}
+#endif
 	if (result) me64_to_le_str(result, ctx->hash, digest_length);
 	memzero(ctx, sizeof(SHA3_CTX));
 }
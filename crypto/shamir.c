@@ -260,75 +260,119 @@ static void gf256_inv(uint32_t r[8], uint32_t x[8]) {
   memzero(z, sizeof(z));
 }
 
+static bool gf256_is_zero(const uint32_t x[8]) {
+  return (x[0] | x[1] | x[2] | x[3] | x[4] | x[5] | x[6] | x[7]) == 0;
+}
+
 bool shamir_interpolate(uint8_t *result, uint8_t result_index,
                         const uint8_t *share_indices,
                         const uint8_t **share_values, uint8_t share_count,
                         size_t len) {
-  size_t i = 0, j = 0;
+  return shamir_interpolate_multi(&result, &result_index, 1, share_indices,
+                                  share_values, share_count, len);
+}
+
+bool shamir_interpolate_multi(uint8_t **results, const uint8_t *result_indices,
+                              uint8_t result_count,
+                              const uint8_t *share_indices,
+                              const uint8_t **share_values, uint8_t share_count,
+                              size_t len) {
+  size_t i = 0, j = 0, k = 0;
   uint32_t x[8] = {0};
   uint32_t xs[share_count][8];
   memset(xs, 0, sizeof(xs));
   uint32_t ys[share_count][8];
   memset(ys, 0, sizeof(ys));
-  uint32_t num[8] = {~0}; /* num is the numerator (=1) */
-  uint32_t denom[8] = {0};
+  /* ws[i] is the product of (x_i - x_j) over j != i, which does not depend
+   * on the result index */
+  uint32_t ws[share_count][8];
+  memset(ws, 0, sizeof(ws));
+  /* the denominators of the Lagrange basis polynomials and their prefix
+   * products for the batch inversion */
+  uint32_t ds[share_count][8];
+  memset(ds, 0, sizeof(ds));
+  uint32_t ps[share_count][8];
+  memset(ps, 0, sizeof(ps));
+  uint32_t num[8] = {0};
+  uint32_t inv[8] = {0};
   uint32_t tmp[8] = {0};
   uint32_t secret[8] = {0};
   bool ret = true;
 
-  if (len > SHAMIR_MAX_LEN) return false;
+  if (len > SHAMIR_MAX_LEN || share_count == 0) return false;
 
   /* Collect the x and y values */
   for (i = 0; i < share_count; i++) {
     bitslice_setall(xs[i], share_indices[i]);
     bitslice(ys[i], share_values[i], len);
   }
-  bitslice_setall(x, result_index);
-
-  for (i = 0; i < share_count; i++) {
-    memcpy(tmp, x, sizeof(uint32_t[8]));
-    gf256_add(tmp, xs[i]);
-    gf256_mul(num, num, tmp);
-  }
 
-  /* Use Lagrange basis polynomials to calculate the secret coefficient */
   for (i = 0; i < share_count; i++) {
-    /* The code below assumes that none of the share_indices are equal to
-     * result_index. We need to treat that as a special case. */
-    if (share_indices[i] != result_index) {
-      memcpy(denom, x, sizeof(denom));
-      gf256_add(denom, xs[i]);
-    } else {
-      bitslice_setall(denom, 1);
-      gf256_add(secret, ys[i]);
-    }
+    bitslice_setall(ws[i], 1);
     for (j = 0; j < share_count; j++) {
       if (i == j) continue;
       memcpy(tmp, xs[i], sizeof(uint32_t[8]));
       gf256_add(tmp, xs[j]);
-      gf256_mul(denom, denom, tmp);
+      gf256_mul(ws[i], ws[i], tmp);
     }
-    if ((denom[0] | denom[1] | denom[2] | denom[3] | denom[4] | denom[5] |
-         denom[6] | denom[7]) == 0) {
+    if (gf256_is_zero(ws[i])) {
       /* The share_indices are not unique. */
       ret = false;
       break;
     }
-    gf256_inv(tmp, denom);      /* inverted denominator */
-    gf256_mul(tmp, tmp, num);   /* basis polynomial */
-    gf256_mul(tmp, tmp, ys[i]); /* scaled coefficient */
-    gf256_add(secret, tmp);
   }
 
-  if (ret == true) {
-    unbitslice(result, secret, len);
+  for (k = 0; ret == true && k < result_count; k++) {
+    bitslice_setall(x, result_indices[k]);
+    bitslice_setall(num, 1); /* num is the numerator */
+    memset(secret, 0, sizeof(secret));
+
+    /* ds[i] = (x - x_i) * ws[i], ps[i] = ds[0] * ... * ds[i] */
+    for (i = 0; i < share_count; i++) {
+      memcpy(tmp, x, sizeof(uint32_t[8]));
+      gf256_add(tmp, xs[i]);
+      gf256_mul(num, num, tmp);
+
+      /* The code below assumes that none of the share_indices are equal to
+       * result_index. We need to treat that as a special case. */
+      if (share_indices[i] != result_indices[k]) {
+        gf256_mul(ds[i], tmp, ws[i]);
+      } else {
+        memcpy(ds[i], ws[i], sizeof(uint32_t[8]));
+        gf256_add(secret, ys[i]);
+      }
+      if (i == 0) {
+        memcpy(ps[0], ds[0], sizeof(uint32_t[8]));
+      } else {
+        gf256_mul(ps[i], ps[i - 1], ds[i]);
+      }
+    }
+
+    /* Invert all the denominators with a single inversion */
+    gf256_inv(inv, ps[share_count - 1]); /* (ds[0] * ... * ds[i])^-1 */
+    for (i = share_count; i-- > 0;) {
+      if (i > 0) {
+        gf256_mul(tmp, inv, ps[i - 1]); /* inverted denominator */
+        gf256_mul(inv, inv, ds[i]);
+      } else {
+        memcpy(tmp, inv, sizeof(tmp));
+      }
+      gf256_mul(tmp, tmp, num);   /* basis polynomial */
+      gf256_mul(tmp, tmp, ys[i]); /* scaled coefficient */
+      gf256_add(secret, tmp);
+    }
+
+    unbitslice(results[k], secret, len);
   }
 
   memzero(x, sizeof(x));
   memzero(xs, sizeof(xs));
   memzero(ys, sizeof(ys));
+  memzero(ws, sizeof(ws));
+  memzero(ds, sizeof(ds));
+  memzero(ps, sizeof(ps));
   memzero(num, sizeof(num));
-  memzero(denom, sizeof(denom));
+  memzero(inv, sizeof(inv));
   memzero(tmp, sizeof(tmp));
   memzero(secret, sizeof(secret));
   return ret;
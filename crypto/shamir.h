@@ -67,4 +67,17 @@ bool shamir_interpolate(uint8_t *result, uint8_t result_index,
                         const uint8_t **share_values, uint8_t share_count,
                         size_t len);
 
+/*
+ * Computes f(x) for each of result_count x coordinates in result_indices and
+ * writes them to results[0], ... , results[result_count - 1], in the manner
+ * of shamir_interpolate(). The parts of the computation that do not depend on
+ * x, the bitsliced share values and the Lagrange denominators of the shares,
+ * are done once for all of the results.
+ */
+bool shamir_interpolate_multi(uint8_t **results, const uint8_t *result_indices,
+                              uint8_t result_count,
+                              const uint8_t *share_indices,
+                              const uint8_t **share_values, uint8_t share_count,
+                              size_t len);
+
 #endif /* __SHAMIR_H__ */
@@ -25,7 +25,11 @@
 #include "slip39.h"
 #include <stdio.h>
 #include <string.h>
+#include "memzero.h"
+#include "pbkdf2.h"
+#include "sha2.h"
 #include "slip39_wordlist.h"
+#include "slip39_wordlist_index.h"
 
 /**
  * Returns word on position `index`.
@@ -41,6 +45,17 @@ bool word_index(uint16_t* index, const char* word, uint8_t word_length) {
   uint16_t hi = WORDS_COUNT;
   uint16_t mid = 0;
 
+  // narrow the search to the words sharing the first two letters
+  if (word_length >= 2 && word[0] >= 'a' && word[0] <= 'z' &&
+      word[1] >= 'a' && word[1] <= 'z') {
+    uint16_t pair = (word[0] - 'a') * 26 + (word[1] - 'a');
+    lo = wordlist_index[pair];
+    hi = wordlist_index[pair + 1];
+    if (lo == hi) {
+      return false;
+    }
+  }
+
   while ((hi - lo) > 1) {
     mid = (hi + lo) / 2;
     if (strncmp(wordlist[mid], word, word_length) > 0) {
@@ -65,7 +80,28 @@ bool word_index(uint16_t* index, const char* word, uint8_t word_length) {
  * Example: 110000110 - second, third, eighth and ninth button still can be
  * pressed.
  */
-uint16_t compute_mask(uint16_t prefix) { return find(prefix, false); }
+uint16_t compute_mask(uint16_t prefix) {
+  if (prefix == 0 || prefix >= 1000) {
+    return find(prefix, false);
+  }
+
+  // sequences of one to three buttons are looked up in button_masks
+  uint16_t offset = 0;
+  uint16_t count = 1;
+  uint16_t n = 0;
+  uint16_t p = prefix;
+  while (p > 0) {
+    uint8_t digit = p % 10;
+    if (digit == 0) {
+      return find(prefix, false);
+    }
+    n += (digit - 1) * count;
+    offset += count;
+    count *= 9;
+    p /= 10;
+  }
+  return button_masks[offset - 1 + n];
+}
 
 /**
  * Converts sequence to word index.
@@ -101,6 +137,11 @@ uint16_t find(uint16_t prefix, bool find_index) {
   }
   for_max = min - (min % 1000) + 1000;
 
+  // the first button is sorted, so start at its first word
+  if (min / 1000 >= 1 && min / 1000 <= 9) {
+    i = button_index[min / 1000 - 1];
+  }
+
   // We can't use binary search because the numbers are not sorted.
   // They are sorted using the words' alphabet (so we can use the index).
   // Example: axle (1953), beam (1315)
@@ -134,3 +175,155 @@ uint16_t find(uint16_t prefix, bool find_index) {
 
   return bitmap;
 }
+
+/**
+ * The customization string used in the RS1024 checksum and in the PBKDF2 salt.
+ */
+static const uint8_t CUSTOMIZATION_STRING[] = {'s', 'h', 'a', 'm', 'i', 'r'};
+
+static uint32_t rs1024_polymod_step(uint32_t chk, uint16_t value) {
+  static const uint32_t GEN[10] = {
+      0xE0E040,   0x1C1C080,  0x3838100,  0x7070200,  0xE0E0009,
+      0x1C0C2412, 0x38086C24, 0x3090FC48, 0x21B1F890, 0x3F3F120,
+  };
+  uint32_t b = chk >> 20;
+  chk = ((chk & 0xFFFFF) << 10) ^ value;
+  for (int i = 0; i < 10; i++) {
+    chk ^= GEN[i] & -((b >> i) & 1);
+  }
+  return chk;
+}
+
+static uint32_t rs1024_polymod(const uint16_t* data, size_t length) {
+  uint32_t chk = 1;
+  for (size_t i = 0; i < sizeof(CUSTOMIZATION_STRING); i++) {
+    chk = rs1024_polymod_step(chk, CUSTOMIZATION_STRING[i]);
+  }
+  for (size_t i = 0; i < length; i++) {
+    chk = rs1024_polymod_step(chk, data[i]);
+  }
+  return chk;
+}
+
+/**
+ * Verifies the RS1024 checksum of the word indices of a mnemonic, the last
+ * SLIP39_RS1024_CHECKSUM_LENGTH of which are the checksum.
+ */
+bool rs1024_verify_checksum(const uint16_t* data, size_t length) {
+  return rs1024_polymod(data, length) == 1;
+}
+
+/**
+ * Fills the last SLIP39_RS1024_CHECKSUM_LENGTH of the `length` word indices
+ * with the RS1024 checksum of the ones before them.
+ */
+void rs1024_create_checksum(uint16_t* data, size_t length) {
+  for (size_t i = length - SLIP39_RS1024_CHECKSUM_LENGTH; i < length; i++) {
+    data[i] = 0;
+  }
+  uint32_t polymod = rs1024_polymod(data, length) ^ 1;
+  for (size_t i = 0; i < SLIP39_RS1024_CHECKSUM_LENGTH; i++) {
+    data[length - 1 - i] = (polymod >> (10 * i)) & 1023;
+  }
+}
+
+/**
+ * The Feistel network which applies the passphrase to the master secret.
+ * The round function is PBKDF2-HMAC-SHA256 keyed by the round index and the
+ * passphrase, with the salt "shamir" || identifier || R.
+ */
+static bool slip39_feistel(const uint8_t* input, size_t length,
+                           const uint8_t* passphrase, size_t passphrase_length,
+                           uint8_t iteration_exponent, uint16_t identifier,
+                           bool decrypt, uint8_t* output) {
+  // 10000 << e iterations split over four rounds, in 32 bits
+  if (length == 0 || length % 2 != 0 || length > SLIP39_MAX_SECRET_LENGTH ||
+      iteration_exponent > 20) {
+    return false;
+  }
+  const size_t half = length / 2;
+  const uint32_t iterations = (10000 / 4) << iteration_exponent;
+
+  uint8_t left[SLIP39_MAX_SECRET_LENGTH / 2];
+  uint8_t right[SLIP39_MAX_SECRET_LENGTH / 2];
+  uint8_t f[SHA256_DIGEST_LENGTH];
+  uint8_t salt[sizeof(CUSTOMIZATION_STRING) + 2 + SLIP39_MAX_SECRET_LENGTH / 2];
+  // the HMAC key is the round index followed by the passphrase, hashed if it
+  // is longer than a block just as HMAC itself would
+  uint8_t key[SHA256_BLOCK_LENGTH];
+  const bool hash_key = 1 + passphrase_length > sizeof(key);
+  const size_t key_length =
+      hash_key ? SHA256_DIGEST_LENGTH : 1 + passphrase_length;
+  PBKDF2_HMAC_SHA256_CTX pctx;
+  SHA256_CTX sctx;
+
+  memcpy(left, input, half);
+  memcpy(right, input + half, half);
+  memcpy(salt, CUSTOMIZATION_STRING, sizeof(CUSTOMIZATION_STRING));
+  salt[sizeof(CUSTOMIZATION_STRING)] = identifier >> 8;
+  salt[sizeof(CUSTOMIZATION_STRING) + 1] = identifier & 0xFF;
+  const size_t salt_prefix_length = sizeof(CUSTOMIZATION_STRING) + 2;
+
+  for (uint8_t round = 0; round < 4; round++) {
+    uint8_t i = decrypt ? 3 - round : round;
+    if (hash_key) {
+      sha256_Init(&sctx);
+      sha256_Update(&sctx, &i, 1);
+      sha256_Update(&sctx, passphrase, passphrase_length);
+      sha256_Final(&sctx, key);
+    } else {
+      key[0] = i;
+      memcpy(key + 1, passphrase, passphrase_length);
+    }
+    memcpy(salt + salt_prefix_length, right, half);
+    pbkdf2_hmac_sha256_Init(&pctx, key, key_length, salt,
+                            salt_prefix_length + half, 1);
+    pbkdf2_hmac_sha256_Update(&pctx, iterations);
+    pbkdf2_hmac_sha256_Final(&pctx, f);
+
+    // (L, R) = (R, L ^ F(i, R))
+    for (size_t j = 0; j < half; j++) {
+      f[j] ^= left[j];
+    }
+    memcpy(left, right, half);
+    memcpy(right, f, half);
+  }
+
+  memcpy(output, right, half);
+  memcpy(output + half, left, half);
+
+  memzero(left, sizeof(left));
+  memzero(right, sizeof(right));
+  memzero(f, sizeof(f));
+  memzero(key, sizeof(key));
+  memzero(&pctx, sizeof(pctx));
+  memzero(&sctx, sizeof(sctx));
+  return true;
+}
+
+/**
+ * Converts a Master Secret to the Encrypted Master Secret with the passphrase.
+ * Returns false if the length is odd or too long, or the iteration exponent
+ * is too large.
+ */
+bool slip39_encrypt(const uint8_t* master_secret, size_t length,
+                    const uint8_t* passphrase, size_t passphrase_length,
+                    uint8_t iteration_exponent, uint16_t identifier,
+                    uint8_t* encrypted_master_secret) {
+  return slip39_feistel(master_secret, length, passphrase, passphrase_length,
+                        iteration_exponent, identifier, false,
+                        encrypted_master_secret);
+}
+
+/**
+ * Converts the Encrypted Master Secret to the Master Secret with the
+ * passphrase, the inverse of slip39_encrypt().
+ */
+bool slip39_decrypt(const uint8_t* encrypted_master_secret, size_t length,
+                    const uint8_t* passphrase, size_t passphrase_length,
+                    uint8_t iteration_exponent, uint16_t identifier,
+                    uint8_t* master_secret) {
+  return slip39_feistel(encrypted_master_secret, length, passphrase,
+                        passphrase_length, iteration_exponent, identifier, true,
+                        master_secret);
+}
@@ -23,6 +23,7 @@
  */
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 const char* get_word(uint16_t index);
@@ -34,3 +35,20 @@ uint16_t compute_mask(uint16_t prefix);
 const char* button_sequence_to_word(uint16_t prefix);
 
 uint16_t find(uint16_t prefix, bool find_index);
+
+#define SLIP39_RS1024_CHECKSUM_LENGTH 3
+#define SLIP39_MAX_SECRET_LENGTH 64
+
+bool rs1024_verify_checksum(const uint16_t* data, size_t length);
+
+void rs1024_create_checksum(uint16_t* data, size_t length);
+
+bool slip39_encrypt(const uint8_t* master_secret, size_t length,
+                    const uint8_t* passphrase, size_t passphrase_length,
+                    uint8_t iteration_exponent, uint16_t identifier,
+                    uint8_t* encrypted_master_secret);
+
+bool slip39_decrypt(const uint8_t* encrypted_master_secret, size_t length,
+                    const uint8_t* passphrase, size_t passphrase_length,
+                    uint8_t iteration_exponent, uint16_t identifier,
+                    uint8_t* master_secret);
@@ -0,0 +1,142 @@
+// clang-format off
+// This file is generated by tools/mkwordindex.py from slip39_wordlist.h, do not edit.
+
+// words in [wordlist_index[26 * a + b], wordlist_index[26 * a + b + 1])
+// start with the letters a and b
+static const uint16_t wordlist_index[26 * 26 + 1] = {
+       0,    0,    0,    7,   15,   15,   16,   19,   19,   23,   24,   24,
+      34,   38,   48,   48,   49,   50,   56,   57,   57,   60,   63,   65,
+      67,   67,   67,   67,   67,   67,   67,   79,   79,   79,   79,   83,
+      83,   83,   89,   89,   89,   95,   95,   95,  103,  103,  103,  114,
+     114,  114,  114,  114,  114,  130,  130,  130,  130,  133,  133,  133,
+     141,  143,  143,  143,  155,  155,  155,  166,  166,  166,  179,  179,
+     179,  184,  184,  184,  184,  185,  185,  191,  191,  191,  191,  217,
+     217,  217,  217,  233,  233,  233,  233,  233,  233,  239,  239,  239,
+     248,  248,  248,  251,  251,  252,  252,  253,  253,  257,  257,  260,
+     263,  263,  263,  263,  263,  264,  264,  264,  273,  280,  292,  292,
+     294,  296,  298,  301,  301,  301,  306,  306,  322,  323,  323,  338,
+     338,  338,  338,  338,  338,  338,  338,  349,  349,  349,  358,  358,
+     358,  367,  367,  367,  377,  377,  377,  381,  381,  381,  381,  381,
+     381,  388,  388,  388,  388,  394,  394,  394,  394,  394,  394,  394,
+     399,  399,  399,  401,  401,  401,  415,  415,  415,  420,  420,  420,
+     420,  420,  420,  429,  429,  429,  429,  437,  437,  437,  437,  437,
+     437,  437,  437,  437,  437,  444,  444,  444,  444,  444,  444,  451,
+     451,  451,  451,  452,  452,  452,  452,  452,  455,  455,  455,  455,
+     455,  455,  455,  455,  455,  460,  478,  478,  478,  478,  479,  481,
+     482,  482,  483,  483,  483,  483,  483,  484,  484,  484,  484,  486,
+     486,  486,  486,  486,  486,  486,  486,  486,  486,  487,  487,  487,
+     487,  487,  487,  495,  495,  495,  495,  495,  495,  495,  495,  495,
+     495,  497,  497,  497,  497,  500,  500,  500,  500,  500,  502,  502,
+     502,  502,  502,  502,  502,  502,  502,  502,  502,  502,  502,  512,
+     512,  512,  512,  523,  523,  523,  523,  536,  536,  536,  536,  536,
+     536,  542,  542,  542,  542,  542,  542,  547,  547,  547,  547,  549,
+     549,  570,  570,  570,  570,  580,  580,  580,  580,  588,  588,  588,
+     588,  588,  588,  599,  599,  599,  599,  599,  599,  606,  606,  606,
+     606,  606,  606,  608,  608,  608,  608,  613,  613,  613,  613,  613,
+     613,  613,  613,  613,  613,  613,  613,  613,  613,  613,  613,  616,
+     616,  616,  616,  617,  617,  618,  622,  623,  623,  623,  624,  624,
+     624,  624,  624,  624,  625,  626,  626,  626,  626,  626,  632,  632,
+     632,  633,  635,  636,  636,  636,  636,  653,  653,  653,  653,  663,
+     663,  663,  668,  676,  676,  676,  684,  684,  684,  684,  684,  684,
+     707,  707,  707,  715,  715,  715,  715,  716,  716,  716,  716,  716,
+     716,  716,  716,  716,  716,  716,  716,  716,  716,  716,  716,  716,
+     716,  716,  716,  716,  716,  720,  720,  720,  720,  720,  720,  730,
+     730,  730,  730,  760,  760,  760,  762,  765,  765,  765,  765,  765,
+     765,  772,  772,  772,  772,  772,  772,  775,  775,  775,  775,  775,
+     775,  784,  784,  795,  795,  801,  801,  801,  811,  818,  818,  820,
+     827,  834,  837,  843,  857,  859,  859,  859,  873,  882,  882,  886,
+     886,  890,  890,  898,  898,  898,  898,  908,  908,  908,  917,  922,
+     922,  922,  922,  922,  922,  927,  927,  927,  942,  942,  942,  942,
+     942,  944,  944,  946,  946,  946,  946,  946,  946,  946,  946,  947,
+     947,  947,  947,  947,  948,  949,  960,  960,  962,  962,  962,  965,
+     965,  965,  965,  965,  965,  965,  965,  970,  970,  970,  970,  978,
+     978,  978,  978,  987,  987,  987,  987,  987,  987,  992,  992,  992,
+     992,  992,  992,  992,  992,  992,  992,  992,  992,  997,  997,  997,
+     997, 1003, 1003, 1003, 1003, 1011, 1011, 1011, 1011, 1011, 1011, 1015,
+    1015, 1015, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019,
+    1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019,
+    1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019,
+    1019, 1019, 1019, 1019, 1019, 1021, 1021, 1021, 1021, 1022, 1022, 1022,
+    1022, 1022, 1022, 1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023,
+    1023, 1023, 1023, 1023, 1023, 1023, 1023, 1024, 1024, 1024, 1024, 1024,
+    1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+    1024, 1024, 1024, 1024, 1024,
+};
+
+// words in [button_index[b - 1], button_index[b]) start with button b
+static const uint16_t button_index[9 + 1] = {
+       0,  114,  253,  381,  495,  606,  720,  890,  992, 1024,
+};
+
+// masks of the buttons that can follow 1, 2 and 3 button sequences
+static const uint16_t button_masks[9 + 9 * 9 + 9 * 9 * 9] = {
+     510,  509,  507,  503,  429,  479,  447,  381,  109,    0,  253,  379,
+     119,  495,  475,  191,  382,   25,  248,    0,  251,  247,  173,  467,
+     429,   83,   49,  506,  184,    0,  243,  239,  222,  175,  125,  175,
+     506,   20,  369,    0,   45,  223,  189,  127,    1,  506,    0,  507,
+     503,    0,  475,    0,  370,   72,  494,    4,  491,  503,  429,    0,
+     175,  127,  176,  510,  109,  507,  503,  173,  479,    0,  381,  124,
+     498,    0,  505,  247,  129,  478,  173,    0,   40,  208,    0,   81,
+     246,    0,   88,   41,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,   34,    0,   32,  130,    8,  196,   32,  121,    0,
+     208,   96,    0,   33,   40,    4,  129,    0,   32,   72,    4,   32,
+       0,    4,   16,  190,    0,    0,  490,   32,   64,  180,    0,  136,
+       4,  116,    1,  208,  268,    0,   84,  128,    0,  296,   45,    8,
+     162,    1,   33,  132,    4,  404,    0,  264,    0,    0,  152,   64,
+     145,   41,  138,  290,    0,    4,  320,    0,    0,   64,    4,    0,
+       0,    0,    0,    0,    0,    0,   68,   39,  395,  191,   77,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,  210,  124,    0,
+      16,    9,  477,  159,   45,    0,  120,  128,  466,    0,   12,   28,
+     191,   45,    0,  320,    0,    1,   52,    0,  202,    0,   65,    0,
+      80,  136,    0,    0,  173,    0,  160,  108,   33,  286,    0,   67,
+     246,    0,  384,    0,  106,   68,    8,   16,    0,    0,  132,    0,
+     153,    0,    0,   64,    0,    0,    0,    8,    1,    0,    0,    0,
+       0,  136,    0,   48,  108,  138,  404,   41,   32,    0,    0,    0,
+     164,    8,   16,    0,    2,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    4,  128,    0,    0,  128,   11,   30,   40,    0,
+     248,    4,  507,  224,    0,  221,    4,    4,    0,    0,  184,  112,
+      99,    1,    0,  415,  365,    0,   74,    1,   96,    7,    0,  450,
+       0,    9,    0,   16,    0,   32,   18,    4,   18,   20,    0,    0,
+      18,  156,   67,    1,    0,  213,    0,   68,    0,    0,   16,    0,
+      64,   69,   10,  179,   44,   17,    0,    0,   33,    0,    4,    0,
+       0,    0,    0,  210,    0,    0,    0,   32,  220,  155,    0,    4,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,  106,    0,   32,
+      16,    0,  209,    0,    0,    0,  160,  252,   33,  164,  271,    0,
+     188,  109,    0,  482,    0,    1,  116,    1,  466,    0,   16,    0,
+      64,    8,   80,  150,  105,  218,  409,    0,    0,   64,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,  284,    0,  115,   45,  203,
+     191,   44,  104,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     230,  137,    0,   69,   33,  138,   42,   76,    1,   68,  100,  128,
+       0,  271,  206,  129,   14,  133,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,   44,   13,    0,  196,    4,    0,  168,  110,    1,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   24,    0,
+       0,  132,   11,  142,    0,  128,    0,    0,    0,   32,    0,    0,
+       8,    0,    0,    0,   28,   64,   55,    0,  135,  158,   77,   80,
+       0,    0,    1,    0,    0,    0,    0,    0,    0,   98,   17,    0,
+       1,    0,    3,  150,  268,   64,   96,  144,    2,    0,    4,  148,
+     129,    2,   64,  488,    0,    1,  128,    0,  128,    0,   32,   16,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,  314,   12,  251,
+     501,    0,  223,    0,   32,    0,  112,   16,   96,    6,  101,  267,
+      34,    0,    0,    0,    0,    0,    0,   32,    4,    0,    8,    0,
+       0,   29,    1,  112,  161,   26,   32,   44,   64,  224,    0,   32,
+      36,    0,  128,   45,    0,    0,  246,  229,    0,  212,   45,  159,
+     174,  109,    1,  118,   12,   80,    0,  172,  200,  136,    5,  144,
+     224,    0,   19,  242,    0,  272,    0,  104,    0,  122,   24,  435,
+     246,  163,    0,  137,  117,    1,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,  510,    0,   33,  179,   36,   84,  173,    0,   16,
+       0,    0,    1,  176,   33,    2,  128,    0,    0,    0,  176,    0,
+       0,  172,    8,  152,    8,    8,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,   82,    0,    0,    1,  160,  195,  410,    4,  132,
+     160,  404,  353,    0,  261,  216,  141,   49,    0,   64,    0,    0,
+       0,    0,    0,    0,    8,    0,    0,   37,  161,  231,  172,    0,
+     128,   77,   72,  238,    0,   97,  167,    0,  128,    0,   69,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      34,    0,   12,    0,    0,    0,    0,    0,    0,    0,   32,    0,
+      48,  258,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     114,    0,    0,    0,   38,    0,  160,    0,    0,    0,  128,   16,
+       0,    2,    6,    6,   72,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    1,    5,    0,  144,    0,    0,
+      32,    0,    0,  192,    0,  128,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,
+};
@@ -470,10 +470,10 @@ def assert_bn_divide_base(x_old, prime):
     assert x_new * 2 ** bits_per_limb % prime == x_old % prime
 
 
-def assert_bn_inverse(x_old, prime):
+def assert_bn_inverse(x_old, prime, function=lib.bn_inverse):
     bn_x = int_to_bignum(x_old)
     bn_prime = int_to_bignum(prime)
-    lib.bn_inverse(bn_x, bn_prime)
+    function(bn_x, bn_prime)
     x_new = bignum_to_int(bn_x)
 
     assert bignum_is_normalised(bn_x)
@@ -481,6 +481,20 @@ def assert_bn_inverse(x_old, prime):
     assert (x_old == 0 and x_new == 0) or (x_old != 0 and (x_old * x_new) % prime == 1)
 
 
+def assert_bn_inverse_batch(xs_old, prime, function):
+    bignum_type = limbs_number * limb_type
+    bn_xs = (len(xs_old) * bignum_type)(*[int_to_bignum(x) for x in xs_old])
+    bn_scratch = (len(xs_old) * bignum_type)()
+    bn_prime = int_to_bignum(prime)
+    function(bn_xs, c_size_t(len(xs_old)), bn_prime, bn_scratch)
+
+    for bn_x, x_old in zip(bn_xs, xs_old):
+        x_new = bignum_to_int(bn_x)
+        assert bignum_is_normalised(bn_x)
+        assert number_is_fully_reduced(x_new, prime)
+        assert (x_old * x_new) % prime == 1
+
+
 def assert_bn_normalize(bn_x):
     x_old = bignum_to_int(bn_x)
     lib.bn_normalize(bn_x)
@@ -846,6 +860,20 @@ def test_bn_multiply(r, prime):
     assert_bn_multiply(k, x, prime)
 
 
+def test_bn_multiply_nist256p1(r):
+    prime = 0xFFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF
+    x = r.randrange(floor(sqrt(2 ** 519)))
+    k = r.randrange(floor(sqrt(2 ** 519)))
+    assert_bn_multiply(k, x, prime)
+
+
+def test_bn_multiply_order(r):
+    prime = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141
+    x = r.randrange(floor(sqrt(2 ** 519)))
+    k = r.randrange(floor(sqrt(2 ** 519)))
+    assert_bn_multiply(k, x, prime)
+
+
 def test_bn_fast_mod_1(r, prime):
     assert_bn_fast_mod(r.rand_int_normalized(), prime)
 
@@ -904,6 +932,21 @@ def test_bn_inverse_2(r, prime):
     assert_bn_inverse(n, prime)
 
 
+def test_bn_inverse_safegcd(r, prime):
+    assert_bn_inverse(0, prime, lib.bn_inverse_safegcd)
+    assert_bn_inverse(1, prime, lib.bn_inverse_safegcd)
+    assert_bn_inverse(prime - 1, prime, lib.bn_inverse_safegcd)
+    assert_bn_inverse(r.randrange(1, prime), prime, lib.bn_inverse_safegcd)
+    # not reduced
+    assert_bn_inverse(prime + 2, prime, lib.bn_inverse_safegcd)
+
+
+def test_bn_inverse_batch(r, prime):
+    xs = [r.randrange(1, prime) for _ in range(r.randrange(1, 10))]
+    assert_bn_inverse_batch(xs, prime, lib.bn_inverse_batch)
+    assert_bn_inverse_batch(xs, prime, lib.bn_inverse_batch_slow)
+
+
 def test_bn_normalize(r):
     assert_bn_normalize(r.rand_bignum())
 
@@ -40,6 +40,7 @@
 
 #include "address.h"
 #include "aes/aes.h"
+#include "aes/aes_ct.h"
 #include "base32.h"
 #include "base58.h"
 #include "bignum.h"
@@ -53,7 +54,9 @@
 #include "ecdsa.h"
 #include "ed25519-donna/ed25519-donna.h"
 #include "ed25519-donna/ed25519-keccak.h"
+#include "ed25519-donna/ed25519-sha3.h"
 #include "ed25519-donna/ed25519.h"
+#include "groestl.h"
 #include "hmac_drbg.h"
 #include "memzero.h"
 #include "monero/monero.h"
@@ -63,6 +66,7 @@
 #include "rand.h"
 #include "rc4.h"
 #include "rfc6979.h"
+#include "ripemd160.h"
 #include "script.h"
 #include "secp256k1.h"
 #include "sha2.h"
@@ -1907,6 +1911,42 @@ START_TEST(test_bip32_optimized) {
 }
 END_TEST
 
+START_TEST(test_bip32_optimized_batch) {
+  HDNode root;
+  hdnode_from_seed((uint8_t *)"NothingToSeeHere", 16, SECP256K1_NAME, &root);
+  hdnode_fill_public_key(&root);
+
+  curve_point pub;
+  ecdsa_read_pubkey(&secp256k1, root.public_key, &pub);
+
+  curve_point children[20], child;
+  char addrs[20][MAX_ADDR_SIZE], addr[MAX_ADDR_SIZE];
+
+  ck_assert_int_eq(hdnode_public_ckd_cp_batch(&secp256k1, &pub,
+                                              root.chain_code, 5, 20, children),
+                   1);
+  ck_assert_int_eq(hdnode_public_ckd_address_optimized_batch(
+                       &pub, root.chain_code, 5, 20, 0, HASHER_SHA2_RIPEMD,
+                       HASHER_SHA2D, addrs[0], sizeof(addrs[0]), 1),
+                   1);
+  for (int i = 0; i < 20; i++) {
+    hdnode_public_ckd_cp(&secp256k1, &pub, root.chain_code, 5 + i, &child,
+                         NULL);
+    ck_assert_mem_eq(&child, &children[i], sizeof(curve_point));
+    hdnode_public_ckd_address_optimized(&pub, root.chain_code, 5 + i, 0,
+                                        HASHER_SHA2_RIPEMD, HASHER_SHA2D, addr,
+                                        sizeof(addr), 1);
+    ck_assert_str_eq(addr, addrs[i]);
+  }
+
+  // hardened children cannot be derived
+  ck_assert_int_eq(hdnode_public_ckd_cp_batch(&secp256k1, &pub,
+                                              root.chain_code, 0x7FFFFFFF, 2,
+                                              children),
+                   0);
+}
+END_TEST
+
 START_TEST(test_bip32_cache_1) {
   HDNode node1, node2;
   int i, r;
@@ -2019,6 +2059,122 @@ START_TEST(test_bip32_cache_2) {
 }
 END_TEST
 
+START_TEST(test_bip32_cache_roots) {
+  static const char *curves[] = {SECP256K1_NAME, NIST256P1_NAME,
+                                 SECP256K1_NAME};
+  static const char *seeds[] = {
+      "301133282ad079cbeb59bc446ad39d333928f74c46997d3609cd3e2801ca69d6"
+      "2788f9f174429946ff4e9be89f67c22fae28cb296a9b37734f75e73d1477af19",
+      "301133282ad079cbeb59bc446ad39d333928f74c46997d3609cd3e2801ca69d6"
+      "2788f9f174429946ff4e9be89f67c22fae28cb296a9b37734f75e73d1477af19",
+      "000000002ad079cbeb59bc446ad39d333928f74c46997d3609cd3e2801ca69d6"
+      "2788f9f174429946ff4e9be89f67c22fae28cb296a9b37734f75e73d1477af19"};
+  uint32_t ii[] = {0x8000002c, 0x80000000, 0x80000000, 0, 0};
+  HDNode node1, node2;
+  uint32_t hits, misses, fp1, fp2;
+  int i, k, r;
+
+  hdnode_ckd_cache_clear();
+  hdnode_ckd_cache_stats(&hits, &misses);
+  ck_assert_int_eq(hits, 0);
+  ck_assert_int_eq(misses, 0);
+
+  // interleave three roots twice: only the first round misses
+  for (k = 0; k < 2; k++) {
+    for (i = 0; i < 3; i++) {
+      hdnode_from_seed(fromhex(seeds[i]), 64, curves[i], &node1);
+      memcpy(&node2, &node1, sizeof(HDNode));
+      ii[4] = k;
+      for (size_t j = 0; j < 5; j++) {
+        if (j == 4) fp1 = hdnode_fingerprint(&node1);
+        r = hdnode_private_ckd(&node1, ii[j]);
+        ck_assert_int_eq(r, 1);
+      }
+      r = hdnode_private_ckd_cached(&node2, ii, 5, &fp2);
+      ck_assert_int_eq(r, 1);
+      ck_assert_mem_eq(&node1, &node2, sizeof(HDNode));
+      ck_assert_int_eq(fp1, fp2);
+    }
+  }
+  hdnode_ckd_cache_stats(&hits, &misses);
+  ck_assert_int_eq(hits, 3);
+  ck_assert_int_eq(misses, 3);
+
+  // a sibling branch starts from the cached account node
+  hdnode_from_seed(fromhex(seeds[0]), 64, curves[0], &node1);
+  memcpy(&node2, &node1, sizeof(HDNode));
+  ii[3] = 1;
+  for (size_t j = 0; j < 5; j++) {
+    r = hdnode_private_ckd(&node1, ii[j]);
+    ck_assert_int_eq(r, 1);
+  }
+  r = hdnode_private_ckd_cached(&node2, ii, 5, NULL);
+  ck_assert_int_eq(r, 1);
+  ck_assert_mem_eq(&node1, &node2, sizeof(HDNode));
+  hdnode_ckd_cache_stats(&hits, &misses);
+  ck_assert_int_eq(hits, 3);
+  ck_assert_int_eq(misses, 4);
+
+  hdnode_ckd_cache_clear();
+}
+END_TEST
+
+START_TEST(test_bip32_public_cache) {
+  uint32_t ii[] = {0x8000002c, 0x80000000, 0x80000000, 0, 0};
+  uint32_t hits, misses, fp1, fp2;
+  HDNode root, account, node1, node2;
+  int r;
+
+  hdnode_ckd_cache_clear();
+  hdnode_from_seed(
+      fromhex(
+          "301133282ad079cbeb59bc446ad39d333928f74c46997d3609cd3e2801ca69d6"
+          "2788f9f174429946ff4e9be89f67c22fae28cb296a9b37734f75e73d1477af19"),
+      64, SECP256K1_NAME, &root);
+  hdnode_fill_public_key(&root);
+  memcpy(&account, &root, sizeof(HDNode));
+  r = hdnode_private_ckd_cached(&account, ii, 3, NULL);
+  ck_assert_int_eq(r, 1);
+  hdnode_fill_public_key(&account);
+  memzero(account.private_key, 32);
+
+  for (uint32_t k = 0; k < 4; k++) {
+    ii[3] = k & 1;
+    ii[4] = k;
+    memcpy(&node1, &account, sizeof(HDNode));
+    r = hdnode_public_ckd(&node1, ii[3]);
+    ck_assert_int_eq(r, 1);
+    fp1 = hdnode_fingerprint(&node1);
+    r = hdnode_public_ckd(&node1, ii[4]);
+    ck_assert_int_eq(r, 1);
+    memcpy(&node2, &account, sizeof(HDNode));
+    r = hdnode_public_ckd_cached(&node2, ii + 3, 2, &fp2);
+    ck_assert_int_eq(r, 1);
+    ck_assert_mem_eq(&node1, &node2, sizeof(HDNode));
+    ck_assert_int_eq(fp1, fp2);
+  }
+  hdnode_ckd_cache_stats(&hits, &misses);
+  ck_assert_int_eq(hits, 2);
+  ck_assert_int_eq(misses, 3);
+
+  // private and public derivations from one root are cached apart
+  memcpy(&node1, &root, sizeof(HDNode));
+  r = hdnode_private_ckd_cached(&node1, ii + 3, 2, NULL);
+  ck_assert_int_eq(r, 1);
+  hdnode_fill_public_key(&node1);
+  memcpy(&node2, &root, sizeof(HDNode));
+  r = hdnode_public_ckd_cached(&node2, ii + 3, 2, NULL);
+  ck_assert_int_eq(r, 1);
+  ck_assert_mem_eq(node1.public_key, node2.public_key, 33);
+  memcpy(&node1, &root, sizeof(HDNode));
+  r = hdnode_private_ckd_cached(&node1, ii + 3, 2, NULL);
+  ck_assert_int_eq(r, 1);
+  ck_assert(memcmp(node1.private_key, node2.private_key, 32) != 0);
+
+  hdnode_ckd_cache_clear();
+}
+END_TEST
+
 START_TEST(test_bip32_nist_seed) {
   HDNode node;
 
@@ -3797,6 +3953,107 @@ START_TEST(test_aes) {
 }
 END_TEST
 
+// the vectors of test_aes, processed in one call so that blocks are paired
+START_TEST(test_aes_ct) {
+  aes_ct_ctx ctx;
+  uint8_t plain[64], buf[64], iv[16];
+
+  memcpy(plain,
+         fromhex("6bc1bee22e409f96e93d7e117393172a"
+                 "ae2d8a571e03ac9c9eb76fac45af8e51"
+                 "30c81c46a35ce411e5fbc1191a0a52ef"
+                 "f69f2445df4f9b17ad2b417be66c3710"),
+         64);
+  ck_assert_int_eq(
+      aes_ct_set_key(
+          &ctx,
+          fromhex("603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914"
+                  "dff4"),
+          32),
+      0);
+
+  // CBC
+  memcpy(iv, fromhex("000102030405060708090A0B0C0D0E0F"), 16);
+  aes_ct_cbc_encrypt(&ctx, plain, buf, 64, iv);
+  ck_assert_mem_eq(
+      buf,
+      fromhex(
+          "f58c4c04d6e5f1ba779eabfb5f7bfbd69cfc4e967edb808d679f777bc6702c7d"
+          "39f23369a9d9bacfa530e26304231461b2eb05e2c39be9fcda6c19078c6a9d1b"),
+      64);
+  ck_assert_mem_eq(iv, buf + 48, 16);
+  // decrypt in place, with an odd number of blocks in the first call
+  memcpy(iv, fromhex("000102030405060708090A0B0C0D0E0F"), 16);
+  aes_ct_cbc_decrypt(&ctx, buf, buf, 48, iv);
+  aes_ct_cbc_decrypt(&ctx, buf + 48, buf + 48, 16, iv);
+  ck_assert_mem_eq(buf, plain, 64);
+
+  // CTR, with a length that is not a multiple of the block size
+  memcpy(iv, fromhex("f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff"), 16);
+  aes_ct_ctr_crypt(&ctx, plain, buf, 16, iv);
+  aes_ct_ctr_crypt(&ctx, plain + 16, buf + 16, 41, iv);
+  ck_assert_mem_eq(
+      buf,
+      fromhex("601ec313775789a5b7a7f504bbf3d228f443e3ca4d62b59aca84e990cacaf5c5"
+              "2b0930daa23de94ce87017ba2d84988ddfc9c58db67aada613c2dd08457941"
+              "a6"),
+      57);
+  ck_assert_mem_eq(iv, fromhex("f0f1f2f3f4f5f6f7f8f9fafbfcfdff03"), 16);
+
+  // FIPS-197 appendix C for all key sizes, CBC with a zero iv is ECB
+  static const char *fips_vector[] = {
+      "69c4e0d86a7b0430d8cdb78070b4c55a",
+      "dda97ca4864cdfe06eaf70a0ec0d7191",
+      "8ea2b7ca516745bfeafc49904b496089",
+  };
+  uint8_t key[32];
+  for (size_t i = 0; i < sizeof(key); i++) {
+    key[i] = i;
+  }
+  for (int i = 0; i < 3; i++) {
+    ck_assert_int_eq(aes_ct_set_key(&ctx, key, 16 + 8 * i), 0);
+    memzero(iv, 16);
+    aes_ct_cbc_encrypt(&ctx, fromhex("00112233445566778899aabbccddeeff"), buf,
+                       16, iv);
+    ck_assert_mem_eq(buf, fromhex(fips_vector[i]), 16);
+    memzero(iv, 16);
+    aes_ct_cbc_decrypt(&ctx, buf, buf, 16, iv);
+    ck_assert_mem_eq(buf, fromhex("00112233445566778899aabbccddeeff"), 16);
+  }
+
+  // the table based implementation, with a carry in the counter
+  aes_encrypt_ctx ctxe;
+  aes_decrypt_ctx ctxd;
+  uint8_t data[80], out[80], iv2[16];
+  for (size_t i = 0; i < sizeof(data); i++) {
+    data[i] = i * 7 + 1;
+  }
+  ck_assert_int_eq(aes_ct_set_key(&ctx, key, 32), 0);
+  aes_encrypt_key256(key, &ctxe);
+  aes_decrypt_key256(key, &ctxd);
+
+  memset(iv, 0xff, 16);
+  memset(iv2, 0xff, 16);
+  aes_ctr_encrypt(data, out, 75, iv2, aes_ctr_cbuf_inc, &ctxe);
+  aes_ct_ctr_crypt(&ctx, data, buf, 64, iv);
+  ck_assert_mem_eq(buf, out, 64);
+  aes_ct_ctr_crypt(&ctx, data + 64, buf, 11, iv);
+  ck_assert_mem_eq(buf, out + 64, 11);
+
+  memset(iv, 0x5a, 16);
+  memset(iv2, 0x5a, 16);
+  aes_cbc_decrypt(data, out, 80, iv2, &ctxd);
+  memcpy(buf, data, 64);
+  aes_ct_cbc_decrypt(&ctx, buf, buf, 64, iv);
+  ck_assert_mem_eq(buf, out, 64);
+  aes_ct_cbc_decrypt(&ctx, data + 64, buf, 16, iv);
+  ck_assert_mem_eq(buf, out + 64, 16);
+  ck_assert_mem_eq(iv, iv2, 16);
+
+  ck_assert_int_eq(aes_ct_set_key(&ctx, key, 20), -1);
+}
+END_TEST
+
 #define TEST1 "abc"
 #define TEST2_1 "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"
 #define TEST2_2a "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmn"
@@ -4074,6 +4331,76 @@ START_TEST(test_sha512) {
 }
 END_TEST
 
+START_TEST(test_sha2_multi) {
+  uint32_t state256[8][8], out256[8][8], ref256[8][8], data256[8][16];
+  uint64_t state512[4][8], out512[4][8], ref512[4][8], data512[4][16];
+  const uint32_t *in256[8], *blk256[8];
+  uint32_t *res256[8];
+  const uint64_t *in512[4], *blk512[4];
+  uint64_t *res512[4];
+
+  for (int l = 0; l < 8; l++) {
+    for (int j = 0; j < 8; j++) state256[l][j] = 0x01234567 * (l + 1) + j;
+    for (int j = 0; j < 16; j++) data256[l][j] = 0x89abcdef * (j + 1) ^ l;
+    sha256_Transform(state256[l], data256[l], ref256[l]);
+    in256[l] = state256[l];
+    blk256[l] = data256[l];
+    res256[l] = out256[l];
+  }
+  for (int l = 0; l < 4; l++) {
+    for (int j = 0; j < 8; j++)
+      state512[l][j] = 0x0123456789abcdefULL * (l + 1) + j;
+    for (int j = 0; j < 16; j++)
+      data512[l][j] = 0xfedcba9876543210ULL * (j + 1) ^ l;
+    sha512_Transform(state512[l], data512[l], ref512[l]);
+    in512[l] = state512[l];
+    blk512[l] = data512[l];
+    res512[l] = out512[l];
+  }
+
+  memset(out256, 0, sizeof(out256));
+  sha256_Transform_x4(in256, blk256, res256);
+  ck_assert_mem_eq(out256, ref256, 4 * sizeof(out256[0]));
+  memset(out256, 0, sizeof(out256));
+  sha256_Transform_x8(in256, blk256, res256);
+  ck_assert_mem_eq(out256, ref256, sizeof(out256));
+
+  memset(out512, 0, sizeof(out512));
+  sha512_Transform_x2(in512, blk512, res512);
+  ck_assert_mem_eq(out512, ref512, 2 * sizeof(out512[0]));
+  memset(out512, 0, sizeof(out512));
+  sha512_Transform_x4(in512, blk512, res512);
+  ck_assert_mem_eq(out512, ref512, sizeof(out512));
+
+  // in place, as the streaming code calls the transforms
+  sha256_Transform_x8(in256, blk256, (uint32_t *const *)in256);
+  ck_assert_mem_eq(state256, ref256, sizeof(state256));
+  sha512_Transform_x4(in512, blk512, (uint64_t *const *)in512);
+  ck_assert_mem_eq(state512, ref512, sizeof(state512));
+
+  // messages of different lengths, across the padding boundaries
+  uint8_t msg[19][200];
+  const uint8_t *msgs[19];
+  size_t lens[19];
+  uint8_t digests[19 * SHA256_DIGEST_LENGTH], digest[SHA256_DIGEST_LENGTH];
+  for (int i = 0; i < 19; i++) {
+    for (int j = 0; j < 200; j++) msg[i][j] = (uint8_t)(i * 31 + j * 7);
+    msgs[i] = msg[i];
+  }
+  for (size_t start = 0; start < 200; start += 19) {
+    for (int i = 0; i < 19; i++) lens[i] = (start + i * 11) % 201;
+    for (size_t n = 0; n <= 19; n += 6) {
+      sha256_Raw_multi(msgs, lens, n, digests);
+      for (size_t i = 0; i < n; i++) {
+        sha256_Raw(msgs[i], lens[i], digest);
+        ck_assert_mem_eq(digests + i * SHA256_DIGEST_LENGTH, digest,
+                         SHA256_DIGEST_LENGTH);
+      }
+    }
+  }
+}
+END_TEST
+
 // test vectors from http://www.di-mgt.com.au/sha_testvectors.html
 START_TEST(test_sha3_256) {
   uint8_t digest[SHA3_256_DIGEST_LENGTH];
@@ -4605,6 +4932,161 @@ START_TEST(test_blake2s) {
 }
 END_TEST
 
+START_TEST(test_groestl512) {
+  uint8_t digest[64];
+  uint8_t data[1000];
+  GROESTL512_CTX ctx;
+  size_t i;
+
+  groestl512_Init(&ctx);
+  groestl512_Final(&ctx, digest);
+  ck_assert_mem_eq(
+      digest,
+      fromhex(
+          "6d3ad29d279110eef3adbd66de2a0345a77baede1557f5d099fce0c03d6dc2ba"
+          "8e6d4a6633dfbd66053c20faa87d1a11f39a7fbe4a6c2f009801370308fc4ad8"),
+      64);
+
+  groestl512_Init(&ctx);
+  groestl512_Update(&ctx, "The quick brown fox jumps over the lazy dog", 43);
+  groestl512_Final(&ctx, digest);
+  ck_assert_mem_eq(
+      digest,
+      fromhex(
+          "badc1f70ccd69e0cf3760c3f93884289da84ec13c70b3d12a53a7a8a4a513f99"
+          "715d46288f55e1dbf926e6d084a0538e4eebfc91cf2b21452921ccde9131718d"),
+      64);
+
+  // several blocks, fed in uneven pieces
+  for (i = 0; i < sizeof(data); i++) {
+    data[i] = i * 7;
+  }
+  groestl512_Init(&ctx);
+  for (i = 0; i < sizeof(data); i += 100) {
+    groestl512_Update(&ctx, data + i, 13);
+    groestl512_Update(&ctx, data + i + 13, 87);
+  }
+  groestl512_Final(&ctx, digest);
+  ck_assert_mem_eq(
+      digest,
+      fromhex(
+          "5dc14528620cfeae181da9c8d51eccbb502e2b6eea9993bd4890a407e8656c25"
+          "0d992fcdf6a9e7b7804ae34e4e52bf9b5fc41d8e42407a9bd1a9cb412defa73d"),
+      64);
+}
+END_TEST
+
+START_TEST(test_hasher_midstate) {
+  static const HasherType types[] = {
+    HASHER_SHA2,           HASHER_SHA2D, HASHER_SHA2_RIPEMD, HASHER_SHA3,
+#if USE_KECCAK
+    HASHER_SHA3K,
+#endif
+    HASHER_BLAKE,          HASHER_BLAKED, HASHER_BLAKE_RIPEMD,
+    HASHER_GROESTLD_TRUNC, HASHER_BLAKE2B, HASHER_BLAKE2B_PERSONAL,
+  };
+  uint8_t data[300], midstate[HASHER_MIDSTATE_MAX_LENGTH];
+  uint8_t expected[HASHER_DIGEST_LENGTH], hash[HASHER_DIGEST_LENGTH];
+  for (size_t i = 0; i < sizeof(data); i++) {
+    data[i] = i * 7;
+  }
+
+  for (size_t t = 0; t < sizeof(types) / sizeof(types[0]); t++) {
+    // the prefix ends inside a block, the midstate carries the buffer
+    for (size_t prefix = 0; prefix <= sizeof(data); prefix += 75) {
+      Hasher hasher, copy;
+      hasher_InitParam(&hasher, types[t], "ZcashPrevoutHash", 16);
+      hasher_Update(&hasher, data, sizeof(data));
+      hasher_Final(&hasher, expected);
+
+      hasher_InitParam(&hasher, types[t], "ZcashPrevoutHash", 16);
+      hasher_Update(&hasher, data, prefix);
+      hasher_Copy(&copy, &hasher);
+      size_t len =
+          hasher_export_midstate(&hasher, midstate, sizeof(midstate));
+      ck_assert(len > 1);
+      ck_assert(len <= sizeof(midstate));
+      ck_assert_uint_eq(hasher_export_midstate(&hasher, midstate, len - 1), 0);
+
+      hasher_Update(&copy, data + prefix, sizeof(data) - prefix);
+      hasher_Final(&copy, hash);
+      ck_assert_mem_eq(hash, expected, sizeof(hash));
+
+      hasher_InitParam(&copy, types[t], "ZcashPrevoutHash", 16);
+      ck_assert(!hasher_import_midstate(&copy, midstate, len - 1));
+      ck_assert(hasher_import_midstate(&copy, midstate, len));
+      hasher_Update(&copy, data + prefix, sizeof(data) - prefix);
+      hasher_Final(&copy, hash);
+      ck_assert_mem_eq(hash, expected, sizeof(hash));
+    }
+  }
+
+  // a midstate of another type is rejected
+  Hasher sha2, blake2b;
+  hasher_Init(&sha2, HASHER_SHA2);
+  hasher_Init(&blake2b, HASHER_BLAKE2B);
+  size_t len = hasher_export_midstate(&sha2, midstate, sizeof(midstate));
+  ck_assert(!hasher_import_midstate(&blake2b, midstate, len));
+  // and so is one with its buffer position out of range
+  len = hasher_export_midstate(&blake2b, midstate, sizeof(midstate));
+  blake2b.ctx.blake2b.buflen = BLAKE2B_BLOCK_LENGTH + 1;
+  hasher_export_midstate(&blake2b, midstate, sizeof(midstate));
+  ck_assert(!hasher_import_midstate(&blake2b, midstate, len));
+}
+END_TEST
+
+START_TEST(test_hash160) {
+  uint8_t data[100], digest[SHA256_DIGEST_LENGTH];
+  uint8_t expected[RIPEMD160_DIGEST_LENGTH], hash[RIPEMD160_DIGEST_LENGTH];
+  uint8_t hasher_hash[HASHER_DIGEST_LENGTH];
+  for (size_t i = 0; i < sizeof(data); i++) {
+    data[i] = i * 13;
+  }
+
+  for (size_t len = 0; len <= sizeof(data); len++) {
+    sha256_Raw(data, len, digest);
+    ripemd160(digest, sizeof(digest), expected);
+    ripemd160_32(digest, hash);
+    ck_assert_mem_eq(hash, expected, sizeof(hash));
+    hash160(data, len, hash);
+    ck_assert_mem_eq(hash, expected, sizeof(hash));
+    hasher_Raw(HASHER_SHA2_RIPEMD, data, len, hasher_hash);
+    ck_assert_mem_eq(hasher_hash, expected, sizeof(expected));
+  }
+
+  // the compressed public key of the first BIP-32 test vector
+  hash160(fromhex("0339a36013301597daef41fbe593a02cc513d0b55527ec2df1050e2e8ff"
+                  "49c85c2"),
+          33, hash);
+  ck_assert_mem_eq(hash, fromhex("3442193e1bb70916e914552172cd4e2dbc9df811"),
+                   sizeof(hash));
+}
+END_TEST
+
+START_TEST(test_poly1305) { ck_assert_int_eq(poly1305_power_on_self_test(), 1); }
+END_TEST
+
+START_TEST(test_chacha20_blocks) {
+  // the multi-block path must produce the same keystream as single blocks
+  uint8_t key[32], iv[8], whole[1000], pieces[1000];
+  for (size_t i = 0; i < sizeof(key); i++) key[i] = i;
+  for (size_t i = 0; i < sizeof(iv); i++) iv[i] = 0xf0 + i;
+  ECRYPT_ctx ctx;
+  ECRYPT_keysetup(&ctx, key, 256, 64);
+  ECRYPT_ivsetup(&ctx, iv);
+  ctx.input[12] = 0xfffffffe;
+  ECRYPT_keystream_bytes(&ctx, whole, sizeof(whole));
+  ECRYPT_keysetup(&ctx, key, 256, 64);
+  ECRYPT_ivsetup(&ctx, iv);
+  ctx.input[12] = 0xfffffffe;
+  for (size_t i = 0; i < sizeof(pieces); i += 64) {
+    size_t len = sizeof(pieces) - i < 64 ? sizeof(pieces) - i : 64;
+    ECRYPT_keystream_bytes(&ctx, pieces + i, len);
+  }
+  ck_assert_mem_eq(whole, pieces, sizeof(whole));
+}
+END_TEST
+
 START_TEST(test_chacha_drbg) {
   char entropy[] = "8a09b482de30c12ee1d2eb69dd49753d4252b3d36128ee1e";
   char reseed[] = "9ec4b991f939dbb44355392d05cd793a2e281809d2ed7139";
@@ -4912,6 +5394,43 @@ START_TEST(test_mnemonic) {
 }
 END_TEST
 
+START_TEST(test_mnemonic_to_seed_batch) {
+  static const char *mnemonics[] = {
+      "abandon abandon abandon abandon abandon abandon abandon abandon "
+      "abandon abandon abandon about",
+      "all all all all all all all all all all all all",
+      "legal winner thank year wave sausage worth useful legal winner thank "
+      "yellow",
+      "letter advice cage absurd amount doctor acoustic avoid letter advice "
+      "cage above",
+      "zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo wrong",
+      "all all all all all all all all all all all all",
+      "abandon abandon abandon abandon abandon abandon abandon abandon "
+      "abandon abandon abandon about",
+  };
+  static const char *passphrases[] = {
+      "TREZOR", "", "TREZOR", "testing", "", "testing", "",
+  };
+  uint8_t seeds[7][512 / 8], seed[512 / 8];
+
+  // 7 seeds go through 4 and 2 lanes and a single one
+  for (size_t n = 0; n <= 7; n += 7) {
+    memset(seeds, 0, sizeof(seeds));
+    mnemonic_to_seed_batch(mnemonics, passphrases, n, seeds);
+    for (size_t i = 0; i < n; i++) {
+      mnemonic_to_seed(mnemonics[i], passphrases[i], seed, 0);
+      ck_assert_mem_eq(seeds[i], seed, sizeof(seed));
+    }
+  }
+  mnemonic_to_seed_batch(mnemonics, passphrases, 1, seeds);
+  ck_assert_mem_eq(seeds[0],
+                   fromhex("c55257c360c07c72029aebc1b53c05ed0362ada38ead3e3e9efa"
+                           "3708e53495531f09a6987599d18264c1e1c92f2cf141630c7a3c"
+                           "4ab7c81b2f001698e7463b04"),
+                   sizeof(seed));
+}
+END_TEST
+
 START_TEST(test_mnemonic_check) {
   static const char *vectors_ok[] = {
       "abandon abandon abandon abandon abandon abandon abandon abandon abandon "
@@ -5202,6 +5721,39 @@ START_TEST(test_mnemonic_find_word) {
 }
 END_TEST
 
+START_TEST(test_mnemonic_complete_word) {
+  char prefix[4] = {0};
+  ck_assert_str_eq(mnemonic_complete_word(prefix, 0), "abandon");
+  ck_assert_int_eq(mnemonic_word_completion_mask(prefix, 0), 0x3ffffff);
+  // compare the indexed lookups with a linear scan of the wordlist
+  for (int len = 1; len <= 3; len++) {
+    int count = len == 1 ? 26 : len == 2 ? 26 * 26 : 26 * 26 * 26;
+    for (int n = 0; n < count; n++) {
+      for (int i = 0, m = n; i < len; i++, m /= 26) {
+        prefix[len - 1 - i] = 'a' + m % 26;
+      }
+      const char *first = NULL;
+      uint32_t mask = 0;
+      for (int i = 0; i < BIP39_WORDS; i++) {
+        const char *word = mnemonic_get_word(i);
+        if (strncmp(word, prefix, len) == 0) {
+          if (first == NULL) {
+            first = word;
+          }
+          if (word[len] != 0) {
+            mask |= 1 << (word[len] - 'a');
+          }
+        }
+      }
+      ck_assert_ptr_eq(mnemonic_complete_word(prefix, len), first);
+      ck_assert_int_eq(mnemonic_word_completion_mask(prefix, len), mask);
+    }
+  }
+  ck_assert_ptr_eq(mnemonic_complete_word("A", 1), NULL);
+  ck_assert_int_eq(mnemonic_word_completion_mask("a1", 2), 0);
+}
+END_TEST
+
 START_TEST(test_slip39_get_word) {
   static const struct {
     const int index;
@@ -5276,6 +5828,17 @@ START_TEST(test_slip39_compute_mask) {
 }
 END_TEST
 
+START_TEST(test_slip39_compute_mask_all) {
+  // compare the precomputed masks with a scan of the sequences
+  for (uint16_t prefix = 1; prefix < 1000; prefix++) {
+    if (prefix % 10 == 0 || (prefix >= 100 && (prefix / 10) % 10 == 0)) {
+      continue;
+    }
+    ck_assert_int_eq(compute_mask(prefix), find(prefix, false));
+  }
+}
+END_TEST
+
 START_TEST(test_slip39_sequence_to_word) {
   static const struct {
     const uint16_t prefix;
@@ -5292,6 +5855,58 @@ START_TEST(test_slip39_sequence_to_word) {
 }
 END_TEST
 
+START_TEST(test_slip39_rs1024) {
+  // "duckling enlarge academic academic agency result length solution fridge
+  // kidney coal piece deal husband erode duke ajar critical decision keyboard"
+  uint16_t data[20];
+  static const char *words[20] = {
+      "duckling", "enlarge", "academic", "academic", "agency",
+      "result",   "length",  "solution", "fridge",   "kidney",
+      "coal",     "piece",   "deal",     "husband",  "erode",
+      "duke",     "ajar",    "critical", "decision", "keyboard"};
+  for (size_t i = 0; i < 20; i++) {
+    ck_assert(word_index(&data[i], words[i], strlen(words[i])));
+  }
+  ck_assert(rs1024_verify_checksum(data, 20));
+
+  uint16_t checksum[3];
+  memcpy(checksum, data + 17, sizeof(checksum));
+  rs1024_create_checksum(data, 20);
+  ck_assert_mem_eq(data + 17, checksum, sizeof(checksum));
+
+  for (size_t i = 0; i < 20; i++) {
+    data[i] ^= 1;
+    ck_assert(!rs1024_verify_checksum(data, 20));
+    data[i] ^= 1;
+  }
+}
+END_TEST
+
+START_TEST(test_slip39_encrypt) {
+  // the first vector of the SLIP-39 test vectors, with passphrase "TREZOR"
+  // and the identifier and iteration exponent of its mnemonic
+  const uint8_t *ems = fromhex("11bc609d21747c49ba78c0701293e417");
+  uint8_t ms[16], out[16];
+  ck_assert(slip39_decrypt(ems, 16, (const uint8_t *)"TREZOR", 6, 0, 7945,
+                           ms));
+  ck_assert_mem_eq(ms, fromhex("bb54aac4b89dc868ba37d9cc21b2cece"), 16);
+  ck_assert(slip39_encrypt(ms, 16, (const uint8_t *)"TREZOR", 6, 0, 7945,
+                           out));
+  ck_assert_mem_eq(out, fromhex("11bc609d21747c49ba78c0701293e417"), 16);
+
+  // a passphrase longer than the HMAC block is hashed into the key
+  static const uint8_t long_passphrase[100] = {0};
+  ck_assert(slip39_encrypt(ms, 16, long_passphrase, sizeof(long_passphrase), 1,
+                           0x7FFF, out));
+  ck_assert(slip39_decrypt(out, 16, long_passphrase, sizeof(long_passphrase),
+                           1, 0x7FFF, out));
+  ck_assert_mem_eq(out, ms, 16);
+
+  ck_assert(!slip39_decrypt(ems, 15, (const uint8_t *)"", 0, 0, 0, out));
+  ck_assert(!slip39_decrypt(ems, 16, (const uint8_t *)"", 0, 21, 0, out));
+}
+END_TEST
+
 START_TEST(test_shamir) {
 #define SHAMIR_MAX_COUNT 16
   static const struct {
@@ -5404,6 +6019,45 @@ START_TEST(test_shamir) {
 }
 END_TEST
 
+START_TEST(test_shamir_multi) {
+  uint8_t share_indices[4] = {3, 254, 255, 7};
+  uint8_t values[4][SHAMIR_MAX_LEN];
+  const uint8_t *share_values[4];
+  for (size_t i = 0; i < 4; ++i) {
+    for (size_t j = 0; j < SHAMIR_MAX_LEN; ++j) {
+      values[i][j] = i * 67 + j * 29 + 1;
+    }
+    share_values[i] = values[i];
+  }
+
+  // all x coordinates, including those of the shares, at once
+  uint8_t result_indices[16];
+  uint8_t results[16][SHAMIR_MAX_LEN];
+  uint8_t *result_ptrs[16];
+  for (size_t i = 0; i < 16; ++i) {
+    result_indices[i] = (i < 4) ? share_indices[i] : i * 13;
+    result_ptrs[i] = results[i];
+  }
+  ck_assert(shamir_interpolate_multi(result_ptrs, result_indices, 16,
+                                     share_indices, share_values, 4,
+                                     SHAMIR_MAX_LEN));
+  for (size_t i = 0; i < 16; ++i) {
+    uint8_t result[SHAMIR_MAX_LEN];
+    ck_assert(shamir_interpolate(result, result_indices[i], share_indices,
+                                 share_values, 4, SHAMIR_MAX_LEN));
+    ck_assert_mem_eq(results[i], result, SHAMIR_MAX_LEN);
+    if (i < 4) {
+      ck_assert_mem_eq(results[i], values[i], SHAMIR_MAX_LEN);
+    }
+  }
+
+  share_indices[3] = share_indices[0];
+  ck_assert(!shamir_interpolate_multi(result_ptrs, result_indices, 16,
+                                      share_indices, share_values, 4,
+                                      SHAMIR_MAX_LEN));
+}
+END_TEST
+
 START_TEST(test_address) {
   char address[36];
   uint8_t pub_key[65];
@@ -5716,6 +6370,41 @@ START_TEST(test_pubkey_uncompress) {
 }
 END_TEST
 
+START_TEST(test_pubkey_read_cache) {
+  const ecdsa_curve *curves[] = {&secp256k1, &nist256p1};
+  uint8_t pub_key[33];
+  curve_point pub, expected;
+  bignum256 k;
+
+  // more keys than the cache holds, each read twice and in both parities
+  for (size_t c = 0; c < 2; c++) {
+    const ecdsa_curve *curve = curves[c];
+    for (uint32_t n = 1; n <= 3 * PUBKEY_CACHE_SIZE; n++) {
+      bn_read_uint32(n * 7919, &k);
+      point_multiply(curve, &k, &curve->G, &expected);
+      compress_coords(&expected, pub_key);
+      for (int r = 0; r < 2; r++) {
+        ck_assert_int_eq(ecdsa_read_pubkey(curve, pub_key, &pub), 1);
+        ck_assert_int_eq(bn_is_equal(&pub.x, &expected.x), 1);
+        ck_assert_int_eq(bn_is_equal(&pub.y, &expected.y), 1);
+      }
+      pub_key[0] ^= 1;
+      ck_assert_int_eq(ecdsa_read_pubkey(curve, pub_key, &pub), 1);
+      bn_subtract(&curve->prime, &expected.y, &expected.y);
+      ck_assert_int_eq(bn_is_equal(&pub.y, &expected.y), 1);
+    }
+  }
+
+  // an x without a point is rejected every time
+  memcpy(pub_key,
+         fromhex("0200000000000000000000000000000000000000000000000000000000"
+                 "00000005"),
+         33);
+  ck_assert_int_eq(ecdsa_read_pubkey(&secp256k1, pub_key, &pub), 0);
+  ck_assert_int_eq(ecdsa_read_pubkey(&secp256k1, pub_key, &pub), 0);
+}
+END_TEST
+
 START_TEST(test_wif) {
   uint8_t priv_key[32];
   char wif[53];
@@ -5977,13 +6666,18 @@ static void test_codepoints_curve(const ecdsa_curve *curve) {
   int i, j;
   bignum256 a;
   curve_point p, p1;
-  for (i = 0; i < 64; i++) {
-    for (j = 0; j < 8; j++) {
+  for (i = 0; i < CP_POSITIONS; i++) {
+    for (j = 0; j < CP_ENTRIES; j++) {
+      int bit = USE_PRECOMPUTED_CP_WINDOW * i;
+      uint64_t shifted = (uint64_t)(2 * j + 1) << (bit % BN_BITS_PER_LIMB);
       bn_zero(&a);
-      a.val[(4 * i) / BN_BITS_PER_LIMB] = (uint32_t)(2 * j + 1)
-                                          << (4 * i % BN_BITS_PER_LIMB);
-      bn_normalize(&a);
-      // note that this is not a trivial test.  We add 64 curve
+      a.val[bit / BN_BITS_PER_LIMB] = shifted & BN_LIMB_MASK;
+      if (bit / BN_BITS_PER_LIMB + 1 < BN_LIMBS) {
+        a.val[bit / BN_BITS_PER_LIMB + 1] = shifted >> BN_BITS_PER_LIMB;
+      }
+      bn_fast_mod(&a, &curve->order);
+      bn_mod(&a, &curve->order);
+      // note that this is not a trivial test.  We add CP_POSITIONS curve
       // points in the table to get that particular curve point.
       scalar_multiply(curve, &a, &p);
       ck_assert_mem_eq(&p, &curve->cp[i][j], sizeof(curve_point));
@@ -5995,7 +6689,7 @@ static void test_codepoints_curve(const ecdsa_curve *curve) {
       bn_mod(&a, &curve->order);
       p1 = curve->cp[i][j];
       point_double(curve, &p1);
-      // note that this is not a trivial test.  We add 64 curve
+      // note that this is not a trivial test.  We add CP_POSITIONS curve
       // points in the table to get that particular curve point.
       scalar_multiply(curve, &a, &p);
       ck_assert_mem_eq(&p, &p1, sizeof(curve_point));
@@ -6123,6 +6817,79 @@ END_TEST
 START_TEST(test_point_mult_nist256p1) { test_point_mult_curve(&nist256p1); }
 END_TEST
 
+static void test_point_mult_double_curve(const ecdsa_curve *curve) {
+  int i;
+  // get two "random" numbers and a "random" point
+  bignum256 a = curve->G.x;
+  bignum256 b = curve->G.y;
+  curve_point p = curve->G;
+  curve_point p1, p2, p3;
+  for (i = 0; i < 200; i++) {
+    /* test aG + bP and aP + bG against separate multiplications */
+    bn_mod(&a, &curve->order);
+    bn_mod(&b, &curve->order);
+    scalar_multiply(curve, &a, &p1);
+    point_multiply(curve, &b, &p, &p2);
+    point_add(curve, &p1, &p2);
+    point_multiply_double(curve, &a, &curve->G, &b, &p, &p3);
+    ck_assert_mem_eq(&p2, &p3, sizeof(curve_point));
+
+    point_multiply(curve, &a, &p, &p1);
+    scalar_multiply(curve, &b, &p2);
+    point_add(curve, &p1, &p2);
+    point_multiply_double(curve, &a, &p, &b, &curve->G, &p3);
+    ck_assert_mem_eq(&p2, &p3, sizeof(curve_point));
+
+    // new "random" numbers and a "random" point
+    a = p1.x;
+    b = p3.y;
+    p = p3;
+  }
+
+  // aG + a(-G) == infinity
+  p = curve->G;
+  bn_subtract(&curve->prime, &p.y, &p.y);
+  point_multiply_double(curve, &a, &curve->G, &a, &p, &p3);
+  ck_assert(point_is_infinity(&p3));
+
+  // 0G + bP == bP
+  bn_zero(&a);
+  point_multiply(curve, &b, &p, &p2);
+  point_multiply_double(curve, &a, &curve->G, &b, &p, &p3);
+  ck_assert_mem_eq(&p2, &p3, sizeof(curve_point));
+
+  // bG + bG == 2bG
+  scalar_multiply(curve, &b, &p2);
+  point_double(curve, &p2);
+  point_multiply_double(curve, &b, &curve->G, &b, &curve->G, &p3);
+  ck_assert_mem_eq(&p2, &p3, sizeof(curve_point));
+
+  // 0G + kP == kP for scalars k close to 1, order / 2 and order
+  bignum256 k[5];
+  bn_one(&k[0]);
+  bn_subtract(&curve->order, &k[0], &k[1]);
+  k[2] = curve->order_half;
+  k[3] = curve->order_half;
+  bn_addi(&k[3], 1);
+  bn_read_uint32(2, &k[4]);
+  for (i = 0; i < 5; i++) {
+    point_multiply(curve, &k[i], &p, &p2);
+    point_multiply_double(curve, &a, &curve->G, &k[i], &p, &p3);
+    ck_assert_mem_eq(&p2, &p3, sizeof(curve_point));
+    point_multiply_double(curve, &k[i], &p, &a, &curve->G, &p3);
+    ck_assert_mem_eq(&p2, &p3, sizeof(curve_point));
+  }
+}
+
+START_TEST(test_point_mult_double_secp256k1) {
+  test_point_mult_double_curve(&secp256k1);
+}
+END_TEST
+START_TEST(test_point_mult_double_nist256p1) {
+  test_point_mult_double_curve(&nist256p1);
+}
+END_TEST
+
 static void test_scalar_point_mult_curve(const ecdsa_curve *curve) {
   int i;
   // get two "random" numbers
@@ -6164,6 +6931,232 @@ START_TEST(test_scalar_point_mult_nist256p1) {
 }
 END_TEST
 
+static void test_ecdsa_verify_batch_curve(const ecdsa_curve *curve) {
+#define BATCH_TEST_SIZE 20
+  uint8_t priv_key[32], pub_key[BATCH_TEST_SIZE][33];
+  uint8_t sig[BATCH_TEST_SIZE][64], digest[BATCH_TEST_SIZE][32];
+  const uint8_t *pub_keys[BATCH_TEST_SIZE], *sigs[BATCH_TEST_SIZE],
+      *digests[BATCH_TEST_SIZE];
+  int i, res;
+
+  memcpy(priv_key, curve->G.x.val, 32);
+  for (i = 0; i < BATCH_TEST_SIZE; i++) {
+    // use only four distinct keys for the batch
+    priv_key[31] = i % 4 + 1;
+    ecdsa_get_public_key33(curve, priv_key, pub_key[i]);
+    sha256_Raw(priv_key, 32, digest[i]);
+    digest[i][0] = i;
+    res = ecdsa_sign_digest(curve, priv_key, digest[i], sig[i], NULL, NULL);
+    ck_assert_int_eq(res, 0);
+    pub_keys[i] = pub_key[i];
+    sigs[i] = sig[i];
+    digests[i] = digest[i];
+  }
+
+  res = ecdsa_verify_digest_batch(curve, BATCH_TEST_SIZE, pub_keys, sigs,
+                                  digests);
+  ck_assert_int_eq(res, 0);
+  res = ecdsa_verify_digest_batch(curve, 0, pub_keys, sigs, digests);
+  ck_assert_int_eq(res, 0);
+
+  // wrong digest
+  digest[13][5] ^= 1;
+  res = ecdsa_verify_digest_batch(curve, BATCH_TEST_SIZE, pub_keys, sigs,
+                                  digests);
+  ck_assert_int_eq(res, 14);
+  digest[13][5] ^= 1;
+
+  // signature from another key
+  pub_keys[2] = pub_key[3];
+  res = ecdsa_verify_digest_batch(curve, BATCH_TEST_SIZE, pub_keys, sigs,
+                                  digests);
+  ck_assert_int_eq(res, 3);
+  pub_keys[2] = pub_key[2];
+
+  // s out of range
+  memset(sig[19] + 32, 0xff, 32);
+  res = ecdsa_verify_digest_batch(curve, BATCH_TEST_SIZE, pub_keys, sigs,
+                                  digests);
+  ck_assert_int_eq(res, 20);
+  res = ecdsa_verify_digest_batch(curve, BATCH_TEST_SIZE - 1, pub_keys, sigs,
+                                  digests);
+  ck_assert_int_eq(res, 0);
+#undef BATCH_TEST_SIZE
+}
+
+START_TEST(test_ecdsa_verify_batch_secp256k1) {
+  test_ecdsa_verify_batch_curve(&secp256k1);
+}
+END_TEST
+START_TEST(test_ecdsa_verify_batch_nist256p1) {
+  test_ecdsa_verify_batch_curve(&nist256p1);
+}
+END_TEST
+
+static void test_ecdsa_recover_batch_curve(const ecdsa_curve *curve) {
+#define BATCH_TEST_SIZE 20
+  uint8_t priv_key[32], pub_key[65], recovered[BATCH_TEST_SIZE][65];
+  uint8_t sig[BATCH_TEST_SIZE][64], digest[BATCH_TEST_SIZE][32];
+  const uint8_t *sigs[BATCH_TEST_SIZE], *digests[BATCH_TEST_SIZE];
+  int recids[BATCH_TEST_SIZE];
+  uint8_t by;
+  int i, res;
+
+  memcpy(priv_key, curve->G.x.val, 32);
+  for (i = 0; i < BATCH_TEST_SIZE; i++) {
+    priv_key[31] = i + 1;
+    sha256_Raw(priv_key, 32, digest[i]);
+    res = ecdsa_sign_digest(curve, priv_key, digest[i], sig[i], &by, NULL);
+    ck_assert_int_eq(res, 0);
+    sigs[i] = sig[i];
+    digests[i] = digest[i];
+    recids[i] = by;
+  }
+
+  ck_assert_uint_eq(ecdsa_recover_pub_from_sig_batch(curve, BATCH_TEST_SIZE,
+                                                     recovered[0], sigs,
+                                                     digests, recids),
+                    BATCH_TEST_SIZE);
+  for (i = 0; i < BATCH_TEST_SIZE; i++) {
+    priv_key[31] = i + 1;
+    ecdsa_get_public_key65(curve, priv_key, pub_key);
+    ck_assert_mem_eq(recovered[i], pub_key, 65);
+    res = ecdsa_recover_pub_from_sig(curve, pub_key, sig[i], digest[i],
+                                     recids[i]);
+    ck_assert_int_eq(res, 0);
+    ck_assert_mem_eq(recovered[i], pub_key, 65);
+  }
+
+  // r out of range and the other parity of R
+  memset(sig[3], 0xff, 32);
+  recids[7] ^= 1;
+  ck_assert_uint_eq(ecdsa_recover_pub_from_sig_batch(curve, BATCH_TEST_SIZE,
+                                                     recovered[0], sigs,
+                                                     digests, recids),
+                    BATCH_TEST_SIZE - 1);
+  memset(pub_key, 0, 65);
+  ck_assert_mem_eq(recovered[3], pub_key, 65);
+  ck_assert_int_eq(ecdsa_recover_pub_from_sig(curve, pub_key, sig[7],
+                                              digest[7], recids[7]),
+                   0);
+  ck_assert_mem_eq(recovered[7], pub_key, 65);
+  priv_key[31] = 8;
+  ecdsa_get_public_key65(curve, priv_key, pub_key);
+  ck_assert_mem_ne(recovered[7], pub_key, 65);
+#undef BATCH_TEST_SIZE
+}
+
+START_TEST(test_ecdsa_recover_batch_secp256k1) {
+  test_ecdsa_recover_batch_curve(&secp256k1);
+}
+END_TEST
+START_TEST(test_ecdsa_recover_batch_nist256p1) {
+  test_ecdsa_recover_batch_curve(&nist256p1);
+}
+END_TEST
+
+START_TEST(test_bip340) {
+  // test vector 0 from
+  // https://github.com/bitcoin/bips/blob/master/bip-0340/test-vectors.csv
+  uint8_t priv_key[32], pub_key[32], digest[32], aux_rand[32], sig[64];
+
+  memset(priv_key, 0, 32);
+  priv_key[31] = 3;
+  memset(digest, 0, 32);
+  memset(aux_rand, 0, 32);
+
+  ck_assert_int_eq(bip340_get_public_key(&secp256k1, priv_key, pub_key), 0);
+  ck_assert_mem_eq(
+      pub_key,
+      fromhex(
+          "F9308A019258C31049344F85F89D5229B531C845836F99B08601F113BCE036F9"),
+      32);
+  ck_assert_int_eq(
+      bip340_sign_digest(&secp256k1, priv_key, digest, aux_rand, sig), 0);
+  ck_assert_mem_eq(
+      sig,
+      fromhex(
+          "E907831F80848D1069A5371B402410364BDF1C5F8307B0084C55F1CE2DCA8215"
+          "25F66A4A85EA8B71E482A74F382D2CE5EBEEE8FDB2172F477DF4900D310536C0"),
+      64);
+  ck_assert_int_eq(bip340_verify_digest(&secp256k1, pub_key, sig, digest), 0);
+
+  digest[31] ^= 1;
+  ck_assert_int_ne(bip340_verify_digest(&secp256k1, pub_key, sig, digest), 0);
+  digest[31] ^= 1;
+
+  // invalid private keys
+  memset(priv_key, 0, 32);
+  ck_assert_int_ne(bip340_get_public_key(&secp256k1, priv_key, pub_key), 0);
+  ck_assert_int_ne(
+      bip340_sign_digest(&secp256k1, priv_key, digest, NULL, sig), 0);
+  bn_write_be(&secp256k1.order, priv_key);
+  ck_assert_int_ne(bip340_get_public_key(&secp256k1, priv_key, pub_key), 0);
+}
+END_TEST
+
+START_TEST(test_bip340_verify_batch) {
+#define BATCH_TEST_SIZE 20
+  uint8_t priv_key[32], pub_key[BATCH_TEST_SIZE][32];
+  uint8_t sig[BATCH_TEST_SIZE][64], digest[BATCH_TEST_SIZE][32];
+  const uint8_t *pub_keys[BATCH_TEST_SIZE], *sigs[BATCH_TEST_SIZE],
+      *digests[BATCH_TEST_SIZE];
+  int i, res;
+
+  memcpy(priv_key, secp256k1.G.x.val, 32);
+  for (i = 0; i < BATCH_TEST_SIZE; i++) {
+    // use only four distinct keys for the batch
+    priv_key[31] = i % 4 + 1;
+    ck_assert_int_eq(bip340_get_public_key(&secp256k1, priv_key, pub_key[i]),
+                     0);
+    sha256_Raw(priv_key, 32, digest[i]);
+    digest[i][0] = i;
+    res = bip340_sign_digest(&secp256k1, priv_key, digest[i], NULL, sig[i]);
+    ck_assert_int_eq(res, 0);
+    pub_keys[i] = pub_key[i];
+    sigs[i] = sig[i];
+    digests[i] = digest[i];
+  }
+
+  res = bip340_verify_digest_batch(&secp256k1, BATCH_TEST_SIZE, pub_keys,
+                                   sigs, digests);
+  ck_assert_int_eq(res, 0);
+  res = bip340_verify_digest_batch(&secp256k1, 0, pub_keys, sigs, digests);
+  ck_assert_int_eq(res, 0);
+
+  // wrong digest
+  digest[13][5] ^= 1;
+  res = bip340_verify_digest_batch(&secp256k1, BATCH_TEST_SIZE, pub_keys,
+                                   sigs, digests);
+  ck_assert_int_eq(res, 14);
+  digest[13][5] ^= 1;
+
+  // signature from another key
+  pub_keys[2] = pub_key[3];
+  res = bip340_verify_digest_batch(&secp256k1, BATCH_TEST_SIZE, pub_keys,
+                                   sigs, digests);
+  ck_assert_int_eq(res, 3);
+  pub_keys[2] = pub_key[2];
+
+  // wrong s
+  sig[6][40] ^= 1;
+  res = bip340_verify_digest_batch(&secp256k1, BATCH_TEST_SIZE, pub_keys,
+                                   sigs, digests);
+  ck_assert_int_eq(res, 7);
+  sig[6][40] ^= 1;
+
+  // s out of range
+  memset(sig[19] + 32, 0xff, 32);
+  res = bip340_verify_digest_batch(&secp256k1, BATCH_TEST_SIZE, pub_keys,
+                                   sigs, digests);
+  ck_assert_int_eq(res, 20);
+  res = bip340_verify_digest_batch(&secp256k1, BATCH_TEST_SIZE - 1, pub_keys,
+                                   sigs, digests);
+  ck_assert_int_eq(res, 0);
+#undef BATCH_TEST_SIZE
+}
+END_TEST
+
 START_TEST(test_ed25519) {
   // test vectors from
   // https://github.com/torproject/tor/blob/master/src/test/ed25519_vectors.inc
@@ -6258,6 +7251,51 @@ END_TEST
 
 // test vectors from
 // https://raw.githubusercontent.com/NemProject/nem-test-vectors/master/2.test-sign.dat
+// test vectors from RFC 7748, section 6.1
+START_TEST(test_curve25519_rfc7748) {
+  static const uint8_t basepoint[32] = {9};
+  uint8_t alice_sk[32], alice_pk[32], bob_sk[32], bob_pk[32];
+  uint8_t result[32];
+
+  memcpy(alice_sk,
+         fromhex(
+             "77076d0a7318a57d3c16c17251b26645df4c2f87ebc0992ab177fba51db92c2a"),
+         32);
+  memcpy(alice_pk,
+         fromhex(
+             "8520f0098930a754748b7ddcb43ef75a0dbf3a0d26381af4eba4a98eaa9b4e6a"),
+         32);
+  memcpy(bob_sk,
+         fromhex(
+             "5dab087e624a8a4b79e17f8b83800ee66f3bb1292618b6fd1c2f8b27ff88e0eb"),
+         32);
+  memcpy(bob_pk,
+         fromhex(
+             "de9edb7d7b7dc1b4d35b61c2ece435373f8343c85b78674dadfc7e146f882b4f"),
+         32);
+
+  curve25519_scalarmult_basepoint(result, alice_sk);
+  ck_assert_mem_eq(result, alice_pk, 32);
+  curve25519_scalarmult(result, alice_sk, basepoint);
+  ck_assert_mem_eq(result, alice_pk, 32);
+  curve25519_scalarmult_basepoint(result, bob_sk);
+  ck_assert_mem_eq(result, bob_pk, 32);
+
+  curve25519_scalarmult(result, alice_sk, bob_pk);
+  ck_assert_mem_eq(
+      result,
+      fromhex(
+          "4a5d9d5ba4ce2de1728e3bf480350f25e07e21c947d19e3376f09b3c1e161742"),
+      32);
+  curve25519_scalarmult(result, bob_sk, alice_pk);
+  ck_assert_mem_eq(
+      result,
+      fromhex(
+          "4a5d9d5ba4ce2de1728e3bf480350f25e07e21c947d19e3376f09b3c1e161742"),
+      32);
+}
+END_TEST
+
 START_TEST(test_ed25519_keccak) {
   static const struct {
     const char *private_key;
@@ -6528,6 +7566,143 @@ START_TEST(test_ed25519_cosi) {
 }
 END_TEST
 
+static void test_ed25519_batch_variant(
+    void (*publickey)(const ed25519_secret_key, ed25519_public_key),
+    void (*sign)(const unsigned char *, size_t, const ed25519_secret_key,
+                 const ed25519_public_key, ed25519_signature),
+    int (*sign_open_batch)(const unsigned char *const *, const size_t *,
+                           const unsigned char *const *,
+                           const unsigned char *const *, size_t, int *)) {
+#define BATCH_TEST_SIZE 21
+  ed25519_secret_key sk;
+  ed25519_public_key pk[BATCH_TEST_SIZE];
+  ed25519_signature sig[BATCH_TEST_SIZE];
+  uint8_t msg[BATCH_TEST_SIZE][40];
+  const unsigned char *msgs[BATCH_TEST_SIZE];
+  const unsigned char *pks[BATCH_TEST_SIZE];
+  const unsigned char *sigs[BATCH_TEST_SIZE];
+  size_t msglen[BATCH_TEST_SIZE];
+  int valid[BATCH_TEST_SIZE];
+  int res;
+
+  for (int i = 0; i < BATCH_TEST_SIZE; i++) {
+    memset(sk, i + 1, sizeof(sk));
+    publickey(sk, pk[i]);
+    msglen[i] = i % 2 ? sizeof(msg[i]) : (size_t)i;
+    memset(msg[i], 0x5a ^ i, sizeof(msg[i]));
+    sign(msg[i], msglen[i], sk, pk[i], sig[i]);
+    msgs[i] = msg[i];
+    pks[i] = pk[i];
+    sigs[i] = sig[i];
+  }
+
+  res = sign_open_batch(msgs, msglen, pks, sigs, BATCH_TEST_SIZE, valid);
+  ck_assert_int_eq(res, 0);
+  for (int i = 0; i < BATCH_TEST_SIZE; i++) {
+    ck_assert_int_eq(valid[i], 1);
+  }
+  res = sign_open_batch(msgs, msglen, pks, sigs, 0, valid);
+  ck_assert_int_eq(res, 0);
+
+  // wrong message, signature from another key, S out of range, bad R
+  msg[3][0] ^= 1;
+  pks[9] = pk[10];
+  memset(sig[17] + 32, 0xff, 32);
+  sig[20][0] ^= 1;
+  res = sign_open_batch(msgs, msglen, pks, sigs, BATCH_TEST_SIZE, valid);
+  ck_assert_int_eq(res, -1);
+  for (int i = 0; i < BATCH_TEST_SIZE; i++) {
+    ck_assert_int_eq(valid[i], i != 3 && i != 9 && i != 17 && i != 20);
+  }
+  res = sign_open_batch(msgs + 4, msglen + 4, pks + 4, sigs + 4, 5, valid);
+  ck_assert_int_eq(res, 0);
+
+#undef BATCH_TEST_SIZE
+}
+
+START_TEST(test_ed25519_batch) {
+  test_ed25519_batch_variant(ed25519_publickey, ed25519_sign,
+                             ed25519_sign_open_batch);
+  test_ed25519_batch_variant(ed25519_publickey_keccak, ed25519_sign_keccak,
+                             ed25519_sign_open_batch_keccak);
+  test_ed25519_batch_variant(ed25519_publickey_sha3, ed25519_sign_sha3,
+                             ed25519_sign_open_batch_sha3);
+
+  // R = (0, 1) with the sign bit set and S = H(R,A,m) a satisfy the batch
+  // equation, but ed25519_sign_open wants the canonical encoding of R
+  bignum256modm a, h, S;
+  ge25519 A;
+  ed25519_public_key pk;
+  ed25519_signature sig;
+  hash_512bits hash;
+  SHA512_CTX ctx;
+  const unsigned char *msgs[1] = {pk}, *pks[1] = {pk}, *sigs[1] = {sig};
+  size_t msglen[1] = {sizeof(pk)};
+  int valid[1];
+
+  set256_modm(a, 0x123456789abcdefULL);
+  ge25519_scalarmult_base_niels(&A, ge25519_niels_base_multiples, a);
+  ge25519_pack(pk, &A);
+  memcpy(sig,
+         fromhex(
+             "0100000000000000000000000000000000000000000000000000000000000080"),
+         32);
+  sha512_Init(&ctx);
+  sha512_Update(&ctx, sig, 32);
+  sha512_Update(&ctx, pk, 32);
+  sha512_Update(&ctx, pk, 32);
+  sha512_Final(&ctx, hash);
+  expand256_modm(h, hash, 64);
+  mul256_modm(S, h, a);
+  contract256_modm(sig + 32, S);
+
+  ck_assert_int_eq(ed25519_sign_open(pk, sizeof(pk), pk, sig), -1);
+  ck_assert_int_eq(ed25519_sign_open_batch(msgs, msglen, pks, sigs, 1, valid),
+                   -1);
+  ck_assert_int_eq(valid[0], 0);
+
+  // R = (0, 1) and S = H(R,A,m) a is accepted by ed25519_sign_open, R = (0, -1)
+  // of order 2 is not, but makes the batch equation neutral for even z
+  static const char *small_order_r[2] = {
+      "0100000000000000000000000000000000000000000000000000000000000000",
+      "ecffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f",
+  };
+  const unsigned char *msgs8[8], *pks8[8], *sigs8[8];
+  ed25519_signature sig8[8];
+  uint8_t msg8[8][2];
+  size_t msglen8[8];
+  int valid8[8];
+  for (int r = 0; r < 2; r++) {
+    // several rounds, so that a batch with an even sum of z would show up
+    for (int round = 0; round < 16; round++) {
+      for (int i = 0; i < 8; i++) {
+        msg8[i][0] = round;
+        msg8[i][1] = i;
+        memcpy(sig8[i], fromhex(small_order_r[r]), 32);
+        sha512_Init(&ctx);
+        sha512_Update(&ctx, sig8[i], 32);
+        sha512_Update(&ctx, pk, 32);
+        sha512_Update(&ctx, msg8[i], sizeof(msg8[i]));
+        sha512_Final(&ctx, hash);
+        expand256_modm(h, hash, 64);
+        mul256_modm(S, h, a);
+        contract256_modm(sig8[i] + 32, S);
+        msgs8[i] = msg8[i];
+        msglen8[i] = sizeof(msg8[i]);
+        pks8[i] = pk;
+        sigs8[i] = sig8[i];
+        ck_assert_int_eq(ed25519_sign_open(msg8[i], 2, pk, sig8[i]), -r);
+      }
+      ck_assert_int_eq(
+          ed25519_sign_open_batch(msgs8, msglen8, pks8, sigs8, 8, valid8), -r);
+      for (int i = 0; i < 8; i++) {
+        ck_assert_int_eq(valid8[i], 1 - r);
+      }
+    }
+  }
+}
+END_TEST
+
 START_TEST(test_ed25519_modl_add) {
   char tests[][3][65] = {
       {
@@ -8774,8 +9949,11 @@ Suite *test_suite(void) {
   tcase_add_test(tc, test_bip32_vector_3);
   tcase_add_test(tc, test_bip32_compare);
   tcase_add_test(tc, test_bip32_optimized);
+  tcase_add_test(tc, test_bip32_optimized_batch);
   tcase_add_test(tc, test_bip32_cache_1);
   tcase_add_test(tc, test_bip32_cache_2);
+  tcase_add_test(tc, test_bip32_cache_roots);
+  tcase_add_test(tc, test_bip32_public_cache);
   suite_add_tcase(s, tc);
 
   tc = tcase_create("bip32-nist");
@@ -8836,12 +10014,14 @@ Suite *test_suite(void) {
 
   tc = tcase_create("aes");
   tcase_add_test(tc, test_aes);
+  tcase_add_test(tc, test_aes_ct);
   suite_add_tcase(s, tc);
 
   tc = tcase_create("sha2");
   tcase_add_test(tc, test_sha1);
   tcase_add_test(tc, test_sha256);
   tcase_add_test(tc, test_sha512);
+  tcase_add_test(tc, test_sha2_multi);
   suite_add_tcase(s, tc);
 
   tc = tcase_create("sha3");
@@ -8859,6 +10039,20 @@ Suite *test_suite(void) {
   tcase_add_test(tc, test_blake2s);
   suite_add_tcase(s, tc);
 
+  tc = tcase_create("groestl");
+  tcase_add_test(tc, test_groestl512);
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("hasher");
+  tcase_add_test(tc, test_hasher_midstate);
+  tcase_add_test(tc, test_hash160);
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("chacha20poly1305");
+  tcase_add_test(tc, test_poly1305);
+  tcase_add_test(tc, test_chacha20_blocks);
+  suite_add_tcase(s, tc);
+
   tc = tcase_create("chacha_drbg");
   tcase_add_test(tc, test_chacha_drbg);
   suite_add_tcase(s, tc);
@@ -8874,20 +10068,26 @@ Suite *test_suite(void) {
 
   tc = tcase_create("bip39");
   tcase_add_test(tc, test_mnemonic);
+  tcase_add_test(tc, test_mnemonic_to_seed_batch);
   tcase_add_test(tc, test_mnemonic_check);
   tcase_add_test(tc, test_mnemonic_to_entropy);
   tcase_add_test(tc, test_mnemonic_find_word);
+  tcase_add_test(tc, test_mnemonic_complete_word);
   suite_add_tcase(s, tc);
 
   tc = tcase_create("slip39");
   tcase_add_test(tc, test_slip39_get_word);
   tcase_add_test(tc, test_slip39_word_index);
   tcase_add_test(tc, test_slip39_compute_mask);
+  tcase_add_test(tc, test_slip39_rs1024);
+  tcase_add_test(tc, test_slip39_encrypt);
+  tcase_add_test(tc, test_slip39_compute_mask_all);
   tcase_add_test(tc, test_slip39_sequence_to_word);
   suite_add_tcase(s, tc);
 
   tc = tcase_create("shamir");
   tcase_add_test(tc, test_shamir);
+  tcase_add_test(tc, test_shamir_multi);
   suite_add_tcase(s, tc);
 
   tc = tcase_create("pubkey_validity");
@@ -8896,6 +10096,7 @@ Suite *test_suite(void) {
 
   tc = tcase_create("pubkey_uncompress");
   tcase_add_test(tc, test_pubkey_uncompress);
+  tcase_add_test(tc, test_pubkey_read_cache);
   suite_add_tcase(s, tc);
 
   tc = tcase_create("codepoints");
@@ -8918,11 +10119,31 @@ Suite *test_suite(void) {
   tcase_add_test(tc, test_point_mult_nist256p1);
   suite_add_tcase(s, tc);
 
+  tc = tcase_create("point_mult_double");
+  tcase_add_test(tc, test_point_mult_double_secp256k1);
+  tcase_add_test(tc, test_point_mult_double_nist256p1);
+  suite_add_tcase(s, tc);
+
   tc = tcase_create("scalar_point_mult");
   tcase_add_test(tc, test_scalar_point_mult_secp256k1);
   tcase_add_test(tc, test_scalar_point_mult_nist256p1);
   suite_add_tcase(s, tc);
 
+  tc = tcase_create("ecdsa_verify_batch");
+  tcase_add_test(tc, test_ecdsa_verify_batch_secp256k1);
+  tcase_add_test(tc, test_ecdsa_verify_batch_nist256p1);
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("ecdsa_recover_batch");
+  tcase_add_test(tc, test_ecdsa_recover_batch_secp256k1);
+  tcase_add_test(tc, test_ecdsa_recover_batch_nist256p1);
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("bip340");
+  tcase_add_test(tc, test_bip340);
+  tcase_add_test(tc, test_bip340_verify_batch);
+  suite_add_tcase(s, tc);
+
   tc = tcase_create("ed25519");
   tcase_add_test(tc, test_ed25519);
   suite_add_tcase(s, tc);
@@ -8935,6 +10156,14 @@ Suite *test_suite(void) {
   tcase_add_test(tc, test_ed25519_cosi);
   suite_add_tcase(s, tc);
 
+  tc = tcase_create("ed25519_batch");
+  tcase_add_test(tc, test_ed25519_batch);
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("curve25519");
+  tcase_add_test(tc, test_curve25519_rfc7748);
+  suite_add_tcase(s, tc);
+
   tc = tcase_create("ed25519_modm");
   tcase_add_test(tc, test_ed25519_modl_add);
   tcase_add_test(tc, test_ed25519_modl_neg);
@@ -9003,6 +10232,7 @@ Suite *test_suite(void) {
   tcase_add_test(tc, test_bip32_cardano_hdnode_vector_5);
   tcase_add_test(tc, test_bip32_cardano_hdnode_vector_6);
   tcase_add_test(tc, test_bip32_cardano_hdnode_vector_7);
+  tcase_add_test(tc, test_bip32_cardano_hdnode_batch);
 
   tcase_add_test(tc, test_ed25519_cardano_sign_vectors);
   suite_add_tcase(s, tc);
@@ -9033,6 +10263,7 @@ Suite *test_suite(void) {
   tc = tcase_create("xmr_xmr");
   tcase_add_test(tc, test_xmr_check_point);
   tcase_add_test(tc, test_xmr_h);
+  tcase_add_test(tc, test_xmr_scalarmult_h);
   tcase_add_test(tc, test_xmr_fast_hash);
   tcase_add_test(tc, test_xmr_hasher);
   tcase_add_test(tc, test_xmr_hash_to_scalar);
@@ -9043,6 +10274,7 @@ Suite *test_suite(void) {
   tcase_add_test(tc, test_xmr_derive_public_key);
   tcase_add_test(tc, test_xmr_add_keys2);
   tcase_add_test(tc, test_xmr_add_keys3);
+  tcase_add_test(tc, test_xmr_multi_scalarmult);
   tcase_add_test(tc, test_xmr_get_subaddress_secret_key);
   tcase_add_test(tc, test_xmr_gen_c);
   tcase_add_test(tc, test_xmr_varint);
@@ -382,3 +382,42 @@ START_TEST(test_bip32_cardano_hdnode_vector_7) {
       32);
 }
 END_TEST
+
+START_TEST(test_bip32_cardano_hdnode_batch) {
+  static const uint32_t first[] = {0x80000000, 0, 0x7FFFFFFD};
+  HDNode root, node, children[4];
+
+  uint8_t seed[66];
+  int seed_len = mnemonic_to_entropy(
+      "ring crime symptom enough erupt lady behave ramp apart settle citizen "
+      "junk",
+      seed);
+  ck_assert_int_eq(seed_len, 132);
+  hdnode_from_entropy_cardano_icarus((const uint8_t *)"", 0, seed, seed_len / 8,
+                                     &root);
+  hdnode_private_ckd_cardano(&root, 0x8000002C);
+
+  for (size_t i = 0; i < sizeof(first) / sizeof(*first); i++) {
+    ck_assert_int_eq(
+        hdnode_private_ckd_cardano_batch(&root, first[i], 3, children), 1);
+    for (size_t j = 0; j < 3; j++) {
+      memcpy(&node, &root, sizeof(HDNode));
+      hdnode_private_ckd_cardano(&node, first[i] + j);
+      hdnode_fill_public_key(&node);
+      ck_assert_uint_eq(children[j].depth, node.depth);
+      ck_assert_uint_eq(children[j].child_num, node.child_num);
+      ck_assert_mem_eq(children[j].chain_code, node.chain_code, 32);
+      ck_assert_mem_eq(children[j].private_key, node.private_key, 32);
+      ck_assert_mem_eq(children[j].private_key_extension,
+                       node.private_key_extension, 32);
+      ck_assert_mem_eq(children[j].public_key, node.public_key, 33);
+    }
+  }
+
+  // the children must not cross the hardened boundary
+  ck_assert_int_eq(
+      hdnode_private_ckd_cardano_batch(&root, 0x7FFFFFFD, 4, children), 0);
+  ck_assert_int_eq(
+      hdnode_private_ckd_cardano_batch(&root, 0xFFFFFFFE, 3, children), 0);
+}
+END_TEST
@@ -610,6 +610,23 @@ START_TEST(test_xmr_h) {
 }
 END_TEST
 
+START_TEST(test_xmr_scalarmult_h) {
+  bignum256modm s = {0};
+  ge25519 A, B;
+
+  for (int i = 0; i < 64; i++) {
+    if (i < 3) {
+      set256_modm(s, i);
+    } else {
+      xmr_random_scalar(s);
+    }
+    ge25519_scalarmult_h(&A, s);
+    ge25519_scalarmult(&B, &xmr_h, s);
+    ck_assert_int_eq(ge25519_eq(&A, &B), 1);
+  }
+}
+END_TEST
+
 START_TEST(test_xmr_fast_hash) {
   uint8_t hash[32];
   char tests[][2][65] = {
@@ -988,6 +1005,41 @@ START_TEST(test_xmr_add_keys3) {
 }
 END_TEST
 
+START_TEST(test_xmr_multi_scalarmult) {
+  static ge25519 points[300];
+  static bignum256modm scalars[300];
+  static uint8_t scratch[300 * (9 * sizeof(ge25519_pniels) + 64)];
+  static const size_t counts[] = {0, 1, 2, 17, 40, 300};
+  uint8_t buff[32] = {0};
+  ge25519 res, res_ct, res_exp, tmp;
+
+  ck_assert_int_eq(xmr_multi_scalarmult_scratch_size(300), sizeof(scratch));
+
+  for (size_t i = 0; i < 300; i++) {
+    xmr_fast_hash(buff, &i, sizeof(i));
+    xmr_hash_to_ec(&points[i], buff, sizeof(buff));
+    xmr_hash_to_scalar(scalars[i], buff, sizeof(buff));
+  }
+  set256_modm(scalars[0], 0);
+  set256_modm(scalars[1], 1);
+  sub256_modm(scalars[2], scalars[0], scalars[1]);
+
+  for (size_t k = 0; k < sizeof(counts) / sizeof(*counts); k++) {
+    ge25519_set_neutral(&res_exp);
+    for (size_t i = 0; i < counts[k]; i++) {
+      ge25519_scalarmult(&tmp, &points[i], scalars[i]);
+      ge25519_add(&res_exp, &res_exp, &tmp, 0);
+    }
+
+    xmr_multi_scalarmult_vartime(&res, points, scalars, counts[k]);
+    ck_assert_int_eq(ge25519_eq(&res, &res_exp), 1);
+
+    xmr_multi_scalarmult(&res_ct, points, scalars, counts[k], scratch);
+    ck_assert_int_eq(ge25519_eq(&res_ct, &res_exp), 1);
+  }
+}
+END_TEST
+
 START_TEST(test_xmr_get_subaddress_secret_key) {
   static const struct {
     uint32_t major, minor;
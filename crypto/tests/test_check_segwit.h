@@ -156,5 +156,28 @@ START_TEST(test_segwit) {
                                  invalid_address_enc[i].program_length);
     ck_assert_int_eq(ret, 0);
   }
+  {
+    uint8_t witprog[4][32];
+    const uint8_t* progs[4];
+    char rebuild[4][93], expected[93];
+    char* outputs[4];
+    for (i = 0; i < 4; ++i) {
+      memset(witprog[i], 0x11 * i + 1, sizeof(witprog[i]));
+      witprog[i][0] = i;
+      progs[i] = witprog[i];
+      outputs[i] = rebuild[i];
+    }
+    ck_assert_int_eq(segwit_addr_encode_many(outputs, "tb", 0, progs, 32, 4),
+                     1);
+    for (i = 0; i < 4; ++i) {
+      ck_assert_int_eq(segwit_addr_encode(expected, "tb", 0, witprog[i], 32),
+                       1);
+      ck_assert_str_eq(rebuild[i], expected);
+    }
+    ck_assert_int_eq(segwit_addr_encode_many(outputs, "tb", 0, progs, 33, 4),
+                     0);
+    ck_assert_int_eq(segwit_addr_encode_many(outputs, "Tb", 0, progs, 32, 4),
+                     0);
+  }
 }
 END_TEST
@@ -1,15 +1,39 @@
 #include <assert.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_CYCLES 1
+#else
+#define HAVE_CYCLES 0
+#endif
+#include "aes/aes.h"
+#include "aes/aes_ct.h"
+#include "base58.h"
+#include "bignum.h"
 #include "bip32.h"
+#include "bip39.h"
+#include "blake256.h"
+#include "blake2b.h"
+#include "blake2s.h"
+#include "chacha20poly1305/rfc7539.h"
 #include "curves.h"
 #include "ecdsa.h"
 #include "ed25519-donna/ed25519.h"
+#include "groestl.h"
 #include "hasher.h"
+#include "hmac.h"
+#include "monero/monero.h"
 #include "nist256p1.h"
+#include "pbkdf2.h"
+#include "ripemd160.h"
 #include "secp256k1.h"
+#include "segwit_addr.h"
+#include "sha2.h"
+#include "sha3.h"
 
 static uint8_t msg[256];
 
@@ -54,7 +78,7 @@ void bench_sign_ed25519(int iterations) {
   ed25519_secret_key sk;
   ed25519_signature sig;
 
-  memcpy(pk,
+  memcpy(sk,
          "\xc5\x5e\xce\x85\x8b\x0d\xdd\x52\x63\xf9\x68\x10\xfe\x14\x43\x7c\xd3"
          "\xb5\xe1\xfb\xd7\xc6\xa2\xec\x1e\x03\x1f\x05\xe8\x6d\x8b\xd5",
          32);
@@ -138,7 +162,7 @@ void bench_verify_ed25519(int iterations) {
   ed25519_secret_key sk;
   ed25519_signature sig;
 
-  memcpy(pk,
+  memcpy(sk,
          "\xc5\x5e\xce\x85\x8b\x0d\xdd\x52\x63\xf9\x68\x10\xfe\x14\x43\x7c\xd3"
          "\xb5\xe1\xfb\xd7\xc6\xa2\xec\x1e\x03\x1f\x05\xe8\x6d\x8b\xd5",
          32);
@@ -169,6 +193,362 @@ void bench_multiply_curve25519(int iterations) {
   }
 }
 
+void bench_multiply_curve25519_basepoint(int iterations) {
+  uint8_t result[32];
+  uint8_t secret[32];
+
+  memcpy(secret,
+         "\xc5\x5e\xce\x85\x8b\x0d\xdd\x52\x63\xf9\x68\x10\xfe\x14\x43\x7c\xd3"
+         "\xb5\xe1\xfb\xd7\xc6\xa2\xec\x1e\x03\x1f\x05\xe8\x6d\x8b\xd5",
+         32);
+
+  for (int i = 0; i < iterations; i++) {
+    curve25519_scalarmult_basepoint(result, secret);
+  }
+}
+
+void bench_bn_multiply(int iterations) {
+  bignum256 a = secp256k1.G.x, b = secp256k1.G.y;
+
+  for (int i = 0; i < iterations; i++) {
+    bn_multiply(&a, &b, &secp256k1.prime);
+  }
+}
+
+void bench_bn_fast_mod(int iterations) {
+  bignum256 a = nist256p1.G.x;
+
+  for (int i = 0; i < iterations; i++) {
+    bn_mult_k(&a, 8, &nist256p1.prime);
+    bn_fast_mod(&a, &nist256p1.prime);
+  }
+}
+
+static uint8_t data[65536];
+
+void bench_keccak_256_1k(int iterations) {
+  uint8_t digest[SHA3_256_DIGEST_LENGTH];
+
+  for (int i = 0; i < iterations; i++) {
+    keccak_256(data, 1024, digest);
+  }
+}
+
+void bench_keccak_512_1k(int iterations) {
+  uint8_t digest[SHA3_512_DIGEST_LENGTH];
+
+  for (int i = 0; i < iterations; i++) {
+    keccak_512(data, 1024, digest);
+  }
+}
+
+void bench_sha3_256_1k(int iterations) {
+  uint8_t digest[SHA3_256_DIGEST_LENGTH];
+
+  for (int i = 0; i < iterations; i++) {
+    sha3_256(data, 1024, digest);
+  }
+}
+
+void bench_sha3_512_1k(int iterations) {
+  uint8_t digest[SHA3_512_DIGEST_LENGTH];
+
+  for (int i = 0; i < iterations; i++) {
+    sha3_512(data, 1024, digest);
+  }
+}
+
+void bench_keccak_256_64k(int iterations) {
+  uint8_t digest[SHA3_256_DIGEST_LENGTH];
+
+  for (int i = 0; i < iterations; i++) {
+    keccak_256(data, sizeof(data), digest);
+  }
+}
+
+void bench_blake2b_1k(int iterations) {
+  uint8_t digest[BLAKE2B_OUTBYTES];
+
+  for (int i = 0; i < iterations; i++) {
+    blake2b(data, 1024, digest, sizeof(digest));
+  }
+}
+
+void bench_blake2s_1k(int iterations) {
+  uint8_t digest[BLAKE2S_OUTBYTES];
+
+  for (int i = 0; i < iterations; i++) {
+    blake2s(data, 1024, digest, sizeof(digest));
+  }
+}
+
+void bench_blake256_1k(int iterations) {
+  uint8_t digest[BLAKE256_DIGEST_LENGTH];
+
+  for (int i = 0; i < iterations; i++) {
+    blake256(data, 1024, digest);
+  }
+}
+
+void bench_groestl512_1k(int iterations) {
+  uint8_t digest[64];
+  GROESTL512_CTX ctx;
+
+  for (int i = 0; i < iterations; i++) {
+    groestl512_Init(&ctx);
+    groestl512_Update(&ctx, data, 1024);
+    groestl512_Final(&ctx, digest);
+  }
+}
+
+void bench_sha256_1k(int iterations) {
+  uint8_t digest[32];
+
+  for (int i = 0; i < iterations; i++) {
+    sha256_Raw(data, 1024, digest);
+  }
+}
+
+void bench_sha1_1k(int iterations) {
+  uint8_t digest[SHA1_DIGEST_LENGTH];
+
+  for (int i = 0; i < iterations; i++) {
+    sha1_Raw(data, 1024, digest);
+  }
+}
+
+void bench_sha512_1k(int iterations) {
+  uint8_t digest[SHA512_DIGEST_LENGTH];
+
+  for (int i = 0; i < iterations; i++) {
+    sha512_Raw(data, 1024, digest);
+  }
+}
+
+void bench_ripemd160_1k(int iterations) {
+  uint8_t digest[RIPEMD160_DIGEST_LENGTH];
+
+  for (int i = 0; i < iterations; i++) {
+    ripemd160(data, 1024, digest);
+  }
+}
+
+void bench_hmac_sha256_1k(int iterations) {
+  uint8_t mac[SHA256_DIGEST_LENGTH];
+
+  for (int i = 0; i < iterations; i++) {
+    hmac_sha256(msg, 32, data, 1024, mac);
+  }
+}
+
+void bench_hmac_sha512_1k(int iterations) {
+  uint8_t mac[SHA512_DIGEST_LENGTH];
+
+  for (int i = 0; i < iterations; i++) {
+    hmac_sha512(msg, 32, data, 1024, mac);
+  }
+}
+
+// One PIN unlock in storage.c derives two blocks with 20000 iterations each.
+void bench_pbkdf2_hmac_sha256_pin(int iterations) {
+  uint8_t key[64];
+
+  for (int i = 0; i < iterations; i++) {
+    pbkdf2_hmac_sha256(data, 4, data + 4, 80, 20000, key, sizeof(key));
+  }
+}
+
+// The BIP-39 cache would answer all but the first call, so the passphrase
+// differs in every iteration.
+void bench_mnemonic_to_seed(int iterations) {
+  const char *mnemonic =
+      "abandon abandon abandon abandon abandon abandon abandon abandon "
+      "abandon abandon abandon about";
+  uint8_t seed[512 / 8];
+  char passphrase[16];
+
+  for (int i = 0; i < iterations; i++) {
+    snprintf(passphrase, sizeof(passphrase), "%d", i);
+    mnemonic_to_seed(mnemonic, passphrase, seed, NULL);
+  }
+}
+
+void bench_aes256_cbc_1k(int iterations) {
+  static uint8_t out[1024];
+  uint8_t iv[AES_BLOCK_SIZE] = {0};
+  aes_encrypt_ctx ctx;
+
+  aes_encrypt_key256(msg, &ctx);
+  for (int i = 0; i < iterations; i++) {
+    aes_cbc_encrypt(data, out, 1024, iv, &ctx);
+  }
+}
+
+void bench_aes256_ctr_1k(int iterations) {
+  static uint8_t out[1024];
+  uint8_t ctr[AES_BLOCK_SIZE] = {0};
+  aes_encrypt_ctx ctx;
+
+  aes_encrypt_key256(msg, &ctx);
+  for (int i = 0; i < iterations; i++) {
+    aes_ctr_encrypt(data, out, 1024, ctr, aes_ctr_cbuf_inc, &ctx);
+  }
+}
+
+void bench_aes256_ct_ctr_1k(int iterations) {
+  static uint8_t out[1024];
+  uint8_t ctr[AES_CT_BLOCK_SIZE] = {0};
+  aes_ct_ctx ctx;
+
+  aes_ct_set_key(&ctx, msg, 32);
+  for (int i = 0; i < iterations; i++) {
+    aes_ct_ctr_crypt(&ctx, data, out, 1024, ctr);
+  }
+}
+
+void bench_aes256_cbc_decrypt_1k(int iterations) {
+  static uint8_t out[1024];
+  uint8_t iv[AES_BLOCK_SIZE] = {0};
+  aes_decrypt_ctx ctx;
+
+  aes_decrypt_key256(msg, &ctx);
+  for (int i = 0; i < iterations; i++) {
+    aes_cbc_decrypt(data, out, 1024, iv, &ctx);
+  }
+}
+
+void bench_aes256_ct_cbc_decrypt_1k(int iterations) {
+  static uint8_t out[1024];
+  uint8_t iv[AES_CT_BLOCK_SIZE] = {0};
+  aes_ct_ctx ctx;
+
+  aes_ct_set_key(&ctx, msg, 32);
+  for (int i = 0; i < iterations; i++) {
+    aes_ct_cbc_decrypt(&ctx, data, out, 1024, iv);
+  }
+}
+
+void bench_chacha20poly1305_1k(int iterations) {
+  static uint8_t out[1024];
+  uint8_t mac[16];
+  chacha20poly1305_ctx ctx;
+
+  for (int i = 0; i < iterations; i++) {
+    rfc7539_init(&ctx, msg, msg + 32);
+    rfc7539_auth(&ctx, msg, 16);
+    chacha20poly1305_encrypt(&ctx, data, out, 1024);
+    rfc7539_finish(&ctx, 16, 1024, mac);
+  }
+}
+
+void bench_base58_encode_check(int iterations) {
+  char str[MAX_ADDR_SIZE];
+
+  for (int i = 0; i < iterations; i++) {
+    base58_encode_check(data, 21, HASHER_SHA2D, str, sizeof(str));
+  }
+}
+
+void bench_base58_decode_check(int iterations) {
+  char str[MAX_ADDR_SIZE];
+  uint8_t out[21];
+
+  base58_encode_check(data, 21, HASHER_SHA2D, str, sizeof(str));
+  for (int i = 0; i < iterations; i++) {
+    base58_decode_check(str, HASHER_SHA2D, out, sizeof(out));
+  }
+}
+
+void bench_segwit_addr_encode(int iterations) {
+  char addr[93];
+
+  for (int i = 0; i < iterations; i++) {
+    segwit_addr_encode(addr, "bc", 0, data, 20);
+  }
+}
+
+void bench_bn_inverse(int iterations) {
+  bignum256 a = secp256k1.G.x;
+
+  for (int i = 0; i < iterations; i++) {
+    bn_inverse(&a, &secp256k1.prime);
+  }
+}
+
+void bench_bn_inverse_slow(int iterations) {
+  bignum256 a = secp256k1.G.x;
+
+  for (int i = 0; i < iterations; i++) {
+    bn_inverse_slow(&a, &secp256k1.prime);
+  }
+}
+
+void bench_bn_inverse_fast(int iterations) {
+  bignum256 a = secp256k1.G.x;
+
+  for (int i = 0; i < iterations; i++) {
+    bn_inverse_fast(&a, &secp256k1.prime);
+  }
+}
+
+void bench_bn_inverse_safegcd(int iterations) {
+  bignum256 a = secp256k1.G.x;
+
+  for (int i = 0; i < iterations; i++) {
+    bn_inverse_safegcd(&a, &secp256k1.prime);
+  }
+}
+
+void bench_bn_sqrt(int iterations) {
+  bignum256 a = secp256k1.G.y;
+
+  for (int i = 0; i < iterations; i++) {
+    bn_multiply(&a, &a, &secp256k1.prime);
+    bn_sqrt(&a, &secp256k1.prime);
+  }
+}
+
+void bench_xmr_hash_to_ec(int iterations) {
+  ge25519 p;
+
+  for (int i = 0; i < iterations; i++) {
+    xmr_hash_to_ec(&p, msg, 32);
+  }
+}
+
+void bench_xmr_generate_key_derivation(int iterations) {
+  ge25519 a, r;
+  bignum256modm b;
+
+  expand256_modm(b, msg, 32);
+  ge25519_scalarmult_base_wrapper(&a, b);
+  for (int i = 0; i < iterations; i++) {
+    xmr_generate_key_derivation(&r, &a, b);
+  }
+}
+
+void bench_xmr_derive_public_key(int iterations) {
+  ge25519 base, deriv, r;
+  bignum256modm s;
+
+  expand256_modm(s, msg, 32);
+  ge25519_scalarmult_base_wrapper(&base, s);
+  xmr_generate_key_derivation(&deriv, &base, s);
+  for (int i = 0; i < iterations; i++) {
+    xmr_derive_public_key(&r, &deriv, i, &base);
+  }
+}
+
+void bench_xmr_scalarmult_h(int iterations) {
+  ge25519 r;
+  bignum256modm s;
+
+  expand256_modm(s, msg, 32);
+  for (int i = 0; i < iterations; i++) {
+    ge25519_scalarmult_h(&r, s);
+  }
+}
+
 static HDNode root;
 
 void prepare_node(void) {
@@ -199,35 +579,237 @@ void bench_ckd_optimized(int iterations) {
   }
 }
 
-void bench(void (*func)(int), const char *name, int iterations) {
-  clock_t t = clock();
-  func(iterations);
-  float speed = iterations / ((float)(clock() - t) / CLOCKS_PER_SEC);
-  printf("%25s: %8.2f ops/s\n", name, speed);
+
+static uint64_t cycles(void) {
+#if HAVE_CYCLES
+  return __rdtsc();
+#else
+  return 0;
+#endif
 }
 
-#define BENCH(FUNC, ITER) bench(FUNC, #FUNC, ITER)
+struct benchmark {
+  void (*func)(int);
+  const char *name;
+  int iterations;
+};
+
+#define BENCH(FUNC, ITER) \
+  { FUNC, #FUNC, ITER }
+
+static const struct benchmark benchmarks[] = {
+    BENCH(bench_sign_secp256k1, 500),
+    BENCH(bench_verify_secp256k1_33, 500),
+    BENCH(bench_verify_secp256k1_65, 500),
+
+    BENCH(bench_sign_nist256p1, 500),
+    BENCH(bench_verify_nist256p1_33, 500),
+    BENCH(bench_verify_nist256p1_65, 500),
+
+    BENCH(bench_sign_ed25519, 4000),
+    BENCH(bench_verify_ed25519, 4000),
+
+    BENCH(bench_multiply_curve25519, 4000),
+    BENCH(bench_multiply_curve25519_basepoint, 4000),
+
+    BENCH(bench_bn_multiply, 1000000),
+    BENCH(bench_bn_fast_mod, 1000000),
+    BENCH(bench_bn_inverse, 20000),
+    BENCH(bench_bn_inverse_slow, 5000),
+    BENCH(bench_bn_inverse_fast, 20000),
+    BENCH(bench_bn_inverse_safegcd, 20000),
+    BENCH(bench_bn_sqrt, 5000),
+
+    BENCH(bench_keccak_256_1k, 100000),
+    BENCH(bench_keccak_256_64k, 2000),
+    BENCH(bench_keccak_512_1k, 100000),
+    BENCH(bench_sha3_256_1k, 100000),
+    BENCH(bench_sha3_512_1k, 100000),
+
+    BENCH(bench_blake256_1k, 100000),
+    BENCH(bench_blake2b_1k, 100000),
+    BENCH(bench_blake2s_1k, 100000),
+
+    BENCH(bench_sha1_1k, 100000),
+    BENCH(bench_sha256_1k, 100000),
+    BENCH(bench_sha512_1k, 100000),
+    BENCH(bench_ripemd160_1k, 100000),
+    BENCH(bench_groestl512_1k, 10000),
+
+    BENCH(bench_hmac_sha256_1k, 100000),
+    BENCH(bench_hmac_sha512_1k, 100000),
+    BENCH(bench_pbkdf2_hmac_sha256_pin, 20),
+    BENCH(bench_mnemonic_to_seed, 20),
+
+    BENCH(bench_aes256_cbc_1k, 100000),
+    BENCH(bench_aes256_ctr_1k, 100000),
+    BENCH(bench_aes256_ct_ctr_1k, 100000),
+    BENCH(bench_aes256_cbc_decrypt_1k, 100000),
+    BENCH(bench_aes256_ct_cbc_decrypt_1k, 100000),
+    BENCH(bench_chacha20poly1305_1k, 100000),
+
+    BENCH(bench_base58_encode_check, 100000),
+    BENCH(bench_base58_decode_check, 100000),
+    BENCH(bench_segwit_addr_encode, 1000000),
+
+    BENCH(bench_xmr_hash_to_ec, 4000),
+    BENCH(bench_xmr_generate_key_derivation, 4000),
+    BENCH(bench_xmr_derive_public_key, 4000),
+    BENCH(bench_xmr_scalarmult_h, 4000),
+
+    BENCH(bench_ckd_normal, 1000),
+    BENCH(bench_ckd_optimized, 1000),
+};
+
+#define BENCH_COUNT (sizeof(benchmarks) / sizeof(benchmarks[0]))
+
+// Results of a previous run, read from its JSON output.
+static struct {
+  char name[64];
+  double ops;
+} baseline[BENCH_COUNT];
+static size_t baseline_count = 0;
+
+static void load_baseline(const char *path) {
+  FILE *f = fopen(path, "r");
+  if (f == NULL) {
+    perror(path);
+    exit(2);
+  }
+  char line[256];
+  while (baseline_count < BENCH_COUNT && fgets(line, sizeof(line), f)) {
+    if (sscanf(line, " \"%63[^\"]\": {\"ops\": %lf",
+               baseline[baseline_count].name,
+               &baseline[baseline_count].ops) == 2) {
+      baseline_count++;
+    }
+  }
+  fclose(f);
+}
 
-int main(void) {
-  prepare_msg();
+static double baseline_ops(const char *name) {
+  for (size_t i = 0; i < baseline_count; i++) {
+    if (strcmp(baseline[i].name, name) == 0) {
+      return baseline[i].ops;
+    }
+  }
+  return 0;
+}
 
-  BENCH(bench_sign_secp256k1, 500);
-  BENCH(bench_verify_secp256k1_33, 500);
-  BENCH(bench_verify_secp256k1_65, 500);
+static bool selected(const char *name, int argc, char **argv) {
+  if (argc == 0) {
+    return true;
+  }
+  for (int i = 0; i < argc; i++) {
+    if (strstr(name, argv[i]) != NULL) {
+      return true;
+    }
+  }
+  return false;
+}
 
-  BENCH(bench_sign_nist256p1, 500);
-  BENCH(bench_verify_nist256p1_33, 500);
-  BENCH(bench_verify_nist256p1_65, 500);
+static void usage(const char *prog) {
+  fprintf(stderr,
+          "usage: %s [-j results.json] [-c baseline.json] [-t percent] "
+          "[name...]\n"
+          "  -j  write the results as JSON\n"
+          "  -c  compare with the JSON results of an earlier run and fail\n"
+          "      when a benchmark got slower by more than the tolerance\n"
+          "  -t  tolerance of the comparison in percent (default 10)\n"
+          "  name  only run benchmarks containing one of these substrings\n",
+          prog);
+  exit(2);
+}
 
-  BENCH(bench_sign_ed25519, 4000);
-  BENCH(bench_verify_ed25519, 4000);
+int main(int argc, char **argv) {
+  const char *json_path = NULL;
+  const char *baseline_path = NULL;
+  double tolerance = 10;
+
+  int arg = 1;
+  for (; arg < argc && argv[arg][0] == '-'; arg++) {
+    if (arg + 1 == argc) {
+      usage(argv[0]);
+    }
+    if (strcmp(argv[arg], "-j") == 0) {
+      json_path = argv[++arg];
+    } else if (strcmp(argv[arg], "-c") == 0) {
+      baseline_path = argv[++arg];
+    } else if (strcmp(argv[arg], "-t") == 0) {
+      tolerance = atof(argv[++arg]);
+    } else {
+      usage(argv[0]);
+    }
+  }
 
-  BENCH(bench_multiply_curve25519, 4000);
+  FILE *json = NULL;
+  if (json_path != NULL) {
+    json = fopen(json_path, "w");
+    if (json == NULL) {
+      perror(json_path);
+      return 2;
+    }
+    fprintf(json, "{\n");
+  }
+  if (baseline_path != NULL) {
+    load_baseline(baseline_path);
+  }
 
+  prepare_msg();
   prepare_node();
 
-  BENCH(bench_ckd_normal, 1000);
-  BENCH(bench_ckd_optimized, 1000);
+  int regressions = 0;
+  bool first = true;
+  for (size_t i = 0; i < BENCH_COUNT; i++) {
+    const struct benchmark *b = &benchmarks[i];
+    if (!selected(b->name, argc - arg, argv + arg)) {
+      continue;
+    }
+
+    clock_t t = clock();
+    uint64_t c = cycles();
+    b->func(b->iterations);
+    c = cycles() - c;
+    t = clock() - t;
+
+    double ops = b->iterations / ((double)t / CLOCKS_PER_SEC);
+    double cycles_per_op = (double)c / b->iterations;
+    printf("%35s: %12.2f ops/s", b->name, ops);
+    if (HAVE_CYCLES) {
+      printf(" %12.0f cycles/op", cycles_per_op);
+    }
+
+    double base = baseline_ops(b->name);
+    if (base > 0) {
+      double change = (ops - base) * 100 / base;
+      printf(" %+7.1f%%", change);
+      if (change < -tolerance) {
+        printf(" REGRESSION");
+        regressions++;
+      }
+    }
+    printf("\n");
+
+    if (json != NULL) {
+      fprintf(json, "%s  \"%s\": {\"ops\": %.2f", first ? "" : ",\n",
+              b->name, ops);
+      if (HAVE_CYCLES) {
+        fprintf(json, ", \"cycles\": %.0f", cycles_per_op);
+      }
+      fprintf(json, "}");
+      first = false;
+    }
+  }
+
+  if (json != NULL) {
+    fprintf(json, "\n}\n");
+    fclose(json);
+  }
 
+  if (regressions > 0) {
+    printf("%d benchmark(s) slower than the baseline by more than %.1f%%\n",
+           regressions, tolerance);
+    return 1;
+  }
   return 0;
 }
@@ -1,22 +1,39 @@
+#include <pthread.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <unistd.h>
+#include "base58.h"
 #include "bip32.h"
 #include "bip39.h"
 #include "curves.h"
 #include "ecdsa.h"
 #include "secp256k1.h"
 
-char iter[256];
-uint8_t seed[512 / 8];
-char addr[MAX_ADDR_SIZE];
-int count = 0, found = 0;
-HDNode node;
-clock_t start;
+// candidates handed to mnemonic_to_seed_batch at once
+#define BATCH 4
+// seconds between two progress reports
+#define PROGRESS_INTERVAL 10
+
+const char *mnemonic, *item;
+char found_iter[256], found_addr[MAX_ADDR_SIZE];
+int count = 0, found = 0, done = 0, finished = 0;
+pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+// The target addresses are kept as sorted hashes, with a Bloom filter in
+// front of them so that almost all candidates are rejected by a few bit
+// tests. The hashes are uniformly distributed, so their words are used
+// directly as the filter indices.
+#define BLOOM_HASHES 4
+uint8_t (*targets)[20];
+size_t target_count = 0;
+uint32_t *bloom;
+uint32_t bloom_mask;
 
 #define ACCOUNT_LEGACY 0
 
-// around 280 tries per second
+// around 1000 tries per second and thread with AVX2 (550 without batching)
 
 // testing data:
 //
@@ -30,13 +47,171 @@ clock_t start;
 //             segwit: "3NcXPfbDP4UHSbuHASALJEBtDeAcWYMMcS"
 // passphrase: "testing"
 
+static int cmp_hash(const void *a, const void *b) { return memcmp(a, b, 20); }
+
+static uint32_t bloom_index(const uint8_t *hash, int i) {
+  const uint8_t *p = hash + 4 * i;
+  return ((uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 |
+          (uint32_t)p[3] << 24) &
+         bloom_mask;
+}
+
+static int add_target(const char *addr) {
+  uint8_t raw[MAX_ADDR_RAW_SIZE];
+  if (base58_decode_check(addr, HASHER_SHA2D, raw, sizeof(raw)) != 21) {
+    return 0;
+  }
+  targets = realloc(targets, (target_count + 1) * sizeof(*targets));
+  if (targets == NULL) {
+    return 0;
+  }
+  memcpy(targets[target_count++], raw + 1, 20);
+  return 1;
+}
+
+// reads one address per line, blank lines are skipped
+static int read_targets(const char *path) {
+  FILE *f = fopen(path, "r");
+  if (f == NULL) {
+    return 0;
+  }
+  char line[256];
+  int ok = 1;
+  while (ok && fgets(line, sizeof(line), f)) {
+    line[strcspn(line, "\r\n")] = 0;
+    if (line[0] != 0 && !add_target(line)) {
+      fprintf(stderr, "\"%s\" is not a valid address\n", line);
+      ok = 0;
+    }
+  }
+  fclose(f);
+  return ok && target_count > 0;
+}
+
+static void build_bloom(void) {
+  // at least 32 bits per target, which keeps false positives below 0.1%
+  size_t bits = 1024;
+  while (bits < 32 * target_count) {
+    bits <<= 1;
+  }
+  bloom_mask = bits - 1;
+  bloom = calloc(bits / 32, sizeof(uint32_t));
+  for (size_t i = 0; i < target_count; i++) {
+    for (int j = 0; j < BLOOM_HASHES; j++) {
+      uint32_t k = bloom_index(targets[i], j);
+      bloom[k / 32] |= 1u << (k % 32);
+    }
+  }
+  qsort(targets, target_count, sizeof(*targets), cmp_hash);
+}
+
+static int is_target(const uint8_t *hash) {
+  for (int j = 0; j < BLOOM_HASHES; j++) {
+    uint32_t k = bloom_index(hash, j);
+    if (!(bloom[k / 32] & (1u << (k % 32)))) {
+      return 0;
+    }
+  }
+  return bsearch(hash, targets, target_count, sizeof(*targets), cmp_hash) !=
+         NULL;
+}
+
+// reads up to BATCH candidates from stdin, returns how many
+static int read_batch(char iter[BATCH][256]) {
+  int n = 0;
+  pthread_mutex_lock(&lock);
+  while (n < BATCH && !found && !done) {
+    if (fgets(iter[n], 256, stdin) == NULL) {
+      done = 1;
+      break;
+    }
+    int len = strlen(iter[n]);
+    if (len <= 0) {
+      continue;
+    }
+    if (iter[n][len - 1] == '\n') {
+      iter[n][len - 1] = 0;
+    }
+    n++;
+  }
+  count += n;
+  pthread_mutex_unlock(&lock);
+  return n;
+}
+
+static void *worker(void *arg) {
+  (void)arg;
+  char iter[BATCH][256];
+  const char *mnemonics[BATCH], *passphrases[BATCH];
+  uint8_t seeds[BATCH][512 / 8];
+  uint8_t raw[MAX_ADDR_RAW_SIZE];
+  HDNode node;
+  for (;;) {
+    int n = read_batch(iter);
+    if (n == 0) break;
+    for (int i = 0; i < n; i++) {
+      mnemonics[i] = mnemonic ? mnemonic : iter[i];
+      passphrases[i] = mnemonic ? iter[i] : "";
+    }
+    mnemonic_to_seed_batch(mnemonics, passphrases, n, seeds);
+    for (int i = 0; i < n; i++) {
+      hdnode_from_seed(seeds[i], 512 / 8, SECP256K1_NAME, &node);
+#if ACCOUNT_LEGACY
+      hdnode_private_ckd_prime(&node, 44);
+#else
+      hdnode_private_ckd_prime(&node, 49);
+#endif
+      hdnode_private_ckd_prime(&node, 0);
+      hdnode_private_ckd_prime(&node, 0);
+      hdnode_private_ckd(&node, 0);
+      hdnode_private_ckd(&node, 0);
+      hdnode_fill_public_key(&node);
+#if ACCOUNT_LEGACY
+      // Legacy address
+      ecdsa_get_address_raw(node.public_key, 0, HASHER_SHA2_RIPEMD, raw);
+#else
+      // Segwit-in-P2SH
+      ecdsa_get_address_segwit_p2sh_raw(node.public_key, 5, HASHER_SHA2_RIPEMD,
+                                        raw);
+#endif
+      if (is_target(raw + 1)) {
+        pthread_mutex_lock(&lock);
+        found = 1;
+        strcpy(found_iter, iter[i]);
+        base58_encode_check(raw, 21, HASHER_SHA2D, found_addr,
+                            sizeof(found_addr));
+        pthread_mutex_unlock(&lock);
+        break;
+      }
+    }
+  }
+  pthread_mutex_lock(&lock);
+  finished++;
+  pthread_mutex_unlock(&lock);
+  return NULL;
+}
+
+static float elapsed(const struct timespec *start) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
 int main(int argc, char **argv) {
   if (argc != 2 && argc != 3) {
-    fprintf(stderr, "Usage: bip39bruteforce address [mnemonic]\n");
+    fprintf(stderr, "Usage: bip39bruteforce address|@file [mnemonic]\n");
     return 1;
   }
-  const char *address = argv[1];
-  const char *mnemonic, *item;
+  if (argv[1][0] == '@') {
+    if (!read_targets(argv[1] + 1)) {
+      fprintf(stderr, "Could not read addresses from \"%s\"\n", argv[1] + 1);
+      return 3;
+    }
+  } else if (!add_target(argv[1])) {
+    fprintf(stderr, "\"%s\" is not a valid address\n", argv[1]);
+    return 3;
+  }
+  build_bloom();
   if (argc == 3) {
     mnemonic = argv[2];
     item = "passphrase";
@@ -48,51 +223,44 @@ int main(int argc, char **argv) {
     fprintf(stderr, "\"%s\" is not a valid mnemonic\n", mnemonic);
     return 2;
   }
-  printf("Reading %ss from stdin ...\n", item);
-  start = clock();
+  long threads = sysconf(_SC_NPROCESSORS_ONLN);
+  if (threads < 1) {
+    threads = 1;
+  }
+  pthread_t tid[threads];
+  printf("Reading %ss from stdin using %ld threads, %zu target addresses ...\n",
+         item, threads, target_count);
+  fflush(stdout);
+  struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (long i = 0; i < threads; i++) {
+    pthread_create(&tid[i], NULL, worker, NULL);
+  }
+  // report the progress to stderr until all workers are done
+  float next_report = PROGRESS_INTERVAL;
   for (;;) {
-    if (fgets(iter, 256, stdin) == NULL) break;
-    int len = strlen(iter);
-    if (len <= 0) {
-      continue;
-    }
-    count++;
-    iter[len - 1] = 0;
-    if (mnemonic) {
-      mnemonic_to_seed(mnemonic, iter, seed, NULL);
-    } else {
-      mnemonic_to_seed(iter, "", seed, NULL);
-    }
-    hdnode_from_seed(seed, 512 / 8, SECP256K1_NAME, &node);
-#if ACCOUNT_LEGACY
-    hdnode_private_ckd_prime(&node, 44);
-#else
-    hdnode_private_ckd_prime(&node, 49);
-#endif
-    hdnode_private_ckd_prime(&node, 0);
-    hdnode_private_ckd_prime(&node, 0);
-    hdnode_private_ckd(&node, 0);
-    hdnode_private_ckd(&node, 0);
-    hdnode_fill_public_key(&node);
-#if ACCOUNT_LEGACY
-    // Legacy address
-    ecdsa_get_address(node.public_key, 0, HASHER_SHA2_RIPEMD, HASHER_SHA2D,
-                      addr, sizeof(addr));
-#else
-    // Segwit-in-P2SH
-    ecdsa_get_address_segwit_p2sh(node.public_key, 5, HASHER_SHA2_RIPEMD,
-                                  HASHER_SHA2D, addr, sizeof(addr));
-#endif
-    if (strcmp(address, addr) == 0) {
-      found = 1;
-      break;
+    struct timespec tick = {0, 100 * 1000 * 1000};
+    nanosleep(&tick, NULL);
+    pthread_mutex_lock(&lock);
+    int tried = count, all_done = finished == threads;
+    pthread_mutex_unlock(&lock);
+    if (all_done) break;
+    float dur = elapsed(&start);
+    if (dur >= next_report) {
+      fprintf(stderr, "Tried %d %ss in %.0f seconds = %.1f tries/second\n",
+              tried, item, dur, tried / dur);
+      next_report += PROGRESS_INTERVAL;
     }
   }
-  float dur = (float)(clock() - start) / CLOCKS_PER_SEC;
+  for (long i = 0; i < threads; i++) {
+    pthread_join(tid[i], NULL);
+  }
+  float dur = elapsed(&start);
   printf("Tried %d %ss in %f seconds = %f tries/second\n", count, item, dur,
          (float)count / dur);
   if (found) {
-    printf("Correct %s found! :-)\n\"%s\"\n", item, iter);
+    printf("Correct %s found! :-)\n\"%s\"\naddress: %s\n", item, found_iter,
+           found_addr);
     return 0;
   }
   printf("Correct %s not found. :-(\n", item);
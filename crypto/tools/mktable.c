@@ -1,5 +1,6 @@
 #include <assert.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include "bignum.h"
 #include "bip32.h"
 #include "ecdsa.h"
@@ -7,15 +8,28 @@
 
 /*
  * This program prints the contents of the ecdsa_curve.cp array.
- * The entry cp[i][j] contains the number (2*j+1)*16^i*G,
- * where G is the generator of the specified elliptic curve.
+ * The entry cp[i][j] contains the number (2*j+1)*2^(w*i)*G,
+ * where G is the generator of the specified elliptic curve and w is
+ * the window size, USE_PRECOMPUTED_CP_WINDOW unless given as the
+ * second argument. There are 2^(w-1) entries for each of the
+ * ceil(256/w) positions i.
  */
 int main(int argc, char **argv) {
   int i, j, k;
-  if (argc != 2) {
-    printf("Usage: %s CURVE_NAME\n", argv[0]);
+  int window = USE_PRECOMPUTED_CP_WINDOW;
+  if (argc != 2 && argc != 3) {
+    printf("Usage: %s CURVE_NAME [WINDOW]\n", argv[0]);
     return 1;
   }
+  if (argc == 3) {
+    window = atoi(argv[2]);
+    if (window < 4 || window > 8) {
+      printf("WINDOW must be between 4 and 8\n");
+      return 1;
+    }
+  }
+  const int positions = (256 + window - 1) / window;
+  const int entries = 1 << (window - 1);
   const char *name = argv[1];
   const curve_info *info = get_curve_by_name(name);
   const ecdsa_curve *curve = info->params;
@@ -26,26 +40,32 @@ int main(int argc, char **argv) {
 
   curve_point ng = curve->G;
   curve_point pow2ig = curve->G;
-  for (i = 0; i < 64; i++) {
+  for (i = 0; i < positions; i++) {
     // invariants:
-    //   pow2ig = 16^i * G
+    //   pow2ig = 2^(w*i) * G
     //   ng     = pow2ig
     printf("\t{\n");
-    for (j = 0; j < 8; j++) {
+    for (j = 0; j < entries; j++) {
       // invariants:
-      //   pow2ig = 16^i * G
-      //   ng     = (2*j+1) * 16^i * G
+      //   pow2ig = 2^(w*i) * G
+      //   ng     = (2*j+1) * 2^(w*i) * G
 #ifndef NDEBUG
       curve_point checkresult;
       bignum256 a;
+      uint64_t shifted = (uint64_t)(2 * j + 1)
+                         << ((window * i) % BN_BITS_PER_LIMB);
       bn_zero(&a);
-      a.val[(4 * i) / BN_BITS_PER_LIMB] = ((uint32_t)2 * j + 1)
-                                          << ((4 * i) % BN_BITS_PER_LIMB);
-      bn_normalize(&a);
+      a.val[(window * i) / BN_BITS_PER_LIMB] = shifted & BN_LIMB_MASK;
+      if ((window * i) / BN_BITS_PER_LIMB + 1 < BN_LIMBS) {
+        a.val[(window * i) / BN_BITS_PER_LIMB + 1] =
+            shifted >> BN_BITS_PER_LIMB;
+      }
+      bn_fast_mod(&a, &curve->order);
+      bn_mod(&a, &curve->order);
       point_multiply(curve, &a, &curve->G, &checkresult);
       assert(point_is_equal(&checkresult, &ng));
 #endif
-      printf("\t\t/* %2d*16^%d*G: */\n\t\t{{{", 2 * j + 1, i);
+      printf("\t\t/* %2d*%d^%d*G: */\n\t\t{{{", 2 * j + 1, 1 << window, i);
       // print x coordinate
       for (k = 0; k < 9; k++) {
         printf((k < 8 ? "0x%08x, " : "0x%04x"), ng.x.val[k]);
@@ -55,7 +75,7 @@ int main(int argc, char **argv) {
       for (k = 0; k < 9; k++) {
         printf((k < 8 ? "0x%08x, " : "0x%04x"), ng.y.val[k]);
       }
-      if (j == 7) {
+      if (j == entries - 1) {
         printf("}}}\n\t},\n");
       } else {
         printf("}}},\n");
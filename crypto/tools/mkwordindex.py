@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+# Generates the prefix indices of the BIP39 and SLIP39 wordlists.
+#
+# usage: tools/mkwordindex.py   (run from the crypto directory)
+
+import re
+
+HEADER = """// clang-format off
+// This file is generated by tools/mkwordindex.py from {source}, do not edit.
+
+"""
+
+LETTERS = 26
+BUTTONS = 9
+
+
+def read_words(filename):
+    with open(filename) as f:
+        data = f.read()
+    body = data[data.index("wordlist[") :]
+    body = body[: body.index("};")]
+    return re.findall(r'"([a-z]+)"', body)
+
+
+def read_sequences(filename):
+    with open(filename) as f:
+        data = f.read()
+    body = data[data.index("words_button_seq[") :]
+    body = body[: body.index("};")]
+    return [int(s) for s in re.findall(r"^\s*(\d+),", body, re.M)]
+
+
+def format_array(decl, values, per_line=12, width=4):
+    lines = ["%s = {" % decl]
+    for i in range(0, len(values), per_line):
+        chunk = values[i : i + per_line]
+        lines.append("    " + " ".join(("%d," % v).rjust(width + 1) for v in chunk))
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def letter_pair_index(words):
+    # offset of the first word that starts with each two-letter prefix,
+    # followed by the number of words
+    index = []
+    for pair in range(LETTERS * LETTERS):
+        prefix = chr(ord("a") + pair // LETTERS) + chr(ord("a") + pair % LETTERS)
+        index.append(sum(1 for w in words if w[:2] < prefix))
+    index.append(len(words))
+    return index
+
+
+def gen_bip39():
+    words = read_words("bip39_english.h")
+    assert len(words) == 2048 and words == sorted(words)
+    assert min(len(w) for w in words) >= 2
+    out = HEADER.format(source="bip39_english.h")
+    out += "// words in [wordlist_index[26 * a + b], wordlist_index[26 * a + b + 1])\n"
+    out += "// start with the letters a and b\n"
+    out += format_array(
+        "static const uint16_t wordlist_index[26 * 26 + 1]",
+        letter_pair_index(words),
+    )
+    with open("bip39_english_index.h", "w") as f:
+        f.write(out)
+
+
+def gen_slip39():
+    words = read_words("slip39_wordlist.h")
+    seqs = read_sequences("slip39_wordlist.h")
+    assert len(words) == len(seqs) == 1024 and words == sorted(words)
+    assert min(len(w) for w in words) >= 2
+
+    # masks of the buttons that can follow a sequence of one to three
+    # buttons, the sequences are ordered by length and then by value
+    masks = []
+    for length in (1, 2, 3):
+        for n in range(BUTTONS ** length):
+            prefix = 0
+            for i in reversed(range(length)):
+                prefix = prefix * 10 + (n // BUTTONS ** i) % BUTTONS + 1
+            mask = 0
+            for s in seqs:
+                digits = str(s)
+                if digits[:length] == str(prefix):
+                    mask |= 1 << (int(digits[length]) - 1)
+            masks.append(mask)
+
+    # the sequences are sorted by their first button
+    first = [sum(1 for s in seqs if s // 1000 < b) for b in range(1, BUTTONS + 2)]
+    assert all(seqs[i] // 1000 <= seqs[i + 1] // 1000 for i in range(len(seqs) - 1))
+
+    out = HEADER.format(source="slip39_wordlist.h")
+    out += "// words in [wordlist_index[26 * a + b], wordlist_index[26 * a + b + 1])\n"
+    out += "// start with the letters a and b\n"
+    out += format_array(
+        "static const uint16_t wordlist_index[26 * 26 + 1]",
+        letter_pair_index(words),
+    )
+    out += "\n// words in [button_index[b - 1], button_index[b]) start with button b\n"
+    out += format_array("static const uint16_t button_index[9 + 1]", first)
+    out += "\n// masks of the buttons that can follow 1, 2 and 3 button sequences\n"
+    out += format_array(
+        "static const uint16_t button_masks[9 + 9 * 9 + 9 * 9 * 9]", masks
+    )
+    with open("slip39_wordlist_index.h", "w") as f:
+        f.write(out)
+
+
+if __name__ == "__main__":
+    gen_bip39()
+    gen_slip39()
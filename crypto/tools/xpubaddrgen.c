@@ -1,48 +1,267 @@
 #include <inttypes.h>
+#include <pthread.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 #include "bip32.h"
 #include "curves.h"
 #include "ecdsa.h"
+#include "secp256k1.h"
+#include "segwit_addr.h"
 
 #define VERSION_PUBLIC 0x0488b21e
+#define VERSION_P2PKH 0
+#define VERSION_P2SH 5
+#define SEGWIT_HRP "bc"
 
-void process_job(uint32_t jobid, const char *xpub, uint32_t change,
-                 uint32_t from, uint32_t to) {
-  HDNode node, child;
+enum { FORMAT_P2PKH, FORMAT_P2SH, FORMAT_BECH32 };
+
+// indices derived by one worker at a time, through hdnode_public_ckd_cp_batch
+#define CHUNK_SIZE 1024
+// chunks derived before the results are written, bounds the memory use
+#define ROUND_CHUNKS 256
+// an address or, in binary mode, the 20-byte hash
+#define SLOT_SIZE 64
+
+typedef struct {
+  // 0: result chunk, 1: job error, 2: malformed line
+  int kind;
+  uint32_t jobid;
+  uint32_t from;
+  uint32_t count;
+  curve_point pub;
+  uint8_t chain_code[32];
+  char *slots;
+} item_t;
+
+static item_t round_items[ROUND_CHUNKS];
+static size_t round_count = 0;
+static size_t round_next = 0;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+static int format = FORMAT_P2PKH;
+static int binary = 0;
+
+static void encode(const curve_point *b, char *slot) {
+  uint8_t pubkey[33];
+  uint8_t raw[MAX_ADDR_RAW_SIZE];
+
+  pubkey[0] = 0x02 | (b->y.val[0] & 0x01);
+  bn_write_be(&b->x, pubkey + 1);
+
+  switch (format) {
+    case FORMAT_P2SH:
+      if (binary) {
+        ecdsa_get_address_segwit_p2sh_raw(pubkey, VERSION_P2SH,
+                                          HASHER_SHA2_RIPEMD, raw);
+        memcpy(slot, raw + 1, 20);
+      } else {
+        ecdsa_get_address_segwit_p2sh(pubkey, VERSION_P2SH, HASHER_SHA2_RIPEMD,
+                                      HASHER_SHA2D, slot, SLOT_SIZE);
+      }
+      break;
+    case FORMAT_BECH32:
+      ecdsa_get_pubkeyhash(pubkey, HASHER_SHA2_RIPEMD, raw);
+      if (binary) {
+        memcpy(slot, raw, 20);
+      } else {
+        segwit_addr_encode(slot, SEGWIT_HRP, 0, raw, 20);
+      }
+      break;
+    default:
+      if (binary) {
+        ecdsa_get_pubkeyhash(pubkey, HASHER_SHA2_RIPEMD, (uint8_t *)slot);
+      } else {
+        ecdsa_get_address(pubkey, VERSION_P2PKH, HASHER_SHA2_RIPEMD,
+                          HASHER_SHA2D, slot, SLOT_SIZE);
+      }
+      break;
+  }
+}
+
+static void process_chunk(item_t *item) {
+  curve_point children[CHUNK_SIZE];
+  if (!hdnode_public_ckd_cp_batch(&secp256k1, &item->pub, item->chain_code,
+                                  item->from, item->count, children)) {
+    item->kind = 1;
+    return;
+  }
+  for (uint32_t j = 0; j < item->count; j++) {
+    encode(&children[j], item->slots + j * SLOT_SIZE);
+  }
+}
+
+static void *worker(void *arg) {
+  (void)arg;
+  for (;;) {
+    pthread_mutex_lock(&lock);
+    item_t *item = NULL;
+    while (round_next < round_count) {
+      item_t *next = &round_items[round_next++];
+      if (next->kind == 0) {
+        item = next;
+        break;
+      }
+    }
+    pthread_mutex_unlock(&lock);
+    if (item == NULL) {
+      return NULL;
+    }
+    process_chunk(item);
+  }
+}
+
+static void write_le32(uint8_t *out, uint32_t v) {
+  out[0] = v;
+  out[1] = v >> 8;
+  out[2] = v >> 16;
+  out[3] = v >> 24;
+}
+
+// derives all chunks of the round in parallel and writes the results in the
+// order of the input
+static void run_round(long threads) {
+  pthread_t tid[threads];
+  round_next = 0;
+  for (long i = 0; i < threads; i++) {
+    pthread_create(&tid[i], NULL, worker, NULL);
+  }
+  for (long i = 0; i < threads; i++) {
+    pthread_join(tid[i], NULL);
+  }
+
+  uint32_t last_error = 0;
+  int has_error = 0;
+  for (size_t i = 0; i < round_count; i++) {
+    item_t *item = &round_items[i];
+    if (item->kind == 2) {
+      fprintf(binary ? stderr : stdout, "error\n");
+    } else if (item->kind == 1) {
+      // a job fails only once, even if several of its chunks were hardened
+      if (!has_error || last_error != item->jobid) {
+        fprintf(binary ? stderr : stdout, "%" PRIu32 " error\n", item->jobid);
+      }
+      has_error = 1;
+      last_error = item->jobid;
+    } else {
+      for (uint32_t j = 0; j < item->count; j++) {
+        const char *slot = item->slots + j * SLOT_SIZE;
+        if (binary) {
+          uint8_t record[4 + 4 + 20];
+          write_le32(record, item->jobid);
+          write_le32(record + 4, item->from + j);
+          memcpy(record + 8, slot, 20);
+          fwrite(record, sizeof(record), 1, stdout);
+        } else {
+          printf("%" PRIu32 " %" PRIu32 " %s\n", item->jobid, item->from + j,
+                 slot);
+        }
+      }
+    }
+  }
+  round_count = 0;
+}
+
+static item_t *add_item(int kind, uint32_t jobid, long threads) {
+  if (round_count == ROUND_CHUNKS) {
+    run_round(threads);
+  }
+  item_t *item = &round_items[round_count++];
+  item->kind = kind;
+  item->jobid = jobid;
+  return item;
+}
+
+static void process_job(uint32_t jobid, const char *xpub, uint32_t change,
+                        uint32_t from, uint32_t to, long threads) {
+  HDNode node;
   if (change > 1 || to <= from ||
       hdnode_deserialize_public(xpub, VERSION_PUBLIC, SECP256K1_NAME, &node,
-                                NULL) != 0) {
-    printf("%d error\n", jobid);
+                                NULL) != 0 ||
+      hdnode_public_ckd(&node, change) != 1) {
+    add_item(1, jobid, threads);
+    return;
+  }
+  curve_point pub;
+  if (!ecdsa_read_pubkey(&secp256k1, node.public_key, &pub)) {
+    add_item(1, jobid, threads);
     return;
   }
-  hdnode_public_ckd(&node, change);
-  uint32_t i;
-  char address[36];
-  for (i = from; i < to; i++) {
-    memcpy(&child, &node, sizeof(HDNode));
-    hdnode_public_ckd(&child, i);
-    ecdsa_get_address(child.public_key, 0, HASHER_SHA2, HASHER_SHA2D, address,
-                      sizeof(address));
-    printf("%d %d %s\n", jobid, i, address);
+  for (uint32_t i = from; i < to;) {
+    uint32_t count = to - i < CHUNK_SIZE ? to - i : CHUNK_SIZE;
+    item_t *item = add_item(0, jobid, threads);
+    item->from = i;
+    item->count = count;
+    memcpy(&item->pub, &pub, sizeof(pub));
+    memcpy(item->chain_code, node.chain_code, 32);
+    i += count;
   }
 }
 
-int main(void) {
+static void usage(const char *prog) {
+  fprintf(stderr,
+          "Usage: %s [-f p2pkh|p2sh|bech32] [-b] [-t threads]\n"
+          "  -f  address type (default p2pkh)\n"
+          "  -b  binary output: jobid and index as 32-bit little endian,\n"
+          "      then the 20-byte hash of the address\n"
+          "  -t  number of threads (default: number of CPUs)\n",
+          prog);
+  exit(1);
+}
+
+int main(int argc, char **argv) {
+  long threads = sysconf(_SC_NPROCESSORS_ONLN);
+  int opt;
+  while ((opt = getopt(argc, argv, "f:bt:")) != -1) {
+    switch (opt) {
+      case 'f':
+        if (strcmp(optarg, "p2pkh") == 0) {
+          format = FORMAT_P2PKH;
+        } else if (strcmp(optarg, "p2sh") == 0) {
+          format = FORMAT_P2SH;
+        } else if (strcmp(optarg, "bech32") == 0) {
+          format = FORMAT_BECH32;
+        } else {
+          usage(argv[0]);
+        }
+        break;
+      case 'b':
+        binary = 1;
+        break;
+      case 't':
+        threads = atol(optarg);
+        break;
+      default:
+        usage(argv[0]);
+    }
+  }
+  if (threads < 1) {
+    threads = 1;
+  }
+
+  // each chunk owns a fixed part of the result buffer
+  static char slots[ROUND_CHUNKS][CHUNK_SIZE * SLOT_SIZE];
+  for (size_t i = 0; i < ROUND_CHUNKS; i++) {
+    round_items[i].slots = slots[i];
+  }
+
   char line[1024], xpub[1024];
   uint32_t jobid, change, from, to;
   int r;
   for (;;) {
     if (!fgets(line, sizeof(line), stdin)) break;
-    r = sscanf(line, "%u %s %u %u %u\n", &jobid, xpub, &change, &from, &to);
+    r = sscanf(line, "%" SCNu32 " %1023s %" SCNu32 " %" SCNu32 " %" SCNu32,
+               &jobid, xpub, &change, &from, &to);
     if (r < 1) {
-      printf("error\n");
+      add_item(2, 0, threads);
     } else if (r != 5) {
-      printf("%d error\n", jobid);
+      add_item(1, jobid, threads);
     } else {
-      process_job(jobid, xpub, change, from, to);
+      process_job(jobid, xpub, change, from, to, threads);
     }
   }
+  run_round(threads);
   return 0;
 }
@@ -24,6 +24,10 @@
 uint16_t buttonRead(void) {
   uint16_t state = 0;
 
+  if (emulatorHeadless()) {
+    return ~state;
+  }
+
   const uint8_t *scancodes = SDL_GetKeyboardState(NULL);
   if (scancodes[SDL_SCANCODE_LEFT]) {
     state |= BTN_PIN_NO;
@@ -25,9 +25,12 @@
 #include "strl.h"
 
 #include <stddef.h>
+#include <stdint.h>
 
+int emulatorHeadless(void);
 void emulatorPoll(void);
 void emulatorRandom(void *buffer, size_t size);
+void emulatorClockAdvance(uint32_t millis);
 
 void emulatorSocketInit(void);
 size_t emulatorSocketRead(int *iface, void *buffer, size_t size);
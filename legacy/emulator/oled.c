@@ -49,6 +49,11 @@ static int emulatorScale(void) {
 }
 
 void oledInit(void) {
+  if (emulatorHeadless()) {
+    oledClear();
+    return;
+  }
+
   if (SDL_Init(SDL_INIT_VIDEO) != 0) {
     fprintf(stderr, "Failed to initialize SDL: %s\n", SDL_GetError());
     exit(1);
@@ -104,6 +109,10 @@ void oledInit(void) {
 }
 
 void oledRefresh(void) {
+  if (emulatorHeadless()) {
+    return;
+  }
+
   /* Draw triangle in upper right corner */
   oledInvertDebugLink();
 
@@ -130,6 +139,10 @@ void oledRefresh(void) {
 }
 
 void emulatorPoll(void) {
+  if (emulatorHeadless()) {
+    return;
+  }
+
   SDL_Event event;
 
   if (SDL_PollEvent(&event)) {
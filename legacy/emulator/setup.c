@@ -33,6 +33,7 @@
 #include "timer.h"
 
 #define EMULATOR_FLASH_FILE "emulator.img"
+#define ENV_HEADLESS "TREZOR_HEADLESS"
 
 #ifndef RANDOM_DEV_FILE
 #define RANDOM_DEV_FILE "/dev/urandom"
@@ -57,6 +58,15 @@ void __attribute__((noreturn)) shutdown(void) {
   exit(4);
 }
 
+int emulatorHeadless(void) {
+  static int headless = -1;
+  if (headless < 0) {
+    const char *variable = getenv(ENV_HEADLESS);
+    headless = variable ? atoi(variable) : 0;
+  }
+  return headless;
+}
+
 void emulatorRandom(void *buffer, size_t size) {
   ssize_t n = 0, len = 0;
   do {
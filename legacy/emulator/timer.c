@@ -21,12 +21,17 @@
 
 #include "timer.h"
 
+/* Time skipped by sleeps in headless mode */
+static uint32_t clock_offset = 0;
+
 void timer_init(void) {}
 
+void emulatorClockAdvance(uint32_t millis) { clock_offset += millis; }
+
 uint32_t timer_ms(void) {
   struct timespec t = {0};
   clock_gettime(CLOCK_MONOTONIC, &t);
 
   uint32_t msec = t.tv_sec * 1000 + (t.tv_nsec / 1000000);
-  return msec;
+  return msec + clock_offset;
 }
@@ -94,9 +94,11 @@ static size_t socket_read(struct usb_socket *sock, void *buffer, size_t size) {
 }
 
 void emulatorSocketInit(void) {
-  usb_main.fd = socket_setup(TREZOR_UDP_PORT);
+  const char *variable = getenv("TREZOR_UDP_PORT");
+  int port = variable ? atoi(variable) : TREZOR_UDP_PORT;
+  usb_main.fd = socket_setup(port);
   usb_main.fromlen = 0;
-  usb_debug.fd = socket_setup(TREZOR_UDP_PORT + 1);
+  usb_debug.fd = socket_setup(port + 1);
   usb_debug.fromlen = 0;
 }
 
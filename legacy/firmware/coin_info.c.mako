@@ -13,6 +13,13 @@ def defined(s):
 
 def hex(x):
 	return "0x{:08x}".format(c_int(x))
+
+coins_list = list(supported_on("trezor1", bitcoin))
+
+def index_by(key):
+	# stable, so that coins sharing a key keep their order in coins[]
+	order = sorted(range(len(coins_list)), key=lambda i: key(coins_list[i]))
+	return ", ".join(str(i) for i in order)
 %>\
 // This file is automatically generated from coin_info.c.mako
 // DO NOT EDIT
@@ -23,7 +30,7 @@ def hex(x):
 #include "secp256k1.h"
 
 const CoinInfo coins[COINS_COUNT] = {
-% for c in supported_on("trezor1", bitcoin):
+% for c in coins_list:
 {
 	.coin_name = ${c_str(c.coin_name)},
 	.coin_shortcut = ${c_str(" " + c.coin_shortcut)},
@@ -52,3 +59,15 @@ const CoinInfo coins[COINS_COUNT] = {
 },
 % endfor
 };
+
+const uint16_t coins_by_name[COINS_COUNT] = {
+	${index_by(lambda c: c.coin_name.encode())}
+};
+
+const uint16_t coins_by_address_type[COINS_COUNT] = {
+	${index_by(lambda c: c.address_type)}
+};
+
+const uint16_t coins_by_coin_type[COINS_COUNT] = {
+	${index_by(lambda c: c_int(c.slip44) | 0x80000000)}
+};
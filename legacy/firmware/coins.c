@@ -23,32 +23,53 @@
 #include "base58.h"
 #include "ecdsa.h"
 
-const CoinInfo *coinByName(const char *name) {
-  if (!name) return 0;
-  for (int i = 0; i < COINS_COUNT; i++) {
-    if (strcmp(name, coins[i].coin_name) == 0) {
-      return &(coins[i]);
+// Returns the first coin with the given key from an index of coins[] sorted by
+// that key.
+static const CoinInfo *coinByIndex(const uint16_t *index,
+                                   uint32_t (*key)(const CoinInfo *),
+                                   uint32_t value) {
+  int lo = 0, hi = COINS_COUNT;
+  while (lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    if (key(&coins[index[mid]]) < value) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
     }
   }
+  if (lo < COINS_COUNT && key(&coins[index[lo]]) == value) {
+    return &(coins[index[lo]]);
+  }
   return 0;
 }
 
-const CoinInfo *coinByAddressType(uint32_t address_type) {
-  for (int i = 0; i < COINS_COUNT; i++) {
-    if (address_type == coins[i].address_type) {
-      return &(coins[i]);
+static uint32_t addressType(const CoinInfo *coin) { return coin->address_type; }
+
+static uint32_t coinType(const CoinInfo *coin) { return coin->coin_type; }
+
+const CoinInfo *coinByName(const char *name) {
+  if (!name) return 0;
+  int lo = 0, hi = COINS_COUNT;
+  while (lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    int cmp = strcmp(name, coins[coins_by_name[mid]].coin_name);
+    if (cmp == 0) {
+      return &(coins[coins_by_name[mid]]);
+    } else if (cmp < 0) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
     }
   }
   return 0;
 }
 
+const CoinInfo *coinByAddressType(uint32_t address_type) {
+  return coinByIndex(coins_by_address_type, addressType, address_type);
+}
+
 const CoinInfo *coinBySlip44(uint32_t coin_type) {
-  for (int i = 0; i < COINS_COUNT; i++) {
-    if (coin_type == coins[i].coin_type) {
-      return &(coins[i]);
-    }
-  }
-  return 0;
+  return coinByIndex(coins_by_coin_type, coinType, coin_type);
 }
 
 bool coinExtractAddressType(const CoinInfo *coin, const char *addr,
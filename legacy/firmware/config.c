@@ -138,6 +138,34 @@ static uint8_t session_findSession(const uint8_t *sessionId);
 static CONFIDENTIAL Session sessionsCache[MAX_SESSIONS_COUNT];
 static Session *activeSessionCache;
 
+// Root nodes derived from the seeds of the sessions, one entry per curve and
+// session. Entries are wiped together with any session.
+#define ROOT_NODES_COUNT 4
+
+typedef struct {
+  const Session *session;
+  HDNode node;
+} RootNode;
+
+static CONFIDENTIAL RootNode rootNodesCache[ROOT_NODES_COUNT];
+static uint8_t rootNodesNext = 0;
+
+// ECDH session keys, identified by a hash of the curve, the path and the peer
+// public key, so that host apps asking for the same peer in every message
+// do not pay for a point multiplication each time. Entries are wiped
+// together with any session.
+#define SHARED_KEYS_COUNT 4
+
+typedef struct {
+  const Session *session;
+  uint8_t id[32];
+  uint8_t session_key[65];
+  int session_key_size;
+} SharedKey;
+
+static CONFIDENTIAL SharedKey sharedKeysCache[SHARED_KEYS_COUNT];
+static uint8_t sharedKeysNext = 0;
+
 static uint32_t sessionUseCounter = 0;
 
 #define autoLockDelayMsDefault (10 * 60 * 1000U)  // 10 minutes
@@ -432,6 +460,10 @@ void session_clear(bool lock) {
     session_clearCache(sessionsCache + i);
   }
   activeSessionCache = NULL;
+#if USE_BIP32_CACHE
+  hdnode_ckd_cache_clear();
+#endif
+  u2f_clear_cache();
   if (lock) {
     config_lockDevice();
   }
@@ -442,6 +474,10 @@ void session_clearCache(Session *session) {
   memzero(session->id, sizeof(session->id));
   memzero(session->seed, sizeof(session->seed));
   session->seedCached = false;
+  memzero(rootNodesCache, sizeof(rootNodesCache));
+  rootNodesNext = 0;
+  memzero(sharedKeysCache, sizeof(sharedKeysCache));
+  sharedKeysNext = 0;
 }
 
 void config_lockDevice(void) { storage_lock(); }
@@ -651,11 +687,56 @@ bool config_getRootNode(HDNode *node, const char *curve) {
   if (seed == NULL) {
     return false;
   }
+  const curve_info *info = get_curve_by_name(curve);
+  for (uint8_t i = 0; i < ROOT_NODES_COUNT; i++) {
+    const RootNode *cached = &rootNodesCache[i];
+    if (info != NULL && cached->session == activeSessionCache &&
+        cached->node.curve == info) {
+      memcpy(node, &cached->node, sizeof(HDNode));
+      return true;
+    }
+  }
   int result = hdnode_from_seed(seed, 64, curve, node);
   if (result == 0) {
     fsm_sendFailure(FailureType_Failure_NotInitialized, _("Unsupported curve"));
+    return false;
+  }
+  RootNode *cached = &rootNodesCache[rootNodesNext];
+  rootNodesNext = (rootNodesNext + 1) % ROOT_NODES_COUNT;
+  cached->session = activeSessionCache;
+  memcpy(&cached->node, node, sizeof(HDNode));
+  return true;
+}
+
+bool config_getSharedKey(const uint8_t id[32], uint8_t session_key[65],
+                         int *session_key_size) {
+  if (activeSessionCache == NULL) {
+    return false;
+  }
+  for (uint8_t i = 0; i < SHARED_KEYS_COUNT; i++) {
+    const SharedKey *cached = &sharedKeysCache[i];
+    if (cached->session == activeSessionCache &&
+        memcmp(cached->id, id, sizeof(cached->id)) == 0) {
+      memcpy(session_key, cached->session_key, cached->session_key_size);
+      *session_key_size = cached->session_key_size;
+      return true;
+    }
+  }
+  return false;
+}
+
+void config_setSharedKey(const uint8_t id[32], const uint8_t *session_key,
+                         int session_key_size) {
+  if (activeSessionCache == NULL || session_key_size < 0 ||
+      session_key_size > 65) {
+    return;
   }
-  return result;
+  SharedKey *cached = &sharedKeysCache[sharedKeysNext];
+  sharedKeysNext = (sharedKeysNext + 1) % SHARED_KEYS_COUNT;
+  cached->session = activeSessionCache;
+  memcpy(cached->id, id, sizeof(cached->id));
+  memcpy(cached->session_key, session_key, session_key_size);
+  cached->session_key_size = session_key_size;
 }
 
 bool config_getLabel(char *dest, uint16_t dest_size) {
@@ -96,6 +96,10 @@ const uint8_t *config_getSeed(void);
 
 bool config_getU2FRoot(HDNode *node);
 bool config_getRootNode(HDNode *node, const char *curve);
+bool config_getSharedKey(const uint8_t id[32], uint8_t session_key[65],
+                         int *session_key_size);
+void config_setSharedKey(const uint8_t id[32], const uint8_t *session_key,
+                         int session_key_size);
 
 bool config_getLabel(char *dest, uint16_t dest_size);
 void config_setLabel(const char *label);
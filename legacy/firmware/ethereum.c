@@ -40,6 +40,10 @@
 /* maximum supported chain id.  v must fit in an uint32_t. */
 #define MAX_CHAIN_ID 2147483629
 
+/* maximum number of data bytes requested in one EthereumTxRequest, must match
+ * the max_size of EthereumTxAck.data_chunk */
+#define MAX_DATA_CHUNK 8192
+
 static bool ethereum_signing = false;
 static uint32_t data_total, data_left;
 static EthereumTxRequest msg_tx_request;
@@ -170,9 +174,10 @@ static int rlp_calculate_number_length(uint32_t number) {
 static void send_request_chunk(void) {
   int progress = 1000 - (data_total > 1000000 ? data_left / (data_total / 800)
                                               : data_left * 800 / data_total);
-  layoutProgress(_("Signing"), progress);
+  layoutProgressStep(_("Signing"), progress);
   msg_tx_request.has_data_length = true;
-  msg_tx_request.data_length = data_left <= 1024 ? data_left : 1024;
+  msg_tx_request.data_length =
+      data_left <= MAX_DATA_CHUNK ? data_left : MAX_DATA_CHUNK;
   msg_write(MessageType_MessageType_EthereumTxRequest, &msg_tx_request);
 }
 
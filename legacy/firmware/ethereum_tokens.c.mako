@@ -5,7 +5,7 @@
 #include "ethereum_tokens.h"
 
 const TokenType tokens[TOKENS_COUNT] = {
-% for t in supported_on("trezor1", erc20):
+% for t in sorted(supported_on("trezor1", erc20), key=lambda t: (t.chain_id, t.address_bytes)):
 	{${"{:>2}".format(t.chain_id)}, ${c_str(t.address_bytes)}, " ${ascii(t.symbol)}", ${t.decimals}}, // ${t.chain} / ${t.name}
 % endfor
 };
@@ -16,9 +16,22 @@ const TokenType *UnknownToken = &_UnknownToken;
 const TokenType *tokenByChainAddress(uint32_t chain_id, const uint8_t *address)
 {
 	if (!address) return 0;
-	for (int i = 0; i < TOKENS_COUNT; i++) {
-		if (chain_id == tokens[i].chain_id && memcmp(address, tokens[i].address, 20) == 0) {
-			return &(tokens[i]);
+	// tokens are sorted by chain_id and address
+	int lo = 0, hi = TOKENS_COUNT;
+	while (lo < hi) {
+		int mid = lo + (hi - lo) / 2;
+		int cmp;
+		if (chain_id != tokens[mid].chain_id) {
+			cmp = chain_id < tokens[mid].chain_id ? -1 : 1;
+		} else {
+			cmp = memcmp(address, tokens[mid].address, 20);
+		}
+		if (cmp == 0) {
+			return &(tokens[mid]);
+		} else if (cmp < 0) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
 		}
 	}
 	return UnknownToken;
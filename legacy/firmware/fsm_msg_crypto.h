@@ -21,9 +21,20 @@ void fsm_msgCipherKeyValue(const CipherKeyValue *msg) {
   CHECK_INITIALIZED
 
   CHECK_PARAM(msg->has_key, _("No key provided"));
-  CHECK_PARAM(msg->has_value, _("No value provided"));
-  CHECK_PARAM(msg->value.size % 16 == 0,
-              _("Value length must be a multiple of 16"));
+  bool batch = msg->values_count > 0;
+  if (batch) {
+    CHECK_PARAM(!msg->has_value, _("Cannot combine value and values"));
+    CHECK_PARAM(msg->ivs_count == 0 || msg->ivs_count == msg->values_count,
+                _("Number of ivs must match number of values"));
+    for (pb_size_t i = 0; i < msg->values_count; i++) {
+      CHECK_PARAM(msg->values[i].size % 16 == 0,
+                  _("Value length must be a multiple of 16"));
+    }
+  } else {
+    CHECK_PARAM(msg->has_value, _("No value provided"));
+    CHECK_PARAM(msg->value.size % 16 == 0,
+                _("Value length must be a multiple of 16"));
+  }
 
   CHECK_PIN
 
@@ -56,19 +67,48 @@ void fsm_msgCipherKeyValue(const CipherKeyValue *msg) {
   }
 
   RESP_INIT(CipheredKeyValue);
+  // the key schedule is computed once and shared by all the values of a batch
+  aes_encrypt_ctx encrypt_ctx;
+  aes_decrypt_ctx decrypt_ctx;
   if (encrypt) {
-    aes_encrypt_ctx ctx;
-    aes_encrypt_key256(data, &ctx);
-    aes_cbc_encrypt(msg->value.bytes, resp->value.bytes, msg->value.size,
-                    data + 32, &ctx);
+    aes_encrypt_key256(data, &encrypt_ctx);
   } else {
-    aes_decrypt_ctx ctx;
-    aes_decrypt_key256(data, &ctx);
-    aes_cbc_decrypt(msg->value.bytes, resp->value.bytes, msg->value.size,
-                    data + 32, &ctx);
+    aes_decrypt_key256(data, &decrypt_ctx);
   }
-  resp->has_value = true;
-  resp->value.size = msg->value.size;
+  if (batch) {
+    uint8_t iv[16];
+    for (pb_size_t i = 0; i < msg->values_count; i++) {
+      // the CBC functions update the iv in place
+      if (msg->ivs_count > 0 && msg->ivs[i].size == 16) {
+        memcpy(iv, msg->ivs[i].bytes, 16);
+      } else {
+        memcpy(iv, data + 32, 16);
+      }
+      if (encrypt) {
+        aes_cbc_encrypt(msg->values[i].bytes, resp->values[i].bytes,
+                        msg->values[i].size, iv, &encrypt_ctx);
+      } else {
+        aes_cbc_decrypt(msg->values[i].bytes, resp->values[i].bytes,
+                        msg->values[i].size, iv, &decrypt_ctx);
+      }
+      resp->values[i].size = msg->values[i].size;
+    }
+    resp->values_count = msg->values_count;
+    memzero(iv, sizeof(iv));
+  } else {
+    if (encrypt) {
+      aes_cbc_encrypt(msg->value.bytes, resp->value.bytes, msg->value.size,
+                      data + 32, &encrypt_ctx);
+    } else {
+      aes_cbc_decrypt(msg->value.bytes, resp->value.bytes, msg->value.size,
+                      data + 32, &decrypt_ctx);
+    }
+    resp->has_value = true;
+    resp->value.size = msg->value.size;
+  }
+  memzero(&encrypt_ctx, sizeof(encrypt_ctx));
+  memzero(&decrypt_ctx, sizeof(decrypt_ctx));
+  memzero(data, sizeof(data));
   msg_write(MessageType_MessageType_CipheredKeyValue, resp);
   layoutHome();
 }
@@ -207,12 +247,30 @@ void fsm_msgGetECDHSessionKey(const GetECDHSessionKey *msg) {
     curve = msg->ecdsa_curve_name;
   }
 
+  // the session key is cached under the curve, the path and the peer key
+  uint8_t id[32];
+  SHA256_CTX ctx;
+  sha256_Init(&ctx);
+  sha256_Update(&ctx, (const uint8_t *)curve, strlen(curve) + 1);
+  sha256_Update(&ctx, (const uint8_t *)address_n, sizeof(address_n));
+  sha256_Update(&ctx, msg->peer_public_key.bytes, msg->peer_public_key.size);
+  sha256_Final(&ctx, id);
+
+  int result_size = 0;
+  if (config_getSharedKey(id, resp->session_key.bytes, &result_size)) {
+    resp->has_session_key = true;
+    resp->session_key.size = result_size;
+    msg_write(MessageType_MessageType_ECDHSessionKey, resp);
+    layoutHome();
+    return;
+  }
+
   const HDNode *node = fsm_getDerivedNode(curve, address_n, 5, NULL);
   if (!node) return;
 
-  int result_size = 0;
   if (hdnode_get_shared_key(node, msg->peer_public_key.bytes,
                             resp->session_key.bytes, &result_size) == 0) {
+    config_setSharedKey(id, resp->session_key.bytes, result_size);
     resp->has_session_key = true;
     resp->session_key.size = result_size;
     msg_write(MessageType_MessageType_ECDHSessionKey, resp);
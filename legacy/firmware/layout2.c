@@ -241,6 +241,33 @@ void layoutProgressSwipe(const char *desc, int permil) {
   layoutProgress(desc, permil);
 }
 
+// The progress screen is redrawn at least this often to animate the gears.
+#define PROGRESS_ANIMATION_MS 100
+
+// Called on every signing step. The screen is only redrawn when the bar
+// advances by a pixel column, so that signing does not wait for the display.
+void layoutProgressStep(const char *desc, int permil) {
+  static const char *last_desc = NULL;
+  static int last_column = -1;
+  static uint32_t last_generation = 0;
+  static uint32_t last_ms = 0;
+
+  // Same scaling as the bar drawn by layoutProgress.
+  int column = permil * (OLED_WIDTH - 4) / 1000;
+  uint32_t now = timer_ms();
+  if (desc == last_desc && column == last_column &&
+      oledGeneration() == last_generation &&
+      now - last_ms < PROGRESS_ANIMATION_MS) {
+    return;
+  }
+
+  layoutProgress(desc, permil);
+  last_desc = desc;
+  last_column = column;
+  last_generation = oledGeneration();
+  last_ms = now;
+}
+
 void layoutScreensaver(void) {
   layoutLast = layoutScreensaver;
   oledClear();
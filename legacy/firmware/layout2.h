@@ -43,6 +43,7 @@ void layoutDialogSwipe(const BITMAP *icon, const char *btnNo,
                        const char *line2, const char *line3, const char *line4,
                        const char *line5, const char *line6);
 void layoutProgressSwipe(const char *desc, int permil);
+void layoutProgressStep(const char *desc, int permil);
 
 void layoutScreensaver(void);
 void layoutHome(void);
@@ -225,6 +225,12 @@ void msg_process(char type, uint16_t msg_id, const pb_msgdesc_t *fields,
   }
 }
 
+/*
+ * Reassembles a message from 64-byte reports and decodes it once complete.
+ * The decoder cannot run while the message streams in. It would have to wait
+ * for reports from inside a pb_istream callback, but reports are handed over
+ * by usbPoll(), which may itself be running inside a message handler.
+ */
 void msg_read_common(char type, const uint8_t *buf, uint32_t len) {
   static char read_state = READSTATE_IDLE;
   static uint8_t msg_in[MSG_IN_SIZE];
@@ -66,6 +66,9 @@ static uint8_t pubkey[33], sig[64];
 static uint8_t hash_prevouts[32], hash_sequence[32], hash_outputs[32];
 #if !BITCOIN_ONLY
 static uint8_t decred_hash_prefix[32];
+// witness hash state after the header and the empty scripts of the inputs
+// signed so far, forked into ti for each input
+static TxStruct ti_decred_witness;
 #endif
 static uint8_t hash_check[32];
 static uint64_t to_spend, spending, change_spend;
@@ -856,7 +859,7 @@ static bool signing_check_output(TxOutputType *txoutput) {
   spending += txoutput->amount;
   int co = compile_output(coin, &root, txoutput, &bin_output, !is_change);
   if (!is_change) {
-    layoutProgress(_("Signing transaction"), progress);
+    layoutProgressStep(_("Signing transaction"), progress);
   }
   if (co < 0) {
     fsm_sendFailure(FailureType_Failure_ActionCancelled, NULL);
@@ -1240,11 +1243,7 @@ void signing_txack(TransactionType *tx) {
     return;
   }
 
-  static int update_ctr = 0;
-  if (update_ctr++ == 20) {
-    layoutProgress(_("Signing transaction"), progress);
-    update_ctr = 0;
-  }
+  layoutProgressStep(_("Signing transaction"), progress);
 
   memzero(&resp, sizeof(TxRequest));
 
@@ -1755,14 +1754,16 @@ void signing_txack(TransactionType *tx) {
                 coin->curve->hasher_sign, coin->overwintered, version_group_id,
                 timestamp);
         to.is_decred = true;
+
+        // witness hash
+        tx_init(&ti_decred_witness, inputs_count, outputs_count, version,
+                lock_time, expiry, 0, coin->curve->hasher_sign,
+                coin->overwintered, version_group_id, timestamp);
+        ti_decred_witness.version |= (DECRED_SERIALIZE_WITNESS_SIGNING << 16);
+        ti_decred_witness.is_decred = true;
       }
 
-      // witness hash
-      tx_init(&ti, inputs_count, outputs_count, version, lock_time, expiry, 0,
-              coin->curve->hasher_sign, coin->overwintered, version_group_id,
-              timestamp);
-      ti.version |= (DECRED_SERIALIZE_WITNESS_SIGNING << 16);
-      ti.is_decred = true;
+      memcpy(&ti, &ti_decred_witness, sizeof(TxStruct));
       if (!compile_input_script_sig(&tx->inputs[0])) {
         fsm_sendFailure(FailureType_Failure_ProcessError,
                         _("Failed to compile input"));
@@ -1770,7 +1771,7 @@ void signing_txack(TransactionType *tx) {
         return;
       }
 
-      for (idx2 = 0; idx2 < inputs_count; idx2++) {
+      for (idx2 = idx1; idx2 < inputs_count; idx2++) {
         uint32_t r = 0;
         if (idx2 == idx1) {
           r = tx_serialize_decred_witness_hash(&ti, &tx->inputs[0]);
@@ -1786,6 +1787,9 @@ void signing_txack(TransactionType *tx) {
         }
       }
 
+      // the input signed next hashes an empty script for this one
+      tx_serialize_decred_witness_hash(&ti_decred_witness, NULL);
+
       if (!signing_sign_decred_input(&tx->inputs[0])) {
         return;
       }
@@ -1474,37 +1474,23 @@ const HDNode *stellar_deriveNode(const uint32_t *address_n,
 }
 
 void stellar_hashupdate_uint32(uint32_t value) {
-  // Ensure uint32 is big endian
-#if BYTE_ORDER == LITTLE_ENDIAN
-  REVERSE32(value, value);
-#endif
-
   // Byte values must be hashed as big endian
   uint8_t data[4] = {0};
-  data[3] = (value >> 24) & 0xFF;
-  data[2] = (value >> 16) & 0xFF;
-  data[1] = (value >> 8) & 0xFF;
-  data[0] = value & 0xFF;
+  data[0] = (value >> 24) & 0xFF;
+  data[1] = (value >> 16) & 0xFF;
+  data[2] = (value >> 8) & 0xFF;
+  data[3] = value & 0xFF;
 
   stellar_hashupdate_bytes(data, sizeof(data));
 }
 
 void stellar_hashupdate_uint64(uint64_t value) {
-  // Ensure uint64 is big endian
-#if BYTE_ORDER == LITTLE_ENDIAN
-  REVERSE64(value, value);
-#endif
-
   // Byte values must be hashed as big endian
   uint8_t data[8] = {0};
-  data[7] = (value >> 56) & 0xFF;
-  data[6] = (value >> 48) & 0xFF;
-  data[5] = (value >> 40) & 0xFF;
-  data[4] = (value >> 32) & 0xFF;
-  data[3] = (value >> 24) & 0xFF;
-  data[2] = (value >> 16) & 0xFF;
-  data[1] = (value >> 8) & 0xFF;
-  data[0] = value & 0xFF;
+  for (int i = 7; i >= 0; i--) {
+    data[i] = value & 0xFF;
+    value >>= 8;
+  }
 
   stellar_hashupdate_bytes(data, sizeof(data));
 }
@@ -1525,13 +1511,9 @@ void stellar_hashupdate_string(const uint8_t *data, size_t len) {
   stellar_hashupdate_bytes(data, len);
 
   // If len isn't a multiple of 4, add padding bytes
-  int remainder = len % 4;
-  uint8_t null_byte[1] = {0x00};
-  if (remainder) {
-    while (remainder < 4) {
-      stellar_hashupdate_bytes(null_byte, 1);
-      remainder++;
-    }
+  static const uint8_t padding[3] = {0};
+  if (len % 4) {
+    stellar_hashupdate_bytes(padding, 4 - len % 4);
   }
 }
 
@@ -158,6 +158,7 @@ int main(void) {
   for (;;) {
     usbPoll();
     check_lock_screen();
+    usbIdle();
   }
 
   return 0;
@@ -31,6 +31,7 @@
 #include "memzero.h"
 #include "nist256p1.h"
 #include "rng.h"
+#include "timer.h"
 #include "trezor.h"
 #include "usb.h"
 #include "util.h"
@@ -43,7 +44,13 @@
 
 // About 1/2 Second according to values used in protect.c
 #define U2F_TIMEOUT (800000 / 2)
-#define U2F_OUT_PKT_BUFFER_LEN 130
+
+// Number of packets in the output ring (a power of two below 256), enough for
+// the registration and authentication responses. Longer responses wait for
+// the host to read the ring. When the host does not read any packet for
+// U2F_OUT_TIMEOUT_MS, the rest of the response is dropped.
+#define U2F_OUT_RING_SIZE 16
+#define U2F_OUT_TIMEOUT_MS 500
 
 // Initialise without a cid
 static uint32_t cid = 0;
@@ -51,10 +58,13 @@ static uint32_t cid = 0;
 // The channel ID of the last successful U2F_AUTHENTICATE check-only request.
 static uint32_t last_good_auth_check_cid = 0;
 
-// Circular Output buffer
-static uint32_t u2f_out_start = 0;
-static uint32_t u2f_out_end = 0;
-static uint8_t u2f_out_packets[U2F_OUT_PKT_BUFFER_LEN][HID_RPT_SIZE];
+// Output ring, filled by queue_u2f_pkt() and drained by the USB interrupt
+// handler through u2f_out_data() and u2f_out_release(). The indices run freely
+// and are reduced modulo U2F_OUT_RING_SIZE.
+static volatile uint8_t u2f_out_head = 0;  // advanced in thread mode
+static volatile uint8_t u2f_out_tail = 0;  // advanced by the interrupt handler
+static uint8_t u2f_out_packets[U2F_OUT_RING_SIZE][HID_RPT_SIZE];
+static bool u2f_out_stalled = false;
 
 #define U2F_PUBKEY_LEN 65
 #define KEY_PATH_LEN 32
@@ -63,6 +73,22 @@ static uint8_t u2f_out_packets[U2F_OUT_PKT_BUFFER_LEN][HID_RPT_SIZE];
 // Derivation path is m/U2F'/r'/r'/r'/r'/r'/r'/r'/r'
 #define KEY_PATH_ENTRIES (KEY_PATH_LEN / sizeof(uint32_t))
 
+// Nodes of the most recently used key handles. Browsers probe the same
+// handles with check-only requests and then repeat the authenticate request
+// until the user confirms it.
+#define NODE_CACHE_SIZE 4
+
+typedef struct {
+  bool set;
+  // chain code of the U2F root the node was derived from
+  uint8_t root_chain_code[32];
+  uint32_t key_path[KEY_PATH_ENTRIES];
+  HDNode node;
+} NodeCacheEntry;
+
+static CONFIDENTIAL NodeCacheEntry node_cache[NODE_CACHE_SIZE];
+static uint8_t node_cache_next = 0;
+
 // Defined as UsbSignHandler.BOGUS_APP_ID_HASH
 // in
 // https://github.com/google/u2f-ref-code/blob/master/u2f-chrome-extension/usbsignhandler.js#L118
@@ -319,23 +345,35 @@ void u2fhid_init(const U2FHID_FRAME *in) {
 
 void queue_u2f_pkt(const U2FHID_FRAME *u2f_pkt) {
   // debugLog(0, "", "u2f_write_pkt");
-  uint32_t next = (u2f_out_end + 1) % U2F_OUT_PKT_BUFFER_LEN;
-  if (u2f_out_start == next) {
-    debugLog(0, "", "u2f_write_pkt full");
-    return;  // Buffer full :(
+  uint32_t start = timer_ms();
+  while ((uint8_t)(u2f_out_head - u2f_out_tail) == U2F_OUT_RING_SIZE) {
+    // the ring drains while the host reads the endpoint
+    usbWriteU2f();
+    if (u2f_out_stalled || timer_ms() - start > U2F_OUT_TIMEOUT_MS) {
+      debugLog(0, "", "u2f_write_pkt full");
+      u2f_out_stalled = true;
+      return;  // Buffer full :(
+    }
   }
-  memcpy(u2f_out_packets[u2f_out_end], u2f_pkt, HID_RPT_SIZE);
-  u2f_out_end = next;
+  u2f_out_stalled = false;
+  memcpy(u2f_out_packets[u2f_out_head % U2F_OUT_RING_SIZE], u2f_pkt,
+         HID_RPT_SIZE);
+  // publish the packet only after it is copied
+  __asm__ volatile("" ::: "memory");
+  u2f_out_head++;
+  usbWriteU2f();
 }
 
-uint8_t *u2f_out_data(void) {
-  if (u2f_out_start == u2f_out_end) return NULL;  // No data
-  // debugLog(0, "", "u2f_out_data");
-  uint32_t t = u2f_out_start;
-  u2f_out_start = (u2f_out_start + 1) % U2F_OUT_PKT_BUFFER_LEN;
-  return u2f_out_packets[t];
+// called from the USB interrupt handler
+const uint8_t *u2f_out_data(void) {
+  if (u2f_out_tail == u2f_out_head) return NULL;  // No data
+  return u2f_out_packets[u2f_out_tail % U2F_OUT_RING_SIZE];
 }
 
+// called from the USB interrupt handler once the packet from u2f_out_data()
+// is written to the endpoint
+void u2f_out_release(void) { u2f_out_tail++; }
+
 void u2fhid_msg(const APDU *a, uint32_t len) {
   if ((APDU_LEN(*a) + sizeof(APDU)) > len) {
     debugLog(0, "", "BAD APDU LENGTH");
@@ -452,6 +490,11 @@ static void getReadableAppId(const uint8_t appid[U2F_APPID_SIZE],
   *appname = buf;
 }
 
+void u2f_clear_cache(void) {
+  memzero(node_cache, sizeof(node_cache));
+  node_cache_next = 0;
+}
+
 static const HDNode *getDerivedNode(uint32_t *address_n,
                                     size_t address_n_count) {
   static CONFIDENTIAL HDNode node;
@@ -463,13 +506,41 @@ static const HDNode *getDerivedNode(uint32_t *address_n,
   if (!address_n || address_n_count == 0) {
     return &node;
   }
+
+  // the root is compared too, so that a new seed never hits a stale entry
+  bool cacheable = (address_n_count == KEY_PATH_ENTRIES);
+  if (cacheable) {
+    for (size_t i = 0; i < NODE_CACHE_SIZE; i++) {
+      NodeCacheEntry *entry = &node_cache[i];
+      if (entry->set &&
+          memcmp(entry->root_chain_code, node.chain_code, 32) == 0 &&
+          memcmp(entry->key_path, address_n, KEY_PATH_LEN) == 0) {
+        memcpy(&node, &entry->node, sizeof(HDNode));
+        return &node;
+      }
+    }
+  }
+
+  uint8_t root_chain_code[32] = {0};
+  memcpy(root_chain_code, node.chain_code, 32);
   for (size_t i = 0; i < address_n_count; i++) {
     if (hdnode_private_ckd(&node, address_n[i]) == 0) {
+      memzero(root_chain_code, sizeof(root_chain_code));
       layoutHome();
       debugLog(0, "", "ERR: Derive private failed");
       return 0;
     }
   }
+
+  if (cacheable) {
+    NodeCacheEntry *entry = &node_cache[node_cache_next];
+    node_cache_next = (node_cache_next + 1) % NODE_CACHE_SIZE;
+    entry->set = true;
+    memcpy(entry->root_chain_code, root_chain_code, 32);
+    memcpy(entry->key_path, address_n, KEY_PATH_LEN);
+    memcpy(&entry->node, &node, sizeof(HDNode));
+  }
+  memzero(root_chain_code, sizeof(root_chain_code));
   return &node;
 }
 
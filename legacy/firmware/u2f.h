@@ -47,10 +47,12 @@ void u2fhid_lock(const uint8_t *buf, uint32_t len);
 void u2fhid_msg(const APDU *a, uint32_t len);
 void queue_u2f_pkt(const U2FHID_FRAME *u2f_pkt);
 
-uint8_t *u2f_out_data(void);
+const uint8_t *u2f_out_data(void);
+void u2f_out_release(void);
 void u2f_register(const APDU *a);
 void u2f_version(const APDU *a);
 void u2f_authenticate(const APDU *a);
+void u2f_clear_cache(void);
 
 void send_u2f_msg(const uint8_t *data, uint32_t len);
 void send_u2f_error(uint16_t err);
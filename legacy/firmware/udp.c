@@ -40,28 +40,36 @@ void usbPoll(void) {
 
   static uint8_t buffer[64];
 
+  // Drain all queued datagrams, so that a multi-packet message is reassembled
+  // in a single poll. A tiny message is handed over one packet at a time, as
+  // the caller consumes msg_tiny before the next one may overwrite it.
   int iface = 0;
-  if (emulatorSocketRead(&iface, buffer, sizeof(buffer)) > 0) {
+  while (emulatorSocketRead(&iface, buffer, sizeof(buffer)) > 0) {
     if (!tiny) {
       msg_read_common(_ISDBG, buffer, sizeof(buffer));
     } else {
       msg_read_tiny(buffer, sizeof(buffer));
+      break;
     }
   }
 
-  const uint8_t *data = msg_out_data();
-  if (data != NULL) {
+  const uint8_t *data = NULL;
+  while ((data = msg_out_data()) != NULL) {
     emulatorSocketWrite(0, data, 64);
   }
 
 #if DEBUG_LINK
-  data = msg_debug_out_data();
-  if (data != NULL) {
+  while ((data = msg_debug_out_data()) != NULL) {
     emulatorSocketWrite(1, data, 64);
   }
 #endif
 }
 
+void usbIdle(void) {}
+
+// the emulator has no U2F interface
+void usbWriteU2f(void) {}
+
 char usbTiny(char set) {
   char old = tiny;
   tiny = set;
@@ -69,6 +77,14 @@ char usbTiny(char set) {
 }
 
 void usbSleep(uint32_t millis) {
+  // Without a display nobody watches the delays and animations, so the clock
+  // skips over them.
+  if (emulatorHeadless()) {
+    usbPoll();
+    emulatorClockAdvance(millis);
+    return;
+  }
+
   uint32_t start = timer_ms();
 
   while ((timer_ms() - start) < millis) {
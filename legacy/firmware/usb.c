@@ -19,11 +19,14 @@
 
 #include <libopencm3/usb/hid.h>
 #include <libopencm3/usb/usbd.h>
+#include <string.h>
 
 #include "common.h"
 #include "config.h"
 #include "debug.h"
+#include "memzero.h"
 #include "messages.h"
+#include "supervise.h"
 #include "timer.h"
 #include "trezor.h"
 #if U2F_ENABLED
@@ -301,45 +304,138 @@ static enum usbd_request_return_codes hid_control_request(
   return 1;
 }
 
-static void u2f_rx_callback(usbd_device *dev, uint8_t ep) {
-  (void)ep;
-  static CONFIDENTIAL uint8_t buf[64] __attribute__((aligned(4)));
+#endif
 
-  debugLog(0, "", "u2f_rx_callback");
-  if (usbd_ep_read_packet(dev, ENDPOINT_ADDRESS_U2F_OUT, buf, 64) != 64) return;
-  u2fhid_read(tiny, (const U2FHID_FRAME *)(void *)buf);
-}
+/*
+ * Packets are read from the OUT endpoints by the USB interrupt handler and
+ * queued in a ring. usbPoll() and usbSleep() hand them to the message layer in
+ * thread mode, so no message is ever processed in the interrupt handler.
+ */
+#define USB_RX_RING_SIZE 16
+/*
+ * Once fewer slots are free, the OUT endpoints NAK until the ring is drained,
+ * because a few packets may already be waiting in the OTG FIFO.
+ */
+#define USB_RX_RING_RESERVE 4
+
+typedef struct {
+  uint8_t buf[64] __attribute__((aligned(4)));
+  uint8_t ep;
+} usb_packet;
 
+static CONFIDENTIAL usb_packet usb_rx_ring[USB_RX_RING_SIZE];
+static volatile uint8_t usb_rx_head = 0;  // advanced by the interrupt handler
+static volatile uint8_t usb_rx_tail = 0;  // advanced in thread mode
+static volatile bool usb_rx_nak = false;
+
+static const uint8_t usb_out_endpoints[] = {
+    ENDPOINT_ADDRESS_MAIN_OUT,
+#if U2F_ENABLED
+    ENDPOINT_ADDRESS_U2F_OUT,
+#endif
+#if DEBUG_LINK
+    ENDPOINT_ADDRESS_DEBUG_OUT,
 #endif
+};
 
-static void main_rx_callback(usbd_device *dev, uint8_t ep) {
-  (void)ep;
-  static CONFIDENTIAL uint8_t buf[64] __attribute__((aligned(4)));
-  if (usbd_ep_read_packet(dev, ENDPOINT_ADDRESS_MAIN_OUT, buf, 64) != 64)
-    return;
-  debugLog(0, "", "main_rx_callback");
-  if (!tiny) {
-    msg_read(buf, 64);
-  } else {
-    msg_read_tiny(buf, 64);
+static uint8_t usb_rx_free(void) {
+  return (usb_rx_tail + USB_RX_RING_SIZE - usb_rx_head - 1) % USB_RX_RING_SIZE;
+}
+
+static void usb_rx_set_nak(usbd_device *dev, uint8_t nak) {
+  for (size_t i = 0; i < sizeof(usb_out_endpoints); i++) {
+    usbd_ep_nak_set(dev, usb_out_endpoints[i], nak);
+  }
+  usb_rx_nak = nak;
+}
+
+// called from the USB interrupt handler
+static void rx_callback(usbd_device *dev, uint8_t ep) {
+  uint8_t head = usb_rx_head;
+  if (usb_rx_free() == 0) {
+    return;  // cannot happen while the endpoints NAK in time
+  }
+  if (usbd_ep_read_packet(dev, ep, usb_rx_ring[head].buf, 64) != 64) return;
+  usb_rx_ring[head].ep = ep;
+  usb_rx_head = (head + 1) % USB_RX_RING_SIZE;
+  if (usb_rx_free() < USB_RX_RING_RESERVE) {
+    usb_rx_set_nak(dev, 1);
   }
 }
 
+static void usb_rx_dispatch(usbd_device *dev) {
+  while (usb_rx_tail != usb_rx_head) {
+    // Release the slot before handling the packet, the message handlers poll
+    // USB again while they wait for the user.
+    uint8_t buf[64] __attribute__((aligned(4)));
+    uint8_t tail = usb_rx_tail;
+    uint8_t ep = usb_rx_ring[tail].ep;
+    memcpy(buf, usb_rx_ring[tail].buf, 64);
+    memzero(usb_rx_ring[tail].buf, 64);
+    usb_rx_tail = (tail + 1) % USB_RX_RING_SIZE;
+
+    if (usb_rx_nak) {
+      svc_usb_irq(0);
+      if (usb_rx_free() >= USB_RX_RING_RESERVE) {
+        usb_rx_set_nak(dev, 0);
+      }
+      svc_usb_irq(1);
+    }
+
+    switch (ep) {
+      case ENDPOINT_ADDRESS_MAIN_OUT:
+        debugLog(0, "", "main_rx_callback");
+        if (!tiny) {
+          msg_read(buf, 64);
+        } else {
+          msg_read_tiny(buf, 64);
+        }
+        break;
+#if U2F_ENABLED
+      case ENDPOINT_ADDRESS_U2F_OUT:
+        debugLog(0, "", "u2f_rx_callback");
+        u2fhid_read(tiny, (const U2FHID_FRAME *)(void *)buf);
+        break;
+#endif
 #if DEBUG_LINK
+      case ENDPOINT_ADDRESS_DEBUG_OUT:
+        debugLog(0, "", "debug_rx_callback");
+        if (!tiny) {
+          msg_debug_read(buf, 64);
+        } else {
+          msg_read_tiny(buf, 64);
+        }
+        break;
+#endif
+      default:
+        break;
+    }
+    memzero(buf, sizeof(buf));
+  }
+}
 
-static void debug_rx_callback(usbd_device *dev, uint8_t ep) {
-  (void)ep;
-  static uint8_t buf[64] __attribute__((aligned(4)));
-  if (usbd_ep_read_packet(dev, ENDPOINT_ADDRESS_DEBUG_OUT, buf, 64) != 64)
-    return;
-  debugLog(0, "", "debug_rx_callback");
-  if (!tiny) {
-    msg_debug_read(buf, 64);
+#if U2F_ENABLED
+// Set while a packet written to the U2F IN endpoint waits for the host. Its
+// transfer complete interrupt writes the next packet from the U2F output
+// ring, so that a response goes out as fast as the host polls the endpoint.
+static volatile bool u2f_tx_busy = false;
+
+static void u2f_tx_next(usbd_device *dev) {
+  const uint8_t *data = u2f_out_data();
+  if (data != NULL &&
+      usbd_ep_write_packet(dev, ENDPOINT_ADDRESS_U2F_IN, data, 64) == 64) {
+    u2f_out_release();
+    u2f_tx_busy = true;
   } else {
-    msg_read_tiny(buf, 64);
+    u2f_tx_busy = false;
   }
 }
 
+// called from the USB interrupt handler
+static void u2f_tx_callback(usbd_device *dev, uint8_t ep) {
+  (void)ep;
+  u2f_tx_next(dev);
+}
 #endif
 
 static void set_config(usbd_device *dev, uint16_t wValue) {
@@ -348,18 +444,19 @@ static void set_config(usbd_device *dev, uint16_t wValue) {
   usbd_ep_setup(dev, ENDPOINT_ADDRESS_MAIN_IN, USB_ENDPOINT_ATTR_INTERRUPT, 64,
                 0);
   usbd_ep_setup(dev, ENDPOINT_ADDRESS_MAIN_OUT, USB_ENDPOINT_ATTR_INTERRUPT, 64,
-                main_rx_callback);
+                rx_callback);
 #if U2F_ENABLED
   usbd_ep_setup(dev, ENDPOINT_ADDRESS_U2F_IN, USB_ENDPOINT_ATTR_INTERRUPT, 64,
-                0);
+                u2f_tx_callback);
+  u2f_tx_busy = false;
   usbd_ep_setup(dev, ENDPOINT_ADDRESS_U2F_OUT, USB_ENDPOINT_ATTR_INTERRUPT, 64,
-                u2f_rx_callback);
+                rx_callback);
 #endif
 #if DEBUG_LINK
   usbd_ep_setup(dev, ENDPOINT_ADDRESS_DEBUG_IN, USB_ENDPOINT_ATTR_INTERRUPT, 64,
                 0);
   usbd_ep_setup(dev, ENDPOINT_ADDRESS_DEBUG_OUT, USB_ENDPOINT_ATTR_INTERRUPT,
-                64, debug_rx_callback);
+                64, rx_callback);
 #endif
 #if U2F_ENABLED
   usbd_register_control_callback(
@@ -393,6 +490,39 @@ void usbInit(void) {
   // Debug link interface does not have WinUSB set;
   // if you really need debug link on windows, edit the descriptor in winusb.c
   winusb_setup(usbd_dev, USB_INTERFACE_INDEX_MAIN);
+  // from now on the OTG core is serviced by otg_fs_isr()
+  svc_usb_irq(1);
+}
+
+void otg_fs_isr(void) {
+  if (usbd_dev != NULL) {
+    usbd_poll(usbd_dev);
+  }
+}
+
+static void usb_write_packet(uint8_t ep, const uint8_t *data) {
+  for (;;) {
+    // keep the interrupt handler off the OTG core during the write
+    svc_usb_irq(0);
+    uint16_t len = usbd_ep_write_packet(usbd_dev, ep, data, 64);
+    svc_usb_irq(1);
+    if (len == 64) {
+      return;
+    }
+  }
+}
+
+void usbWriteU2f(void) {
+#if U2F_ENABLED
+  if (usbd_dev == NULL) {
+    return;
+  }
+  svc_usb_irq(0);
+  if (!u2f_tx_busy) {
+    u2f_tx_next(usbd_dev);
+  }
+  svc_usb_irq(1);
+#endif
 }
 
 void usbPoll(void) {
@@ -400,40 +530,40 @@ void usbPoll(void) {
     return;
   }
 
-  static const uint8_t *data;
-  // poll read buffer
-  usbd_poll(usbd_dev);
+  const uint8_t *data;
+  // handle received packets
+  usb_rx_dispatch(usbd_dev);
   // write pending data
-  data = msg_out_data();
-  if (data) {
-    while (usbd_ep_write_packet(usbd_dev, ENDPOINT_ADDRESS_MAIN_IN, data, 64) !=
-           64) {
-    }
+  while ((data = msg_out_data()) != NULL) {
+    usb_write_packet(ENDPOINT_ADDRESS_MAIN_IN, data);
   }
 #if U2F_ENABLED
-  data = u2f_out_data();
-  if (data) {
-    while (usbd_ep_write_packet(usbd_dev, ENDPOINT_ADDRESS_U2F_IN, data, 64) !=
-           64) {
-    }
-  }
+  // the interrupt handler writes the rest of the queued U2F packets
+  usbWriteU2f();
 #endif
 #if DEBUG_LINK
   // write pending debug data
-  data = msg_debug_out_data();
-  if (data) {
-    while (usbd_ep_write_packet(usbd_dev, ENDPOINT_ADDRESS_DEBUG_IN, data,
-                                64) != 64) {
-    }
+  while ((data = msg_debug_out_data()) != NULL) {
+    usb_write_packet(ENDPOINT_ADDRESS_DEBUG_IN, data);
   }
 #endif
 }
 
+void usbIdle(void) {
+  // Sleep until the next interrupt. A packet queued just before the wfi waits
+  // for the next 1 ms system tick at most.
+  if (usb_rx_tail == usb_rx_head) {
+    __asm__ volatile("wfi");
+  }
+}
+
 void usbReconnect(void) {
   if (usbd_dev != NULL) {
+    svc_usb_irq(0);
     usbd_disconnect(usbd_dev, 1);
     delay(120000);
     usbd_disconnect(usbd_dev, 0);
+    svc_usb_irq(1);
   }
 }
 
@@ -448,7 +578,8 @@ void usbSleep(uint32_t millis) {
 
   while ((timer_ms() - start) < millis) {
     if (usbd_dev != NULL) {
-      usbd_poll(usbd_dev);
+      usb_rx_dispatch(usbd_dev);
     }
+    usbIdle();
   }
 }
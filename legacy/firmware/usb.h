@@ -22,8 +22,10 @@
 
 void usbInit(void);
 void usbPoll(void);
+void usbIdle(void);
 void usbReconnect(void);
 char usbTiny(char set);
 void usbSleep(uint32_t millis);
+void usbWriteU2f(void);
 
 #endif
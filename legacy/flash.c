@@ -128,3 +128,34 @@ secbool flash_write_word(uint8_t sector, uint32_t offset, uint32_t data) {
 
   return sectrue;
 }
+
+secbool flash_write_block(uint8_t sector, uint32_t offset,
+                          const uint32_t *data, uint32_t count) {
+  uint32_t *address = (uint32_t *)flash_get_address(sector, offset,
+                                                    count * sizeof(uint32_t));
+  if (address == NULL) {
+    return secfalse;
+  }
+
+  if (offset % 4 != 0) {
+    return secfalse;
+  }
+
+  for (uint32_t i = 0; i < count; i++) {
+    if ((address[i] & data[i]) != data[i]) {
+      return secfalse;
+    }
+  }
+
+  // Enter programming mode once, the writes stall until the flash is ready.
+  svc_flash_program(FLASH_CR_PROGRAM_X32);
+  for (uint32_t i = 0; i < count; i++) {
+    ((volatile uint32_t *)address)[i] = data[i];
+  }
+
+  if (memcmp(address, data, count * sizeof(uint32_t)) != 0) {
+    return secfalse;
+  }
+
+  return sectrue;
+}
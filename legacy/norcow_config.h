@@ -22,6 +22,10 @@
 
 #include "flash.h"
 
+/*
+ * The flash sectors used by the storage. Compaction rotates through all of
+ * them, so listing more sectors spreads the erase cycles.
+ */
 #define NORCOW_SECTOR_COUNT 2
 #define NORCOW_SECTOR_SIZE (16 * 1024)
 #define NORCOW_SECTORS \
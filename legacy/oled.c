@@ -43,6 +43,8 @@
 #define OLED_SETHIGHCOLUMN 0x10
 #define OLED_SETSTARTLINE 0x40
 #define OLED_MEMORYMODE 0x20
+#define OLED_COLUMNADDR 0x21
+#define OLED_PAGEADDR 0x22
 #define OLED_COMSCANINC 0xC0
 #define OLED_COMSCANDEC 0xC8
 #define OLED_SEGREMAP 0xA0
@@ -67,11 +69,22 @@
 static uint8_t _oledbuffer[OLED_BUFSIZE];
 static bool is_debug_link = 0;
 
+/* Bit i of _oleddirty is set when the i-th OLED_WIDTH bytes of _oledbuffer
+ * (one page of the display controller) may differ from what was last sent.
+ */
+static uint8_t _oleddirty = 0xFF;
+
+/* Incremented whenever the whole buffer is cleared or replaced, so that a
+ * layout can tell whether the screen it drew last is still shown.
+ */
+static uint32_t _oledgeneration = 0;
+
 /*
  * macros to convert coordinate to bit position
  */
 #define OLED_OFFSET(x, y) (OLED_BUFSIZE - 1 - (x) - ((y) / 8) * OLED_WIDTH)
 #define OLED_MASK(x, y) (1 << (7 - (y) % 8))
+#define OLED_PAGE(x, y) (1 << (OLED_OFFSET(x, y) / OLED_WIDTH))
 
 /*
  * Return the state of the pixel at x, y
@@ -88,6 +101,7 @@ void oledDrawPixel(int x, int y) {
     return;
   }
   _oledbuffer[OLED_OFFSET(x, y)] |= OLED_MASK(x, y);
+  _oleddirty |= OLED_PAGE(x, y);
 }
 
 /*
@@ -98,6 +112,7 @@ void oledClearPixel(int x, int y) {
     return;
   }
   _oledbuffer[OLED_OFFSET(x, y)] &= ~OLED_MASK(x, y);
+  _oleddirty |= OLED_PAGE(x, y);
 }
 
 /*
@@ -108,6 +123,7 @@ void oledInvertPixel(int x, int y) {
     return;
   }
   _oledbuffer[OLED_OFFSET(x, y)] ^= OLED_MASK(x, y);
+  _oleddirty |= OLED_PAGE(x, y);
 }
 
 #if !EMULATOR
@@ -178,7 +194,11 @@ void oledInit() {
 /*
  * Clears the display buffer (sets all pixels to black)
  */
-void oledClear() { memzero(_oledbuffer, sizeof(_oledbuffer)); }
+void oledClear() {
+  memzero(_oledbuffer, sizeof(_oledbuffer));
+  _oleddirty = 0xFF;
+  _oledgeneration++;
+}
 
 void oledInvertDebugLink() {
   if (is_debug_link) {
@@ -207,38 +227,72 @@ void oledInvertDebugLink() {
  * not the content of the display.
  */
 #if !EMULATOR
-void oledRefresh() {
-  static const uint8_t s[3] = {OLED_SETLOWCOLUMN | 0x00,
-                               OLED_SETHIGHCOLUMN | 0x00,
-                               OLED_SETSTARTLINE | 0x00};
+/* Copy of the display RAM, valid once the whole buffer has been sent. */
+static uint8_t _oledsent[OLED_BUFSIZE];
+static bool _oledsent_valid = false;
 
+void oledRefresh() {
   // draw triangle in upper right corner
   oledInvertDebugLink();
 
-  gpio_clear(OLED_CS_PORT, OLED_CS_PIN);  // SPI select
-  SPISend(SPI_BASE, s, 3);
-  gpio_set(OLED_CS_PORT, OLED_CS_PIN);  // SPI deselect
+  // Only the changed columns of the dirty pages are sent. The display is
+  // in horizontal addressing mode, so the column and page address commands
+  // limit the data to that window.
+  for (int page = 0; page < OLED_HEIGHT / 8; page++) {
+    if (!(_oleddirty & (1 << page))) {
+      continue;
+    }
+    const uint8_t *row = _oledbuffer + page * OLED_WIDTH;
+    uint8_t *sent = _oledsent + page * OLED_WIDTH;
+    int first = 0, last = OLED_WIDTH - 1;
+    if (_oledsent_valid) {
+      while (first <= last && row[first] == sent[first]) {
+        first++;
+      }
+      if (first > last) {
+        continue;
+      }
+      while (row[last] == sent[last]) {
+        last--;
+      }
+    }
+    const uint8_t s[6] = {OLED_COLUMNADDR, first, last,
+                          OLED_PAGEADDR,   page,  page};
 
-  gpio_set(OLED_DC_PORT, OLED_DC_PIN);    // set to DATA
-  gpio_clear(OLED_CS_PORT, OLED_CS_PIN);  // SPI select
-  SPISend(SPI_BASE, _oledbuffer, sizeof(_oledbuffer));
-  gpio_set(OLED_CS_PORT, OLED_CS_PIN);    // SPI deselect
-  gpio_clear(OLED_DC_PORT, OLED_DC_PIN);  // set to CMD
+    gpio_clear(OLED_CS_PORT, OLED_CS_PIN);  // SPI select
+    SPISend(SPI_BASE, s, sizeof(s));
+    gpio_set(OLED_CS_PORT, OLED_CS_PIN);  // SPI deselect
+
+    gpio_set(OLED_DC_PORT, OLED_DC_PIN);    // set to DATA
+    gpio_clear(OLED_CS_PORT, OLED_CS_PIN);  // SPI select
+    SPISend(SPI_BASE, row + first, last - first + 1);
+    gpio_set(OLED_CS_PORT, OLED_CS_PIN);    // SPI deselect
+    gpio_clear(OLED_DC_PORT, OLED_DC_PIN);  // set to CMD
+
+    memcpy(sent + first, row + first, last - first + 1);
+  }
+  _oledsent_valid = true;
 
   // return it back
   oledInvertDebugLink();
+  _oleddirty = 0;
 }
 #endif
 
 const uint8_t *oledGetBuffer() { return _oledbuffer; }
 
+uint32_t oledGeneration() { return _oledgeneration; }
+
 void oledSetDebugLink(bool set) {
   is_debug_link = set;
+  _oleddirty = 0xFF;
   oledRefresh();
 }
 
 void oledSetBuffer(uint8_t *buf) {
   memcpy(_oledbuffer, buf, sizeof(_oledbuffer));
+  _oleddirty = 0xFF;
+  _oledgeneration++;
 }
 
 void oledDrawChar(int x, int y, char c, uint8_t font) {
@@ -417,8 +471,10 @@ void oledSwipeLeft(void) {
       }
       _oledbuffer[j * OLED_WIDTH] = 0;
     }
+    _oleddirty = 0xFF;
     oledRefresh();
   }
+  _oledgeneration++;
 }
 
 /*
@@ -443,8 +499,10 @@ void oledSwipeRight(void) {
       _oledbuffer[j * OLED_WIDTH + OLED_WIDTH - 3] = 0;
       _oledbuffer[j * OLED_WIDTH + OLED_WIDTH - 4] = 0;
     }
+    _oleddirty = 0xFF;
     oledRefresh();
   }
+  _oledgeneration++;
 }
 
 /*
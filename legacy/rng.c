@@ -24,8 +24,13 @@
 #include "rng.h"
 
 #if !EMULATOR
+static uint32_t stall_count = 0;
+
 uint32_t random32(void) {
   static uint32_t last = 0, new = 0;
+  if ((RNG_SR & (RNG_SR_SECS | RNG_SR_CECS | RNG_SR_DRDY)) != RNG_SR_DRDY) {
+    stall_count++;
+  }
   while (new == last) {
     if ((RNG_SR & (RNG_SR_SECS | RNG_SR_CECS | RNG_SR_DRDY)) == RNG_SR_DRDY) {
       new = RNG_DR;
@@ -34,4 +39,6 @@ uint32_t random32(void) {
   last = new;
   return new;
 }
+
+uint32_t rng_stall_count(void) { return stall_count; }
 #endif
@@ -22,4 +22,7 @@
 
 #include "rand.h"
 
+// number of random32() calls that had to wait for the TRNG
+uint32_t rng_stall_count(void);
+
 #endif
@@ -18,6 +18,7 @@
  */
 
 #include "supervise.h"
+#include <libopencm3/cm3/nvic.h>
 #include <libopencm3/stm32/flash.h>
 #include <stdint.h>
 #include "memory.h"
@@ -62,6 +63,14 @@ static uint32_t svhandler_flash_lock(void) {
   return FLASH_SR;
 }
 
+static void svhandler_usb_irq(uint32_t enable) {
+  if (enable) {
+    nvic_enable_irq(NVIC_OTG_FS_IRQ);
+  } else {
+    nvic_disable_irq(NVIC_OTG_FS_IRQ);
+  }
+}
+
 extern volatile uint32_t system_millis;
 
 void svc_handler_main(uint32_t *stack) {
@@ -82,6 +91,9 @@ void svc_handler_main(uint32_t *stack) {
     case SVC_TIMER_MS:
       stack[0] = system_millis;
       break;
+    case SVC_USB_IRQ:
+      svhandler_usb_irq(stack[0]);
+      break;
     default:
       stack[0] = 0xffffffff;
       break;
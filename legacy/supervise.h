@@ -29,6 +29,7 @@
 #define SVC_FLASH_PROGRAM 2
 #define SVC_FLASH_LOCK 3
 #define SVC_TIMER_MS 4
+#define SVC_USB_IRQ 5
 
 /* Unlocks flash.  This function needs to be called before programming
  * or erasing. Multiple calls of flash_program and flash_erase can
@@ -71,6 +72,13 @@ inline uint32_t svc_timer_ms(void) {
   return r0;
 }
 
+/* Enables (1) or disables (0) the USB OTG FS interrupt.
+ */
+inline void svc_usb_irq(uint32_t enable) {
+  register uint32_t r0 __asm__("r0") = enable;
+  __asm__ __volatile__("svc %0" ::"i"(SVC_USB_IRQ), "r"(r0) : "memory");
+}
+
 #else
 
 extern void svc_flash_unlock(void);
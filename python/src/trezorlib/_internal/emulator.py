@@ -16,6 +16,7 @@
 
 import logging
 import os
+import signal
 import subprocess
 import time
 from pathlib import Path
@@ -47,6 +48,7 @@ class Emulator:
         storage=None,
         headless=False,
         debug=True,
+        port=None,
         extra_args=()
     ):
         self.executable = Path(executable).resolve()
@@ -75,7 +77,7 @@ class Emulator:
         self.client = None
         self.process = None
 
-        self.port = 21324
+        self.port = port or 21324
         self.headless = headless
         self.debug = debug
         self.extra_args = list(extra_args)
@@ -84,7 +86,9 @@ class Emulator:
         return []
 
     def make_env(self):
-        return os.environ.copy()
+        env = os.environ.copy()
+        env["TREZOR_UDP_PORT"] = str(self.port)
+        return env
 
     def _get_transport(self):
         return UdpTransport("127.0.0.1:{}".format(self.port))
@@ -204,7 +208,6 @@ class CoreEmulator(Emulator):
     def __init__(
         self,
         *args,
-        port=None,
         main_args=("-m", "main"),
         workdir=None,
         sdcard=None,
@@ -220,8 +223,6 @@ class CoreEmulator(Emulator):
         if sdcard is not None:
             self.sdcard.write_bytes(sdcard)
 
-        if port:
-            self.port = port
         self.disable_animation = disable_animation
         self.main_args = list(main_args)
         self.heap_size = heap_size
@@ -231,16 +232,38 @@ class CoreEmulator(Emulator):
         env.update(
             TREZOR_PROFILE_DIR=str(self.profile_dir),
             TREZOR_PROFILE=str(self.profile_dir),
-            TREZOR_UDP_PORT=str(self.port),
         )
         if self.headless:
             env["SDL_VIDEODRIVER"] = "dummy"
+            env["TREZOR_HEADLESS"] = "1"
         if self.disable_animation:
             env["TREZOR_DISABLE_FADE"] = "1"
             env["TREZOR_DISABLE_ANIMATION"] = "1"
 
         return env
 
+    def _signal_and_wait(self, signum, timeout=EMULATOR_WAIT_TIME):
+        marker = self.profile_dir / "trezor.snapshot"
+        _rm_f(marker)
+        self.process.send_signal(signum)
+        start = time.monotonic()
+        while not marker.exists():
+            if self.process.poll() is not None:
+                raise RuntimeError("Emulator proces died")
+            if time.monotonic() - start >= timeout:
+                raise TimeoutError("Emulator did not fork")
+            time.sleep(0.01)
+        self.wait_until_ready(timeout)
+
+    def snapshot(self):
+        """Keep the current state of the emulator, including its RAM, so that
+        `restore` can return to it. Call it only while the emulator is idle."""
+        self._signal_and_wait(signal.SIGUSR1)
+
+    def restore(self):
+        """Return to the state of the last `snapshot`."""
+        self._signal_and_wait(signal.SIGUSR2)
+
     def make_args(self):
         pyopt = "-O0" if self.debug else "-O1"
         return (
@@ -257,4 +280,5 @@ class LegacyEmulator(Emulator):
         env = super().make_env()
         if self.headless:
             env["SDL_VIDEODRIVER"] = "dummy"
+            env["TREZOR_HEADLESS"] = "1"
         return env
@@ -71,6 +71,26 @@ def get_public_node(
     )
 
 
+@expect(messages.PublicKeys, field="keys")
+def get_public_nodes(
+    client,
+    paths,
+    ecdsa_curve_name=None,
+    coin_name=None,
+    script_type=messages.InputScriptType.SPENDADDRESS,
+):
+    """Get the public keys of several paths in one call, e.g. during account
+    discovery. The keys are returned in the order of `paths`."""
+    return client.call(
+        messages.GetPublicKeys(
+            paths=[messages.GetPublicKeysPath(address_n=n) for n in paths],
+            ecdsa_curve_name=ecdsa_curve_name,
+            coin_name=coin_name,
+            script_type=script_type,
+        )
+    )
+
+
 @expect(messages.Address, field="address")
 def get_address(
     client,
@@ -91,6 +111,28 @@ def get_address(
     )
 
 
+@expect(messages.Addresses, field="addresses")
+def get_addresses(
+    client,
+    coin_name,
+    n,
+    start,
+    count,
+    script_type=messages.InputScriptType.SPENDADDRESS,
+):
+    """Get the addresses `n/start` ... `n/(start + count - 1)` in one call,
+    e.g. to scan the gap limit of an account."""
+    return client.call(
+        messages.GetAddresses(
+            address_n=n,
+            start=start,
+            count=count,
+            coin_name=coin_name,
+            script_type=script_type,
+        )
+    )
+
+
 @expect(messages.MessageSignature)
 def sign_message(
     client, coin_name, n, message, script_type=messages.InputScriptType.SPENDADDRESS
@@ -150,6 +192,12 @@ def sign_tx(client, coin_name, inputs, outputs, details=None, prev_txes=None):
         tx_copy.extra_data = None
         return tx_copy
 
+    def items_requested(details):
+        # the device asks for request_count consecutive items only if
+        # signtx.batch_size allowed it, otherwise for a single one
+        start = details.request_index
+        return slice(start, start + (details.request_count or 1))
+
     R = messages.RequestType
     while isinstance(res, messages.TxRequest):
         # If there's some part of signed transaction, let's add it
@@ -179,15 +227,15 @@ def sign_tx(client, coin_name, inputs, outputs, details=None, prev_txes=None):
 
         elif res.request_type == R.TXINPUT:
             msg = messages.TransactionType()
-            msg.inputs = [current_tx.inputs[res.details.request_index]]
+            msg.inputs = current_tx.inputs[items_requested(res.details)]
             res = client.call(messages.TxAck(tx=msg))
 
         elif res.request_type == R.TXOUTPUT:
             msg = messages.TransactionType()
             if res.details.tx_hash:
-                msg.bin_outputs = [current_tx.bin_outputs[res.details.request_index]]
+                msg.bin_outputs = current_tx.bin_outputs[items_requested(res.details)]
             else:
-                msg.outputs = [current_tx.outputs[res.details.request_index]]
+                msg.outputs = current_tx.outputs[items_requested(res.details)]
 
             res = client.call(messages.TxAck(tx=msg))
 
@@ -42,23 +42,46 @@ def sign_tx(
     outputs: List[messages.CardanoTxOutputType],
     transactions: List[bytes],
     protocol_magic,
+    stream: bool = False,
 ):
-    response = client.call(
-        messages.CardanoSignTx(
+    """Sign a transaction.
+
+    With `stream`, the device requests the inputs and outputs one by one and
+    sends the serialized transaction back in parts, which are joined here.
+    """
+    if stream:
+        sign_tx_msg = messages.CardanoSignTx(
+            inputs_count=len(inputs),
+            outputs_count=len(outputs),
+            transactions_count=len(transactions),
+            protocol_magic=protocol_magic,
+        )
+    else:
+        sign_tx_msg = messages.CardanoSignTx(
             inputs=inputs,
             outputs=outputs,
             transactions_count=len(transactions),
             protocol_magic=protocol_magic,
         )
-    )
+    response = client.call(sign_tx_msg)
 
+    tx_body = b""
     while isinstance(response, messages.CardanoTxRequest):
-        tx_index = response.tx_index
-
-        transaction_data = bytes.fromhex(transactions[tx_index])
-        ack_message = messages.CardanoTxAck(transaction=transaction_data)
+        if response.tx_body:
+            tx_body += response.tx_body
+
+        if response.input_index is not None:
+            ack_message = messages.CardanoTxAck(input=inputs[response.input_index])
+        elif response.output_index is not None:
+            ack_message = messages.CardanoTxAck(output=outputs[response.output_index])
+        else:
+            transaction_data = bytes.fromhex(transactions[response.tx_index])
+            ack_message = messages.CardanoTxAck(transaction=transaction_data)
         response = client.call(ack_message)
 
+    if stream and isinstance(response, messages.CardanoSignedTx):
+        response.tx_body = tx_body + response.tx_body
+
     return response
 
 
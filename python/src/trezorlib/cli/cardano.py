@@ -38,8 +38,11 @@ def cli():
     help="Transaction in JSON format",
 )
 @click.option("-N", "--network", type=int, default=1)
+@click.option(
+    "-s", "--stream", is_flag=True, help="Send inputs and outputs one by one"
+)
 @with_client
-def sign_tx(client, file, network):
+def sign_tx(client, file, network, stream):
     """Sign Cardano transaction."""
     transaction = json.load(file)
 
@@ -47,7 +50,9 @@ def sign_tx(client, file, network):
     outputs = [cardano.create_output(output) for output in transaction["outputs"]]
     transactions = transaction["transactions"]
 
-    signed_transaction = cardano.sign_tx(client, inputs, outputs, transactions, network)
+    signed_transaction = cardano.sign_tx(
+        client, inputs, outputs, transactions, network, stream=stream
+    )
 
     return {
         "tx_hash": signed_transaction.tx_hash.hex(),
@@ -178,6 +178,8 @@ def find_best_firmware_version(
 @click.option("--raw", is_flag=True, help="Push raw data to Trezor")
 @click.option("--fingerprint", help="Expected firmware fingerprint in hex")
 @click.option("--skip-vendor-header", help="Skip vendor header validation on Trezor T")
+@click.option("--compress", is_flag=True, help="Send compressed chunks if the bootloader supports it")
+@click.option("--delta-from", type=click.File("rb"), help="Installed firmware to send a delta against")
 # fmt: on
 @with_client
 def firmware_update(
@@ -192,6 +194,8 @@ def firmware_update(
     dry_run,
     beta,
     bitcoin_only,
+    compress,
+    delta_from,
 ):
     """Upload new firmware to device.
 
@@ -294,7 +298,10 @@ def firmware_update(
             if f.major_version == 1 and f.firmware_present is not False:
                 # Trezor One does not send ButtonRequest
                 click.echo("Please confirm the action on your Trezor device")
-            return firmware.update(client, data)
+            installed = delta_from.read() if delta_from else None
+            return firmware.update(
+                client, data, compress=compress, installed=installed
+            )
         except exceptions.Cancelled:
             click.echo("Update aborted on device.")
         except exceptions.TrezorException as e:
@@ -15,7 +15,7 @@
 # If not, see <https://www.gnu.org/licenses/lgpl-3.0.html>.
 
 import logging
-from collections import namedtuple
+from collections import deque, namedtuple
 from copy import deepcopy
 
 from mnemonic import Mnemonic
@@ -40,6 +40,9 @@ class DebugLink:
     def __init__(self, transport, auto_interact=True):
         self.transport = transport
         self.allow_interactions = auto_interact
+        # layout changes pushed by the device, see `watch_layout`
+        self.push_layout = False
+        self.layout_changes = deque()
 
     def open(self):
         self.transport.begin_session()
@@ -63,11 +66,19 @@ class DebugLink:
         if nowait:
             return None
 
+        while True:
+            msg = self._read()
+            if self.push_layout and isinstance(msg, messages.DebugLinkLayout):
+                self.layout_changes.append(msg.lines)
+            else:
+                return msg
+
+    def _read(self):
         ret_type, ret_bytes = self.transport.read()
         LOG.log(
             DUMP_BYTES,
             "received type {} ({} bytes): {}".format(
-                msg_type, len(msg_bytes), msg_bytes.hex()
+                ret_type, len(ret_bytes), ret_bytes.hex()
             ),
         )
         msg = mapping.decode(ret_type, ret_bytes)
@@ -84,17 +95,32 @@ class DebugLink:
         return layout_lines(self.state().layout_lines)
 
     def wait_layout(self):
-        obj = self._call(messages.DebugLinkGetState(wait_layout=True))
-        return layout_lines(obj.layout_lines)
+        if not self.push_layout:
+            obj = self._call(messages.DebugLinkGetState(wait_layout=True))
+            return layout_lines(obj.layout_lines)
+
+        while not self.layout_changes:
+            msg = self._read()
+            if isinstance(msg, messages.DebugLinkLayout):
+                self.layout_changes.append(msg.lines)
+            else:
+                LOG.warning("unexpected message: {}".format(msg.__class__.__name__))
+        return layout_lines(self.layout_changes.popleft())
 
-    def watch_layout(self, watch: bool) -> None:
+    def watch_layout(self, watch: bool, push: bool = False) -> None:
         """Enable or disable watching layouts.
         If disabled, wait_layout will not work.
 
+        With `push`, the device sends every layout change as it happens and
+        wait_layout only reads them, instead of asking for each one. Firmware
+        without this feature keeps answering requests.
+
         The message is missing on T1. Use `TrezorClientDebugLink.watch_layout` for
         cross-version compatibility.
         """
-        self._call(messages.DebugLinkWatchLayout(watch=watch))
+        ret = self._call(messages.DebugLinkWatchLayout(watch=watch, push=push))
+        self.layout_changes.clear()
+        self.push_layout = isinstance(ret, messages.DebugLinkLayout)
 
     def encode_pin(self, pin, matrix=None):
         """Transform correct PIN according to the displayed matrix."""
@@ -126,6 +152,16 @@ class DebugLink:
         if args != 1:
             raise ValueError("Invalid input - must use one of word, button, swipe")
 
+        if self.push_layout:
+            # the resulting layout change is pushed anyway
+            decision = messages.DebugLinkDecision(
+                yes_no=button, swipe=swipe, input=word, x=x, y=y
+            )
+            self._call(decision, nowait=True)
+            if wait:
+                return self.wait_layout()
+            return None
+
         decision = messages.DebugLinkDecision(
             yes_no=button, swipe=swipe, input=word, x=x, y=y, wait=wait
         )
@@ -161,12 +197,26 @@ class DebugLink:
     def reseed(self, value):
         self._call(messages.DebugLinkReseedRandom(value=value))
 
-    def start_recording(self, directory):
-        self._call(messages.DebugLinkRecordScreen(target_directory=directory))
+    def start_recording(self, directory, hash_only=False):
+        """Record screen changes into `directory`.
+
+        With `hash_only`, the device only hashes the frames (see `screen_hash`)
+        and keeps them in memory. A following call without `hash_only` writes
+        them to the directory.
+        """
+        self._call(
+            messages.DebugLinkRecordScreen(
+                target_directory=directory, hash_only=hash_only
+            )
+        )
 
     def stop_recording(self):
         self._call(messages.DebugLinkRecordScreen(target_directory=None))
 
+    def screen_hash(self):
+        """SHA-256 of the raw frames recorded since `start_recording`."""
+        return self.state().screen_hash
+
     @expect(messages.DebugLinkMemory, field="memory")
     def memory_read(self, address, length):
         return self._call(messages.DebugLinkMemoryRead(address=address, length=length))
@@ -357,7 +407,7 @@ class TrezorClientDebugLink(TrezorClient):
             # whether and where to wait for reply:
             # - T1 reports unknown debuglink messages on the wirelink
             # - TT < 2.3.0 does not reply to unknown debuglink messages due to a bug
-            self.debug.watch_layout(watch)
+            self.debug.watch_layout(watch, push=True)
 
     def __enter__(self):
         # For usage in with/expected_responses
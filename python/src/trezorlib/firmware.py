@@ -15,8 +15,10 @@
 # If not, see <https://www.gnu.org/licenses/lgpl-3.0.html>.
 
 import hashlib
+import struct
+import zlib
 from enum import Enum
-from typing import Callable, List, Tuple
+from typing import Callable, Dict, List, Tuple
 
 import construct as c
 import ecdsa
@@ -483,12 +485,96 @@ def validate(
 # ====== Client functions ====== #
 
 
+def _deflate(data: bytes) -> bytes:
+    # raw deflate stream, without the zlib header and checksum
+    compressor = zlib.compressobj(9, zlib.DEFLATED, -15)
+    return compressor.compress(data) + compressor.flush()
+
+
+# Delta chunks copy ranges of the installed firmware and insert the rest.
+DELTA_COPY = 0
+DELTA_INSERT = 1
+# shorter matches are not worth the 9 bytes of a copy operation
+DELTA_MIN_MATCH = 32
+DELTA_MAX_CANDIDATES = 8
+
+
+class DeltaEncoder:
+    """Encodes ranges of a new image as copies from an installed one.
+
+    The bootloader rewrites the installed firmware in place, chunk by chunk, so
+    a chunk may only copy from its own chunk and the ones after it.
+    """
+
+    def __init__(self, installed: bytes, chunk_size: int = V2_CHUNK_SIZE) -> None:
+        self.installed = installed
+        self.chunk_size = chunk_size
+        # firmware code is 4-byte aligned, so is the index of installed blocks
+        self.index = {}  # type: Dict[bytes, List[int]]
+        for i in range(0, len(installed) - DELTA_MIN_MATCH + 1, 4):
+            positions = self.index.setdefault(installed[i : i + DELTA_MIN_MATCH], [])
+            if len(positions) == DELTA_MAX_CANDIDATES:
+                positions.pop(0)
+            positions.append(i)
+
+    def _match_length(self, src: int, new: bytes, pos: int, end: int) -> int:
+        length = 0
+        limit = min(end - pos, len(self.installed) - src)
+        step = 256
+        while step:
+            while length + step <= limit and (
+                self.installed[src + length : src + length + step]
+                == new[pos + length : pos + length + step]
+            ):
+                length += step
+            step //= 4
+        return length
+
+    def encode(self, new: bytes, offset: int, length: int) -> bytes:
+        min_source = offset // self.chunk_size * self.chunk_size
+        end = offset + length
+        patch = bytearray()
+        literal = pos = offset
+        while pos < end:
+            best_src, best_len = 0, 0
+            key = new[pos : pos + DELTA_MIN_MATCH]
+            for src in self.index.get(key, ()):
+                if src >= min_source:
+                    match = self._match_length(src, new, pos, end)
+                    if match > best_len:
+                        best_src, best_len = src, match
+            if best_len < DELTA_MIN_MATCH:
+                pos += 1
+                continue
+            if literal < pos:
+                patch += struct.pack("<BI", DELTA_INSERT, pos - literal)
+                patch += new[literal:pos]
+            patch += struct.pack("<BII", DELTA_COPY, best_src, best_len)
+            pos += best_len
+            literal = pos
+        if literal < end:
+            patch += struct.pack("<BI", DELTA_INSERT, end - literal)
+            patch += new[literal:end]
+        return bytes(patch)
+
+
 @tools.session
-def update(client, data):
+def update(client, data, compress=False, installed=None):
+    """Upload firmware in bootloader mode.
+
+    If `installed` is the image currently on the device, a bootloader that
+    supports it receives patches against it instead of the whole image.
+    """
     if client.features.bootloader_mode is False:
         raise RuntimeError("Device must be in bootloader mode")
 
-    resp = client.call(messages.FirmwareErase(length=len(data)))
+    resp = client.call(
+        messages.FirmwareErase(
+            length=len(data),
+            compressed=compress or None,
+            delta=installed is not None or None,
+        )
+    )
 
     # TREZORv1 method
     if isinstance(resp, messages.Success):
@@ -499,9 +585,19 @@ def update(client, data):
             raise RuntimeError("Unexpected result %s" % resp)
 
     # TREZORv2 method
+    # bootloaders that cannot decompress or patch chunks do not confirm it
+    compressed = delta = None
+    if isinstance(resp, messages.FirmwareRequest):
+        compressed = resp.compressed
+        if resp.delta:
+            delta = DeltaEncoder(installed)
     while isinstance(resp, messages.FirmwareRequest):
         payload = data[resp.offset : resp.offset + resp.length]
         digest = blake2s(payload).digest()
+        if delta:
+            payload = delta.encode(data, resp.offset, resp.length)
+        elif compressed:
+            payload = _deflate(payload)
         resp = client.call(messages.FirmwareUpload(payload=payload, hash=digest))
 
     if isinstance(resp, messages.Success):
@@ -22,11 +22,15 @@ class CardanoSignTx(p.MessageType):
         outputs: List[CardanoTxOutputType] = None,
         transactions_count: int = None,
         protocol_magic: int = None,
+        inputs_count: int = None,
+        outputs_count: int = None,
     ) -> None:
         self.inputs = inputs if inputs is not None else []
         self.outputs = outputs if outputs is not None else []
         self.transactions_count = transactions_count
         self.protocol_magic = protocol_magic
+        self.inputs_count = inputs_count
+        self.outputs_count = outputs_count
 
     @classmethod
     def get_fields(cls) -> Dict:
@@ -35,4 +39,6 @@ class CardanoSignTx(p.MessageType):
             2: ('outputs', CardanoTxOutputType, p.FLAG_REPEATED),
             3: ('transactions_count', p.UVarintType, 0),
             5: ('protocol_magic', p.UVarintType, 0),
+            6: ('inputs_count', p.UVarintType, 0),
+            7: ('outputs_count', p.UVarintType, 0),
         }
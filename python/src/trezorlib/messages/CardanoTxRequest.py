@@ -18,10 +18,14 @@ class CardanoTxRequest(p.MessageType):
         tx_index: int = None,
         tx_hash: bytes = None,
         tx_body: bytes = None,
+        input_index: int = None,
+        output_index: int = None,
     ) -> None:
         self.tx_index = tx_index
         self.tx_hash = tx_hash
         self.tx_body = tx_body
+        self.input_index = input_index
+        self.output_index = output_index
 
     @classmethod
     def get_fields(cls) -> Dict:
@@ -29,4 +33,6 @@ class CardanoTxRequest(p.MessageType):
             1: ('tx_index', p.UVarintType, 0),
             2: ('tx_hash', p.BytesType, 0),
             3: ('tx_body', p.BytesType, 0),
+            4: ('input_index', p.UVarintType, 0),
+            5: ('output_index', p.UVarintType, 0),
         }
@@ -22,6 +22,8 @@ class CipherKeyValue(p.MessageType):
         ask_on_encrypt: bool = None,
         ask_on_decrypt: bool = None,
         iv: bytes = None,
+        values: List[bytes] = None,
+        ivs: List[bytes] = None,
     ) -> None:
         self.address_n = address_n if address_n is not None else []
         self.key = key
@@ -30,6 +32,8 @@ class CipherKeyValue(p.MessageType):
         self.ask_on_encrypt = ask_on_encrypt
         self.ask_on_decrypt = ask_on_decrypt
         self.iv = iv
+        self.values = values if values is not None else []
+        self.ivs = ivs if ivs is not None else []
 
     @classmethod
     def get_fields(cls) -> Dict:
@@ -41,4 +45,6 @@ class CipherKeyValue(p.MessageType):
             5: ('ask_on_encrypt', p.BoolType, 0),
             6: ('ask_on_decrypt', p.BoolType, 0),
             7: ('iv', p.BytesType, 0),
+            8: ('values', p.BytesType, p.FLAG_REPEATED),
+            9: ('ivs', p.BytesType, p.FLAG_REPEATED),
         }
@@ -16,11 +16,14 @@ class DebugLinkRecordScreen(p.MessageType):
     def __init__(
         self,
         target_directory: str = None,
+        hash_only: bool = None,
     ) -> None:
         self.target_directory = target_directory
+        self.hash_only = hash_only
 
     @classmethod
     def get_fields(cls) -> Dict:
         return {
             1: ('target_directory', p.UnicodeType, 0),
+            2: ('hash_only', p.BoolType, 0),
         }
@@ -16,11 +16,17 @@ class FirmwareErase(p.MessageType):
     def __init__(
         self,
         length: int = None,
+        compressed: bool = None,
+        delta: bool = None,
     ) -> None:
         self.length = length
+        self.compressed = compressed
+        self.delta = delta
 
     @classmethod
     def get_fields(cls) -> Dict:
         return {
             1: ('length', p.UVarintType, 0),
+            2: ('compressed', p.BoolType, 0),
+            3: ('delta', p.BoolType, 0),
         }
@@ -17,13 +17,19 @@ class FirmwareRequest(p.MessageType):
         self,
         offset: int = None,
         length: int = None,
+        compressed: bool = None,
+        delta: bool = None,
     ) -> None:
         self.offset = offset
         self.length = length
+        self.compressed = compressed
+        self.delta = delta
 
     @classmethod
     def get_fields(cls) -> Dict:
         return {
             1: ('offset', p.UVarintType, 0),
             2: ('length', p.UVarintType, 0),
+            3: ('compressed', p.BoolType, 0),
+            4: ('delta', p.BoolType, 0),
         }
@@ -0,0 +1,38 @@
+# Automatically generated by pb2py
+# fmt: off
+from .. import protobuf as p
+
+from .GetPublicKeysPath import GetPublicKeysPath
+
+if __debug__:
+    try:
+        from typing import Dict, List  # noqa: F401
+        from typing_extensions import Literal  # noqa: F401
+        EnumTypeInputScriptType = Literal[0, 1, 2, 3, 4]
+    except ImportError:
+        pass
+
+
+class GetPublicKeys(p.MessageType):
+    MESSAGE_WIRE_TYPE = 49
+
+    def __init__(
+        self,
+        paths: List[GetPublicKeysPath] = None,
+        ecdsa_curve_name: str = None,
+        coin_name: str = None,
+        script_type: EnumTypeInputScriptType = None,
+    ) -> None:
+        self.paths = paths if paths is not None else []
+        self.ecdsa_curve_name = ecdsa_curve_name
+        self.coin_name = coin_name
+        self.script_type = script_type
+
+    @classmethod
+    def get_fields(cls) -> Dict:
+        return {
+            1: ('paths', GetPublicKeysPath, p.FLAG_REPEATED),
+            2: ('ecdsa_curve_name', p.UnicodeType, 0),
+            3: ('coin_name', p.UnicodeType, 0),  # default=Bitcoin
+            4: ('script_type', p.EnumType("InputScriptType", (0, 1, 2, 3, 4)), 0),  # default=SPENDADDRESS
+        }
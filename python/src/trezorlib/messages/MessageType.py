@@ -53,6 +53,10 @@ Address = 30  # type: Literal[30]
 SignMessage = 38  # type: Literal[38]
 VerifyMessage = 39  # type: Literal[39]
 MessageSignature = 40  # type: Literal[40]
+GetPublicKeys = 49  # type: Literal[49]
+PublicKeys = 50  # type: Literal[50]
+GetAddresses = 51  # type: Literal[51]
+Addresses = 52  # type: Literal[52]
 CipherKeyValue = 23  # type: Literal[23]
 CipheredKeyValue = 48  # type: Literal[48]
 SignIdentity = 53  # type: Literal[53]
@@ -175,6 +179,8 @@ MoneroLiveRefreshStepRequest = 554  # type: Literal[554]
 MoneroLiveRefreshStepAck = 555  # type: Literal[555]
 MoneroLiveRefreshFinalRequest = 556  # type: Literal[556]
 MoneroLiveRefreshFinalAck = 557  # type: Literal[557]
+MoneroLiveRefreshBatchStepRequest = 558  # type: Literal[558]
+MoneroLiveRefreshBatchStepAck = 559  # type: Literal[559]
 EosGetPublicKey = 600  # type: Literal[600]
 EosPublicKey = 601  # type: Literal[601]
 EosSignTx = 602  # type: Literal[602]
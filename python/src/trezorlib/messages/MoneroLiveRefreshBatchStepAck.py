@@ -0,0 +1,28 @@
+# Automatically generated by pb2py
+# fmt: off
+from .. import protobuf as p
+
+from .MoneroLiveRefreshStepAck import MoneroLiveRefreshStepAck
+
+if __debug__:
+    try:
+        from typing import Dict, List  # noqa: F401
+        from typing_extensions import Literal  # noqa: F401
+    except ImportError:
+        pass
+
+
+class MoneroLiveRefreshBatchStepAck(p.MessageType):
+    MESSAGE_WIRE_TYPE = 559
+
+    def __init__(
+        self,
+        key_images: List[MoneroLiveRefreshStepAck] = None,
+    ) -> None:
+        self.key_images = key_images if key_images is not None else []
+
+    @classmethod
+    def get_fields(cls) -> Dict:
+        return {
+            1: ('key_images', MoneroLiveRefreshStepAck, p.FLAG_REPEATED),
+        }
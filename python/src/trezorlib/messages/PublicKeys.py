@@ -0,0 +1,28 @@
+# Automatically generated by pb2py
+# fmt: off
+from .. import protobuf as p
+
+from .PublicKey import PublicKey
+
+if __debug__:
+    try:
+        from typing import Dict, List  # noqa: F401
+        from typing_extensions import Literal  # noqa: F401
+    except ImportError:
+        pass
+
+
+class PublicKeys(p.MessageType):
+    MESSAGE_WIRE_TYPE = 50
+
+    def __init__(
+        self,
+        keys: List[PublicKey] = None,
+    ) -> None:
+        self.keys = keys if keys is not None else []
+
+    @classmethod
+    def get_fields(cls) -> Dict:
+        return {
+            1: ('keys', PublicKey, p.FLAG_REPEATED),
+        }
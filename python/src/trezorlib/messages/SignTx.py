@@ -25,6 +25,8 @@ class SignTx(p.MessageType):
         version_group_id: int = None,
         timestamp: int = None,
         branch_id: int = None,
+        batch_size: int = None,
+        cache_legacy_tx: bool = None,
     ) -> None:
         self.outputs_count = outputs_count
         self.inputs_count = inputs_count
@@ -36,6 +38,8 @@ class SignTx(p.MessageType):
         self.version_group_id = version_group_id
         self.timestamp = timestamp
         self.branch_id = branch_id
+        self.batch_size = batch_size
+        self.cache_legacy_tx = cache_legacy_tx
 
     @classmethod
     def get_fields(cls) -> Dict:
@@ -50,4 +54,6 @@ class SignTx(p.MessageType):
             8: ('version_group_id', p.UVarintType, 0),
             9: ('timestamp', p.UVarintType, 0),
             10: ('branch_id', p.UVarintType, 0),
+            11: ('batch_size', p.UVarintType, 0),
+            12: ('cache_legacy_tx', p.BoolType, 0),
         }
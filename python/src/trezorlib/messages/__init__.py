@@ -2,6 +2,7 @@
 # fmt: off
 
 from .Address import Address
+from .Addresses import Addresses
 from .ApplyFlags import ApplyFlags
 from .ApplySettings import ApplySettings
 from .BackupDevice import BackupDevice
@@ -107,11 +108,14 @@ from .FirmwareErase import FirmwareErase
 from .FirmwareRequest import FirmwareRequest
 from .FirmwareUpload import FirmwareUpload
 from .GetAddress import GetAddress
+from .GetAddresses import GetAddresses
 from .GetECDHSessionKey import GetECDHSessionKey
 from .GetEntropy import GetEntropy
 from .GetFeatures import GetFeatures
 from .GetNextU2FCounter import GetNextU2FCounter
 from .GetPublicKey import GetPublicKey
+from .GetPublicKeys import GetPublicKeys
+from .GetPublicKeysPath import GetPublicKeysPath
 from .HDNodePathType import HDNodePathType
 from .HDNodeType import HDNodeType
 from .IdentityType import IdentityType
@@ -146,6 +150,8 @@ from .MoneroKeyImageSyncFinalAck import MoneroKeyImageSyncFinalAck
 from .MoneroKeyImageSyncFinalRequest import MoneroKeyImageSyncFinalRequest
 from .MoneroKeyImageSyncStepAck import MoneroKeyImageSyncStepAck
 from .MoneroKeyImageSyncStepRequest import MoneroKeyImageSyncStepRequest
+from .MoneroLiveRefreshBatchStepAck import MoneroLiveRefreshBatchStepAck
+from .MoneroLiveRefreshBatchStepRequest import MoneroLiveRefreshBatchStepRequest
 from .MoneroLiveRefreshFinalAck import MoneroLiveRefreshFinalAck
 from .MoneroLiveRefreshFinalRequest import MoneroLiveRefreshFinalRequest
 from .MoneroLiveRefreshStartAck import MoneroLiveRefreshStartAck
@@ -205,6 +211,7 @@ from .PinMatrixAck import PinMatrixAck
 from .PinMatrixRequest import PinMatrixRequest
 from .Ping import Ping
 from .PublicKey import PublicKey
+from .PublicKeys import PublicKeys
 from .RecoveryDevice import RecoveryDevice
 from .ResetDevice import ResetDevice
 from .RippleAddress import RippleAddress
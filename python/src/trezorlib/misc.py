@@ -14,6 +14,8 @@
 # You should have received a copy of the License along with this library.
 # If not, see <https://www.gnu.org/licenses/lgpl-3.0.html>.
 
+from typing import List
+
 from . import messages
 from .tools import Address, expect
 
@@ -104,3 +106,55 @@ def decrypt_keyvalue(
             iv=iv,
         )
     )
+
+
+@expect(messages.CipheredKeyValue, field="values")
+def encrypt_keyvalues(
+    client: "TrezorClient",
+    n: Address,
+    key: str,
+    values: List[bytes],
+    ask_on_encrypt: bool = True,
+    ask_on_decrypt: bool = True,
+    iv: bytes = b"",
+    ivs: List[bytes] = None,
+) -> messages.CipheredKeyValue:
+    """Encrypt several values with the same key in one call."""
+    return client.call(
+        messages.CipherKeyValue(
+            address_n=n,
+            key=key,
+            values=values,
+            encrypt=True,
+            ask_on_encrypt=ask_on_encrypt,
+            ask_on_decrypt=ask_on_decrypt,
+            iv=iv,
+            ivs=ivs,
+        )
+    )
+
+
+@expect(messages.CipheredKeyValue, field="values")
+def decrypt_keyvalues(
+    client: "TrezorClient",
+    n: Address,
+    key: str,
+    values: List[bytes],
+    ask_on_encrypt: bool = True,
+    ask_on_decrypt: bool = True,
+    iv: bytes = b"",
+    ivs: List[bytes] = None,
+) -> messages.CipheredKeyValue:
+    """Decrypt several values with the same key in one call."""
+    return client.call(
+        messages.CipherKeyValue(
+            address_n=n,
+            key=key,
+            values=values,
+            encrypt=False,
+            ask_on_encrypt=ask_on_encrypt,
+            ask_on_decrypt=ask_on_decrypt,
+            iv=iv,
+            ivs=ivs,
+        )
+    )
@@ -0,0 +1,82 @@
+# This file is part of the Trezor project.
+#
+# Copyright (C) 2012-2019 SatoshiLabs and contributors
+#
+# This library is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License version 3
+# as published by the Free Software Foundation.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the License along with this library.
+# If not, see <https://www.gnu.org/licenses/lgpl-3.0.html>.
+
+import random
+import struct
+
+from trezorlib import firmware
+
+CHUNK_SIZE = 1024
+
+
+def apply_patch(installed, patch, min_source):
+    # what the bootloader does with a delta chunk
+    out = bytearray()
+    pos = 0
+    while pos < len(patch):
+        op = patch[pos]
+        if op == firmware.DELTA_COPY:
+            src, length = struct.unpack_from("<II", patch, pos + 1)
+            assert src >= min_source
+            out += installed[src : src + length]
+            pos += 9
+        else:
+            assert op == firmware.DELTA_INSERT
+            (length,) = struct.unpack_from("<I", patch, pos + 1)
+            out += patch[pos + 5 : pos + 5 + length]
+            pos += 5 + length
+    return bytes(out)
+
+
+def random_image(rnd, size):
+    return bytes(rnd.getrandbits(8) for _ in range(size))
+
+
+def test_delta_roundtrip():
+    rnd = random.Random(0)
+    installed = random_image(rnd, 8 * CHUNK_SIZE)
+    new = bytearray(installed)
+    new[100:108] = b"\x00" * 8
+    new[3000:3000] = random_image(rnd, 12)
+    del new[5000:5040]
+    new = bytes(new)
+
+    encoder = firmware.DeltaEncoder(installed, chunk_size=CHUNK_SIZE)
+    device = bytearray(installed)
+    total = 0
+    for offset in range(0, len(new), CHUNK_SIZE):
+        length = min(CHUNK_SIZE, len(new) - offset)
+        patch = encoder.encode(new, offset, length)
+        total += len(patch)
+        chunk = apply_patch(bytes(device), patch, offset)
+        assert chunk == new[offset : offset + length]
+        # the chunk is written in place
+        device[offset : offset + length] = chunk
+
+    assert total < len(new) // 4
+
+
+def test_delta_no_copy_from_rewritten_chunks():
+    rnd = random.Random(1)
+    block = random_image(rnd, CHUNK_SIZE)
+    installed = block + random_image(rnd, CHUNK_SIZE)
+    # the second chunk repeats the first one, which is already overwritten
+    new = random_image(rnd, CHUNK_SIZE) + block
+
+    encoder = firmware.DeltaEncoder(installed, chunk_size=CHUNK_SIZE)
+    patch = encoder.encode(new, CHUNK_SIZE, CHUNK_SIZE)
+    assert patch[0] == firmware.DELTA_INSERT
+    assert apply_patch(installed, patch, CHUNK_SIZE) == block
@@ -27,6 +27,9 @@
 #define NORCOW_MAGIC ((uint32_t)0x3243524e)
 // NRCW = 4e524357
 #define NORCOW_MAGIC_V0 ((uint32_t)0x5743524e)
+// NRC2 with the top bit set, marks the writing sector of an unfinished
+// compaction. The bit is cleared once the compaction completes.
+#define NORCOW_MAGIC_COMPACT ((uint32_t)0xb243524e)
 
 #define NORCOW_WORD_SIZE (sizeof(uint32_t))
 #define NORCOW_PREFIX_LEN NORCOW_WORD_SIZE
@@ -43,7 +46,13 @@
 #define NORCOW_STORAGE_START \
   (NORCOW_HEADER_LEN + NORCOW_MAGIC_LEN + NORCOW_VERSION_LEN)
 
-// Map from sector index to sector number.
+#if NORCOW_SECTOR_COUNT < 2
+#error norcow needs at least two sectors
+#endif
+
+// Map from sector index to sector number. Each compaction moves the items to
+// the next sector in the list, so with more than two sectors the erase cycles
+// are spread over all of them.
 static const uint8_t norcow_sectors[NORCOW_SECTOR_COUNT] = NORCOW_SECTORS;
 
 // The index of the active reading sector and writing sector. These should be
@@ -57,12 +66,62 @@ static uint32_t norcow_active_version = 0;
 // The offset of the first free item in the writing sector.
 static uint32_t norcow_free_offset = 0;
 
+// Whether an incremental compaction from the active sector to the writing
+// sector is in progress.
+static secbool norcow_compacting = secfalse;
+
+// The offset of the next item in the active sector to be migrated and the
+// first free offset of the active sector during compaction.
+static uint32_t norcow_compact_offset = 0;
+static uint32_t norcow_compact_end = 0;
+
+#if NORCOW_STATS
+uint32_t norcow_compaction_count = 0;
+uint32_t norcow_migrated_count = 0;
+#endif
+
+// The number of words programmed by one flash_write_block() in norcow_write().
+#define NORCOW_WRITE_BURST_WORDS 16
+
+// The maximum number of items migrated by one norcow_compact_step().
+#ifndef NORCOW_COMPACT_STEP_ITEMS
+#define NORCOW_COMPACT_STEP_ITEMS 8
+#endif
+
+// Incremental compaction is started only once the free space drops below
+// NORCOW_COMPACT_FREE_MIN and at least NORCOW_COMPACT_DELETED_MIN bytes are
+// held by deleted items, so that it does not wear the flash for nothing.
+#define NORCOW_COMPACT_FREE_MIN (NORCOW_SECTOR_SIZE / 4)
+#define NORCOW_COMPACT_DELETED_MIN (NORCOW_SECTOR_SIZE / 8)
+
+// Flag set in the norcow_get_next() offset while listing the items of the
+// active sector during compaction.
+#define NORCOW_NEXT_ACTIVE ((uint32_t)0x80000000)
+
+// The maximum number of keys held by the RAM index of the writing sector.
+#ifndef NORCOW_INDEX_SIZE
+#define NORCOW_INDEX_SIZE 256
+#endif
+
+// Index of the latest instance of each key in the writing sector, sorted by
+// key. The item offset is stored in words, so that it fits into 16 bits. If
+// the index overflows, then it is invalidated and lookups fall back to
+// scanning the sector until the index is rebuilt by compaction or wipe.
+typedef struct {
+  uint16_t key;
+  uint16_t offset;
+} norcow_index_entry;
+
+static norcow_index_entry norcow_index[NORCOW_INDEX_SIZE];
+static uint16_t norcow_index_count = 0;
+static secbool norcow_index_valid = secfalse;
+
 /*
  * Returns pointer to sector, starting with offset
  * Fails when there is not enough space for data of given size
  */
 static const void *norcow_ptr(uint8_t sector, uint32_t offset, uint32_t size) {
-  ensure(sectrue * (sector <= NORCOW_SECTOR_COUNT), "invalid sector");
+  ensure(sectrue * (sector < NORCOW_SECTOR_COUNT), "invalid sector");
   return flash_get_address(norcow_sectors[sector], offset, size);
 }
 
@@ -81,16 +140,34 @@ static secbool norcow_write(uint8_t sector, uint32_t offset, uint32_t prefix,
 
   ensure(flash_unlock_write(), NULL);
 
-  // write prefix
-  ensure(flash_write_word(norcow_sectors[sector], offset, prefix), NULL);
-  offset += NORCOW_PREFIX_LEN;
-
+  // write prefix and data in bursts of whole words, the last partial word of
+  // data is zero padded
+  uint32_t burst[NORCOW_WRITE_BURST_WORDS];
+  uint32_t count = 1;
+  burst[0] = prefix;
+  uint16_t pos = 0;
   if (data != NULL) {
-    // write data
-    for (uint16_t i = 0; i < len; i++, offset++) {
-      ensure(flash_write_byte(norcow_sectors[sector], offset, data[i]), NULL);
+    while (pos < len) {
+      if (count == NORCOW_WRITE_BURST_WORDS) {
+        ensure(flash_write_block(norcow_sectors[sector], offset, burst, count),
+               NULL);
+        offset += count * NORCOW_WORD_SIZE;
+        count = 0;
+      }
+      uint16_t chunk = len - pos;
+      if (chunk > NORCOW_WORD_SIZE) {
+        chunk = NORCOW_WORD_SIZE;
+      }
+      burst[count] = 0;
+      memcpy(&burst[count], data + pos, chunk);
+      count++;
+      pos += chunk;
     }
-  } else {
+  }
+  ensure(flash_write_block(norcow_sectors[sector], offset, burst, count),
+         NULL);
+  offset += count * NORCOW_WORD_SIZE;
+  if (data == NULL) {
     offset += len;
   }
 
@@ -103,6 +180,18 @@ static secbool norcow_write(uint8_t sector, uint32_t offset, uint32_t prefix,
   return sectrue;
 }
 
+/*
+ * Writes the magic and the version at the start of an erased sector. The
+ * version is written first, so that a sector with a valid magic always has it.
+ */
+static void write_magic(uint8_t sector, uint32_t magic, uint32_t version) {
+  ensure(norcow_write(sector, NORCOW_HEADER_LEN + NORCOW_MAGIC_LEN, ~version,
+                      NULL, 0),
+         "set version failed");
+  ensure(norcow_write(sector, NORCOW_HEADER_LEN, magic, NULL, 0),
+         "set magic failed");
+}
+
 /*
  * Erases sector (and sets a magic)
  */
@@ -128,11 +217,7 @@ static void erase_sector(uint8_t sector, secbool set_magic) {
 #endif
 
   if (sectrue == set_magic) {
-    ensure(norcow_write(sector, NORCOW_HEADER_LEN, NORCOW_MAGIC, NULL, 0),
-           "set magic failed");
-    ensure(norcow_write(sector, NORCOW_HEADER_LEN + NORCOW_MAGIC_LEN,
-                        ~NORCOW_VERSION, NULL, 0),
-           "set version failed");
+    write_magic(sector, NORCOW_MAGIC, NORCOW_VERSION);
   }
 }
 
@@ -187,7 +272,7 @@ static secbool find_start_offset(uint8_t sector, uint32_t *offset,
     return secfalse;
   }
 
-  if (*magic == NORCOW_MAGIC) {
+  if (*magic == NORCOW_MAGIC || *magic == NORCOW_MAGIC_COMPACT) {
     *offset = NORCOW_STORAGE_START;
     *version = ~(magic[1]);
   } else if (*magic == NORCOW_MAGIC_V0) {
@@ -200,6 +285,94 @@ static secbool find_start_offset(uint8_t sector, uint32_t *offset,
   return sectrue;
 }
 
+/*
+ * Checks whether the sector is the writing sector of an unfinished compaction
+ */
+static secbool is_compact_target(uint8_t sector) {
+  const uint32_t *magic =
+      norcow_ptr(sector, NORCOW_HEADER_LEN, NORCOW_MAGIC_LEN);
+  return sectrue * (magic != NULL && *magic == NORCOW_MAGIC_COMPACT);
+}
+
+/*
+ * Returns the position of key in the index, or the position where it should
+ * be inserted if it is not present
+ */
+static uint16_t index_search(uint16_t key) {
+  uint16_t lo = 0, hi = norcow_index_count;
+  while (lo < hi) {
+    uint16_t mid = lo + (hi - lo) / 2;
+    if (norcow_index[mid].key < key) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+/*
+ * Records the offset of the latest instance of key in the index
+ */
+static void index_put(uint16_t key, uint32_t offset) {
+  if (sectrue != norcow_index_valid || key == NORCOW_KEY_DELETED) {
+    return;
+  }
+  uint16_t i = index_search(key);
+  if (i >= norcow_index_count || norcow_index[i].key != key) {
+    if (norcow_index_count >= NORCOW_INDEX_SIZE) {
+      norcow_index_valid = secfalse;
+      return;
+    }
+    memmove(&norcow_index[i + 1], &norcow_index[i],
+            (norcow_index_count - i) * sizeof(norcow_index_entry));
+    norcow_index_count++;
+    norcow_index[i].key = key;
+  }
+  norcow_index[i].offset = offset / NORCOW_WORD_SIZE;
+}
+
+/*
+ * Removes key from the index
+ */
+static void index_remove(uint16_t key) {
+  if (sectrue != norcow_index_valid) {
+    return;
+  }
+  uint16_t i = index_search(key);
+  if (i < norcow_index_count && norcow_index[i].key == key) {
+    norcow_index_count--;
+    memmove(&norcow_index[i], &norcow_index[i + 1],
+            (norcow_index_count - i) * sizeof(norcow_index_entry));
+  }
+}
+
+/*
+ * Rebuilds the index from the items of the writing sector
+ */
+static void index_build(void) {
+  norcow_index_count = 0;
+  norcow_index_valid = sectrue;
+
+  uint32_t offset = 0;
+  uint32_t version = 0;
+  if (sectrue != find_start_offset(norcow_write_sector, &offset, &version)) {
+    norcow_index_valid = secfalse;
+    return;
+  }
+
+  for (;;) {
+    uint16_t k = 0, l = 0;
+    const void *v = NULL;
+    uint32_t pos = 0;
+    if (sectrue != read_item(norcow_write_sector, offset, &k, &v, &l, &pos)) {
+      break;
+    }
+    index_put(k, offset);
+    offset = pos;
+  }
+}
+
 /*
  * Finds item in given sector
  */
@@ -208,12 +381,35 @@ static secbool find_item(uint8_t sector, uint16_t key, const void **val,
   *val = NULL;
   *len = 0;
 
+  if (sectrue == norcow_index_valid && sector == norcow_write_sector &&
+      key != NORCOW_KEY_DELETED) {
+    uint16_t i = index_search(key);
+    if (i >= norcow_index_count || norcow_index[i].key != key) {
+      return secfalse;
+    }
+    uint16_t k = 0;
+    uint32_t pos = 0;
+    uint32_t offset = (uint32_t)norcow_index[i].offset * NORCOW_WORD_SIZE;
+    if (sectrue != read_item(sector, offset, &k, val, len, &pos) ||
+        k != key) {
+      *val = NULL;
+      *len = 0;
+      return secfalse;
+    }
+    return sectrue;
+  }
+
   uint32_t offset = 0;
   uint32_t version = 0;
   if (sectrue != find_start_offset(sector, &offset, &version)) {
     return secfalse;
   }
 
+  // The items preceding the compaction offset have been migrated already.
+  if (sectrue == norcow_compacting && sector == norcow_active_sector) {
+    offset = norcow_compact_offset;
+  }
+
   for (;;) {
     uint16_t k = 0, l = 0;
     const void *v = NULL;
@@ -230,6 +426,55 @@ static secbool find_item(uint8_t sector, uint16_t key, const void **val,
   return sectrue * (*val != NULL);
 }
 
+/*
+ * Finds the current instance of an item. It is looked up in the writing
+ * sector and during compaction also in the active sector.
+ */
+static secbool find_current_item(uint16_t key, uint8_t *sector,
+                                 const void **val, uint16_t *len) {
+  *sector = norcow_write_sector;
+  if (sectrue == find_item(norcow_write_sector, key, val, len)) {
+    return sectrue;
+  }
+  if (sectrue != norcow_compacting) {
+    return secfalse;
+  }
+  *sector = norcow_active_sector;
+  return find_item(norcow_active_sector, key, val, len);
+}
+
+/*
+ * Returns the offset of the item value from the beginning of the sector
+ */
+static uint32_t item_offset(uint8_t sector, const void *val) {
+  return (const uint8_t *)val -
+         (const uint8_t *)norcow_ptr(sector, 0, NORCOW_SECTOR_SIZE);
+}
+
+/*
+ * Marks the item as deleted and erases its data
+ */
+static void delete_item(uint8_t sector, const void *val, uint16_t len) {
+  const uint8_t sector_num = norcow_sectors[sector];
+  uint32_t offset = item_offset(sector, val);
+
+  ensure(flash_unlock_write(), NULL);
+
+  // Update the prefix to indicate that the item has been deleted.
+  uint32_t prefix = (uint32_t)len << 16;
+  ensure(flash_write_word(sector_num, offset - NORCOW_PREFIX_LEN, prefix),
+         NULL);
+
+  // Delete the item data.
+  uint32_t end = offset + len;
+  while (offset < end) {
+    ensure(flash_write_word(sector_num, offset, 0x00000000), NULL);
+    offset += NORCOW_WORD_SIZE;
+  }
+
+  ensure(flash_lock_write(), NULL);
+}
+
 /*
  * Finds first unused offset in given sector
  */
@@ -253,46 +498,172 @@ static uint32_t find_free_offset(uint8_t sector) {
 }
 
 /*
- * Compacts active sector and sets new active sector
+ * Starts compaction of the active sector into the next sector, which is given
+ * the specified version
  */
-static void compact(void) {
-  uint32_t offsetr = 0;
+static secbool compact_start(uint32_t target_version) {
+  uint32_t offset = 0;
   uint32_t version = 0;
-  if (sectrue != find_start_offset(norcow_active_sector, &offsetr, &version)) {
-    return;
+  if (sectrue != find_start_offset(norcow_active_sector, &offset, &version)) {
+    return secfalse;
   }
 
   norcow_write_sector = (norcow_active_sector + 1) % NORCOW_SECTOR_COUNT;
-  erase_sector(norcow_write_sector, sectrue);
-  uint32_t offsetw = NORCOW_STORAGE_START;
+  erase_sector(norcow_write_sector, secfalse);
+  write_magic(norcow_write_sector, NORCOW_MAGIC_COMPACT, target_version);
+  norcow_free_offset = NORCOW_STORAGE_START;
+  norcow_compact_offset = offset;
+  norcow_compact_end = find_free_offset(norcow_active_sector);
+  norcow_compacting = sectrue;
+  index_build();
+  return sectrue;
+}
 
+/*
+ * Migrates at most max_items items from the active sector to the writing
+ * sector. Returns sectrue once there is nothing left to migrate.
+ */
+static secbool compact_migrate(uint32_t max_items) {
+  uint32_t count = 0;
   for (;;) {
-    // read item
     uint16_t k = 0, l = 0;
     const void *v = NULL;
     uint32_t posr = 0;
-    secbool r = read_item(norcow_active_sector, offsetr, &k, &v, &l, &posr);
-    if (sectrue != r) {
-      break;
+    uint32_t offsetr = norcow_compact_offset;
+    if (sectrue !=
+        read_item(norcow_active_sector, offsetr, &k, &v, &l, &posr)) {
+      return sectrue;
     }
-    offsetr = posr;
+    if (count >= max_items) {
+      return secfalse;
+    }
+    norcow_compact_offset = posr;
 
     // skip deleted items
     if (k == NORCOW_KEY_DELETED) {
       continue;
     }
 
-    // copy the item
-    uint32_t posw = 0;
-    ensure(write_item(norcow_write_sector, offsetw, k, v, l, &posw),
-           "compaction write failed");
-    offsetw = posw;
+    // Copy the item unless it has been written since the compaction started
+    // or before the compaction was interrupted.
+    const void *vw = NULL;
+    uint16_t lw = 0;
+    if (sectrue != find_item(norcow_write_sector, k, &vw, &lw)) {
+      uint32_t posw = 0;
+      ensure(write_item(norcow_write_sector, norcow_free_offset, k, v, l,
+                        &posw),
+             "compaction write failed");
+      index_put(k, norcow_free_offset);
+      norcow_free_offset = posw;
+      count++;
+#if NORCOW_STATS
+      norcow_migrated_count++;
+#endif
+    }
+
+    // Mark the copy in the active sector as deleted, so that a resumed
+    // compaction never brings back an item deleted from the writing sector.
+    ensure(flash_unlock_write(), NULL);
+    ensure(flash_write_word(norcow_sectors[norcow_active_sector], offsetr,
+                            (uint32_t)l << 16),
+           NULL);
+    ensure(flash_lock_write(), NULL);
+  }
+}
+
+/*
+ * Deletes the last item of the writing sector if it is a copy of an item which
+ * is still present in the active sector. Such a copy may be incomplete, if the
+ * compaction was interrupted while writing it. The item is migrated again.
+ */
+static void discard_unfinished_copy(void) {
+  uint32_t offset = NORCOW_STORAGE_START;
+  uint16_t key = NORCOW_KEY_DELETED, len = 0;
+  const void *val = NULL;
+  for (;;) {
+    uint16_t k = 0, l = 0;
+    const void *v = NULL;
+    uint32_t pos = 0;
+    if (sectrue != read_item(norcow_write_sector, offset, &k, &v, &l, &pos)) {
+      break;
+    }
+    key = k;
+    val = v;
+    len = l;
+    offset = pos;
+  }
+
+  const void *v = NULL;
+  uint16_t l = 0;
+  if (key != NORCOW_KEY_DELETED &&
+      sectrue == find_item(norcow_active_sector, key, &v, &l)) {
+    delete_item(norcow_write_sector, val, len);
   }
+}
 
+/*
+ * Completes compaction and sets new active sector
+ */
+static void compact_finish(void) {
+  compact_migrate(UINT32_MAX);
+
+  // Erase the old sector before clearing the marker, so that a compaction
+  // interrupted in between is finished by norcow_init().
   erase_sector(norcow_active_sector, secfalse);
+  ensure(flash_unlock_write(), NULL);
+  ensure(flash_write_word(norcow_sectors[norcow_write_sector],
+                          NORCOW_HEADER_LEN, NORCOW_MAGIC),
+         NULL);
+  ensure(flash_lock_write(), NULL);
+
+  uint32_t offset = 0;
   norcow_active_sector = norcow_write_sector;
-  norcow_active_version = NORCOW_VERSION;
-  norcow_free_offset = find_free_offset(norcow_write_sector);
+  find_start_offset(norcow_active_sector, &offset, &norcow_active_version);
+  norcow_compacting = secfalse;
+#if NORCOW_STATS
+  norcow_compaction_count++;
+#endif
+}
+
+/*
+ * Compacts active sector and sets new active sector
+ */
+static void compact(void) {
+  if (sectrue != norcow_compacting &&
+      sectrue != compact_start(norcow_active_version)) {
+    return;
+  }
+  compact_finish();
+}
+
+/*
+ * Checks whether enough space would be reclaimed by compaction
+ */
+static secbool compact_needed(void) {
+  if (norcow_free_offset + NORCOW_COMPACT_FREE_MIN <= NORCOW_SECTOR_SIZE) {
+    return secfalse;
+  }
+
+  uint32_t offset = 0;
+  uint32_t version = 0;
+  if (sectrue != find_start_offset(norcow_active_sector, &offset, &version)) {
+    return secfalse;
+  }
+
+  uint32_t deleted = 0;
+  for (;;) {
+    uint16_t k = 0, l = 0;
+    const void *v = NULL;
+    uint32_t pos = 0;
+    if (sectrue != read_item(norcow_active_sector, offset, &k, &v, &l, &pos)) {
+      break;
+    }
+    if (k == NORCOW_KEY_DELETED) {
+      deleted += pos - offset;
+    }
+    offset = pos;
+  }
+  return sectrue * (deleted >= NORCOW_COMPACT_DELETED_MIN);
 }
 
 /*
@@ -303,9 +674,15 @@ void norcow_init(uint32_t *norcow_version) {
   secbool found = secfalse;
   *norcow_version = 0;
   norcow_active_sector = 0;
+  norcow_compacting = secfalse;
   // detect active sector - starts with magic and has highest version
+  uint8_t compact_target = NORCOW_SECTOR_COUNT;
   for (uint8_t i = 0; i < NORCOW_SECTOR_COUNT; i++) {
     uint32_t offset = 0;
+    if (sectrue == is_compact_target(i)) {
+      compact_target = i;
+      continue;
+    }
     if (sectrue == find_start_offset(i, &offset, &norcow_active_version) &&
         norcow_active_version >= *norcow_version) {
       found = sectrue;
@@ -314,18 +691,47 @@ void norcow_init(uint32_t *norcow_version) {
     }
   }
 
+  // A compaction was interrupted after its old sector had been erased.
+  if (sectrue != found && compact_target < NORCOW_SECTOR_COUNT) {
+    ensure(flash_unlock_write(), NULL);
+    ensure(flash_write_word(norcow_sectors[compact_target], NORCOW_HEADER_LEN,
+                            NORCOW_MAGIC),
+           NULL);
+    ensure(flash_lock_write(), NULL);
+    uint32_t offset = 0;
+    found = find_start_offset(compact_target, &offset, &norcow_active_version);
+    norcow_active_sector = compact_target;
+    *norcow_version = norcow_active_version;
+    compact_target = NORCOW_SECTOR_COUNT;
+  }
+
   // If no active sectors found or version downgrade, then erase.
   if (sectrue != found || *norcow_version > NORCOW_VERSION) {
     norcow_wipe();
     *norcow_version = NORCOW_VERSION;
-  } else if (*norcow_version < NORCOW_VERSION) {
+  } else if (*norcow_version == 0) {
     // Prepare write sector for storage upgrade.
     norcow_write_sector = (norcow_active_sector + 1) % NORCOW_SECTOR_COUNT;
     erase_sector(norcow_write_sector, sectrue);
     norcow_free_offset = find_free_offset(norcow_write_sector);
+    index_build();
+  } else if (compact_target < NORCOW_SECTOR_COUNT) {
+    // Resume the interrupted compaction. If it is a storage upgrade, then the
+    // version of the writing sector is reported, because the upgrade of the
+    // storage contents had been completed before the compaction started.
+    uint32_t offset = 0, version = 0;
+    find_start_offset(norcow_active_sector, &norcow_compact_offset, &version);
+    find_start_offset(compact_target, &offset, norcow_version);
+    norcow_compact_end = find_free_offset(norcow_active_sector);
+    norcow_write_sector = compact_target;
+    norcow_free_offset = find_free_offset(norcow_write_sector);
+    norcow_compacting = sectrue;
+    discard_unfinished_copy();
+    index_build();
   } else {
     norcow_write_sector = norcow_active_sector;
     norcow_free_offset = find_free_offset(norcow_write_sector);
+    index_build();
   }
 }
 
@@ -344,21 +750,77 @@ void norcow_wipe(void) {
   norcow_active_version = NORCOW_VERSION;
   norcow_write_sector = norcow_active_sector;
   norcow_free_offset = NORCOW_STORAGE_START;
+  norcow_compacting = secfalse;
+  norcow_index_count = 0;
+  norcow_index_valid = sectrue;
 }
 
 /*
  * Looks for the given key, returns status of the operation
  */
 secbool norcow_get(uint16_t key, const void **val, uint16_t *len) {
+  if (sectrue == norcow_compacting) {
+    uint8_t sector = 0;
+    return find_current_item(key, &sector, val, len);
+  }
   return find_item(norcow_active_sector, key, val, len);
 }
 
+/*
+ * Reads the next entry during compaction. The items of the writing sector are
+ * listed first, followed by the items of the active sector that have not been
+ * migrated yet. The latter are marked by NORCOW_NEXT_ACTIVE in the offset.
+ */
+static secbool get_next_compacting(uint32_t *offset, uint16_t *key,
+                                   const void **val, uint16_t *len) {
+  if (*offset == 0) {
+    *offset = NORCOW_STORAGE_START;
+  }
+
+  if ((*offset & NORCOW_NEXT_ACTIVE) == 0) {
+    for (;;) {
+      uint32_t pos = 0;
+      if (sectrue !=
+          read_item(norcow_write_sector, *offset, key, val, len, &pos)) {
+        break;
+      }
+      *offset = pos;
+      if (*key != NORCOW_KEY_DELETED) {
+        return sectrue;
+      }
+    }
+    *offset = NORCOW_NEXT_ACTIVE | norcow_compact_offset;
+  }
+
+  for (;;) {
+    uint32_t pos = 0;
+    if (sectrue != read_item(norcow_active_sector,
+                             *offset & ~NORCOW_NEXT_ACTIVE, key, val, len,
+                             &pos)) {
+      return secfalse;
+    }
+    *offset = NORCOW_NEXT_ACTIVE | pos;
+
+    // Skip deleted items and items which already exist in the writing sector.
+    const void *v = NULL;
+    uint16_t l = 0;
+    if (*key != NORCOW_KEY_DELETED &&
+        sectrue != find_item(norcow_write_sector, *key, &v, &l)) {
+      return sectrue;
+    }
+  }
+}
+
 /*
  * Reads the next entry in the storage starting at offset. Returns secfalse if
  * there is none.
  */
 secbool norcow_get_next(uint32_t *offset, uint16_t *key, const void **val,
                         uint16_t *len) {
+  if (sectrue == norcow_compacting) {
+    return get_next_compacting(offset, key, val, len);
+  }
+
   if (*offset == 0) {
     uint32_t version = 0;
     if (sectrue != find_start_offset(norcow_active_sector, offset, &version)) {
@@ -420,23 +882,20 @@ secbool norcow_set_ex(uint16_t key, const void *val, uint16_t len,
     return secfalse;
   }
 
-  const uint8_t sector_num = norcow_sectors[norcow_write_sector];
+  uint8_t sector = 0;
   secbool ret = secfalse;
   const void *ptr = NULL;
   uint16_t len_old = 0;
-  *found = find_item(norcow_write_sector, key, &ptr, &len_old);
+  *found = find_current_item(key, &sector, &ptr, &len_old);
 
   // Try to update the entry if it already exists.
-  uint32_t offset = 0;
   if (sectrue == *found) {
-    offset =
-        (const uint8_t *)ptr -
-        (const uint8_t *)norcow_ptr(norcow_write_sector, 0, NORCOW_SECTOR_SIZE);
+    uint32_t offset = item_offset(sector, ptr);
     if (val != NULL && len_old == len) {
       ret = sectrue;
       ensure(flash_unlock_write(), NULL);
       for (uint16_t i = 0; i < len; i++) {
-        if (sectrue != flash_write_byte(sector_num, offset + i,
+        if (sectrue != flash_write_byte(norcow_sectors[sector], offset + i,
                                         ((const uint8_t *)val)[i])) {
           ret = secfalse;
           break;
@@ -450,21 +909,18 @@ secbool norcow_set_ex(uint16_t key, const void *val, uint16_t len,
   if (secfalse == ret) {
     // Delete the old item.
     if (sectrue == *found) {
-      ensure(flash_unlock_write(), NULL);
-
-      // Update the prefix to indicate that the old item has been deleted.
-      uint32_t prefix = (uint32_t)len_old << 16;
-      ensure(flash_write_word(sector_num, offset - NORCOW_PREFIX_LEN, prefix),
-             NULL);
-
-      // Delete the old item data.
-      uint32_t end = offset + len_old;
-      while (offset < end) {
-        ensure(flash_write_word(sector_num, offset, 0x00000000), NULL);
-        offset += NORCOW_WORD_SIZE;
+      delete_item(sector, ptr, len_old);
+      if (sector == norcow_write_sector) {
+        index_remove(key);
       }
-
-      ensure(flash_lock_write(), NULL);
+    }
+    // Finish the compaction in progress if the new item would not leave
+    // enough space for the items which are still to be migrated.
+    if (sectrue == norcow_compacting &&
+        norcow_free_offset + NORCOW_PREFIX_LEN + len + norcow_compact_end -
+                norcow_compact_offset >
+            NORCOW_SECTOR_SIZE) {
+      compact_finish();
     }
     // Check whether there is enough free space and compact if full.
     if (norcow_free_offset + NORCOW_PREFIX_LEN + len > NORCOW_SECTOR_SIZE) {
@@ -475,12 +931,42 @@ secbool norcow_set_ex(uint16_t key, const void *val, uint16_t len,
     ret = write_item(norcow_write_sector, norcow_free_offset, key, val, len,
                      &pos);
     if (sectrue == ret) {
+      index_put(key, norcow_free_offset);
       norcow_free_offset = pos;
     }
   }
   return ret;
 }
 
+/*
+ * Sets several keys in one append run. Space for all the items is reserved
+ * up front, so that the sector is compacted at most once per batch. The found
+ * array receives whether each key existed before.
+ */
+secbool norcow_set_many(const uint16_t *keys, const void *const *vals,
+                        const uint16_t *lens, uint16_t count,
+                        secbool *found) {
+  uint32_t size = 0;
+  for (uint16_t i = 0; i < count; i++) {
+    if (keys[i] == NORCOW_KEY_FREE) {
+      return secfalse;
+    }
+    size += NORCOW_PREFIX_LEN + lens[i];
+    ALIGN4(size);
+  }
+
+  if (norcow_free_offset + size > NORCOW_SECTOR_SIZE) {
+    compact();
+  }
+
+  for (uint16_t i = 0; i < count; i++) {
+    if (sectrue != norcow_set_ex(keys[i], vals[i], lens[i], &found[i])) {
+      return secfalse;
+    }
+  }
+  return sectrue;
+}
+
 /*
  * Deletes the given key, returns status of the operation.
  */
@@ -490,33 +976,18 @@ secbool norcow_delete(uint16_t key) {
     return secfalse;
   }
 
-  const uint8_t sector_num = norcow_sectors[norcow_write_sector];
+  uint8_t sector = 0;
   const void *ptr = NULL;
   uint16_t len = 0;
-  if (sectrue != find_item(norcow_write_sector, key, &ptr, &len)) {
+  if (sectrue != find_current_item(key, &sector, &ptr, &len)) {
     return secfalse;
   }
 
-  uint32_t offset =
-      (const uint8_t *)ptr -
-      (const uint8_t *)norcow_ptr(norcow_write_sector, 0, NORCOW_SECTOR_SIZE);
-
-  ensure(flash_unlock_write(), NULL);
-
-  // Update the prefix to indicate that the item has been deleted.
-  uint32_t prefix = (uint32_t)len << 16;
-  ensure(flash_write_word(sector_num, offset - NORCOW_PREFIX_LEN, prefix),
-         NULL);
-
-  // Delete the item data.
-  uint32_t end = offset + len;
-  while (offset < end) {
-    ensure(flash_write_word(sector_num, offset, 0x00000000), NULL);
-    offset += NORCOW_WORD_SIZE;
+  delete_item(sector, ptr, len);
+  if (sector == norcow_write_sector) {
+    index_remove(key);
   }
 
-  ensure(flash_lock_write(), NULL);
-
   return sectrue;
 }
 
@@ -525,22 +996,18 @@ secbool norcow_delete(uint16_t key) {
  * into the NORCOW area.
  */
 secbool norcow_update_word(uint16_t key, uint16_t offset, uint32_t value) {
+  uint8_t sector = 0;
   const void *ptr = NULL;
   uint16_t len = 0;
-  if (sectrue != find_item(norcow_write_sector, key, &ptr, &len)) {
+  if (sectrue != find_current_item(key, &sector, &ptr, &len)) {
     return secfalse;
   }
   if ((offset & 3) != 0 || offset >= len) {
     return secfalse;
   }
-  uint32_t sector_offset =
-      (const uint8_t *)ptr -
-      (const uint8_t *)norcow_ptr(norcow_write_sector, 0, NORCOW_SECTOR_SIZE) +
-      offset;
+  uint32_t sector_offset = item_offset(sector, ptr) + offset;
   ensure(flash_unlock_write(), NULL);
-  ensure(flash_write_word(norcow_sectors[norcow_write_sector], sector_offset,
-                          value),
-         NULL);
+  ensure(flash_write_word(norcow_sectors[sector], sector_offset, value), NULL);
   ensure(flash_lock_write(), NULL);
   return sectrue;
 }
@@ -550,27 +1017,36 @@ secbool norcow_update_word(uint16_t key, uint16_t offset, uint32_t value) {
  */
 secbool norcow_update_bytes(const uint16_t key, const uint16_t offset,
                             const uint8_t *data, const uint16_t len) {
+  uint8_t sector = 0;
   const void *ptr = NULL;
   uint16_t allocated_len = 0;
-  if (sectrue != find_item(norcow_write_sector, key, &ptr, &allocated_len)) {
+  if (sectrue != find_current_item(key, &sector, &ptr, &allocated_len)) {
     return secfalse;
   }
   if (offset + len > allocated_len) {
     return secfalse;
   }
-  uint32_t sector_offset =
-      (const uint8_t *)ptr -
-      (const uint8_t *)norcow_ptr(norcow_write_sector, 0, NORCOW_SECTOR_SIZE) +
-      offset;
-  uint8_t sector = norcow_sectors[norcow_write_sector];
+  uint32_t sector_offset = item_offset(sector, ptr) + offset;
   ensure(flash_unlock_write(), NULL);
   for (uint16_t i = 0; i < len; i++, sector_offset++) {
-    ensure(flash_write_byte(sector, sector_offset, data[i]), NULL);
+    ensure(flash_write_byte(norcow_sectors[sector], sector_offset, data[i]),
+           NULL);
   }
   ensure(flash_lock_write(), NULL);
   return sectrue;
 }
 
+/*
+ * Starts storage version upgrade. The items are migrated to a sector of the
+ * current version by norcow_compact_step(), which resumes after a power loss.
+ */
+secbool norcow_upgrade_start(void) {
+  if (norcow_active_version == NORCOW_VERSION) {
+    return sectrue;
+  }
+  return compact_start(NORCOW_VERSION);
+}
+
 /*
  * Complete storage version upgrade
  */
@@ -580,3 +1056,24 @@ secbool norcow_upgrade_finish(void) {
   norcow_active_version = NORCOW_VERSION;
   return sectrue;
 }
+
+/*
+ * Performs one bounded step of incremental compaction. Returns sectrue if
+ * more steps are needed to complete it.
+ */
+secbool norcow_compact_step(void) {
+  if (sectrue != norcow_compacting) {
+    // Do not start compaction during storage upgrade.
+    if (norcow_active_sector != norcow_write_sector ||
+        sectrue != compact_needed()) {
+      return secfalse;
+    }
+    return compact_start(norcow_active_version);
+  }
+
+  if (sectrue != compact_migrate(NORCOW_COMPACT_STEP_ITEMS)) {
+    return sectrue;
+  }
+  compact_finish();
+  return secfalse;
+}
@@ -29,6 +29,11 @@
 
 #include "norcow_config.h"
 
+// Whether norcow counts its compactions, for the storage benchmark.
+#ifndef NORCOW_STATS
+#define NORCOW_STATS 0
+#endif
+
 /*
  * Initialize storage
  */
@@ -60,6 +65,15 @@ secbool norcow_set(uint16_t key, const void *val, uint16_t len);
 secbool norcow_set_ex(uint16_t key, const void *val, uint16_t len,
                       secbool *found);
 
+/*
+ * Sets several keys in one append run, so that the sector is compacted at most
+ * once per batch. If NULL is passed as a value, then the item is only
+ * allocated, as in norcow_set(). The found array receives whether each key
+ * existed before.
+ */
+secbool norcow_set_many(const uint16_t *keys, const void *const *vals,
+                        const uint16_t *lens, uint16_t count, secbool *found);
+
 /*
  * Deletes the given key, returns status of the operation.
  */
@@ -78,9 +92,29 @@ secbool norcow_update_word(uint16_t key, uint16_t offset, uint32_t value);
 secbool norcow_update_bytes(const uint16_t key, const uint16_t offset,
                             const uint8_t *data, const uint16_t len);
 
+/*
+ * Starts storage version upgrade, which is completed by compaction steps
+ */
+secbool norcow_upgrade_start(void);
+
 /*
  * Complete storage version upgrade
  */
 secbool norcow_upgrade_finish(void);
 
+/*
+ * Performs one bounded step of incremental compaction. Returns sectrue if
+ * more steps are needed to complete it.
+ */
+secbool norcow_compact_step(void);
+
+#if NORCOW_STATS
+/*
+ * The number of finished compactions and of items copied by them since the
+ * library was loaded.
+ */
+extern uint32_t norcow_compaction_count;
+extern uint32_t norcow_migrated_count;
+#endif
+
 #endif
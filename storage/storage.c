@@ -25,6 +25,7 @@
 #include "hmac.h"
 #include "memzero.h"
 #include "norcow.h"
+#include "options.h"
 #include "pbkdf2.h"
 #include "rand.h"
 #include "sha2.h"
@@ -71,8 +72,13 @@
 // The total number of iterations to use in PBKDF2.
 #define PIN_ITER_COUNT 20000
 
-// The number of seconds required to derive the KEK and KEIV.
+// The number of seconds required to derive the KEK and KEIV. This is the
+// measured time of the two PBKDF2 runs on the target, see
+// bench_pbkdf2_hmac_sha256_pin in crypto/tests/test_speed.c, so that boards
+// with a faster SHA-256 can override it.
+#ifndef DERIVE_SECS
 #define DERIVE_SECS 1
+#endif
 
 // The length of the guard key in words.
 #define GUARD_KEY_WORDS 1
@@ -132,8 +138,10 @@
 // special handling when both the PIN and wipe code are not set.
 #define WIPE_CODE_EMPTY 0
 
-// The length of the counter tail in words.
-#define COUNTER_TAIL_WORDS 2
+// The length of the counter tail in words. Every increment clears one bit of
+// the tail, so the counter entry only needs to be rewritten once every
+// 32 * COUNTER_TAIL_WORDS increments.
+#define COUNTER_TAIL_WORDS 128
 
 // Values used in the guard key integrity check.
 #define GUARD_KEY_MODULUS 6311
@@ -160,6 +168,19 @@ static const uint8_t FALSE_BYTE = 0x00;
 static const uint32_t TRUE_WORD = 0xC35A69A5;
 static const uint32_t FALSE_WORD = 0x3CA5965A;
 
+#if STORAGE_CACHE_ENTRIES > 0
+// Decrypted values of recently read protected keys. An entry with key 0 is
+// free, because the APP_STORAGE keys are never cached.
+typedef struct {
+  uint16_t key;
+  uint16_t len;
+  uint8_t val[STORAGE_CACHE_MAX_LEN];
+} storage_cache_entry;
+
+static CONFIDENTIAL storage_cache_entry storage_cache[STORAGE_CACHE_ENTRIES];
+static uint8_t storage_cache_next = 0;
+#endif
+
 static void __handle_fault(const char *msg, const char *file, int line,
                            const char *func);
 #define handle_fault(msg) (__handle_fault(msg, __FILE__, __LINE__, __func__))
@@ -167,9 +188,93 @@ static void __handle_fault(const char *msg, const char *file, int line,
 static secbool storage_upgrade(void);
 static secbool storage_set_encrypted(const uint16_t key, const void *val,
                                      const uint16_t len);
+static secbool storage_write_encrypted(const uint16_t key, const void *val,
+                                       const uint16_t len);
 static secbool storage_get_encrypted(const uint16_t key, void *val_dest,
                                      const uint16_t max_len, uint16_t *len);
 
+#if STORAGE_CACHE_ENTRIES > 0
+
+static storage_cache_entry *cache_find(const uint16_t key) {
+  for (uint8_t i = 0; i < STORAGE_CACHE_ENTRIES; i++) {
+    if (storage_cache[i].key == key) {
+      return &storage_cache[i];
+    }
+  }
+  return NULL;
+}
+
+static void cache_clear(void) {
+  memzero(storage_cache, sizeof(storage_cache));
+  storage_cache_next = 0;
+}
+
+static void cache_remove(const uint16_t key) {
+  storage_cache_entry *entry = cache_find(key);
+  if (entry != NULL) {
+    memzero(entry, sizeof(*entry));
+  }
+}
+
+/*
+ * Looks up the decrypted value of key in the cache. Follows the semantics of
+ * storage_get(), but returns secfalse also if the key is not cached.
+ */
+static secbool cache_get(const uint16_t key, void *val_dest,
+                         const uint16_t max_len, uint16_t *len) {
+  const storage_cache_entry *entry = cache_find(key);
+  if (entry == NULL) {
+    return secfalse;
+  }
+  *len = entry->len;
+  if (val_dest == NULL) {
+    return sectrue;
+  }
+  if (*len > max_len) {
+    return secfalse;
+  }
+  memcpy(val_dest, entry->val, *len);
+  return sectrue;
+}
+
+static void cache_put(const uint16_t key, const void *val, const uint16_t len) {
+  if (len > STORAGE_CACHE_MAX_LEN) {
+    return;
+  }
+  storage_cache_entry *entry = cache_find(key);
+  if (entry == NULL) {
+    entry = &storage_cache[storage_cache_next];
+    storage_cache_next = (storage_cache_next + 1) % STORAGE_CACHE_ENTRIES;
+  }
+  memzero(entry, sizeof(*entry));
+  entry->key = key;
+  entry->len = len;
+  memcpy(entry->val, val, len);
+}
+
+#else
+
+static void cache_clear(void) {}
+
+static void cache_remove(const uint16_t key) { (void)key; }
+
+static secbool cache_get(const uint16_t key, void *val_dest,
+                         const uint16_t max_len, uint16_t *len) {
+  (void)key;
+  (void)val_dest;
+  (void)max_len;
+  (void)len;
+  return secfalse;
+}
+
+static void cache_put(const uint16_t key, const void *val, const uint16_t len) {
+  (void)key;
+  (void)val;
+  (void)len;
+}
+
+#endif
+
 static secbool secequal(const void *ptr1, const void *ptr2, size_t n) {
   const uint8_t *p1 = ptr1;
   const uint8_t *p2 = ptr2;
@@ -231,23 +336,38 @@ static secbool auth_init(void) {
 }
 
 /*
- * Update the storage authentication tag with the given key.
+ * Add or remove the given key in the storage authentication sum.
  */
-static secbool auth_update(uint16_t key) {
-  if (sectrue != is_protected(key)) {
-    return sectrue;
-  }
-
+static void auth_sum_update(uint16_t key) {
   uint8_t tag[SHA256_DIGEST_LENGTH] = {0};
   hmac_sha256(cached_sak, SAK_SIZE, (uint8_t *)&key, sizeof(key), tag);
   for (uint32_t i = 0; i < SHA256_DIGEST_LENGTH; i++) {
     authentication_sum[i] ^= tag[i];
   }
+}
+
+/*
+ * Write the storage authentication tag of the current authentication sum.
+ */
+static secbool auth_write_tag(void) {
+  uint8_t tag[SHA256_DIGEST_LENGTH] = {0};
   hmac_sha256(cached_sak, SAK_SIZE, authentication_sum,
               sizeof(authentication_sum), tag);
   return norcow_set(STORAGE_TAG_KEY, tag, STORAGE_TAG_SIZE);
 }
 
+/*
+ * Update the storage authentication tag with the given key.
+ */
+static secbool auth_update(uint16_t key) {
+  if (sectrue != is_protected(key)) {
+    return sectrue;
+  }
+
+  auth_sum_update(key);
+  return auth_write_tag();
+}
+
 /*
  * A secure version of norcow_set(), which updates the storage authentication
  * tag.
@@ -652,6 +772,7 @@ void storage_init(PIN_UI_WAIT_CALLBACK callback, const uint8_t *salt,
                   const uint16_t salt_len) {
   initialized = secfalse;
   unlocked = secfalse;
+  cache_clear();
   norcow_init(&norcow_active_version);
   initialized = sectrue;
   ui_callback = callback;
@@ -858,6 +979,7 @@ secbool storage_is_unlocked(void) {
 void storage_lock(void) {
   unlocked = secfalse;
   memzero(cached_keys, sizeof(cached_keys));
+  cache_clear();
   memzero(authentication_sum, sizeof(authentication_sum));
 }
 
@@ -1140,7 +1262,16 @@ secbool storage_get(const uint16_t key, void *val_dest, const uint16_t max_len,
     if (sectrue != unlocked) {
       return secfalse;
     }
-    return storage_get_encrypted(key, val_dest, max_len, len);
+    if (sectrue == cache_get(key, val_dest, max_len, len)) {
+      return sectrue;
+    }
+    if (sectrue != storage_get_encrypted(key, val_dest, max_len, len)) {
+      return secfalse;
+    }
+    if (val_dest != NULL) {
+      cache_put(key, val_dest, *len);
+    }
+    return sectrue;
   }
 }
 
@@ -1160,6 +1291,15 @@ static secbool storage_set_encrypted(const uint16_t key, const void *val,
     return secfalse;
   }
 
+  return storage_write_encrypted(key, val, len);
+}
+
+/*
+ * Encrypts the data at val using cached_dek as the encryption key and writes
+ * the ciphertext to the space preallocated under key.
+ */
+static secbool storage_write_encrypted(const uint16_t key, const void *val,
+                                       const uint16_t len) {
   // Write the IV to the flash.
   uint8_t buffer[CHACHA20_BLOCK_SIZE] = {0};
   random_buffer(buffer, CHACHA20_IV_SIZE);
@@ -1210,6 +1350,8 @@ secbool storage_set(const uint16_t key, const void *val, const uint16_t len) {
     return secfalse;
   }
 
+  cache_remove(key);
+
   secbool ret = secfalse;
   if ((app & FLAG_PUBLIC) != 0) {
     ret = norcow_set(key, val, len);
@@ -1219,6 +1361,84 @@ secbool storage_set(const uint16_t key, const void *val, const uint16_t len) {
   return ret;
 }
 
+/*
+ * Sets several keys at once. All the keys are checked before anything is
+ * written, the items are appended in one run and the storage authentication
+ * tag is updated only once.
+ */
+secbool storage_set_batch(const uint16_t *keys, const void *const *vals,
+                          const uint16_t *lens, const uint16_t count) {
+  if (sectrue != initialized || count > STORAGE_BATCH_MAX) {
+    return secfalse;
+  }
+
+  const void *norcow_vals[STORAGE_BATCH_MAX] = {0};
+  uint16_t norcow_lens[STORAGE_BATCH_MAX] = {0};
+  secbool found[STORAGE_BATCH_MAX] = {0};
+  for (uint16_t i = 0; i < count; i++) {
+    const uint8_t app = keys[i] >> 8;
+
+    // APP == 0 is reserved for PIN related values
+    if (app == APP_STORAGE) {
+      return secfalse;
+    }
+
+    if (sectrue != unlocked && (app & FLAGS_WRITE) != FLAGS_WRITE) {
+      return secfalse;
+    }
+
+    if ((app & FLAG_PUBLIC) != 0) {
+      norcow_vals[i] = vals[i];
+      norcow_lens[i] = lens[i];
+    } else {
+      if (lens[i] > UINT16_MAX - CHACHA20_IV_SIZE - POLY1305_TAG_SIZE) {
+        return secfalse;
+      }
+      // Only preallocate space for encrypted values.
+      norcow_vals[i] = NULL;
+      norcow_lens[i] = CHACHA20_IV_SIZE + POLY1305_TAG_SIZE + lens[i];
+    }
+  }
+
+  for (uint16_t i = 0; i < count; i++) {
+    cache_remove(keys[i]);
+  }
+
+  if (sectrue !=
+      norcow_set_many(keys, norcow_vals, norcow_lens, count, found)) {
+    return secfalse;
+  }
+
+  secbool ret = sectrue;
+  secbool auth_changed = secfalse;
+  for (uint16_t i = 0; i < count; i++) {
+    if (sectrue == is_protected(keys[i]) && secfalse == found[i]) {
+      auth_sum_update(keys[i]);
+      auth_changed = sectrue;
+    }
+  }
+  if (sectrue == auth_changed) {
+    ret = auth_write_tag();
+  }
+  if (sectrue != ret) {
+    for (uint16_t i = 0; i < count; i++) {
+      if (sectrue == is_protected(keys[i]) && secfalse == found[i]) {
+        auth_sum_update(keys[i]);
+        norcow_delete(keys[i]);
+      }
+    }
+    return secfalse;
+  }
+
+  for (uint16_t i = 0; i < count; i++) {
+    if (norcow_vals[i] == NULL &&
+        sectrue != storage_write_encrypted(keys[i], vals[i], lens[i])) {
+      return secfalse;
+    }
+  }
+  return sectrue;
+}
+
 secbool storage_delete(const uint16_t key) {
   const uint8_t app = key >> 8;
 
@@ -1231,6 +1451,8 @@ secbool storage_delete(const uint16_t key) {
     return secfalse;
   }
 
+  cache_remove(key);
+
   secbool ret = norcow_delete(key);
   if (sectrue == ret) {
     ret = auth_update(key);
@@ -1238,6 +1460,34 @@ secbool storage_delete(const uint16_t key) {
   return ret;
 }
 
+/*
+ * Calls callback for every key of the given app which is present in the
+ * storage, using a single pass over the storage. The values are not read.
+ */
+secbool storage_iter_app(const uint8_t app, STORAGE_ITER_CALLBACK callback,
+                         void *context) {
+  // APP == 0 is reserved for storage related values
+  if (sectrue != initialized || app == APP_STORAGE) {
+    return secfalse;
+  }
+
+  // The keys of protected apps are listed only on an unlocked device.
+  if (sectrue != unlocked && (app & FLAG_PUBLIC) == 0) {
+    return secfalse;
+  }
+
+  uint32_t offset = 0;
+  uint16_t key = 0;
+  uint16_t len = 0;
+  const void *val = NULL;
+  while (sectrue == norcow_get_next(&offset, &key, &val, &len)) {
+    if ((key >> 8) == app) {
+      callback(key, context);
+    }
+  }
+  return sectrue;
+}
+
 secbool storage_set_counter(const uint16_t key, const uint32_t count) {
   const uint8_t app = key >> 8;
   if ((app & FLAG_PUBLIC) == 0) {
@@ -1245,11 +1495,13 @@ secbool storage_set_counter(const uint16_t key, const uint32_t count) {
   }
 
   // The count is stored as a 32-bit integer followed by a tail of "1" bits,
-  // which is used as a tally.
-  uint32_t value[1 + COUNTER_TAIL_WORDS] = {0};
-  memset(value, 0xff, sizeof(value));
-  value[0] = count;
-  return storage_set(key, value, sizeof(value));
+  // which is used as a tally. The item is allocated without a value, so that
+  // the tail is left erased and only the count needs to be written.
+  if (sectrue !=
+      storage_set(key, NULL, (1 + COUNTER_TAIL_WORDS) * sizeof(uint32_t))) {
+    return secfalse;
+  }
+  return norcow_update_word(key, 0, count);
 }
 
 secbool storage_next_counter(const uint16_t key, uint32_t *count) {
@@ -1276,9 +1528,17 @@ secbool storage_next_counter(const uint16_t key, uint32_t *count) {
   }
   uint16_t len_words = len / sizeof(uint32_t);
 
+  // The tail words are cleared in order, so the first word which is not zero
+  // can be found by bisection.
   uint16_t i = 1;
-  while (i < len_words && val_stored[i] == 0) {
-    ++i;
+  uint16_t end = len_words;
+  while (i < end) {
+    uint16_t mid = i + (end - i) / 2;
+    if (val_stored[mid] == 0) {
+      i = mid + 1;
+    } else {
+      end = mid;
+    }
   }
 
   *count = val_stored[0] + 1 + 32 * (i - 1);
@@ -1383,9 +1643,21 @@ void storage_wipe(void) {
   norcow_active_version = NORCOW_VERSION;
   memzero(authentication_sum, sizeof(authentication_sum));
   memzero(cached_keys, sizeof(cached_keys));
+  cache_clear();
   init_wiped_storage();
 }
 
+/*
+ * Performs one bounded step of storage compaction, meant to be called when the
+ * device is idle. Returns sectrue if more steps are needed.
+ */
+secbool storage_compact_step(void) {
+  if (sectrue != initialized) {
+    return secfalse;
+  }
+  return norcow_compact_step();
+}
+
 static void __handle_fault(const char *msg, const char *file, int line,
                            const char *func) {
   static secbool in_progress = secfalse;
@@ -1506,14 +1778,6 @@ static secbool storage_upgrade(void) {
 
     unlocked = secfalse;
     memzero(cached_keys, sizeof(cached_keys));
-  } else {
-    // Copy all entries.
-    uint32_t offset = 0;
-    while (sectrue == norcow_get_next(&offset, &key, &val, &len)) {
-      if (sectrue != norcow_set(key, val, len)) {
-        return secfalse;
-      }
-    }
   }
 
   if (norcow_active_version <= 1) {
@@ -1527,6 +1791,13 @@ static secbool storage_upgrade(void) {
     return secfalse;
   }
 
+  if (norcow_active_version == 0) {
+    norcow_active_version = NORCOW_VERSION;
+    return norcow_upgrade_finish();
+  }
+
+  // The entries are not copied here, they are migrated to a sector of the new
+  // version by storage_compact_step() once the device is running.
   norcow_active_version = NORCOW_VERSION;
-  return norcow_upgrade_finish();
+  return norcow_upgrade_start();
 }
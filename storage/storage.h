@@ -37,9 +37,25 @@
 // Mask for extracting the "real" app_id.
 #define FLAGS_APPID 0x3F
 
+// The maximum number of items written by one storage_set_batch().
+#define STORAGE_BATCH_MAX 16
+
+// The number of decrypted values which storage_get() keeps in RAM while the
+// storage is unlocked. Set to 0 to disable the cache.
+#ifndef STORAGE_CACHE_ENTRIES
+#define STORAGE_CACHE_ENTRIES 4
+#endif
+
+// The maximum length of a value which is kept in the cache.
+#ifndef STORAGE_CACHE_MAX_LEN
+#define STORAGE_CACHE_MAX_LEN 256
+#endif
+
 typedef secbool (*PIN_UI_WAIT_CALLBACK)(uint32_t wait, uint32_t progress,
                                         const char *message);
 
+typedef void (*STORAGE_ITER_CALLBACK)(uint16_t key, void *context);
+
 void storage_init(PIN_UI_WAIT_CALLBACK callback, const uint8_t *salt,
                   const uint16_t salt_len);
 void storage_wipe(void);
@@ -60,8 +76,13 @@ secbool storage_has(const uint16_t key);
 secbool storage_get(const uint16_t key, void *val, const uint16_t max_len,
                     uint16_t *len);
 secbool storage_set(const uint16_t key, const void *val, const uint16_t len);
+secbool storage_set_batch(const uint16_t *keys, const void *const *vals,
+                          const uint16_t *lens, const uint16_t count);
 secbool storage_delete(const uint16_t key);
+secbool storage_iter_app(const uint8_t app, STORAGE_ITER_CALLBACK callback,
+                         void *context);
 secbool storage_set_counter(const uint16_t key, const uint32_t count);
 secbool storage_next_counter(const uint16_t key, uint32_t *count);
+secbool storage_compact_step(void);
 
 #endif
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+
+# Measures the speed and the flash wear of the C storage. Each workload drives
+# a mix of operations and reads the flash counters kept by c/flash.c and
+# c/norcow.c, so that the write amplification can be compared across releases.
+#
+#   counter: only U2F-style counter increments
+#   mixed:   mostly reads, with writes, counter increments and PIN unlocks
+
+import argparse
+import random
+from time import perf_counter
+
+from c.storage import Storage as StorageC
+
+# Unique device ID for testing.
+uid = b"\x67\xce\x6a\xe8\xf7\x9b\x73\x96\x83\x88\x21\x5e"
+
+PIN = 1
+COUNTER_KEY = 0xC001
+WORD_SIZE = 4
+
+# Keys of the mixed workload: protected keys of app 1 and public keys of app 2.
+KEYS = [0x0101 + i for i in range(16)] + [0x8201 + i for i in range(8)]
+
+# Relative frequency of each operation in the mixed workload.
+MIX = (("get", 70), ("set", 15), ("counter", 10), ("pin", 5))
+
+
+class Stats:
+    def __init__(self, s: StorageC) -> None:
+        self.s = s
+        self.start = s._get_stats()
+        self.payload = 0
+        self.rewrites = 0
+        self.times = {}
+
+    def run(self, name: str, op, *args):
+        before = self.s._get_stats()["bytes_written"]
+        start = perf_counter()
+        result = op(*args)
+        elapsed = perf_counter() - start
+        written = self.s._get_stats()["bytes_written"] - before
+        # A counter increment should program a single tally word.
+        if name == "counter" and written > WORD_SIZE:
+            self.rewrites += 1
+        self.times.setdefault(name, []).append(elapsed)
+        return result
+
+    def report(self, workload: str) -> None:
+        end = self.s._get_stats()
+        delta = {k: end[k] - self.start[k] for k in end}
+        ops = sum(len(t) for t in self.times.values())
+        total = sum(sum(t) for t in self.times.values())
+        print("workload:          ", workload)
+        print("operations:        ", ops)
+        print("ops per second:    ", round(ops / total))
+        print("bytes programmed:  ", delta["bytes_written"])
+        if self.payload:
+            # All programmed bytes, including the PIN and counter entries,
+            # per byte of values passed to set().
+            amplification = delta["bytes_written"] / self.payload
+            print("write amplification:", round(amplification, 2))
+        print("sector erases:     ", delta["sectors_erased"])
+        print("compactions:       ", delta["compactions"])
+        print("items migrated:    ", delta["migrated"])
+        if "counter" in self.times:
+            print("counter rewrites:  ", self.rewrites)
+        print("operation      count    mean us   worst us")
+        for name, t in sorted(self.times.items()):
+            print(
+                "{:<10} {:>9} {:>10.1f} {:>10.1f}".format(
+                    name, len(t), sum(t) * 1e6 / len(t), max(t) * 1e6
+                )
+            )
+        print()
+
+
+def init() -> StorageC:
+    s = StorageC()
+    s.init(uid)
+    assert s.unlock(PIN)
+    assert s.set_counter(COUNTER_KEY, 0)
+    return s
+
+
+def counter(count: int, seed: int) -> None:
+    s = init()
+    stats = Stats(s)
+    for i in range(1, count + 1):
+        assert stats.run("counter", s.next_counter, COUNTER_KEY) == i
+    stats.report("counter")
+
+
+def mixed(count: int, seed: int) -> None:
+    rng = random.Random(seed)
+    s = init()
+    for key in KEYS:
+        s.set(key, bytes(rng.randrange(1, 65)))
+    stats = Stats(s)
+    names = [name for name, _ in MIX]
+    weights = [weight for _, weight in MIX]
+    for name in rng.choices(names, weights, k=count):
+        if name == "get":
+            stats.run(name, s.get, rng.choice(KEYS))
+        elif name == "set":
+            val = bytes(rng.randrange(256) for _ in range(rng.randrange(1, 65)))
+            stats.payload += len(val)
+            stats.run(name, s.set, rng.choice(KEYS), val)
+        elif name == "counter":
+            stats.run(name, s.next_counter, COUNTER_KEY)
+        else:
+            s.lock()
+            assert stats.run(name, s.unlock, PIN)
+    stats.report("mixed")
+
+
+WORKLOADS = {"counter": counter, "mixed": mixed}
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="Benchmark the C storage.")
+    parser.add_argument("workload", nargs="*", help=", ".join(WORKLOADS))
+    parser.add_argument("-n", "--ops", type=int, default=20000)
+    parser.add_argument("--seed", type=int, default=0)
+    args = parser.parse_args()
+    for name in args.workload:
+        if name not in WORKLOADS:
+            parser.error("unknown workload: " + name)
+    for name in args.workload or WORKLOADS:
+        WORKLOADS[name](args.ops, args.seed)
+
+
+if __name__ == "__main__":
+    main()
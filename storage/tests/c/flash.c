@@ -54,6 +54,10 @@ static const uint32_t FLASH_SECTOR_TABLE[FLASH_SECTOR_COUNT + 1] = {
 const uint32_t FLASH_SIZE = 0x200000;
 uint8_t *FLASH_BUFFER = NULL;
 
+// Flash wear counters, read by benchmark.py.
+uint32_t FLASH_BYTES_WRITTEN = 0;
+uint32_t FLASH_SECTORS_ERASED = 0;
+
 void flash_init(void) {
   assert(FLASH_SIZE ==
          FLASH_SECTOR_TABLE[FLASH_SECTOR_COUNT] - FLASH_SECTOR_TABLE[0]);
@@ -86,6 +90,7 @@ secbool flash_erase_sectors(const uint8_t *sectors, int len,
     const uint32_t size =
         FLASH_SECTOR_TABLE[sector + 1] - FLASH_SECTOR_TABLE[sector];
     memset(FLASH_BUFFER + offset, 0xFF, size);
+    FLASH_SECTORS_ERASED++;
     if (progress) {
       progress(i + 1, len);
     }
@@ -102,6 +107,7 @@ secbool flash_write_byte(uint8_t sector, uint32_t offset, uint8_t data) {
     return secfalse;  // we cannot change zeroes to ones
   }
   flash[0] = data;
+  FLASH_BYTES_WRITTEN += 1;
   return sectrue;
 }
 
@@ -117,5 +123,26 @@ secbool flash_write_word(uint8_t sector, uint32_t offset, uint32_t data) {
     return secfalse;  // we cannot change zeroes to ones
   }
   flash[0] = data;
+  FLASH_BYTES_WRITTEN += sizeof(data);
+  return sectrue;
+}
+
+secbool flash_write_block(uint8_t sector, uint32_t offset,
+                          const uint32_t *data, uint32_t count) {
+  if (offset % sizeof(uint32_t)) {  // we write only at 4-byte boundary
+    return secfalse;
+  }
+  uint32_t *flash = (uint32_t *)flash_get_address(sector, offset,
+                                                  count * sizeof(uint32_t));
+  if (!flash) {
+    return secfalse;
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    if ((flash[i] & data[i]) != data[i]) {
+      return secfalse;  // we cannot change zeroes to ones
+    }
+  }
+  memcpy(flash, data, count * sizeof(uint32_t));
+  FLASH_BYTES_WRITTEN += count * sizeof(uint32_t);
   return sectrue;
 }
@@ -40,5 +40,9 @@ static inline secbool flash_erase(uint8_t sector) {
 }
 secbool __wur flash_write_byte(uint8_t sector, uint32_t offset, uint8_t data);
 secbool __wur flash_write_word(uint8_t sector, uint32_t offset, uint32_t data);
+// Writes count words starting at the word-aligned offset. Faster than calling
+// flash_write_word() for each word, as the flash is kept programming.
+secbool __wur flash_write_block(uint8_t sector, uint32_t offset,
+                                const uint32_t *data, uint32_t count);
 
 #endif
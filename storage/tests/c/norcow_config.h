@@ -44,4 +44,9 @@
  */
 #define NORCOW_VERSION ((uint32_t)0x00000002)
 
+/*
+ * Count compactions, see benchmark.py.
+ */
+#define NORCOW_STATS 1
+
 #endif
@@ -65,6 +65,14 @@ class Storage:
         if sectrue != self.lib.storage_set(c.c_uint16(key), val, c.c_uint16(len(val))):
             raise RuntimeError("Failed to set value in storage.")
 
+    def set_batch(self, items: dict) -> None:
+        count = len(items)
+        keys = (c.c_uint16 * count)(*items.keys())
+        vals = (c.c_char_p * count)(*items.values())
+        lens = (c.c_uint16 * count)(*(len(v) for v in items.values()))
+        if sectrue != self.lib.storage_set_batch(keys, vals, lens, c.c_uint16(count)):
+            raise RuntimeError("Failed to set values in storage.")
+
     def set_counter(self, key: int, count: int) -> bool:
         return sectrue == self.lib.storage_set_counter(
             c.c_uint16(key), c.c_uint32(count)
@@ -77,9 +85,21 @@ class Storage:
         else:
             return None
 
+    def compact_step(self) -> bool:
+        return sectrue == self.lib.storage_compact_step()
+
     def delete(self, key: int) -> bool:
         return sectrue == self.lib.storage_delete(c.c_uint16(key))
 
+    def iter_app(self, app: int) -> list:
+        keys = []
+        callback = c.CFUNCTYPE(None, c.c_uint16, c.c_void_p)(
+            lambda key, context: keys.append(key)
+        )
+        if sectrue != self.lib.storage_iter_app(c.c_uint8(app), callback, None):
+            raise RuntimeError("Failed to iterate the storage.")
+        return keys
+
     def _dump(self) -> bytes:
         # return just sectors 4 and 16 of the whole flash
         return [
@@ -87,6 +107,16 @@ class Storage:
             self.flash_buffer[0x110000 : 0x110000 + 0x10000],
         ]
 
+    def _get_stats(self) -> dict:
+        # the counters are shared by all instances, callers compare snapshots
+        names = (
+            ("bytes_written", "FLASH_BYTES_WRITTEN"),
+            ("sectors_erased", "FLASH_SECTORS_ERASED"),
+            ("compactions", "norcow_compaction_count"),
+            ("migrated", "norcow_migrated_count"),
+        )
+        return {k: c.c_uint32.in_dll(self.lib, v).value for k, v in names}
+
     def _get_flash_buffer(self) -> bytes:
         return bytes(self.flash_buffer)
 
@@ -66,10 +66,10 @@ WIPE_CODE_TAG_SIZE = 8
 # special handling when both the PIN and wipe code are not set.
 WIPE_CODE_EMPTY = 0
 
-# Size of counter. 4B integer and 8B tail.
-COUNTER_TAIL = 12
-COUNTER_TAIL_SIZE = 8
-COUNTER_MAX_TAIL = 64
+# Size of counter. 4B integer and 512B tail.
+COUNTER_TAIL = 516
+COUNTER_TAIL_SIZE = 512
+COUNTER_MAX_TAIL = 4096
 
 # ----- PIN logs ----- #
 
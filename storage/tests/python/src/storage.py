@@ -172,7 +172,7 @@ class Storage:
 
         base = int.from_bytes(current[:4], sys.byteorder)
         tail = helpers.to_int_by_words(current[4:])
-        tail_count = "{0:064b}".format(tail).count("0")
+        tail_count = "{0:0{1}b}".format(tail, consts.COUNTER_MAX_TAIL).count("0")
         increased_count = base + tail_count + 1
 
         if tail_count == consts.COUNTER_MAX_TAIL:
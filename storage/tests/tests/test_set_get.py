@@ -77,6 +77,48 @@ def test_set_get():
     assert common.memory_equals(sc, sp)
 
 
+def test_set_batch():
+    sc, sp = common.init(unlock=True)
+    items = {
+        0xBEEF: b"Hello",
+        0x0101: b"secret",
+        0x0102: chacha_strings[2],
+        0x8103: b"public",
+    }
+    sc.set_batch(items)
+    for key, val in items.items():
+        sp.set(key, val)
+
+    # overwrite some of the keys and add a new one
+    items = {0x0101: b"new secret", 0x8103: b"", 0x0104: b"added"}
+    sc.set_batch(items)
+    for key, val in items.items():
+        sp.set(key, val)
+
+    for s in (sc, sp):
+        s.lock()
+        assert s.unlock(1)
+        assert s.get(0xBEEF) == b"Hello"
+        assert s.get(0x0101) == b"new secret"
+        assert s.get(0x0102) == chacha_strings[2]
+        assert s.get(0x8103) == b""
+        assert s.get(0x0104) == b"added"
+
+    # nothing is written if any of the keys is invalid
+    with pytest.raises(RuntimeError):
+        sc.set_batch({0x0105: b"valid", 0x0001: b"reserved"})
+    with pytest.raises(RuntimeError):
+        sc.get(0x0105)
+
+    # protected keys cannot be written when locked
+    sc.lock()
+    with pytest.raises(RuntimeError):
+        sc.set_batch({0x8105: b"public", 0x0105: b"protected"})
+    assert sc.unlock(1)
+    with pytest.raises(RuntimeError):
+        sc.get(0x8105)
+
+
 def test_invalid_key():
     for s in common.init(unlock=True):
         with pytest.raises(RuntimeError):
@@ -122,6 +164,55 @@ def test_set_repeated():
         assert common.memory_equals(sc, sp)
 
 
+def test_get_after_change():
+    sc, sp = common.init(unlock=True)
+    for s in (sc, sp):
+        # More keys than the read cache holds, each read twice.
+        for i in range(8):
+            s.set(0x0101 + i, bytes([i]) * 20)
+        for _ in range(2):
+            for i in range(8):
+                assert s.get(0x0101 + i) == bytes([i]) * 20
+        s.set(0x0101, b"changed")
+        assert s.get(0x0101) == b"changed"
+        s.lock()
+        with pytest.raises(RuntimeError):
+            s.get(0x0104)
+        assert s.unlock(1)
+        assert s.get(0x0104) == bytes([3]) * 20
+    assert common.memory_equals(sc, sp)
+
+    sc.set_batch({0x0101: b"batch", 0x0102: b"batch"})
+    assert sc.get(0x0101) == b"batch"
+    assert sc.get(0x0102) == b"batch"
+    assert sc.get(0x0103) == bytes([2]) * 20
+    assert sc.delete(0x0103)
+    with pytest.raises(RuntimeError):
+        sc.get(0x0103)
+
+
+def test_iter_app():
+    sc, _ = common.init(unlock=True)
+    for i in range(1, 101, 7):
+        sc.set(0x0400 + i, b"credential")
+    sc.set(0x0301, b"other app")
+    sc.set(0x8401, b"public")
+    assert sc.delete(0x0408)
+    sc.set(0x0401, b"rewritten")
+
+    expected = [0x0400 + i for i in range(1, 101, 7) if i != 8]
+    assert sorted(sc.iter_app(0x04)) == expected
+    assert sc.iter_app(0x84) == [0x8401]
+    assert sc.iter_app(0x05) == []
+
+    sc.lock()
+    with pytest.raises(RuntimeError):
+        sc.iter_app(0x04)
+    assert sc.iter_app(0x84) == [0x8401]
+    with pytest.raises(RuntimeError):
+        sc.iter_app(0x00)
+
+
 def test_set_similar():
     sc, sp = common.init(unlock=True)
     for s in (sc, sp):
@@ -183,3 +274,15 @@ def test_counter():
         for s in (sc, sp):
             assert i == s.next_counter(0xC001)
     assert common.memory_equals(sc, sp)
+
+
+def test_counter_tail():
+    sc, sp = common.init(unlock=True)
+    for s in (sc, sp):
+        s.set_counter(0xC001, 1000)
+
+    # Run through the whole tail twice so that the counter gets rewritten.
+    for i in range(1001, 1001 + 2 * 4096 + 100):
+        for s in (sc, sp):
+            assert i == s.next_counter(0xC001)
+    assert common.memory_equals(sc, sp)
@@ -1,5 +1,6 @@
 from c0.storage import Storage as StorageC0
 from c.storage import Storage as StorageC
+from python.src import consts
 from python.src.storage import Storage as StoragePy
 
 from . import common
@@ -57,6 +58,69 @@ def test_upgrade():
     check_values(sc1)
 
 
+def v1_flash_buffer():
+    # Storage version 1 differs only in the version number and the wipe code.
+    sp = StoragePy()
+    sp.init(common.test_uid)
+    assert sp.unlock(1)
+    set_values(sp)
+    sp._set_encrypt(consts.VERSION_KEY, b"\x01\x00\x00\x00")
+    sp.nc.delete(consts.WIPE_CODE_DATA_KEY)
+    sectors = sp._dump()
+    sectors[0] = sectors[0][:4] + b"\xfe\xff\xff\xff" + sectors[0][8:]
+
+    sc = StorageC()
+    sc.init(common.test_uid)
+    buf = bytearray(sc._get_flash_buffer())
+    buf[0x010000 : 0x010000 + 0x10000] = sectors[0]
+    buf[0x110000 : 0x110000 + 0x10000] = b"\xff" * 0x10000
+    return bytes(buf)
+
+
+def test_upgrade_v1():
+    buf = v1_flash_buffer()
+    sc = StorageC()
+    sc._set_flash_buffer(buf)
+    sc.init(common.test_uid)
+    # The entries are readable while they are being migrated.
+    check_values(sc)
+    steps = 0
+    while sc.compact_step():
+        steps += 1
+    assert steps > 1
+    check_values(sc)
+
+    sc1 = StorageC()
+    sc1._set_flash_buffer(sc._get_flash_buffer())
+    sc1.init(common.test_uid)
+    assert not sc1.compact_step()
+    check_values(sc1)
+
+
+def test_upgrade_v1_interrupted():
+    buf = v1_flash_buffer()
+    sc = StorageC()
+    sc._set_flash_buffer(buf)
+    sc.init(common.test_uid)
+    assert sc.compact_step()
+    assert sc.compact_step()
+
+    # The migration resumes after a power loss.
+    sc1 = StorageC()
+    sc1._set_flash_buffer(sc._get_flash_buffer())
+    sc1.init(common.test_uid)
+    check_values(sc1)
+    sc1.set(0xBEEF, b"resumed")
+    while sc1.compact_step():
+        pass
+
+    sc2 = StorageC()
+    sc2._set_flash_buffer(sc1._get_flash_buffer())
+    sc2.init(common.test_uid)
+    check_values(sc2)
+    assert sc2.get(0xBEEF) == b"resumed"
+
+
 def test_python_set_sectors():
     sp0 = StoragePy()
     sp0.init(common.test_uid)
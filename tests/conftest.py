@@ -25,12 +25,15 @@ from trezorlib.transport import enumerate_devices, get_transport
 
 from . import ui_tests
 from .device_handler import BackgroundDeviceHandler
+from .emulators import EmulatorWrapper
 from .ui_tests.reporting import testreport
 
 
-def get_device():
+def get_device(emulator=None):
     path = os.environ.get("TREZOR_PATH")
     interact = int(os.environ.get("INTERACT", 0))
+    if emulator is not None:
+        path = "udp:127.0.0.1:{}".format(emulator.port)
     if path:
         try:
             transport = get_transport(path)
@@ -49,8 +52,25 @@ def get_device():
             raise RuntimeError("No debuggable device found")
 
 
+@pytest.fixture(scope="session")
+def _emulator(request):
+    """Emulator owned by this test session.
+
+    With `--emulator core` (or `legacy`), every session starts its own headless
+    emulator on automatically allocated ports. Under pytest-xdist each worker is
+    a separate session, so `pytest -n auto` runs one emulator per worker.
+    """
+    gen = request.config.getoption("emulator")
+    if not gen:
+        yield None
+        return
+
+    with EmulatorWrapper(gen) as emu:
+        yield emu
+
+
 @pytest.fixture(scope="function")
-def client(request):
+def client(request, _emulator):
     """Client fixture.
 
     Every test function that requires a client instance will get it from here.
@@ -71,7 +91,7 @@ def client(request):
     @pytest.mark.setup_client(uninitialized=True)
     """
     try:
-        client = get_device()
+        client = get_device(_emulator)
     except RuntimeError:
         request.session.shouldstop = "No debuggable Trezor is available"
         pytest.fail("No debuggable Trezor is available")
@@ -190,6 +210,12 @@ def pytest_terminal_summary(terminalreporter, exitstatus, config):
 
 
 def pytest_addoption(parser):
+    parser.addoption(
+        "--emulator",
+        action="store",
+        choices=["core", "legacy"],
+        help="Start a dedicated emulator for the test session (one per xdist worker)",
+    )
     parser.addoption(
         "--ui",
         action="store",
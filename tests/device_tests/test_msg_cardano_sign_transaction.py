@@ -207,6 +207,58 @@ def test_cardano_sign_tx(
         assert response.tx_body.hex() == tx_body
 
 
+@pytest.mark.altcoin
+@pytest.mark.cardano
+@pytest.mark.skip_t1  # T1 support is not planned
+@pytest.mark.parametrize(
+    "protocol_magic,inputs,outputs,transactions,tx_hash,tx_body", VALID_VECTORS
+)
+def test_cardano_sign_tx_streamed(
+    client, protocol_magic, inputs, outputs, transactions, tx_hash, tx_body
+):
+    inputs = [cardano.create_input(i) for i in inputs]
+    outputs = [cardano.create_output(o) for o in outputs]
+
+    expected_responses = [
+        messages.CardanoTxRequest(input_index=i) for i in range(len(inputs))
+    ]
+    expected_responses += [
+        messages.CardanoTxRequest(tx_index=i) for i in range(len(transactions))
+    ]
+    for i, output in enumerate(outputs):
+        expected_responses.append(messages.CardanoTxRequest(output_index=i))
+        if not output.address_n:
+            expected_responses.append(
+                messages.ButtonRequest(code=messages.ButtonRequestType.Other)
+            )
+    expected_responses.append(
+        messages.ButtonRequest(code=messages.ButtonRequestType.Other)
+    )
+    expected_responses += [
+        messages.CardanoTxRequest(input_index=i) for i in range(len(inputs))
+    ]
+    expected_responses.append(messages.CardanoSignedTx())
+
+    def input_flow():
+        yield
+        client.debug.swipe_up()
+        client.debug.press_yes()
+        yield
+        client.debug.swipe_up()
+        client.debug.press_yes()
+
+    with client:
+        client.set_expected_responses(expected_responses)
+        client.set_input_flow(input_flow)
+        response = cardano.sign_tx(
+            client, inputs, outputs, transactions, protocol_magic, stream=True
+        )
+        # the outputs of the vectors are already in the order of the full
+        # transaction, so streaming produces the same body
+        assert response.tx_hash.hex() == tx_hash
+        assert response.tx_body.hex() == tx_body
+
+
 @pytest.mark.altcoin
 @pytest.mark.cardano
 @pytest.mark.skip_t1  # T1 support is not planned
@@ -184,3 +184,59 @@ class TestMsgCipherkeyvalue:
     def test_decrypt_badlen(self, client):
         with pytest.raises(Exception):
             misc.decrypt_keyvalue(client, [0, 1, 2], "test", b"testing")
+
+    @pytest.mark.setup_client(mnemonic=MNEMONIC12)
+    def test_encrypt_batch(self, client):
+        res = misc.encrypt_keyvalues(
+            client,
+            [0, 1, 2],
+            "test",
+            [b"testing message!", b"testing message! it is different"],
+            ask_on_encrypt=True,
+            ask_on_decrypt=True,
+        )
+        assert [r.hex() for r in res] == [
+            "676faf8f13272af601776bc31bc14e8f",
+            "676faf8f13272af601776bc31bc14e8f3ae1c88536bf18f1b44f1e4c2c4a613d",
+        ]
+
+    @pytest.mark.setup_client(mnemonic=MNEMONIC12)
+    def test_decrypt_batch(self, client):
+        res = misc.decrypt_keyvalues(
+            client,
+            [0, 1, 2],
+            "test",
+            [
+                bytes.fromhex("676faf8f13272af601776bc31bc14e8f"),
+                bytes.fromhex(
+                    "676faf8f13272af601776bc31bc14e8f3ae1c88536bf18f1b44f1e4c2c4a613d"
+                ),
+            ],
+            ask_on_encrypt=True,
+            ask_on_decrypt=True,
+        )
+        assert res == [b"testing message!", b"testing message! it is different"]
+
+    @pytest.mark.setup_client(mnemonic=MNEMONIC12)
+    def test_batch_ivs(self, client):
+        values = [b"testing message!", b"testing message!"]
+        ivs = [bytes(16), bytes(range(16))]
+        res = misc.encrypt_keyvalues(
+            client, [0, 1, 2], "test", values, ask_on_encrypt=False, ivs=ivs
+        )
+        # each value is ciphered with its own iv
+        assert res[0] != res[1]
+        assert res[0] == misc.encrypt_keyvalue(
+            client, [0, 1, 2], "test", values[0], ask_on_encrypt=False, iv=ivs[0]
+        )
+
+        res = misc.decrypt_keyvalues(
+            client, [0, 1, 2], "test", res, ask_on_encrypt=False, ivs=ivs
+        )
+        assert res == values
+
+    def test_batch_badlen(self, client):
+        with pytest.raises(Exception):
+            misc.encrypt_keyvalues(
+                client, [0, 1, 2], "test", [b"testing message!", b"testing"]
+            )
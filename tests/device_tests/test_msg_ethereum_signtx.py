@@ -264,14 +264,11 @@ class TestMsgEthereumSigntx:
                     messages.ButtonRequest(code=messages.ButtonRequestType.SignTx),
                     messages.ButtonRequest(code=messages.ButtonRequestType.SignTx),
                     messages.EthereumTxRequest(
-                        data_length=1024,
+                        data_length=3075,
                         signature_r=None,
                         signature_s=None,
                         signature_v=None,
                     ),
-                    messages.EthereumTxRequest(data_length=1024),
-                    messages.EthereumTxRequest(data_length=1024),
-                    messages.EthereumTxRequest(data_length=3),
                     messages.EthereumTxRequest(),
                 ]
             )
@@ -305,14 +302,11 @@ class TestMsgEthereumSigntx:
                     messages.ButtonRequest(code=messages.ButtonRequestType.SignTx),
                     messages.ButtonRequest(code=messages.ButtonRequestType.SignTx),
                     messages.EthereumTxRequest(
-                        data_length=1024,
+                        data_length=3075,
                         signature_r=None,
                         signature_s=None,
                         signature_v=None,
                     ),
-                    messages.EthereumTxRequest(data_length=1024),
-                    messages.EthereumTxRequest(data_length=1024),
-                    messages.EthereumTxRequest(data_length=3),
                     messages.EthereumTxRequest(),
                 ]
             )
@@ -357,14 +351,11 @@ class TestMsgEthereumSigntx:
                     messages.ButtonRequest(code=messages.ButtonRequestType.SignTx),
                     messages.ButtonRequest(code=messages.ButtonRequestType.SignTx),
                     messages.EthereumTxRequest(
-                        data_length=1024,
+                        data_length=3075,
                         signature_r=None,
                         signature_s=None,
                         signature_v=None,
                     ),
-                    messages.EthereumTxRequest(data_length=1024),
-                    messages.EthereumTxRequest(data_length=1024),
-                    messages.EthereumTxRequest(data_length=3),
                     messages.EthereumTxRequest(),
                 ]
             )
@@ -0,0 +1,82 @@
+# This file is part of the Trezor project.
+#
+# Copyright (C) 2012-2019 SatoshiLabs and contributors
+#
+# This library is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License version 3
+# as published by the Free Software Foundation.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the License along with this library.
+# If not, see <https://www.gnu.org/licenses/lgpl-3.0.html>.
+
+import pytest
+
+from trezorlib import btc, messages
+from trezorlib.exceptions import TrezorFailure
+from trezorlib.tools import parse_path
+
+pytestmark = [pytest.mark.skip_t1, pytest.mark.skip_ui]
+
+S = messages.InputScriptType
+
+
+@pytest.mark.parametrize(
+    "coin_name, path, script_type",
+    (
+        ("Bitcoin", "m/44h/0h/0h/0", S.SPENDADDRESS),
+        ("Bitcoin", "m/49h/0h/0h/1", S.SPENDP2SHWITNESS),
+        ("Bitcoin", "m/84h/0h/1h/0", S.SPENDWITNESS),
+        ("Testnet", "m/44h/1h/0h/0", S.SPENDADDRESS),
+    ),
+)
+def test_get_addresses(client, coin_name, path, script_type):
+    n = parse_path(path)
+    addresses = btc.get_addresses(client, coin_name, n, 5, 20, script_type)
+    assert addresses == [
+        btc.get_address(client, coin_name, n + [i], script_type=script_type)
+        for i in range(5, 25)
+    ]
+
+
+def test_get_addresses_invalid_range(client):
+    n = parse_path("m/44h/0h/0h/0")
+    with pytest.raises(TrezorFailure, match="Invalid address range"):
+        btc.get_addresses(client, "Bitcoin", n, 0, 0)
+    with pytest.raises(TrezorFailure, match="Invalid address range"):
+        btc.get_addresses(client, "Bitcoin", n, 0, 101)
+    with pytest.raises(TrezorFailure, match="Invalid address range"):
+        btc.get_addresses(client, "Bitcoin", n, 0x7FFFFFFF, 2)
+
+
+def test_get_addresses_forbidden_path(client):
+    # Testnet path on Bitcoin is outside of the keychain
+    with pytest.raises(TrezorFailure, match="Forbidden key path"):
+        btc.get_addresses(client, "Bitcoin", parse_path("m/44h/1h/0h/0"), 0, 2)
+
+
+def test_get_public_nodes(client):
+    paths = [parse_path("m/44h/0h/%dh" % i) for i in range(10)]
+    paths.append(parse_path("m/44h/0h/0h/0/0"))
+    nodes = btc.get_public_nodes(client, paths, coin_name="Bitcoin")
+    assert [node.xpub for node in nodes] == [
+        btc.get_public_node(client, n, coin_name="Bitcoin").xpub for n in paths
+    ]
+
+
+def test_get_public_nodes_script_type(client):
+    paths = [parse_path("m/84h/0h/%dh" % i) for i in range(3)]
+    nodes = btc.get_public_nodes(
+        client, paths, coin_name="Bitcoin", script_type=S.SPENDWITNESS
+    )
+    assert [node.xpub for node in nodes] == [
+        btc.get_public_node(
+            client, n, coin_name="Bitcoin", script_type=S.SPENDWITNESS
+        ).xpub
+        for n in paths
+    ]
+    assert all(node.xpub.startswith("zpub") for node in nodes)
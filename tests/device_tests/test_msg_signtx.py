@@ -423,6 +423,121 @@ class TestMsgSigntx:
             == "6f9775545830731a316a4c2a39515b1890e9c8ab0f9e21e7c6a6ca2c1499116d"
         )
 
+    @pytest.mark.skip_t1
+    def test_two_two_cached(self, client):
+        # Same transaction as in test_two_two, the second input is signed from the
+        # transaction kept by the device after signing the first one.
+        inp1 = proto.TxInputType(
+            address_n=parse_path("44h/0h/0h/0/0"),
+            # amount=100000,
+            prev_hash=TXHASH_c6be22,
+            prev_index=1,
+        )
+
+        inp2 = proto.TxInputType(
+            address_n=parse_path("44h/0h/0h/0/1"),
+            # amount=110000,
+            prev_hash=TXHASH_58497a,
+            prev_index=1,
+        )
+
+        out1 = proto.TxOutputType(
+            address="15Jvu3nZNP7u2ipw2533Q9VVgEu2Lu9F2B",
+            amount=210000 - 100000 - 10000,
+            script_type=proto.OutputScriptType.PAYTOADDRESS,
+        )
+
+        out2 = proto.TxOutputType(
+            address_n=parse_path("44h/0h/0h/1/0"),
+            amount=100000,
+            script_type=proto.OutputScriptType.PAYTOADDRESS,
+        )
+
+        with client:
+            client.set_expected_responses(
+                [
+                    request_input(0),
+                    request_meta(TXHASH_c6be22),
+                    request_input(0, TXHASH_c6be22),
+                    request_output(0, TXHASH_c6be22),
+                    request_output(1, TXHASH_c6be22),
+                    request_input(1),
+                    request_meta(TXHASH_58497a),
+                    request_input(0, TXHASH_58497a),
+                    request_output(0, TXHASH_58497a),
+                    request_output(1, TXHASH_58497a),
+                    request_output(0),
+                    proto.ButtonRequest(code=B.ConfirmOutput),
+                    request_output(1),
+                    proto.ButtonRequest(code=B.SignTx),
+                    request_input(0),
+                    request_input(1),
+                    request_output(0),
+                    request_output(1),
+                    request_input(1),
+                    request_output(0),
+                    request_output(1),
+                    request_finished(),
+                ]
+            )
+            _, serialized_tx = btc.sign_tx(
+                client,
+                "Bitcoin",
+                [inp1, inp2],
+                [out1, out2],
+                details=proto.SignTx(cache_legacy_tx=True),
+                prev_txes=TX_CACHE_MAINNET,
+            )
+
+        assert (
+            tx_hash(serialized_tx).hex()
+            == "6f9775545830731a316a4c2a39515b1890e9c8ab0f9e21e7c6a6ca2c1499116d"
+        )
+
+    @pytest.mark.skip_t1
+    def test_two_two_cached_batched(self, client):
+        # Same as test_two_two_cached, with inputs and outputs sent in batches.
+        inp1 = proto.TxInputType(
+            address_n=parse_path("44h/0h/0h/0/0"),
+            # amount=100000,
+            prev_hash=TXHASH_c6be22,
+            prev_index=1,
+        )
+
+        inp2 = proto.TxInputType(
+            address_n=parse_path("44h/0h/0h/0/1"),
+            # amount=110000,
+            prev_hash=TXHASH_58497a,
+            prev_index=1,
+        )
+
+        out1 = proto.TxOutputType(
+            address="15Jvu3nZNP7u2ipw2533Q9VVgEu2Lu9F2B",
+            amount=210000 - 100000 - 10000,
+            script_type=proto.OutputScriptType.PAYTOADDRESS,
+        )
+
+        out2 = proto.TxOutputType(
+            address_n=parse_path("44h/0h/0h/1/0"),
+            amount=100000,
+            script_type=proto.OutputScriptType.PAYTOADDRESS,
+        )
+
+        with client:
+            _, serialized_tx = btc.sign_tx(
+                client,
+                "Bitcoin",
+                [inp1, inp2],
+                [out1, out2],
+                details=proto.SignTx(cache_legacy_tx=True, batch_size=4),
+                prev_txes=TX_CACHE_MAINNET,
+            )
+
+        assert (
+            tx_hash(serialized_tx).hex()
+            == "6f9775545830731a316a4c2a39515b1890e9c8ab0f9e21e7c6a6ca2c1499116d"
+        )
+
     @pytest.mark.skip_ui
     @pytest.mark.slow
     def test_lots_of_inputs(self, client):
@@ -14,6 +14,9 @@
 # You should have received a copy of the License along with this library.
 # If not, see <https://www.gnu.org/licenses/lgpl-3.0.html>.
 
+import itertools
+import os
+import socket
 import tempfile
 from collections import defaultdict
 from pathlib import Path
@@ -32,6 +35,15 @@ CORE_SRC_DIR = ROOT / "core" / "src"
 
 ENV = {"SDL_VIDEODRIVER": "dummy"}
 
+# Each emulator binds a block of consecutive UDP ports (main, debug, FIDO, ...).
+# Every pytest-xdist worker gets its own range of blocks, so that concurrent
+# workers never race for the same port.
+PORT_BASE = 21400
+PORT_BLOCK = 10
+BLOCKS_PER_WORKER = 20
+
+_blocks = itertools.count()
+
 
 def check_version(tag, version_tuple):
     if tag is not None and tag.startswith("v") and len(tag.split(".")) == 3:
@@ -65,8 +77,39 @@ def get_tags():
 ALL_TAGS = get_tags()
 
 
+def _worker_index():
+    # "gw3" for the fourth xdist worker, unset without xdist
+    worker = os.environ.get("PYTEST_XDIST_WORKER", "gw0")
+    return int(worker[2:]) if worker.startswith("gw") else 0
+
+
+def _ports_free(first, count):
+    socks = []
+    try:
+        for port in range(first, first + count):
+            sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+            socks.append(sock)
+            sock.bind(("127.0.0.1", port))
+        return True
+    except OSError:
+        return False
+    finally:
+        for sock in socks:
+            sock.close()
+
+
+def get_free_port():
+    """Find a block of free UDP ports for a new emulator of this worker."""
+    first = PORT_BASE + _worker_index() * BLOCKS_PER_WORKER * PORT_BLOCK
+    for _ in range(BLOCKS_PER_WORKER):
+        port = first + (next(_blocks) % BLOCKS_PER_WORKER) * PORT_BLOCK
+        if _ports_free(port, PORT_BLOCK):
+            return port
+    raise RuntimeError("No free UDP ports for the emulator")
+
+
 class EmulatorWrapper:
-    def __init__(self, gen, tag=None, storage=None):
+    def __init__(self, gen, tag=None, storage=None, port=None):
         if tag is not None:
             executable = filename_from_tag(gen, tag)
         else:
@@ -80,10 +123,16 @@ class EmulatorWrapper:
             workdir = CORE_SRC_DIR
         else:
             workdir = None
+        if port is None:
+            port = get_free_port()
 
         if gen == "legacy":
             self.emulator = LegacyEmulator(
-                executable, self.profile_dir.name, storage=storage, headless=True,
+                executable,
+                self.profile_dir.name,
+                storage=storage,
+                headless=True,
+                port=port,
             )
         elif gen == "core":
             self.emulator = CoreEmulator(
@@ -92,6 +141,7 @@ class EmulatorWrapper:
                 storage=storage,
                 workdir=workdir,
                 headless=True,
+                port=port,
             )
 
     def __enter__(self):
@@ -15,7 +15,12 @@
 # You should have received a copy of the License along with this library.
 # If not, see <https://www.gnu.org/licenses/lgpl-3.0.html>.
 
+import hashlib
+import io
 import json
+import mmap
+import os
+import struct
 import sys
 from decimal import Decimal
 from pathlib import Path
@@ -28,6 +33,7 @@ from trezorlib import btc, messages, protobuf
 REPOSITORY_ROOT = Path(__file__).parent.parent
 TOOLS_PATH = REPOSITORY_ROOT / "common" / "tools"
 CACHE_PATH = Path(__file__).parent / "txcache"
+INDEX_FILE = CACHE_PATH / ".index.bin"
 
 sys.path.insert(0, str(TOOLS_PATH))
 from coin_info import coin_info  # isort:skip
@@ -51,25 +57,116 @@ def _get_blockbooks():
 BLOCKBOOKS = _get_blockbooks()
 
 
+# The JSON corpus is compiled into INDEX_FILE on first use, so that every test
+# process does not parse it again:
+#
+#   header   magic "TXC1", record count (u32), fingerprint of the corpus (32s)
+#   index    sorted records of SHA-256("<coin slug>/<txhash>") (32s),
+#            offset (u32) and length (u32) of the transaction
+#   data     transactions serialized as TransactionType protobuf messages
+#
+# The fingerprint covers the name, size and mtime of every JSON file, so adding
+# or editing a transaction rebuilds the index. Transactions are only decoded
+# when a test asks for them.
+INDEX_MAGIC = b"TXC1"
+INDEX_HEADER = struct.Struct("<4sI32s")
+INDEX_RECORD = struct.Struct("<32sII")
+
+
+def _index_key(slug, txhash):
+    return hashlib.sha256(f"{slug}/{txhash}".encode()).digest()
+
+
+def _corpus_fingerprint(files):
+    h = hashlib.sha256()
+    for path in files:
+        st = path.stat()
+        name = path.relative_to(CACHE_PATH)
+        h.update(f"{name}:{st.st_size}:{st.st_mtime_ns}\n".encode())
+    return h.digest()
+
+
+def _build_index(files, fingerprint):
+    records = []
+    data = io.BytesIO()
+    for path in files:
+        txdict = json.loads(path.read_text())
+        tx = protobuf.dict_to_proto(messages.TransactionType, txdict)
+        offset = data.tell()
+        protobuf.dump_message(data, tx)
+        key = _index_key(path.parent.name, path.stem)
+        records.append((key, offset, data.tell() - offset))
+    records.sort()
+
+    data_offset = INDEX_HEADER.size + len(records) * INDEX_RECORD.size
+    out = io.BytesIO()
+    out.write(INDEX_HEADER.pack(INDEX_MAGIC, len(records), fingerprint))
+    for key, offset, length in records:
+        out.write(INDEX_RECORD.pack(key, data_offset + offset, length))
+    out.write(data.getvalue())
+
+    # parallel test workers may build the index at the same time
+    tmp = INDEX_FILE.with_name(f"{INDEX_FILE.name}.{os.getpid()}")
+    tmp.write_bytes(out.getvalue())
+    os.replace(tmp, INDEX_FILE)
+
+
+class _Index:
+    def __init__(self):
+        files = sorted(CACHE_PATH.glob("*/*.json"))
+        fingerprint = _corpus_fingerprint(files)
+        try:
+            self._open(fingerprint)
+        except (OSError, ValueError):
+            _build_index(files, fingerprint)
+            self._open(fingerprint)
+
+    def _open(self, fingerprint):
+        with open(INDEX_FILE, "rb") as f:
+            self.data = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        magic, self.count, stored = INDEX_HEADER.unpack_from(self.data)
+        if magic != INDEX_MAGIC or stored != fingerprint:
+            self.data.close()
+            raise ValueError("Stale transaction index")
+
+    def find(self, key):
+        lo, hi = 0, self.count
+        while lo < hi:
+            mid = (lo + hi) // 2
+            offset = INDEX_HEADER.size + mid * INDEX_RECORD.size
+            k, start, length = INDEX_RECORD.unpack_from(self.data, offset)
+            if k < key:
+                lo = mid + 1
+            elif k > key:
+                hi = mid
+            else:
+                return self.data[start : start + length]
+        return None
+
+
+_index = None
+
+
+def _get_index():
+    global _index
+    if _index is None:
+        _index = _Index()
+    return _index
+
+
 class TxCache:
     def __init__(self, coin_name):
         self.slug = coin_name.lower().replace(" ", "_")
 
     def get_tx(self, txhash):
-        try:
-            (CACHE_PATH / self.slug).mkdir()
-        except Exception:
-            pass
-
-        cache_file = CACHE_PATH / self.slug / f"{txhash}.json"
-        if not cache_file.exists():
+        tx = _get_index().find(_index_key(self.slug, txhash))
+        if tx is None:
             raise RuntimeError(
                 f"cache miss for {self.slug} tx {txhash}.\n"
                 "To fix, refer to ./tests/tx_cache.py --help"
             )
 
-        txdict = json.loads(cache_file.read_text())
-        return protobuf.dict_to_proto(messages.TransactionType, txdict)
+        return protobuf.load_message(io.BytesIO(tx), messages.TransactionType)
 
     def __getitem__(self, key):
         return self.get_tx(key.hex())